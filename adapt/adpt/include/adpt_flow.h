@@ -336,6 +336,15 @@ adpt_flow_get_last_matched(struct rule_ctc* p_rule, int64_ofp* p_last_matched);
 int32_ofp
 adpt_flow_add_flow(struct rule_ctc* p_rule);
 
+/**
+ * Add flow entries as one transaction, either all flows are added or none
+ * @param[in] pp_rule                   array of pointers to ovs rules
+ * @param[in] count                     number of rules
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_flow_add_flows(struct rule_ctc** pp_rule, uint32_ofp count);
+
 /**
  * Modify flow entry action
  * @param[in] p_rule                    pointer to ovs rule
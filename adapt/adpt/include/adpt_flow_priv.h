@@ -26,9 +26,11 @@
 #include "ihash.h"
 #include "ivec.h"
 #include "ctc_parser.h"
+#include "ctc_aclqos.h"
 #include "ctc_hash.h"
 #include "ctc_linklist.h"
 #include "afx.h"
+#include "ofp_stats.h"
 
 /*******************************************************************
  *
@@ -67,32 +69,122 @@ struct adpt_flow_info_s
     uint64_ofp packet_count;            /**< packet count */
     uint16_ofp idle_timeout;            /**< idle timeout */
     uint16_ofp rsv;                     /**< reserved */
+    uint32_ofp sweep_gen;               /**< tells the sweep a new flow owns the stats ptr */
     struct rule_ctc* p_rule;            /**< rule struct */
     bool is_idle_timer;                 /**< if this entry records idle_timeout */
     bool need_delete;                   /**< flag to delete */
 };
 typedef struct adpt_flow_info_s adpt_flow_info_t;
 
-struct adpt_flow_entry_id_list_s
+/**
+ @brief a flow visited by the idle timeout stats sweep
+*/
+struct adpt_flow_sweep_entry_s
 {
-    ctc_list_pointer_node_t node;
+    uint32_ofp flow_id;                 /**< flow id */
+    uint16_ofp stats_ptr;               /**< stats ptr of the flow */
+    bool       matched;                 /**< packet count changed since last sweep */
+    uint32_ofp sweep_gen;               /**< sweep_gen of the flow */
+    uint64_ofp packet_count;            /**< packet count read by this sweep */
+};
+typedef struct adpt_flow_sweep_entry_s adpt_flow_sweep_entry_t;
 
-    uint32_ofp entry_id;
+/**
+ @brief packet count of a stats ptr seen by the last sweep, only valid for
+        the flow whose sweep_gen it carries
+*/
+struct adpt_flow_sweep_snapshot_s
+{
+    uint64_ofp packet_count;            /**< packet count */
+    uint32_ofp sweep_gen;               /**< sweep_gen of the flow that had the count */
 };
-typedef struct adpt_flow_entry_id_list_s adpt_flow_entry_id_list_t;
-typedef struct adpt_flow_entry_id_list_s adpt_flow_entry_id_hash_t;
+typedef struct adpt_flow_sweep_snapshot_s adpt_flow_sweep_snapshot_t;
 
-struct adpt_flow_priority_list_s
+/**
+ @brief idle timeout stats sweep, reads the stats of all idle timeout flows
+        in one bulk pass without the flow lock, owned by the stats lock
+*/
+struct adpt_flow_stats_sweep_s
+{
+    uint32_ofp capacity;                /**< size of p_entry, p_sort, p_stats_ptr and p_stats */
+    uint32_ofp count;                   /**< flows in the current sweep */
+    adpt_flow_sweep_entry_t* p_entry;   /**< flows, sorted by stats ptr */
+    adpt_flow_sweep_entry_t* p_sort;    /**< scratch of the sort by stats ptr */
+    uint16_ofp* p_stats_ptr;            /**< stats ptrs passed to the bulk read */
+    ofp_stats_t* p_stats;               /**< stats returned by the bulk read */
+
+    uint32_ofp snapshot_size;           /**< size of p_snapshot */
+    adpt_flow_sweep_snapshot_t* p_snapshot; /**< last packet count, indexed by stats ptr */
+
+    uint32_ofp last_count;              /**< flows read by the last sweep */
+    uint32_ofp last_matched;            /**< flows matched since the sweep before */
+    uint64_ofp last_usec;               /**< wall time of the last sweep */
+    uint64_ofp max_usec;                /**< longest sweep */
+};
+typedef struct adpt_flow_stats_sweep_s adpt_flow_stats_sweep_t;
+
+#define ADPT_FLOW_INDEX_MAX_LEVEL   16
+#define ADPT_FLOW_INDEX_POOL_CHUNK  256
+
+/**
+ @brief node of a flow priority index
+*/
+struct adpt_flow_index_node_s
 {
-    ctc_list_pointer_node_t node;
+    struct hmap_node hmap_node;         /**< in adpt_flow_index_t.entry_id_map */
 
     uint32_ofp priority;
+    uint32_ofp entry_id;
+    uint64_ofp seq;                     /**< insertion sequence */
+    uint8_ofp  level;                   /**< number of next pointers in use */
 
-    ctc_list_pointer_t entry_id_list;   /**< adpt_flow_entry_id_list_t */
-    ctc_hash_t*        entry_id_hash;   /**< adpt_flow_entry_id_hash_t */
+    struct adpt_flow_index_node_s* prev;                            /**< previous node of level 0 */
+    struct adpt_flow_index_node_s* next[ADPT_FLOW_INDEX_MAX_LEVEL];
 };
-typedef struct adpt_flow_priority_list_s adpt_flow_priority_list_t;
-typedef struct adpt_flow_priority_list_s adpt_flow_priority_hash_t;
+typedef struct adpt_flow_index_node_s adpt_flow_index_node_t;
+
+struct adpt_flow_index_chunk_s
+{
+    struct adpt_flow_index_chunk_s* next;
+    adpt_flow_index_node_t nodes[ADPT_FLOW_INDEX_POOL_CHUNK];
+};
+typedef struct adpt_flow_index_chunk_s adpt_flow_index_chunk_t;
+
+/**
+ @brief flow priority index, a skip list of entry ids ordered by descending
+        priority and then by insertion sequence, which is their order in tcam
+*/
+struct adpt_flow_index_s
+{
+    adpt_flow_index_node_t head;        /**< sentinel, head.next[0] is the first entry */
+    uint8_ofp  level;                   /**< highest level in use */
+    uint32_ofp count;
+    uint64_ofp seq;
+    uint32_ofp rand_seed;
+
+    struct hmap entry_id_map;           /**< adpt_flow_index_node_t by entry id */
+
+    adpt_flow_index_node_t*  p_free;    /**< free nodes, linked by next[0] */
+    adpt_flow_index_chunk_t* p_chunk;   /**< node pool */
+};
+typedef struct adpt_flow_index_s adpt_flow_index_t;
+
+/**
+ @brief flow being added, prepared by adpt_flow_add_flow_prepare() and
+        written to the sdk by adpt_flow_add_flow_commit()
+*/
+struct adpt_flow_add_ctx_s
+{
+    struct rule_ctc*        p_rule;
+    uint32_ofp              index;          /**< position in the batch */
+
+    ofp_flow_type_t         flow_type;
+    ctc_aclqos_label_type_t label_type;
+    uint32_ofp              label_id;
+    ctc_aclqos_entry_t      entry;
+    ctc_aclqos_entry_t      extra_entry;    /**< ipv4 copy of a FLOW_TYPE_ANY flow */
+};
+typedef struct adpt_flow_add_ctx_s adpt_flow_add_ctx_t;
 
 /**
  @brief adapter layer flow master data structure
@@ -100,6 +192,10 @@ typedef struct adpt_flow_priority_list_s adpt_flow_priority_hash_t;
 struct adpt_flow_master_s
 {
     afx_timer_t *idle_timeout_timer;
+    afx_timer_t *tcam_defrag_timer;
+    uint32_ofp tcam_change_seq;         /**< bumped on every tcam entry add/remove */
+    uint32_ofp tcam_defrag_seq;         /**< tcam_change_seq seen by the last defrag tick */
+    uint32_ofp sweep_gen;               /**< last sweep_gen given to a flow */
 
     /* ether_type l3type map */
     uint8_ofp ether_type_l3type_map_max_num;
@@ -124,28 +220,19 @@ struct adpt_flow_master_s
 
     uint32_ofp queue_profile_max;
 
-    ctc_list_pointer_t mac_flow_priority_list;      /**< adpt_flow_priority_list_t */
-    ctc_hash_t*        mac_flow_priority_hash;      /**< adpt_flow_priority_hash_t */
-    ctc_list_pointer_t ipv4_flow_priority_list;     /**< adpt_flow_priority_list_t */
-    ctc_hash_t*        ipv4_flow_priority_hash;     /**< adpt_flow_priority_hash_t */
+    adpt_flow_index_t mac_flow_index;               /**< entries of mac key */
+    adpt_flow_index_t ipv4_flow_index;              /**< entries of ipv4 key */
 
     struct ihash flow_info_ihmap;
+    adpt_flow_stats_sweep_t stats_sweep;
 
     uint64_ofp removed_flow_stats_pkt;
     uint64_ofp removed_flow_stats_bytes;
 };
 typedef struct adpt_flow_master_s adpt_flow_master_t;
 
-#define ADPT_FLOW_MAC_PRIORITY_HASH  (g_p_adpt_flow_master->mac_flow_priority_hash)
-#define ADPT_FLOW_MAC_PRIORITY_LIST  (&g_p_adpt_flow_master->mac_flow_priority_list)
-#define ADPT_FLOW_IPV4_PRIORITY_HASH (g_p_adpt_flow_master->ipv4_flow_priority_hash)
-#define ADPT_FLOW_IPV4_PRIORITY_LIST (&g_p_adpt_flow_master->ipv4_flow_priority_list)
-
-#define ADPT_FLOW_PRIORITY_HASH_BLOCK_NUM 10
-#define ADPT_FLOW_PRIORITY_HASH_BLOCK_SIZE 256
-
-#define ADPT_FLOW_ENTRY_ID_HASH_BLOCK_NUM 10
-#define ADPT_FLOW_ENTRY_ID_HASH_BLOCK_SIZE 256
+#define ADPT_FLOW_MAC_INDEX  (&g_p_adpt_flow_master->mac_flow_index)
+#define ADPT_FLOW_IPV4_INDEX (&g_p_adpt_flow_master->ipv4_flow_index)
 
 extern adpt_flow_master_t* g_p_adpt_flow_master;
 
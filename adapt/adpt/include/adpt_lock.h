@@ -0,0 +1,162 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file
+ * @brief This file is the header file of adpt_lock.c
+ *
+ * The adapter state is split into lock domains, each one a reader/writer
+ * lock. Domains are always taken in the order of adpt_lock_t:
+ *
+ *     FLOW -> PORT -> TUNNEL -> STATS
+ *
+ * adpt_lock() takes all domains of a set in that order and adpt_unlock()
+ * releases them. A thread that already holds a domain may take it again,
+ * the inner take only bumps a per thread depth; retaking a domain held for
+ * read for write fails and adpt_lock() then takes nothing.
+ *
+ * The wait and hold times are only recorded after adpt_lock_set_profile(true).
+ */
+
+#ifndef __ADPT_LOCK_H__
+#define __ADPT_LOCK_H__
+
+/******************************************************************************
+* Header Files
+******************************************************************************/
+
+/****************************************************************************
+ *
+ * Defines and Macros
+ *
+ ****************************************************************************/
+
+/**
+ @brief lock domains, in lock order
+*/
+enum adpt_lock_e
+{
+    ADPT_LOCK_FLOW = 0,                 /**< flow db, flow ids, nexthops, opf, tcam */
+    ADPT_LOCK_PORT,                     /**< port db */
+    ADPT_LOCK_TUNNEL,                   /**< gre tunnel db */
+    ADPT_LOCK_STATS,                    /**< idle timeout stats sweep snapshot */
+    ADPT_LOCK_MAX
+};
+typedef enum adpt_lock_e adpt_lock_t;
+
+#define ADPT_LOCK_RD(lock)      (1U << (lock))
+#define ADPT_LOCK_WR(lock)      (1U << ((lock) + ADPT_LOCK_MAX))
+
+/* flow add/modify/delete: looks up ports, binds gre service ids */
+#define ADPT_LOCK_FLOW_UPDATE   (ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_RD(ADPT_LOCK_PORT) \
+                                 | ADPT_LOCK_WR(ADPT_LOCK_TUNNEL))
+
+/* port create/destroy: allocates nexthops and tunnels */
+#define ADPT_LOCK_PORT_UPDATE   (ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_WR(ADPT_LOCK_PORT) \
+                                 | ADPT_LOCK_WR(ADPT_LOCK_TUNNEL))
+
+/* buckets of the wait and hold histograms, bucket i counts [2^(i-1), 2^i) us */
+#define ADPT_LOCK_HIST_NUM      20
+
+/****************************************************************************
+ *
+ * Global and Declaration
+ *
+ ****************************************************************************/
+
+/**
+ @brief contention profile of one domain in one mode
+*/
+struct adpt_lock_stats_s
+{
+    uint64_ofp count;                   /**< acquisitions, nested ones excluded */
+    uint64_ofp contended;               /**< acquisitions that had to wait */
+    uint64_ofp wait_nsec;               /**< total time spent waiting */
+    uint64_ofp wait_max_nsec;           /**< longest wait */
+    uint64_ofp hold_nsec;               /**< total time held */
+    uint64_ofp hold_max_nsec;           /**< longest hold */
+    uint32_ofp wait_hist[ADPT_LOCK_HIST_NUM];   /**< wait time histogram */
+    uint32_ofp hold_hist[ADPT_LOCK_HIST_NUM];   /**< hold time histogram */
+};
+typedef struct adpt_lock_stats_s adpt_lock_stats_t;
+
+/****************************************************************************
+ *
+ * Function
+ *
+ ****************************************************************************/
+
+/**
+ * Take a set of lock domains, on failure none of them is taken
+ * @param[in]  locks                    ADPT_LOCK_RD()/ADPT_LOCK_WR() bits
+ * @return OFP_ERR_XXX, only fails for a write take of a domain the thread
+ *         holds for read
+ */
+int32_ofp
+adpt_lock(uint32_ofp locks);
+
+/**
+ * Release a set of lock domains taken by adpt_lock()
+ * @param[in]  locks                    Same bits as passed to adpt_lock()
+ */
+void
+adpt_unlock(uint32_ofp locks);
+
+/**
+ * Get the name of a lock domain
+ * @param[in]  lock                     Lock domain
+ * @return name
+ */
+const char*
+adpt_lock_name(adpt_lock_t lock);
+
+/**
+ * Turn the timing of the lock acquisitions on or off
+ * @param[in]  enable                   Time the acquisitions
+ */
+void
+adpt_lock_set_profile(bool enable);
+
+/**
+ * Tell whether the lock acquisitions are timed
+ * @return true if they are
+ */
+bool
+adpt_lock_get_profile(void);
+
+/**
+ * Get the contention profile of a lock domain
+ * @param[in]  lock                     Lock domain
+ * @param[out] p_rd_stats               Profile of the read acquisitions
+ * @param[out] p_wr_stats               Profile of the write acquisitions
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock_get_stats(adpt_lock_t lock, adpt_lock_stats_t* p_rd_stats, adpt_lock_stats_t* p_wr_stats);
+
+/**
+ * Clear the contention profile of all lock domains
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock_clear_stats(void);
+
+/**
+ * Init lock domains
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock_init(void);
+
+#endif
@@ -138,6 +138,15 @@ adpt_nexthop_alloc_to_cpu_flex_nh(uint32_ofp flow_id, ofp_nh_offset_t* p_nh_offs
 int32_ofp
 adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offset_t* p_nh_offset);
 
+/**
+ * allocate a multicast flex next-hop that is not shared with other outputs
+ * @param[in] p_action_combo            adpt_flow_action_combo_t
+ * @param[out] p_nh_offset              pointer to ofp_nh_offset_t
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_alloc_unshared_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offset_t* p_nh_offset);
+
 /**
  * allocate the multicast group id
  * @param[out] p_group_nh               pointer to ofp_nh_offset_t
@@ -154,6 +163,31 @@ adpt_nexthop_alloc_mcast_group(ofp_nh_offset_t* p_group_nh);
 int32_ofp
 adpt_nexthop_release_mcast_group(ofp_nh_offset_t* p_group_nh);
 
+/**
+ * get a multicast group replicating to a member set, flows with the same member set share one group
+ * @param[in] p_member_nh               member next-hops, entries with nhid 0 are skipped
+ * @param[in] member_cnt                number of entries in p_member_nh
+ * @param[in] p_old_group_nh            group the flow used before a modify, or NULL. If no group
+ *                                      has the member set and only this flow uses the old group,
+ *                                      the old group is updated in place
+ * @param[out] p_group_nh               pointer to ofp_nh_offset_t, release with adpt_nexthop_release_mcast_group
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_alloc_shared_mcast_group(ofp_nh_offset_t* p_member_nh, uint32_ofp member_cnt,
+                                      const ofp_nh_offset_t* p_old_group_nh, ofp_nh_offset_t* p_group_nh);
+
+/**
+ * set the members of a shared multicast group, used to undo an in place update
+ * @param[in] p_group_nh                pointer to ofp_nh_offset_t
+ * @param[in] p_member_nh               member next-hops, entries with nhid 0 are skipped
+ * @param[in] member_cnt                number of entries in p_member_nh
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_set_mcast_group_members(const ofp_nh_offset_t* p_group_nh, ofp_nh_offset_t* p_member_nh,
+                                     uint32_ofp member_cnt);
+
 /**
  * allocate nexthop offset by type
  * @param[in]  type                     ofp_nh_type_t
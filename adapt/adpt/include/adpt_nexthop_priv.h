@@ -20,18 +20,70 @@
 #ifndef __ADPT_NEXTHOP_PRIV_H__
 #define __ADPT_NEXTHOP_PRIV_H__
 
+#include "hmap.h"
+
 /*******************************************************************
 *
 *Structures and macros, enums
 *
 ********************************************************************/
 
+/**
+ @brief shared flex nexthop, keyed on its edit
+*/
+struct adpt_nexthop_flex_node_s
+{
+    struct hmap_node param_node;        /**< in adpt_nexthop_master_t.flex_param_map */
+    struct hmap_node nhid_node;         /**< in adpt_nexthop_master_t.flex_nhid_map */
+
+    ctc_flex_nh_param_t param;          /**< edit with dsnh_offset cleared */
+    ofp_nh_offset_t nh;                 /**< hardware nexthop */
+    uint32_ofp ref_cnt;                 /**< outputs using nh */
+};
+typedef struct adpt_nexthop_flex_node_s adpt_nexthop_flex_node_t;
+
+/**
+ @brief member of a shared mcast group
+*/
+struct adpt_nexthop_mcast_member_s
+{
+    uint32_ofp nhid;
+    uint32_ofp port_check_discard;
+};
+typedef struct adpt_nexthop_mcast_member_s adpt_nexthop_mcast_member_t;
+
+/**
+ @brief shared mcast group, keyed on its member set
+*/
+struct adpt_nexthop_mcast_node_s
+{
+    struct hmap_node member_node;       /**< in adpt_nexthop_master_t.mcast_member_map */
+    struct hmap_node nhid_node;         /**< in adpt_nexthop_master_t.mcast_nhid_map */
+
+    ofp_nh_offset_t group_nh;           /**< hardware group */
+    uint32_ofp ref_cnt;                 /**< flows using group_nh */
+    uint32_ofp member_cnt;
+    adpt_nexthop_mcast_member_t member[MAX_OUTPUT_PORT];   /**< sorted by nhid, a nhid once */
+};
+typedef struct adpt_nexthop_mcast_node_s adpt_nexthop_mcast_node_t;
+
 /**
  @brief adapter layer master
 */
 struct adpt_nexthop_master_s
 {
     ofp_nh_offset_t group_nh;
+
+    struct hmap flex_param_map;         /**< adpt_nexthop_flex_node_t by edit */
+    struct hmap flex_nhid_map;          /**< adpt_nexthop_flex_node_t by nhid */
+    uint32_ofp flex_ref_cnt;            /**< outputs using a shared flex nexthop */
+
+    struct hmap mcast_member_map;       /**< adpt_nexthop_mcast_node_t by member set */
+    struct hmap mcast_nhid_map;         /**< adpt_nexthop_mcast_node_t by group nhid */
+    uint32_ofp mcast_ref_cnt;           /**< flows using a shared mcast group */
+    uint32_ofp mcast_lookup_cnt;        /**< group lookups */
+    uint32_ofp mcast_hit_cnt;           /**< lookups that found a group */
+    uint32_ofp mcast_update_cnt;        /**< groups updated in place by a flow modify */
 };
 typedef struct adpt_nexthop_master_s adpt_nexthop_master_t;
 
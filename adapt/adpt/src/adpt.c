@@ -26,6 +26,7 @@
 #include "ofp_api.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_opf.h"
 #include "adpt_port.h"
 #include "adpt_flow.h"
@@ -102,6 +103,7 @@ int32_ofp
 adpt_module_init(void)
 {
     adpt_get_current_profile();
+    ADPT_ERROR_RETURN(adpt_lock_init());
     ADPT_ERROR_RETURN(adpt_message_init());
     ADPT_ERROR_RETURN(adpt_opf_init());
     ADPT_ERROR_RETURN(adpt_port_init());
@@ -24,7 +24,6 @@
  ****************************************************************************/
 #include "afx.h"
 #include "sal.h"
-#include "sal_mutex.h"
 
 #include "ofp-print.h"
 #include "ofp-actions.h"
@@ -34,6 +33,7 @@
 #include "ofp_lib.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_port.h"
 #include "adpt_flow.h"
 #include "adpt_flow_priv.h"
@@ -56,7 +56,6 @@
  * Global and Declaration
  *
  ****************************************************************************/
-extern sal_mutex_t *pg_mutex;
 
 adpt_flow_master_t* g_p_adpt_flow_master;
 VLOG_DEFINE_THIS_MODULE(adapt_flow);
@@ -1252,6 +1251,37 @@ adpt_flow_check_output_action(struct list *flow_actions, ofp_nexthop_info_t* p_n
     return OFP_ERR_SUCCESS;      
 }
 
+/**
+ * Allocate the flex next-hop of an output, a group holds a member next-hop once, so an edit
+ * the flow already outputs gets its own next-hop and the packet is still sent per output
+ * @param[in]  p_action             OVS rule actions(layer 2 field modification and output)
+ * @param[in]  p_member_nh_array    Next-hop members of the flow mapped so far
+ * @param[in]  member_cnt           Next-hop member count
+ * @param[out] p_member_nh          Next-hop of the output
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_alloc_member_flex_nh(adpt_flow_action_combo_t* p_action,
+                               const ofp_nh_offset_t* p_member_nh_array, uint32_ofp member_cnt,
+                               ofp_nh_offset_t* p_member_nh)
+{
+    uint32_ofp i;
+
+    ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_flex_nh(p_action, p_member_nh));
+
+    for (i = 0; i < member_cnt; i++)
+    {
+        if (p_member_nh_array[i].nhid == p_member_nh->nhid)
+        {
+            adpt_nexthop_release_nh_info(p_member_nh);
+            ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_unshared_flex_nh(p_action, p_member_nh));
+            break;
+        }
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
 /** 
  * add a combo action that its about to output to all
  * @param[in]  p_action             OVS rule actions(layer 2 field modification and output)
@@ -1276,7 +1306,8 @@ adpt_flow_check_output_action(struct list *flow_actions, ofp_nexthop_info_t* p_n
     {
         p_action->output_gport = gport;
         SET_FLAG(p_action->flag, OFP_FLOW_ACTION_FIELD_OUTPUT);
-        ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_flex_nh(p_action, &member_nh));
+        ADPT_FLOW_ERROR_RETURN(adpt_flow_alloc_member_flex_nh(p_action, p_member_nh_array, *p_member_cnt,
+                                                              &member_nh));
 
         p_member_nh_array[*p_member_cnt].nhid    = member_nh.nhid;
         p_member_nh_array[*p_member_cnt].offset  = member_nh.offset;
@@ -1509,7 +1540,8 @@ adpt_flow_map_output_action_to_mcast_members(uint16_ofp in_port,
         if (adpt_port_is_physical_port(ofp_port))
         {
             ADPT_FLOW_ERROR_RETURN(adpt_port_get_gport_by_ofport(ofp_port, &action_combo.output_gport));
-            ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_flex_nh(&action_combo, &member_nh));
+            ADPT_FLOW_ERROR_RETURN(adpt_flow_alloc_member_flex_nh(&action_combo, p_member_nh_array,
+                                                                  *p_member_cnt, &member_nh));
         }
         else if (adpt_port_is_tunnel_port(ofp_port))
         {
@@ -1545,7 +1577,8 @@ adpt_flow_map_output_action_to_mcast_members(uint16_ofp in_port,
             {
                 ADPT_FLOW_ERROR_RETURN(
                     adpt_port_get_gport_by_ofport(in_port, &action_combo.output_gport));
-                ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_flex_nh(&action_combo, &member_nh));
+                ADPT_FLOW_ERROR_RETURN(adpt_flow_alloc_member_flex_nh(&action_combo, p_member_nh_array,
+                                                                      *p_member_cnt, &member_nh));
             }
             else if (adpt_port_is_tunnel_port(in_port))
             {
@@ -1593,14 +1626,13 @@ adpt_flow_map_output_action_to_mcast_members(uint16_ofp in_port,
 /** 
  * Map a flow action to a nexthop and also create the nexthop
  * @param[in] p_rule            struct rule_ctc
+ * @param[in] p_old_nh_info     nexthop info the rule used before a modify, or NULL
  * @return OFP_ERR_XXX
  */
 static int32_ofp
-adpt_flow_add_output_action(struct rule_ctc* p_rule)
+adpt_flow_add_output_action(struct rule_ctc* p_rule, const ofp_nexthop_info_t* p_old_nh_info)
 {
     uint32_ofp member_cnt = 0;
-    uint32_ofp member_idx;
-    ofp_nh_offset_t group_nh;
     uint16_ofp in_port;
     bool group_valid = false;
     
@@ -1617,11 +1649,9 @@ adpt_flow_add_output_action(struct rule_ctc* p_rule)
         return OFP_ERR_SUCCESS;
     }
 
-    memset(&group_nh, 0, sizeof(group_nh));
-    ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_mcast_group(&group_nh));
-    p_rule->nh_info.main_nh.nhid   = group_nh.nhid;
-    p_rule->nh_info.main_nh.offset = group_nh.offset;
-    p_rule->nh_info.use_mcast      = TRUE;
+    /* the members are mapped first, flows with the same members share one mcast group */
+    memset(&p_rule->nh_info.main_nh, 0, sizeof(ofp_nh_offset_t));
+    p_rule->nh_info.use_mcast = TRUE;
 
     in_port = OFP_FLOW_INPORT_BASED(p_rule) == FLOW_TYPE_PORT_BASED_PER_PORT ? p_rule->match.flow.in_port : 0;
     ADPT_FLOW_ERROR_RETURN(adpt_flow_map_output_action_to_mcast_members(
@@ -1629,13 +1659,10 @@ adpt_flow_add_output_action(struct rule_ctc* p_rule)
         p_rule->nh_info.member_nh,
         &member_cnt));
 
-    for (member_idx = 0; member_idx < member_cnt; member_idx ++)
-    {
-        ADPT_FLOW_ERROR_RETURN(hal_nexthop_add_mcast_member(
-            group_nh.nhid, 
-            p_rule->nh_info.member_nh[member_idx].nhid,
-            p_rule->nh_info.member_nh[member_idx].port_check_discard));
-    }
+    ADPT_FLOW_ERROR_RETURN(adpt_nexthop_alloc_shared_mcast_group(
+        p_rule->nh_info.member_nh, member_cnt,
+        (p_old_nh_info && p_old_nh_info->use_mcast) ? &p_old_nh_info->main_nh : NULL,
+        &p_rule->nh_info.main_nh));
 
     return OFP_ERR_SUCCESS;
 }
@@ -1643,11 +1670,13 @@ adpt_flow_add_output_action(struct rule_ctc* p_rule)
 /** 
  * Map a flow action to Qos action
  * @param[in]  p_rule            Pointer to struct rule_ctc
+ * @param[in]  p_old_nh_info     Nexthop info the rule used before a modify, or NULL
  * @param[out] p_qos_action      Pointer to Qos action
  * @return OFP_ERR_XXX
  */
 static int32_ofp
-adpt_flow_map_flow_action(struct rule_ctc *p_rule, ctc_aclqos_action_t *p_qos_action)
+adpt_flow_map_flow_action(struct rule_ctc *p_rule, const ofp_nexthop_info_t *p_old_nh_info,
+                          ctc_aclqos_action_t *p_qos_action)
 {
     int32_ofp ret = 0;
     const struct list *flow_actions = &p_rule->flow_actions;
@@ -1672,7 +1701,7 @@ adpt_flow_map_flow_action(struct rule_ctc *p_rule, ctc_aclqos_action_t *p_qos_ac
     }
     else
     {
-        ret = adpt_flow_add_output_action(p_rule);
+        ret = adpt_flow_add_output_action(p_rule, p_old_nh_info);
         if (ret)
         {
             adpt_nexthop_release_nh_info_res(&(p_rule->nh_info));
@@ -1745,6 +1774,7 @@ adpt_flow_add_flow_to_sdk(struct rule_ctc* p_rule, uint32_ofp label_id, ctc_aclq
     {
         return OFP_ERR_INVALID_PARAM;
     }
+    g_p_adpt_flow_master->tcam_change_seq++;
     
     return OFP_ERR_SUCCESS;
 }
@@ -1779,6 +1809,7 @@ adpt_flow_del_flow_from_sdk(const struct rule_ctc* p_rule, uint32_ofp label_id,
     {
         return OFP_ERR_INVALID_PARAM;
     }
+    g_p_adpt_flow_master->tcam_change_seq++;
     
     return OFP_ERR_SUCCESS;
 }
@@ -2022,6 +2053,7 @@ adpt_flow_add_flow_timer(struct rule_ctc* p_rule)
     kal_memset(flow_info_p, 0x0, sizeof(adpt_flow_info_t));
 
     flow_info_p->p_rule = p_rule;
+    flow_info_p->sweep_gen = ++g_p_adpt_flow_master->sweep_gen;
 
     if (0 == p_rule->up.idle_timeout)
     {
@@ -2322,23 +2354,153 @@ adpt_flow_clear_all_flow_stats(void)
 }
 
 /**
- * Handle idle timeout timer
- * @param[in] p_arg             Not used
+ * Sort the sweep entries by stats ptr, a radix sort on the low then the high
+ * byte of the stats ptr through p_sort
+ * @param[in] p_sweep           Pointer to the stats sweep
+ */
+static void
+adpt_flow_sweep_sort(adpt_flow_stats_sweep_t* p_sweep)
+{
+    uint32_ofp count[2][256];
+    uint32_ofp sum[2] = {0, 0};
+    uint32_ofp tmp;
+    uint32_ofp i, b;
+
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < p_sweep->count; i++)
+    {
+        count[0][p_sweep->p_entry[i].stats_ptr & 0xFF]++;
+        count[1][p_sweep->p_entry[i].stats_ptr >> 8]++;
+    }
+    for (b = 0; b < 256; b++)
+    {
+        tmp = count[0][b];
+        count[0][b] = sum[0];
+        sum[0] += tmp;
+        tmp = count[1][b];
+        count[1][b] = sum[1];
+        sum[1] += tmp;
+    }
+
+    for (i = 0; i < p_sweep->count; i++)
+    {
+        p_sweep->p_sort[count[0][p_sweep->p_entry[i].stats_ptr & 0xFF]++] = p_sweep->p_entry[i];
+    }
+    for (i = 0; i < p_sweep->count; i++)
+    {
+        p_sweep->p_entry[count[1][p_sweep->p_sort[i].stats_ptr >> 8]++] = p_sweep->p_sort[i];
+    }
+}
+
+/**
+ * Make room for count flows in the sweep arrays
+ * @param[in] p_sweep           Pointer to the stats sweep
+ * @param[in] count             Number of flows
  * @return OFP_ERR_XXX
  */
 static int32_ofp
-adpt_flow_idle_timeout_timer(void* p_arg)
+adpt_flow_sweep_reserve(adpt_flow_stats_sweep_t* p_sweep, uint32_ofp count)
+{
+    uint32_ofp capacity;
+    void* p_entry;
+    void* p_sort;
+    void* p_stats_ptr;
+    void* p_stats;
+
+    if (count <= p_sweep->capacity)
+    {
+        return OFP_ERR_SUCCESS;
+    }
+
+    capacity = p_sweep->capacity ? p_sweep->capacity : 256;
+    while (capacity < count)
+    {
+        capacity *= 2;
+    }
+
+    p_entry = realloc(p_sweep->p_entry, capacity * sizeof(adpt_flow_sweep_entry_t));
+    if (p_entry)
+    {
+        p_sweep->p_entry = p_entry;
+    }
+    p_sort = realloc(p_sweep->p_sort, capacity * sizeof(adpt_flow_sweep_entry_t));
+    if (p_sort)
+    {
+        p_sweep->p_sort = p_sort;
+    }
+    p_stats_ptr = realloc(p_sweep->p_stats_ptr, capacity * sizeof(uint16_ofp));
+    if (p_stats_ptr)
+    {
+        p_sweep->p_stats_ptr = p_stats_ptr;
+    }
+    p_stats = realloc(p_sweep->p_stats, capacity * sizeof(ofp_stats_t));
+    if (p_stats)
+    {
+        p_sweep->p_stats = p_stats;
+    }
+    if (!p_entry || !p_sort || !p_stats_ptr || !p_stats)
+    {
+        return OFP_ERR_NO_MEMORY;
+    }
+    p_sweep->capacity = capacity;
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Make the snapshot array cover stats_ptr
+ * @param[in] p_sweep           Pointer to the stats sweep
+ * @param[in] stats_ptr         Stats ptr
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_sweep_reserve_snapshot(adpt_flow_stats_sweep_t* p_sweep, uint16_ofp stats_ptr)
+{
+    uint32_ofp size;
+    adpt_flow_sweep_snapshot_t* p_snapshot;
+
+    if (stats_ptr < p_sweep->snapshot_size)
+    {
+        return OFP_ERR_SUCCESS;
+    }
+
+    size = p_sweep->snapshot_size ? p_sweep->snapshot_size : 1024;
+    while (size <= stats_ptr)
+    {
+        size *= 2;
+    }
+
+    p_snapshot = realloc(p_sweep->p_snapshot, size * sizeof(adpt_flow_sweep_snapshot_t));
+    if (NULL == p_snapshot)
+    {
+        return OFP_ERR_NO_MEMORY;
+    }
+    memset(p_snapshot + p_sweep->snapshot_size, 0,
+           (size - p_sweep->snapshot_size) * sizeof(adpt_flow_sweep_snapshot_t));
+    p_sweep->p_snapshot    = p_snapshot;
+    p_sweep->snapshot_size = size;
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Collect the flows to sweep, the flow lock must be held for write
+ * @param[in] p_sweep           Pointer to the stats sweep
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_sweep_collect(adpt_flow_stats_sweep_t* p_sweep)
 {
     uint32_ofp flow_id = 0;
     struct ihash *p_flow_info_ihmap;
     adpt_flow_info_t * p_flow_info;
     struct ihash_node *node, *next;
-    struct ofp_stats_s new_stats;
-    
-    sal_mutex_lock(pg_mutex);
-    
+    adpt_flow_sweep_entry_t* p_entry;
+
     p_flow_info_ihmap = adpt_flowdb_get_flow_info_ihmap();
-    
+    p_sweep->count = 0;
+    ADPT_ERROR_RETURN(adpt_flow_sweep_reserve(p_sweep, ihash_count(p_flow_info_ihmap)));
+
     IHASH_FOR_EACH_SAFE(node, next, p_flow_info_ihmap)
     {
         flow_id = node->key;
@@ -2354,28 +2516,189 @@ adpt_flow_idle_timeout_timer(void* p_arg)
         }
 
         /* if a flow is not idle_timer, do not read stats */
-        if (false == p_flow_info->is_idle_timer)
+        if (false == p_flow_info->is_idle_timer
+            || SPECIAL_STATS_PTR == p_flow_info->p_rule->stats_ptr)
         {
             continue;
         }
 
-        new_stats.packet_count = 0;
-        new_stats.byte_count   = 0;
+        p_entry = &p_sweep->p_entry[p_sweep->count++];
+        p_entry->flow_id   = flow_id;
+        p_entry->stats_ptr = p_flow_info->p_rule->stats_ptr;
+        p_entry->sweep_gen = p_flow_info->sweep_gen;
+        p_entry->matched   = false;
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Read the stats of the collected flows and diff them against the snapshot,
+ * the stats lock must be held for write. A snapshot left by an older flow on
+ * the same stats ptr counts as 0, the stats ptr is cleared when it is freed.
+ * @param[in] p_sweep           Pointer to the stats sweep
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_sweep_read(adpt_flow_stats_sweep_t* p_sweep)
+{
+    adpt_flow_sweep_entry_t* p_entry;
+    adpt_flow_sweep_snapshot_t* p_snapshot;
+    uint32_ofp i;
+
+    /* Walk the stats sram in address order */
+    adpt_flow_sweep_sort(p_sweep);
+    for (i = 0; i < p_sweep->count; i++)
+    {
+        p_sweep->p_stats_ptr[i] = p_sweep->p_entry[i].stats_ptr;
+    }
+    if (p_sweep->count)
+    {
+        ADPT_ERROR_RETURN(adpt_flow_sweep_reserve_snapshot(p_sweep,
+                              p_sweep->p_stats_ptr[p_sweep->count - 1]));
+    }
 
-        ofp_get_flow_stats(p_flow_info->p_rule, &new_stats);
+    ADPT_ERROR_RETURN(hal_stats_get_stats_bulk(p_sweep->p_stats_ptr, p_sweep->count,
+                                               p_sweep->p_stats));
 
-        if (new_stats.packet_count != p_flow_info->packet_count)
+    p_sweep->last_matched = 0;
+    for (i = 0; i < p_sweep->count; i++)
+    {
+        p_entry = &p_sweep->p_entry[i];
+        p_entry->packet_count = p_sweep->p_stats[i].packet_count;
+        p_snapshot = &p_sweep->p_snapshot[p_entry->stats_ptr];
+        if (p_snapshot->sweep_gen != p_entry->sweep_gen)
+        {
+            p_snapshot->sweep_gen    = p_entry->sweep_gen;
+            p_snapshot->packet_count = 0;
+        }
+        if (p_entry->packet_count != p_snapshot->packet_count)
         {
-            p_flow_info->last_matched = time_msec();
-            p_flow_info->packet_count = new_stats.packet_count;
+            p_snapshot->packet_count = p_entry->packet_count;
+            p_entry->matched = true;
+            p_sweep->last_matched++;
         }
     }
-    
-    sal_mutex_unlock(pg_mutex);
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Update last_matched of the flows whose counters moved, the flow lock must be held
+ * for write
+ * @param[in] p_sweep           Pointer to the stats sweep
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_sweep_publish(adpt_flow_stats_sweep_t* p_sweep)
+{
+    adpt_flow_sweep_entry_t* p_entry;
+    adpt_flow_info_t * p_flow_info;
+    int64_ofp now = time_msec();
+    uint32_ofp i;
+
+    for (i = 0; i < p_sweep->count; i++)
+    {
+        p_entry = &p_sweep->p_entry[i];
+        if (!p_entry->matched)
+        {
+            continue;
+        }
+
+        /* The flow may have been removed or modified while the flow lock was released */
+        p_flow_info = adpt_flowdb_get_flow_info(p_entry->flow_id);
+        if (NULL == p_flow_info || p_flow_info->need_delete || !p_flow_info->is_idle_timer
+            || p_flow_info->p_rule->stats_ptr != p_entry->stats_ptr)
+        {
+            continue;
+        }
+
+        if (p_entry->packet_count != p_flow_info->packet_count)
+        {
+            p_flow_info->last_matched = now;
+            p_flow_info->packet_count = p_entry->packet_count;
+        }
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Handle idle timeout timer
+ * @param[in] p_arg             Not used
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_idle_timeout_timer(void* p_arg)
+{
+    adpt_flow_stats_sweep_t* p_sweep = &g_p_adpt_flow_master->stats_sweep;
+    struct timeval start, end;
+    int32_ofp ret;
+
+    xgettimeofday(&start);
+
+    ADPT_ERROR_RETURN(adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_WR(ADPT_LOCK_STATS)));
+    ret = adpt_flow_sweep_collect(p_sweep);
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_FLOW));
+
+    /* The stats are read without the flow lock. Adding or removing a flow only
+     * takes the flow lock, so it is not held up by the bulk read; the SDK
+     * serializes the access to the stats sram itself */
+    if (OFP_ERR_SUCCESS == ret)
+    {
+        ret = adpt_flow_sweep_read(p_sweep);
+    }
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_STATS));
+    if (ret)
+    {
+        return ret;
+    }
+
+    ADPT_ERROR_RETURN(adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_WR(ADPT_LOCK_STATS)));
+    adpt_flow_sweep_publish(p_sweep);
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_FLOW));
+
+    xgettimeofday(&end);
+    p_sweep->last_count = p_sweep->count;
+    p_sweep->last_usec  = (end.tv_sec - start.tv_sec) * 1000000LL
+                          + (end.tv_usec - start.tv_usec);
+    if (p_sweep->last_usec > p_sweep->max_usec)
+    {
+        p_sweep->max_usec = p_sweep->last_usec;
+    }
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_STATS));
     
     return OFP_ERR_SUCCESS;
 }
 
+/**
+ * Handle tcam defrag timer, entries are only moved when no flow was added or
+ * removed since the last tick so the defrag never competes with flow setup
+ * @param[in] p_arg             Not used
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_tcam_defrag_timer(void* p_arg)
+{
+    uint32_ofp moves = 0;
+    int32_ofp ret = OFP_ERR_SUCCESS;
+
+    ADPT_ERROR_RETURN(adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_FLOW)));
+    if (g_p_adpt_flow_master->tcam_defrag_seq == g_p_adpt_flow_master->tcam_change_seq)
+    {
+        ret = hal_flow_defrag_tcam(OFP_TCAM_DEFRAG_MOVES, &moves);
+    }
+    g_p_adpt_flow_master->tcam_defrag_seq = g_p_adpt_flow_master->tcam_change_seq;
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_FLOW));
+
+    if (ret)
+    {
+        OFP_LOG_ERROR("tcam defrag failed after %u moves, ret %d", moves, ret);
+    }
+
+    return ret;
+}
+
 /**
  * Retrieve flow stats and save to DB
  * @param[in]  p_rule               Pointer to struct rule_ctc
@@ -2430,17 +2753,15 @@ adpt_flow_get_last_matched(struct rule_ctc* p_rule, int64_ofp* p_last_matched)
 }
 
 /**
- * @brief Add flow entry
+ * Allocate the ids and map the key and action of a flow, and add its entries
+ * to the priority db. Nothing is written to the tcam yet.
+ * @param[in,out] p_ctx         Pointer to the add context, p_rule is set by the caller
+ * @return OFP_ERR_XXX
  */
-int32_ofp
-adpt_flow_add_flow(struct rule_ctc* p_rule)
+static int32_ofp
+adpt_flow_add_flow_prepare(adpt_flow_add_ctx_t* p_ctx)
 {
-    ctc_aclqos_entry_t entry;
-    ctc_aclqos_entry_t extra_entry;
-    ofp_flow_type_t flow_type;
-    uint32_ofp label_id = 0;
-    ctc_aclqos_label_type_t label_type;
-    uint32_ofp prev_entry_id = 0;
+    struct rule_ctc* p_rule = p_ctx->p_rule;
     int ret = 0;
 
     p_rule->flow_id         = 0;
@@ -2461,7 +2782,8 @@ adpt_flow_add_flow(struct rule_ctc* p_rule)
     p_rule->group_info.is_group_bound = FALSE;
     p_rule->group_info.group_nhid     = 0;
     
-    memset(&entry, 0, sizeof(ctc_aclqos_entry_t));
+    memset(&p_ctx->entry, 0, sizeof(ctc_aclqos_entry_t));
+    memset(&p_ctx->extra_entry, 0, sizeof(ctc_aclqos_entry_t));
 
     OFP_LOG_DEBUG_FUNC();
 
@@ -2472,110 +2794,345 @@ adpt_flow_add_flow(struct rule_ctc* p_rule)
         goto Err0;
     }
 
-    /* 3. get label id & label type */
-    ret = adpt_flow_alloc_label_id(p_rule, &label_type, &label_id);
+    /* 2. get label id & label type */
+    ret = adpt_flow_alloc_label_id(p_rule, &p_ctx->label_type, &p_ctx->label_id);
     if (ret)
     {
         goto Err0;
     }
 
-    /* 4. get entry id */
-    flow_type = OFP_MAP_FLOW_TYPE(ntohs(p_rule->match.flow.dl_type));
-    ret = adpt_flow_alloc_entry_id(label_id, flow_type, &entry.entry_id);
+    /* 3. get entry id */
+    p_ctx->flow_type = OFP_MAP_FLOW_TYPE(ntohs(p_rule->match.flow.dl_type));
+    ret = adpt_flow_alloc_entry_id(p_ctx->label_id, p_ctx->flow_type, &p_ctx->entry.entry_id);
     if (ret)
     {
         goto Err1;
     }
 
-    /* 5. map flow key */
-    ret = adpt_flow_map_flow_key(p_rule, &entry.key);
+    /* 4. map flow key */
+    ret = adpt_flow_map_flow_key(p_rule, &p_ctx->entry.key);
     if (ret)
     {
         goto Err2;
     }
 
-    /* 6. add flow timer to handle idle_timeout */
+    /* 5. add flow timer to handle idle_timeout */
     adpt_flow_add_flow_timer(p_rule);
 
-    /* 7. map flow action */
-    ret = adpt_flow_map_flow_action(p_rule, &entry.action);
+    /* 6. map flow action */
+    ret = adpt_flow_map_flow_action(p_rule, NULL, &p_ctx->entry.action);
     if (ret)
     {
         goto Err3;
     }
 
-    /* 8. get prev entry id */
-    adpt_flowdb_add_flow_priority_entry_id(flow_type, p_rule->up.cr.priority, entry.entry_id);
-    adpt_flowdb_get_prev_entry_id(flow_type, p_rule->up.cr.priority, entry.entry_id, &prev_entry_id);
-    OFP_DEBUG_PRINT("priority: %u, flow_type: %d, label_id: %u, prev_entry_id: %u entry_id: %u \n",
-            p_rule->up.cr.priority, flow_type, label_id, prev_entry_id, entry.entry_id);
+    /* 7. add entry id to priority db */
+    adpt_flowdb_add_flow_priority_entry_id(p_ctx->flow_type, p_rule->up.cr.priority, p_ctx->entry.entry_id);
 
-    /* 9. add flow entry to sdk*/
-    ret = adpt_flow_add_flow_to_sdk(p_rule, label_id, label_type, prev_entry_id, &entry);
-    if (ret)
-    {
-        goto Err4;
-    }
-    
-    /* 10. Copy to ipv4 key to match ipv4 packets if necessary */
-    if (FLOW_TYPE_ANY == flow_type)
+    /* 8. Copy to ipv4 key to match ipv4 packets if necessary */
+    if (FLOW_TYPE_ANY == p_ctx->flow_type)
     {
-        /* 10.1 copy flow action, flow key */
-        memset(&extra_entry, 0, sizeof(ctc_aclqos_entry_t));
-        adpt_flow_map_mac_ipv4_entry(&entry, &extra_entry);
+        /* 8.1 copy flow action, flow key */
+        adpt_flow_map_mac_ipv4_entry(&p_ctx->entry, &p_ctx->extra_entry);
 
-        /* 10.2 alloc flow entry id, after entry id*/
-        ret = adpt_flow_alloc_entry_id(label_id, FLOW_TYPE_IPV4, &extra_entry.entry_id);
+        /* 8.2 alloc flow entry id, after entry id*/
+        ret = adpt_flow_alloc_entry_id(p_ctx->label_id, FLOW_TYPE_IPV4, &p_ctx->extra_entry.entry_id);
         if (ret)
         {
-            goto Err5;
+            goto Err4;
         }
 
-        /* 10.3 get prev entry id */
-        adpt_flowdb_add_flow_priority_entry_id(FLOW_TYPE_IPV4, p_rule->up.cr.priority, extra_entry.entry_id);
-        adpt_flowdb_get_prev_entry_id(FLOW_TYPE_IPV4, p_rule->up.cr.priority, extra_entry.entry_id, &prev_entry_id);
+        /* 8.3 add entry id to priority db */
+        adpt_flowdb_add_flow_priority_entry_id(FLOW_TYPE_IPV4, p_rule->up.cr.priority, p_ctx->extra_entry.entry_id);
+    }
+
+    return OFP_ERR_SUCCESS;
+
+Err4:
+    adpt_flowdb_del_flow_priority_entry_id(p_ctx->flow_type, p_rule->up.cr.priority, p_ctx->entry.entry_id);
+Err3:
+    adpt_flow_map_remove_flow_action(p_rule);
+    adpt_flow_map_remove_flow_key(p_rule);
+    adpt_flow_del_flow_timer(p_rule);
+Err2:
+    adpt_flow_release_entry_id(p_ctx->label_id, p_ctx->flow_type, p_ctx->entry.entry_id);
+Err1:
+    adpt_flow_release_label_id(p_rule, p_ctx->label_type, p_ctx->label_id);
+Err0:
+    return ret;
+}
+
+/**
+ * Undo adpt_flow_add_flow_prepare() of a flow that was not committed
+ * @param[in]  p_ctx             Pointer to the add context
+ */
+static void
+adpt_flow_add_flow_unprepare(adpt_flow_add_ctx_t* p_ctx)
+{
+    struct rule_ctc* p_rule = p_ctx->p_rule;
+
+    if (FLOW_TYPE_ANY == p_ctx->flow_type)
+    {
+        adpt_flowdb_del_flow_priority_entry_id(FLOW_TYPE_IPV4, p_rule->up.cr.priority, p_ctx->extra_entry.entry_id);
+        adpt_flow_release_entry_id(p_ctx->label_id, FLOW_TYPE_IPV4, p_ctx->extra_entry.entry_id);
+    }
+    adpt_flowdb_del_flow_priority_entry_id(p_ctx->flow_type, p_rule->up.cr.priority, p_ctx->entry.entry_id);
+    adpt_flow_map_remove_flow_action(p_rule);
+    adpt_flow_map_remove_flow_key(p_rule);
+    adpt_flow_del_flow_timer(p_rule);
+    adpt_flow_release_entry_id(p_ctx->label_id, p_ctx->flow_type, p_ctx->entry.entry_id);
+    adpt_flow_release_label_id(p_rule, p_ctx->label_type, p_ctx->label_id);
+}
+
+/**
+ * Write the entries of a prepared flow to the sdk. On failure the entries
+ * already written are removed again, the prepared state is kept.
+ * @param[in]  p_ctx             Pointer to the add context
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_add_flow_commit(adpt_flow_add_ctx_t* p_ctx)
+{
+    struct rule_ctc* p_rule = p_ctx->p_rule;
+    uint32_ofp prev_entry_id = 0;
+    int ret = 0;
+
+    /* 1. get prev entry id */
+    adpt_flowdb_get_prev_entry_id(p_ctx->flow_type, p_rule->up.cr.priority, p_ctx->entry.entry_id, &prev_entry_id);
+    OFP_DEBUG_PRINT("priority: %u, flow_type: %d, label_id: %u, prev_entry_id: %u entry_id: %u \n",
+            p_rule->up.cr.priority, p_ctx->flow_type, p_ctx->label_id, prev_entry_id, p_ctx->entry.entry_id);
+
+    /* 2. add flow entry to sdk*/
+    ret = adpt_flow_add_flow_to_sdk(p_rule, p_ctx->label_id, p_ctx->label_type, prev_entry_id, &p_ctx->entry);
+    if (ret)
+    {
+        return ret;
+    }
+    
+    /* 3. add the ipv4 copy to sdk */
+    if (FLOW_TYPE_ANY == p_ctx->flow_type)
+    {
+        adpt_flowdb_get_prev_entry_id(FLOW_TYPE_IPV4, p_rule->up.cr.priority, p_ctx->extra_entry.entry_id, &prev_entry_id);
         OFP_DEBUG_PRINT("priority: %u, flow_type: %d, label_id: %u, prev_entry_id: %u entry_id: %u \n",
-                p_rule->up.cr.priority, FLOW_TYPE_IPV4, label_id, prev_entry_id, entry.entry_id);
+                p_rule->up.cr.priority, FLOW_TYPE_IPV4, p_ctx->label_id, prev_entry_id, p_ctx->entry.entry_id);
 
-        /* 10.4 add flow entry to sdk */
-        ret = adpt_flow_add_flow_to_sdk(p_rule, label_id, label_type, prev_entry_id, &extra_entry);
+        ret = adpt_flow_add_flow_to_sdk(p_rule, p_ctx->label_id, p_ctx->label_type, prev_entry_id, &p_ctx->extra_entry);
         if (ret)
         {
-            OFP_DEBUG_PRINT("Rollback the previous mac entry label id: %u, entry id: %u\n", label_id, entry.entry_id);
+            OFP_DEBUG_PRINT("Rollback the previous mac entry label id: %u, entry id: %u\n", p_ctx->label_id, p_ctx->entry.entry_id);
+            adpt_flow_del_flow_from_sdk(p_rule, p_ctx->label_id, p_ctx->label_type, p_ctx->entry.key.type, p_ctx->entry.entry_id);
             
-            goto Err6;
+            return ret;
         }
 
-        /* 10.5. add entry id to db*/
-        p_rule->extra_entry_id = extra_entry.entry_id;
+        /* 3.1 add entry id to db*/
+        p_rule->extra_entry_id = p_ctx->extra_entry.entry_id;
     }
 
-    /* 11. add entry id to db*/
-    p_rule->entry_id = entry.entry_id;
+    /* 4. add entry id to db*/
+    p_rule->entry_id = p_ctx->entry.entry_id;
 
-    /* 12. increase current flow number */
+    /* 5. increase current flow number */
     adpt_flowdb_incr_flow_entry_num();
 
     adpt_flow_op_nexthop_res(&p_rule->nh_info, ADPT_RES_OP_TYPE_ADD);
 
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * @brief Add flow entry
+ */
+int32_ofp
+adpt_flow_add_flow(struct rule_ctc* p_rule)
+{
+    adpt_flow_add_ctx_t ctx;
+    int ret = 0;
+
+    ctx.p_rule = p_rule;
+    ctx.index  = 0;
+    ret = adpt_flow_add_flow_prepare(&ctx);
+    if (ret)
+    {
+        goto Err0;
+    }
+
+    ret = adpt_flow_add_flow_commit(&ctx);
+    if (ret)
+    {
+        adpt_flow_add_flow_unprepare(&ctx);
+        goto Err0;
+    }
+
     return OFP_ERR_SUCCESS;
     
-Err6:
-    adpt_flowdb_del_flow_priority_entry_id(FLOW_TYPE_IPV4, p_rule->up.cr.priority, extra_entry.entry_id);
-    adpt_flow_release_entry_id(label_id, FLOW_TYPE_IPV4, extra_entry.entry_id);
-Err5:
-    adpt_flow_del_flow_from_sdk(p_rule, label_id, label_type, entry.key.type, entry.entry_id);
-Err4:
-    adpt_flowdb_del_flow_priority_entry_id(flow_type, p_rule->up.cr.priority, entry.entry_id);
-Err3:
-    adpt_flow_map_remove_flow_action(p_rule);
-    adpt_flow_map_remove_flow_key(p_rule);
-    adpt_flow_del_flow_timer(p_rule);
-Err2:
-    adpt_flow_release_entry_id(label_id, flow_type, entry.entry_id);
+Err0:
+    ADPT_ERROR_RETURN(ret);
+    
+    return OFP_ERR_FAIL;
+}
+
+/**
+ * Order flows by descending priority, flows of the same priority keep the
+ * order they were given in
+ */
+static int
+adpt_flow_add_ctx_cmp(const void* p_a, const void* p_b)
+{
+    const adpt_flow_add_ctx_t* p_ctx_a = p_a;
+    const adpt_flow_add_ctx_t* p_ctx_b = p_b;
+    uint32_ofp prio_a = p_ctx_a->p_rule->up.cr.priority;
+    uint32_ofp prio_b = p_ctx_b->p_rule->up.cr.priority;
+
+    if (prio_a != prio_b)
+    {
+        return prio_a > prio_b ? -1 : 1;
+    }
+
+    return p_ctx_a->index < p_ctx_b->index ? -1 : (p_ctx_a->index > p_ctx_b->index);
+}
+
+/**
+ * Open free tcam entries for every entry of the prepared flows of one key
+ * type, so that the commit does not have to shift entries per flow
+ * @param[in]  p_ctx             Prepared flows, in commit order
+ * @param[in]  count             Number of flows
+ * @param[in]  key_type          Key type to reserve for
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_flow_add_flows_reserve(adpt_flow_add_ctx_t* p_ctx, uint32_ofp count, ctc_aclqos_key_type_t key_type)
+{
+    uint32_ofp* p_entry_id = NULL;
+    uint32_ofp* p_after_entry_id = NULL;
+    ctc_aclqos_entry_t* p_entry = NULL;
+    ofp_flow_type_t flow_type = FLOW_TYPE_ANY;
+    uint32_ofp num = 0;
+    uint32_ofp i;
+    int32_ofp ret = OFP_ERR_SUCCESS;
+
+    p_entry_id = malloc(2 * count * sizeof(uint32_ofp));
+    p_after_entry_id = malloc(2 * count * sizeof(uint32_ofp));
+    if (!p_entry_id || !p_after_entry_id)
+    {
+        ret = OFP_ERR_NO_MEMORY;
+        goto out;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        p_entry = NULL;
+        if (p_ctx[i].entry.key.type == key_type)
+        {
+            p_entry = &p_ctx[i].entry;
+            flow_type = p_ctx[i].flow_type;
+        }
+        else if ((FLOW_TYPE_ANY == p_ctx[i].flow_type) && (p_ctx[i].extra_entry.key.type == key_type))
+        {
+            p_entry = &p_ctx[i].extra_entry;
+            flow_type = FLOW_TYPE_IPV4;
+        }
+
+        if (p_entry)
+        {
+            p_entry_id[num] = p_entry->entry_id;
+            adpt_flowdb_get_prev_entry_id(flow_type, p_ctx[i].p_rule->up.cr.priority,
+                                          p_entry->entry_id, &p_after_entry_id[num]);
+            num++;
+        }
+    }
+
+    ret = hal_flow_reserve_entry(key_type, p_entry_id, p_after_entry_id, num);
+
+out:
+    free(p_entry_id);
+    free(p_after_entry_id);
+
+    return ret;
+}
+
+/**
+ * @brief Add flow entries as one transaction
+ */
+int32_ofp
+adpt_flow_add_flows(struct rule_ctc** pp_rule, uint32_ofp count)
+{
+    adpt_flow_add_ctx_t* p_ctx = NULL;
+    uint32_ofp n_prepared = 0;
+    uint32_ofp n_committed = 0;
+    uint32_ofp i;
+    int ret = 0;
+
+    ADPT_PTR_CHECK(pp_rule);
+    if (!count)
+    {
+        return OFP_ERR_SUCCESS;
+    }
+
+    p_ctx = malloc(count * sizeof(adpt_flow_add_ctx_t));
+    if (!p_ctx)
+    {
+        return OFP_ERR_NO_MEMORY;
+    }
+
+    /* 1. sort by priority so every flow is added after the flows it follows,
+     * the priority db then gives the final order of the batch at once */
+    for (i = 0; i < count; i++)
+    {
+        p_ctx[i].p_rule = pp_rule[i];
+        p_ctx[i].index  = i;
+    }
+    qsort(p_ctx, count, sizeof(adpt_flow_add_ctx_t), adpt_flow_add_ctx_cmp);
+
+    /* 2. allocate ids and map key & action of every flow */
+    for (n_prepared = 0; n_prepared < count; n_prepared++)
+    {
+        ret = adpt_flow_add_flow_prepare(&p_ctx[n_prepared]);
+        if (ret)
+        {
+            goto Err0;
+        }
+    }
+
+    /* 3. make room in the tcam for the whole batch in one pass */
+    ret = adpt_flow_add_flows_reserve(p_ctx, count, CTC_ACLQOS_MAC_KEY);
+    if (ret)
+    {
+        goto Err0;
+    }
+    ret = adpt_flow_add_flows_reserve(p_ctx, count, CTC_ACLQOS_IPV4_KEY);
+    if (ret)
+    {
+        goto Err0;
+    }
+
+    /* 4. write the entries in tcam order */
+    for (n_committed = 0; n_committed < count; n_committed++)
+    {
+        ret = adpt_flow_add_flow_commit(&p_ctx[n_committed]);
+        if (ret)
+        {
+            goto Err1;
+        }
+    }
+
+    free(p_ctx);
+
+    return OFP_ERR_SUCCESS;
+
 Err1:
-    adpt_flow_release_label_id(p_rule, label_type, label_id);
+    for (i = 0; i < n_committed; i++)
+    {
+        adpt_flow_del_flow(p_ctx[i].p_rule);
+    }
 Err0:
+    while (n_prepared > n_committed)
+    {
+        n_prepared--;
+        adpt_flow_add_flow_unprepare(&p_ctx[n_prepared]);
+    }
+    free(p_ctx);
+
     ADPT_ERROR_RETURN(ret);
     
     return OFP_ERR_FAIL;
@@ -2625,7 +3182,7 @@ adpt_flow_modify_flow_action(struct rule_ctc *p_rule)
     }
 
     /* 3. map p_rule action */
-    ret = adpt_flow_map_flow_action(p_rule, &action);
+    ret = adpt_flow_map_flow_action(p_rule, &old_nh_info, &action);
     if (ret)
     {
         goto Err0;
@@ -2655,6 +3212,14 @@ adpt_flow_modify_flow_action(struct rule_ctc *p_rule)
     return OFP_ERR_SUCCESS;
 
 Err1:
+    /* the old mcast group may have been updated in place, give it back its members
+     * while the new member nexthops are still held */
+    if (old_nh_info.use_mcast && p_rule->nh_info.use_mcast &&
+        old_nh_info.main_nh.nhid == p_rule->nh_info.main_nh.nhid)
+    {
+        adpt_nexthop_set_mcast_group_members(&old_nh_info.main_nh,
+            old_nh_info.member_nh, old_nh_info.output_count);
+    }
     adpt_flow_map_remove_flow_action(p_rule);
 Err0:    
     memcpy(&p_rule->nh_info, &old_nh_info, sizeof(ofp_nexthop_info_t));
@@ -2736,6 +3301,11 @@ adpt_flow_add_idle_timeout_timer(void)
     ADPT_FLOW_ERROR_RETURN(afx_timer_start(g_p_adpt_flow_master->idle_timeout_timer, 
         OFP_IDLE_TIMEOUT_TIMER));
 
+    ADPT_FLOW_ERROR_RETURN(afx_timer_create(&g_p_adpt_flow_master->tcam_defrag_timer, 
+        (afx_timer_cb_t) adpt_flow_tcam_defrag_timer, NULL));
+    ADPT_FLOW_ERROR_RETURN(afx_timer_start(g_p_adpt_flow_master->tcam_defrag_timer, 
+        OFP_TCAM_DEFRAG_TIMER));
+
     return OFP_ERR_SUCCESS;
 }
 
@@ -2747,6 +3317,9 @@ adpt_flow_remove_idle_timeout_timer(void)
     ADPT_FLOW_ERROR_RETURN(afx_timer_stop(g_p_adpt_flow_master->idle_timeout_timer));
     ADPT_FLOW_ERROR_RETURN(afx_timer_destroy(g_p_adpt_flow_master->idle_timeout_timer));
 
+    ADPT_FLOW_ERROR_RETURN(afx_timer_stop(g_p_adpt_flow_master->tcam_defrag_timer));
+    ADPT_FLOW_ERROR_RETURN(afx_timer_destroy(g_p_adpt_flow_master->tcam_defrag_timer));
+
     return OFP_ERR_SUCCESS;
 }
 
@@ -26,9 +26,11 @@
 #include "afx.h"
 
 #include "vlog.h"
+#include "hash.h"
 #include "ofp_api.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_flow.h"
 #include "adpt_flow_priv.h"
 #include "adpt_parser.h"
@@ -44,19 +46,17 @@ VLOG_DEFINE_THIS_MODULE(adapt_flow);
 
 extern uint8_ofp g_current_profile;
 
-#define ADPT_FLOWDB_SELECT_DB(ret)                          \
+#define ADPT_FLOWDB_SELECT_INDEX(ret)                       \
 do {                                                        \
     if (flow_type == FLOW_TYPE_IPV4)                        \
     {                                                       \
-        p_priority_list = ADPT_FLOW_MAC_PRIORITY_LIST;      \
-        p_priority_hash = ADPT_FLOW_MAC_PRIORITY_HASH;      \
+        p_index = ADPT_FLOW_IPV4_INDEX;                     \
     }                                                       \
     else if (flow_type == FLOW_TYPE_MAC ||                  \
              flow_type == FLOW_TYPE_ANY ||                  \
              flow_type == FLOW_TYPE_OTHER)                  \
     {                                                       \
-        p_priority_list = ADPT_FLOW_IPV4_PRIORITY_LIST;     \
-        p_priority_hash = ADPT_FLOW_IPV4_PRIORITY_HASH;     \
+        p_index = ADPT_FLOW_MAC_INDEX;                      \
     }                                                       \
     else                                                    \
     {                                                       \
@@ -296,6 +296,7 @@ adpt_flowdb_show_flow_info(void)
     int i = 0;
     struct ihash_node *node, *next;
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
     ctc_cli_out_ofp("--------------------------Flow INFO DB ----------------------------------------------------------\n");
 
     ctc_cli_out_ofp("%5s %7s %8s %6s %10s %10s %10s %20s %10s\n",
@@ -312,6 +313,18 @@ adpt_flowdb_show_flow_info(void)
                 data->idle_timeout, data->is_idle_timer, data->need_delete);
         i++;
     }
+
+    ctc_cli_out_ofp("-------------------------------------------------------------------------------------------------\n");
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
+
+    /* Not under the flow lock, a sweep holds the stats lock across its bulk read */
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_STATS));
+    ctc_cli_out_ofp("idle timeout sweep: %u flows, %u matched, %llu us (max %llu us)\n",
+        g_p_adpt_flow_master->stats_sweep.last_count,
+        g_p_adpt_flow_master->stats_sweep.last_matched,
+        g_p_adpt_flow_master->stats_sweep.last_usec,
+        g_p_adpt_flow_master->stats_sweep.max_usec);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_STATS));
 }
 
 /**
@@ -383,8 +396,10 @@ adpt_flowdb_decr_flow_entry_num(void)
 int32_ofp
 adpt_flowdb_show_flow_entry_num(void)
 {
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
     ctc_cli_out_ofp (" Flow entry num : %4d / %4d\n", 
         adpt_flowdb_get_flow_entry_cur_num(), adpt_flowdb_get_flow_entry_max_num());
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
 
     return OFP_ERR_SUCCESS;
 }
@@ -566,209 +581,144 @@ adpt_flowdb_decr_qinq_with_mac_cur_num(void)
 int32_ofp
 adpt_flowdb_show_output_port_num(void)
 {
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
     ctc_cli_out_ofp (" Output entry num                    : %4d / %4d\n", 
         adpt_flowdb_get_output_port_count(), adpt_flowdb_get_output_port_max());
     ctc_cli_out_ofp (" GRE and MPLS(push) output entry num : %4d / %4d\n", 
         adpt_flowdb_get_gre_and_mpls_push_output_count(), adpt_flowdb_get_gre_and_mpls_push_output_max());
     ctc_cli_out_ofp (" QinQ with modified mac output entry num : %4d / %4d\n",
         adpt_flowdb_get_qinq_with_mac_cur_num(), adpt_flowdb_get_qinq_with_mac_max_num());
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
 
     return OFP_ERR_SUCCESS;
 }
 
-static inline uint32_ofp
-adpt_flowdb_priority_hash_make(void* pst_key_void)
+static void
+adpt_flowdb_index_init(adpt_flow_index_t* p_index)
 {
-    adpt_flow_priority_hash_t* pst_key = NULL;
-    pst_key = pst_key_void;
-
-    return pst_key->priority;
+    memset(p_index, 0, sizeof(adpt_flow_index_t));
+    p_index->level = 1;
+    p_index->rand_seed = 0x2545f491;
+    hmap_init(&p_index->entry_id_map);
 }
 
-static inline bool
-adpt_flowdb_priority_hash_cmp (void* pv_node_a_void, void* pv_node_b_void)
+static void
+adpt_flowdb_index_deinit(adpt_flow_index_t* p_index)
 {
-    adpt_flow_priority_hash_t* pv_node_a = NULL;
-    adpt_flow_priority_hash_t* pv_node_b = NULL;
+    adpt_flow_index_chunk_t* p_chunk;
 
-    pv_node_a = pv_node_a_void;
-    pv_node_b = pv_node_b_void;
-
-    if (pv_node_a->priority != pv_node_b->priority)
+    while (p_index->p_chunk)
     {
-        return FALSE;
+        p_chunk = p_index->p_chunk;
+        p_index->p_chunk = p_chunk->next;
+        free(p_chunk);
     }
-
-    return TRUE;
-}
-
-static inline adpt_flow_priority_hash_t*
-adpt_flowdb_priority_hash_lookup(ctc_hash_t *p_hash, uint32_ofp priority)
-{
-    adpt_flow_priority_hash_t lookup_key;
-    
-    lookup_key.priority = priority;
-    
-    return ctc_hash_lookup(p_hash, &lookup_key);
-}
-
-static inline int32_ofp
-adpt_flowdb_priority_hash_add(ctc_hash_t *p_hash, adpt_flow_priority_hash_t* p_priority)
-{
-    ctc_hash_insert(p_hash, p_priority);
-
-    return OFP_ERR_SUCCESS;
+    hmap_destroy(&p_index->entry_id_map);
+    memset(p_index, 0, sizeof(adpt_flow_index_t));
 }
 
-static inline int32_ofp
-adpt_flowdb_priority_hash_del(ctc_hash_t *p_hash, adpt_flow_priority_hash_t* p_priority)
+static adpt_flow_index_node_t*
+adpt_flowdb_index_node_alloc(adpt_flow_index_t* p_index)
 {
-    ctc_hash_remove(p_hash, p_priority);
-
-    return OFP_ERR_SUCCESS;
-}
-
-static inline int32_ofp
-adpt_flowdb_priority_list_add(ctc_list_pointer_t *p_list, adpt_flow_priority_list_t* p_priority)
-{
-    ctc_list_pointer_node_t* p_node = NULL;
-    ctc_list_pointer_node_t* p_head_node = NULL;
-    ctc_list_pointer_node_t* p_tail_node = NULL;
-    adpt_flow_priority_list_t* p_head_priority = NULL;
-    adpt_flow_priority_list_t* p_tail_priority = NULL;
-
-    /* 1. check whether the priority is the first one */
-    if (ctc_list_pointer_empty(p_list))
-    {
-        ctc_list_pointer_insert_head(p_list, &p_priority->node);
-        return OFP_ERR_SUCCESS;
-    }
-
-    /* 2. check whether the priority is larger than all other priorities */
-    p_head_node = ctc_list_pointer_head(p_list);
-    p_head_priority = _ctc_container_of(p_head_node, adpt_flow_priority_list_t, node);
-    if (p_priority->priority > p_head_priority->priority)
-    {
-        ctc_list_pointer_insert_head(p_list, &p_priority->node);
-        return OFP_ERR_SUCCESS;
-    }
-
-    /* 3. check whether the priority is lower than all other priorities */
-    p_tail_node = ctc_list_pointer_node_tail(p_list);
-    p_tail_priority = _ctc_container_of(p_tail_node, adpt_flow_priority_list_t, node);
-    if (p_priority->priority < p_tail_priority->priority)
-    {
-        ctc_list_pointer_insert_tail(p_list, &p_priority->node);
-        return OFP_ERR_SUCCESS;
-    }
+    adpt_flow_index_chunk_t* p_chunk;
+    adpt_flow_index_node_t* p_node;
+    uint32_ofp i;
 
-    /* 4. find the position */
-    if ((p_head_priority->priority - p_priority->priority) <
-        (p_priority->priority - p_tail_priority->priority))
+    if (!p_index->p_free)
     {
-        /* loop from head */
-        CTC_LIST_POINTER_LOOP(p_node, p_list)
+        p_chunk = malloc(sizeof(adpt_flow_index_chunk_t));
+        if (!p_chunk)
         {
-            p_head_priority = _ctc_container_of(p_node, adpt_flow_priority_list_t, node);
-            if (p_head_priority->priority < p_priority->priority)
-            {
-                ctc_list_pointer_insert_before(p_list, &p_head_priority->node, &p_priority->node);
-                return OFP_ERR_SUCCESS;
-            }
+            return NULL;
         }
-    }
-    else
-    {
-        /* loop from tail */
-        CTC_LIST_POINTER_LOOP_R(p_node, p_list)
+        p_chunk->next = p_index->p_chunk;
+        p_index->p_chunk = p_chunk;
+
+        for (i = 0; i < ADPT_FLOW_INDEX_POOL_CHUNK; i++)
         {
-            p_tail_priority = _ctc_container_of(p_node, adpt_flow_priority_list_t, node);
-            if (p_tail_priority->priority > p_priority->priority)
-            {
-                ctc_list_pointer_insert_after(p_list, &p_tail_priority->node, &p_priority->node);
-                return OFP_ERR_SUCCESS;
-            }
+            p_chunk->nodes[i].next[0] = p_index->p_free;
+            p_index->p_free = &p_chunk->nodes[i];
         }
     }
-    
-    return OFP_ERR_SUCCESS;
-}
 
-static inline int32_ofp
-adpt_flowdb_priority_list_del(ctc_list_pointer_t *p_list, adpt_flow_priority_list_t* p_priority)
-{
-    ctc_list_pointer_delete(p_list, &p_priority->node);
+    p_node = p_index->p_free;
+    p_index->p_free = p_node->next[0];
 
-    return OFP_ERR_SUCCESS;
+    return p_node;
 }
 
-static inline uint32_ofp
-adpt_flowdb_entry_id_hash_make(void* pst_key_void)
+static void
+adpt_flowdb_index_node_free(adpt_flow_index_t* p_index, adpt_flow_index_node_t* p_node)
 {
-    adpt_flow_entry_id_hash_t* pst_key = NULL;
-
-    pst_key = pst_key_void;
-    return pst_key->entry_id;
+    p_node->next[0] = p_index->p_free;
+    p_index->p_free = p_node;
 }
 
-static inline bool
-adpt_flowdb_entry_id_hash_cmp (void* pv_node_a_void, void* pv_node_b_void)
+/* level of a new node, each level is used by a quarter of the level below */
+static uint8_ofp
+adpt_flowdb_index_random_level(adpt_flow_index_t* p_index)
 {
-    adpt_flow_entry_id_hash_t* pv_node_a = NULL;
-    adpt_flow_entry_id_hash_t* pv_node_b = NULL;
+    uint32_ofp x = p_index->rand_seed;
+    uint8_ofp level = 1;
 
-    pv_node_a = pv_node_a_void;
-    pv_node_b = pv_node_b_void;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    p_index->rand_seed = x;
 
-    if (pv_node_a->entry_id != pv_node_b->entry_id)
+    while ((level < ADPT_FLOW_INDEX_MAX_LEVEL) && !(x & 3))
     {
-        return FALSE;
+        level++;
+        x >>= 2;
     }
 
-    return TRUE;
-}
-
-static inline adpt_flow_entry_id_hash_t*
-adpt_flowdb_entry_id_hash_lookup(ctc_hash_t *p_hash, uint32_ofp entry_id)
-{
-    adpt_flow_entry_id_hash_t lookup_key;
-    
-    lookup_key.entry_id = entry_id;
-    
-    return ctc_hash_lookup(p_hash, &lookup_key);
+    return level;
 }
 
-static inline int32_ofp
-adpt_flowdb_entry_id_hash_add(ctc_hash_t *p_hash, adpt_flow_entry_id_hash_t* p_entry_id)
+/* whether p_a is before p_b in tcam order */
+static inline bool
+adpt_flowdb_index_before(const adpt_flow_index_node_t* p_a, const adpt_flow_index_node_t* p_b)
 {
-    ctc_hash_insert(p_hash, p_entry_id);
+    if (p_a->priority != p_b->priority)
+    {
+        return p_a->priority > p_b->priority;
+    }
 
-    return OFP_ERR_SUCCESS;
+    return p_a->seq < p_b->seq;
 }
 
-static inline int32_ofp
-adpt_flowdb_entry_id_hash_del(ctc_hash_t *p_hash, adpt_flow_entry_id_hash_t* p_entry_id)
+static adpt_flow_index_node_t*
+adpt_flowdb_index_find(adpt_flow_index_t* p_index, uint32_ofp entry_id)
 {
-    ctc_hash_remove(p_hash, p_entry_id);
-
-    return OFP_ERR_SUCCESS;
-}
+    adpt_flow_index_node_t* p_node;
 
-static inline int32_ofp
-adpt_flowdb_entry_id_list_add(ctc_list_pointer_t *p_list, adpt_flow_entry_id_list_t* p_entry_id)
-{
-    /* no need insert the entry in order of entry id*/
-    ctc_list_pointer_insert_tail(p_list, &p_entry_id->node);
+    HMAP_FOR_EACH_WITH_HASH(p_node, hmap_node, hash_int(entry_id, 0), &p_index->entry_id_map)
+    {
+        if (p_node->entry_id == entry_id)
+        {
+            return p_node;
+        }
+    }
 
-    return OFP_ERR_SUCCESS;
+    return NULL;
 }
 
-static inline int32_ofp
-adpt_flowdb_entry_id_list_del(ctc_list_pointer_t *p_list, adpt_flow_entry_id_list_t* p_entry_id)
+/* fill pp_update[level] with the last node of each level before p_node */
+static void
+adpt_flowdb_index_search(adpt_flow_index_t* p_index, const adpt_flow_index_node_t* p_node,
+                         adpt_flow_index_node_t** pp_update)
 {
-    ctc_list_pointer_delete(p_list, &p_entry_id->node);
+    adpt_flow_index_node_t* p_cur = &p_index->head;
+    int32_ofp level;
 
-    return OFP_ERR_SUCCESS;
+    for (level = p_index->level - 1; level >= 0; level--)
+    {
+        while (p_cur->next[level] && adpt_flowdb_index_before(p_cur->next[level], p_node))
+        {
+            p_cur = p_cur->next[level];
+        }
+        pp_update[level] = p_cur;
+    }
 }
 
 /**
@@ -781,36 +731,48 @@ adpt_flowdb_entry_id_list_del(ctc_list_pointer_t *p_list, adpt_flow_entry_id_lis
 int32_ofp
 adpt_flowdb_add_flow_priority_entry_id(ofp_flow_type_t flow_type, uint32_ofp priority, uint32_ofp entry_id)
 {
-    ctc_list_pointer_t* p_priority_list = NULL;
-    ctc_hash_t*         p_priority_hash = NULL;
-    adpt_flow_priority_list_t* p_priority = NULL;
-    adpt_flow_entry_id_list_t* p_entry_id = NULL;
+    adpt_flow_index_t* p_index = NULL;
+    adpt_flow_index_node_t* p_node = NULL;
+    adpt_flow_index_node_t* update[ADPT_FLOW_INDEX_MAX_LEVEL];
+    int32_ofp level;
 
-    ADPT_FLOWDB_SELECT_DB(OFP_ERR_INVALID_PARAM);
+    ADPT_FLOWDB_SELECT_INDEX(OFP_ERR_INVALID_PARAM);
 
-    /* 1. check if priority exists in p_priority_hash, if not create */
-    p_priority = adpt_flowdb_priority_hash_lookup(p_priority_hash, priority);
-    if (p_priority == NULL)
+    p_node = adpt_flowdb_index_node_alloc(p_index);
+    if (!p_node)
     {
-        p_priority = malloc(sizeof(adpt_flow_priority_list_t));
-        p_priority->priority = priority;
-        
-        ctc_list_pointer_init(&p_priority->entry_id_list);
-        
-        p_priority->entry_id_hash = ctc_hash_create(
-            ADPT_FLOW_ENTRY_ID_HASH_BLOCK_NUM,
-            ADPT_FLOW_ENTRY_ID_HASH_BLOCK_SIZE,
-            adpt_flowdb_entry_id_hash_make,
-            adpt_flowdb_entry_id_hash_cmp);
-
-        adpt_flowdb_priority_hash_add(p_priority_hash, p_priority);
-        adpt_flowdb_priority_list_add(p_priority_list, p_priority);
+        return OFP_ERR_NO_MEMORY;
     }
-    
-    p_entry_id = malloc(sizeof(adpt_flow_entry_id_hash_t));
-    p_entry_id->entry_id = entry_id;
-    adpt_flowdb_entry_id_hash_add(p_priority->entry_id_hash, p_entry_id);
-    adpt_flowdb_entry_id_list_add(&p_priority->entry_id_list, p_entry_id);
+
+    /* entries of the same priority keep their insertion order */
+    p_node->priority = priority;
+    p_node->entry_id = entry_id;
+    p_node->seq      = ++p_index->seq;
+    p_node->level    = adpt_flowdb_index_random_level(p_index);
+
+    for (level = p_index->level; level < p_node->level; level++)
+    {
+        p_index->head.next[level] = NULL;
+    }
+    if (p_node->level > p_index->level)
+    {
+        p_index->level = p_node->level;
+    }
+
+    adpt_flowdb_index_search(p_index, p_node, update);
+    for (level = 0; level < p_node->level; level++)
+    {
+        p_node->next[level] = update[level]->next[level];
+        update[level]->next[level] = p_node;
+    }
+    p_node->prev = update[0];
+    if (p_node->next[0])
+    {
+        p_node->next[0]->prev = p_node;
+    }
+
+    hmap_insert(&p_index->entry_id_map, &p_node->hmap_node, hash_int(entry_id, 0));
+    p_index->count++;
 
     return OFP_ERR_SUCCESS;
 }
@@ -825,35 +787,37 @@ adpt_flowdb_add_flow_priority_entry_id(ofp_flow_type_t flow_type, uint32_ofp pri
 int32_ofp
 adpt_flowdb_del_flow_priority_entry_id(ofp_flow_type_t flow_type, uint32_ofp priority, uint32_ofp entry_id)
 {
-    ctc_list_pointer_t* p_priority_list = NULL;
-    ctc_hash_t*         p_priority_hash = NULL;
-    adpt_flow_priority_list_t* p_priority = NULL;
-    adpt_flow_entry_id_list_t* p_entry_id = NULL;
+    adpt_flow_index_t* p_index = NULL;
+    adpt_flow_index_node_t* p_node = NULL;
+    adpt_flow_index_node_t* update[ADPT_FLOW_INDEX_MAX_LEVEL];
+    int32_ofp level;
 
-    ADPT_FLOWDB_SELECT_DB(OFP_ERR_INVALID_PARAM);
+    ADPT_FLOWDB_SELECT_INDEX(OFP_ERR_INVALID_PARAM);
 
-    /* 1. check if priority exists, if not return */
-    p_priority = adpt_flowdb_priority_hash_lookup(p_priority_hash, priority);
-    if (p_priority == NULL)
+    /* 1. check if the entry exists, if not return */
+    p_node = adpt_flowdb_index_find(p_index, entry_id);
+    if ((p_node == NULL) || (p_node->priority != priority))
     {
         return OFP_ERR_SUCCESS;
     }
-    
-    p_entry_id = adpt_flowdb_entry_id_hash_lookup(p_priority->entry_id_hash, entry_id);
-    if (p_entry_id)
+
+    adpt_flowdb_index_search(p_index, p_node, update);
+    for (level = 0; level < p_node->level; level++)
     {
-        adpt_flowdb_entry_id_hash_del(p_priority->entry_id_hash, p_entry_id);
-        adpt_flowdb_entry_id_list_del(&p_priority->entry_id_list, p_entry_id);
-        free(p_entry_id);
+        update[level]->next[level] = p_node->next[level];
     }
-    
-    if (ctc_list_pointer_empty(&p_priority->entry_id_list))
+    if (p_node->next[0])
+    {
+        p_node->next[0]->prev = p_node->prev;
+    }
+    while ((p_index->level > 1) && !p_index->head.next[p_index->level - 1])
     {
-        adpt_flowdb_priority_hash_del(p_priority_hash, p_priority);
-        adpt_flowdb_priority_list_del(p_priority_list, p_priority);
-        ctc_hash_free(p_priority->entry_id_hash);
-        free(p_priority);
+        p_index->level--;
     }
+
+    hmap_remove(&p_index->entry_id_map, &p_node->hmap_node);
+    adpt_flowdb_index_node_free(p_index, p_node);
+    p_index->count--;
     
     return OFP_ERR_SUCCESS;
 }
@@ -869,40 +833,23 @@ adpt_flowdb_del_flow_priority_entry_id(ofp_flow_type_t flow_type, uint32_ofp pri
 int32_ofp
 adpt_flowdb_get_prev_entry_id(ofp_flow_type_t flow_type, uint32_ofp priority, uint32_ofp entry_id, uint32_ofp* p_after_entry_id)
 {
-    ctc_list_pointer_t* p_priority_list = NULL;
-    ctc_hash_t*         p_priority_hash = NULL;
-    adpt_flow_priority_list_t* p_priority = NULL;
-    adpt_flow_entry_id_list_t* p_entry_id = NULL;
-    ctc_list_pointer_node_t*   p_priority_node = NULL;
-    ctc_list_pointer_node_t*   p_entry_id_node = NULL;
+    adpt_flow_index_t* p_index = NULL;
+    adpt_flow_index_node_t* p_node = NULL;
     
-    ADPT_FLOWDB_SELECT_DB(OFP_ERR_INVALID_PARAM);
+    ADPT_FLOWDB_SELECT_INDEX(OFP_ERR_INVALID_PARAM);
 
     *p_after_entry_id = 0;
     
-    p_priority = adpt_flowdb_priority_hash_lookup(p_priority_hash, priority);
-    ADPT_PTR_CHECK(p_priority);
-    
-    p_entry_id = adpt_flowdb_entry_id_hash_lookup(p_priority->entry_id_hash, entry_id);
-    ADPT_PTR_CHECK(p_entry_id);
-    
-    p_entry_id_node = ctc_list_pointer_prev(&p_entry_id->node);
-    p_priority_node = &p_priority->node;
-    while(p_priority_node)
+    p_node = adpt_flowdb_index_find(p_index, entry_id);
+    ADPT_PTR_CHECK(p_node);
+    if (p_node->priority != priority)
     {
-        if (p_entry_id_node)
-        {
-            p_entry_id = _ctc_container_of(p_entry_id_node, adpt_flow_entry_id_list_t, node);
-            *p_after_entry_id = p_entry_id->entry_id;
-            break;
-        }
+        return OFP_ERR_INVALID_PARAM;
+    }
 
-        p_priority_node = ctc_list_pointer_prev(p_priority_node);
-        if (p_priority_node)
-        {
-            p_priority = _ctc_container_of(p_priority_node, adpt_flow_priority_list_t, node);
-            p_entry_id_node = ctc_list_pointer_node_tail(&p_priority->entry_id_list);
-        }
+    if (p_node->prev != &p_index->head)
+    {
+        *p_after_entry_id = p_node->prev->entry_id;
     }
     
     return OFP_ERR_SUCCESS;
@@ -911,14 +858,9 @@ adpt_flowdb_get_prev_entry_id(ofp_flow_type_t flow_type, uint32_ofp priority, ui
 void
 adpt_flowdb_show_priority_db(ofp_flow_type_t flow_type)
 {
-    ctc_list_pointer_t* p_priority_list = NULL;
-    ctc_hash_t*         p_priority_hash = NULL;
-
-    ctc_list_pointer_node_t* p_priority_node;
-    adpt_flow_priority_list_t* p_priority;
-
-    ctc_list_pointer_node_t* p_entry_id_node;
-    adpt_flow_entry_id_list_t* p_entry_id;
+    adpt_flow_index_t* p_index = NULL;
+    adpt_flow_index_node_t* p_node;
+    uint32_ofp entry_cnt = 0;
 
     if (flow_type == FLOW_TYPE_ANY)
     {
@@ -929,34 +871,39 @@ adpt_flowdb_show_priority_db(ofp_flow_type_t flow_type)
         ctc_cli_out_ofp("Print Priority DB of IPv4 entry\n");
     }
     
-    ADPT_FLOWDB_SELECT_DB();
+    ADPT_FLOWDB_SELECT_INDEX();
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
     ctc_cli_out_ofp("Priority   |  Value (QoS Entry ID)\n");
     ctc_cli_out_ofp(" ---------------------------------\n");
 
-    CTC_LIST_POINTER_LOOP(p_priority_node, p_priority_list)
+    for (p_node = p_index->head.next[0]; p_node; p_node = p_node->next[0])
     {
-        uint32_ofp entry_cnt = 0;
-        
-        p_priority = _ctc_container_of(p_priority_node, adpt_flow_priority_list_t, node);
-        
-        ctc_cli_out_ofp("%-10u | ", p_priority->priority);
-        
-        CTC_LIST_POINTER_LOOP(p_entry_id_node, &p_priority->entry_id_list)
+        if ((p_node->prev == &p_index->head) || (p_node->prev->priority != p_node->priority))
         {
-            p_entry_id = _ctc_container_of(p_entry_id_node, adpt_flow_entry_id_list_t, node);
-            
-            ctc_cli_out_ofp("%u ", p_entry_id->entry_id);
-            if ((entry_cnt + 1) % 10 == 0)
+            if (p_node->prev != &p_index->head)
             {
-                ctc_cli_out_ofp("\n%13s", "");
+                ctc_cli_out_ofp("\n");
             }
-            entry_cnt ++;
+            ctc_cli_out_ofp("%-10u | ", p_node->priority);
+            entry_cnt = 0;
         }
+        
+        ctc_cli_out_ofp("%u ", p_node->entry_id);
+        if ((entry_cnt + 1) % 10 == 0)
+        {
+            ctc_cli_out_ofp("\n%13s", "");
+        }
+        entry_cnt ++;
+    }
+    if (p_index->head.next[0])
+    {
         ctc_cli_out_ofp("\n");
     }
 
     ctc_cli_out_ofp(" ---------------------------------\n");
+    ctc_cli_out_ofp("%u entries, %u levels\n", p_index->count, p_index->level);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
 }
 
 /**
@@ -974,18 +921,8 @@ adpt_flow_db_init(void)
 
     ihash_init(&g_p_adpt_flow_master->flow_info_ihmap);
 
-    ctc_list_pointer_init(ADPT_FLOW_MAC_PRIORITY_LIST);
-    ctc_list_pointer_init(ADPT_FLOW_IPV4_PRIORITY_LIST);
-    ADPT_FLOW_MAC_PRIORITY_HASH = ctc_hash_create(
-        ADPT_FLOW_PRIORITY_HASH_BLOCK_NUM,
-        ADPT_FLOW_PRIORITY_HASH_BLOCK_SIZE,
-        adpt_flowdb_priority_hash_make,
-        adpt_flowdb_priority_hash_cmp);
-    ADPT_FLOW_IPV4_PRIORITY_HASH = ctc_hash_create(
-        ADPT_FLOW_PRIORITY_HASH_BLOCK_NUM,
-        ADPT_FLOW_PRIORITY_HASH_BLOCK_SIZE,
-        adpt_flowdb_priority_hash_make,
-        adpt_flowdb_priority_hash_cmp);
+    adpt_flowdb_index_init(ADPT_FLOW_MAC_INDEX);
+    adpt_flowdb_index_init(ADPT_FLOW_IPV4_INDEX);
 
     if (GLB_STM_DEFAULT == g_current_profile)
     {
@@ -1020,51 +957,12 @@ adpt_flow_db_init(void)
 int32_ofp
 adpt_flow_db_deinit(void)
 {
-    ctc_list_pointer_node_t* p_priority_node;
-    ctc_list_pointer_node_t* p_priority_next_node;
-    adpt_flow_priority_list_t* p_priority;
-
-    ctc_list_pointer_node_t* p_entry_id_node;
-    ctc_list_pointer_node_t* p_entry_id_next_node;
-    adpt_flow_entry_id_list_t* p_entry_id;
-
     ADPT_MODULE_INIT_CHECK(g_p_adpt_flow_master);
     
     ihash_destroy_free_data(&g_p_adpt_flow_master->flow_info_ihmap);
 
-    CTC_LIST_POINTER_LOOP_DEL(p_priority_node, p_priority_next_node, ADPT_FLOW_MAC_PRIORITY_LIST)
-    {
-        p_priority = _ctc_container_of(p_priority_node, adpt_flow_priority_list_t, node);
-        CTC_LIST_POINTER_LOOP_DEL(p_entry_id_node, p_entry_id_next_node, &p_priority->entry_id_list)
-        {
-            p_entry_id = _ctc_container_of(p_entry_id_node, adpt_flow_entry_id_list_t, node);
-
-            adpt_flowdb_entry_id_hash_del(p_priority->entry_id_hash, p_entry_id);
-            adpt_flowdb_entry_id_list_del(&p_priority->entry_id_list, p_entry_id);
-        }
-        ctc_hash_free(p_priority->entry_id_hash);
-
-        adpt_flowdb_priority_hash_del(ADPT_FLOW_MAC_PRIORITY_HASH, p_priority);
-        adpt_flowdb_priority_list_del(ADPT_FLOW_MAC_PRIORITY_LIST, p_priority);
-    }
-    
-    CTC_LIST_POINTER_LOOP_DEL(p_priority_node, p_priority_next_node, ADPT_FLOW_IPV4_PRIORITY_LIST)
-    {
-        p_priority = _ctc_container_of(p_priority_node, adpt_flow_priority_list_t, node);
-        CTC_LIST_POINTER_LOOP_DEL(p_entry_id_node, p_entry_id_next_node , &p_priority->entry_id_list)
-        {
-            p_entry_id = _ctc_container_of(p_entry_id_node, adpt_flow_entry_id_list_t, node);
-
-            adpt_flowdb_entry_id_hash_del(p_priority->entry_id_hash, p_entry_id);
-            adpt_flowdb_entry_id_list_del(&p_priority->entry_id_list, p_entry_id);
-        }
-        ctc_hash_free(p_priority->entry_id_hash);
-
-        adpt_flowdb_priority_hash_del(ADPT_FLOW_IPV4_PRIORITY_HASH, p_priority);
-        adpt_flowdb_priority_list_del(ADPT_FLOW_IPV4_PRIORITY_LIST, p_priority);
-    }
-    ctc_hash_free(ADPT_FLOW_MAC_PRIORITY_HASH);
-    ctc_hash_free(ADPT_FLOW_IPV4_PRIORITY_HASH);
+    adpt_flowdb_index_deinit(ADPT_FLOW_MAC_INDEX);
+    adpt_flowdb_index_deinit(ADPT_FLOW_IPV4_INDEX);
 
     return OFP_ERR_SUCCESS;
 }
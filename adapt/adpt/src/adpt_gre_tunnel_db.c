@@ -25,6 +25,7 @@
 #include "ofp_api.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_port.h"
 #include "adpt_gre_tunnel.h"
 #include "adpt_gre_tunnel_priv.h"
@@ -117,7 +118,11 @@ adpt_tunneldb_add_service_id(uint32_ofp tunnel_port, uint32_ofp tunnel_id, uint3
         p_service_id_info->service_id  = service_id;
         p_service_id_info->ref         = 1;
 
-        ctc_hash_insert(ADPT_SERVICE_ID_HASH, p_service_id_info);
+        if (NULL == ctc_hash_insert(ADPT_SERVICE_ID_HASH, p_service_id_info))
+        {
+            free(p_service_id_info);
+            return OFP_ERR_NO_MEMORY;
+        }
     }
     
     return OFP_ERR_SUCCESS;
@@ -253,6 +258,7 @@ adpt_tunneldb_show_service_id(void)
     ADPT_MODULE_INIT_CHECK(g_p_tunnel_master);
     ADPT_MODULE_INIT_CHECK(ADPT_SERVICE_ID_HASH);
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
     ctc_cli_out_ofp("The Maximum combination of tunnel port and tunnel id is %u, currently is %u \n\n",
         OFP_TUNNEL_SERVICE_ID_NUM, ADPT_SERVICE_ID_HASH->count);
 
@@ -263,6 +269,7 @@ adpt_tunneldb_show_service_id(void)
     {
         ctc_hash_traverse(ADPT_SERVICE_ID_HASH, (hash_traversal_fn)adpt_tunneldb_show_service_id_info, &tunnel_port);
     }
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
 
     return OFP_ERR_SUCCESS;
 }
@@ -329,7 +336,11 @@ adpt_tunneldb_add_local_ip(uint32_ofp local_ip)
         p_local_ip_info->local_ip = local_ip;
         p_local_ip_info->ref = 1;
 
-        ctc_hash_insert(ADPT_LOCAL_IP_HASH, p_local_ip_info);
+        if (NULL == ctc_hash_insert(ADPT_LOCAL_IP_HASH, p_local_ip_info))
+        {
+            free(p_local_ip_info);
+            return OFP_ERR_NO_MEMORY;
+        }
     }
     
     return OFP_ERR_SUCCESS;
@@ -399,6 +410,7 @@ adpt_tunneldb_show_local_ip(void)
     ADPT_MODULE_INIT_CHECK(g_p_tunnel_master);
     ADPT_MODULE_INIT_CHECK(ADPT_LOCAL_IP_HASH);
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
     ctc_hash_get_count(ADPT_LOCAL_IP_HASH, &local_ip_cnt);
 
     ctc_cli_out_ofp("The Maximum of local ip is %u, currently is %u \n",
@@ -406,6 +418,7 @@ adpt_tunneldb_show_local_ip(void)
     ctc_cli_out_ofp("----------------------------------------------------\n");
 
     ctc_hash_traverse(ADPT_LOCAL_IP_HASH, (hash_traversal_fn)adpt_tunneldb_show_local_ip_info, &i);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
 
     return OFP_ERR_SUCCESS;
 }
@@ -475,7 +488,11 @@ adpt_tunneldb_add_local_remote_ip(uint32_ofp local_ip, uint32_ofp remote_ip)
     p_ip_info->remote_ip = remote_ip;
     p_ip_info->ref       = 1;
 
-    ctc_hash_insert(ADPT_LOCAL_REMOTE_IP_HASH, p_ip_info);
+    if (NULL == ctc_hash_insert(ADPT_LOCAL_REMOTE_IP_HASH, p_ip_info))
+    {
+        free(p_ip_info);
+        return OFP_ERR_NO_MEMORY;
+    }
 
     return OFP_ERR_SUCCESS;
 }
@@ -554,11 +571,13 @@ adpt_tunneldb_show_local_remote_ip(void)
     ADPT_MODULE_INIT_CHECK(g_p_tunnel_master);
     ADPT_MODULE_INIT_CHECK(ADPT_LOCAL_REMOTE_IP_HASH);
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
     ctc_cli_out_ofp("The Maximum of local remote ip is %u, currently is %u \n",
         OFP_TUNNEL_MAX_LOCAL_IP_NUM, ADPT_LOCAL_REMOTE_IP_HASH->count);
 
     ctc_cli_out_ofp("---------------------------------------------------------\n");
     ctc_hash_traverse(ADPT_LOCAL_REMOTE_IP_HASH, (hash_traversal_fn)adpt_tunneldb_show_local_remote_ip_info, &index);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
 
     return OFP_ERR_SUCCESS;
 }
@@ -620,7 +639,11 @@ adpt_tunneldb_add_bind_port(uint16_ofp bind_port)
         p_bind_port_info->bind_port = bind_port;
         p_bind_port_info->ref = 1;
 
-        ctc_hash_insert(ADPT_BIND_PORT_HASH, p_bind_port_info);
+        if (NULL == ctc_hash_insert(ADPT_BIND_PORT_HASH, p_bind_port_info))
+        {
+            free(p_bind_port_info);
+            return OFP_ERR_NO_MEMORY;
+        }
     }
     
     return OFP_ERR_SUCCESS;
@@ -703,9 +726,11 @@ adpt_tunneldb_show_bind_port(void)
 {
     int32_ofp i = 0;
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
     ctc_cli_out_ofp("Print tunnel bind port DB\n");
     ctc_cli_out_ofp("--------------------------------------\n");
     ctc_hash_traverse(ADPT_BIND_PORT_HASH, (hash_traversal_fn)adpt_tunneldb_show_bind_port_info, &i);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
 
     return OFP_ERR_SUCCESS;
 }
@@ -735,6 +760,7 @@ adpt_tunneldb_show_tunnel_port(void)
     uint32_ofp local_ip_network_byte_order = 0;
     uint32_ofp remote_ip_network_byte_order = 0;
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT) | ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
     adpt_port_get_tunnel_port_max(&port_max);
     adpt_port_get_tunnel_port_count(&port_count);
 
@@ -742,6 +768,7 @@ adpt_tunneldb_show_tunnel_port(void)
         port_max, port_count);
     if (port_count == 0)
     {
+        adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT) | ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
         return OFP_ERR_SUCCESS;
     }
 
@@ -793,6 +820,7 @@ adpt_tunneldb_show_tunnel_port(void)
 
         i++;
     }
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT) | ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
 #undef TEMP_STR_LEN
 
     return OFP_ERR_SUCCESS;
@@ -813,6 +841,7 @@ adpt_tunneldb_show_tunnel_info(void)
     uint32_ofp port_count;
     int32_ofp  ret;
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT) | ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
     adpt_port_get_tunnel_port_max(&port_max);
     adpt_port_get_tunnel_port_count(&port_count);
 
@@ -844,6 +873,7 @@ adpt_tunneldb_show_tunnel_info(void)
 
         i++;
     }
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT) | ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
 
     return OFP_ERR_SUCCESS;
 }
@@ -0,0 +1,426 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file
+ * @brief This file is the main file for adapter lock domains
+ */
+
+/****************************************************************************
+ *
+ * Header Files
+ *
+ ****************************************************************************/
+#include <time.h>
+
+#include "sal.h"
+#include "sal_mutex.h"
+
+#include "ofp_api.h"
+
+#include "adpt.h"
+#include "adpt_lock.h"
+
+/****************************************************************************
+ *
+ * Global and Declaration
+ *
+ ****************************************************************************/
+VLOG_DEFINE_THIS_MODULE(adapt_lock);
+
+/**
+ @brief lock domain
+*/
+struct adpt_lock_domain_s
+{
+    sal_rwlock_t* p_rwlock;             /**< the domain lock */
+    sal_mutex_t* p_stats_mutex;         /**< protects stats, there is no 64 bit atomic on mips32 */
+    adpt_lock_stats_t stats[2];         /**< profile of the read and write acquisitions */
+};
+typedef struct adpt_lock_domain_s adpt_lock_domain_t;
+
+static adpt_lock_domain_t g_adpt_lock_domain[ADPT_LOCK_MAX];
+
+static const char* g_adpt_lock_name[ADPT_LOCK_MAX] =
+{
+    "flow",
+    "port",
+    "tunnel",
+    "stats",
+};
+
+/* Time the acquisitions, off by default so a take costs no clock read or stats mutex */
+static volatile bool g_adpt_lock_profile;
+
+/* Domains held by the current thread */
+static __thread uint32_ofp g_adpt_lock_depth[ADPT_LOCK_MAX];
+static __thread bool g_adpt_lock_is_wr[ADPT_LOCK_MAX];
+static __thread bool g_adpt_lock_timed[ADPT_LOCK_MAX];
+static __thread uint64_ofp g_adpt_lock_since[ADPT_LOCK_MAX];
+
+static struct vlog_rate_limit adpt_lock_rl = VLOG_RATE_LIMIT_INIT(1, 5);
+
+/****************************************************************************
+ *
+ * Function
+ *
+ ****************************************************************************/
+
+/**
+ * Get monotonic time in nano seconds
+ * @return time
+ */
+static inline uint64_ofp
+adpt_lock_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_ofp)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * Map a duration to its histogram bucket
+ * @param[in]  nsec                     Duration
+ * @return bucket index
+ */
+static uint32_ofp
+adpt_lock_hist_index(uint64_ofp nsec)
+{
+    uint64_ofp usec = nsec / 1000;
+    uint32_ofp index = 0;
+
+    while (usec && index < ADPT_LOCK_HIST_NUM - 1)
+    {
+        usec >>= 1;
+        index++;
+    }
+
+    return index;
+}
+
+/**
+ * Take one lock domain
+ * @param[in]  lock                     Lock domain
+ * @param[in]  is_wr                    Take for write
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+adpt_lock_take(adpt_lock_t lock, bool is_wr)
+{
+    adpt_lock_domain_t* p_domain = &g_adpt_lock_domain[lock];
+    adpt_lock_stats_t* p_stats;
+    uint64_ofp start, wait = 0;
+    bool contended = false;
+    uint32_ofp i;
+
+    if (g_adpt_lock_depth[lock])
+    {
+        /* the caller would write under a read lock, an upgrade could deadlock
+         * against another reader doing the same */
+        if (is_wr && !g_adpt_lock_is_wr[lock])
+        {
+            VLOG_ERR("%s lock is held for read, can not take it for write",
+                     g_adpt_lock_name[lock]);
+            return OFP_ERR_FAIL;
+        }
+        g_adpt_lock_depth[lock]++;
+        return OFP_ERR_SUCCESS;
+    }
+
+    for (i = lock + 1; i < ADPT_LOCK_MAX; i++)
+    {
+        if (g_adpt_lock_depth[i])
+        {
+            VLOG_WARN_RL(&adpt_lock_rl, "%s lock taken while holding %s lock, out of lock order",
+                         g_adpt_lock_name[lock], g_adpt_lock_name[i]);
+            break;
+        }
+    }
+
+    g_adpt_lock_depth[lock] = 1;
+    g_adpt_lock_is_wr[lock] = is_wr;
+    g_adpt_lock_timed[lock] = g_adpt_lock_profile;
+    if (!g_adpt_lock_timed[lock])
+    {
+        if (is_wr)
+        {
+            sal_rwlock_wrlock(p_domain->p_rwlock);
+        }
+        else
+        {
+            sal_rwlock_rdlock(p_domain->p_rwlock);
+        }
+        return OFP_ERR_SUCCESS;
+    }
+
+    start = adpt_lock_now();
+    if (is_wr ? !sal_rwlock_try_wrlock(p_domain->p_rwlock)
+              : !sal_rwlock_try_rdlock(p_domain->p_rwlock))
+    {
+        contended = true;
+        if (is_wr)
+        {
+            sal_rwlock_wrlock(p_domain->p_rwlock);
+        }
+        else
+        {
+            sal_rwlock_rdlock(p_domain->p_rwlock);
+        }
+        g_adpt_lock_since[lock] = adpt_lock_now();
+        wait = g_adpt_lock_since[lock] - start;
+    }
+    else
+    {
+        g_adpt_lock_since[lock] = start;
+    }
+
+    p_stats = &p_domain->stats[is_wr];
+    sal_mutex_lock(p_domain->p_stats_mutex);
+    p_stats->count++;
+    if (contended)
+    {
+        p_stats->contended++;
+        p_stats->wait_nsec += wait;
+        if (wait > p_stats->wait_max_nsec)
+        {
+            p_stats->wait_max_nsec = wait;
+        }
+    }
+    p_stats->wait_hist[adpt_lock_hist_index(wait)]++;
+    sal_mutex_unlock(p_domain->p_stats_mutex);
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Release one lock domain
+ * @param[in]  lock                     Lock domain
+ */
+static void
+adpt_lock_give(adpt_lock_t lock)
+{
+    adpt_lock_domain_t* p_domain = &g_adpt_lock_domain[lock];
+    adpt_lock_stats_t* p_stats;
+    uint64_ofp hold;
+
+    if (0 == g_adpt_lock_depth[lock])
+    {
+        VLOG_ERR_RL(&adpt_lock_rl, "%s lock released but not held", g_adpt_lock_name[lock]);
+        return;
+    }
+    if (--g_adpt_lock_depth[lock])
+    {
+        return;
+    }
+
+    if (!g_adpt_lock_timed[lock])
+    {
+        sal_rwlock_unlock(p_domain->p_rwlock);
+        return;
+    }
+
+    hold = adpt_lock_now() - g_adpt_lock_since[lock];
+    p_stats = &p_domain->stats[g_adpt_lock_is_wr[lock]];
+    sal_rwlock_unlock(p_domain->p_rwlock);
+
+    sal_mutex_lock(p_domain->p_stats_mutex);
+    p_stats->hold_nsec += hold;
+    if (hold > p_stats->hold_max_nsec)
+    {
+        p_stats->hold_max_nsec = hold;
+    }
+    p_stats->hold_hist[adpt_lock_hist_index(hold)]++;
+    sal_mutex_unlock(p_domain->p_stats_mutex);
+}
+
+/**
+ * Take a set of lock domains, on failure none of them is taken
+ * @param[in]  locks                    ADPT_LOCK_RD()/ADPT_LOCK_WR() bits
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock(uint32_ofp locks)
+{
+    uint32_ofp lock;
+    int32_ofp ret = OFP_ERR_SUCCESS;
+
+    for (lock = 0; lock < ADPT_LOCK_MAX; lock++)
+    {
+        if (locks & ADPT_LOCK_WR(lock))
+        {
+            ret = adpt_lock_take(lock, true);
+        }
+        else if (locks & ADPT_LOCK_RD(lock))
+        {
+            ret = adpt_lock_take(lock, false);
+        }
+        if (ret)
+        {
+            break;
+        }
+    }
+
+    if (ret)
+    {
+        while (lock-- > 0)
+        {
+            if (locks & (ADPT_LOCK_RD(lock) | ADPT_LOCK_WR(lock)))
+            {
+                adpt_lock_give(lock);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * Release a set of lock domains taken by adpt_lock()
+ * @param[in]  locks                    Same bits as passed to adpt_lock()
+ */
+void
+adpt_unlock(uint32_ofp locks)
+{
+    uint32_ofp lock;
+
+    for (lock = ADPT_LOCK_MAX; lock-- > 0; )
+    {
+        if (locks & (ADPT_LOCK_RD(lock) | ADPT_LOCK_WR(lock)))
+        {
+            adpt_lock_give(lock);
+        }
+    }
+}
+
+/**
+ * Get the name of a lock domain
+ * @param[in]  lock                     Lock domain
+ * @return name
+ */
+const char*
+adpt_lock_name(adpt_lock_t lock)
+{
+    return lock < ADPT_LOCK_MAX ? g_adpt_lock_name[lock] : "unknown";
+}
+
+/**
+ * Turn the timing of the lock acquisitions on or off
+ * @param[in]  enable                   Time the acquisitions
+ */
+void
+adpt_lock_set_profile(bool enable)
+{
+    g_adpt_lock_profile = enable;
+}
+
+/**
+ * Tell whether the lock acquisitions are timed
+ * @return true if they are
+ */
+bool
+adpt_lock_get_profile(void)
+{
+    return g_adpt_lock_profile;
+}
+
+/**
+ * Get the contention profile of a lock domain
+ * @param[in]  lock                     Lock domain
+ * @param[out] p_rd_stats               Profile of the read acquisitions
+ * @param[out] p_wr_stats               Profile of the write acquisitions
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock_get_stats(adpt_lock_t lock, adpt_lock_stats_t* p_rd_stats, adpt_lock_stats_t* p_wr_stats)
+{
+    adpt_lock_domain_t* p_domain;
+
+    ADPT_PTR_CHECK(p_rd_stats);
+    ADPT_PTR_CHECK(p_wr_stats);
+    if (lock >= ADPT_LOCK_MAX)
+    {
+        return OFP_ERR_INVALID_PARAM;
+    }
+
+    p_domain = &g_adpt_lock_domain[lock];
+    if (NULL == p_domain->p_stats_mutex)
+    {
+        return OFP_ERR_NOT_INIT;
+    }
+
+    sal_mutex_lock(p_domain->p_stats_mutex);
+    memcpy(p_rd_stats, &p_domain->stats[false], sizeof(adpt_lock_stats_t));
+    memcpy(p_wr_stats, &p_domain->stats[true], sizeof(adpt_lock_stats_t));
+    sal_mutex_unlock(p_domain->p_stats_mutex);
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Clear the contention profile of all lock domains
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock_clear_stats(void)
+{
+    adpt_lock_domain_t* p_domain;
+    uint32_ofp lock;
+
+    for (lock = 0; lock < ADPT_LOCK_MAX; lock++)
+    {
+        p_domain = &g_adpt_lock_domain[lock];
+        if (NULL == p_domain->p_stats_mutex)
+        {
+            return OFP_ERR_NOT_INIT;
+        }
+
+        sal_mutex_lock(p_domain->p_stats_mutex);
+        memset(p_domain->stats, 0, sizeof(p_domain->stats));
+        sal_mutex_unlock(p_domain->p_stats_mutex);
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Init lock domains
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+adpt_lock_init(void)
+{
+    adpt_lock_domain_t* p_domain;
+    uint32_ofp lock;
+
+    for (lock = 0; lock < ADPT_LOCK_MAX; lock++)
+    {
+        p_domain = &g_adpt_lock_domain[lock];
+        if (p_domain->p_rwlock)
+        {
+            continue;
+        }
+
+        if (sal_rwlock_create(&p_domain->p_rwlock))
+        {
+            return OFP_ERR_NO_MEMORY;
+        }
+        if (sal_mutex_create(&p_domain->p_stats_mutex))
+        {
+            return OFP_ERR_NO_MEMORY;
+        }
+    }
+
+    return OFP_ERR_SUCCESS;
+}
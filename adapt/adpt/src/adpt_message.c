@@ -25,6 +25,7 @@
 #include "ofp_api.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_message.h"
 #include "adpt_message_priv.h"
 
@@ -58,6 +59,7 @@ int32_ofp
 adpt_message_dispatch_msg_from_lcm(adpt_msg_type_t type, void* arg)
 {
     int32_ofp ret = OFP_ERR_SUCCESS;
+    uint32_ofp locks;
     
     if (ADPT_MSG_TYPE_MODULE_INIT == type && NULL == g_p_adpt_message_master)
     {
@@ -69,7 +71,16 @@ adpt_message_dispatch_msg_from_lcm(adpt_msg_type_t type, void* arg)
     ADPT_MODULE_INIT_CHECK(g_p_adpt_message_master);
     if (g_p_adpt_message_master->lcm2adpt_msg_cb[type])
     {
-        ret = g_p_adpt_message_master->lcm2adpt_msg_cb[type](arg);
+        /* Link status only touches the port db, port create/destroy also
+         * allocate nexthops */
+        locks = (ADPT_MSG_TYPE_NOTIFY_LINK == type) ? ADPT_LOCK_WR(ADPT_LOCK_PORT)
+                                                    : ADPT_LOCK_PORT_UPDATE;
+        ret = adpt_lock(locks);
+        if (OFP_ERR_SUCCESS == ret)
+        {
+            ret = g_p_adpt_message_master->lcm2adpt_msg_cb[type](arg);
+            adpt_unlock(locks);
+        }
         if (ret)
         {
             ADPT_LOG_ERROR("Fail to process lcm message %d, ret = %d\n", type, ret)
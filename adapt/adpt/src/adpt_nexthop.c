@@ -27,6 +27,7 @@
 #include "ofp_api.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_flow.h"
 #include "adpt_port.h"
 #include "adpt_nexthop.h"
@@ -36,6 +37,8 @@
 
 #include "hal_nexthop.h"
 
+#include "hash.h"
+
 /****************************************************************************
  *
  * Global and Declaration
@@ -51,6 +54,287 @@ VLOG_DEFINE_THIS_MODULE(adapt_nexthop);
  *
  ****************************************************************************/
 
+/**
+ * Is the next-hop a flex next-hop shared through the edit cache
+ * @param[in] nh_type                   ofp_nh_type_t
+ * @return true/false
+ */
+static inline bool
+adpt_nexthop_is_shared_flex(ofp_nh_type_t nh_type)
+{
+    return OPF_NH_TYPE_NH_FLEX == nh_type ||
+           OPF_NH_TYPE_NH_FLEX_QINQ == nh_type ||
+           OPF_NH_TYPE_NH_FLEX_IPDA == nh_type;
+}
+
+/**
+ * Find the shared flex next-hop with the same edit
+ * @param[in] p_param                   ctc_flex_nh_param_t, dsnh_offset cleared
+ * @param[in] hash                      hash of p_param
+ * @return node, NULL if not found
+ */
+static adpt_nexthop_flex_node_t*
+adpt_nexthop_flex_find_by_param(const ctc_flex_nh_param_t* p_param, uint32_ofp hash)
+{
+    adpt_nexthop_flex_node_t* p_node;
+
+    HMAP_FOR_EACH_WITH_HASH(p_node, param_node, hash, &g_p_adpt_nexthop_master->flex_param_map)
+    {
+        if (!memcmp(&p_node->param, p_param, sizeof(ctc_flex_nh_param_t)))
+        {
+            return p_node;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Find the shared flex next-hop by nhid
+ * @param[in] nhid                      nhid
+ * @return node, NULL if not found
+ */
+static adpt_nexthop_flex_node_t*
+adpt_nexthop_flex_find_by_nhid(uint32_ofp nhid)
+{
+    adpt_nexthop_flex_node_t* p_node;
+
+    HMAP_FOR_EACH_WITH_HASH(p_node, nhid_node, hash_int(nhid, 0), &g_p_adpt_nexthop_master->flex_nhid_map)
+    {
+        if (p_node->nh.nhid == nhid)
+        {
+            return p_node;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Drop one reference to a shared flex next-hop
+ * @param[in] p_nh_offset               pointer to ofp_nh_offset_t
+ * @return true if other outputs still use the next-hop and it must be kept
+ */
+static bool
+adpt_nexthop_flex_unref(ofp_nh_offset_t* p_nh_offset)
+{
+    adpt_nexthop_flex_node_t* p_node;
+
+    p_node = adpt_nexthop_flex_find_by_nhid(p_nh_offset->nhid);
+    if (NULL == p_node)
+    {
+        return false;
+    }
+
+    g_p_adpt_nexthop_master->flex_ref_cnt--;
+    if (--p_node->ref_cnt)
+    {
+        return true;
+    }
+
+    hmap_remove(&g_p_adpt_nexthop_master->flex_param_map, &p_node->param_node);
+    hmap_remove(&g_p_adpt_nexthop_master->flex_nhid_map, &p_node->nhid_node);
+    free(p_node);
+
+    return false;
+}
+
+/**
+ * Compare two mcast group members by nhid, hardware holds a member nhid once in a group
+ * @return <0, 0, >0
+ */
+static int32_ofp
+adpt_nexthop_mcast_member_cmp(const adpt_nexthop_mcast_member_t* p_a, const adpt_nexthop_mcast_member_t* p_b)
+{
+    if (p_a->nhid != p_b->nhid)
+    {
+        return p_a->nhid < p_b->nhid ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Build the member set of a mcast group, sorted by nhid and without duplicates. If a nhid is
+ * given with and without port_check_discard, the member does not check the port discard
+ * @param[in]  p_member_nh              member next-hops, entries with nhid 0 are skipped
+ * @param[in]  member_cnt               number of entries in p_member_nh
+ * @param[out] p_key                    member set, MAX_OUTPUT_PORT entries
+ * @return number of members in p_key
+ */
+static uint32_ofp
+adpt_nexthop_mcast_make_key(const ofp_nh_offset_t* p_member_nh, uint32_ofp member_cnt,
+                            adpt_nexthop_mcast_member_t* p_key)
+{
+    adpt_nexthop_mcast_member_t member;
+    uint32_ofp key_cnt = 0;
+    uint32_ofp i, j;
+    int32_ofp cmp;
+
+    for (i = 0; i < member_cnt && i < MAX_OUTPUT_PORT; i++)
+    {
+        if (0 == p_member_nh[i].nhid)
+        {
+            continue;
+        }
+
+        member.nhid = p_member_nh[i].nhid;
+        member.port_check_discard = p_member_nh[i].port_check_discard ? 1 : 0;
+
+        /* insertion sort, a group has at most MAX_OUTPUT_PORT members */
+        cmp = 1;
+        for (j = key_cnt; j > 0; j--)
+        {
+            cmp = adpt_nexthop_mcast_member_cmp(&p_key[j - 1], &member);
+            if (cmp <= 0)
+            {
+                break;
+            }
+        }
+        if (0 == cmp)
+        {
+            p_key[j - 1].port_check_discard &= member.port_check_discard;
+            continue;
+        }
+        memmove(&p_key[j + 1], &p_key[j], (key_cnt - j) * sizeof(adpt_nexthop_mcast_member_t));
+        p_key[j] = member;
+        key_cnt++;
+    }
+
+    return key_cnt;
+}
+
+/**
+ * Hash a mcast group member set
+ * @return hash
+ */
+static inline uint32_ofp
+adpt_nexthop_mcast_hash(const adpt_nexthop_mcast_member_t* p_key, uint32_ofp key_cnt)
+{
+    return hash_words((const uint32_t*)p_key, key_cnt * 2, key_cnt);
+}
+
+/**
+ * Find the shared mcast group with the same member set
+ * @return node, NULL if not found
+ */
+static adpt_nexthop_mcast_node_t*
+adpt_nexthop_mcast_find_by_key(const adpt_nexthop_mcast_member_t* p_key, uint32_ofp key_cnt, uint32_ofp hash)
+{
+    adpt_nexthop_mcast_node_t* p_node;
+
+    HMAP_FOR_EACH_WITH_HASH(p_node, member_node, hash, &g_p_adpt_nexthop_master->mcast_member_map)
+    {
+        if (p_node->member_cnt == key_cnt &&
+            !memcmp(p_node->member, p_key, key_cnt * sizeof(adpt_nexthop_mcast_member_t)))
+        {
+            return p_node;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Find the shared mcast group by group nhid
+ * @return node, NULL if not found
+ */
+static adpt_nexthop_mcast_node_t*
+adpt_nexthop_mcast_find_by_nhid(uint32_ofp nhid)
+{
+    adpt_nexthop_mcast_node_t* p_node;
+
+    HMAP_FOR_EACH_WITH_HASH(p_node, nhid_node, hash_int(nhid, 0), &g_p_adpt_nexthop_master->mcast_nhid_map)
+    {
+        if (p_node->group_nh.nhid == nhid)
+        {
+            return p_node;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Change the members of a shared mcast group, only the difference is written to hardware
+ * @param[in] p_node                    shared mcast group
+ * @param[in] p_key                     new member set
+ * @param[in] key_cnt                   number of members in p_key
+ * @return OFP_ERR_XX
+ */
+static int32_ofp
+adpt_nexthop_mcast_update_members(adpt_nexthop_mcast_node_t* p_node,
+                                  const adpt_nexthop_mcast_member_t* p_key, uint32_ofp key_cnt)
+{
+    uint32_ofp nhid = p_node->group_nh.nhid;
+    uint32_ofp i = 0, j = 0;
+    int32_ofp cmp;
+    int32_ofp ret = OFP_ERR_SUCCESS;
+
+    /* remove first, a member whose port_check_discard changes is removed and added again */
+    while (i < p_node->member_cnt && OFP_ERR_SUCCESS == ret)
+    {
+        cmp = j < key_cnt ? adpt_nexthop_mcast_member_cmp(&p_node->member[i], &p_key[j]) : -1;
+        if (cmp > 0)
+        {
+            j++;
+            continue;
+        }
+        if (cmp < 0 || p_node->member[i].port_check_discard != p_key[j].port_check_discard)
+        {
+            ret = hal_nexthop_del_mcast_member(nhid, p_node->member[i].nhid);
+        }
+        i++;
+        j += (0 == cmp);
+    }
+
+    for (i = 0, j = 0; j < key_cnt && OFP_ERR_SUCCESS == ret; )
+    {
+        cmp = i < p_node->member_cnt ? adpt_nexthop_mcast_member_cmp(&p_node->member[i], &p_key[j]) : 1;
+        if (cmp < 0)
+        {
+            i++;
+            continue;
+        }
+        if (cmp > 0 || p_node->member[i].port_check_discard != p_key[j].port_check_discard)
+        {
+            ret = hal_nexthop_add_mcast_member(nhid, p_key[j].nhid, p_key[j].port_check_discard);
+        }
+        j++;
+        i += (0 == cmp);
+    }
+
+    if (OFP_ERR_SUCCESS != ret)
+    {
+        ADPT_LOG_ERROR("Update members of mcast group %d failed, ret = %d", nhid, ret);
+        return ret;
+    }
+
+    hmap_remove(&g_p_adpt_nexthop_master->mcast_member_map, &p_node->member_node);
+    memcpy(p_node->member, p_key, key_cnt * sizeof(adpt_nexthop_mcast_member_t));
+    p_node->member_cnt = key_cnt;
+    hmap_insert(&g_p_adpt_nexthop_master->mcast_member_map, &p_node->member_node,
+                adpt_nexthop_mcast_hash(p_key, key_cnt));
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Drop a shared mcast group from the cache when its members no longer match hardware, the
+ * flows using it keep the group and release it as an unshared one
+ * @param[in] p_node                    shared mcast group
+ */
+static void
+adpt_nexthop_mcast_forget(adpt_nexthop_mcast_node_t* p_node)
+{
+    ADPT_LOG_ERROR("Members of mcast group %d are unknown, stop sharing it", p_node->group_nh.nhid);
+
+    g_p_adpt_nexthop_master->mcast_ref_cnt -= p_node->ref_cnt;
+    hmap_remove(&g_p_adpt_nexthop_master->mcast_member_map, &p_node->member_node);
+    hmap_remove(&g_p_adpt_nexthop_master->mcast_nhid_map, &p_node->nhid_node);
+    free(p_node);
+}
+
 /**
  * Allocate the next-hop info opf
  * @param[in]  type                     ofp_nh_info_type_t
@@ -153,6 +437,15 @@ adpt_nexthop_release_nh_info(ofp_nh_offset_t *nh_offset)
 
     if (!adpt_nexthop_is_reserved_nhid(nh_offset->nhid))
     {
+        if (adpt_nexthop_is_shared_flex(nh_offset->nh_type) && adpt_nexthop_flex_unref(nh_offset))
+        {
+            nh_offset->nhid = 0;
+            nh_offset->offset = 0;
+            nh_offset->nh_type = OPF_NH_TYPE_MAX;
+
+            return OFP_ERR_SUCCESS;
+        }
+
         if (OPF_NH_TYPE_NH_FLEX_QINQ == nh_offset->nh_type)
         {
             adpt_flowdb_decr_qinq_with_mac_cur_num();
@@ -386,14 +679,17 @@ adpt_nexthop_alloc_to_cpu_flex_nh(uint32_ofp flow_id, ofp_nh_offset_t* p_nh_offs
 /**
  * allocate the multi-cast flex next-hop
  * @param[in] p_action_combo            adpt_flow_action_combo_t
+ * @param[in] shared                    outputs with the same edit share one next-hop
  * @param[out] p_nh_offset              pointer to ofp_nh_offset_t
  * @return OFP_ERR_XX
  */
-int32_ofp
-adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offset_t* p_nh_offset)
+static int32_ofp
+_adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, bool shared, ofp_nh_offset_t* p_nh_offset)
 {
     int ret = OFP_ERR_SUCCESS;
     ctc_flex_nh_param_t nh_param;
+    adpt_nexthop_flex_node_t* p_node;
+    uint32_ofp hash;
     bool use_dsnh8w = false;
     bool is_qinq = false;
     bool is_write_ipda = false;
@@ -407,6 +703,23 @@ adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offs
         return OFP_ERR_SUCCESS;
     }
 
+    /* the edit is the key of the cache, dsnh_offset stays 0 until the next-hop is created */
+    memset(&nh_param, 0x0, sizeof(ctc_flex_nh_param_t));
+    ADPT_ERROR_RETURN(adpt_nexthop_map_flex_nh_param(p_action_combo, &nh_param));
+
+    hash = hash_bytes(&nh_param, sizeof(ctc_flex_nh_param_t), 0);
+    p_node = shared ? adpt_nexthop_flex_find_by_param(&nh_param, hash) : NULL;
+    if (p_node)
+    {
+        p_node->ref_cnt++;
+        g_p_adpt_nexthop_master->flex_ref_cnt++;
+        p_nh_offset->nhid    = p_node->nh.nhid;
+        p_nh_offset->offset  = p_node->nh.offset;
+        p_nh_offset->nh_type = p_node->nh.nh_type;
+
+        return OFP_ERR_SUCCESS;
+    }
+
     if (IS_FLAG_SET(p_action_combo->flag, OFP_FLOW_ACTION_FIELD_PUSH_SVLAN) &&
         IS_FLAG_SET(p_action_combo->flag, OFP_FLOW_ACTION_FIELD_PUSH_CVLAN) &&
         (IS_FLAG_SET(p_action_combo->flag, OFP_FLOW_ACTION_FIELD_SET_MACDA) ||
@@ -461,10 +774,7 @@ adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offs
 
     ADPT_ERROR_RETURN(adpt_nexthop_alloc_nh_info_opf(NH_INFO_TYPE_NH_ID, &p_nh_offset->nhid));
 
-    memset(&nh_param, 0x0, sizeof(ctc_flex_nh_param_t));
     nh_param.dsnh_offset = p_nh_offset->offset;
-
-    ADPT_ERROR_RETURN(adpt_nexthop_map_flex_nh_param(p_action_combo, &nh_param));
     ADPT_ERROR_RETURN(hal_nexthop_create_flex_nh(p_nh_offset->nhid, &nh_param));
 
     if (use_dsnh8w)
@@ -483,9 +793,47 @@ adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offs
         p_nh_offset->nh_type = OPF_NH_TYPE_NH_FLEX;
     }
 
+    /* without memory the next-hop is just not shared, releasing it still works */
+    p_node = shared ? malloc(sizeof(adpt_nexthop_flex_node_t)) : NULL;
+    if (p_node)
+    {
+        memcpy(&p_node->param, &nh_param, sizeof(ctc_flex_nh_param_t));
+        p_node->param.dsnh_offset = 0;
+        memcpy(&p_node->nh, p_nh_offset, sizeof(ofp_nh_offset_t));
+        p_node->ref_cnt = 1;
+        hmap_insert(&g_p_adpt_nexthop_master->flex_param_map, &p_node->param_node, hash);
+        hmap_insert(&g_p_adpt_nexthop_master->flex_nhid_map, &p_node->nhid_node, hash_int(p_node->nh.nhid, 0));
+        g_p_adpt_nexthop_master->flex_ref_cnt++;
+    }
+
     return ret;
 }
 
+/**
+ * allocate the multi-cast flex next-hop, outputs with the same edit share one next-hop
+ * @param[in] p_action_combo            adpt_flow_action_combo_t
+ * @param[out] p_nh_offset              pointer to ofp_nh_offset_t
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_alloc_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offset_t* p_nh_offset)
+{
+    return _adpt_nexthop_alloc_flex_nh(p_action_combo, true, p_nh_offset);
+}
+
+/**
+ * allocate a multi-cast flex next-hop that is not shared, used when a flow outputs the
+ * same edit more than once, a group holds a member next-hop only once
+ * @param[in] p_action_combo            adpt_flow_action_combo_t
+ * @param[out] p_nh_offset              pointer to ofp_nh_offset_t
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_alloc_unshared_flex_nh(adpt_flow_action_combo_t* p_action_combo, ofp_nh_offset_t* p_nh_offset)
+{
+    return _adpt_nexthop_alloc_flex_nh(p_action_combo, false, p_nh_offset);
+}
+
 /**
  * allocate ipuc next-hop to support decrease ip ttl
  * @param[in] p_action_combo            adpt_flow_action_combo_t
@@ -581,8 +929,25 @@ adpt_nexthop_alloc_mcast_group(ofp_nh_offset_t* p_group_nh)
 int32_ofp
 adpt_nexthop_release_mcast_group(ofp_nh_offset_t* p_group_nh)
 {
+    adpt_nexthop_mcast_node_t* p_node;
+
     ADPT_PTR_CHECK(p_group_nh);
 
+    p_node = adpt_nexthop_mcast_find_by_nhid(p_group_nh->nhid);
+    if (p_node)
+    {
+        g_p_adpt_nexthop_master->mcast_ref_cnt--;
+        if (--p_node->ref_cnt)
+        {
+            memset(p_group_nh, 0x0, sizeof(ofp_nh_offset_t));
+            return OFP_ERR_SUCCESS;
+        }
+
+        hmap_remove(&g_p_adpt_nexthop_master->mcast_member_map, &p_node->member_node);
+        hmap_remove(&g_p_adpt_nexthop_master->mcast_nhid_map, &p_node->nhid_node);
+        free(p_node);
+    }
+
     if (!adpt_nexthop_is_reserved_nhid(p_group_nh->nhid))
     {
         ADPT_ERROR_RETURN(hal_nexthop_remove_mcast_group(p_group_nh->nhid));
@@ -598,6 +963,129 @@ adpt_nexthop_release_mcast_group(ofp_nh_offset_t* p_group_nh)
     return OFP_ERR_SUCCESS;
 }
 
+/**
+ * get a multicast group replicating to a member set, flows with the same member set share one group
+ * @param[in] p_member_nh               member next-hops, entries with nhid 0 are skipped
+ * @param[in] member_cnt                number of entries in p_member_nh
+ * @param[in] p_old_group_nh            group the flow used before a modify, or NULL
+ * @param[out] p_group_nh               pointer to ofp_nh_offset_t
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_alloc_shared_mcast_group(ofp_nh_offset_t* p_member_nh, uint32_ofp member_cnt,
+                                      const ofp_nh_offset_t* p_old_group_nh, ofp_nh_offset_t* p_group_nh)
+{
+    adpt_nexthop_mcast_member_t key[MAX_OUTPUT_PORT];
+    adpt_nexthop_mcast_member_t old_key[MAX_OUTPUT_PORT];
+    adpt_nexthop_mcast_node_t* p_node;
+    uint32_ofp key_cnt, old_key_cnt;
+    uint32_ofp hash;
+    uint32_ofp i;
+    int32_ofp ret;
+
+    ADPT_PTR_CHECK(p_member_nh);
+    ADPT_PTR_CHECK(p_group_nh);
+
+    key_cnt = adpt_nexthop_mcast_make_key(p_member_nh, member_cnt, key);
+    hash = adpt_nexthop_mcast_hash(key, key_cnt);
+
+    g_p_adpt_nexthop_master->mcast_lookup_cnt++;
+    p_node = adpt_nexthop_mcast_find_by_key(key, key_cnt, hash);
+    if (p_node)
+    {
+        g_p_adpt_nexthop_master->mcast_hit_cnt++;
+        goto ref_node;
+    }
+
+    /* the modified flow is the only user of its old group, change its members instead of
+     * building a new group. The old reference is dropped when the old actions are released */
+    p_node = p_old_group_nh ? adpt_nexthop_mcast_find_by_nhid(p_old_group_nh->nhid) : NULL;
+    if (p_node && 1 == p_node->ref_cnt)
+    {
+        old_key_cnt = p_node->member_cnt;
+        memcpy(old_key, p_node->member, old_key_cnt * sizeof(adpt_nexthop_mcast_member_t));
+
+        ret = adpt_nexthop_mcast_update_members(p_node, key, key_cnt);
+        if (ret)
+        {
+            /* best effort, the old actions are still in use */
+            if (adpt_nexthop_mcast_update_members(p_node, old_key, old_key_cnt))
+            {
+                adpt_nexthop_mcast_forget(p_node);
+            }
+            return ret;
+        }
+        g_p_adpt_nexthop_master->mcast_update_cnt++;
+        goto ref_node;
+    }
+
+    /* p_group_nh is set before the members are added, so the caller releases a half built group */
+    ADPT_ERROR_RETURN(adpt_nexthop_alloc_mcast_group(p_group_nh));
+    for (i = 0; i < key_cnt; i++)
+    {
+        ADPT_ERROR_RETURN(hal_nexthop_add_mcast_member(p_group_nh->nhid, key[i].nhid, key[i].port_check_discard));
+    }
+
+    /* without memory the group is just not shared, releasing it still works */
+    p_node = malloc(sizeof(adpt_nexthop_mcast_node_t));
+    if (p_node)
+    {
+        memcpy(&p_node->group_nh, p_group_nh, sizeof(ofp_nh_offset_t));
+        p_node->ref_cnt = 1;
+        p_node->member_cnt = key_cnt;
+        memcpy(p_node->member, key, key_cnt * sizeof(adpt_nexthop_mcast_member_t));
+        hmap_insert(&g_p_adpt_nexthop_master->mcast_member_map, &p_node->member_node, hash);
+        hmap_insert(&g_p_adpt_nexthop_master->mcast_nhid_map, &p_node->nhid_node,
+                    hash_int(p_group_nh->nhid, 0));
+        g_p_adpt_nexthop_master->mcast_ref_cnt++;
+    }
+
+    return OFP_ERR_SUCCESS;
+
+ref_node:
+    p_node->ref_cnt++;
+    g_p_adpt_nexthop_master->mcast_ref_cnt++;
+    memcpy(p_group_nh, &p_node->group_nh, sizeof(ofp_nh_offset_t));
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * set the members of a shared multicast group, used to undo an in place update
+ * @param[in] p_group_nh                pointer to ofp_nh_offset_t
+ * @param[in] p_member_nh               member next-hops, entries with nhid 0 are skipped
+ * @param[in] member_cnt                number of entries in p_member_nh
+ * @return OFP_ERR_XX
+ */
+int32_ofp
+adpt_nexthop_set_mcast_group_members(const ofp_nh_offset_t* p_group_nh, ofp_nh_offset_t* p_member_nh,
+                                     uint32_ofp member_cnt)
+{
+    adpt_nexthop_mcast_member_t key[MAX_OUTPUT_PORT];
+    adpt_nexthop_mcast_node_t* p_node;
+    uint32_ofp key_cnt;
+    int32_ofp ret;
+
+    ADPT_PTR_CHECK(p_group_nh);
+    ADPT_PTR_CHECK(p_member_nh);
+
+    p_node = adpt_nexthop_mcast_find_by_nhid(p_group_nh->nhid);
+    if (NULL == p_node)
+    {
+        return OFP_ERR_SUCCESS;
+    }
+
+    key_cnt = adpt_nexthop_mcast_make_key(p_member_nh, member_cnt, key);
+    ret = adpt_nexthop_mcast_update_members(p_node, key, key_cnt);
+    if (ret)
+    {
+        adpt_nexthop_mcast_forget(p_node);
+        return ret;
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
 /**
  * allocate nexthop offset by type
  * @param[in]  type                     ofp_nh_type_t
@@ -772,10 +1260,24 @@ adpt_nexthop_phy_port_destory(uint32_ofp gport)
 int32_ofp
 adpt_nexthop_show_db(void)
 {
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
     ctc_cli_out_ofp(" -------------------- Nexthop DB -------------------------------------\n");
     ctc_cli_out_ofp(" all_group_nhid = %d, offset = %d\n", 
         g_p_adpt_nexthop_master->group_nh.nhid,
         g_p_adpt_nexthop_master->group_nh.offset);
+    ctc_cli_out_ofp(" shared flex nexthop = %d, referenced by %d outputs\n",
+        (uint32_ofp)hmap_count(&g_p_adpt_nexthop_master->flex_param_map),
+        g_p_adpt_nexthop_master->flex_ref_cnt);
+    ctc_cli_out_ofp(" shared mcast group = %d, referenced by %d flows\n",
+        (uint32_ofp)hmap_count(&g_p_adpt_nexthop_master->mcast_member_map),
+        g_p_adpt_nexthop_master->mcast_ref_cnt);
+    ctc_cli_out_ofp(" mcast group lookup = %d, hit = %d (%d%%), updated in place = %d\n",
+        g_p_adpt_nexthop_master->mcast_lookup_cnt,
+        g_p_adpt_nexthop_master->mcast_hit_cnt,
+        g_p_adpt_nexthop_master->mcast_lookup_cnt ?
+            (uint32_ofp)((uint64_ofp)g_p_adpt_nexthop_master->mcast_hit_cnt * 100 / g_p_adpt_nexthop_master->mcast_lookup_cnt) : 0,
+        g_p_adpt_nexthop_master->mcast_update_cnt);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
 
     return OFP_ERR_SUCCESS;
 }
@@ -790,6 +1292,10 @@ adpt_nexthop_init(void)
     g_p_adpt_nexthop_master = malloc(sizeof(adpt_nexthop_master_t));
     ADPT_MEM_PTR_CHECK(g_p_adpt_nexthop_master);
     memset(g_p_adpt_nexthop_master, 0, sizeof(adpt_nexthop_master_t));
+    hmap_init(&g_p_adpt_nexthop_master->flex_param_map);
+    hmap_init(&g_p_adpt_nexthop_master->flex_nhid_map);
+    hmap_init(&g_p_adpt_nexthop_master->mcast_member_map);
+    hmap_init(&g_p_adpt_nexthop_master->mcast_nhid_map);
     
     ADPT_ERROR_RETURN(adpt_nexthop_create_output_all_nh());
     
@@ -25,6 +25,7 @@
 #include "vlog.h"
 #include "ofp_api.h"
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_port.h"
 #include "adpt_port_priv.h"
 #include "adpt_nexthop.h"
@@ -463,6 +464,7 @@ adpt_portdb_traversal_show_port_info(void)
         return;
     }
     
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ctc_cli_out_ofp(" ------------------ Port LIST DB --------------------------------------\n");
     ctc_cli_out_ofp(" %6s %8s %11s %5s %7s \n", "ofport", "type", "name", "gport", "ifindex");
     ctc_cli_out_ofp(" ----------------------------------------------------------------------\n");
@@ -500,6 +502,7 @@ adpt_portdb_traversal_show_port_info(void)
             ctc_cli_out_ofp("%8s : %3d\n", OFP_MAP_INTF_TYPE_STR(type), ADPT_PORT_TYPE_PORT_NUM[type]);
         }
     }
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
 }
 
 static int32_ofp 
@@ -548,12 +551,14 @@ adpt_portdb_traversal_show_phy_info(void)
     int32_ofp type = OFP_INTERFACE_TYPE_PHYSICAL;
 
     /* adpt_port_phy_info_t */
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ctc_cli_out_ofp(" ------------------ Port PHY INFO DB ---------------------------------\n");
     ctc_cli_out_ofp(" %11s %5s %6s %6s %6s %10s [%2s %6s %6s %10s]port-config\n", 
         "name", "gport", "duplex", "speed", "link", "media",
         "En", "duplex", "speed", "media");
     ctc_cli_out_ofp(" ---------------------------------------------------------------------\n");
     ctc_hash_traverse(ADPT_PORT_GPORT_HASH, (hash_traversal_fn)adpt_portdb_show_phy_info, &type);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
 
     return OFP_ERR_SUCCESS;
 }
@@ -598,10 +603,12 @@ adpt_portdb_traversal_show_op_info(void)
     int32_ofp type = OFP_INTERFACE_TYPE_PHYSICAL;
 
     /* adpt_port_of_fea_info_t */
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ctc_cli_out_ofp(" -------------------- Port OP INFO DB ---------------------------------\n");
     ctc_cli_out_ofp(" %11s %5s %10s %10s %10s %10s %10s\n", "name", "gport", "carrier", "current", "advertised", "supported", "peer");
     ctc_cli_out_ofp(" ----------------------------------------------------------------------\n");
     ctc_hash_traverse(ADPT_PORT_GPORT_HASH, (hash_traversal_fn)adpt_portdb_show_op_info, &type);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
 
     return OFP_ERR_SUCCESS;
 }
@@ -632,10 +639,12 @@ int32_ofp
 adpt_portdb_traversal_show_status_info(void)
 {
     /* adpt_port_status_info_t */
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ctc_cli_out_ofp(" -------------------- Port STATUS INFO DB -------\n");
     ctc_cli_out_ofp(" %11s %5s\n", "name", "modified");
     ctc_cli_out_ofp(" ------------------------------------------------\n");
     ctc_hash_traverse(ADPT_PORT_GPORT_HASH, (hash_traversal_fn)adpt_portdb_show_status_info, NULL);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
 
     return OFP_ERR_SUCCESS;
 }
@@ -677,10 +686,12 @@ adpt_portdb_traversal_show_nh_info(void)
     int32_ofp type = OFP_INTERFACE_TYPE_PHYSICAL;
 
     /* ADPT_PORT_DATA_TYPE_NH_INFO */
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ctc_cli_out_ofp(" -------------------- Port NH INFO DB ---------------------------------\n");
     ctc_cli_out_ofp(" %11s %5s %15s %15s\n", "name", "gport", "non-edit-nhid", "dsnh-offset");
     ctc_cli_out_ofp(" ----------------------------------------------------------------------\n");
     ctc_hash_traverse(ADPT_PORT_GPORT_HASH, (hash_traversal_fn)adpt_portdb_show_nh_info, &type);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
 
     return OFP_ERR_SUCCESS;
 }
@@ -62,6 +62,27 @@
  *
  ****************************************************************************/
 
+/**
+ * Strip the cpu mac header and humber bridge header from a received packet. This
+ * does not touch the adapter database and may be called from any thread.
+ * @param packet        received packet
+ * @param src_gport     source gport of the packet
+ * @param nexthop_ptr   nexthop pointer in the bridge header, identifies the to_cpu flow
+ * @return OFP_ERR_SUCCESS, OFP_ERR_FAIL
+ */
+int32_ofp
+ofp_netdev_decap_packet(struct ofpbuf *packet, uint16_ofp *src_gport, uint32_ofp *nexthop_ptr);
+
+/**
+ * Resolve the packet_to_cpu information of a packet decapsulated by ofp_netdev_decap_packet
+ * @param src_gport             source gport of the packet
+ * @param nexthop_ptr           nexthop pointer in the bridge header
+ * @param packet_to_cpu_info    packet to cpu information, include in_port, reason
+ * @return OFP_ERR_SUCCESS, OFP_ERR_FAIL
+ */
+int32_ofp
+ofp_netdev_resolve_upcall(uint16_ofp src_gport, uint32_ofp nexthop_ptr, ofp_packet_to_cpu_info_t *packet_to_cpu_info);
+
 /**
  * Decapsulate packet with humber bridge header, and return the packet_to_cpu information
  * @param packet                received packet
@@ -77,7 +98,8 @@ ofp_netdev_decap_upcall(struct ofpbuf *packet, ofp_packet_to_cpu_info_t *packet_
  * @param key flow key
  * @param ofp_actions actions in packet_out messages
  * @param n_actions number of actions in packet_out messages
- * @param hardware_process_packet packet that will be forwarded by hardware, a bridge header will be encapsulated to the original packet
+ * @param hardware_process_packet packet that will be forwarded by hardware, a bridge header will be encapsulated to the original packet.
+ *        Passing packet itself hands packet over: the headers are pushed into its headroom, reserve OFP_CPU_ENCAP_HDR_LEN for that
  * @param priority packet priority for qos
  * @return OFP_CPU_PROCESS_DISCARD, OFP_CPU_PROCESS_ENABLE, OFP_CPU_PROCESS_DISABLE
  */
@@ -103,4 +125,29 @@ ofp_ofproto_construct(void);
 int32_ofp
 ofp_ofproto_destruct(void);
 
+struct ds;
+
+/**
+ * Dump the wait and hold times of the adapter lock domains
+ * @param ds dynamic string the report is appended to
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_lock_show(struct ds *ds);
+
+/**
+ * Clear the wait and hold times of the adapter lock domains
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_lock_clear_stats(void);
+
+/**
+ * Start or stop recording the wait and hold times of the adapter lock domains
+ * @param enable                record them
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_lock_set_profile(bool enable);
+
 #endif /* _OFP_API_H_ */
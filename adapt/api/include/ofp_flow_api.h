@@ -57,6 +57,15 @@ ofp_destroy_flow_actions(struct list *flow_actions);
 int32_ofp
 ofp_add_flow(struct rule_ctc* p_rule);
 
+/**
+ * Add openflow flows to adapter layer as one transaction
+ * @param  pp_rule      array of openflow rule structures
+ * @param  count        number of rules
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_add_flows(struct rule_ctc** pp_rule, uint32_ofp count);
+
 /**
  * Modify openflow flow action
  * @param  rule         openflow rule structure
@@ -20,9 +20,11 @@
 /******************************************************************************
 * Header Files 
 ******************************************************************************/
+#include "dynamic-string.h"
 #include "ofp_api.h"
 
 #include "adpt.h"
+#include "adpt_lock.h"
 #include "adpt_opf.h"
 #include "adpt_port.h"
 #include "adpt_flow_priv.h"
@@ -45,128 +47,21 @@ VLOG_DEFINE_THIS_MODULE(ofp_api);
  ****************************************************************************/
 
 /**
- * Send packet from CPU. 16(cpu mac header) + 32(bridge header) + payload
- * @param encap_info encapsulate information
- * @param buf packet buffer
- * @param buf_len packet buffer length
- * @param hardware_process_packet packet that will be forwarded by hardware, a bridge header will be encapsulated to the original packet
- * @return
- */
-static int32_ofp
-ofp_encap_packet(ofp_cpu_encap_info_t* encap_info, uint8_ofp* buf, uint16_ofp buf_len, struct ofpbuf *hardware_process_packet)
-{
-    ofp_cpu_packet_t packet;
-    uint32_ofp hash = 0;
-    uint8_ofp *p;
-    uint32_ofp hardware_process_packet_length = 0;
-
-    OFP_PTR_CHECK(encap_info);
-    OFP_PTR_CHECK(buf);
-    OFP_PTR_CHECK(hardware_process_packet);
-    OFP_LOG_DEBUG_FUNC();
-
-    memset(&packet, 0, sizeof(ofp_cpu_packet_t));
-
-    /* encapsulate cpu mac header, bridge header and payload */
-    /* 1 encapsulate cpu header, 16byte */
-    packet.cpu_mac_header.cpu_mac_sa[0] = 0xFF;
-    packet.cpu_mac_header.cpu_mac_sa[1] = 0xFF;
-    packet.cpu_mac_header.cpu_mac_sa[2] = 0xFF;
-    packet.cpu_mac_header.cpu_mac_sa[3] = 0xFF;
-    packet.cpu_mac_header.cpu_mac_sa[4] = 0xFF;
-    packet.cpu_mac_header.cpu_mac_sa[5] = 0x00;
-    packet.cpu_mac_header.cpu_mac_da[0] = 0xFE;
-    packet.cpu_mac_header.cpu_mac_da[1] = 0xFD;
-    packet.cpu_mac_header.cpu_mac_da[2] = 0x0;
-    packet.cpu_mac_header.cpu_mac_da[3] = 0x0;
-    packet.cpu_mac_header.cpu_mac_da[4] = 0x0;
-    packet.cpu_mac_header.cpu_mac_da[5] = 0x1;
-    packet.cpu_mac_header.cpu_hdr_type = 0x5A5A;
-
-    /* 2 encapsulate bridge header, 32byte */
-    if (encap_info->is_mcast)
-    {
-        packet.bridge_header.nxt_hop_ptr = 0;
-    }
-    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_BRIDGE)
-    {
-        packet.bridge_header.nxt_hop_ptr = BRIDGE_NEXTHOP_PTR;     /* can do vlan tag edit */
-    }
-    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_BYPASS)
-    {
-        packet.bridge_header.nxt_hop_ptr = BYPASS_NEXTHOP_PTR;     /* no edit, should input final packet */
-    }
-    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_UNTAG)
-    {
-        packet.bridge_header.nxt_hop_ptr = UNTAG_NEXTHOP_PTR;      /* can remove vlan tags */
-    }
-    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_OFFSET)
-    {
-        packet.bridge_header.nxt_hop_ptr = encap_info->nh_offset;  /* can do any edit which support */
-    }
-
-    packet.bridge_header.dest_id = encap_info->destid;             /* dest local port */
-    packet.bridge_header.dest_chip_id = encap_info->dest_chipid;   /* dest global chipId */
-    packet.bridge_header.src_port = encap_info->src_port;
-
-    /* head hash is used for linkagg */
-    hash = encap_info->hash;
-    packet.bridge_header.hd_hash_2_to_0 = hash & 0x7;
-    packet.bridge_header.hd_hash_7_to_3 = (hash >> 3) & 0x1F;
-
-    packet.bridge_header.hdr_type = 1;                             /* for humber, it should be 1 */
-    packet.bridge_header.multi_cast = encap_info->is_mcast;        /* 0:unicast, 1:multicast */
-    if(encap_info->src_vid)
-    {
-        packet.bridge_header.src_vid = encap_info->src_vid;        /* source svlanId*/
-        packet.bridge_header.src_svid_vld = 1;
-        packet.bridge_header.src_vlanptr_or_timestamp_79_64 = encap_info->src_vid;  /* vlan ptr */
-    }
-    packet.bridge_header.color = CTC_QOS_COLOR_GREEN;              /* highest priority */
-    packet.bridge_header.priority = encap_info->packet_priority;                         
-    packet.bridge_header.srcport_isolate_id = 0x3F;                /* disable port isolate */
-    packet.bridge_header.flowid_servecid_or_oamportid |= 0xFF << 16;  /* disable flow id */
-    packet.bridge_header.ttl_or_oam_defect = 20;                   /* TTL of packet */
-
-    packet.bridge_header.pkt_len = buf_len + 4;                    /* add CRC 4 bytes */
-
-    ctc_swap32((uint32_ofp*)&packet.bridge_header, sizeof(ofp_brghdr_info_t)/4, HOST_TO_NETWORK);
-
-    /* calc bridge header CRC */
-    p = (uint8_ofp*)(&packet.bridge_header);
-    p[OFP_CPU_BRGHDR_CRC_POS] = 0;
-    p[OFP_CPU_BRGHDR_CRC_POS] = _ctclib_crc8((uint8_ofp *)&packet.bridge_header, OFP_CPU_PKT_HDR_LEN, 0);
-
-    /*3 encapsulate payload */
-    kal_memcpy(packet.data, buf, buf_len);
-    packet.data_length = buf_len;
-
-    hardware_process_packet_length = packet.data_length + sizeof(ofp_cpu_mac_header_t) + sizeof(ofp_brghdr_info_t);
-
-    ofpbuf_init(hardware_process_packet, hardware_process_packet_length);
-    ofpbuf_put(hardware_process_packet, &packet, hardware_process_packet_length);
-
-    return OFP_ERR_SUCCESS;
-}
-
-
-/**
- * Decapsulate packet with humber bridge header, and return the packet_to_cpu information
- * @param packet                received packet
- * @param packet_to_cpu_info    packet to cpu information, include in_port, reason
+ * Strip the cpu mac header and humber bridge header from a received packet. This
+ * does not touch the adapter database and may be called from any thread.
+ * @param packet        received packet
+ * @param src_gport     source gport of the packet
+ * @param nexthop_ptr   nexthop pointer in the bridge header, identifies the to_cpu flow
  * @return OFP_ERR_SUCCESS, OFP_ERR_FAIL
  */
 int32_ofp
-ofp_netdev_decap_upcall(struct ofpbuf *packet, ofp_packet_to_cpu_info_t *packet_to_cpu_info)
+ofp_netdev_decap_packet(struct ofpbuf *packet, uint16_ofp *src_gport, uint32_ofp *nexthop_ptr)
 {
-    uint16_ofp ofport = 0;
     ofp_brghdr_info_t* p_brghdr_ptr = NULL;
-    uint32_ofp nexthop_ptr = 0;
-    adpt_flow_info_t* flow_info_p = NULL;
 
     OFP_PTR_CHECK(packet);
-    OFP_PTR_CHECK(packet_to_cpu_info);
-    OFP_LOG_DEBUG_FUNC();
+    OFP_PTR_CHECK(src_gport);
+    OFP_PTR_CHECK(nexthop_ptr);
 
     /* 1. sanity check*/
     if (packet->size < OFP_BRGHDR_LEN)
@@ -184,7 +79,8 @@ ofp_netdev_decap_upcall(struct ofpbuf *packet, ofp_packet_to_cpu_info_t *packet_
 
     ctc_swap32((uint32_ofp*)(p_brghdr_ptr), OFP_HUMBER_HDR_LEN / 4, HOST_TO_NETWORK);
 
-    nexthop_ptr = p_brghdr_ptr->nexthop_ptr_19_18 << 18 | p_brghdr_ptr->nxt_hop_ptr;
+    *nexthop_ptr = p_brghdr_ptr->nexthop_ptr_19_18 << 18 | p_brghdr_ptr->nxt_hop_ptr;
+    *src_gport = p_brghdr_ptr->src_port;
 
     OFP_DEBUG_PRINT("decap humber hdr, len=%d, src_port=%d, nhptr=0x%x, src_vid=%d\n",
                     p_brghdr_ptr->pkt_len,
@@ -192,14 +88,33 @@ ofp_netdev_decap_upcall(struct ofpbuf *packet, ofp_packet_to_cpu_info_t *packet_
                     p_brghdr_ptr->nxt_hop_ptr,
                     p_brghdr_ptr->src_vid);
 
-    /* 4. Get port number from database */
-    if (adpt_port_get_ofport_by_gport(p_brghdr_ptr->src_port, &ofport))
+    /* 4. strip humber header */
+    ofpbuf_pull(packet, OFP_HUMBER_HDR_LEN);
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Resolve the packet_to_cpu information, the flow and port locks must be held for read
+ * @param src_gport             source gport of the packet
+ * @param nexthop_ptr           nexthop pointer in the bridge header
+ * @param packet_to_cpu_info    packet to cpu information, include in_port, reason
+ * @return OFP_ERR_SUCCESS, OFP_ERR_FAIL
+ */
+static int32_ofp
+ofp_netdev_resolve_upcall__(uint16_ofp src_gport, uint32_ofp nexthop_ptr, ofp_packet_to_cpu_info_t *packet_to_cpu_info)
+{
+    uint16_ofp ofport = 0;
+    adpt_flow_info_t* flow_info_p = NULL;
+
+    /* 1. Get port number from database */
+    if (adpt_port_get_ofport_by_gport(src_gport, &ofport))
     {
-        OFP_LOG_DEBUG("Discard upcall packet due to invalid src-port %d\n", p_brghdr_ptr->src_port);
+        OFP_LOG_DEBUG("Discard upcall packet due to invalid src-port %d\n", src_gport);
         return OFP_ERR_FAIL;
     }
 
-    /* 5. parse packet_to_cpu info */
+    /* 2. parse packet_to_cpu info */
     packet_to_cpu_info->in_port = ofport;
     packet_to_cpu_info->flow_id = nexthop_ptr;
     packet_to_cpu_info->packet_in_reason = PACKET_TO_CPU_REASON_MAX;;
@@ -231,24 +146,58 @@ ofp_netdev_decap_upcall(struct ofpbuf *packet, ofp_packet_to_cpu_info_t *packet_
         }
     }
 
-    /* 6. strip humber header */
-    ofpbuf_pull(packet, OFP_HUMBER_HDR_LEN);
-
     return OFP_ERR_SUCCESS;
 }
 
 /**
- *  Handling of packet-out messages for output, hardware forwarding of packets in packet-out messages if we support
- * @param packet input packet buffer
- * @param key flow key
- * @param ofp_actions actions in packet_out messages
- * @param n_actions number of actions in packet_out messages
- * @param hardware_process_packet packet that will be forwarded by hardware, a bridge header will be encapsulated to the original packet
- * @param priority packet priority for qos
- * @return OFP_CPU_PROCESS_DISCARD, OFP_CPU_PROCESS_ENABLE, OFP_CPU_PROCESS_DISABLE
+ * Resolve the packet_to_cpu information of a packet decapsulated by ofp_netdev_decap_packet
+ * @param src_gport             source gport of the packet
+ * @param nexthop_ptr           nexthop pointer in the bridge header
+ * @param packet_to_cpu_info    packet to cpu information, include in_port, reason
+ * @return OFP_ERR_SUCCESS, OFP_ERR_FAIL
  */
 int32_ofp
-ofp_send_packet_out(struct ofpbuf *packet, struct flow *key, const union ofp_action *ofp_actions, int32_ofp n_actions, 
+ofp_netdev_resolve_upcall(uint16_ofp src_gport, uint32_ofp nexthop_ptr, ofp_packet_to_cpu_info_t *packet_to_cpu_info)
+{
+    uint32_ofp locks = ADPT_LOCK_RD(ADPT_LOCK_FLOW) | ADPT_LOCK_RD(ADPT_LOCK_PORT);
+    int32_ofp ret;
+
+    OFP_PTR_CHECK(packet_to_cpu_info);
+
+    adpt_lock(locks);
+    ret = ofp_netdev_resolve_upcall__(src_gport, nexthop_ptr, packet_to_cpu_info);
+    adpt_unlock(locks);
+
+    return ret;
+}
+
+/**
+ * Decapsulate packet with humber bridge header, and return the packet_to_cpu information
+ * @param packet                received packet
+ * @param packet_to_cpu_info    packet to cpu information, include in_port, reason
+ * @return OFP_ERR_SUCCESS, OFP_ERR_FAIL
+ */
+int32_ofp
+ofp_netdev_decap_upcall(struct ofpbuf *packet, ofp_packet_to_cpu_info_t *packet_to_cpu_info)
+{
+    uint16_ofp src_gport = 0;
+    uint32_ofp nexthop_ptr = 0;
+
+    OFP_PTR_CHECK(packet);
+    OFP_PTR_CHECK(packet_to_cpu_info);
+    OFP_LOG_DEBUG_FUNC();
+
+    OFP_ERROR_RETURN(ofp_netdev_decap_packet(packet, &src_gport, &nexthop_ptr));
+
+    return ofp_netdev_resolve_upcall(src_gport, nexthop_ptr, packet_to_cpu_info);
+}
+
+/**
+ * Handling of packet-out messages for output, the port lock must be held for read
+ * @return OFP_CPU_PROCESS_DISCARD, OFP_CPU_PROCESS_ENABLE, OFP_CPU_PROCESS_DISABLE
+ */
+static int32_ofp
+ofp_send_packet_out__(struct ofpbuf *packet, struct flow *key, const union ofp_action *ofp_actions, int32_ofp n_actions, 
                                 struct ofpbuf *hardware_process_packet, uint32_ofp priority)
 {
     uint8_ofp lport=0, gchip=0;
@@ -260,12 +209,6 @@ ofp_send_packet_out(struct ofpbuf *packet, struct flow *key, const union ofp_act
     int32_ofp ret;
     uint16_ofp in_port = 0;
 
-    OFP_PTR_CHECK(packet);
-    OFP_PTR_CHECK(key);
-    OFP_PTR_CHECK(ofp_actions);
-    OFP_PTR_CHECK(hardware_process_packet);
-    OFP_LOG_DEBUG_FUNC();
-
     in_port = key->in_port;
 
     /* Check if we support the actions, if support hardware forwarding will be performed, otherwise software forwarding will be performed */
@@ -302,7 +245,7 @@ ofp_send_packet_out(struct ofpbuf *packet, struct flow *key, const union ofp_act
         cpu_encap_info.src_vid     = OFP_DEFAULT_VLAN_ID;
         cpu_encap_info.src_port    = src_gport;
         cpu_encap_info.packet_priority = priority;
-        ofp_encap_packet(&cpu_encap_info, packet->data, packet->size, hardware_process_packet);
+        ofp_encap_packet(&cpu_encap_info, packet, hardware_process_packet);
         return OFP_CPU_PROCESS_DISABLE;
         break;
 
@@ -341,7 +284,7 @@ ofp_send_packet_out(struct ofpbuf *packet, struct flow *key, const union ofp_act
         cpu_encap_info.is_mcast  = 0;
         cpu_encap_info.hash = 5; /* used to calculate header hash in linkagg */
         cpu_encap_info.packet_priority = priority;
-        ofp_encap_packet(&cpu_encap_info, packet->data, packet->size, hardware_process_packet);
+        ofp_encap_packet(&cpu_encap_info, packet, hardware_process_packet);
         return OFP_CPU_PROCESS_DISABLE;
         break;
     }
@@ -349,6 +292,36 @@ ofp_send_packet_out(struct ofpbuf *packet, struct flow *key, const union ofp_act
     return OFP_CPU_PROCESS_ENABLE;
 }
 
+/**
+ *  Handling of packet-out messages for output, hardware forwarding of packets in packet-out messages if we support
+ * @param packet input packet buffer
+ * @param key flow key
+ * @param ofp_actions actions in packet_out messages
+ * @param n_actions number of actions in packet_out messages
+ * @param hardware_process_packet packet that will be forwarded by hardware, a bridge header will be encapsulated to the original packet.
+ *        Passing packet itself hands packet over: the headers are pushed into its headroom, reserve OFP_CPU_ENCAP_HDR_LEN for that
+ * @param priority packet priority for qos
+ * @return OFP_CPU_PROCESS_DISCARD, OFP_CPU_PROCESS_ENABLE, OFP_CPU_PROCESS_DISABLE
+ */
+int32_ofp
+ofp_send_packet_out(struct ofpbuf *packet, struct flow *key, const union ofp_action *ofp_actions, int32_ofp n_actions, 
+                                struct ofpbuf *hardware_process_packet, uint32_ofp priority)
+{
+    int32_ofp ret;
+
+    OFP_PTR_CHECK(packet);
+    OFP_PTR_CHECK(key);
+    OFP_PTR_CHECK(ofp_actions);
+    OFP_PTR_CHECK(hardware_process_packet);
+    OFP_LOG_DEBUG_FUNC();
+
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = ofp_send_packet_out__(packet, key, ofp_actions, n_actions, hardware_process_packet, priority);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+
+    return ret;
+}
+
 /**
  * Handling of packet-out messages for group, hardware forwarding of packets in packet-out messages if we support.
  * mismatched group will be ignored silently.
@@ -384,3 +357,103 @@ ofp_ofproto_destruct(void)
 
     return OFP_ERR_SUCCESS;
 }
+
+/**
+ * Get a percentile of a lock histogram
+ * @param hist histogram, bucket i counts [2^(i-1), 2^i) us
+ * @param permille percentile in 1/1000
+ * @return upper bound of the bucket holding the percentile in us
+ */
+static uint32_ofp
+ofp_lock_hist_percentile(const uint32_ofp* hist, uint32_ofp permille)
+{
+    uint64_ofp total = 0, sum = 0;
+    uint32_ofp i;
+
+    for (i = 0; i < ADPT_LOCK_HIST_NUM; i++)
+    {
+        total += hist[i];
+    }
+    for (i = 0; i < ADPT_LOCK_HIST_NUM; i++)
+    {
+        sum += hist[i];
+        if (sum * 1000 >= total * permille)
+        {
+            break;
+        }
+    }
+
+    return i < ADPT_LOCK_HIST_NUM ? (1U << i) : (1U << (ADPT_LOCK_HIST_NUM - 1));
+}
+
+/**
+ * Dump the wait and hold times of the adapter lock domains
+ * @param ds dynamic string the report is appended to
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_lock_show(struct ds *ds)
+{
+    adpt_lock_stats_t stats[2];
+    adpt_lock_stats_t* p_stats;
+    uint32_ofp lock, is_wr;
+
+    OFP_PTR_CHECK(ds);
+
+    ds_put_format(ds, "%-7s %-4s %10s %10s %9s %9s %9s %9s %9s %9s\n",
+                  "lock", "mode", "count", "contended", "wait avg", "wait p99", "wait max",
+                  "hold avg", "hold p99", "hold max");
+    for (lock = 0; lock < ADPT_LOCK_MAX; lock++)
+    {
+        OFP_ERROR_RETURN(adpt_lock_get_stats(lock, &stats[0], &stats[1]));
+        for (is_wr = 0; is_wr < 2; is_wr++)
+        {
+            p_stats = &stats[is_wr];
+            if (0 == p_stats->count)
+            {
+                continue;
+            }
+            ds_put_format(ds, "%-7s %-4s %10llu %10llu %9.1f %9u %9.1f %9.1f %9u %9.1f\n",
+                          adpt_lock_name(lock), is_wr ? "wr" : "rd",
+                          p_stats->count, p_stats->contended,
+                          p_stats->wait_nsec / 1000.0 / p_stats->count,
+                          ofp_lock_hist_percentile(p_stats->wait_hist, 990),
+                          p_stats->wait_max_nsec / 1000.0,
+                          p_stats->hold_nsec / 1000.0 / p_stats->count,
+                          ofp_lock_hist_percentile(p_stats->hold_hist, 990),
+                          p_stats->hold_max_nsec / 1000.0);
+        }
+    }
+    ds_put_cstr(ds, "times in us, p99 is the upper bound of its histogram bucket\n");
+    if (!adpt_lock_get_profile())
+    {
+        ds_put_cstr(ds, "profiling is off, nothing is recorded\n");
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Clear the wait and hold times of the adapter lock domains
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_lock_clear_stats(void)
+{
+    OFP_ERROR_RETURN(adpt_lock_clear_stats());
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Start or stop recording the wait and hold times of the adapter lock domains
+ * @param enable                record them
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_lock_set_profile(bool enable)
+{
+    adpt_lock_set_profile(enable);
+
+    return OFP_ERR_SUCCESS;
+}
@@ -25,6 +25,7 @@
 #include "ofp_api.h"
 #include "ofp_lib.h"
 
+#include "adpt_lock.h"
 #include "adpt_flow.h"
 #include "adpt_flow_priv.h"
 #include "adpt_port.h"
@@ -109,10 +110,38 @@ ofp_destroy_flow_actions(struct list *flow_actions)
 int32_ofp
 ofp_add_flow(struct rule_ctc* p_rule)
 {
+    int32_ofp ret;
+
     OFP_PTR_CHECK(p_rule);
     OFP_LOG_DEBUG_FUNC();
     
-    OFP_ERROR_RETURN(adpt_flow_add_flow(p_rule));
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    ret = adpt_flow_add_flow(p_rule);
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    OFP_ERROR_RETURN(ret);
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Add openflow flows to adapter layer as one transaction, either all flows
+ * are added or none
+ * @param  pp_rule              Array of pointers of struct rule_ctc
+ * @param  count                Number of rules
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_add_flows(struct rule_ctc** pp_rule, uint32_ofp count)
+{
+    int32_ofp ret;
+
+    OFP_PTR_CHECK(pp_rule);
+    OFP_LOG_DEBUG_FUNC();
+    
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    ret = adpt_flow_add_flows(pp_rule, count);
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -125,10 +154,15 @@ ofp_add_flow(struct rule_ctc* p_rule)
 int32_ofp
 ofp_modify_flow_action(struct rule_ctc* p_rule)
 {
+    int32_ofp ret;
+
     OFP_PTR_CHECK(p_rule);
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_flow_modify_flow_action(p_rule));
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    ret = adpt_flow_modify_flow_action(p_rule);
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -141,10 +175,15 @@ ofp_modify_flow_action(struct rule_ctc* p_rule)
 int32_ofp
 ofp_del_flow(struct rule_ctc *p_rule)
 {
+    int32_ofp ret;
+
     OFP_PTR_CHECK(p_rule);
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_flow_del_flow(p_rule));
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    ret = adpt_flow_del_flow(p_rule);
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -176,6 +215,7 @@ int32_ofp
 ofp_get_flow_missmatch_stats(ofp_stats_t* p_stats)
 {
     ofp_stats_t stats;
+    int32_ofp ret;
 
     OFP_PTR_CHECK(p_stats);
     OFP_LOG_DEBUG_FUNC();
@@ -196,7 +236,10 @@ ofp_get_flow_missmatch_stats(ofp_stats_t* p_stats)
     
     /* 3. route default entry */
     memset(&stats, 0 , sizeof(ofp_stats_t));
-    OFP_ERROR_RETURN(adpt_tunnel_get_gre_packets_miss_match_stats(&stats));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
+    ret = adpt_tunnel_get_gre_packets_miss_match_stats(&stats);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_TUNNEL));
+    OFP_ERROR_RETURN(ret);
     p_stats->packet_count += stats.packet_count;
     p_stats->byte_count   += stats.byte_count;
     return OFP_ERR_SUCCESS;
@@ -210,10 +253,15 @@ ofp_get_flow_missmatch_stats(ofp_stats_t* p_stats)
 int32_ofp
 ofp_get_flow_old_stats(ofp_stats_t* p_stats)
 {
+    int32_ofp ret;
+
     OFP_PTR_CHECK(p_stats);
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_flow_get_removed_flow_stats(p_stats));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
+    ret = adpt_flow_get_removed_flow_stats(p_stats);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -225,10 +273,18 @@ ofp_get_flow_old_stats(ofp_stats_t* p_stats)
 int32_ofp
 ofp_clear_all_flows_stats(void)
 {
+    int32_ofp ret;
+
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_flow_clear_all_flow_stats());
-    OFP_ERROR_RETURN(adpt_tunnel_clear_gre_packets_miss_match_stats());
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    ret = adpt_flow_clear_all_flow_stats();
+    if (OFP_ERR_SUCCESS == ret)
+    {
+        ret = adpt_tunnel_clear_gre_packets_miss_match_stats();
+    }
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    OFP_ERROR_RETURN(ret);
     
     return OFP_ERR_SUCCESS;
 }
@@ -243,12 +299,16 @@ int32_ofp
 ofp_get_flow_last_matched_time(struct rule_ctc* p_rule, int64_ofp* p_last_match)
 {
     int64_ofp last_match = 0;
+    int32_ofp ret;
 
     OFP_PTR_CHECK(p_rule);
     OFP_PTR_CHECK(p_last_match);
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_flow_get_last_matched(p_rule, &last_match));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
+    ret = adpt_flow_get_last_matched(p_rule, &last_match);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_FLOW));
+    OFP_ERROR_RETURN(ret);
     *p_last_match = last_match;
     
     return OFP_ERR_SUCCESS;
@@ -35,7 +35,6 @@ ctc_master_cli(void);
 pthread_t ctc_master_cli_thread;
 #else
 pthread_t ctc_master_sdk_thread;
-sal_mutex_t *pg_mutex;
 #endif
 
 extern int
@@ -79,6 +78,8 @@ main(int argc, char *argv[])
     /* init lcm_main, drivers, and install CLIs */
     OFP_ERROR_RETURN(lcm_master());
 
+    /* pg_mutex only serializes the commands of the CLI library, the adapter
+     * state is guarded by the lock domains of adpt_lock.h */
     sal_mutex_create(&pg_mutex);
 
     /* start cli thread */
@@ -89,8 +90,6 @@ main(int argc, char *argv[])
 
     /* start sdk thread */
     pthread_create(&ctc_master_sdk_thread, NULL, ctc_master_sdk_loop, NULL);
-
-    sal_mutex_create(&pg_mutex);
 #endif
 
     /* register netdev/ofproto centec implementation */
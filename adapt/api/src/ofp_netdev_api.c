@@ -19,6 +19,7 @@
 
 #include "ofp_api.h"
 #include "ofp_netdev_api.h"
+#include "adpt_lock.h"
 #include "adpt_port.h"
 #include "adpt_message.h"
 
@@ -26,6 +27,33 @@
 
 VLOG_DEFINE_THIS_MODULE(ofp_netdev_api);
 
+/**
+ * Get gport of a physical port
+ * @param[in]  ifname           interface name
+ * @param[out] p_gport          gport
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+ofp_netdev_get_phy_gport(const char * ifname, uint16_ofp* p_gport)
+{
+    ofp_interface_type_t if_type;
+    int32_ofp ret;
+
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_port_type_by_name(ifname, &if_type);
+    if (OFP_ERR_SUCCESS == ret && if_type != OFP_INTERFACE_TYPE_PHYSICAL)
+    {
+        ret = OFP_ERR_INVALID_PARAM;
+    }
+    if (OFP_ERR_SUCCESS == ret)
+    {
+        ret = adpt_port_get_gport_by_name(ifname, p_gport);
+    }
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+
+    return ret;
+}
+
 /**
  * Get netdev statistics
  * @param ifname                interface name
@@ -36,20 +64,12 @@ int32_ofp
 ofp_netdev_get_port_stats(const char * ifname, ofp_if_stats_t* p_if_stats)
 {
     uint16_ofp gport;
-    ofp_interface_type_t if_type;
 
     OFP_PTR_CHECK(ifname);
     OFP_LOG_DEBUG_FUNC();
     OFP_LOG_DEBUG("ifname = %s\n", ifname);
 
-    OFP_ERROR_RETURN(adpt_port_get_port_type_by_name(ifname, &if_type));
-
-    if (if_type != OFP_INTERFACE_TYPE_PHYSICAL)
-    {
-        return OFP_ERR_INVALID_PARAM;
-    }
-
-    OFP_ERROR_RETURN(adpt_port_get_gport_by_name(ifname, &gport));
+    OFP_ERROR_RETURN(ofp_netdev_get_phy_gport(ifname, &gport));
 
     OFP_ERROR_RETURN(hal_port_get_mac_stats(gport, p_if_stats));
 
@@ -66,21 +86,13 @@ int32_ofp
 ofp_netdev_reset_port_stats(const char * ifname)
 {
     uint16_ofp gport;
-    ofp_interface_type_t if_type;
 
     OFP_PTR_CHECK(ifname);
     
     OFP_LOG_DEBUG_FUNC();
     OFP_LOG_DEBUG("ifname = %s\n", ifname);
 
-    OFP_ERROR_RETURN(adpt_port_get_port_type_by_name(ifname, &if_type));
-    
-    if (if_type != OFP_INTERFACE_TYPE_PHYSICAL)
-    {
-        return OFP_ERR_INVALID_PARAM;
-    }
-
-    OFP_ERROR_RETURN(adpt_port_get_gport_by_name(ifname, &gport));
+    OFP_ERROR_RETURN(ofp_netdev_get_phy_gport(ifname, &gport));
     
     OFP_ERROR_RETURN(hal_port_reset_mac_stats(gport));
     
@@ -96,6 +108,8 @@ ofp_netdev_reset_port_stats(const char * ifname)
 int32_ofp
 ofp_netdev_set_port_advertised(const char * ifname, uint32_ofp advertised)
 {
+    int32_ofp ret;
+
     OFP_PTR_CHECK(ifname);
 
     OFP_LOG_DEBUG_FUNC();
@@ -107,7 +121,10 @@ ofp_netdev_set_port_advertised(const char * ifname, uint32_ofp advertised)
         /**TODO to be handled */
         return OFP_ERR_SUCCESS;
     }
-    OFP_ERROR_RETURN(adpt_port_set_of_fea_advertised(ifname, advertised));
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_PORT)));
+    ret = adpt_port_set_of_fea_advertised(ifname, advertised);
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -116,19 +133,11 @@ int32_ofp
 ofp_netdev_get_port_speed(const char * ifname, uint32_ofp *speed)
 {
     uint16_ofp gport;
-    ofp_interface_type_t if_type;
     OFP_PTR_CHECK(ifname);
     OFP_LOG_DEBUG_FUNC();
     OFP_LOG_DEBUG("ifname = %s\n", ifname);
 
-    OFP_ERROR_RETURN(adpt_port_get_port_type_by_name(ifname, &if_type));
-
-    if (if_type != OFP_INTERFACE_TYPE_PHYSICAL)
-    {
-        return OFP_ERR_INVALID_PARAM;
-    }
-
-    OFP_ERROR_RETURN(adpt_port_get_gport_by_name(ifname, &gport));
+    OFP_ERROR_RETURN(ofp_netdev_get_phy_gport(ifname, &gport));
 
     OFP_ERROR_RETURN(hal_port_get_autonego_speed(gport, speed));
 
@@ -149,6 +158,7 @@ ofp_netdev_get_port_features(const char * ifname, uint32_ofp *p_current,
     uint32_ofp *p_advertised, uint32_ofp *p_supported, uint32_ofp *p_peer)
 {
     adpt_port_of_fea_info_t fea_info;
+    int32_ofp ret;
 
     OFP_PTR_CHECK(ifname);
     OFP_PTR_CHECK(p_current);
@@ -166,7 +176,10 @@ ofp_netdev_get_port_features(const char * ifname, uint32_ofp *p_current,
         return OFP_ERR_SUCCESS;
     }
 
-    OFP_ERROR_RETURN(adpt_port_get_of_fea_info(ifname, &fea_info));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_of_fea_info(ifname, &fea_info);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     *p_current    = fea_info.current;
     *p_advertised = fea_info.advertised;
     *p_supported  = fea_info.supported;
@@ -185,6 +198,7 @@ int32_ofp
 ofp_netdev_get_port_supported(const char * ifname, uint32_ofp* p_supported)
 {
     adpt_port_of_fea_info_t fea_info;
+    int32_ofp ret;
 
     OFP_PTR_CHECK(ifname);
     OFP_PTR_CHECK(p_supported);
@@ -199,7 +213,10 @@ ofp_netdev_get_port_supported(const char * ifname, uint32_ofp* p_supported)
         return OFP_ERR_SUCCESS;
     }
 
-    OFP_ERROR_RETURN(adpt_port_get_of_fea_info(ifname, &fea_info));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_of_fea_info(ifname, &fea_info);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     *p_supported  = fea_info.supported;
 
     return OFP_ERR_SUCCESS;
@@ -216,6 +233,8 @@ int32_ofp
 ofp_netdev_get_port_carrier(const char * ifname, uint8_ofp* p_carrier)
 {
     adpt_port_of_fea_info_t fea_info;
+    int32_ofp ret;
+
     OFP_PTR_CHECK(ifname);
 
     OFP_LOG_DEBUG_FUNC();
@@ -229,7 +248,10 @@ ofp_netdev_get_port_carrier(const char * ifname, uint8_ofp* p_carrier)
         return OFP_ERR_SUCCESS;
     }
 
-    OFP_ERROR_RETURN(adpt_port_get_of_fea_info(ifname, &fea_info));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_of_fea_info(ifname, &fea_info);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     *p_carrier  = fea_info.carrier;
 
     return OFP_ERR_SUCCESS;
@@ -243,10 +265,14 @@ ofp_netdev_get_port_carrier(const char * ifname, uint8_ofp* p_carrier)
 int32_ofp
 ofp_netdev_set_port_modified(const char * ifname)
 {
+    int32_ofp ret;
 
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_port_set_port_modified(ifname, true));
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_PORT)));
+    ret = adpt_port_set_port_modified(ifname, true);
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -261,13 +287,17 @@ int32_ofp
 ofp_netdev_get_port_modified(const char * ifname, bool* p_is_modified)
 {
     adpt_port_status_info_t p_status_info;
+    int32_ofp ret;
 
     OFP_PTR_CHECK(p_is_modified);
     memset(&p_status_info, 0, sizeof(adpt_port_status_info_t));
 
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_port_get_port_status(ifname, &p_status_info));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_port_status(ifname, &p_status_info);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     *p_is_modified = p_status_info.modified;
 
     return OFP_ERR_SUCCESS;
@@ -281,9 +311,14 @@ ofp_netdev_get_port_modified(const char * ifname, bool* p_is_modified)
 int32_ofp
 ofp_netdev_clear_port_modified(const char * ifname)
 {
+    int32_ofp ret;
+
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_port_set_port_modified(ifname, false));
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_PORT)));
+    ret = adpt_port_set_port_modified(ifname, false);
+    adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -296,9 +331,14 @@ ofp_netdev_clear_port_modified(const char * ifname)
 int32_ofp
 ofp_netdev_get_any_port_modified(char** ifname)
 {
+    int32_ofp ret;
+
     OFP_LOG_DEBUG_FUNC();
 
-    OFP_ERROR_RETURN(adpt_port_get_any_port_modified(ifname));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_any_port_modified(ifname);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
@@ -512,6 +552,7 @@ ofp_netdev_enable_interface(const char * ifname)
     uint16_ofp gport;
     uint16_ofp ofport;
     int flag = 0;
+    int32_ofp ret;
 #ifdef _OFP_UML_
     adpt_notify_link_status_req_t req;
     uint32_ofp port_no;
@@ -531,7 +572,10 @@ ofp_netdev_enable_interface(const char * ifname)
 
     /* 2. Set device enable in kernel */
     OFP_ERROR_RETURN(ofp_netdev_enable_device(ifname));
-    OFP_ERROR_RETURN(adpt_port_get_gport_by_name(ifname, &gport));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_gport_by_name(ifname, &gport);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
 
     /* 3. Set PHY enable */
 #ifndef _OFP_UML_
@@ -555,7 +599,10 @@ ofp_netdev_enable_interface(const char * ifname)
     OFP_ERROR_RETURN(ofp_netdev_set_port_modified(ifname));
 
     /* 5. log */
-    OFP_ERROR_RETURN(adpt_port_get_ofport_by_name(ifname, &ofport));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_ofport_by_name(ifname, &ofport);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     OFP_LOG_INFO("port: %u (interface: %s) state change to up", ofport, ifname);
     
     return OFP_ERR_SUCCESS;
@@ -573,6 +620,7 @@ ofp_netdev_disable_interface(const char * ifname)
     uint16_ofp gport;
     uint16_ofp ofport;
     int flag;
+    int32_ofp ret;
 #ifdef _OFP_UML_
     adpt_notify_link_status_req_t req;
     uint32_ofp port_no;
@@ -592,7 +640,10 @@ ofp_netdev_disable_interface(const char * ifname)
 
     /* 2. Set device disable in kernel */
     OFP_ERROR_RETURN(ofp_netdev_disable_device(ifname));
-    OFP_ERROR_RETURN(adpt_port_get_gport_by_name(ifname, &gport));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_gport_by_name(ifname, &gport);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     
     /* 3. Set PHY disable */
 #ifndef _OFP_UML_
@@ -617,7 +668,10 @@ ofp_netdev_disable_interface(const char * ifname)
     OFP_ERROR_RETURN(ofp_netdev_set_port_modified(ifname));
 
     /* 5. log */
-    OFP_ERROR_RETURN(adpt_port_get_ofport_by_name(ifname, &ofport));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_ofport_by_name(ifname, &ofport);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     OFP_LOG_INFO("port: %u (interface: %s) state change to down", ofport, ifname);
     
     return OFP_ERR_SUCCESS;
@@ -740,7 +794,9 @@ ofp_netdev_ofport_is_gre_port(uint16_ofp ofport, bool check_exist)
         return true;
     }
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ret = adpt_port_get_port_type_by_ofport(ofport, &type);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     if (ret || type != OFP_INTERFACE_TYPE_GRE)
     {
         return false;
@@ -772,7 +828,9 @@ ofp_netdev_ofport_is_phy_port(uint16_ofp ofport, bool check_exist)
         return true;
     }
 
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     ret = adpt_port_get_port_type_by_ofport(ofport, &type);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
     if (ret || type != OFP_INTERFACE_TYPE_PHYSICAL)
     {
         return false;
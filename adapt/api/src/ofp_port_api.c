@@ -26,6 +26,7 @@
 #include "ofp_api.h"
 #include "ofp_port_api.h"
 
+#include "adpt_lock.h"
 #include "adpt_port.h"
 #include "adpt_gre_tunnel.h"
 #include "hal_port.h"
@@ -59,11 +60,15 @@ int32_ofp
 ofp_port_set_config(uint16_ofp ofport, uint32_ofp port_config)
 {
     uint16 gport = 0;
+    int32_ofp ret;
 
     OFP_LOG_DEBUG_FUNC();
     OFP_LOG_DEBUG("ofport= %d, port_config = %d", ofport, port_config);
 
-    OFP_ERROR_RETURN(adpt_port_get_gport_by_ofport(ofport, &gport));
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_gport_by_ofport(ofport, &gport);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
     OFP_ERROR_RETURN(hal_port_set_config(gport, port_config));
     
     return OFP_ERR_SUCCESS;
@@ -143,12 +148,12 @@ ofp_port_tunnel_log_error(int32_ofp error, ofp_port_info_t* p_port_info, ofp_tun
 }
 
 /**
- * Add port to openflow instance
+ * Add port to openflow instance, the port update locks must be held
  * @param p_port_info           Pointer of port information
  * @return OFP_ERR_XXX
  */
-int32_ofp
-ofp_port_add(ofp_port_info_t* p_port_info)
+static int32_ofp
+ofp_port_add__(ofp_port_info_t* p_port_info)
 {
     uint16_ofp gport = OFP_INVALID_GPORT;
     
@@ -190,12 +195,29 @@ ofp_port_add(ofp_port_info_t* p_port_info)
 }
 
 /**
- * Delete port from openflow instance
- * @param ofport                ofport
+ * Add port to openflow instance
+ * @param p_port_info           Pointer of port information
  * @return OFP_ERR_XXX
  */
 int32_ofp
-ofp_port_del(uint16_ofp ofport)
+ofp_port_add(ofp_port_info_t* p_port_info)
+{
+    int32_ofp ret;
+
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_PORT_UPDATE));
+    ret = ofp_port_add__(p_port_info);
+    adpt_unlock(ADPT_LOCK_PORT_UPDATE);
+
+    return ret;
+}
+
+/**
+ * Delete port from openflow instance, the port update locks must be held
+ * @param ofport                ofport
+ * @return OFP_ERR_XXX
+ */
+static int32_ofp
+ofp_port_del__(uint16_ofp ofport)
 {
     ofp_interface_type_t if_type;
     int32_ofp ret;
@@ -226,6 +248,23 @@ ofp_port_del(uint16_ofp ofport)
     return OFP_ERR_SUCCESS;
 }
 
+/**
+ * Delete port from openflow instance
+ * @param ofport                ofport
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_port_del(uint16_ofp ofport)
+{
+    int32_ofp ret;
+
+    OFP_ERROR_RETURN(adpt_lock(ADPT_LOCK_PORT_UPDATE));
+    ret = ofp_port_del__(ofport);
+    adpt_unlock(ADPT_LOCK_PORT_UPDATE);
+
+    return ret;
+}
+
 /**
  * Get ofport by ifname
  * @param[in]  ifname                   port name
@@ -235,7 +274,12 @@ ofp_port_del(uint16_ofp ofport)
 int32_ofp
 ofp_port_get_ofport_by_name(const char* ifname, uint16_ofp* p_ofport)
 {
-    OFP_ERROR_RETURN(adpt_port_get_ofport_by_name(ifname, p_ofport));
+    int32_ofp ret;
+
+    adpt_lock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    ret = adpt_port_get_ofport_by_name(ifname, p_ofport);
+    adpt_unlock(ADPT_LOCK_RD(ADPT_LOCK_PORT));
+    OFP_ERROR_RETURN(ret);
 
     return OFP_ERR_SUCCESS;
 }
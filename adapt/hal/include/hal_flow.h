@@ -158,4 +158,25 @@ hal_flow_add_service_entry(ctc_aclqos_entry_oper_t* p_entry_oper);
 int32_ofp 
 hal_flow_remove_service_entry(ctc_aclqos_entry_oper_t* p_entry_oper);
 
+/**
+* Open free tcam entries for a batch of qos/service entries before adding them
+* @param[in]  key_type                  key type of the batch
+* @param[in]  p_entry_id                entry ids in adding order
+* @param[in]  p_after_entry_id          after entry ids in adding order
+* @param[in]  count                     number of entries
+* @return OFP_ERR_XX
+*/
+int32_ofp
+hal_flow_reserve_entry(ctc_aclqos_key_type_t key_type, const uint32_ofp* p_entry_id,
+                       const uint32_ofp* p_after_entry_id, uint32_ofp count);
+
+/**
+* Move some qos/service entries to reopen free tcam entries between crowded entries
+* @param[in]  max_moves                 most tcam entries to move
+* @param[out] p_moves                   tcam entries moved
+* @return OFP_ERR_XX
+*/
+int32_ofp
+hal_flow_defrag_tcam(uint32_ofp max_moves, uint32_ofp* p_moves);
+
 #endif
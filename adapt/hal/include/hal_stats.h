@@ -67,6 +67,16 @@ hal_stats_delete_stats_ptr(uint16_ofp stats_ptr);
 int32_ofp
 hal_stats_get_stats(uint16_ofp stats_ptr, ofp_stats_t* p_stats);
 
+/**
+ * Get stats of a batch of stats ptrs in one pass
+ * @param[in]  p_stats_ptr              Stats ptrs, sorted in ascending order
+ * @param[in]  count                    Number of stats ptrs
+ * @param[out] p_stats                  Statistics of each stats ptr
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+hal_stats_get_stats_bulk(const uint16_ofp* p_stats_ptr, uint32_ofp count, ofp_stats_t* p_stats);
+
 /**
  * Clear stats by stats ptr
  * @param[in]  stats_ptr                Stats ptr
@@ -37,6 +37,9 @@
  *
  ****************************************************************************/
 
+/* Stats ptrs read per SDK bulk call, bounds the time the SDK stats lock is held */
+#define HAL_STATS_BULK_CHUNK 64
+
 /****************************************************************************
  *
  * Global and Declaration
@@ -94,6 +97,39 @@ hal_stats_get_stats(uint16_ofp stats_ptr, ofp_stats_t * p_stats)
     return OFP_ERR_SUCCESS;
 }
 
+/**
+ * Get stats of a batch of stats ptrs in one pass
+ * @param[in]  p_stats_ptr              Stats ptrs, sorted in ascending order
+ * @param[in]  count                    Number of stats ptrs
+ * @param[out] p_stats                  Statistics of each stats ptr
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+hal_stats_get_stats_bulk(const uint16_ofp* p_stats_ptr, uint32_ofp count, ofp_stats_t* p_stats)
+{
+    ctc_stats_basic_t stats[HAL_STATS_BULK_CHUNK];
+    uint32_ofp base;
+    uint32_ofp num;
+    uint32_ofp i;
+
+    for (base = 0; base < count; base += num)
+    {
+        num = count - base;
+        if (num > HAL_STATS_BULK_CHUNK)
+        {
+            num = HAL_STATS_BULK_CHUNK;
+        }
+        HAL_ERROR_RETURN(sys_humber_stats_get_flow_stats_bulk(0, p_stats_ptr + base, num, stats));
+        for (i = 0; i < num; i++)
+        {
+            p_stats[base + i].byte_count   = stats[i].byte_count;
+            p_stats[base + i].packet_count = stats[i].packet_count;
+        }
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
 /**
  * Get stats by stats ptr
  * @param[in]  stats_ptr                Stats ptr
@@ -77,6 +77,8 @@
 #define GLB_MET_MAX_SIZE 6912
 
 #define OFP_IDLE_TIMEOUT_TIMER 5000
+#define OFP_TCAM_DEFRAG_TIMER 1000
+#define OFP_TCAM_DEFRAG_MOVES 32
 #define OFP_ETHER_TYPE_MAX_NUM 10
 
 #define OFP_BUCKET_NUM_PER_GROUP        16
@@ -22,14 +22,23 @@
  * Header Files
  *
  ****************************************************************************/
+#include "ofpbuf.h"
+#include "vlog.h"
+
 #include "ofp_types.h"
+#include "ofp_error.h"
 #include "ofp_const.h"
 #include "ofp_flow.h"
 #include "ofp_port.h"
 #include "ofp_packet.h"
+#include "ofp_macro.h"
+
+#include "ctc_aclqos.h"
 
 #include "ofp_lib.h"
 
+VLOG_DEFINE_THIS_MODULE(ofp_lib);
+
 /****************************************************************************
  *  
  * Function
@@ -193,3 +202,106 @@ cmd_str2uint(char *str, int32_ofp *ret)
     *ret = 0;
     return total;
 }
+
+/**
+ * Send packet from CPU. 16(cpu mac header) + 32(bridge header) + payload
+ * @param encap_info encapsulate information
+ * @param packet packet buffer
+ * @param hardware_process_packet packet that will be forwarded by hardware, a bridge header will be encapsulated to the original packet.
+ *        If it is packet itself, the headers are pushed into the headroom of packet and the payload is not copied
+ * @return
+ */
+int32_ofp
+ofp_encap_packet(ofp_cpu_encap_info_t* encap_info, struct ofpbuf *packet, struct ofpbuf *hardware_process_packet)
+{
+    static const ofp_cpu_mac_header_t cpu_mac_header =
+    {
+        {0xFE, 0xFD, 0x0, 0x0, 0x0, 0x1},
+        {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00},
+        OFP_CPU_ETH_P_ASIC,
+        0
+    };
+    ofp_brghdr_info_t bridge_header;
+    uint32_ofp hash = 0;
+    uint32_ofp buf_len = 0;
+    uint8_ofp *p;
+
+    OFP_PTR_CHECK(encap_info);
+    OFP_PTR_CHECK(packet);
+    OFP_PTR_CHECK(hardware_process_packet);
+    OFP_LOG_DEBUG_FUNC();
+
+    buf_len = packet->size;
+    memset(&bridge_header, 0, sizeof(ofp_brghdr_info_t));
+
+    /* encapsulate bridge header, 32byte */
+    if (encap_info->is_mcast)
+    {
+        bridge_header.nxt_hop_ptr = 0;
+    }
+    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_BRIDGE)
+    {
+        bridge_header.nxt_hop_ptr = BRIDGE_NEXTHOP_PTR;     /* can do vlan tag edit */
+    }
+    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_BYPASS)
+    {
+        bridge_header.nxt_hop_ptr = BYPASS_NEXTHOP_PTR;     /* no edit, should input final packet */
+    }
+    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_UNTAG)
+    {
+        bridge_header.nxt_hop_ptr = UNTAG_NEXTHOP_PTR;      /* can remove vlan tags */
+    }
+    else if (encap_info->nh_type == OFP_NEXTHOP_TYPE_OFFSET)
+    {
+        bridge_header.nxt_hop_ptr = encap_info->nh_offset;  /* can do any edit which support */
+    }
+
+    bridge_header.dest_id = encap_info->destid;             /* dest local port */
+    bridge_header.dest_chip_id = encap_info->dest_chipid;   /* dest global chipId */
+    bridge_header.src_port = encap_info->src_port;
+
+    /* head hash is used for linkagg */
+    hash = encap_info->hash;
+    bridge_header.hd_hash_2_to_0 = hash & 0x7;
+    bridge_header.hd_hash_7_to_3 = (hash >> 3) & 0x1F;
+
+    bridge_header.hdr_type = 1;                             /* for humber, it should be 1 */
+    bridge_header.multi_cast = encap_info->is_mcast;        /* 0:unicast, 1:multicast */
+    if(encap_info->src_vid)
+    {
+        bridge_header.src_vid = encap_info->src_vid;        /* source svlanId*/
+        bridge_header.src_svid_vld = 1;
+        bridge_header.src_vlanptr_or_timestamp_79_64 = encap_info->src_vid;  /* vlan ptr */
+    }
+    bridge_header.color = CTC_QOS_COLOR_GREEN;              /* highest priority */
+    bridge_header.priority = encap_info->packet_priority;
+    bridge_header.srcport_isolate_id = 0x3F;                /* disable port isolate */
+    bridge_header.flowid_servecid_or_oamportid |= 0xFF << 16;  /* disable flow id */
+    bridge_header.ttl_or_oam_defect = 20;                   /* TTL of packet */
+
+    bridge_header.pkt_len = buf_len + 4;                    /* add CRC 4 bytes */
+
+    ctc_swap32((uint32_ofp*)&bridge_header, sizeof(ofp_brghdr_info_t)/4, HOST_TO_NETWORK);
+
+    /* calc bridge header CRC */
+    p = (uint8_ofp*)(&bridge_header);
+    p[OFP_CPU_BRGHDR_CRC_POS] = 0;
+    p[OFP_CPU_BRGHDR_CRC_POS] = _ctclib_crc8((uint8_ofp *)&bridge_header, OFP_CPU_PKT_HDR_LEN, 0);
+
+    /* prepend cpu mac header and bridge header to the payload */
+    if (hardware_process_packet == packet)
+    {
+        p = ofpbuf_push_uninit(packet, OFP_CPU_ENCAP_HDR_LEN);
+    }
+    else
+    {
+        ofpbuf_init(hardware_process_packet, OFP_CPU_ENCAP_HDR_LEN + buf_len);
+        p = ofpbuf_put_uninit(hardware_process_packet, OFP_CPU_ENCAP_HDR_LEN);
+        ofpbuf_put(hardware_process_packet, packet->data, buf_len);
+    }
+    kal_memcpy(p, &cpu_mac_header, sizeof(ofp_cpu_mac_header_t));
+    kal_memcpy(p + sizeof(ofp_cpu_mac_header_t), &bridge_header, sizeof(ofp_brghdr_info_t));
+
+    return OFP_ERR_SUCCESS;
+}
+
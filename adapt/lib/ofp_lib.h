@@ -49,4 +49,19 @@ _ctclib_crc8(uint8_ofp *data, int32_ofp len, uint8_ofp init_crc);
 uint32_ofp
 cmd_str2uint(char *str, int32_ofp *ret);
 
+struct ofpbuf;
+struct ofp_cpu_encap_info_s;
+
+/**
+ * Prepend the cpu mac header and the humber bridge header to a packet
+ * @param encap_info encapsulate information
+ * @param packet packet buffer
+ * @param hardware_process_packet gets packet with the headers, or packet itself to
+ *        push the headers into its headroom
+ * @return OFP_ERR_XXX
+ */
+int32_ofp
+ofp_encap_packet(struct ofp_cpu_encap_info_s* encap_info, struct ofpbuf *packet,
+                 struct ofpbuf *hardware_process_packet);
+
 #endif /* __OFP_LIBS_H__ */
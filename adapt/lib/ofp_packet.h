@@ -296,4 +296,7 @@ struct ofp_cpu_packet_s
 };
 typedef struct ofp_cpu_packet_s ofp_cpu_packet_t;
 
+/* cpu mac header + bridge header, the headroom a packet-out buffer reserves */
+#define OFP_CPU_ENCAP_HDR_LEN   (sizeof(ofp_cpu_mac_header_t) + sizeof(ofp_brghdr_info_t))
+
 #endif /* ! */
@@ -21,6 +21,7 @@
 #define NETDEV_CTC_H 1
 
 #include <config.h>
+#include <netpacket/packet.h>
 
 #include "packets.h"
 #include "netdev-provider.h"
@@ -39,6 +40,7 @@ enum {
     VALID_VPORT_STAT_ERROR  = 1 << 6,
     VALID_DRVINFO           = 1 << 7,
     VALID_FEATURES          = 1 << 8,
+    VALID_TX_ADDR           = 1 << 9,
 };
 
 struct if_rx_stats
@@ -155,6 +157,7 @@ struct netdev_dev_ctc {
     int netdev_policing_error;  /* Cached error code from set policing. */
     int get_features_error;     /* Cached error code from ETHTOOL_GSET. */
     int get_ifindex_error;      /* Cached error code from SIOCGIFINDEX. */
+    struct sockaddr_ll tx_addr; /* Destination for AF_PACKET transmit. */
     
     struct if_rx_stats *rx_stats;
     struct if_tx_stats *tx_stats;
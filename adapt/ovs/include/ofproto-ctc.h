@@ -24,6 +24,7 @@
 
 #include <limits.h>
 #include "timer.h"
+#include "token-bucket.h"
 
 #include "lib/ofp-util.h"
 #include "ofproto/ofproto-provider.h"
@@ -49,6 +50,10 @@ enum { MAX_QUEUE_LEN = 128 };   /* Maximum number of packets per queue. */
 #define FLOW_MISS_MAX_BATCH 50
 #define FLOW_MISS_BUF_SIZE 4096
 
+/* CPU port receive ring geometry, each frame holds one jumbo frame. */
+#define CTC_CPUPORT_RING_FRAME_SIZE 16384
+#define CTC_CPUPORT_RING_FRAME_NR 256
+
 #ifdef _OFP_UML_
 #define NETDEV_CPU_PORT "eth104"
 #else
@@ -91,6 +96,72 @@ struct ctc_netdev_upcall {
 struct ctc_netdev_queue {
     struct ctc_netdev_upcall upcalls[MAX_QUEUE_LEN];
     unsigned int head, tail;
+    uint64_t n_dropped;         /* Misses dropped because the queue was full. */
+};
+
+/* Octeon L2 cache line size. */
+#define CTC_CACHE_LINE_SIZE 128
+
+/* Number of slots in the CPU port receive thread ring, must be a power of 2. */
+enum { CTC_RX_RING_LEN = 256 };
+
+/* One frame received by the CPU port receive thread. */
+struct ctc_rx_slot {
+    struct ofpbuf packet;       /* Decapsulated packet, points into 'data'. */
+    struct flow flow;           /* Flow of 'packet', except in_port. */
+    uint32_t nexthop_ptr;       /* From the bridge header. */
+    uint16_t src_gport;         /* From the bridge header. */
+    bool valid;                 /* False if the frame is to be dropped. */
+    uint8_t data[2 + VLAN_HEADER_LEN + VLAN_ETH_HEADER_LEN + 9600];
+};
+
+/* Single-producer/single-consumer ring between the CPU port receive thread
+ * and the main thread.  'head' is written only by the receive thread and
+ * 'tail' only by the main thread, each on its own cache line. */
+struct ctc_rx_ring {
+    unsigned int head;
+    uint64_t n_received;        /* Frames received from the CPU port. */
+    uint64_t n_ring_full;       /* Frames dropped because the ring was full. */
+    uint64_t n_decap_error;     /* Frames dropped by decapsulation. */
+
+    unsigned int tail __attribute__((aligned(CTC_CACHE_LINE_SIZE)));
+
+    struct ctc_rx_slot *slots   /* CTC_RX_RING_LEN slots, NULL if no thread. */
+        __attribute__((aligned(CTC_CACHE_LINE_SIZE)));
+    int wakeup_fds[2];          /* Pipe used to wake up the main thread. */
+    int stop_fds[2];            /* Pipe used to stop the receive thread. */
+    uint8_t scratch[2 + VLAN_HEADER_LEN + VLAN_ETH_HEADER_LEN + 9600];
+} __attribute__((aligned(CTC_CACHE_LINE_SIZE)));
+
+/* Packet-in suppression defaults.  A microflow that missed within the last
+ * CTC_MISS_CACHE_WINDOW ms is not reported again, and each in_port may send
+ * at most CTC_PIN_RATE packet-ins per second with bursts of CTC_PIN_BURST. */
+#define CTC_MISS_CACHE_WINDOW 100
+#define CTC_MISS_CACHE_MAX 4096
+#define CTC_PIN_RATE 1000
+#define CTC_PIN_BURST 2000
+
+/* A microflow recently reported to the controllers as a table miss. */
+struct ctc_miss_entry {
+    struct hmap_node hmap_node; /* In struct ofproto_ctc's 'miss_cache'. */
+    struct flow flow;
+    long long int expires;      /* Report again after this time (msec). */
+};
+
+/* Hierarchical timing wheel of rules with an idle or hard timeout.  A rule
+ * sits in the slot of the earliest time it could expire; when that slot
+ * comes due the rule is either expired or re-armed at its new deadline.
+ * CTC_EXPIRY_LEVELS levels of CTC_EXPIRY_SLOTS slots of CTC_EXPIRY_TICK ms
+ * each cover about 46 hours, more than the longest OpenFlow timeout. */
+#define CTC_EXPIRY_TICK 10
+#define CTC_EXPIRY_BITS 6
+#define CTC_EXPIRY_SLOTS (1 << CTC_EXPIRY_BITS)
+#define CTC_EXPIRY_LEVELS 4
+
+struct ctc_expiry_wheel {
+    long long int now;          /* Last tick processed. */
+    size_t n_rules;             /* Number of rules in the wheel. */
+    struct list slots[CTC_EXPIRY_LEVELS][CTC_EXPIRY_SLOTS];
 };
 
 struct ofproto_ctc {
@@ -102,7 +173,25 @@ struct ofproto_ctc {
     /* Expiration. */
     struct timer next_expiration;
     int fast_expiration;
+    struct ctc_expiry_wheel expiry;
     struct ctc_netdev_queue queues;
+
+    /* Packet-in suppression. */
+    struct hmap miss_cache;     /* Contains "struct ctc_miss_entry"s. */
+    int miss_cache_window;      /* In msec, 0 disables deduplication. */
+    unsigned int pin_rate;      /* Packet-ins/s per in_port, 0 for no limit. */
+    unsigned int pin_burst;
+    struct token_bucket pin_meters[MAX_PORTS];
+    uint64_t n_pin_delivered;   /* Miss packet-ins sent to connmgr. */
+    uint64_t n_pin_deduped;     /* Suppressed by 'miss_cache'. */
+    uint64_t n_pin_metered;     /* Suppressed by 'pin_meters'. */
+
+    /* Flow installation. */
+    struct list pending_adds;   /* Contains "struct rule_ctc"s to install. */
+    size_t n_pending_adds;
+    size_t max_add_batch;       /* Most rules installed in one transaction. */
+    uint64_t n_add_batches;     /* Transactions of more than one rule. */
+    uint64_t n_add_fallbacks;   /* Failed transactions retried rule by rule. */
 };
 
 struct rule_ctc {
@@ -134,6 +223,11 @@ struct rule_ctc {
     ofp_meter_info_t meter_info;
 
     uint32_t queue_id;
+
+    /* Expiration. */
+    struct list expiry_node;    /* In ofproto_ctc's 'expiry' wheel. */
+
+    struct list pending_node;   /* In ofproto_ctc's 'pending_adds'. */
 };
 
 struct group_ctc {
@@ -290,6 +290,32 @@ af_packet_sock(void)
     return sock;
 }
 
+/* Returns the AF_PACKET destination address of 'netdev_', building it on
+ * first use, or NULL if the device has no ifindex. */
+static const struct sockaddr_ll *
+get_tx_addr(const struct netdev *netdev_)
+{
+    struct netdev_dev_ctc *netdev_dev =
+                                netdev_dev_ctc_cast(netdev_get_dev(netdev_));
+
+    if (!(netdev_dev->cache_valid & VALID_TX_ADDR)) {
+        int ifindex;
+
+        if (get_ifindex(netdev_, &ifindex)) {
+            return NULL;
+        }
+
+        /* We don't bother setting most fields in sockaddr_ll because the
+         * kernel ignores them for SOCK_RAW. */
+        memset(&netdev_dev->tx_addr, 0, sizeof netdev_dev->tx_addr);
+        netdev_dev->tx_addr.sll_family = AF_PACKET;
+        netdev_dev->tx_addr.sll_ifindex = ifindex;
+        netdev_dev->cache_valid |= VALID_TX_ADDR;
+    }
+
+    return &netdev_dev->tx_addr;
+}
+
 /* Sends 'buffer' on 'netdev'.  Returns 0 if successful, otherwise a positive
  * errno value.  Returns EAGAIN without blocking if the packet cannot be queued
  * immediately.  Returns EMSGSIZE if a partial packet was transmitted or if
@@ -308,11 +334,7 @@ netdev_ctc_send(struct netdev *netdev_, const void *data, size_t size)
 
         if (netdev->fd < 0) {
             /* Use our AF_PACKET socket to send to this device. */
-            struct sockaddr_ll sll;
-            struct msghdr msg;
-            struct iovec iov;
-            int ifindex;
-            int error;
+            const struct sockaddr_ll *sll;
             int sock;
 
             sock = af_packet_sock();
@@ -320,29 +342,14 @@ netdev_ctc_send(struct netdev *netdev_, const void *data, size_t size)
                 return sock;
             }
 
-            error = get_ifindex(netdev_, &ifindex);
-            if (error) {
-                return error;
+            sll = get_tx_addr(netdev_);
+            if (!sll) {
+                return netdev_dev_ctc_cast(netdev_get_dev(netdev_))
+                       ->get_ifindex_error;
             }
 
-            /* We don't bother setting most fields in sockaddr_ll because the
-             * kernel ignores them for SOCK_RAW. */
-            memset(&sll, 0, sizeof sll);
-            sll.sll_family = AF_PACKET;
-            sll.sll_ifindex = ifindex;
-
-            iov.iov_base = CONST_CAST(void *, data);
-            iov.iov_len = size;
-
-            msg.msg_name = &sll;
-            msg.msg_namelen = sizeof sll;
-            msg.msg_iov = &iov;
-            msg.msg_iovlen = 1;
-            msg.msg_control = NULL;
-            msg.msg_controllen = 0;
-            msg.msg_flags = 0;
-
-            retval = sendmsg(sock, &msg, 0);
+            retval = sendto(sock, data, size, 0,
+                            (const struct sockaddr *) sll, sizeof *sll);
         } else {
             /* Use the netdev's own fd to send to this device.  This is
              * essential for tap devices, because packets sent to a tap device
@@ -19,6 +19,10 @@
 
 #include <config.h>
 #include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <linux/if_packet.h>
 
 #include "byte-order.h"
 #include "meta-flow.h"
@@ -37,6 +41,8 @@
 #include "socket-util.h"
 #include "nx-match.h"
 #include "multipath.h"
+#include "unixctl.h"
+#include "dynamic-string.h"
 #include "linux/openvswitch.h"
 
 #include "ofproto-ctc.h"
@@ -45,7 +51,10 @@
 
 VLOG_DEFINE_THIS_MODULE(ofproto_ctc);
 
+static struct vlog_rate_limit rl = VLOG_RATE_LIMIT_INIT(5, 20);
+
 enum { CTC_NETDEV_HEADROOM = 2 + VLAN_HEADER_LEN };
+enum { CTC_CPUPORT_RX_BUF_SIZE = CTC_NETDEV_HEADROOM + VLAN_ETH_HEADER_LEN + 9600 };
 
 extern int do_get_ifindex(const char *netdev_name);
 
@@ -76,6 +85,27 @@ xlate_actions(struct action_xlate_ctx *ctx,
               const struct ofpact *ofpacts, size_t ofpacts_len,
               struct ofpbuf *odp_actions);
 
+/* Interval bounds of expire(), in msec. */
+#define N_EXPIRE_STEP 3
+#define N_EXPIRE_MIN 10
+#define N_EXPIRE_MAX 100
+
+static void
+send_packet_flush(void);
+
+static void
+miss_cache_clear(struct ofproto_ctc *);
+
+static void
+rule_install_flush(struct ofproto_ctc *);
+
+static void
+expiry_wheel_init(struct ctc_expiry_wheel *);
+
+static void
+packet_in_meter_set(struct ofproto_ctc *, unsigned int rate,
+                    unsigned int burst);
+
 static bool
 is_ofproto_ctc_class(const struct ofproto_class *class)
 {
@@ -109,6 +139,39 @@ static struct ofproto_ctc *ofproto = NULL;
 int g_cpuport_fd = 0;
 uint8_t *g_miss_buf[FLOW_MISS_MAX_BATCH];
 
+/* PACKET_MMAP receive ring on the CPU port, see ofproto_netdev_port_ring_init().
+ * 'frames' is NULL when the ring is not in use and recv_packet() is used. */
+struct ctc_cpuport_ring {
+    uint8_t *frames;            /* mmap()'d ring. */
+    size_t map_len;             /* Length of 'frames' in bytes. */
+    unsigned int frame_size;    /* Bytes per frame. */
+    unsigned int frame_nr;      /* Number of frames in the ring. */
+    unsigned int next;          /* Next frame to be consumed. */
+};
+static struct ctc_cpuport_ring g_cpuport_ring;
+
+/* Batched CPU port I/O, used when the receive ring is not in use and for
+ * transmit.  recvmmsg() and sendmmsg() are newer than some of the kernels we
+ * run on, so each falls back to one syscall per frame on ENOSYS. */
+static struct mmsghdr g_cpuport_rx_msgs[FLOW_MISS_MAX_BATCH];
+static struct iovec g_cpuport_rx_iovs[FLOW_MISS_MAX_BATCH];
+static uint8_t *g_cpuport_rx_bufs[FLOW_MISS_MAX_BATCH];
+static bool g_cpuport_no_recvmmsg = false;
+
+/* Optional CPU port receive thread, see cpuport_rx_thread_main(). */
+#ifdef _OFP_CPUPORT_RX_THREAD_
+static bool g_cpuport_rx_thread_enable = true;
+#else
+static bool g_cpuport_rx_thread_enable = false;
+#endif
+static struct ctc_rx_ring g_cpuport_rx_ring;
+static pthread_t g_cpuport_rx_thread;
+
+static struct ofpbuf g_cpuport_tx_bufs[FLOW_MISS_MAX_BATCH];
+static int g_cpuport_tx_n = 0;
+static bool g_cpuport_no_sendmmsg = false;
+static uint64_t g_cpuport_tx_dropped = 0;
+
 adapt_to_ofp_error_code_map_t translate_error_code[]={
     /*{adapt_error_code,   openflow_error_code,  }*/
     {OFP_ERR_SUCCESS,                       0},
@@ -285,6 +348,81 @@ recv_packet(struct ofpbuf *packet)
     return 0;
 }
 
+static void ofproto_netdev_port_input(struct ofproto *ofproto_,
+                                      struct ofpbuf *packet);
+
+/* Receives up to FLOW_MISS_MAX_BATCH frames from the CPU port with a single
+ * recvmmsg() and feeds them to ofproto_netdev_port_input().
+ *
+ * Returns the number of frames received, or a negative errno value. */
+static int
+recv_packet_batch(struct ofproto *ofproto)
+{
+    int n_packets;
+    int i;
+
+    if (g_cpuport_fd <= 0) {
+        /* Device is not listening. */
+        return -ENODEV;
+    }
+
+    do {
+        n_packets = recvmmsg(g_cpuport_fd, g_cpuport_rx_msgs,
+                             FLOW_MISS_MAX_BATCH, MSG_TRUNC, NULL);
+    } while (n_packets < 0 && errno == EINTR);
+
+    if (n_packets < 0) {
+        if (errno == ENOSYS) {
+            VLOG_INFO("recvmmsg() not supported, receive one packet at a "
+                      "time on %s", NETDEV_CPU_PORT);
+            g_cpuport_no_recvmmsg = true;
+        } else if (errno != EAGAIN) {
+            VLOG_WARN_RL(&rl, "error receiving Ethernet packet on %s",
+                         strerror(errno));
+        }
+        return -errno;
+    }
+
+    for (i = 0; i < n_packets; i++) {
+        struct mmsghdr *msg = &g_cpuport_rx_msgs[i];
+        struct ofpbuf packet;
+
+        if (msg->msg_hdr.msg_flags & MSG_TRUNC) {
+            VLOG_WARN_RL(&rl, "discard truncated packet on %s (%u bytes)",
+                         NETDEV_CPU_PORT, msg->msg_len);
+            continue;
+        }
+
+        ofpbuf_use_stub(&packet, g_cpuport_rx_bufs[i], CTC_CPUPORT_RX_BUF_SIZE);
+        ofpbuf_reserve(&packet, CTC_NETDEV_HEADROOM);
+        packet.size = msg->msg_len;
+        if (packet.size < ETH_TOTAL_MIN) {
+            ofpbuf_put_zeros(&packet, ETH_TOTAL_MIN - packet.size);
+        }
+        ofproto_netdev_port_input(ofproto, &packet);
+        ofpbuf_uninit(&packet);
+    }
+
+    return n_packets;
+}
+
+static void
+recv_packet_batch_init(void)
+{
+    int i;
+
+    for (i = 0; i < FLOW_MISS_MAX_BATCH; i++) {
+        g_cpuport_rx_bufs[i] = xmalloc(CTC_CPUPORT_RX_BUF_SIZE);
+        g_cpuport_rx_iovs[i].iov_base = g_cpuport_rx_bufs[i]
+                                        + CTC_NETDEV_HEADROOM;
+        g_cpuport_rx_iovs[i].iov_len = CTC_CPUPORT_RX_BUF_SIZE
+                                       - CTC_NETDEV_HEADROOM;
+        memset(&g_cpuport_rx_msgs[i], 0, sizeof g_cpuport_rx_msgs[i]);
+        g_cpuport_rx_msgs[i].msg_hdr.msg_iov = &g_cpuport_rx_iovs[i];
+        g_cpuport_rx_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
 static int
 ofproto_netdev_port_output(struct ctc_upcall *upcall,
                  struct ofpbuf *buf)
@@ -306,14 +444,17 @@ ofproto_netdev_port_output(struct ctc_upcall *upcall,
     return 0;
 }
 
+/* Handles decapsulated 'packet', whose flow 'key' has already been extracted,
+ * according to 'packet_to_cpu_info'.  Misses are queued for
+ * handle_upcalls__(), packets of software processed flows are forwarded
+ * right away. */
 static void
-ofproto_netdev_port_input(struct ofproto *ofproto_, struct ofpbuf *packet)
+ofproto_netdev_port_input__(struct ofproto_ctc *ofproto, struct ofpbuf *packet,
+                            struct flow *key,
+                            const ofp_packet_to_cpu_info_t *packet_to_cpu_info)
 {
-    struct flow key;
-    struct ofproto_ctc *ofproto = ofproto_ctc_cast(ofproto_);
     struct ctc_netdev_queue *q = &ofproto->queues;
     struct ctc_upcall *upcall;
-    ofp_packet_to_cpu_info_t packet_to_cpu_info;
     struct ofpbuf *buf;
     size_t key_len;
     struct ctc_netdev_upcall *u;
@@ -323,40 +464,28 @@ ofproto_netdev_port_input(struct ofproto *ofproto_, struct ofpbuf *packet)
     struct ofpbuf odp_actions;
     uint64_t odp_actions_stub[1024 / 8];
 
-    memset(&packet_to_cpu_info, 0, sizeof(ofp_packet_to_cpu_info_t));
-
-    if (OFP_ERR_SUCCESS != ofp_netdev_decap_upcall(packet, &packet_to_cpu_info)) {
-        return;
-    }
-
-    if (packet->size < ETH_HEADER_LEN) {
-        return;
-    }
-
-    flow_extract(packet, 0, 0, NULL, packet_to_cpu_info.in_port, &key);
-
     /*we do not support MPLS slow path matching and forwarding, ignore this packet, the packet buffer
       is shared, no need free it here*/
-    if (key.dl_type == htons(ETH_TYPE_MPLS) || key.dl_type == htons(ETH_TYPE_MPLS_MCAST)) {
+    if (key->dl_type == htons(ETH_TYPE_MPLS) || key->dl_type == htons(ETH_TYPE_MPLS_MCAST)) {
         return;
     }
 
-    switch (packet_to_cpu_info.packet_in_reason)
+    switch (packet_to_cpu_info->packet_in_reason)
     {
         /* TODO software process of flow with group is not completed */
         case PACKET_TO_CPU_REASON_SW_PROCESS_GROUP:
             break;
 
         case PACKET_TO_CPU_REASON_SW_PROCESS:
-            if (packet_to_cpu_info.p_rule) {
+            if (packet_to_cpu_info->p_rule) {
                 ofpbuf_use_stack(&buf_key, &keybuf, sizeof keybuf);
-                odp_flow_key_from_flow(&buf_key, &key, key.in_port);
-                action_xlate_ctx_init(&ctx, ofproto, &key, key.vlan_tci, packet_to_cpu_info.p_rule,
-                        packet_get_tcp_flags(packet, &key), packet);
+                odp_flow_key_from_flow(&buf_key, key, key->in_port);
+                action_xlate_ctx_init(&ctx, ofproto, key, key->vlan_tci, packet_to_cpu_info->p_rule,
+                        packet_get_tcp_flags(packet, key), packet);
                 ctx.flow_process_type = OFP_FLOW_PROCESS_TYPE_MATCH_TABLE_AND_FORWARD;
-                ctx.any_port_flow = OFP_FLOW_INPORT_BASED(packet_to_cpu_info.p_rule) == FLOW_TYPE_PORT_BASED_PER_PORT ? false : true;
+                ctx.any_port_flow = OFP_FLOW_INPORT_BASED(packet_to_cpu_info->p_rule) == FLOW_TYPE_PORT_BASED_PER_PORT ? false : true;
                 ofpbuf_use_stub(&odp_actions, odp_actions_stub, sizeof odp_actions_stub);
-                xlate_actions(&ctx, packet_to_cpu_info.p_rule->up.ofpacts, packet_to_cpu_info.p_rule->up.ofpacts_len, &odp_actions);
+                xlate_actions(&ctx, packet_to_cpu_info->p_rule->up.ofpacts, packet_to_cpu_info->p_rule->up.ofpacts_len, &odp_actions);
                 execute(ofproto, buf_key.data, buf_key.size, odp_actions.data, odp_actions.size, packet);
                 ofpbuf_uninit(&odp_actions);
             }
@@ -365,6 +494,7 @@ ofproto_netdev_port_input(struct ofproto *ofproto_, struct ofpbuf *packet)
         case PACKET_TO_CPU_REASON_MISS_MATCH:
             /* Miss match packet */
             if (q->head - q->tail >= MAX_QUEUE_LEN) {
+                q->n_dropped++;
                 return;
             }
 
@@ -372,7 +502,7 @@ ofproto_netdev_port_input(struct ofproto *ofproto_, struct ofpbuf *packet)
 
             buf = &u->buf;
             ofpbuf_init(buf, ODPUTIL_FLOW_KEY_BYTES + 2 + packet->size);
-            odp_flow_key_from_flow(buf, &key, packet_to_cpu_info.in_port);
+            odp_flow_key_from_flow(buf, key, packet_to_cpu_info->in_port);
             key_len = buf->size;
             ofpbuf_pull(buf, key_len);
             ofpbuf_reserve(buf, 2);
@@ -393,13 +523,393 @@ ofproto_netdev_port_input(struct ofproto *ofproto_, struct ofpbuf *packet)
     }
 }
 
+static void
+ofproto_netdev_port_input(struct ofproto *ofproto_, struct ofpbuf *packet)
+{
+    struct flow key;
+    struct ofproto_ctc *ofproto = ofproto_ctc_cast(ofproto_);
+    ofp_packet_to_cpu_info_t packet_to_cpu_info;
+
+    memset(&packet_to_cpu_info, 0, sizeof(ofp_packet_to_cpu_info_t));
+
+    if (OFP_ERR_SUCCESS != ofp_netdev_decap_upcall(packet, &packet_to_cpu_info)) {
+        return;
+    }
+
+    if (packet->size < ETH_HEADER_LEN) {
+        return;
+    }
+
+    flow_extract(packet, 0, 0, NULL, packet_to_cpu_info.in_port, &key);
+    ofproto_netdev_port_input__(ofproto, packet, &key, &packet_to_cpu_info);
+}
+
+/* Sets up a PACKET_MMAP receive ring on CPU port socket 'fd'.  The kernel
+ * shipped with V330 is 2.6.32, which has no TPACKET_V3 block ring, so the ring
+ * is made of fixed TPACKET_V2 frames large enough for a jumbo frame.
+ *
+ * Returns 0 if successful, otherwise a positive errno value, in which case the
+ * caller falls back to recv_packet(). */
+static int
+ofproto_netdev_port_ring_init(int fd)
+{
+    struct ctc_cpuport_ring *ring = &g_cpuport_ring;
+    struct tpacket_req req;
+    int version = TPACKET_V2;
+    void *map;
+
+    if (setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version, sizeof version)) {
+        return errno;
+    }
+
+    memset(&req, 0, sizeof req);
+    req.tp_block_size = CTC_CPUPORT_RING_FRAME_SIZE;
+    req.tp_block_nr = CTC_CPUPORT_RING_FRAME_NR;
+    req.tp_frame_size = CTC_CPUPORT_RING_FRAME_SIZE;
+    req.tp_frame_nr = CTC_CPUPORT_RING_FRAME_NR;
+    if (setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof req)) {
+        return errno;
+    }
+
+    map = mmap(NULL, (size_t) req.tp_block_size * req.tp_block_nr,
+               PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        int error = errno;
+
+        /* Tear down the ring so that plain recv() works on 'fd' again. */
+        memset(&req, 0, sizeof req);
+        setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof req);
+        return error;
+    }
+
+    ring->frames = map;
+    ring->map_len = (size_t) req.tp_block_size * req.tp_block_nr;
+    ring->frame_size = req.tp_frame_size;
+    ring->frame_nr = req.tp_frame_nr;
+    ring->next = 0;
+
+    return 0;
+}
+
+/* Passes every frame that the kernel has handed over in the CPU port ring to
+ * ofproto_netdev_port_input(), in place, and gives the frames back to the
+ * kernel.  At most one lap of the ring is consumed per call so that a receive
+ * storm cannot starve the rest of the main loop. */
+static void
+ofproto_netdev_port_recv_ring(struct ofproto *ofproto)
+{
+    struct ctc_cpuport_ring *ring = &g_cpuport_ring;
+    unsigned int n;
+
+    for (n = 0; n < ring->frame_nr; n++) {
+        struct tpacket2_hdr *hdr;
+        struct ofpbuf packet;
+
+        hdr = (struct tpacket2_hdr *) (ring->frames
+                                       + ring->next * ring->frame_size);
+        if (!(hdr->tp_status & TP_STATUS_USER)) {
+            break;
+        }
+        /* Do not read the frame before its status. */
+        __sync_synchronize();
+
+        if (hdr->tp_snaplen == hdr->tp_len) {
+            /* The rest of the frame serves as tailroom for short packets. */
+            ofpbuf_use_stub(&packet, (uint8_t *) hdr + hdr->tp_mac,
+                            ring->frame_size - hdr->tp_mac);
+            packet.size = hdr->tp_snaplen;
+            if (packet.size < ETH_TOTAL_MIN) {
+                ofpbuf_put_zeros(&packet, ETH_TOTAL_MIN - packet.size);
+            }
+            ofproto_netdev_port_input(ofproto, &packet);
+            ofpbuf_uninit(&packet);
+        } else {
+            VLOG_WARN_RL(&rl, "discard truncated packet on %s (%u of %u bytes)",
+                         NETDEV_CPU_PORT, hdr->tp_snaplen, hdr->tp_len);
+        }
+
+        /* Hand the frame back only after we are done with its contents. */
+        __sync_synchronize();
+        hdr->tp_status = TP_STATUS_KERNEL;
+        ring->next = (ring->next + 1) % ring->frame_nr;
+    }
+}
+
+/* Prepares 'slot' to receive a frame and returns the buffer to receive into. */
+static struct iovec
+cpuport_rx_slot_prepare(struct ctc_rx_slot *slot)
+{
+    struct iovec iov;
+
+    ofpbuf_use_stub(&slot->packet, slot->data, sizeof slot->data);
+    ofpbuf_reserve(&slot->packet, CTC_NETDEV_HEADROOM);
+    iov.iov_base = slot->packet.data;
+    iov.iov_len = ofpbuf_tailroom(&slot->packet);
+    return iov;
+}
+
+/* Decapsulates the 'size' bytes frame received into 'slot' and extracts its
+ * flow.  Everything done here must stay clear of the adapter database, which
+ * is only safe to use from the main thread. */
+static void
+cpuport_rx_slot_fill(struct ctc_rx_ring *ring, struct ctc_rx_slot *slot,
+                     size_t size)
+{
+    slot->valid = false;
+    slot->packet.size = size;
+    if (slot->packet.size < ETH_TOTAL_MIN) {
+        ofpbuf_put_zeros(&slot->packet, ETH_TOTAL_MIN - slot->packet.size);
+    }
+
+    if (OFP_ERR_SUCCESS != ofp_netdev_decap_packet(&slot->packet,
+                                                   &slot->src_gport,
+                                                   &slot->nexthop_ptr)
+        || slot->packet.size < ETH_HEADER_LEN) {
+        ring->n_decap_error++;
+        return;
+    }
+
+    /* in_port is filled in by the main thread from 'src_gport'. */
+    flow_extract(&slot->packet, 0, 0, NULL, 0, &slot->flow);
+    slot->valid = true;
+}
+
+/* Body of the CPU port receive thread.  It receives frames straight into the
+ * free slots of 'g_cpuport_rx_ring', strips the bridge header, extracts the
+ * flow and publishes the slots to the main thread, which finishes them in
+ * ofproto_netdev_port_recv_thread().  Frames that arrive while the ring is full
+ * are dropped and counted. */
+static void *
+cpuport_rx_thread_main(void *ring_)
+{
+    struct ctc_rx_ring *ring = ring_;
+    struct mmsghdr msgs[FLOW_MISS_MAX_BATCH];
+    struct iovec iovs[FLOW_MISS_MAX_BATCH];
+    struct pollfd pfds[2];
+    sigset_t sigset;
+
+    /* Leave SIGALRM to the main thread, as the SDK thread does. */
+    sigemptyset(&sigset);
+    sigaddset(&sigset, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &sigset, NULL);
+
+    pfds[0].fd = g_cpuport_fd;
+    pfds[0].events = POLLIN;
+    pfds[1].fd = ring->stop_fds[0];
+    pfds[1].events = POLLIN;
+
+    for (;;) {
+        unsigned int head = ring->head;
+        unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        unsigned int n_free = CTC_RX_RING_LEN - (head - tail);
+        int n_batch;
+        int n_packets;
+        int i;
+
+        if (poll(pfds, 2, -1) < 0) {
+            continue;
+        }
+        if (pfds[1].revents) {
+            break;
+        }
+        if (!pfds[0].revents) {
+            continue;
+        }
+
+        if (!n_free) {
+            /* Main thread is behind, make room in the socket anyway. */
+            n_packets = recv(g_cpuport_fd, ring->scratch, sizeof ring->scratch,
+                             MSG_TRUNC);
+            if (n_packets >= 0) {
+                ring->n_ring_full++;
+            }
+            continue;
+        }
+
+        n_batch = MIN(n_free, FLOW_MISS_MAX_BATCH);
+        if (!g_cpuport_no_recvmmsg) {
+            memset(msgs, 0, n_batch * sizeof msgs[0]);
+            for (i = 0; i < n_batch; i++) {
+                struct ctc_rx_slot *slot;
+
+                slot = &ring->slots[(head + i) & (CTC_RX_RING_LEN - 1)];
+                iovs[i] = cpuport_rx_slot_prepare(slot);
+                msgs[i].msg_hdr.msg_iov = &iovs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+            n_packets = recvmmsg(g_cpuport_fd, msgs, n_batch, MSG_TRUNC, NULL);
+            if (n_packets < 0 && errno == ENOSYS) {
+                g_cpuport_no_recvmmsg = true;
+            }
+        } else {
+            struct ctc_rx_slot *slot;
+
+            slot = &ring->slots[head & (CTC_RX_RING_LEN - 1)];
+            iovs[0] = cpuport_rx_slot_prepare(slot);
+            n_packets = recv(g_cpuport_fd, iovs[0].iov_base, iovs[0].iov_len,
+                             MSG_TRUNC);
+            if (n_packets >= 0) {
+                msgs[0].msg_len = n_packets;
+                msgs[0].msg_hdr.msg_flags = ((size_t) n_packets
+                                             > iovs[0].iov_len
+                                             ? MSG_TRUNC : 0);
+                n_packets = 1;
+            }
+        }
+        if (n_packets <= 0) {
+            continue;
+        }
+
+        for (i = 0; i < n_packets; i++) {
+            struct ctc_rx_slot *slot;
+
+            slot = &ring->slots[(head + i) & (CTC_RX_RING_LEN - 1)];
+            if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+                slot->valid = false;
+                ring->n_decap_error++;
+            } else {
+                cpuport_rx_slot_fill(ring, slot, msgs[i].msg_len);
+            }
+        }
+        ring->n_received += n_packets;
+
+        /* Publish the slots, then kick the main loop. */
+        __atomic_store_n(&ring->head, head + n_packets, __ATOMIC_RELEASE);
+        ignore(write(ring->wakeup_fds[1], "", 1));
+    }
+
+    return NULL;
+}
+
+static int
+cpuport_rx_thread_start(void)
+{
+    struct ctc_rx_ring *ring = &g_cpuport_rx_ring;
+    int error;
+
+    if (pipe(ring->wakeup_fds)) {
+        return errno;
+    }
+    if (pipe(ring->stop_fds)) {
+        error = errno;
+        close(ring->wakeup_fds[0]);
+        close(ring->wakeup_fds[1]);
+        return error;
+    }
+    set_nonblocking(ring->wakeup_fds[0]);
+    set_nonblocking(ring->wakeup_fds[1]);
+
+    ring->slots = xmalloc(CTC_RX_RING_LEN * sizeof *ring->slots);
+    ring->head = ring->tail = 0;
+
+    error = pthread_create(&g_cpuport_rx_thread, NULL, cpuport_rx_thread_main,
+                           ring);
+    if (error) {
+        close(ring->wakeup_fds[0]);
+        close(ring->wakeup_fds[1]);
+        close(ring->stop_fds[0]);
+        close(ring->stop_fds[1]);
+        free(ring->slots);
+        ring->slots = NULL;
+    }
+    return error;
+}
+
+/* Stops and joins the receive thread, if it is running, and frees its ring
+ * together with the frames published to the main thread but not finished. */
+static void
+cpuport_rx_thread_stop(void)
+{
+    struct ctc_rx_ring *ring = &g_cpuport_rx_ring;
+    unsigned int tail;
+    int error;
+
+    if (!ring->slots) {
+        return;
+    }
+
+    ignore(write(ring->stop_fds[1], "", 1));
+    error = pthread_join(g_cpuport_rx_thread, NULL);
+    if (error) {
+        /* The thread may still write into the slots, leave them be. */
+        VLOG_ERR("failed to join %s receive thread (%s)",
+                 NETDEV_CPU_PORT, strerror(error));
+        return;
+    }
+
+    for (tail = ring->tail; tail != ring->head; tail++) {
+        ofpbuf_uninit(&ring->slots[tail & (CTC_RX_RING_LEN - 1)].packet);
+    }
+
+    close(ring->wakeup_fds[0]);
+    close(ring->wakeup_fds[1]);
+    close(ring->stop_fds[0]);
+    close(ring->stop_fds[1]);
+    free(ring->slots);
+    ring->slots = NULL;
+}
+
+/* Finishes the slots published by the receive thread: resolves their input
+ * port and packet-in reason against the adapter database and hands them to
+ * ofproto_netdev_port_input__().  Stops early when the upcall queue is full,
+ * leaving the rest of the ring to the next call. */
+static void
+ofproto_netdev_port_recv_thread(struct ofproto_ctc *ofproto)
+{
+    struct ctc_rx_ring *ring = &g_cpuport_rx_ring;
+    struct ctc_netdev_queue *q = &ofproto->queues;
+    unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    unsigned int tail = ring->tail;
+    char buf[128];
+
+    while (read(ring->wakeup_fds[0], buf, sizeof buf) > 0) {
+        continue;
+    }
+
+    while (tail != head && q->head - q->tail < MAX_QUEUE_LEN) {
+        struct ctc_rx_slot *slot = &ring->slots[tail & (CTC_RX_RING_LEN - 1)];
+        ofp_packet_to_cpu_info_t packet_to_cpu_info;
+
+        memset(&packet_to_cpu_info, 0, sizeof packet_to_cpu_info);
+        if (slot->valid
+            && OFP_ERR_SUCCESS == ofp_netdev_resolve_upcall(slot->src_gport,
+                                                      slot->nexthop_ptr,
+                                                      &packet_to_cpu_info)) {
+            slot->flow.in_port = packet_to_cpu_info.in_port;
+            ofproto_netdev_port_input__(ofproto, &slot->packet, &slot->flow,
+                                        &packet_to_cpu_info);
+        }
+        ofpbuf_uninit(&slot->packet);
+        tail++;
+    }
+
+    __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+}
+
 static void
 ofproto_netdev_port_recv(struct ofproto *ofproto)
 {
     struct ofpbuf packet;
     ssize_t retval = 0;
 
-    ofpbuf_init(&packet, CTC_NETDEV_HEADROOM + VLAN_ETH_HEADER_LEN + 9600);
+    if (g_cpuport_rx_ring.slots) {
+        ofproto_netdev_port_recv_thread(ofproto_ctc_cast(ofproto));
+        return;
+    }
+
+    if (g_cpuport_ring.frames) {
+        ofproto_netdev_port_recv_ring(ofproto);
+        return;
+    }
+
+    if (!g_cpuport_no_recvmmsg) {
+        retval = recv_packet_batch(ofproto);
+        if (retval != -ENOSYS) {
+            return;
+        }
+    }
+
+    ofpbuf_init(&packet, CTC_CPUPORT_RX_BUF_SIZE);
     ofpbuf_clear(&packet);
     ofpbuf_reserve(&packet, CTC_NETDEV_HEADROOM);
     retval = recv_packet(&packet);
@@ -453,6 +963,23 @@ ofproto_netdev_port_init(void)
     }
 
     g_cpuport_fd = fd;
+
+    if (g_cpuport_rx_thread_enable) {
+        error = cpuport_rx_thread_start();
+        if (!error) {
+            return 0;
+        }
+        VLOG_ERR("failed to start %s receive thread (%s)",
+                 NETDEV_CPU_PORT, strerror(error));
+    }
+
+    error = ofproto_netdev_port_ring_init(fd);
+    if (error) {
+        VLOG_INFO("%s receive ring unavailable (%s), using recvmmsg()",
+                  NETDEV_CPU_PORT, strerror(error));
+        recv_packet_batch_init();
+    }
+
     return 0;
 
 error:
@@ -462,6 +989,166 @@ error:
     return error;
 }
 
+/* Undoes ofproto_netdev_port_init(): stops the receive thread, flushes the
+ * pending transmit batch, unmaps the receive ring, frees the recvmmsg()
+ * buffers and closes the CPU port socket. */
+static void
+ofproto_netdev_port_deinit(void)
+{
+    struct ctc_cpuport_ring *ring = &g_cpuport_ring;
+    int i;
+
+    if (g_cpuport_fd <= 0) {
+        return;
+    }
+
+    cpuport_rx_thread_stop();
+    send_packet_flush();
+
+    if (ring->frames) {
+        if (munmap(ring->frames, ring->map_len)) {
+            VLOG_WARN("failed to unmap %s receive ring (%s)",
+                      NETDEV_CPU_PORT, strerror(errno));
+        }
+        memset(ring, 0, sizeof *ring);
+    }
+
+    for (i = 0; i < FLOW_MISS_MAX_BATCH; i++) {
+        free(g_cpuport_rx_bufs[i]);
+        g_cpuport_rx_bufs[i] = NULL;
+    }
+
+    close(g_cpuport_fd);
+    g_cpuport_fd = 0;
+}
+
+static void
+ofproto_ctc_unixctl_upcall_show(struct unixctl_conn *conn,
+                                int argc OVS_UNUSED,
+                                const char *argv[] OVS_UNUSED,
+                                void *aux OVS_UNUSED)
+{
+    struct ds ds = DS_EMPTY_INITIALIZER;
+    const struct ctc_rx_ring *ring = &g_cpuport_rx_ring;
+
+    if (!ofproto) {
+        unixctl_command_reply_error(conn, "no such bridge");
+        return;
+    }
+
+    ds_put_format(&ds, "%s receive: %s\n", NETDEV_CPU_PORT,
+                  ring->slots ? "thread"
+                  : g_cpuport_ring.frames ? "mmap ring"
+                  : !g_cpuport_no_recvmmsg ? "recvmmsg" : "recv");
+    ds_put_format(&ds, "%s transmit: %s, dropped:%"PRIu64"\n", NETDEV_CPU_PORT,
+                  !g_cpuport_no_sendmmsg ? "sendmmsg" : "write",
+                  g_cpuport_tx_dropped);
+    ds_put_format(&ds, "upcall queue: %u/%d, dropped:%"PRIu64"\n",
+                  ofproto->queues.head - ofproto->queues.tail, MAX_QUEUE_LEN,
+                  ofproto->queues.n_dropped);
+    ds_put_format(&ds, "packet-in: delivered:%"PRIu64" deduplicated:%"PRIu64
+                  " rate limited:%"PRIu64"\n", ofproto->n_pin_delivered,
+                  ofproto->n_pin_deduped, ofproto->n_pin_metered);
+    ds_put_format(&ds, "packet-in limit: window %d ms, %zu flows cached, "
+                  "rate %u/s, burst %u\n", ofproto->miss_cache_window,
+                  hmap_count(&ofproto->miss_cache), ofproto->pin_rate,
+                  ofproto->pin_burst);
+    ds_put_format(&ds, "expiry wheel: %zu rules\n", ofproto->expiry.n_rules);
+    ds_put_format(&ds, "flow install: %zu pending, %"PRIu64" batches, "
+                  "%"PRIu64" retried rule by rule, largest batch %zu\n",
+                  ofproto->n_pending_adds, ofproto->n_add_batches,
+                  ofproto->n_add_fallbacks, ofproto->max_add_batch);
+    if (ring->slots) {
+        ds_put_format(&ds, "receive ring: %u/%d, received:%"PRIu64
+                      " ring full:%"PRIu64" decap error:%"PRIu64"\n",
+                      __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE)
+                      - ring->tail, CTC_RX_RING_LEN, ring->n_received,
+                      ring->n_ring_full, ring->n_decap_error);
+    }
+
+    unixctl_command_reply(conn, ds_cstr(&ds));
+    ds_destroy(&ds);
+}
+
+static void
+ofproto_ctc_unixctl_packet_in_limit(struct unixctl_conn *conn, int argc,
+                                    const char *argv[],
+                                    void *aux OVS_UNUSED)
+{
+    int window, rate, burst;
+
+    if (!ofproto) {
+        unixctl_command_reply_error(conn, "no such bridge");
+        return;
+    }
+
+    rate = ofproto->pin_rate;
+    burst = ofproto->pin_burst;
+    if (!str_to_int(argv[1], 10, &window)
+        || (argc > 2 && !str_to_int(argv[2], 10, &rate))
+        || (argc > 3 && !str_to_int(argv[3], 10, &burst))
+        || window < 0 || rate < 0 || burst < 0) {
+        unixctl_command_reply_error(conn, "invalid packet-in limit");
+        return;
+    }
+
+    ofproto->miss_cache_window = window;
+    if (!window) {
+        miss_cache_clear(ofproto);
+    }
+    packet_in_meter_set(ofproto, rate, burst);
+    unixctl_command_reply(conn, NULL);
+}
+
+static void
+ofproto_ctc_unixctl_lock_show(struct unixctl_conn *conn,
+                              int argc OVS_UNUSED,
+                              const char *argv[] OVS_UNUSED,
+                              void *aux OVS_UNUSED)
+{
+    struct ds ds = DS_EMPTY_INITIALIZER;
+
+    if (ofp_lock_show(&ds)) {
+        unixctl_command_reply_error(conn, "lock profile unavailable");
+    } else {
+        unixctl_command_reply(conn, ds_cstr(&ds));
+    }
+    ds_destroy(&ds);
+}
+
+static void
+ofproto_ctc_unixctl_lock_clear(struct unixctl_conn *conn,
+                               int argc OVS_UNUSED,
+                               const char *argv[] OVS_UNUSED,
+                               void *aux OVS_UNUSED)
+{
+    if (ofp_lock_clear_stats()) {
+        unixctl_command_reply_error(conn, "lock profile unavailable");
+        return;
+    }
+    unixctl_command_reply(conn, NULL);
+}
+
+static void
+ofproto_ctc_unixctl_lock_profile(struct unixctl_conn *conn,
+                                 int argc OVS_UNUSED, const char *argv[],
+                                 void *aux OVS_UNUSED)
+{
+    bool enable;
+
+    if (!strcmp(argv[1], "on")) {
+        enable = true;
+    } else if (!strcmp(argv[1], "off")) {
+        enable = false;
+    } else {
+        unixctl_command_reply_error(conn, "expecting \"on\" or \"off\"");
+        return;
+    }
+
+    ofp_lock_set_profile(enable);
+    unixctl_command_reply(conn, NULL);
+}
+
 static void
 init(const struct shash *iface_hints)
 {
@@ -474,6 +1161,18 @@ init(const struct shash *iface_hints)
 
     ofproto_netdev_port_init();
 
+    unixctl_command_register("ofproto-ctc/upcall-show", "", 0, 0,
+                             ofproto_ctc_unixctl_upcall_show, NULL);
+    unixctl_command_register("ofproto-ctc/packet-in-limit",
+                             "window_ms [rate [burst]]", 1, 3,
+                             ofproto_ctc_unixctl_packet_in_limit, NULL);
+    unixctl_command_register("ofproto-ctc/lock-show", "", 0, 0,
+                             ofproto_ctc_unixctl_lock_show, NULL);
+    unixctl_command_register("ofproto-ctc/lock-clear", "", 0, 0,
+                             ofproto_ctc_unixctl_lock_clear, NULL);
+    unixctl_command_register("ofproto-ctc/lock-profile", "on|off", 1, 1,
+                             ofproto_ctc_unixctl_lock_profile, NULL);
+
     /* XXX: iface_hints processing is needed ? */
 }
 
@@ -533,17 +1232,114 @@ send_packet_in_miss(struct ofproto_ctc *ofproto, const struct ofpbuf *packet,
     connmgr_send_packet_in(ofproto->up.connmgr, &pin);
 }
 
+/* Returns true if 'flow' was reported as a miss within the last
+ * 'miss_cache_window' ms, otherwise remembers it as reported now. */
+static bool
+miss_cache_check(struct ofproto_ctc *ofproto, const struct flow *flow,
+                 uint32_t hash)
+{
+    struct ctc_miss_entry *entry;
+    long long int now = time_msec();
+
+    if (!ofproto->miss_cache_window) {
+        return false;
+    }
+
+    HMAP_FOR_EACH_WITH_HASH (entry, hmap_node, hash, &ofproto->miss_cache) {
+        if (flow_equal(&entry->flow, flow)) {
+            if (now < entry->expires) {
+                return true;
+            }
+            entry->expires = now + ofproto->miss_cache_window;
+            return false;
+        }
+    }
+
+    if (hmap_count(&ofproto->miss_cache) < CTC_MISS_CACHE_MAX) {
+        entry = xmalloc(sizeof *entry);
+        entry->flow = *flow;
+        entry->expires = now + ofproto->miss_cache_window;
+        hmap_insert(&ofproto->miss_cache, &entry->hmap_node, hash);
+    }
+    return false;
+}
+
+/* Forgets the misses whose suppression window is over. */
+static void
+miss_cache_expire(struct ofproto_ctc *ofproto)
+{
+    struct ctc_miss_entry *entry, *next;
+    long long int now = time_msec();
+
+    HMAP_FOR_EACH_SAFE (entry, next, hmap_node, &ofproto->miss_cache) {
+        if (now >= entry->expires) {
+            hmap_remove(&ofproto->miss_cache, &entry->hmap_node);
+            free(entry);
+        }
+    }
+}
+
+static void
+miss_cache_clear(struct ofproto_ctc *ofproto)
+{
+    struct ctc_miss_entry *entry, *next;
+
+    HMAP_FOR_EACH_SAFE (entry, next, hmap_node, &ofproto->miss_cache) {
+        hmap_remove(&ofproto->miss_cache, &entry->hmap_node);
+        free(entry);
+    }
+}
+
+/* Returns true if 'in_port' still has packet-in budget, consuming it. */
+static bool
+packet_in_meter_allow(struct ofproto_ctc *ofproto, uint16_t in_port)
+{
+    if (!ofproto->pin_rate || in_port >= MAX_PORTS) {
+        return true;
+    }
+
+    /* 1000 tokens per packet-in turns the per-msec bucket into per-second. */
+    return token_bucket_withdraw(&ofproto->pin_meters[in_port], 1000);
+}
+
+static void
+packet_in_meter_set(struct ofproto_ctc *ofproto, unsigned int rate,
+                    unsigned int burst)
+{
+    int i;
+
+    ofproto->pin_rate = rate;
+    ofproto->pin_burst = burst;
+    for (i = 0; i < MAX_PORTS; i++) {
+        token_bucket_init(&ofproto->pin_meters[i], rate,
+                          MAX(burst, 1) * 1000);
+    }
+}
+
 static void
 handle_flow_miss(struct ofproto_ctc *ofproto, struct flow_miss *miss,
                  struct flow_miss_op *ops, size_t *n_ops)
 {
     const struct flow *flow = &miss->flow;
     struct ofpbuf *packet;
+    bool suppress;
 
     ops = ops; /* TODO unused parameter */
     n_ops = n_ops; /* TODO unused parameter */
+
+    /* Report a microflow once per window, however many of its packets hit
+     * the CPU in this batch or in the ones before. */
+    suppress = miss_cache_check(ofproto, flow, miss->hmap_node.hash);
     LIST_FOR_EACH (packet, list_node, &miss->packets) {
-        send_packet_in_miss(ofproto, packet, flow);
+        if (suppress) {
+            ofproto->n_pin_deduped++;
+        } else if (!packet_in_meter_allow(ofproto, flow->in_port)) {
+            ofproto->n_pin_metered++;
+        } else {
+            send_packet_in_miss(ofproto, packet, flow);
+            ofproto->n_pin_delivered++;
+            suppress = ofproto->miss_cache_window != 0;
+        }
     }
 
     return;
@@ -647,6 +1443,11 @@ handle_upcalls__(unsigned int max_batch)
 
     ovs_assert(max_batch <= FLOW_MISS_MAX_BATCH);
 
+    if (g_cpuport_rx_ring.slots) {
+        /* Pull in whatever the receive thread has queued meanwhile. */
+        ofproto_netdev_port_recv_thread(ofproto);
+    }
+
     n_misses = 0;
     for (n_processed = 0; n_processed < max_batch; n_processed++) {
         struct ctc_upcall *upcall = &misses[n_misses];
@@ -945,6 +1746,17 @@ construct(struct ofproto *ofproto_)
     }
 
     timer_set_duration(&ofproto->next_expiration, 10);
+    expiry_wheel_init(&ofproto->expiry);
+
+    hmap_init(&ofproto->miss_cache);
+    ofproto->miss_cache_window = CTC_MISS_CACHE_WINDOW;
+    packet_in_meter_set(ofproto, CTC_PIN_RATE, CTC_PIN_BURST);
+
+    list_init(&ofproto->pending_adds);
+    ofproto->n_pending_adds = 0;
+    ofproto->max_add_batch = 0;
+    ofproto->n_add_batches = 0;
+    ofproto->n_add_fallbacks = 0;
 
     ofproto_->ogf.types = (1u << OFPGT11_ALL)     |
                           (1u << OFPGT11_SELECT)  |
@@ -1003,33 +1815,134 @@ construct(struct ofproto *ofproto_)
 
     ofp_ofproto_construct();
 
+    /* destruct() of an earlier instance closed the CPU port socket. */
+    ofproto_netdev_port_init();
+
     return error;
 }
 
 
 static void
-destruct(struct ofproto *ofproto_ OVS_UNUSED)
+destruct(struct ofproto *ofproto_)
 {
+    struct ofproto_ctc *ofproto = ofproto_ctc_cast(ofproto_);
+
+    rule_install_flush(ofproto);
     ofp_ofproto_destruct();
+
+    miss_cache_clear(ofproto);
+    hmap_destroy(&ofproto->miss_cache);
+
+    ofproto_netdev_port_deinit();
 }
 
 static int
 run_fast(struct ofproto *ofproto_ OVS_UNUSED)
 {
     ofproto_netdev_port_recv(&ofproto->up);
+
+    /* run_fast() is also called after wait__(), so flush here as well. */
+    send_packet_flush();
     return 0;
 }
 
+/* Flow expiration timing wheel. */
+
+static void
+expiry_wheel_init(struct ctc_expiry_wheel *wheel)
+{
+    int level, slot;
+
+    wheel->now = time_msec() / CTC_EXPIRY_TICK;
+    wheel->n_rules = 0;
+    for (level = 0; level < CTC_EXPIRY_LEVELS; level++) {
+        for (slot = 0; slot < CTC_EXPIRY_SLOTS; slot++) {
+            list_init(&wheel->slots[level][slot]);
+        }
+    }
+}
+
+/* Links 'rule' into the slot for 'deadline' (msec).  Deadlines beyond the
+ * wheel's range go into the farthest slot and are re-armed from there. */
+static void
+expiry_wheel_insert(struct ctc_expiry_wheel *wheel, struct rule_ctc *rule,
+                    long long int deadline)
+{
+    long long int tick = deadline / CTC_EXPIRY_TICK + 1;
+    long long int delta;
+    int level;
+
+    if (tick <= wheel->now) {
+        tick = wheel->now + 1;
+    }
+
+    delta = tick - wheel->now;
+    for (level = 0; level < CTC_EXPIRY_LEVELS - 1; level++) {
+        if (delta < 1LL << ((level + 1) * CTC_EXPIRY_BITS)) {
+            break;
+        }
+    }
+    if (delta >= 1LL << ((level + 1) * CTC_EXPIRY_BITS)) {
+        tick = wheel->now + (1LL << ((level + 1) * CTC_EXPIRY_BITS)) - 1;
+    }
+
+    list_push_back(&wheel->slots[level][(tick >> (level * CTC_EXPIRY_BITS))
+                                        & (CTC_EXPIRY_SLOTS - 1)],
+                   &rule->expiry_node);
+    wheel->n_rules++;
+}
+
+static void
+expiry_wheel_remove(struct ctc_expiry_wheel *wheel, struct rule_ctc *rule)
+{
+    if (!list_is_empty(&rule->expiry_node)) {
+        list_remove(&rule->expiry_node);
+        list_init(&rule->expiry_node);
+        wheel->n_rules--;
+    }
+}
+
+/* Returns the earliest time (msec) at which 'rule' could expire, or
+ * LLONG_MAX if it has no timeout. */
+static long long int
+rule_expiry_deadline(const struct rule_ctc *rule)
+{
+    long long int deadline = LLONG_MAX;
+
+    if (rule->up.hard_timeout) {
+        deadline = rule->up.modified + rule->up.hard_timeout * 1000;
+    }
+    if (rule->up.idle_timeout) {
+        deadline = MIN(deadline,
+                       rule->up.used + rule->up.idle_timeout * 1000);
+    }
+    return deadline;
+}
+
+/* Puts 'rule' into 'ofproto''s expiry wheel, if it has a timeout. */
+static void
+rule_expiry_arm(struct ofproto_ctc *ofproto, struct rule_ctc *rule)
+{
+    long long int deadline = rule_expiry_deadline(rule);
+
+    if (deadline != LLONG_MAX) {
+        expiry_wheel_insert(&ofproto->expiry, rule, deadline);
+    }
+}
+
 /* If 'rule' is an OpenFlow rule, that has expired according to OpenFlow rules,
- * then delete it entirely. */
+ * then delete it entirely.  Otherwise re-arms it at its next deadline, which
+ * moves out when the hardware reports the flow as recently matched. */
 static void
-rule_expire(struct rule_ctc *rule)
+rule_expire(struct ofproto_ctc *ofproto, struct rule_ctc *rule)
 {
     long long int now;
     uint8_t reason;
 
     if (rule->up.pending) {
         /* We'll have to expire it later. */
+        expiry_wheel_insert(&ofproto->expiry, rule,
+                            time_msec() + N_EXPIRE_MAX);
         return;
     }
 
@@ -1047,6 +1960,7 @@ rule_expire(struct rule_ctc *rule)
                && now > rule->up.used + rule->up.idle_timeout * 1000) {
         reason = OFPRR_IDLE_TIMEOUT;
     } else {
+        rule_expiry_arm(ofproto, rule);
         return;
     }
 
@@ -1054,39 +1968,83 @@ rule_expire(struct rule_ctc *rule)
     ofproto_rule_expire(&rule->up, reason);
 }
 
-/* This function is called periodically by run().  Its job is to collect
- * updates for the flows that have been installed into the datapath, most
- * importantly when they last were used, and then use that information to
- * expire flows that have not been used recently.
+/* Moves the rules in 'level''s current slot down to the levels below. */
+static void
+expiry_wheel_cascade(struct ofproto_ctc *ofproto, int level)
+{
+    struct ctc_expiry_wheel *wheel = &ofproto->expiry;
+    struct list *slot;
+    struct list rules;
+
+    slot = &wheel->slots[level][(wheel->now >> (level * CTC_EXPIRY_BITS))
+                                & (CTC_EXPIRY_SLOTS - 1)];
+    if (list_is_empty(slot)) {
+        return;
+    }
+
+    list_init(&rules);
+    list_splice(&rules, slot->next, slot);
+    while (!list_is_empty(&rules)) {
+        struct rule_ctc *rule = CONTAINER_OF(list_pop_front(&rules),
+                                             struct rule_ctc, expiry_node);
+
+        wheel->n_rules--;
+        expiry_wheel_insert(wheel, rule, rule_expiry_deadline(rule));
+    }
+}
+
+/* This function is called periodically by run().  Its job is to visit the
+ * rules whose idle or hard deadline has arrived, refresh when they last were
+ * used from the hardware, and expire those that have not been used recently.
+ * Rules that are not due are not touched.
  *
  * Returns the number of milliseconds after which it should be called again. */
 static int
 expire(struct ofproto_ctc *ofproto)
 {
-#define N_EXPRIE_STEP 3
-#define N_EXPRIE_MIN 10
-#define N_EXPRIE_MAX 100
-    struct rule_ctc *rule, *next_rule;
-    struct oftable *table;
-    static int time = N_EXPRIE_MIN;
+    struct ctc_expiry_wheel *wheel = &ofproto->expiry;
+    long long int now = time_msec() / CTC_EXPIRY_TICK;
+    static int time = N_EXPIRE_MIN;
+
+    while (wheel->now < now) {
+        struct list *slot;
+        struct list rules;
+        int level;
+
+        wheel->now++;
+        for (level = 1; level < CTC_EXPIRY_LEVELS; level++) {
+            if (wheel->now & ((1LL << (level * CTC_EXPIRY_BITS)) - 1)) {
+                break;
+            }
+            expiry_wheel_cascade(ofproto, level);
+        }
 
-    /* Expire OpenFlow flows whose idle_timeout or hard_timeout has passed. */
-    OFPROTO_FOR_EACH_TABLE (table, &ofproto->up) {
-        struct cls_cursor cursor;
+        slot = &wheel->slots[0][wheel->now & (CTC_EXPIRY_SLOTS - 1)];
+        if (list_is_empty(slot)) {
+            continue;
+        }
 
-        cls_cursor_init(&cursor, &table->cls, NULL);
-        CLS_CURSOR_FOR_EACH_SAFE (rule, next_rule, up.cr, &cursor) {
-            rule_expire(rule);
+        /* ofproto_rule_expire() destroys the rule, so detach the slot first. */
+        list_init(&rules);
+        list_splice(&rules, slot->next, slot);
+        while (!list_is_empty(&rules)) {
+            struct list *node = list_pop_front(&rules);
+            struct rule_ctc *rule = CONTAINER_OF(node, struct rule_ctc,
+                                                 expiry_node);
+
+            list_init(node);
+            wheel->n_rules--;
+            rule_expire(ofproto, rule);
         }
     }
 
     if (ofproto->fast_expiration == TRUE) {
         ofproto->fast_expiration = FALSE;
-        time = N_EXPRIE_MIN;
+        time = N_EXPIRE_MIN;
     }
     else {
-        if (time < N_EXPRIE_MAX) {
-            time = time + N_EXPRIE_STEP;
+        if (time < N_EXPIRE_MAX) {
+            time = time + N_EXPIRE_STEP;
         }
     }
 
@@ -1098,9 +2056,12 @@ run(struct ofproto *ofproto_)
 {
     struct ofproto_ctc *ofproto = ofproto_ctc_cast(ofproto_);
 
+    rule_install_flush(ofproto);
+
     if (timer_expired(&ofproto->next_expiration)) {
         int delay = expire(ofproto);
         timer_set_duration(&ofproto->next_expiration, delay);
+        miss_cache_expire(ofproto);
     }
 
     handle_upcalls();
@@ -1110,7 +2071,26 @@ run(struct ofproto *ofproto_)
 static void
 wait__(struct ofproto *ofproto_ OVS_UNUSED)
 {
+    send_packet_flush();
+    if (g_cpuport_rx_ring.slots) {
+        if (g_cpuport_rx_ring.tail
+            != __atomic_load_n(&g_cpuport_rx_ring.head, __ATOMIC_ACQUIRE)) {
+            poll_immediate_wake();
+        }
+        poll_fd_wait(g_cpuport_rx_ring.wakeup_fds[0], POLLIN);
+    } else if (g_cpuport_fd > 0) {
+        poll_fd_wait(g_cpuport_fd, POLLIN);
+    }
     timer_wait(&ofproto->next_expiration);
+    if (!list_is_empty(&ofproto->pending_adds)) {
+        poll_immediate_wake();
+    }
+}
+
+static void
+flush(struct ofproto *ofproto_)
+{
+    rule_install_flush(ofproto_ctc_cast(ofproto_));
 }
 
 static void
@@ -1579,9 +2559,87 @@ rule_dealloc(struct rule *rule_)
     free(rule);
 }
 
+/* Completes the pending add of 'rule', 'error' is the adapter error code of
+ * its installation. */
+static void
+rule_install_complete(struct ofproto_ctc *ofproto, struct rule_ctc *rule,
+                      int error)
+{
+    struct rule_ctc *victim;
+
+    list_remove(&rule->pending_node);
+    ofproto->n_pending_adds--;
+
+    /* The translated actions is not longer used, free it. */
+    ofp_destroy_flow_actions(&rule->flow_actions);
+
+    if (error) {
+        /* ofproto core restores the victim and frees the rule. */
+        ofoperation_complete(rule->up.pending,
+                             translate_adpt_error_code(error, OFP_TYPE_FLOW));
+        return;
+    }
+
+    /* Same-key-different action. */
+    victim = rule_ctc_cast(ofoperation_get_victim(rule->up.pending));
+    if (victim) {
+        if (ofp_del_flow(victim)) {
+            VLOG_ERR("Remove flow entry failed");
+        }
+    }
+
+    rule_expiry_arm(ofproto, rule);
+
+    ofoperation_complete(rule->up.pending, 0);
+}
+
+/* Installs the rules queued by rule_construct() since the last call as one
+ * transaction, so that the adapter sorts them by priority and makes room for
+ * all of them in the TCAM at once.  If the transaction fails nothing of it is
+ * left in hardware, and the rules are installed one by one so that every
+ * flow_mod gets its own error. */
+static void
+rule_install_flush(struct ofproto_ctc *ofproto)
+{
+    struct rule_ctc **rules;
+    struct rule_ctc *rule;
+    bool batched = false;
+    size_t n = 0;
+    size_t i;
+
+    if (list_is_empty(&ofproto->pending_adds)) {
+        return;
+    }
+
+    rules = xmalloc(ofproto->n_pending_adds * sizeof *rules);
+    LIST_FOR_EACH (rule, pending_node, &ofproto->pending_adds) {
+        rules[n++] = rule;
+    }
+
+    if (n > 1) {
+        batched = !ofp_add_flows(rules, n);
+        if (batched) {
+            ofproto->n_add_batches++;
+            ofproto->max_add_batch = MAX(ofproto->max_add_batch, n);
+        } else {
+            ofproto->n_add_fallbacks++;
+            VLOG_WARN_RL(&rl, "installing %zu flows at once failed, "
+                         "installing them one by one", n);
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        rule_install_complete(ofproto, rules[i],
+                              batched ? 0 : ofp_add_flow(rules[i]));
+    }
+
+    free(rules);
+}
+
 static enum ofperr
 rule_construct(struct rule *rule_)
 {
+    struct ofproto_ctc *ofproto = ofproto_ctc_cast(rule_->ofproto);
     struct rule_ctc *rule = rule_ctc_cast(rule_);
     struct rule_ctc *victim;
     enum ofperr ofp_error = 0;
@@ -1590,6 +2648,7 @@ rule_construct(struct rule *rule_)
     rule->packet_count = 0;
     rule->byte_count = 0;
     list_init(&rule->flow_actions);
+    list_init(&rule->expiry_node);
 
     victim = rule_ctc_cast(ofoperation_get_victim(rule->up.pending));
 
@@ -1613,23 +2672,10 @@ rule_construct(struct rule *rule_)
         goto err1;
     }
 
-    /* XXX: translate error. */
-    error = ofp_add_flow(rule);
-    if (error) {
-        goto err1;
-    }
-
-    /* Same-key-different action. */
-    if (victim) {
-        if (ofp_del_flow(victim)) {
-            VLOG_ERR("Remove flow entry failed");
-        }
-    }
-
-    /* The translated actions is not longer used, free it. */
-    ofp_destroy_flow_actions(&rule->flow_actions);
-
-    ofoperation_complete(rule_->pending, 0);
+    /* The rule is installed and its operation completed by run(), together
+     * with the other rules added in this main loop iteration. */
+    list_push_back(&ofproto->pending_adds, &rule->pending_node);
+    ofproto->n_pending_adds++;
 
     return 0;
 
@@ -1655,6 +2701,8 @@ rule_destruct(struct rule *rule_)
     struct rule_ctc *rule = rule_ctc_cast(rule_);
     int error = 0;
 
+    expiry_wheel_remove(&ofproto_ctc_cast(rule_->ofproto)->expiry, rule);
+
     error = ofp_del_flow(rule);
     if (error) {
         if (OFP_ERR_INVALID_IN_PORT_NUMBER == error) {
@@ -2133,41 +3181,113 @@ flow_from_nlattrs(const struct nlattr *key, uint32_t key_len,
     return 0;
 }
 
+/* Sends 'packet' on the CPU port with one write().  Errors are logged and the
+ * packet is dropped and counted, as the kernel does not queue for AF_PACKET
+ * anyway. */
 static void
-send_packet_to_chip(struct ofproto_ctc *ofproto, struct ofpbuf *packet)
+send_packet_to_chip__(const struct ofpbuf *packet)
 {
-    int retval;
-
-    if (g_cpuport_fd <= 0) {
-        ofproto_netdev_port_init();
-    }
-
-    if (g_cpuport_fd <= 0) {
-        return;
-    }
+    ssize_t retval;
 
-    ofproto = ofproto; /* TODO unused parameter */
+    do {
+        retval = write(g_cpuport_fd, packet->data, packet->size);
+    } while (retval < 0 && errno == EINTR);
 
-    retval = write(g_cpuport_fd, packet->data, packet->size);
     if (retval < 0) {
         /* The Linux AF_PACKET implementation never blocks waiting for room
-         * for packets, instead returning ENOBUFS.  Translate this into
-         * EAGAIN for the caller. */
-        if (errno == ENOBUFS) {
-            return;
-        } else if (errno == EINTR) {
-            return;
-        } else if (errno != EAGAIN) {
+         * for packets, instead returning ENOBUFS. */
+        if (errno != ENOBUFS && errno != EAGAIN) {
             VLOG_WARN("error sending Ethernet packet: %s", strerror(errno));
         }
-        return;
+        g_cpuport_tx_dropped++;
     } else if (retval != packet->size) {
         VLOG_WARN("sent partial Ethernet packet (%zd bytes of "
                      "%zu)", retval, packet->size);
+    }
+}
+
+/* Transmits all packets queued by send_packet_to_chip() with as few
+ * sendmmsg() calls as possible, then releases them.  When sendmmsg() fails
+ * part way, the packets it did not send are retried one write() each, so a
+ * full socket buffer drops only the packets that still do not fit. */
+static void
+send_packet_flush(void)
+{
+    struct mmsghdr msgs[FLOW_MISS_MAX_BATCH];
+    struct iovec iovs[FLOW_MISS_MAX_BATCH];
+    int n_sent;
+    int i;
+
+    if (!g_cpuport_tx_n) {
         return;
-    } else {
+    }
+
+    n_sent = 0;
+    if (!g_cpuport_no_sendmmsg) {
+        memset(msgs, 0, g_cpuport_tx_n * sizeof msgs[0]);
+        for (i = 0; i < g_cpuport_tx_n; i++) {
+            iovs[i].iov_base = g_cpuport_tx_bufs[i].data;
+            iovs[i].iov_len = g_cpuport_tx_bufs[i].size;
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        while (n_sent < g_cpuport_tx_n) {
+            int retval = sendmmsg(g_cpuport_fd, &msgs[n_sent],
+                                  g_cpuport_tx_n - n_sent, 0);
+            if (retval < 0) {
+                if (errno == EINTR) {
+                    continue;
+                } else if (errno == ENOSYS) {
+                    VLOG_INFO("sendmmsg() not supported, send one packet at "
+                              "a time on %s", NETDEV_CPU_PORT);
+                    g_cpuport_no_sendmmsg = true;
+                }
+                break;
+            }
+            n_sent += retval;
+        }
+
+        for (i = 0; i < n_sent; i++) {
+            if (msgs[i].msg_len != iovs[i].iov_len) {
+                VLOG_WARN("sent partial Ethernet packet (%u bytes of %zu)",
+                          msgs[i].msg_len, iovs[i].iov_len);
+            }
+        }
+    }
+
+    for (i = n_sent; i < g_cpuport_tx_n; i++) {
+        send_packet_to_chip__(&g_cpuport_tx_bufs[i]);
+    }
+
+    for (i = 0; i < g_cpuport_tx_n; i++) {
+        ofpbuf_uninit(&g_cpuport_tx_bufs[i]);
+    }
+    g_cpuport_tx_n = 0;
+}
+
+/* Queues 'packet' for transmission on the CPU port and takes ownership of its
+ * data.  Queued packets go out when the batch is full or at the latest from
+ * wait__(), so every packet-out and flood handled within one main loop
+ * iteration costs a single syscall. */
+static void
+send_packet_to_chip(struct ofproto_ctc *ofproto, struct ofpbuf *packet)
+{
+    if (g_cpuport_fd <= 0) {
+        ofproto_netdev_port_init();
+    }
+
+    if (g_cpuport_fd <= 0) {
+        ofpbuf_uninit(packet);
         return;
     }
+
+    ofproto = ofproto; /* TODO unused parameter */
+
+    g_cpuport_tx_bufs[g_cpuport_tx_n++] = *packet;
+    if (g_cpuport_tx_n >= FLOW_MISS_MAX_BATCH) {
+        send_packet_flush();
+    }
 }
 
 static void
@@ -2379,13 +3499,18 @@ execute_actions(struct ofproto_ctc *ofproto,
     NL_ATTR_FOR_EACH_UNSAFE (a, left, actions, actions_len) {
         const struct ovs_action_push_vlan *vlan;
         const struct ovs_action_group *group;
+        struct ofpbuf *hw_packet;
         int type = nl_attr_type(a);
         switch ((enum ovs_action_attr) type) {
         case OVS_ACTION_ATTR_OUTPUT:
+            /* The last action may give 'packet' itself to the chip, the
+             * headers then go into its headroom instead of a copy. */
+            hw_packet = left <= NLA_ALIGN(a->nla_len)
+                        ? packet : &hardware_process_packet;
             ofp_actions.type = htons(OFPAT10_OUTPUT);
             ofp_actions.output10.port = htons(nl_attr_get_u32(a));
             cpu_process_status = ofp_send_packet_out(packet, key,
-                                                &ofp_actions, 1, &hardware_process_packet, priority);
+                                                &ofp_actions, 1, hw_packet, priority);
             if (OFP_CPU_PROCESS_DISCARD == cpu_process_status)
             {
                 /* Do nothing, ignore silently. */
@@ -2396,8 +3521,11 @@ execute_actions(struct ofproto_ctc *ofproto,
             }
             else if (OFP_CPU_PROCESS_DISABLE == cpu_process_status)
             {
-                send_packet_to_chip(ofproto, &hardware_process_packet);
-                ofpbuf_uninit(&hardware_process_packet);
+                send_packet_to_chip(ofproto, hw_packet);
+                if (hw_packet == packet) {
+                    /* The tx queue owns the data now. */
+                    ofpbuf_use(packet, NULL, 0);
+                }
             }
             break;
 
@@ -2406,7 +3534,6 @@ execute_actions(struct ofproto_ctc *ofproto,
             if (OFP_ERR_SUCCESS == ofp_send_packet_group(packet, key, ntohl(group->group_id), &hardware_process_packet))
             {
                 send_packet_to_chip(ofproto, &hardware_process_packet);
-                ofpbuf_uninit(&hardware_process_packet);
             }
             break;
 
@@ -2458,9 +3585,10 @@ execute(struct ofproto_ctc *ofproto,
         return EINVAL;
     }
 
-    /* Make a deep copy of 'packet', because we might modify its data. */
-    ofpbuf_init(&copy, CTC_NETDEV_HEADROOM + buf->size);
-    ofpbuf_reserve(&copy, CTC_NETDEV_HEADROOM);
+    /* Make a deep copy of 'packet', because we might modify its data.  The
+     * headroom also takes the cpu mac and bridge headers of a packet-out. */
+    ofpbuf_init(&copy, OFP_CPU_ENCAP_HDR_LEN + CTC_NETDEV_HEADROOM + buf->size);
+    ofpbuf_reserve(&copy, OFP_CPU_ENCAP_HDR_LEN + CTC_NETDEV_HEADROOM);
     ofpbuf_put(&copy, buf->data, buf->size);
 
     flow_extract(&copy, 0, 0, NULL, -1, &flow_key);
@@ -2901,7 +4029,7 @@ const static struct ofproto_class ofproto_ctc_class = {
     run_fast,
     wait__,
     NULL,                       /* get_memory_usage */
-    NULL,                       /* flush */
+    flush,
     get_features,
     get_capabilities,
     get_datapath_id,
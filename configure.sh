@@ -11,6 +11,7 @@ _V330_COMPILE_JOBS=1
 _V330_DEBUG=n
 _V330_VER=r
 _V330_OPEN_SOURCE=y
+_V330_CPUPORT_RX_THREAD=n
 _V330_TOP_PATH=`pwd`
 _V330_OUT_PATH=$_V330_TOP_PATH/out
 _V330_OVS_PACKAGE=$_V330_OUT_PATH/open_vswitch.tar.gz
@@ -30,6 +31,7 @@ Usage: $0 :
      -c prefix, specify crosscompile prefix(default is mips-linux-gnu-)
      -j number, specify compile speed
      -d , _V330_DEBUG version 
+     -t , receive CPU port packets on a dedicated thread
 EOF
 }
 
@@ -42,7 +44,7 @@ is_number()
     return 0
 }
 
-while getopts "p:c:j:d" opt; do
+while getopts "p:c:j:dt" opt; do
     case $opt in
         p ) _V330_TOOLCHAIN_PATH=$OPTARG ;;
     g ) _V330_GLIBC_REL_PATH=$OPTARG ;;
@@ -54,6 +56,7 @@ while getopts "p:c:j:d" opt; do
         fi
         ;;
     d ) _V330_DEBUG=y ;;
+    t ) _V330_CPUPORT_RX_THREAD=y ;;
     \? ) usage
         exit 1 ;;
     esac
@@ -89,6 +92,7 @@ export _V330_DEBUG=$_V330_DEBUG
 export _V330_COMPILE_JOBS=$_V330_COMPILE_JOBS
 export _V330_TOP_PATH=$_V330_TOP_PATH
 export _V330_OPEN_SOURCE=$_V330_OPEN_SOURCE
+export _V330_CPUPORT_RX_THREAD=$_V330_CPUPORT_RX_THREAD
 
 export _OVS_BIN_DIR=$_V330_OUT_PATH/build.octeon.$_V330_VER/bin.linux-board
 export _OVS_SRC_DIR=$_V330_TOP_PATH/ovs
@@ -17,6 +17,18 @@
 
 #include "afx.h"
 
+#if defined(__linux__) && !defined(AFX_NO_EPOLL)
+#define AFX_HAVE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+/* Events taken by one epoll_wait(), fds are level triggered so the rest
+ * are reported again on the next round */
+#define AFX_EPOLL_EVENTS    64
+
+/* Initial size of the timer heap */
+#define AFX_TIMER_HEAP_MIN  16
+
 struct afx_mio
 {
     int fd;
@@ -32,10 +44,10 @@ struct afx_timer
 {
     afx_timer_cb_t cb;
     void *arg;
-    struct timeval end;
+    uint64_t end;           /* monotonic time due, in usec */
     uint32_t timeout;
     int is_on;
-    afx_list_node_t node;
+    uint32_t heap_index;    /* slot in timer_heap while is_on */
 };
 
 struct func_arg
@@ -46,169 +58,304 @@ struct func_arg
 
 static int have_changed;
 static int exit_flag;
-static AFX_LIST_DEF(timer_list);
 static AFX_LIST_DEF(mio_list);
 static AFX_LIST_DEF(ready_mio_list);
 
-
 /*
- * Event Loop
+ * Running timers are kept in a binary min-heap on their due time. The heap
+ * is sized for every timer created, so starting and re-arming a timer
+ * never allocates.
  */
-int afx_event_loop_create()
+static afx_timer_t **timer_heap;
+static uint32_t timer_heap_len;
+static uint32_t timer_heap_size;
+static uint32_t timer_num;
+
+/* pollfd array of the poll() backend, rebuilt when have_changed is set */
+static struct pollfd *poll_ufds;
+static int poll_ufds_size;
+static int poll_nfds;
+
+#ifdef AFX_HAVE_EPOLL
+/* epoll backend, -1 when we run on poll() */
+static int epoll_fd = -1;
+static struct epoll_event epoll_events[AFX_EPOLL_EVENTS];
+#endif
+
+static uint64_t afx_get_cur_usec(void)
 {
-    return 0;
+    struct timeval now;
+
+    afx_get_cur_time(&now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_usec;
 }
 
-void afx_event_loop_destroy()
+static void afx_timer_heap_set(uint32_t index, afx_timer_t *p_timer)
 {
-    if (!afx_list_empty(&timer_list))
-        printf("memory leak !!!have not destroyed all timers before exit");
-    if (!afx_list_empty(&mio_list))
-        printf("memory leak!!!have not destroyed all mios before exit");
+    timer_heap[index] = p_timer;
+    p_timer->heap_index = index;
 }
 
-static int afx_timer_insert(afx_timer_t *p_timer)
+static void afx_timer_sift_up(uint32_t index)
 {
-    int ret;
-    afx_list_node_t* p_node;
-    afx_timer_t *timer;
+    afx_timer_t *p_timer = timer_heap[index];
+    uint32_t parent;
 
-    afx_list_for_each(p_node, &timer_list)
+    while (index)
     {
-        timer = afx_container_of(p_node, afx_timer_t, node);
-        ret = timer->end.tv_sec - p_timer->end.tv_sec;
-        if (!ret)
-            ret = timer->end.tv_usec - p_timer->end.tv_usec;
-        if (ret>0)
-        {
-            afx_list_insert_before(&timer_list, p_node, &p_timer->node);
+        parent = (index - 1) / 2;
+        if (timer_heap[parent]->end <= p_timer->end)
             break;
+        afx_timer_heap_set(index, timer_heap[parent]);
+        index = parent;
+    }
+    afx_timer_heap_set(index, p_timer);
+}
+
+static void afx_timer_sift_down(uint32_t index)
+{
+    afx_timer_t *p_timer = timer_heap[index];
+    uint32_t child;
+
+    while ((child = index * 2 + 1) < timer_heap_len)
+    {
+        if (child + 1 < timer_heap_len && timer_heap[child + 1]->end < timer_heap[child]->end)
+            child++;
+        if (p_timer->end <= timer_heap[child]->end)
+            break;
+        afx_timer_heap_set(index, timer_heap[child]);
+        index = child;
+    }
+    afx_timer_heap_set(index, p_timer);
+}
+
+static void afx_timer_insert(afx_timer_t *p_timer)
+{
+    afx_timer_heap_set(timer_heap_len, p_timer);
+    afx_timer_sift_up(timer_heap_len++);
+}
+
+static void afx_timer_remove(afx_timer_t *p_timer)
+{
+    uint32_t index = p_timer->heap_index;
+    afx_timer_t *p_last = timer_heap[--timer_heap_len];
+
+    if (p_last == p_timer)
+        return;
+    afx_timer_heap_set(index, p_last);
+    afx_timer_sift_up(index);
+    afx_timer_sift_down(p_last->heap_index);
+}
+
+static short afx_mio_events(afx_mio_t *p_mio)
+{
+    switch (p_mio->dir)
+    {
+        case AFX_IO_IN:
+            return POLLIN;
+        case AFX_IO_OUT:
+            return POLLOUT;
+        case AFX_IO_ANY:
+        default:
+            return POLLIN|POLLOUT;
+    }
+}
+
+static void afx_mio_set_ready(afx_mio_t *p_mio)
+{
+    afx_list_delete(&mio_list, &p_mio->node);
+    afx_list_insert_tail(&ready_mio_list, &p_mio->node);
+    p_mio->list = &ready_mio_list;
+}
+
+/* Callbacks may destroy any mio, a destroyed one just leaves ready_mio_list */
+static void afx_mio_dispatch(void)
+{
+    afx_list_node_t *p_node;
+    afx_mio_t *p_mio;
+
+    while (!afx_list_empty(&ready_mio_list)) {
+        p_node = afx_list_head(&ready_mio_list);
+        p_mio = afx_container_of(p_node, afx_mio_t, node);
+        afx_list_delete(&ready_mio_list, &p_mio->node);
+        afx_list_insert_tail(&mio_list, &p_mio->node);
+        p_mio->list = &mio_list;
+        (*p_mio->cb)(p_mio->fd, p_mio->dir, p_mio->arg);
+    }
+}
+
+#ifdef AFX_HAVE_EPOLL
+static int afx_mio_epoll_ctl(afx_mio_t *p_mio, int op)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events = (afx_mio_events(p_mio) & POLLIN ? EPOLLIN : 0)
+                 | (afx_mio_events(p_mio) & POLLOUT ? EPOLLOUT : 0);
+    event.data.ptr = p_mio;
+    return epoll_ctl(epoll_fd, op, p_mio->fd, &event);
+}
+
+/* Drop back to poll(), e.g. when two mios share one fd which epoll can not register twice */
+static void afx_event_loop_epoll_fallback(void)
+{
+    close(epoll_fd);
+    epoll_fd = -1;
+    have_changed = 1;
+}
+
+static void afx_event_loop_epoll(int timeout)
+{
+    afx_mio_t *p_mio;
+    int ret, i;
+
+    ret = epoll_wait(epoll_fd, epoll_events, AFX_EPOLL_EVENTS, timeout);
+    for (i = 0; i < ret; i++)
+    {
+        p_mio = (afx_mio_t *)epoll_events[i].data.ptr;
+        afx_mio_set_ready(p_mio);
+    }
+    afx_mio_dispatch();
+}
+#endif
+
+static int afx_event_loop_poll(int timeout)
+{
+    struct pollfd *p_ufds;
+    afx_list_node_t *p_node;
+    afx_list_node_t *p_next;
+    afx_mio_t *p_mio;
+    int nfds, ret;
+
+    if (have_changed)
+    {
+        have_changed = 0;
+        nfds = 0;
+        afx_list_for_each(p_node, &mio_list)
+            nfds++;
+        if (nfds > poll_ufds_size)
+        {
+            p_ufds = (struct pollfd*)realloc(poll_ufds, sizeof(struct pollfd)*nfds);
+            if (!p_ufds)
+               return -ENOMEM;
+            poll_ufds = p_ufds;
+            poll_ufds_size = nfds;
+        }
+        poll_nfds = nfds;
+        p_ufds = poll_ufds;
+        afx_list_for_each(p_node, &mio_list)
+        {
+            p_mio = afx_container_of(p_node, afx_mio_t, node);
+            p_mio->pollfd = p_ufds;
+            p_ufds->fd = p_mio->fd;
+            p_ufds->events = afx_mio_events(p_mio);
+            p_ufds++;
         }
     }
 
-    if (!p_node)
-        afx_list_insert_tail(&timer_list, &p_timer->node);
+    ret = poll(poll_ufds, poll_nfds, timeout);
+    if (ret <= 0)
+        return 0;
 
+    afx_list_for_each_safe(p_node, p_next, &mio_list) {
+        p_mio = afx_container_of(p_node, afx_mio_t, node);
+        p_ufds = p_mio->pollfd;
+        if ((p_ufds->events|POLLERR|POLLHUP) & p_ufds->revents)
+            afx_mio_set_ready(p_mio);
+    }
+    afx_mio_dispatch();
     return 0;
 }
 
-int afx_event_loop_run()
+/*
+ * Event Loop
+ */
+int afx_event_loop_create()
 {
-    struct timeval now;
-    struct pollfd *p1_ufds = NULL, *p2_ufds;
+#ifdef AFX_HAVE_EPOLL
     afx_list_node_t *p_node;
-    afx_list_node_t *p_next;
-    afx_timer_t *p_timer;
     afx_mio_t *p_mio;
-    int nfds=0, timeout, ret, delta_sec, delta_usec;
-    uint32_t sec, exp_sec, usec, exp_usec;
+
+    if (epoll_fd >= 0)
+        return 0;
+
+    /* without epoll we stay on poll() */
+    epoll_fd = epoll_create(AFX_EPOLL_EVENTS);
+    if (epoll_fd < 0)
+        return 0;
+
+    afx_list_for_each(p_node, &mio_list)
+    {
+        p_mio = afx_container_of(p_node, afx_mio_t, node);
+        if (afx_mio_epoll_ctl(p_mio, EPOLL_CTL_ADD))
+        {
+            afx_event_loop_epoll_fallback();
+            break;
+        }
+    }
+#endif
+    return 0;
+}
+
+void afx_event_loop_destroy()
+{
+    if (timer_heap_len)
+        printf("memory leak !!!have not destroyed all timers before exit");
+    if (!afx_list_empty(&mio_list))
+        printf("memory leak!!!have not destroyed all mios before exit");
+
+#ifdef AFX_HAVE_EPOLL
+    if (epoll_fd >= 0)
+    {
+        close(epoll_fd);
+        epoll_fd = -1;
+    }
+#endif
+    if (poll_ufds)
+    {
+        free(poll_ufds);
+        poll_ufds = NULL;
+    }
+    poll_ufds_size = 0;
+    poll_nfds = 0;
+    have_changed = 1;
+}
+
+int afx_event_loop_run()
+{
+    uint64_t now, delta;
+    afx_timer_t *p_timer;
+    int timeout;
 
     while (!exit_flag)
     {
         timeout = -1;
-        while (!afx_list_empty(&timer_list))
+        while (timer_heap_len)
         {
-            afx_get_cur_time(&now);
-            p_node = afx_list_head(&timer_list);
-            p_timer = afx_container_of(p_node, afx_timer_t, node);
-            ret = p_timer->end.tv_sec - now.tv_sec;
-            if (!ret)
-                ret = p_timer->end.tv_usec - now.tv_usec;
-            if (ret>0)
+            now = afx_get_cur_usec();
+            p_timer = timer_heap[0];
+            if (p_timer->end > now)
             {
-                delta_sec = p_timer->end.tv_sec - now.tv_sec;
-                delta_usec = p_timer->end.tv_usec - now.tv_usec;
-                if (delta_usec<0)
-                    timeout = delta_sec*1000 -1000 + (1000000+delta_usec)/1000;
-                else
-                    timeout = delta_sec*1000  + delta_usec/1000;
+                /* round up, waking up before the timer is due only spins */
+                delta = (p_timer->end - now + 999) / 1000;
+                timeout = delta > INT32_MAX ? INT32_MAX : (int)delta;
                 break;
             }
-            sec = p_timer->timeout/1000;
-            usec = (p_timer->timeout%1000)*1000;
-            exp_sec = p_timer->end.tv_sec + sec;
-            exp_usec = p_timer->end.tv_usec + usec;
-            if (exp_usec>=1000000)
-            {
-                exp_usec-=1000000;
-                exp_sec++;
-            }
-            p_timer->end.tv_sec = exp_sec;
-            p_timer->end.tv_usec = exp_usec;
-            afx_list_delete(&timer_list, p_node);
-            afx_timer_insert(p_timer);
+            /* re-arm before the callback, which may stop or destroy the timer */
+            p_timer->end += (uint64_t)p_timer->timeout * 1000;
+            afx_timer_sift_down(0);
             (*p_timer->cb)(p_timer->arg);
         }
 
-        if (have_changed)
+#ifdef AFX_HAVE_EPOLL
+        if (epoll_fd >= 0)
         {
-            nfds = 0;
-            have_changed = 0;
-            afx_list_for_each(p_node, &mio_list)
-                nfds++;
-            if (p1_ufds)
-            {
-                free(p1_ufds);
-                p1_ufds = NULL;
-            }
-            p1_ufds = (struct pollfd*)malloc(sizeof(struct pollfd)*nfds);
-            if (!p1_ufds)
-               return -ENOMEM;
-            p2_ufds = p1_ufds;
-            afx_list_for_each(p_node, &mio_list)
-            {
-                p_mio = afx_container_of(p_node, afx_mio_t, node);
-                p_mio->pollfd = p2_ufds;
-                p2_ufds->fd = p_mio->fd;
-                switch (p_mio->dir)
-                {
-                    case AFX_IO_IN:
-                        p2_ufds->events = POLLIN;
-                        break;
-                    case AFX_IO_OUT:
-                        p2_ufds->events = POLLOUT;
-                        break;
-                    case AFX_IO_ANY:
-                        p2_ufds->events = POLLIN|POLLOUT;
-                        break;
-                }
-                p2_ufds++;
-            }
-        }
-
-        ret = poll(p1_ufds, nfds, timeout);
-        switch (ret)
-        {
-            case -1:
-                break;
-            case 0:
-                break;
-            default:
-                afx_list_for_each_safe(p_node, p_next, &mio_list) {
-                    p_mio = afx_container_of(p_node, afx_mio_t, node);
-                    p2_ufds = p_mio->pollfd;
-                    if ((p2_ufds->events|POLLERR|POLLHUP) & p2_ufds->revents) {
-                        afx_list_delete(&mio_list, &p_mio->node);
-                        afx_list_insert_tail(&ready_mio_list, &p_mio->node);
-                        p_mio->list = &ready_mio_list;
-                    }
-                }
-
-                while (!afx_list_empty(&ready_mio_list)) {
-                    p_node = afx_list_head(&ready_mio_list);
-                    p_mio = afx_container_of(p_node, afx_mio_t, node);
-                    afx_list_delete(&ready_mio_list, &p_mio->node);
-                    afx_list_insert_tail(&mio_list, &p_mio->node);
-                    p_mio->list = &mio_list;
-                    (*p_mio->cb)(p_mio->fd, p_mio->dir, p_mio->arg);
-                }
-                break;
+            afx_event_loop_epoll(timeout);
+            continue;
         }
-    }
-    if (p1_ufds)
-    {
-        free(p1_ufds);
-        p1_ufds = NULL;
+#endif
+        if (afx_event_loop_poll(timeout))
+            return -ENOMEM;
     }
     exit_flag = 0;
     return 0;
@@ -243,11 +390,20 @@ afx_mio_create(afx_mio_t **pp_mio,
     p_mio->pollfd = NULL;
     afx_list_insert_tail(&mio_list, &p_mio->node);
     have_changed = 1;
+#ifdef AFX_HAVE_EPOLL
+    if (epoll_fd >= 0 && afx_mio_epoll_ctl(p_mio, EPOLL_CTL_ADD))
+        afx_event_loop_epoll_fallback();
+#endif
     return 0;
 }
 
 void afx_mio_destroy(afx_mio_t *p_mio)
 {
+#ifdef AFX_HAVE_EPOLL
+    /* fails harmlessly if the fd is already closed */
+    if (epoll_fd >= 0)
+        afx_mio_epoll_ctl(p_mio, EPOLL_CTL_DEL);
+#endif
     afx_list_delete(p_mio->list, &p_mio->node);
     free(p_mio);
     have_changed = 1;
@@ -281,10 +437,25 @@ afx_timer_create(afx_timer_t **pp_timer,
                  void *arg)
 {
     afx_timer_t *p_timer;
+    afx_timer_t **p_heap;
+    uint32_t size;
 
     p_timer = malloc(sizeof(afx_timer_t));
     if (!p_timer)
         return -ENOMEM;
+    if (timer_num == timer_heap_size)
+    {
+        size = timer_heap_size ? timer_heap_size * 2 : AFX_TIMER_HEAP_MIN;
+        p_heap = realloc(timer_heap, sizeof(afx_timer_t *) * size);
+        if (!p_heap)
+        {
+            free(p_timer);
+            return -ENOMEM;
+        }
+        timer_heap = p_heap;
+        timer_heap_size = size;
+    }
+    timer_num++;
     p_timer->cb = cb;
     p_timer->arg = arg;
     p_timer->is_on = 0;
@@ -296,28 +467,20 @@ int afx_timer_destroy(afx_timer_t *p_timer)
 {
     afx_timer_stop(p_timer);
     free(p_timer);
+    if (!--timer_num)
+    {
+        free(timer_heap);
+        timer_heap = NULL;
+        timer_heap_size = 0;
+    }
     return 0;
 }
 
 int afx_timer_start(afx_timer_t *p_timer, uint32_t timeout)
 {
-    struct timeval now;
-    uint32_t sec, exp_sec, usec, exp_usec;
-
     if (p_timer->is_on)
         return -1;
-    afx_get_cur_time(&now);
-    sec = timeout/1000;
-    usec = (timeout%1000)*1000;
-    exp_sec = now.tv_sec + sec;
-    exp_usec = now.tv_usec + usec;
-    if (exp_usec>=1000000)
-    {
-        exp_usec-=1000000;
-        exp_sec++;
-    }
-    p_timer->end.tv_sec = exp_sec;
-    p_timer->end.tv_usec = exp_usec;
+    p_timer->end = afx_get_cur_usec() + (uint64_t)timeout * 1000;
     p_timer->timeout = timeout;
     afx_timer_insert(p_timer);
     p_timer->is_on = 1;
@@ -328,7 +491,7 @@ int afx_timer_stop(afx_timer_t *p_timer)
 {
     if (!p_timer->is_on)
     	return -1;
-    afx_list_delete(&timer_list, &p_timer->node);
+    afx_timer_remove(p_timer);
     p_timer->is_on = 0;
     return 0;
 }
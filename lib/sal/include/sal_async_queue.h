@@ -30,6 +30,22 @@
 /** Async Queue Object */
 typedef struct sal_async_queue sal_async_queue_t;
 
+/** Async Queue Implementations */
+enum sal_async_queue_type
+{
+    SAL_ASYNC_QUEUE_LIST,   /**< linked list under a mutex, a node is allocated per put */
+    SAL_ASYNC_QUEUE_RING,   /**< lock-free bounded ring, the length is rounded up to a power of 2 */
+};
+typedef enum sal_async_queue_type sal_async_queue_type_t;
+
+/** Async Queue Counters */
+struct sal_async_queue_stats
+{
+    uint32_t overflow;      /**< puts dropped because the queue was full */
+    uint32_t nomem;         /**< puts dropped because no node could be allocated */
+};
+typedef struct sal_async_queue_stats sal_async_queue_stats_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -45,6 +61,18 @@ extern "C"
  */
 sal_err_t sal_async_queue_create(sal_async_queue_t **p_async_queue, uint32_t max_queue_len);
 
+/**
+ * Create an async queue of the given implementation
+ *
+ * @param[out] p_async_queue
+ * @param[in]  max_queue_len
+ * @param[in]  type
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_create_ex(sal_async_queue_t **p_async_queue, uint32_t max_queue_len,
+    sal_async_queue_type_t type);
+
 /**
  * Destroy async queue
  *
@@ -62,6 +90,19 @@ void sal_async_queue_destroy(sal_async_queue_t *async_queue);
  */
 sal_err_t sal_async_queue_put(sal_async_queue_t *async_queue, void *data);
 
+/**
+ * Send a batch of data, stops at the first one that does not fit
+ *
+ * @param[in]  async_queue
+ * @param[in]  data
+ * @param[in]  count
+ * @param[out] p_count      number of data sent
+ *
+ * @return ERANGE if not all data was sent
+ */
+sal_err_t sal_async_queue_put_batch(sal_async_queue_t *async_queue, void **data, uint32_t count,
+    uint32_t *p_count);
+
 /**
  * Receive data
  *
@@ -73,6 +114,20 @@ sal_err_t sal_async_queue_put(sal_async_queue_t *async_queue, void *data);
  */
 sal_err_t sal_async_queue_get(sal_async_queue_t *async_queue, int timeout, void **pdata);
 
+/**
+ * Receive a batch of data, waits only while the queue is empty
+ *
+ * @param[in]  async_queue
+ * @param[in]  timeout
+ * @param[out] pdata
+ * @param[in]  count        size of pdata
+ * @param[out] p_count      number of data received
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_get_batch(sal_async_queue_t *async_queue, int timeout, void **pdata,
+    uint32_t count, uint32_t *p_count);
+
 /**
  * Get data length
  *
@@ -85,6 +140,17 @@ sal_err_t sal_async_queue_get(sal_async_queue_t *async_queue, int timeout, void
 sal_err_t sal_async_queue_get_count(sal_async_queue_t *async_queue,
     uint32_t *p_current, uint32_t *p_max);
 
+/**
+ * Get the counters of dropped data
+ *
+ * @param[in]  async_queue
+ * @param[out] p_stats
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_get_stats(sal_async_queue_t *async_queue,
+    sal_async_queue_stats_t *p_stats);
+
 #ifdef __cplusplus
 }
 #endif
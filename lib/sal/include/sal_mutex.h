@@ -32,6 +32,9 @@ typedef struct sal_mutex sal_mutex_t;
 
 typedef struct sal_cond sal_cond_t;
 
+/** Read/write lock Object */
+typedef struct sal_rwlock sal_rwlock_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -104,6 +107,61 @@ void sal_task_cond_signal(sal_cond_t* p_cond);
  */
 void sal_task_cond_wait(sal_mutex_t* p_mutex, sal_cond_t* p_cond);
 
+/**
+ * Create a new read/write lock, a waiting writer blocks new readers
+ *
+ * @param[out] prwlock
+ *
+ * @return
+ */
+sal_err_t sal_rwlock_create(sal_rwlock_t **prwlock);
+
+/**
+ * Destroy the read/write lock
+ *
+ * @param[in] rwlock
+ */
+void sal_rwlock_destroy(sal_rwlock_t *rwlock);
+
+/**
+ * Lock the read/write lock shared
+ *
+ * @param[in] rwlock
+ */
+void sal_rwlock_rdlock(sal_rwlock_t *rwlock);
+
+/**
+ * Lock the read/write lock exclusive
+ *
+ * @param[in] rwlock
+ */
+void sal_rwlock_wrlock(sal_rwlock_t *rwlock);
+
+/**
+ * Try to lock the read/write lock shared
+ *
+ * @param[in] rwlock
+ *
+ * @return
+ */
+bool sal_rwlock_try_rdlock(sal_rwlock_t *rwlock);
+
+/**
+ * Try to lock the read/write lock exclusive
+ *
+ * @param[in] rwlock
+ *
+ * @return
+ */
+bool sal_rwlock_try_wrlock(sal_rwlock_t *rwlock);
+
+/**
+ * Unlock the read/write lock
+ *
+ * @param[in] rwlock
+ */
+void sal_rwlock_unlock(sal_rwlock_t *rwlock);
+
 #ifdef __cplusplus
 }
 #endif
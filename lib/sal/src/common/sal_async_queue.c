@@ -16,15 +16,14 @@
  */
 
 #include "sal.h"
+#ifdef _SAL_LINUX_UM
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+/* Keeps the producer and consumer indexes of a ring on their own cache lines */
+#define SAL_ASYNC_QUEUE_CACHE_LINE  128
 
-/**
- * Create an async queue
- *
- * @param p_async_queue
- * @param max_queue_len
- *
- * @return
- */
  struct queue_member
 {
     struct queue_member *next;
@@ -32,30 +31,377 @@
 };
 typedef struct queue_member queue_member_t;
 
+/*
+ * A ring cell is free for the producer at position pos when seq == pos, and
+ * holds data for the consumer at position pos when seq == pos + 1 (Vyukov's
+ * bounded MPMC queue). Positions are free running 32 bit counters.
+ */
+struct queue_cell
+{
+    uint32_t seq;
+    void *data;
+};
+typedef struct queue_cell queue_cell_t;
+
 struct sal_async_queue
 {
+    sal_async_queue_type_t type;
+    sal_async_queue_stats_t stats;
+
+    /* SAL_ASYNC_QUEUE_LIST */
     sal_event_t  *event;
     queue_member_t *head;
     queue_member_t *tail;
     uint32_t current_length;
     uint32_t max_length;
+
+    /* SAL_ASYNC_QUEUE_RING */
+    queue_cell_t *cells;
+    uint32_t mask;
+    char pad0[SAL_ASYNC_QUEUE_CACHE_LINE];
+    uint32_t enqueue_pos;
+    char pad1[SAL_ASYNC_QUEUE_CACHE_LINE];
+    uint32_t dequeue_pos;
+    uint32_t sleeping;          /* set when consumers may sleep on wake_seq */
+    uint32_t wake_seq;          /* futex word, bumped to wake the sleeping consumers */
+    char pad2[SAL_ASYNC_QUEUE_CACHE_LINE];
 };
 
 sal_mutex_t* p_sal_async_queue_mutex=NULL;
 
+#ifdef _SAL_LINUX_UM
+static inline void
+_sal_futex_wait(uint32_t *addr, uint32_t val, struct timespec *ts)
+{
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, ts, NULL, 0);
+}
+
+static inline void
+_sal_futex_wake(uint32_t *addr, uint32_t count)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+#else
+static inline void
+_sal_futex_wait(uint32_t *addr, uint32_t val, struct timespec *ts)
+{
+    sal_task_sleep(1);
+}
+
+static inline void
+_sal_futex_wake(uint32_t *addr, uint32_t count)
+{
+}
+#endif
+
+static inline uint64
+_sal_async_queue_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static bool
+_sal_ring_enqueue(sal_async_queue_t *async_queue, void *data)
+{
+    queue_cell_t *cell;
+    uint32_t pos;
+    int32_t dif;
+
+    pos = __atomic_load_n(&async_queue->enqueue_pos, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        cell = &async_queue->cells[pos & async_queue->mask];
+        dif = (int32_t)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - pos);
+        if (dif == 0)
+        {
+            /* on failure pos is reloaded with the current enqueue_pos */
+            if (__atomic_compare_exchange_n(&async_queue->enqueue_pos, &pos, pos + 1, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        }
+        else if (dif < 0)
+            return FALSE;
+        else
+            pos = __atomic_load_n(&async_queue->enqueue_pos, __ATOMIC_RELAXED);
+    }
+
+    cell->data = data;
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+    return TRUE;
+}
+
+static bool
+_sal_ring_dequeue(sal_async_queue_t *async_queue, void **pdata)
+{
+    queue_cell_t *cell;
+    uint32_t pos;
+    int32_t dif;
+
+    pos = __atomic_load_n(&async_queue->dequeue_pos, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        cell = &async_queue->cells[pos & async_queue->mask];
+        dif = (int32_t)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - (pos + 1));
+        if (dif == 0)
+        {
+            if (__atomic_compare_exchange_n(&async_queue->dequeue_pos, &pos, pos + 1, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        }
+        else if (dif < 0)
+            return FALSE;
+        else
+            pos = __atomic_load_n(&async_queue->dequeue_pos, __ATOMIC_RELAXED);
+    }
+
+    *pdata = cell->data;
+    __atomic_store_n(&cell->seq, pos + async_queue->mask + 1, __ATOMIC_RELEASE);
+    return TRUE;
+}
+
+/*
+ * A consumer sets sleeping before its last look at the ring, a producer
+ * looks at sleeping after publishing; with both sides fenced one of them
+ * sees the other, so no wakeup is lost. The first producer to see the flag
+ * clears it and wakes every sleeper, later ones skip the syscall.
+ */
+static void
+_sal_ring_wake(sal_async_queue_t *async_queue)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&async_queue->sleeping, __ATOMIC_RELAXED)
+        && __atomic_exchange_n(&async_queue->sleeping, 0, __ATOMIC_SEQ_CST))
+    {
+        __atomic_add_fetch(&async_queue->wake_seq, 1, __ATOMIC_SEQ_CST);
+        _sal_futex_wake(&async_queue->wake_seq, INT32_MAX);
+    }
+}
+
+static sal_err_t
+_sal_ring_put(sal_async_queue_t *async_queue, void **data, uint32_t count, uint32_t *p_count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (!_sal_ring_enqueue(async_queue, data[i]))
+            break;
+    }
+    *p_count = i;
+
+    if (i)
+        _sal_ring_wake(async_queue);
+    if (i < count)
+    {
+        __atomic_add_fetch(&async_queue->stats.overflow, count - i, __ATOMIC_RELAXED);
+        return ERANGE;
+    }
+    return 0;
+}
+
+static sal_err_t
+_sal_ring_get(sal_async_queue_t *async_queue, int timeout, void **pdata, uint32_t count,
+    uint32_t *p_count)
+{
+    struct timespec ts;
+    uint64 deadline = 0;
+    uint64 now;
+    uint32_t seq;
+    uint32_t i = 0;
+
+    if (timeout > 0)
+        deadline = _sal_async_queue_now() + (uint64)timeout * 1000000;
+
+    for (;;)
+    {
+        while (i < count && _sal_ring_dequeue(async_queue, &pdata[i]))
+            i++;
+        if (i || !timeout)
+            break;
+
+        seq = __atomic_load_n(&async_queue->wake_seq, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&async_queue->sleeping, 1, __ATOMIC_SEQ_CST);
+        if (_sal_ring_dequeue(async_queue, &pdata[i]))
+        {
+            i++;
+        }
+        else if (timeout < 0)
+        {
+            _sal_futex_wait(&async_queue->wake_seq, seq, NULL);
+        }
+        else
+        {
+            now = _sal_async_queue_now();
+            if (now < deadline)
+            {
+                ts.tv_sec = (deadline - now) / 1000000000ULL;
+                ts.tv_nsec = (deadline - now) % 1000000000ULL;
+                _sal_futex_wait(&async_queue->wake_seq, seq, &ts);
+            }
+            else
+                timeout = 0;
+        }
+    }
+
+    *p_count = i;
+    return i ? 0 : ETIMEDOUT;
+}
+
+static sal_err_t
+_sal_list_put(sal_async_queue_t *async_queue, void **data, uint32_t count, uint32_t *p_count)
+{
+    queue_member_t* new_member;
+    sal_iflags_t iflag;
+    sal_err_t ret = 0;
+    uint32_t i;
+
+    iflag = sal_hwi_lock();
+    for (i = 0; i < count; i++)
+    {
+        if(async_queue->current_length>=async_queue->max_length)
+        {
+            async_queue->stats.overflow += count - i;
+            ret = ERANGE;
+            break;
+        }
+        SAL_MALLOC_ATOMIC(new_member, queue_member_t*, sizeof(queue_member_t));
+        if(new_member==NULL)
+        {
+            async_queue->stats.nomem += count - i;
+            ret = ENOMEM;
+            break;
+        }
+        new_member->data = data[i];
+        new_member->next = NULL;
+        if(async_queue->current_length==0)
+        {
+            async_queue->tail = async_queue->head = new_member;
+        }
+        else
+        {
+            async_queue->tail->next = new_member;
+            async_queue->tail = new_member;
+        }
+        async_queue->current_length++;
+    }
+    if (i)
+        sal_event_set(async_queue->event);
+    sal_hwi_unlock(iflag);
+
+    *p_count = i;
+    return ret;
+}
+
+static sal_err_t
+_sal_list_get(sal_async_queue_t *async_queue, int timeout, void **pdata, uint32_t count,
+    uint32_t *p_count)
+{
+    sal_iflags_t iflag;
+    queue_member_t* deleted_member;
+    uint32_t i = 0;
+
+    iflag = sal_hwi_lock();
+    /* another consumer may have taken the data we were woken up for */
+    while(async_queue->current_length==0)
+    {
+        sal_event_reset(async_queue->event);
+        sal_hwi_unlock(iflag);
+        if(!sal_event_wait(async_queue->event, timeout))
+        {
+            *p_count = 0;
+            return ETIMEDOUT;
+        }
+        iflag = sal_hwi_lock();
+    }
+
+    while (i < count && async_queue->current_length)
+    {
+        deleted_member = async_queue->head;
+        if(async_queue->current_length>1)
+            async_queue->head = async_queue->head->next;
+        else
+            async_queue->head = async_queue->tail = NULL;
+        pdata[i++] = deleted_member->data;
+        SAL_FREE(deleted_member);
+        async_queue->current_length--;
+    }
+    sal_hwi_unlock(iflag);
+
+    *p_count = i;
+    return 0;
+}
+
+/**
+ * Create an async queue
+ *
+ * @param p_async_queue
+ * @param max_queue_len
+ *
+ * @return
+ */
 sal_err_t sal_async_queue_create(sal_async_queue_t **p_async_queue,
                                                                     uint32_t max_queue_len)
+{
+    return sal_async_queue_create_ex(p_async_queue, max_queue_len, SAL_ASYNC_QUEUE_LIST);
+}
+
+/**
+ * Create an async queue of the given implementation
+ *
+ * @param p_async_queue
+ * @param max_queue_len
+ * @param type
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_create_ex(sal_async_queue_t **p_async_queue, uint32_t max_queue_len,
+    sal_async_queue_type_t type)
 {
     sal_async_queue_t *new_queue;
+    uint32_t size;
+    uint32_t i;
     int ret;
+
+    if (type == SAL_ASYNC_QUEUE_RING && (max_queue_len == 0 || max_queue_len > 0x40000000))
+        return EINVAL;
+
     SAL_MALLOC(new_queue, sal_async_queue_t*, sizeof(sal_async_queue_t));
     if(new_queue==NULL)
         return ENOMEM;
+    sal_memset(new_queue, 0, sizeof(sal_async_queue_t));
+    new_queue->type = type;
+
+    if (type == SAL_ASYNC_QUEUE_RING)
+    {
+        for (size = 1; size < max_queue_len; size <<= 1)
+            ;
+        SAL_MALLOC(new_queue->cells, queue_cell_t*, size * sizeof(queue_cell_t));
+        if (new_queue->cells == NULL)
+        {
+            SAL_FREE(new_queue);
+            return ENOMEM;
+        }
+        for (i = 0; i < size; i++)
+        {
+            new_queue->cells[i].seq = i;
+            new_queue->cells[i].data = NULL;
+        }
+        new_queue->mask = size - 1;
+        *p_async_queue = new_queue;
+        return 0;
+    }
+
     if(NULL == p_sal_async_queue_mutex)
     {
         ret = sal_mutex_create(&p_sal_async_queue_mutex);
-        if(ret < 0)
+        if(ret != 0)
+        {
+            SAL_FREE(new_queue);
             return ENOMEM;
+        }
     }
     sal_event_create(&(new_queue->event), TRUE);
     new_queue->current_length = 0;
@@ -73,6 +419,22 @@ sal_err_t sal_async_queue_create(sal_async_queue_t **p_async_queue,
 void sal_async_queue_destroy(sal_async_queue_t *async_queue)
 {
     sal_iflags_t iflag;
+    uint32_t current, max;
+
+    if (async_queue->type == SAL_ASYNC_QUEUE_RING)
+    {
+        sal_async_queue_get_count(async_queue, &current, &max);
+        if (current != 0)
+            SAL_LOG_INFO("couldn't destroy the queue because it isn't empty");
+        else
+        {
+            SAL_FREE(async_queue->cells);
+            SAL_FREE(async_queue);
+        }
+        return;
+    }
+
+    /* p_sal_async_queue_mutex is shared by all list queues and stays */
     iflag = sal_hwi_lock();
     if(async_queue->current_length!=0)
         SAL_LOG_INFO("couldn't destroy the queue because it isn't empty");
@@ -82,11 +444,6 @@ void sal_async_queue_destroy(sal_async_queue_t *async_queue)
         SAL_FREE(async_queue);
     }
     sal_hwi_unlock(iflag);
-    if(NULL != p_sal_async_queue_mutex)
-    {
-        sal_mutex_destroy(p_sal_async_queue_mutex);
-        p_sal_async_queue_mutex = NULL;
-    }
 }
 
 /**
@@ -99,44 +456,33 @@ void sal_async_queue_destroy(sal_async_queue_t *async_queue)
  */
 sal_err_t sal_async_queue_put(sal_async_queue_t *async_queue, void *data)
 {
-    queue_member_t* new_member;
-    sal_iflags_t iflag;
+    uint32_t count;
 
-    iflag = sal_hwi_lock();
+    return sal_async_queue_put_batch(async_queue, &data, 1, &count);
+}
+
+/**
+ * Send a batch of data, stops at the first one that does not fit
+ *
+ * @param async_queue
+ * @param data
+ * @param count
+ * @param p_count
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_put_batch(sal_async_queue_t *async_queue, void **data, uint32_t count,
+    uint32_t *p_count)
+{
     if(async_queue==NULL)
     {
-        sal_hwi_unlock(iflag);
+        *p_count = 0;
         return EADDRNOTAVAIL;
     }
-    if(async_queue->current_length>=async_queue->max_length)
-    {
-        sal_hwi_unlock(iflag);
-        return ERANGE;
-    }
-    else
-    {
-        SAL_MALLOC_ATOMIC(new_member, queue_member_t*, sizeof(queue_member_t));
-        if(new_member==NULL)
-        {
-            sal_hwi_unlock(iflag);
-            return ENOMEM;
-        }
-        new_member->data = data;
-        new_member->next = NULL;
-        if(async_queue->current_length==0)
-        {
-            async_queue->tail = async_queue->head = new_member;
-        }
-        else
-        {
-            async_queue->tail->next = new_member;
-            async_queue->tail = new_member;
-        }
-        async_queue->current_length++;
-        sal_event_set(async_queue->event);
-    }
-    sal_hwi_unlock(iflag);
-    return 0;
+
+    if (async_queue->type == SAL_ASYNC_QUEUE_RING)
+        return _sal_ring_put(async_queue, data, count, p_count);
+    return _sal_list_put(async_queue, data, count, p_count);
 }
 
 /**
@@ -151,49 +497,34 @@ sal_err_t sal_async_queue_put(sal_async_queue_t *async_queue, void *data)
 sal_err_t sal_async_queue_get(sal_async_queue_t *async_queue, int timeout,
                                                             void **pdata)
 {
-    sal_iflags_t iflag;
-    queue_member_t* deleted_member;
-    iflag = sal_hwi_lock();
+    uint32_t count;
+
+    return sal_async_queue_get_batch(async_queue, timeout, pdata, 1, &count);
+}
+
+/**
+ * Receive a batch of data, waits only while the queue is empty
+ *
+ * @param async_queue
+ * @param timeout
+ * @param pdata
+ * @param count
+ * @param p_count
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_get_batch(sal_async_queue_t *async_queue, int timeout, void **pdata,
+    uint32_t count, uint32_t *p_count)
+{
+    *p_count = 0;
     if(async_queue==NULL)
-    {
-        sal_hwi_unlock(iflag);
         return EADDRNOTAVAIL;
-    }
-    if(async_queue->current_length==0)
-    {
-        sal_event_reset(async_queue->event);
-        sal_hwi_unlock(iflag);
-        if(sal_event_wait(async_queue->event, timeout))
-        {
-            iflag = sal_hwi_lock();
-            deleted_member = async_queue->head;
-            if(async_queue->current_length==1)
-                async_queue->head = async_queue->tail = NULL;
-            else
-                async_queue->head = async_queue->head->next;
-            *pdata=deleted_member->data;
-            SAL_FREE(deleted_member);
-            async_queue->current_length--;
-            sal_hwi_unlock(iflag);
-        }
-        else
-        {
-            return ETIMEDOUT;
-        }
-    }
-    else
-    {
-        deleted_member = async_queue->head;
-        if(async_queue->current_length>1)
-            async_queue->head = async_queue->head->next;
-        else
-            async_queue->head = async_queue->tail = NULL;
-        *pdata = deleted_member->data;
-        SAL_FREE(deleted_member);
-        async_queue->current_length--;
-        sal_hwi_unlock(iflag);
-    }
-    return 0;
+    if(count==0)
+        return EINVAL;
+
+    if (async_queue->type == SAL_ASYNC_QUEUE_RING)
+        return _sal_ring_get(async_queue, timeout, pdata, count, p_count);
+    return _sal_list_get(async_queue, timeout, pdata, count, p_count);
 }
 
 /**
@@ -208,7 +539,35 @@ sal_err_t sal_async_queue_get(sal_async_queue_t *async_queue, int timeout,
 sal_err_t sal_async_queue_get_count(sal_async_queue_t *async_queue,
     uint32_t *p_current, uint32_t *p_max)
 {
+    uint32_t enqueue_pos, dequeue_pos;
+
+    if (async_queue->type == SAL_ASYNC_QUEUE_RING)
+    {
+        /* a snapshot, producers and consumers may be moving */
+        dequeue_pos = __atomic_load_n(&async_queue->dequeue_pos, __ATOMIC_ACQUIRE);
+        enqueue_pos = __atomic_load_n(&async_queue->enqueue_pos, __ATOMIC_ACQUIRE);
+        *p_current = enqueue_pos - dequeue_pos;
+        *p_max = async_queue->mask + 1;
+        return 0;
+    }
+
     *p_current = async_queue->current_length;
     *p_max = async_queue->max_length;
     return 0;
 }
+
+/**
+ * Get the counters of dropped data
+ *
+ * @param async_queue
+ * @param p_stats
+ *
+ * @return
+ */
+sal_err_t sal_async_queue_get_stats(sal_async_queue_t *async_queue,
+    sal_async_queue_stats_t *p_stats)
+{
+    p_stats->overflow = __atomic_load_n(&async_queue->stats.overflow, __ATOMIC_RELAXED);
+    p_stats->nomem = __atomic_load_n(&async_queue->stats.nomem, __ATOMIC_RELAXED);
+    return 0;
+}
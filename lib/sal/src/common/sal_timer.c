@@ -20,6 +20,26 @@
 #include"sal_mutex.h"
 #include"sal_event.h"
 #include"sal_mem.h"
+#include <time.h>
+
+/*
+ * Timers are kept in a hierarchical timing wheel with a 1ms tick. The root
+ * wheel has one slot per tick for the next 256 ticks, each outer wheel has
+ * 64 slots spanning 64 times the wheel below it. Whenever the root wheel
+ * wraps, the next slot of the first outer wheel is cascaded down into it,
+ * and so on outwards, so start and stop are O(1) and each timer is moved
+ * at most once per level before it expires.
+ */
+#define TIMER_ROOT_BITS     8
+#define TIMER_LVL_BITS      6
+#define TIMER_LVL_NUM       4
+#define TIMER_ROOT_SIZE     (1 << TIMER_ROOT_BITS)
+#define TIMER_LVL_SIZE      (1 << TIMER_LVL_BITS)
+#define TIMER_ROOT_MASK     (TIMER_ROOT_SIZE - 1)
+#define TIMER_LVL_MASK      (TIMER_LVL_SIZE - 1)
+#define TIMER_LVL_SHIFT(n)  (TIMER_ROOT_BITS + (n) * TIMER_LVL_BITS)
+#define TIMER_MAX_DELTA     0xffffffffULL
+#define TIMER_NEVER         ((uint64)-1)
 
 enum timer_state
 {
@@ -31,151 +51,196 @@ typedef enum timer_state timer_state_t;
 struct sal_timer
 {
     timer_state_t state;
-    struct timeval end;
-    int32 timeout;
+    uint64 expires;                 /* tick the timer is due at */
+    uint32 timeout;                 /* period in ms */
     void (*timer_handler)(void *);
     void *user_param;
     sal_timer_t *next;
-    sal_timer_t *prev;
+    sal_timer_t **pprev;            /* link pointing to this timer, NULL if not linked */
 };
 
 static sal_mutex_t *timer_mutex;
 static sal_event_t  *timer_event;
-static sal_timer_t *head;
 static sal_task_t  *timer_task;
 static bool is_exit;
 static bool is_inited;
 
-int32
-sal_timer_compare(struct timeval timer1,struct timeval timer2)
+static sal_timer_t *root_wheel[TIMER_ROOT_SIZE];
+static sal_timer_t *lvl_wheel[TIMER_LVL_NUM][TIMER_LVL_SIZE];
+static sal_timer_t *expired;        /* due timers whose handler is not called yet */
+static uint64 wheel_tick;           /* next tick to process */
+static uint64 wake_tick;            /* tick the timer task sleeps until */
+static uint32 timer_count;          /* timers in the wheel or the expired list */
+static sal_timer_t *running;        /* timer whose handler is being called */
+static __thread bool in_timer_task;
+
+static inline uint64
+_sal_timer_now(void)
 {
-    int32 ret;
-    ret = (int32)timer1.tv_sec-(int32)timer2.tv_sec;
-    if(ret!=0)
-        return ret;
-    else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static inline void
+_sal_timer_link(sal_timer_t **pslot, sal_timer_t *timer)
+{
+    timer->next = *pslot;
+    if (timer->next)
+        timer->next->pprev = &timer->next;
+    timer->pprev = pslot;
+    *pslot = timer;
+}
+
+static inline void
+_sal_timer_unlink(sal_timer_t *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next)
+        timer->next->pprev = timer->pprev;
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/* Put a timer in the slot of its expiry tick, the caller holds timer_mutex */
+static void
+_sal_timer_add(sal_timer_t *timer)
+{
+    uint64 expires = timer->expires;
+    uint64 delta;
+    int32 lvl;
+
+    if (expires < wheel_tick)
+        expires = wheel_tick;
+    delta = expires - wheel_tick;
+
+    if (delta < TIMER_ROOT_SIZE)
+    {
+        _sal_timer_link(&root_wheel[expires & TIMER_ROOT_MASK], timer);
+        return;
+    }
+
+    if (delta > TIMER_MAX_DELTA)
+    {
+        delta = TIMER_MAX_DELTA;
+        expires = wheel_tick + delta;
+    }
+    for (lvl = 0; lvl < TIMER_LVL_NUM - 1; lvl++)
+    {
+        if (delta < (1ULL << TIMER_LVL_SHIFT(lvl + 1)))
+            break;
+    }
+    _sal_timer_link(&lvl_wheel[lvl][(expires >> TIMER_LVL_SHIFT(lvl)) & TIMER_LVL_MASK], timer);
+}
+
+/* Move the timers of one outer slot down, returns the slot index */
+static int32
+_sal_timer_cascade(int32 lvl)
+{
+    int32 index = (wheel_tick >> TIMER_LVL_SHIFT(lvl)) & TIMER_LVL_MASK;
+    sal_timer_t *timer;
+
+    while ((timer = lvl_wheel[lvl][index]) != NULL)
     {
-        ret = (int32)timer1.tv_usec-(int32)timer2.tv_usec;
-        return ret;
+        _sal_timer_unlink(timer);
+        _sal_timer_add(timer);
     }
+
+    return index;
 }
 
-static inline struct sal_timeval *
-_sal_timer_boottime(struct sal_timeval *tv)
+/* First tick that needs processing, a root wheel wrap counts as one */
+static uint64
+_sal_timer_next_tick(void)
 {
-    /*
-     * (struct timezone *)-1 means get relative time/uptime
-     * refer to kernel/time.c sys_gettimeofday()
-     */
-    gettimeofday(tv, (struct timezone *)-1);
-    return tv;
+    uint64 tick;
+    int32 i;
+
+    if (!timer_count)
+        return TIMER_NEVER;
+
+    for (i = 0; i < TIMER_ROOT_SIZE; i++)
+    {
+        tick = wheel_tick + i;
+        if (!(tick & TIMER_ROOT_MASK) || root_wheel[tick & TIMER_ROOT_MASK])
+            break;
+    }
+
+    return tick;
 }
+
+/* Run the handlers of the timers on the expired list, with timer_mutex held on entry and exit */
+static void
+_sal_timer_run_expired(void)
+{
+    sal_timer_t *timer;
+    void (*handler)(void *);
+    void *param;
+
+    while ((timer = expired) != NULL)
+    {
+        _sal_timer_unlink(timer);
+        timer->expires += timer->timeout ? timer->timeout : 1;
+        _sal_timer_add(timer);
+
+        handler = timer->timer_handler;
+        param = timer->user_param;
+        running = timer;
+        sal_mutex_unlock(timer_mutex);
+
+        handler(param);
+
+        sal_mutex_lock(timer_mutex);
+        running = NULL;
+    }
+}
+
 void
 sal_timer_check(void *param)
 {
-    struct timeval now;
-    int32 timeout;
-    int32 ret;
-    uint32 sec, usec;
-    uint32 exp_sec,exp_usec;
-    sal_timer_t * temp_timer;
-    sal_timer_t * timer;
-    sal_timer_t *head_tmp = NULL;
+    uint64 now;
+    uint64 next;
+    int32 index;
+    sal_timer_t *timer;
+
+    in_timer_task = TRUE;
     while(1)
     {
         if (is_exit==TRUE)
             sal_task_exit();
 
         sal_mutex_lock(timer_mutex);
-        if(head!=NULL)
+        now = _sal_timer_now();
+        while (wheel_tick <= now)
         {
-            /*sal_getuptime(&ts);
-            now.tv_sec = ts.tv_sec;
-            now.tv_usec = ts.tv_nsec/1000;*/
-            _sal_timer_boottime(&now);
-            ret = sal_timer_compare(now,head->end);
+            index = wheel_tick & TIMER_ROOT_MASK;
+            if (!index
+                && !_sal_timer_cascade(0)
+                && !_sal_timer_cascade(1)
+                && !_sal_timer_cascade(2))
+                _sal_timer_cascade(3);
 
-            if(ret>=0)
+            if ((timer = root_wheel[index]) != NULL)
             {
-                head_tmp = head;
-                head->timer_handler(head->user_param);
-                if(head_tmp != head)
-                {
-                    sal_mutex_unlock(timer_mutex);
-                    continue;
-                }
-                sec = head->timeout/1000;
-                usec = (head->timeout%1000)*1000;
-                exp_sec = head->end.tv_sec + sec;
-                exp_usec = head->end.tv_usec + usec;
-
-                if(exp_usec>=1000000)
-                {
-                    exp_usec-=1000000;
-                    exp_sec++;
-                }
-                head->end.tv_sec = exp_sec;
-                head->end.tv_usec = exp_usec;
-                if(head->next!=NULL
-                    &&sal_timer_compare(head->end, head->next->end)>=0)
-                {
-                    timer = head;
-                    head = head->next;
-                    head->prev = NULL;
-                    temp_timer = head;
-                    timer->prev = NULL;
-                    timer->next = NULL;
-                    while(1)
-                    {
-                        ret = sal_timer_compare(timer->end,temp_timer->end);
-                        if(ret<0)
-                        {
-                                temp_timer->prev->next = timer;
-                                timer->prev = temp_timer->prev;
-                                temp_timer->prev = timer;
-                                timer->next = temp_timer;
-                                break;
-                        }
-                        else if(temp_timer->next!=NULL)
-                        {
-                            temp_timer = temp_timer->next;
-                        }
-                        else
-                        {
-                            temp_timer->next = timer;
-                            timer->prev = temp_timer;
-                            break;
-                        }
-                    }
-                }
-
-            sal_mutex_unlock(timer_mutex);
-
-            }
-            else
-            {
-                if(head->end.tv_sec !=now.tv_sec)
-                {
-                    if(head->end.tv_usec>=now.tv_sec)
-                        timeout = (head->end.tv_sec -now.tv_sec)*1000+
-                            (head->end.tv_usec-now.tv_usec)/1000;
-                    else
-                        timeout = (head->end.tv_sec -now.tv_sec-1)*1000+1000-
-                            (now.tv_usec-head->end.tv_usec)/1000;
-                }
-                else
-                    timeout = (head->end.tv_usec-now.tv_usec)/1000;
-
-                sal_mutex_unlock(timer_mutex);
-                sal_event_wait(timer_event,timeout);
+                root_wheel[index] = NULL;
+                expired = timer;
+                timer->pprev = &expired;
             }
-        }
-        else
-        {
-                sal_mutex_unlock(timer_mutex);
-                sal_event_wait(timer_event,-1);
+            wheel_tick++;
+
+            _sal_timer_run_expired();
         }
 
+        next = _sal_timer_next_tick();
+        wake_tick = next;
+        sal_mutex_unlock(timer_mutex);
+
+        now = _sal_timer_now();
+        if (next == TIMER_NEVER)
+            sal_event_wait(timer_event, -1);
+        else if (next > now)
+            sal_event_wait(timer_event, (int)(next - now));
     }
 }
 
@@ -189,6 +254,8 @@ sal_err_t sal_timer_init()
         sal_mutex_create(&timer_mutex);
         sal_event_create(&timer_event, TRUE);
         is_exit = FALSE;
+        wheel_tick = _sal_timer_now();
+        wake_tick = TIMER_NEVER;
         /* reduce thread stack memory */
         sal_task_create(&timer_task,"timer manager",256*1024,sal_timer_check,NULL);
         is_inited = TRUE;
@@ -206,7 +273,7 @@ void sal_timer_fini()
 {
     if(is_inited)
     {
-        if(head==NULL)
+        if(!timer_count)
         {
             is_exit = TRUE;
             sal_event_set(timer_event);
@@ -246,7 +313,7 @@ sal_err_t sal_timer_create(sal_timer_t **ptimer,
     temp_timer->timer_handler = func;
     temp_timer->user_param = arg;
     temp_timer->next = NULL;
-    temp_timer->prev = NULL;
+    temp_timer->pprev = NULL;
     *ptimer = temp_timer;
     return 0;
 }
@@ -258,8 +325,18 @@ sal_err_t sal_timer_create(sal_timer_t **ptimer,
  */
 void sal_timer_destroy(sal_timer_t *timer)
 {
-    if(timer->state == TIMER_RUNNING)
-        sal_timer_stop(timer);
+    sal_timer_stop(timer);
+
+    /* the handler may be running in the timer task, wait for it unless we are that handler */
+    sal_mutex_lock(timer_mutex);
+    while (running == timer && !in_timer_task)
+    {
+        sal_mutex_unlock(timer_mutex);
+        sal_task_yield();
+        sal_mutex_lock(timer_mutex);
+    }
+    sal_mutex_unlock(timer_mutex);
+
     SAL_FREE(timer);
 }
 /**
@@ -272,78 +349,30 @@ void sal_timer_destroy(sal_timer_t *timer)
  */
 sal_err_t sal_timer_start(sal_timer_t *timer, uint32_t timeout)
 {
-    struct timeval now;
-    /*struct timespec ts;*/
-    int32 ret;
-    uint32 sec, usec;
-    uint32 exp_sec,exp_usec;
-    sal_timer_t * temp_timer;
+    uint64 now;
+
     if(timer!=NULL)
     {
+        sal_mutex_lock(timer_mutex);
         if(timer->state!=TIMER_RUNNING)
         {
-            /*sal_getuptime(&ts);
-            now.tv_sec = ts.tv_sec;
-            now.tv_usec = ts.tv_nsec/1000;*/
-            _sal_timer_boottime(&now);
-            sec = timeout/1000;
-            usec = (timeout%1000)*1000;
-            exp_sec = now.tv_sec + sec;
-            exp_usec = now.tv_usec + usec;
-            if(exp_usec>=1000000)
-            {
-                exp_usec-=1000000;
-                exp_sec++;
-            }
-            timer->end.tv_sec = exp_sec;
-            timer->end.tv_usec = exp_usec;
+            now = _sal_timer_now();
+            /* the timer task does not advance an empty wheel, catch it up here */
+            if (!timer_count && wheel_tick < now)
+                wheel_tick = now;
+            /* now is rounded down, round the expiry up so the timer never fires early */
+            timer->expires = now + timeout + 1;
             timer->timeout = timeout;
-            sal_mutex_lock(timer_mutex);
-            if(head==NULL)
+            _sal_timer_add(timer);
+            timer_count++;
+            timer->state = TIMER_RUNNING;
+            if (timer->expires < wake_tick)
             {
-                head = timer;
+                wake_tick = timer->expires;
                 sal_event_set(timer_event);
             }
-            else
-            {
-                temp_timer = head;
-                while(1)
-                {
-                    ret = sal_timer_compare(timer->end,temp_timer->end);
-                    if(ret<0)
-                    {
-                        if(temp_timer->prev==NULL)
-                        {
-                            timer->next = temp_timer ;
-                            temp_timer->prev = timer;
-                            head = timer;
-                            sal_event_set(timer_event);
-                            break;
-                        }
-                        else
-                        {
-                            temp_timer->prev->next = timer;
-                            timer->prev = temp_timer->prev;
-                            temp_timer->prev = timer;
-                            timer->next = temp_timer;
-                            break;
-                        }
-                    }
-                    else if(temp_timer->next!=NULL)
-                    {
-                        temp_timer = temp_timer->next;
-                    }
-                    else
-                    {
-                        temp_timer->next = timer;
-                        timer->prev = temp_timer;
-                        break;
-                    }
-                }
-            }
-            timer->state = TIMER_RUNNING;
-            sal_mutex_unlock(timer_mutex);
         }
+        sal_mutex_unlock(timer_mutex);
     }
     else
             SAL_LOG_INFO("invalid timer pointer");
@@ -358,51 +387,16 @@ sal_err_t sal_timer_start(sal_timer_t *timer, uint32_t timeout)
  */
 sal_err_t sal_timer_stop(sal_timer_t *timer)
 {
-    sal_timer_t * temp_timer;
     if(timer!=NULL)
     {
+        sal_mutex_lock(timer_mutex);
         if(timer->state ==TIMER_RUNNING)
         {
-            /*sal_mutex_lock(timer_mutex);*/
-            temp_timer = head;
-            while(1)
-            {
-            if(temp_timer == timer)
-            {
-                if(temp_timer->prev==NULL)
-                {
-                    if(temp_timer->next==NULL)
-                    {
-                        head = NULL;
-                        break;
-                    }
-                    else
-                    {
-                        head = temp_timer->next;
-                        head->prev = NULL;
-                        break;
-                    }
-                }
-                else if(temp_timer->next==NULL)
-                {
-                    temp_timer->prev->next = NULL;
-                    break;
-                }
-                else
-                {
-                    temp_timer->next->prev = temp_timer->prev;
-                    temp_timer->prev->next = temp_timer->next;
-                    break;
-                }
-            }
-            else
-                temp_timer = temp_timer->next;
-            }
-            /*sal_mutex_unlock(timer_mutex);*/
-            timer->next = NULL;
-            timer->prev = NULL;
+            _sal_timer_unlink(timer);
+            timer_count--;
             timer->state = TIMER_STOPPED;
         }
+        sal_mutex_unlock(timer_mutex);
     }
     else
             SAL_LOG_INFO("invalid timer pointer");
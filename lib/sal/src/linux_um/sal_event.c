@@ -16,7 +16,7 @@
  */
 
 #include "sal.h"
-#include <sys/time.h>
+#include <time.h>
 #include <pthread.h>
 
 struct sal_event
@@ -30,13 +30,18 @@ struct sal_event
 sal_err_t sal_event_create(sal_event_t **pevt, bool auto_reset)
 {
     sal_event_t *event;
+    pthread_condattr_t attr;
 
     SAL_MALLOC(event, sal_event_t *, sizeof(sal_event_t));
     if (!event)
         return ENOMEM;
 
+    /* time out on the monotonic clock so that setting the date does not stretch waits */
     pthread_mutex_init(&event->mutex, NULL);
-    pthread_cond_init(&event->cond, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&event->cond, &attr);
+    pthread_condattr_destroy(&attr);
     event->signaled = FALSE;
     event->auto_reset = auto_reset;
 
@@ -72,23 +77,19 @@ void sal_event_reset(sal_event_t *event)
 
 bool sal_event_wait(sal_event_t *event, int timeout)
 {
-    struct timeval now;
     struct timespec tspec;
     int ret;
 
     if (timeout >= 0)
     {
-        gettimeofday(&now, NULL);
-        now.tv_sec += timeout / 1000;
-        now.tv_usec += (timeout % 1000) * 1000;
-        if (now.tv_usec >= 1000000)
+        clock_gettime(CLOCK_MONOTONIC, &tspec);
+        tspec.tv_sec += timeout / 1000;
+        tspec.tv_nsec += (timeout % 1000) * 1000000;
+        if (tspec.tv_nsec >= 1000000000)
         {
-            now.tv_sec++;
-            now.tv_usec -= 1000000;
+            tspec.tv_sec++;
+            tspec.tv_nsec -= 1000000000;
         }
-
-        tspec.tv_sec = now.tv_sec;
-        tspec.tv_nsec = now.tv_usec * 1000;
     }
 
     pthread_mutex_lock(&event->mutex);
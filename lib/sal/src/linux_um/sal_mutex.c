@@ -28,6 +28,11 @@ struct sal_cond
     pthread_cond_t cond;
 };
 
+struct sal_rwlock
+{
+    pthread_rwlock_t lock;
+};
+
 sal_err_t sal_mutex_recursive_create(sal_mutex_t** pmutex)
 {
     sal_mutex_t* mutex;
@@ -104,3 +109,52 @@ void sal_task_cond_wait(sal_mutex_t* p_mutex, sal_cond_t* p_cond)
 {
     pthread_cond_wait(&p_cond->cond, &p_mutex->lock);
 }
+
+sal_err_t sal_rwlock_create(sal_rwlock_t** prwlock)
+{
+    sal_rwlock_t* rwlock;
+    pthread_rwlockattr_t attr;
+
+    SAL_MALLOC(rwlock, sal_rwlock_t *, sizeof(sal_rwlock_t));
+    if (!rwlock)
+        return ENOMEM;
+
+    pthread_rwlockattr_init(&attr);
+    pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+    pthread_rwlock_init(&rwlock->lock, &attr);
+    pthread_rwlockattr_destroy(&attr);
+
+    *prwlock = rwlock;
+    return 0;
+}
+
+void sal_rwlock_destroy(sal_rwlock_t *rwlock)
+{
+    pthread_rwlock_destroy(&rwlock->lock);
+    SAL_FREE(rwlock);
+}
+
+void sal_rwlock_rdlock(sal_rwlock_t *rwlock)
+{
+    pthread_rwlock_rdlock(&rwlock->lock);
+}
+
+void sal_rwlock_wrlock(sal_rwlock_t *rwlock)
+{
+    pthread_rwlock_wrlock(&rwlock->lock);
+}
+
+bool sal_rwlock_try_rdlock(sal_rwlock_t *rwlock)
+{
+    return pthread_rwlock_tryrdlock(&rwlock->lock) == 0;
+}
+
+bool sal_rwlock_try_wrlock(sal_rwlock_t *rwlock)
+{
+    return pthread_rwlock_trywrlock(&rwlock->lock) == 0;
+}
+
+void sal_rwlock_unlock(sal_rwlock_t *rwlock)
+{
+    pthread_rwlock_unlock(&rwlock->lock);
+}
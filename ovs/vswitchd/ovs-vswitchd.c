@@ -68,9 +68,6 @@ static void usage(void) NO_RETURN;
 int
 main(int argc, char *argv[])
 #else
-#include "sal.h"
-
-extern sal_mutex_t *pg_mutex;
 int
 ovs_main(int argc, char *argv[]);
 int
@@ -142,9 +139,6 @@ ovs_main(int argc, char *argv[])
 
     exiting = false;
     while (!exiting) {
-#ifdef _OFP_CENTEC_
-        sal_mutex_lock(pg_mutex);
-#endif
         worker_run();
         if (signal_poll(sighup)) {
             vlog_reopen_log_file();
@@ -176,9 +170,6 @@ ovs_main(int argc, char *argv[])
         bridge_run_fast();
 #endif
         unixctl_server_wait(unixctl);
-#ifdef _OFP_CENTEC_
-        sal_mutex_unlock(pg_mutex);
-#endif
         netdev_wait();
         if (exiting) {
             poll_immediate_wake();
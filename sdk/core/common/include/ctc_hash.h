@@ -14,31 +14,67 @@
 #define _CTC_HASH_H_
 #include "kal.h"
 
- struct ctc_hash_backet_s
+/**< Slots of a table are a power of 2, it grows at 3/4 load and shrinks under 1/8 */
+#define CTC_HASH_MIN_SIZE       16
+
+/**< Old slots moved to the new table by each insert or remove while resizing */
+#define CTC_HASH_MIGRATE_STEP   8
+
+ struct ctc_hash_slot_s
  {
-     /**< Linked list.  */
-     struct ctc_hash_backet_s *next;
+     /**< Data, NULL for an empty or a deleted slot. */
+     void *data;
 
-     /**< Hash key. */
+     /**< Hash key of data, compared before hash_cmp is called. */
      uint32 key;
 
-     /**< Data.  */
-     void *data;
+     /**< Distance from the home slot of key. */
+     uint16 dist;
+
+     /**< Removed while the table was traversed or migrated, the slot keeps
+          key and dist so that probing still passes it. */
+     uint16 deleted;
  };
-typedef struct ctc_hash_backet_s ctc_hash_backet_t;
+typedef struct ctc_hash_slot_s ctc_hash_slot_t;
+
+struct ctc_hash_table_s
+{
+    /**< Robin Hood open addressing slots. */
+    ctc_hash_slot_t *slot;
+
+    /**< Slot number, a power of 2. */
+    uint32 size;
+
+    /**< log2(size). */
+    uint32 bits;
+
+    /**< Slots holding data. */
+    uint32 count;
+
+    /**< Deleted slots. */
+    uint32 deleted;
+};
+typedef struct ctc_hash_table_s ctc_hash_table_t;
 
 struct ctc_hash_s
 {
-    /**< Hash backet. */
-    ctc_hash_backet_t ***index;
+    /**< Table inserts go to. */
+    ctc_hash_table_t table;
 
-    /**< Hash table size= block_size*block_num */
+    /**< Table being migrated to table after a resize, slot is NULL if none. */
+    ctc_hash_table_t old_table;
 
-    /**< Hash table block number. */
-    uint16 block_num;
+    /**< Next old_table slot to migrate. */
+    uint32 migrate_pos;
 
-    /**< Hash table block size. */
-    uint16 block_size;
+    /**< Old slots to migrate per insert or remove. */
+    uint32 migrate_step;
+
+    /**< Traversals in progress, slots are not moved while it is not 0. */
+    uint32 traversing;
+    /**< Entries inserted during a traversal, moved to table when the last traversal
+         ends, slot is NULL if none. It is not traversed, so it may resize any time. */
+    ctc_hash_table_t pending;
 
     /**< current Hash backet size. */
     uint32 count;
@@ -54,12 +90,13 @@ typedef struct ctc_hash_s ctc_hash_t;
 
 typedef int32 (*hash_traversal_fn)(void *backet_data, void *user_data);
 
-/**< Create hash table*/
+/**< Create hash table, block_num*block_size is no longer a fixed size: the table
+     starts at CTC_HASH_MIN_SIZE slots and resizes with the entry count */
 extern ctc_hash_t *
 ctc_hash_create(uint16 block_num,uint16 block_size, uint32 (*hash_key) (), bool(*hash_cmp) ());
 
 /**< Lookup a node from hash table */
-extern inline void *
+extern void *
 ctc_hash_lookup (ctc_hash_t* hash, void *data);
 
 extern void *
@@ -75,15 +112,16 @@ ctc_hash_traverse2(ctc_hash_t* hash, hash_traversal_fn fn,void *data);
 extern int32
 ctc_hash_traverse_through(ctc_hash_t* hash, hash_traversal_fn fn,void *data);
 
-/**< Insert a node to hash table */
-extern inline void *
+/**< Insert a node to hash table, return NULL on no memory. A node inserted from a
+     traversal callback is not visited by that traversal */
+extern void *
 ctc_hash_insert(ctc_hash_t* hash, void *data);
 
 extern int32
 ctc_hash_get_count (ctc_hash_t *hash, uint32* count);
 
 /**< Remove a node from hash table */
-extern inline void *
+extern void *
 ctc_hash_remove(ctc_hash_t* hash, void *data);
 
 /**< remove  node from hash table  */
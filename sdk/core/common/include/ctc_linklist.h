@@ -164,39 +164,39 @@ void ctc_list_delete_all_node (struct ctc_linklist *);
 #define _CTC_LHEAD(p_list) ((p_list)->head.p_next)
 #define _CTC_LTAIL(p_list) ((p_list)->head.p_prev)
 
-INLINE void
+extern void
 ctc_list_pointer_init(ctc_list_pointer_t* p_list);
 
-INLINE void
+extern void
 ctc_list_pointer_insert_head(ctc_list_pointer_t* p_list, ctc_list_pointer_node_t* p_node);
-INLINE void
+extern void
 ctc_list_pointer_insert_tail(ctc_list_pointer_t* p_list, ctc_list_pointer_node_t* p_node);
 
-INLINE void
+extern void
 ctc_list_pointer_insert_after(ctc_list_pointer_t* p_list, ctc_list_pointer_node_t* p_node1, ctc_list_pointer_node_t* p_node2);
-INLINE void
+extern void
 ctc_list_pointer_insert_before(ctc_list_pointer_t* p_list, ctc_list_pointer_node_t* p_node1, ctc_list_pointer_node_t* p_node2);
 
-INLINE ctc_list_pointer_node_t*
+extern ctc_list_pointer_node_t*
 ctc_list_pointer_delete_head(ctc_list_pointer_t* p_list);
 
-INLINE ctc_list_pointer_node_t*
+extern ctc_list_pointer_node_t*
 ctc_list_pointer_delete_tail(ctc_list_pointer_t* p_list);
 
-INLINE void
+extern void
 ctc_list_pointer_delete(ctc_list_pointer_t* p_list, ctc_list_pointer_node_t* p_node);
-INLINE int
+extern int
 ctc_list_pointer_empty(ctc_list_pointer_t* p_list);
-INLINE ctc_list_pointer_node_t*
+extern ctc_list_pointer_node_t*
 ctc_list_pointer_head(ctc_list_pointer_t* p_list);
 
 
-INLINE ctc_list_pointer_node_t*
+extern ctc_list_pointer_node_t*
 ctc_list_pointer_node_tail(ctc_list_pointer_t* p_list);
 
-INLINE ctc_list_pointer_node_t*
+extern ctc_list_pointer_node_t*
 ctc_list_pointer_next(ctc_list_pointer_node_t* p_node);
-INLINE ctc_list_pointer_node_t*
+extern ctc_list_pointer_node_t*
 ctc_list_pointer_prev(ctc_list_pointer_node_t* p_node);
 
 #define CTC_LIST_POINTER_ISEMPTY(X) (((X)->head.p_next == NULL) && ((X)->head.p_prev == &((X)->head)))
@@ -8,10 +8,378 @@
  *version v2.0
 
  The file define  HASH arithmetic lib
+
+ Robin Hood open addressing: an entry is stored in the first free slot from
+ its home slot, but takes the slot of any entry that is closer to its own
+ home, so a lookup stops at the first slot nearer to its home than the key
+ is. The table doubles at 3/4 load and shrinks under 1/8 load; the entries
+ of the old table are moved a few slots per insert or remove, lookups check
+ both tables until it is done.
+
+ While a traversal is in progress no slot moves: the table is neither
+ resized nor migrated, a remove from a traversal callback only marks the
+ slot deleted, the deleted slots are dropped by a later resize, and an
+ insert goes to a pending table that lookups and removes also check. The
+ pending entries are added to the table when the last traversal ends, so
+ every entry is visited once and a traversal does not visit the entries
+ inserted by its own callbacks.
  ****************************************************************************/
 
 #include "ctc_hash.h"
 
+#define CTC_HASH_GOLDEN_RATIO    0x9E3779B9U
+
+#define CTC_HASH_SLOT_IS_EMPTY(s)    ((NULL == (s)->data) && !(s)->deleted)
+
+/* Fibonacci hashing on the top bits, hash_key() results are often small or
+   already reduced modulo the old fixed table size */
+static INLINE uint32
+_ctc_hash_home(ctc_hash_table_t *table, uint32 key)
+{
+    return (key * CTC_HASH_GOLDEN_RATIO) >> (32 - table->bits);
+}
+
+static int32
+_ctc_hash_table_init(ctc_hash_table_t *table, uint32 size)
+{
+    uint32 bits = 0;
+
+    while ((1U << bits) < size)
+    {
+        bits++;
+    }
+
+    kal_memset(table, 0, sizeof(ctc_hash_table_t));
+    table->slot = mem_malloc(MEM_HASH_MODULE, (1U << bits) * sizeof(ctc_hash_slot_t));
+    if (NULL == table->slot)
+    {
+        return -1;
+    }
+    kal_memset(table->slot, 0, (1U << bits) * sizeof(ctc_hash_slot_t));
+    table->size = 1U << bits;
+    table->bits = bits;
+
+    return 0;
+}
+
+static ctc_hash_slot_t *
+_ctc_hash_table_find(ctc_hash_t *hash, ctc_hash_table_t *table, uint32 key, void *data)
+{
+    uint32 mask = table->size - 1;
+    uint32 pos = 0;
+    uint32 dist = 0;
+    ctc_hash_slot_t *slot = NULL;
+
+    if (NULL == table->slot)
+    {
+        return NULL;
+    }
+
+    pos = _ctc_hash_home(table, key);
+    for (dist = 0; dist < table->size; dist++, pos = (pos + 1) & mask)
+    {
+        slot = &table->slot[pos];
+        if (slot->key == key && slot->data
+            && (*hash->hash_cmp)(slot->data, data) == TRUE)
+        {
+            return slot;
+        }
+
+        if (CTC_HASH_SLOT_IS_EMPTY(slot) || slot->dist < dist)
+        {
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+/* the caller makes sure the table has a free slot */
+static void
+_ctc_hash_table_add(ctc_hash_table_t *table, uint32 key, void *data)
+{
+    uint32 mask = table->size - 1;
+    uint32 pos = 0;
+    ctc_hash_slot_t cur;
+    ctc_hash_slot_t tmp;
+    ctc_hash_slot_t *slot = NULL;
+
+    cur.data = data;
+    cur.key = key;
+    cur.dist = 0;
+    cur.deleted = 0;
+
+    pos = _ctc_hash_home(table, key);
+    for (;;)
+    {
+        slot = &table->slot[pos];
+        if (CTC_HASH_SLOT_IS_EMPTY(slot))
+        {
+            *slot = cur;
+            table->count++;
+            return;
+        }
+
+        if (slot->deleted && slot->dist <= cur.dist)
+        {
+            *slot = cur;
+            table->deleted--;
+            table->count++;
+            return;
+        }
+
+        if (slot->dist < cur.dist)
+        {
+            tmp = *slot;
+            *slot = cur;
+            cur = tmp;
+        }
+
+        pos = (pos + 1) & mask;
+        cur.dist++;
+    }
+}
+
+static void
+_ctc_hash_table_del(ctc_hash_t *hash, ctc_hash_table_t *table, ctc_hash_slot_t *slot)
+{
+    uint32 mask = table->size - 1;
+    uint32 pos = slot - table->slot;
+    ctc_hash_slot_t *next = NULL;
+
+    table->count--;
+    hash->count--;
+
+    /* the old table is migrated in slot order, do not move its slots */
+    if (hash->traversing || table == &hash->old_table)
+    {
+        slot->data = NULL;
+        slot->deleted = 1;
+        table->deleted++;
+        return;
+    }
+
+    /* backward shift the following entries that are not in their home slot */
+    for (;;)
+    {
+        next = &table->slot[(pos + 1) & mask];
+        if (CTC_HASH_SLOT_IS_EMPTY(next) || 0 == next->dist)
+        {
+            break;
+        }
+
+        table->slot[pos] = *next;
+        table->slot[pos].dist--;
+        pos = (pos + 1) & mask;
+    }
+    kal_memset(&table->slot[pos], 0, sizeof(ctc_hash_slot_t));
+}
+
+static void
+_ctc_hash_migrate(ctc_hash_t *hash, uint32 slot_num)
+{
+    ctc_hash_table_t *old_table = &hash->old_table;
+    ctc_hash_slot_t *slot = NULL;
+
+    if (NULL == old_table->slot || hash->traversing)
+    {
+        return;
+    }
+
+    while (slot_num-- && hash->migrate_pos < old_table->size)
+    {
+        slot = &old_table->slot[hash->migrate_pos++];
+        if (slot->data)
+        {
+            _ctc_hash_table_add(&hash->table, slot->key, slot->data);
+            slot->data = NULL;
+            slot->deleted = 1;
+            old_table->count--;
+            old_table->deleted++;
+        }
+    }
+
+    if (hash->migrate_pos >= old_table->size)
+    {
+        mem_free(old_table->slot);
+        kal_memset(old_table, 0, sizeof(ctc_hash_table_t));
+        hash->migrate_pos = 0;
+    }
+}
+
+/* resize the table for count entries if its load is out of range */
+static void
+_ctc_hash_check_size(ctc_hash_t *hash, uint32 count)
+{
+    ctc_hash_table_t *table = &hash->table;
+    ctc_hash_table_t new_table;
+    uint32 size = CTC_HASH_MIN_SIZE;
+
+    if (hash->traversing)
+    {
+        return;
+    }
+
+    if (hash->old_table.slot)
+    {
+        /* the new table is sized to take all of the old one before it fills */
+        if ((table->count + table->deleted + hash->old_table.count + 1) * 4 <= table->size * 3)
+        {
+            return;
+        }
+        _ctc_hash_migrate(hash, hash->old_table.size);
+    }
+
+    if (((count + table->deleted) * 4 <= table->size * 3)
+        && ((table->size <= CTC_HASH_MIN_SIZE) || (count * 8 >= table->size))
+        && (table->deleted * 8 <= table->size))
+    {
+        return;
+    }
+
+    while (size < count * 2)
+    {
+        size <<= 1;
+    }
+
+    /* on no memory keep going with the current table */
+    if (_ctc_hash_table_init(&new_table, size) < 0)
+    {
+        return;
+    }
+
+    hash->old_table = *table;
+    hash->table = new_table;
+    hash->migrate_pos = 0;
+
+    /* done before the new table takes another size / 4 entries */
+    hash->migrate_step = hash->old_table.size * 4 / size;
+    if (hash->migrate_step < CTC_HASH_MIGRATE_STEP)
+    {
+        hash->migrate_step = CTC_HASH_MIGRATE_STEP;
+    }
+    _ctc_hash_migrate(hash, hash->migrate_step);
+}
+
+static ctc_hash_slot_t *
+_ctc_hash_find(ctc_hash_t *hash, uint32 key, void *data, ctc_hash_table_t **pp_table)
+{
+    ctc_hash_slot_t *slot = NULL;
+
+    slot = _ctc_hash_table_find(hash, &hash->table, key, data);
+    if (slot)
+    {
+        *pp_table = &hash->table;
+        return slot;
+    }
+
+    slot = _ctc_hash_table_find(hash, &hash->old_table, key, data);
+    *pp_table = &hash->old_table;
+    return slot;
+}
+
+/* add data to the table, hash->count already counts it */
+static void *
+_ctc_hash_add(ctc_hash_t *hash, void *data)
+{
+    uint32 key = (*hash->hash_key) (data);
+    ctc_hash_table_t *table = &hash->table;
+
+    _ctc_hash_migrate(hash, hash->migrate_step);
+    _ctc_hash_check_size(hash, hash->count);
+
+    /* keep one empty slot so that probing always ends */
+    if (table->count + table->deleted + 1 >= table->size)
+    {
+        return NULL;
+    }
+
+    _ctc_hash_table_add(table, key, data);
+
+    return data;
+}
+
+static void *
+_ctc_hash_pending_add(ctc_hash_t *hash, void *data)
+{
+    ctc_hash_table_t *pending = &hash->pending;
+    ctc_hash_table_t new_table;
+    ctc_hash_slot_t *slot = NULL;
+    uint32 pos = 0;
+
+    if (NULL == pending->slot)
+    {
+        if (_ctc_hash_table_init(pending, CTC_HASH_MIN_SIZE) < 0)
+        {
+            return NULL;
+        }
+    }
+    else if ((pending->count + pending->deleted + 1) * 4 > pending->size * 3)
+    {
+        /* rehash at once, nothing walks the pending slots */
+        if (_ctc_hash_table_init(&new_table, pending->size * 2) < 0)
+        {
+            return NULL;
+        }
+        for (pos = 0; pos < pending->size; pos++)
+        {
+            slot = &pending->slot[pos];
+            if (slot->data)
+            {
+                _ctc_hash_table_add(&new_table, slot->key, slot->data);
+            }
+        }
+        mem_free(pending->slot);
+        *pending = new_table;
+    }
+
+    _ctc_hash_table_add(pending, (*hash->hash_key) (data), data);
+
+    return data;
+}
+
+/* move the pending entries into the table, on no memory the rest stays pending */
+static void
+_ctc_hash_pending_merge(ctc_hash_t *hash)
+{
+    ctc_hash_table_t *pending = &hash->pending;
+    ctc_hash_slot_t *slot = NULL;
+    uint32 pos = 0;
+
+    for (pos = 0; pos < pending->size; pos++)
+    {
+        slot = &pending->slot[pos];
+        if (NULL == slot->data)
+        {
+            continue;
+        }
+        if (NULL == _ctc_hash_add(hash, slot->data))
+        {
+            return;
+        }
+        /* only mark it, a backward shift would move a later slot before pos */
+        slot->data = NULL;
+        slot->deleted = 1;
+        pending->count--;
+        pending->deleted++;
+    }
+
+    mem_free(pending->slot);
+    kal_memset(pending, 0, sizeof(ctc_hash_table_t));
+}
+
+static void
+_ctc_hash_traverse_end(ctc_hash_t *hash)
+{
+    hash->traversing--;
+    _ctc_hash_check_size(hash, hash->count);
+
+    if (0 == hash->traversing && hash->pending.slot)
+    {
+        _ctc_hash_pending_merge(hash);
+    }
+}
+
 ctc_hash_t *
 ctc_hash_create(uint16 block_num,uint16 block_size,uint32 (*hash_key) (), bool(*hash_cmp) ())
 {
@@ -24,16 +392,12 @@ ctc_hash_create(uint16 block_num,uint16 block_size,uint32 (*hash_key) (), bool(*
         return NULL;
     }
     kal_memset(hash ,0,sizeof (ctc_hash_t) );
-    hash->index = mem_malloc (MEM_HASH_MODULE,  block_num*sizeof (void *) );
 
-    if (NULL == hash->index)
+    if (_ctc_hash_table_init(&hash->table, CTC_HASH_MIN_SIZE) < 0)
     {
         mem_free(hash);
         return NULL;
     }
-    kal_memset(hash->index ,0,sizeof (void *) * block_num);
-    hash->block_size= block_size;
-    hash->block_num = block_num;
     hash->hash_key = hash_key;
     hash->hash_cmp = hash_cmp;
     return hash;
@@ -45,81 +409,49 @@ void *
 ctc_hash_lookup (ctc_hash_t *hash, void *data)
 {
     uint32 key = 0;
-    uint32 index = 0;
-     uint32 hash_size = 0;
-    uint16 idx_1d = 0;
-    uint16 idx_2d = 0;
-    ctc_hash_backet_t *backet = NULL;
+    ctc_hash_table_t *table = NULL;
+    ctc_hash_slot_t *slot = NULL;
 
     if (!hash)
       return NULL;
 
-    hash_size =hash->block_size* hash->block_num;
     key = (*hash->hash_key) (data);
-    index = key % hash_size;
-
-    idx_1d  = index / hash->block_size ;
-    idx_2d  = index % hash->block_size ;
-
-    if (!hash->index[idx_1d])
+    slot = _ctc_hash_find(hash, key, data, &table);
+    if (slot)
     {
-        return NULL;
+        return slot->data;
     }
 
-    for (backet = hash->index[idx_1d][idx_2d]; backet != NULL; backet = backet->next)
-    {
-        if (backet->key == key
-            && (*hash->hash_cmp)(backet->data, data) == TRUE)
-        return backet->data;
-    }
+    slot = _ctc_hash_table_find(hash, &hash->pending, key, data);
 
-    return NULL;
+    return slot ? slot->data : NULL;
 }
 
 void *
 ctc_hash_lookup2 (ctc_hash_t *hash, void *data, uint32 *hash_index)
 {
     uint32 key = 0;
-    uint32 index = 0;
-     uint32 hash_size = 0;
-    uint16 idx_1d = 0;
-    uint16 idx_2d = 0;
-    ctc_hash_backet_t *backet = NULL;
+    ctc_hash_table_t *table = NULL;
+    ctc_hash_slot_t *slot = NULL;
 
     if (!hash || !hash_index)
       return NULL;
 
-    hash_size =hash->block_size* hash->block_num;
     key = (*hash->hash_key) (data);
+    *hash_index = _ctc_hash_home(&hash->table, key);
+    slot = _ctc_hash_find(hash, key, data, &table);
 
-    index = key % hash_size;
-    *hash_index = index;
-    idx_1d  = index / hash->block_size ;
-    idx_2d  = index % hash->block_size ;
-
-    if (!hash->index[idx_1d])
-    {
-        return NULL;
-    }
-
-    for (backet = hash->index[idx_1d][idx_2d]; backet != NULL; backet = backet->next)
-    {
-        if (backet->key == key
-            && (*hash->hash_cmp)(backet->data, data) == TRUE)
-        return backet->data;
-    }
-
-    return NULL;
+    return slot ? slot->data : NULL;
 }
 
 int32
 ctc_hash_traverse(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
 {
+    ctc_hash_table_t *tables[2];
+    ctc_hash_slot_t *slot = NULL;
     uint32 count = 0;
-    uint16 index1 = 0;
-    uint16 index2 = 0;
-    uint32 hash_size = 0;
-    ctc_hash_backet_t *backet = NULL;
+    uint32 i = 0;
+    uint32 pos = 0;
     int32 ret = 0;
 
     if (!hash)
@@ -129,75 +461,92 @@ ctc_hash_traverse(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
     {
         return 0;
     }
-    hash_size =hash->block_size * hash->block_num;
+    /* the callback may remove entries, so stop on the count at the start */
+    count = hash->count;
+
+    tables[0] = &hash->old_table;
+    tables[1] = &hash->table;
+    hash->traversing++;
 
-    for (index1 = 0; index1 < hash->block_num; index1++)
+    for (i = 0; i < 2; i++)
     {
-        if (!hash->index[index1])
+        for (pos = 0; pos < tables[i]->size; pos++)
         {
-            continue;
-        }
-        for (index2 = 0; index2 < hash->block_size; index2++)
-        {
-            for (backet = hash->index[index1][index2]; backet != NULL; backet = backet->next)
+            slot = &tables[i]->slot[pos];
+            if (NULL == slot->data)
             {
-                count++;
-                if ((ret = (*fn)(backet->data, data)) < 0)
-                    {
+                continue;
+            }
 
-                    return ret;
-                    }
+            count--;
+            if ((ret = (*fn)(slot->data, data)) < 0)
+            {
+                _ctc_hash_traverse_end(hash);
+                return ret;
+            }
 
-                if (count >= hash->count)
-                {
-                    return 0;
-                }
+            if (count == 0)
+            {
+                _ctc_hash_traverse_end(hash);
+                return 0;
             }
         }
     }
+
+    _ctc_hash_traverse_end(hash);
     return 0;
 
 }
 
-/* Traverse hash special array according to KEY */
+/* Traverse the entries with the same KEY as data */
 extern int32
 ctc_hash_traverse2(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
 {
+    ctc_hash_table_t *tables[2];
+    ctc_hash_slot_t *slot = NULL;
     uint32 key = 0;
-    uint32 index = 0;
-    uint32 hash_size = 0;
-    uint16 idx_1d = 0;
-    uint16 idx_2d = 0;
-    ctc_hash_backet_t *backet = NULL;
+    uint32 i = 0;
+    uint32 pos = 0;
+    uint32 dist = 0;
     int32 ret = 0;
 
     if (!hash)
     {
         return -1;
     }
-    hash_size =hash->block_size * hash->block_num;
     key = (*hash->hash_key) (data);
-    index = key % hash_size;
 
-    idx_1d  = index / hash->block_size ;
-    idx_2d  = index % hash->block_size ;
-    if (!hash->index[idx_1d])
-    {
-        return -1;
-    }
+    tables[0] = &hash->old_table;
+    tables[1] = &hash->table;
+    hash->traversing++;
 
-    for (backet = hash->index[idx_1d][idx_2d]; backet != NULL; backet = backet->next)
+    for (i = 0; i < 2; i++)
     {
-        if ((ret = (*fn)(backet->data, data)) < 0)
-            return ret;
-    }
+        if (NULL == tables[i]->slot)
+        {
+            continue;
+        }
 
-    if (NULL == backet)
-    {
-        return 1;
+        pos = _ctc_hash_home(tables[i], key);
+        for (dist = 0; dist < tables[i]->size; dist++, pos = (pos + 1) & (tables[i]->size - 1))
+        {
+            slot = &tables[i]->slot[pos];
+            if (CTC_HASH_SLOT_IS_EMPTY(slot) || slot->dist < dist)
+            {
+                break;
+            }
+
+            if (slot->data && slot->key == key
+                && (ret = (*fn)(slot->data, data)) < 0)
+            {
+                _ctc_hash_traverse_end(hash);
+                return ret;
+            }
+        }
     }
 
-    return 0;
+    _ctc_hash_traverse_end(hash);
+    return 1;
 }
 
 
@@ -206,13 +555,11 @@ ctc_hash_traverse2(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
 int32
 ctc_hash_traverse_through(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
 {
+    ctc_hash_table_t *tables[2];
+    ctc_hash_slot_t *slot = NULL;
     uint32 count = 0;
-    uint16 index1 = 0;
-    uint16 index2 = 0;
-    uint32 hash_size = 0;
-    ctc_hash_backet_t *backet = NULL;
-    ctc_hash_backet_t *backet_next = NULL;
-
+    uint32 i = 0;
+    uint32 pos = 0;
     int32 ret = 0;
 
     if (!hash)
@@ -224,37 +571,36 @@ ctc_hash_traverse_through(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
     }
     count = hash->count;
 
-    hash_size =hash->block_size * hash->block_num;
+    tables[0] = &hash->old_table;
+    tables[1] = &hash->table;
+    hash->traversing++;
 
-    for (index1 = 0; index1 < hash->block_num; index1++)
+    for (i = 0; i < 2; i++)
     {
-        if (!hash->index[index1])
-        {
-            continue;
-        }
-        for (index2 = 0; index2 < hash->block_size; index2++)
+        for (pos = 0; pos < tables[i]->size; pos++)
         {
-            if (!hash->index[index1][index2])
+            slot = &tables[i]->slot[pos];
+            if (NULL == slot->data)
             {
                 continue;
             }
 
-            for (backet = hash->index[index1][index2]; backet != NULL; backet = backet_next)
+            count--;
+            if ((ret = (*fn)(slot->data, data)) < 0)
             {
-                backet_next = backet->next;
-                count--;
-                if ((ret = (*fn)(backet->data, data)) < 0)
-                {
-                    return ret;
-                }
+                _ctc_hash_traverse_end(hash);
+                return ret;
+            }
 
-                if (count == 0)
-                {
-                    return 0;
-                }
+            if (count == 0)
+            {
+                _ctc_hash_traverse_end(hash);
+                return 0;
             }
         }
     }
+
+    _ctc_hash_traverse_end(hash);
     return 0;
 
 }
@@ -262,54 +608,34 @@ ctc_hash_traverse_through(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
 void *
 ctc_hash_insert (ctc_hash_t *hash, void *data)
 {
-    uint32 key = 0;
-    uint32 index = 0;
-    uint32 hash_size = 0;
-    uint16 idx_1d = 0;
-    uint16 idx_2d = 0;
-    ctc_hash_backet_t *backet = NULL;
-
-
     if (!hash)
         return NULL;
 
-    key = (*hash->hash_key) (data);
-    hash_size =hash->block_size * hash->block_num;
-    index = key % hash_size;
-    idx_1d  = index / hash->block_size ;
-    idx_2d  = index % hash->block_size ;
-    if ( idx_1d >= hash->block_num)
+    /* entries left pending by an earlier merge go in first */
+    if (!hash->traversing && hash->pending.slot)
     {
-        return NULL;
+        _ctc_hash_pending_merge(hash);
     }
-    if (!hash->index[idx_1d])
+
+    /* a Robin Hood insert shifts slots, keep them still for the traversal */
+    if (hash->traversing || hash->pending.slot)
     {
-        hash->index[idx_1d] = (void *)mem_malloc(MEM_VECTOR_MODULE,
-                                                         hash->block_size * sizeof(void *));
-        if ( hash->index[idx_1d])
-         {
-            kal_memset( hash->index[idx_1d], 0,  hash->block_size * sizeof(void *));
+        if (NULL == _ctc_hash_pending_add(hash, data))
+        {
+            return NULL;
         }
-
+        hash->count++;
+        return data;
     }
-    if (!hash->index[idx_1d])
+
+    hash->count++;
+    if (NULL == _ctc_hash_add(hash, data))
     {
+        hash->count--;
         return NULL;
     }
 
-    backet = mem_malloc (MEM_HASH_MODULE, sizeof (ctc_hash_backet_t));
-    if (!backet)
-        return NULL;
-
-    backet->data = data;
-    backet->key = key;
-    backet->next = hash->index[idx_1d][idx_2d];
-
-    hash->index[idx_1d][idx_2d] = backet;
-
-    hash->count++;
-
-    return backet->data;
+    return data;
 }
 
 int32
@@ -323,157 +649,132 @@ void *
 ctc_hash_remove (ctc_hash_t *hash, void *data)
 {
    uint32 key = 0;
-   uint32 index = 0;
-   uint32 hash_size = 0;
-   uint16 idx_1d = 0;
-   uint16 idx_2d = 0;
-   ctc_hash_backet_t *backet = NULL;
-   ctc_hash_backet_t *backet_next= NULL;
-
-   hash_size =hash->block_size* hash->block_num;
-   key = (*hash->hash_key) (data);
-   index = key % hash_size;
-   idx_1d  = index / hash->block_size ;
-   idx_2d  = index % hash->block_size ;
+   ctc_hash_table_t *table = NULL;
+   ctc_hash_slot_t *slot = NULL;
 
-   if (!hash->index[idx_1d])
-   {
-        return NULL;
-   }
+   if (!hash)
+       return NULL;
 
-   for (backet = hash->index[idx_1d][idx_2d],backet_next = backet?backet->next:NULL;
-       backet; backet = backet_next, backet_next = backet?backet->next:NULL)
+   key = (*hash->hash_key) (data);
+   slot = _ctc_hash_find(hash, key, data, &table);
+   if (NULL == slot)
    {
-      if ( backet->key == key
-           && (*hash->hash_cmp) (backet->data, data) == TRUE )
-        { /*head node*/
-           hash->index[idx_1d][idx_2d] =  backet_next;
-           mem_free(backet);
-           hash->count--;
-           return data;
+        slot = _ctc_hash_table_find(hash, &hash->pending, key, data);
+        if (NULL == slot)
+        {
+            return NULL;
         }
-
-       if (backet_next
-         && backet_next->key == key
-           && (*hash->hash_cmp) (backet_next->data, data) == TRUE)
-       {
-           backet->next = backet_next->next;
-           mem_free(backet_next);
-           hash->count--;
-           return data;
-       }
+        _ctc_hash_table_del(hash, &hash->pending, slot);
+        return data;
    }
-   return NULL;
+
+   _ctc_hash_table_del(hash, table, slot);
+
+   _ctc_hash_migrate(hash, hash->migrate_step);
+   _ctc_hash_check_size(hash, hash->count);
+
+   return data;
 }
 
 void
 ctc_hash_traverse_remove(ctc_hash_t *hash, hash_traversal_fn fn, void *data)
 {
-    uint16 index1 = 0;
-    uint16 index2 = 0;
-    ctc_hash_backet_t *backet = NULL;
-    ctc_hash_backet_t *backet_next = NULL;
-
-    for (index1 = 0; index1 < hash->block_num; index1++)
-    {
-       if (!hash->index[index1])
-       {
-           continue;
-       }
-       for (index2 = 0; index2 < hash->block_size; index2++)
-       {
-           for (backet = hash->index[index1][index2], backet_next = backet?backet->next:NULL;
-               backet;     backet = backet_next, backet_next = backet?backet->next:NULL)
-           {
-               if ((backet == hash->index[index1][index2]) && (*fn) (backet->data, data) == TRUE)
-               {
-                    hash->index[index1][index2] =  backet_next;
-                    mem_free(backet);
-                    hash->count--;
-
-                    if ( hash->count == 0)
-                    {
-                       return;
-                    }
-                    continue;
-               }
-
-               if (backet_next && ((*fn) (backet_next->data, data) == TRUE))
-               {
-                    backet->next = backet_next->next;
-                    mem_free(backet_next);
-                    backet_next = backet;
-                    hash->count--;
-                    if (hash->count == 0)
-                    {
-                       return;
-                    }
-               }
-
-           }
-       }
+    ctc_hash_table_t *tables[2];
+    ctc_hash_slot_t *slot = NULL;
+    uint32 i = 0;
+    uint32 pos = 0;
+
+    if (!hash || hash->count == 0)
+    {
+        return;
     }
+
+    tables[0] = &hash->old_table;
+    tables[1] = &hash->table;
+    hash->traversing++;
+
+    for (i = 0; i < 2; i++)
+    {
+        for (pos = 0; pos < tables[i]->size; pos++)
+        {
+            slot = &tables[i]->slot[pos];
+            if (slot->data && (*fn) (slot->data, data) == TRUE)
+            {
+                _ctc_hash_table_del(hash, tables[i], slot);
+                if (hash->count == 0)
+                {
+                    _ctc_hash_traverse_end(hash);
+                    return;
+                }
+            }
+        }
+    }
+
+    _ctc_hash_traverse_end(hash);
 }
 
-/* Traverse hash special array according to KEY */
+/* Traverse the entries with the same KEY as data */
 void
 ctc_hash_traverse2_remove(ctc_hash_t* hash, hash_traversal_fn fn,void *data)
 {
+    ctc_hash_table_t *tables[2];
+    ctc_hash_slot_t *slot = NULL;
     uint32 key = 0;
-    uint32 index = 0;
-    uint32 hash_size = 0;
-    uint16 idx_1d = 0;
-    uint16 idx_2d = 0;
-    ctc_hash_backet_t *backet = NULL;
-    ctc_hash_backet_t *backet_next = NULL;
+    uint32 i = 0;
+    uint32 pos = 0;
+    uint32 dist = 0;
 
     if (!hash)
     {
         return;
     }
-    hash_size =hash->block_size * hash->block_num;
     key = (*hash->hash_key) (data);
-    index = key % hash_size;
 
-    idx_1d  = index / hash->block_size ;
-    idx_2d  = index % hash->block_size ;
-    if (!hash->index[idx_1d])
-    {
-        return;
-    }
-
-    for (backet = hash->index[idx_1d][idx_2d], backet_next = backet?backet->next:NULL;
-           backet; backet = backet_next, backet_next = backet?backet->next:NULL)
-    {
-        (*fn) (backet->data, data);
-    }
-}
-
-void ctc_hash_free (ctc_hash_t * hash)
-{
-    uint16 index1 = 0;
-    uint16 index2 = 0;
-    ctc_hash_backet_t *backet = NULL;
-    ctc_hash_backet_t *backet_next = NULL;
+    tables[0] = &hash->old_table;
+    tables[1] = &hash->table;
+    hash->traversing++;
 
-    for (index1 = 0; index1 < hash->block_num; index1++)
+    for (i = 0; i < 2; i++)
     {
-        if (!hash->index[index1])
+        if (NULL == tables[i]->slot)
         {
             continue;
         }
-        for (index2 = 0; index2 <  hash->block_size; index2++)
+
+        pos = _ctc_hash_home(tables[i], key);
+        for (dist = 0; dist < tables[i]->size; dist++, pos = (pos + 1) & (tables[i]->size - 1))
         {
-            for (backet = hash->index[index1][index2] ; backet; backet = backet_next)
+            slot = &tables[i]->slot[pos];
+            if (CTC_HASH_SLOT_IS_EMPTY(slot) || slot->dist < dist)
             {
-                backet_next = backet->next;
-                mem_free (backet);
+                break;
             }
 
+            if (slot->data && slot->key == key)
+            {
+                (*fn) (slot->data, data);
+            }
         }
-        mem_free ( hash->index[index1]);
     }
-    mem_free ( hash->index);
-    mem_free ( hash);
+
+    _ctc_hash_traverse_end(hash);
 }
 
+void ctc_hash_free (ctc_hash_t * hash)
+{
+    if (!hash)
+    {
+        return;
+    }
+
+    if (hash->old_table.slot)
+    {
+        mem_free(hash->old_table.slot);
+    }
+    if (hash->pending.slot)
+    {
+        mem_free(hash->pending.slot);
+    }
+    mem_free(hash->table.slot);
+    mem_free(hash);
+}
@@ -45,6 +45,14 @@
 extern int32
 ctc_humber_port_init(void* port_global_cfg);
 
+/**
+ @brief De-initialize the port module
+ @return CTC_E_XXX
+
+*/
+extern int32
+ctc_humber_port_deinit(void);
+
 /**
  @brief Set port whether the tranmist is enable
 
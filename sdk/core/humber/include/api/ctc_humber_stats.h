@@ -57,6 +57,15 @@
 extern int32
 ctc_humber_stats_init(void* stats_global_cfg);
 
+/**
+ @brief De-initialize the statistics module
+
+ @return CTC_E_XXX
+
+*/
+extern int32
+ctc_humber_stats_deinit(void);
+
 
 
 
@@ -692,6 +692,33 @@ struct sys_aclqos_entry_s
 typedef struct sys_aclqos_entry_s sys_aclqos_entry_t;
 typedef struct sys_aclqos_entry_s sys_acl_entry_t;
 
+/* The used entries of a block are split in SYS_ACL_DEFRAG_BAND_NUM bands by
+   rank; the defragmenter gives each band a share of the free entries that
+   follows the inserts it received, once a run of used entries gets longer
+   than SYS_ACL_DEFRAG_RUN_MAX */
+#define SYS_ACL_DEFRAG_BAND_NUM   16
+#define SYS_ACL_DEFRAG_RUN_MAX    16
+
+/* A batch reserve opens each hole by shifting toward the nearest free entry,
+   batches bigger than SYS_ACL_RESERVE_LOCAL_MAX, or a hole whose nearest free
+   entry is more than SYS_ACL_RESERVE_SHIFT_MAX rows away, fall back to
+   re-spreading the block. One reserve moves at most SYS_ACL_RESERVE_MOVE_MAX
+   rows, the inserts shift for themselves past that */
+#define SYS_ACL_RESERVE_LOCAL_MAX 32
+#define SYS_ACL_RESERVE_SHIFT_MAX 32
+#define SYS_ACL_RESERVE_MOVE_MAX  256
+
+struct sys_acl_block_stats_s
+{
+    uint32 insert_count;      /* entries inserted */
+    uint32 insert_moves;      /* rows moved to make room for inserts */
+    uint32 insert_moves_max;  /* most rows moved by one insert */
+    uint32 defrag_count;      /* defrag passes completed */
+    uint32 defrag_moves;      /* rows moved by the defragmenter */
+    uint32 move_count;        /* all rows moved */
+};
+typedef struct sys_acl_block_stats_s sys_acl_block_stats_t;
+
 struct sys_acl_block_s
 {
     uint8                   block_number; /* physical block 0~4*/
@@ -701,10 +728,17 @@ struct sys_acl_block_s
     uint16                  entry_dft_max;
     uint16                  free_count;   /* entry count left on each block*/
     sys_aclqos_entry_t**    entries;      /* pointer to entry*/
+    uint16*                 free_tree;    /* fenwick tree of free entries in [0, entry_count), 1-based */
+    uint16                  used_run_max; /* longest run of used entries in [0, entry_count) */
+    uint8                   used_run_dirty; /* used_run_max may be too big, rescan before use */
 
     uint8                   lchip;
     uint16                  after_0_cnt;  /* entry_count < SYS_ACL_REMEMBER_BASE */
     uint16                  after_1_cnt;  /* entry_count < SYS_ACL_REMEMBER_BASE */
+
+    uint32                  insert_hits[SYS_ACL_DEFRAG_BAND_NUM]; /* inserts per rank band, halved by each defrag */
+    uint8                   defrag_active;
+    sys_acl_block_stats_t   stats;
 };
 typedef struct sys_acl_block_s sys_acl_block_t;
 
@@ -845,6 +879,16 @@ sys_humber_show_aclqos_entry_id(uint32 entry_id);
 extern int32
 sys_humber_show_aclqos_block(int32 asic_type);
 
+extern int32
+sys_humber_aclqos_entry_reserve(ctc_aclqos_key_type_t key_type, const uint32* p_entry_id,
+                                const uint32* p_after_entry_id, uint32 count);
+
+extern int32
+sys_humber_aclqos_entry_defrag(uint32 max_moves, uint32* p_moves);
+
+extern int32
+sys_humber_aclqos_entry_get_block_stats(int32 asic_type, sys_acl_block_stats_t* p_stats);
+
 #endif
 
 
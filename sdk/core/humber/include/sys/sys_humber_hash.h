@@ -25,6 +25,13 @@
  @{
 */
 
+/**
+ @brief build the lookup tables of the bucket hashes, hashes computed before
+        it fall back to the bit by bit arithmetic
+*/
+extern int32
+sys_humber_hash_init(void);
+
 /**
  @brief left bucket mac hash arithmetic
 */
@@ -117,19 +117,12 @@ struct sys_humber_opf_s
 typedef  struct sys_humber_opf_s sys_humber_opf_t;
 
 
-struct sys_humber_opf_entry_s
- {
-     struct sys_humber_opf_entry_s *prev;
-     struct sys_humber_opf_entry_s *next;
-     uint32 size;
-     uint32 offset;
- };
-typedef struct sys_humber_opf_entry_s sys_humber_opf_entry_t;
+/* free offset bitmap and its segment tree, see sys_humber_opf.c */
+typedef struct sys_humber_opf_pool_s sys_humber_opf_pool_t;
 
 struct sys_humber_opf_master_s
 {
-    sys_humber_opf_entry_t ***ppp_opf_pre;
-    sys_humber_opf_entry_t ***ppp_opf_rev;
+    sys_humber_opf_pool_t ***ppp_opf_pool;
     uint32             *start_offset_a[MAX_OPF_TBL_NUM];
     uint32             *max_size_a[MAX_OPF_TBL_NUM];
     uint32             *max_offset_for_pre_alloc[MAX_OPF_TBL_NUM];
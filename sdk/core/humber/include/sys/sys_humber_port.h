@@ -169,6 +169,9 @@ typedef struct sys_port_master_s sys_port_master_t;
 extern int32
 sys_humber_port_init(void);
 
+extern int32
+sys_humber_port_deinit(void);
+
 extern int32
 sys_humber_port_set_global_port(uint8 chip_id, uint8 lport, uint16 gl_port);
 extern int32
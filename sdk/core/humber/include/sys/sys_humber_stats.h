@@ -276,6 +276,9 @@ typedef struct sys_stats_fwd_stats_s sys_stats_fwd_stats_t;
 extern int32
 sys_humber_stats_init(void);
 
+extern int32
+sys_humber_stats_deinit(void);
+
 /*Mac Based Stats*/
 extern int32
 sys_humber_stats_set_mac_packet_length_mtu1(uint16 gport, uint16 length);
@@ -373,6 +376,9 @@ sys_humber_stats_delete_statsptr(uint8 lchip, uint8 stats_szie, uint16 stats_ptr
 extern int32
 sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t* p_stats);
 extern int32
+sys_humber_stats_get_flow_stats_bulk(uint8 lchip, const uint16* p_stats_ptr, uint32 count,
+                                     ctc_stats_basic_t* p_stats);
+extern int32
 sys_humber_stats_reset_flow_stats(uint8 lchip, uint16 stats_ptr);
 
 extern int32
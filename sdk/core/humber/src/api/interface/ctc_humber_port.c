@@ -51,6 +51,20 @@ int32 ctc_humber_port_init(void* port_global_cfg)
     return CTC_E_NONE;
 }
 
+/**
+ @brief de-initialize the port module
+
+ @param[]
+
+ @return CTC_E_XXX
+
+*/
+int32 ctc_humber_port_deinit(void)
+{
+    CTC_ERROR_RETURN(sys_humber_port_deinit());
+    return CTC_E_NONE;
+}
+
 /**
  @brief set port whether the tranmist is enable
 
@@ -45,6 +45,20 @@ ctc_humber_stats_init(void* stats_global_cfg)
     return CTC_E_NONE;
 }
 
+/**
+ @brief De-initialize the statistics module
+
+ @return CTC_E_XXX
+
+*/
+int32
+ctc_humber_stats_deinit(void)
+{
+    CTC_ERROR_RETURN(sys_humber_stats_deinit());
+
+    return CTC_E_NONE;
+}
+
 
 /**
  @brief Set Mac base stats property
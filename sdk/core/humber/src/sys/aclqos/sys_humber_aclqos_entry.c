@@ -4322,6 +4322,202 @@ _sys_humber_aclqos_remove_sub_entry(uint8 lchip, sys_aclqos_label_t* p_label,
 
     return CTC_E_NONE;
 }
+/*
+ * The free entries of a block are kept in a fenwick tree over [0, entry_count),
+ * so the nearest free entry around an index is found in O(log n) instead of
+ * scanning pb->entries.  Default entries live above entry_count and are not
+ * tracked.
+ */
+static int32
+_sys_humber_acl_free_tree_init(sys_acl_block_t* pb)
+{
+    uint32 size;
+    int32 idx;
+
+    size = sizeof(uint16) * (pb->entry_count + 1);
+    pb->free_tree = (uint16*)mem_malloc(MEM_ACLQOS_MODULE, size);
+    if (NULL == pb->free_tree)
+    {
+        return CTC_E_NO_MEMORY;
+    }
+
+    /* every entry is free, node i covers (i - lowbit(i), i] */
+    pb->free_tree[0] = 0;
+    for (idx = 1; idx <= pb->entry_count; idx++)
+    {
+        pb->free_tree[idx] = idx & (-idx);
+    }
+
+    return CTC_E_NONE;
+}
+
+/* free the entry array of a block together with its free tree */
+static void
+_sys_humber_acl_block_free(sys_acl_block_t* pb)
+{
+    if (pb->free_tree)
+    {
+        mem_free(pb->free_tree);
+        pb->free_tree = NULL;
+    }
+
+    if (pb->entries)
+    {
+        mem_free(pb->entries);
+        pb->entries = NULL;
+    }
+}
+
+static void
+_sys_humber_acl_free_tree_update(sys_acl_block_t* pb, int32 block_index, int32 delta)
+{
+    int32 idx;
+
+    for (idx = block_index + 1; idx <= pb->entry_count; idx += idx & (-idx))
+    {
+        pb->free_tree[idx] += delta;
+    }
+}
+
+/* number of free entries in [0, block_index] */
+static int32
+_sys_humber_acl_free_tree_count(sys_acl_block_t* pb, int32 block_index)
+{
+    int32 idx;
+    int32 count = 0;
+
+    for (idx = block_index + 1; idx > 0; idx -= idx & (-idx))
+    {
+        count += pb->free_tree[idx];
+    }
+
+    return count;
+}
+
+/* index of the nth (1-based) free entry, or of the nth used entry if used */
+static int32
+_sys_humber_acl_free_tree_find(sys_acl_block_t* pb, int32 nth, bool used)
+{
+    int32 pos = 0;
+    int32 step;
+    int32 count;
+
+    for (step = 1; (step << 1) <= pb->entry_count; step <<= 1)
+    {
+        ;
+    }
+
+    for (; step > 0; step >>= 1)
+    {
+        if (pos + step > pb->entry_count)
+        {
+            continue;
+        }
+        count = used ? (step - pb->free_tree[pos + step]) : pb->free_tree[pos + step];
+        if (count < nth)
+        {
+            pos += step;
+            nth -= count;
+        }
+    }
+
+    return pos;
+}
+
+/* nearest free entry at or above block_index (smaller index), or SYS_ACL_INVALID_INDEX */
+static int32
+_sys_humber_acl_prev_free_index(sys_acl_block_t* pb, int32 block_index)
+{
+    int32 count = _sys_humber_acl_free_tree_count(pb, block_index);
+
+    return count ? _sys_humber_acl_free_tree_find(pb, count, FALSE) : SYS_ACL_INVALID_INDEX;
+}
+
+/* nearest free entry at or below block_index (bigger index), or SYS_ACL_INVALID_INDEX */
+static int32
+_sys_humber_acl_next_free_index(sys_acl_block_t* pb, int32 block_index)
+{
+    int32 count = block_index ? _sys_humber_acl_free_tree_count(pb, block_index - 1) : 0;
+
+    if (count == pb->free_count)
+    {
+        return SYS_ACL_INVALID_INDEX;
+    }
+
+    return _sys_humber_acl_free_tree_find(pb, count + 1, FALSE);
+}
+
+/* first used entry of the block, or SYS_ACL_INVALID_INDEX */
+static int32
+_sys_humber_acl_first_used_index(sys_acl_block_t* pb)
+{
+    if (pb->free_count == pb->entry_count)
+    {
+        return SYS_ACL_INVALID_INDEX;
+    }
+
+    return _sys_humber_acl_free_tree_find(pb, 1, TRUE);
+}
+
+/* length of the run of used entries through block_index, which must be used */
+static uint32
+_sys_humber_acl_used_run_at(sys_acl_block_t* pb, int32 block_index)
+{
+    int32 total = _sys_humber_acl_free_tree_count(pb, pb->entry_count - 1);
+    int32 count;
+    int32 prev = -1;
+    int32 next = pb->entry_count;
+
+    count = block_index ? _sys_humber_acl_free_tree_count(pb, block_index - 1) : 0;
+    if (count)
+    {
+        prev = _sys_humber_acl_free_tree_find(pb, count, FALSE);
+    }
+    if (count < total)
+    {
+        next = _sys_humber_acl_free_tree_find(pb, count + 1, FALSE);
+    }
+
+    return next - prev - 1;
+}
+
+/* set pb->entries[block_index], keeping the free tree and used_run_max in sync */
+static void
+_sys_humber_acl_block_set_entry(sys_acl_block_t* pb, int32 block_index, sys_aclqos_entry_t* p_entry)
+{
+    uint32 run;
+
+    if ((block_index < pb->entry_count)
+        && ((NULL == pb->entries[block_index]) != (NULL == p_entry)))
+    {
+        if (!pb->free_tree)
+        {
+            pb->used_run_dirty = 1;
+        }
+        else if (p_entry)
+        {
+            /* a filled entry joins the runs on both sides of it */
+            _sys_humber_acl_free_tree_update(pb, block_index, -1);
+            run = _sys_humber_acl_used_run_at(pb, block_index);
+            if (run > pb->used_run_max)
+            {
+                pb->used_run_max = run;
+            }
+        }
+        else
+        {
+            /* a cleared entry splits its run, only the longest one matters */
+            if (_sys_humber_acl_used_run_at(pb, block_index) >= pb->used_run_max)
+            {
+                pb->used_run_dirty = 1;
+            }
+            _sys_humber_acl_free_tree_update(pb, block_index, 1);
+        }
+    }
+
+    pb->entries[block_index] = p_entry;
+}
+
 /**
  @brief add acl/qos entry into entry list in the given label
 */
@@ -4332,15 +4528,19 @@ _sys_humber_aclqos_add_entry_to_db(sys_acl_block_t* pb, sys_aclqos_entry_t* p_en
     ctc_list_pointer_t *p_list = NULL;
     sys_aclqos_label_t* p_label;
 
+    /* add to hash */
+    if (NULL == ctc_hash_insert(acl_master->entry, p_entry))
+    {
+        return CTC_E_NO_MEMORY;
+    }
+
     p_label = p_entry->p_label;
     p_index = p_label->p_index[0];
     p_list = &p_index->entry_list[p_entry->key.type];
     ctc_list_pointer_insert_tail(p_list, &p_entry->head);
-    
-    /* add to hash */
-    ctc_hash_insert(acl_master->entry, p_entry);
+
     /* add to block */
-    pb->entries[p_entry->block_index] = p_entry;
+    _sys_humber_acl_block_set_entry(pb, p_entry->block_index, p_entry);
 
     /* free_count-- */
     /* ingore the default entry */
@@ -4406,7 +4606,7 @@ _sys_humber_aclqos_remove_entry_from_db(sys_acl_block_t* pb, sys_aclqos_entry_t*
     ctc_hash_remove(acl_master->entry, p_entry);
 
     /* remove from block */
-    pb->entries[p_entry->block_index] = NULL;
+    _sys_humber_acl_block_set_entry(pb, p_entry->block_index, NULL);
 
     /* free_count++ */
     /* ingore the default entry */
@@ -4429,6 +4629,7 @@ static int32
 _sys_humber_aclqos_entry_write(sys_acl_block_t* pb, sys_aclqos_entry_t* p_entry)
 {
     sys_aclqos_sub_entry_info_t info;
+    int32 ret;
 
     CTC_PTR_VALID_CHECK(p_entry);
 
@@ -4441,7 +4642,12 @@ _sys_humber_aclqos_entry_write(sys_acl_block_t* pb, sys_aclqos_entry_t* p_entry)
         _sys_humber_aclqos_write_entry_to_chip(0, p_entry->p_label, p_entry, &info));
 
     /* add to db */
-    CTC_ERROR_RETURN(_sys_humber_aclqos_add_entry_to_db(pb, p_entry));
+    ret = _sys_humber_aclqos_add_entry_to_db(pb, p_entry);
+    if (CTC_E_NONE != ret)
+    {
+        _sys_humber_aclqos_remove_sub_entry(0, p_entry->p_label, p_entry);
+        return ret;
+    }
 
     return CTC_E_NONE;
 }
@@ -6190,11 +6396,12 @@ _sys_humber_acl_entry_move(sys_acl_entry_t* pe, int32 amount)
 
     /* Move the hardware entry.*/
     CTC_ERROR_RETURN(_sys_humber_acl_entry_move_hw(pe, tcam_idx_new));
+    pb->stats.move_count++;
 
     /* Move the software entry.*/
 
-    pb->entries[tcam_idx_old] = NULL;
-    pb->entries[tcam_idx_new] = pe;
+    _sys_humber_acl_block_set_entry(pb, tcam_idx_old, NULL);
+    _sys_humber_acl_block_set_entry(pb, tcam_idx_new, pe);
     pe->block_index = tcam_idx_new;
 
     return (CTC_E_NONE);
@@ -6274,6 +6481,77 @@ typedef struct
 
 }_fpa_target_t;
 
+/*
+ *move entries to their target index, an entry only moves when no other
+ *entry sits between its old and target index, so the entries keep their
+ *order and every move is make-before-break. Stops after max_moves moves,
+ **p_left returns the number of entries still off target.
+ */
+static int32
+_sys_humber_acl_move_to_target(sys_acl_block_t* pb, _fpa_target_t* target_a, uint32 real_num,
+                               uint32 max_moves, uint32* p_left)
+{
+    int32   idx;
+    uint32  left_num;
+    uint32  move_num = 0;
+    uint8   move_ok;
+
+    left_num   = real_num;
+    while (left_num && move_num < max_moves) /* move_num */
+    {
+        SYS_ACL_DBG_INFO("left_num %d, real_num %d\n", left_num, real_num);
+
+        for(idx = 0; idx < left_num && move_num < max_moves; idx++)
+        {
+            move_ok  = 0;
+
+            if (target_a[idx].o_idx == target_a[idx].t_idx) /* stay */
+            {
+                SYS_ACL_DBG_INFO("stay !\n");
+                kal_memmove(&target_a[idx], &target_a[idx+1], (left_num - idx -1)*sizeof(_fpa_target_t));
+                left_num--;
+                idx--;
+            }
+            else
+            {
+                if (target_a[idx].o_idx < target_a[idx].t_idx)/* move down */
+                {
+                    if ((idx == left_num - 1) || (target_a[idx + 1].o_idx > target_a[idx].t_idx))
+                    {
+                        move_ok = 1;
+                    }
+                }
+                else /* move up */
+                {
+                    if ((idx == 0)|| (target_a[idx - 1].o_idx < target_a[idx].t_idx))
+                    {
+                        move_ok = 1;
+                    }
+                }
+
+                if (move_ok)
+                {
+                    SYS_ACL_DBG_INFO(" move from %d to %d!\n", target_a[idx].o_idx, target_a[idx].t_idx);
+                    /* move idx to temp */
+                    CTC_ERROR_RETURN(_sys_humber_acl_entry_move
+                        (pb->entries[target_a[idx].o_idx], (target_a[idx].t_idx - target_a[idx].o_idx)));
+                    kal_memmove(&target_a[idx], &target_a[idx+1], (left_num - idx -1)*sizeof(_fpa_target_t));
+                    left_num--;
+                    idx--;
+                    move_num++;
+                }
+            }
+        }
+    }
+
+    if (p_left)
+    {
+        *p_left = left_num;
+    }
+
+    return CTC_E_NONE;
+}
+
 static int32
 _sys_humber_acl_reorder(sys_acl_block_t* pb, int32 bottom_idx, uint8 extra_num)
 {
@@ -6282,14 +6560,12 @@ _sys_humber_acl_reorder(sys_acl_block_t* pb, int32 bottom_idx, uint8 extra_num)
     int32   o_idx;
     _fpa_target_t* target_a = NULL;
     int32   ret = 0;
-    uint8   move_ok;
 /*    static double time;*/
 /*    clock_t begin,end;*/
 
     uint32  full_num;
     uint32  real_num;            /* actual entry number */
     uint32  free_num;
-    uint32  left_num;
 
 /*    begin = clock();*/
     CTC_PTR_VALID_CHECK(pb);
@@ -6326,64 +6602,192 @@ _sys_humber_acl_reorder(sys_acl_block_t* pb, int32 bottom_idx, uint8 extra_num)
         }
     }
 
-    left_num   = real_num;
-    while (left_num) /* move_num */
+    CTC_ERROR_GOTO(_sys_humber_acl_move_to_target(pb, target_a, real_num, 0xFFFFFFFF, NULL), ret, cleanup);
+
+    mem_free(target_a);
+
+/*    end = clock();*/
+/*    time = time + ((double)(end - begin) / CLOCKS_PER_SEC);*/
+/*    SYS_ACL_DBG_INFO(" t:%lf", time);*/
+
+    return CTC_E_NONE;
+
+cleanup:
+    mem_free(target_a);
+    return ret;
+}
+
+/*
+ *length of the longest run of used entries in the block, the block is only
+ *scanned when an entry of the longest run was cleared since the last scan
+ */
+static uint32
+_sys_humber_acl_longest_used_run(sys_acl_block_t* pb)
+{
+    int32  idx;
+    uint32 run = 0;
+    uint32 run_max = 0;
+
+    if (!pb->used_run_dirty)
     {
-        SYS_ACL_DBG_INFO("left_num %d, real_num %d\n", left_num, real_num);
+        return pb->used_run_max;
+    }
 
-        for(idx = 0; idx < left_num; idx++)
+    for (idx = 0; idx < pb->entry_count; idx++)
+    {
+        if (pb->entries[idx])
         {
-            move_ok  = 0;
-
-            if (target_a[idx].o_idx == target_a[idx].t_idx) /* stay */
+            run++;
+            if (run > run_max)
             {
-                SYS_ACL_DBG_INFO("stay !\n");
-                kal_memmove(&target_a[idx], &target_a[idx+1], (left_num - idx -1)*sizeof(_fpa_target_t));
-                left_num--;
-                idx--;
+                run_max = run;
             }
-            else
-            {
-                if (target_a[idx].o_idx < target_a[idx].t_idx)/* move down */
-                {
-                    if ((idx == left_num - 1) || (target_a[idx + 1].o_idx > target_a[idx].t_idx))
-                    {
-                        move_ok = 1;
-                    }
-                }
-                else /* move up */
-                {
-                    if ((idx == 0)|| (target_a[idx - 1].o_idx > target_a[idx].t_idx))
-                    {
-                        move_ok = 1;
-                    }
-                }
+        }
+        else
+        {
+            run = 0;
+        }
+    }
 
-                if (move_ok)
-                {
-                    SYS_ACL_DBG_INFO(" move from %d to %d!\n", target_a[idx].o_idx, target_a[idx].t_idx);
-                    /* move idx to temp */
-                    CTC_ERROR_GOTO(_sys_humber_acl_entry_move
-                        (pb->entries[target_a[idx].o_idx], (target_a[idx].t_idx - target_a[idx].o_idx)), ret, cleanup);
-                    kal_memmove(&target_a[idx], &target_a[idx+1], (left_num - idx -1)*sizeof(_fpa_target_t));
-                    left_num--;
-                    idx--;
-                }
-            }
+    pb->used_run_max = run_max;
+    pb->used_run_dirty = 0;
+
+    return run_max;
+}
+
+/*
+ *plan the target of every used entry, band b gets a share of the free
+ *entries weighted by insert_hits[b] plus an even base share, spread
+ *evenly between the entries of the band
+ */
+static void
+_sys_humber_acl_defrag_plan(sys_acl_block_t* pb, _fpa_target_t* target_a, uint32 real_num)
+{
+    uint32 band_num[SYS_ACL_DEFRAG_BAND_NUM];
+    uint32 band_gap[SYS_ACL_DEFRAG_BAND_NUM];
+    uint32 weight[SYS_ACL_DEFRAG_BAND_NUM];
+    uint32 hits = 0;
+    uint32 weight_sum = 0;
+    uint32 gap_sum = 0;
+    uint32 gap_base = 0;
+    uint32 last = 0;
+    uint32 band;
+    uint32 rank;
+    uint32 nth = 0;
+    int32  idx;
+
+    kal_memset(band_num, 0, sizeof(band_num));
+    kal_memset(band_gap, 0, sizeof(band_gap));
+    kal_memset(weight, 0, sizeof(weight));
+
+    for (rank = 0; rank < real_num; rank++)
+    {
+        band_num[(rank * SYS_ACL_DEFRAG_BAND_NUM) / real_num]++;
+    }
+
+    for (band = 0; band < SYS_ACL_DEFRAG_BAND_NUM; band++)
+    {
+        hits += pb->insert_hits[band];
+    }
+
+    for (band = 0; band < SYS_ACL_DEFRAG_BAND_NUM; band++)
+    {
+        if (band_num[band])
+        {
+            weight[band] = pb->insert_hits[band] + (hits / SYS_ACL_DEFRAG_BAND_NUM) + 1;
+            weight_sum += weight[band];
+            last = band;
         }
     }
 
-    mem_free(target_a);
+    for (band = 0; band < SYS_ACL_DEFRAG_BAND_NUM; band++)
+    {
+        band_gap[band] = (uint32)(((uint64)pb->free_count * weight[band]) / weight_sum);
+        gap_sum += band_gap[band];
+    }
+    band_gap[last] += pb->free_count - gap_sum;
 
-/*    end = clock();*/
-/*    time = time + ((double)(end - begin) / CLOCKS_PER_SEC);*/
-/*    SYS_ACL_DBG_INFO(" t:%lf", time);*/
+    rank = 0;
+    band = 0;
+    for (idx = 0; idx < pb->entry_count; idx++)
+    {
+        if (!pb->entries[idx])
+        {
+            continue;
+        }
 
-    return CTC_E_NONE;
+        while (nth >= band_num[band])
+        {
+            gap_base += band_gap[band];
+            nth = 0;
+            band++;
+        }
+
+        target_a[rank].o_idx = idx;
+        target_a[rank].t_idx = rank + gap_base + (band_gap[band] * (nth + 1)) / (band_num[band] + 1);
+        rank++;
+        nth++;
+    }
+}
+
+/*
+ *move at most max_moves entries of the block towards the defrag plan
+ */
+static int32
+_sys_humber_acl_defrag_block(sys_acl_block_t* pb, uint32 max_moves, uint32* p_moves)
+{
+    _fpa_target_t* target_a = NULL;
+    uint32  real_num;
+    uint32  left_num = 0;
+    uint32  move_count;
+    uint32  band;
+    int32   ret = CTC_E_NONE;
+
+    *p_moves = 0;
+
+    real_num = pb->entry_count - pb->free_count;
+    if (!pb->entries || !real_num || !pb->free_count)
+    {
+        pb->defrag_active = 0;
+        return CTC_E_NONE;
+    }
+
+    if (!pb->defrag_active)
+    {
+        if (_sys_humber_acl_longest_used_run(pb) <= SYS_ACL_DEFRAG_RUN_MAX)
+        {
+            return CTC_E_NONE;
+        }
+        pb->defrag_active = 1;
+    }
+
+    target_a = (_fpa_target_t*) mem_malloc(MEM_ACLQOS_MODULE, real_num * sizeof(_fpa_target_t));
+    if (!target_a)
+    {
+        return CTC_E_NO_MEMORY;
+    }
+
+    _sys_humber_acl_defrag_plan(pb, target_a, real_num);
+
+    move_count = pb->stats.move_count;
+    ret = _sys_humber_acl_move_to_target(pb, target_a, real_num, max_moves, &left_num);
+    *p_moves = pb->stats.move_count - move_count;
+    pb->stats.defrag_moves += *p_moves;
 
-cleanup:
     mem_free(target_a);
-    return ret;
+    CTC_ERROR_RETURN(ret);
+
+    if (!left_num)
+    {
+        pb->defrag_active = 0;
+        pb->stats.defrag_count++;
+        for (band = 0; band < SYS_ACL_DEFRAG_BAND_NUM; band++)
+        {
+            pb->insert_hits[band] >>= 1;
+        }
+    }
+
+    return CTC_E_NONE;
 }
 
 static int32
@@ -6530,6 +6934,25 @@ _sys_humber_acl_magic_reorder(sys_acl_block_t* pb, uint32 after_entry_id)
 }
 
 
+/*
+ *count an insert at target_idx against the band of its rank
+ */
+static void
+_sys_humber_acl_record_insert(sys_acl_block_t* pb, int32 target_idx)
+{
+    uint32 used;
+    uint32 rank;
+
+    if ((target_idx < 0) || (target_idx >= pb->entry_count))
+    {
+        return;
+    }
+
+    used = pb->entry_count - pb->free_count;
+    rank = target_idx ? (target_idx - _sys_humber_acl_free_tree_count(pb, target_idx - 1)) : 0;
+    pb->insert_hits[(rank * SYS_ACL_DEFRAG_BAND_NUM) / (used + 1)]++;
+}
+
 /*
  * worst is best
  */
@@ -6582,32 +7005,15 @@ _sys_humber_acl_get_block_index(sys_acl_block_t* pb, uint32 after_entry_id,
     }
     else if (after_entry_id == CTC_ACLQOS_ENTRY_ID_HEAD)
     {
-        /*get last not null index*/
-        first_entry_idx = SYS_ACL_INVALID_INDEX;
-
-        for (idx = 0; idx < pb->entry_count; idx++)
-        {
-            if (pb->entries[idx] != NULL)
-            {
-                first_entry_idx = idx;
-                break;
-            }
-        }
+        /*get first not null index*/
+        first_entry_idx = _sys_humber_acl_first_used_index(pb);
 
         if (first_entry_idx == 0)
         {
-            next_null_idx = SYS_ACL_INVALID_INDEX;
             target_idx = 0;
 
             /* search first next NULL entry from top down */
-            for (idx = target_idx; idx < pb->entry_count; idx++)
-            {
-                if (pb->entries[idx] == NULL)
-                {
-                    next_null_idx = idx;
-                    break;
-                }
-            }
+            next_null_idx = _sys_humber_acl_next_free_index(pb, target_idx);
 
             shift_down_amount = next_null_idx - target_idx - 1;
 
@@ -6624,25 +7030,11 @@ _sys_humber_acl_get_block_index(sys_acl_block_t* pb, uint32 after_entry_id,
     {
         CTC_ERROR_RETURN(_sys_humber_acl_lookup_block_index(after_entry_id, &after_idx));
         
-        next_null_idx = SYS_ACL_INVALID_INDEX;
-        prev_null_idx = SYS_ACL_INVALID_INDEX;
-        
-        for (idx = after_idx ; idx >= 0; idx--)
-        {
-            if (pb->entries[idx] == NULL)
-            {
-                prev_null_idx = idx;
-                break;
-            }
-        }
-        for (idx = after_idx ; idx < pb->entry_count; idx++)
-        {
-            if (pb->entries[idx] == NULL)
-            {
-                next_null_idx = idx;
-                break;
-            }
-        }
+        /* plan both shift chains before touching hardware, the entries
+           between after_idx and the nearest free entry are all used, so
+           the chain to the nearest free entry is the shortest one */
+        prev_null_idx = _sys_humber_acl_prev_free_index(pb, after_idx);
+        next_null_idx = _sys_humber_acl_next_free_index(pb, after_idx);
 
         if (prev_null_idx == SYS_ACL_INVALID_INDEX)
         {
@@ -6680,6 +7072,7 @@ _sys_humber_acl_get_block_index(sys_acl_block_t* pb, uint32 after_entry_id,
         }
     }
 
+    _sys_humber_acl_record_insert(pb, target_idx);
     *block_index = target_idx;
 
     return CTC_E_NONE;
@@ -6705,6 +7098,7 @@ sys_humber_aclqos_entry_insert(uint32 label_id, ctc_aclqos_label_type_t label_ty
     sys_acl_block_t* pb = NULL;
     uint8 asic_type;
     uint16 shift_amount = 0;
+    uint32 move_count = 0;
 
     CTC_PTR_VALID_CHECK(p_ctc_entry);
     CTC_MIN_VALUE_CHECK(p_ctc_entry->entry_id, 1);
@@ -6790,6 +7184,7 @@ sys_humber_aclqos_entry_insert(uint32 label_id, ctc_aclqos_label_type_t label_ty
         }
 
         /* get entry offset */
+        move_count = pb->stats.move_count;
 
         ret = _sys_humber_acl_get_block_index(pb, entry_id, &block_index, &shift_amount);
         if (ret)
@@ -6810,6 +7205,13 @@ sys_humber_aclqos_entry_insert(uint32 label_id, ctc_aclqos_label_type_t label_ty
             _sys_humber_acl_reorder(pb, pb->entry_count - 1, 0);
         }
 
+        move_count = pb->stats.move_count - move_count;
+        pb->stats.insert_count++;
+        pb->stats.insert_moves += move_count;
+        if (move_count > pb->stats.insert_moves_max)
+        {
+            pb->stats.insert_moves_max = move_count;
+        }
     }
 
     return CTC_E_NONE;
@@ -8050,6 +8452,15 @@ _sys_humber_show_aclqos_block(sys_acl_block_t* pb)
     SYS_ACLQOS_ENTRY_DBG_INFO("lchip        : %d\n", pb->lchip);
     SYS_ACLQOS_ENTRY_DBG_INFO("after_0_cnt  : %d\n", pb->after_0_cnt);
     SYS_ACLQOS_ENTRY_DBG_INFO("after_1_cnt  : %d\n", pb->after_1_cnt);
+    SYS_ACLQOS_ENTRY_DBG_INFO("longest_run  : %u\n", _sys_humber_acl_longest_used_run(pb));
+    SYS_ACLQOS_ENTRY_DBG_INFO("insert_cnt   : %u\n", pb->stats.insert_count);
+    SYS_ACLQOS_ENTRY_DBG_INFO("insert_moves : %u (avg %u.%02u, max %u per insert)\n", pb->stats.insert_moves,
+        pb->stats.insert_count ? pb->stats.insert_moves / pb->stats.insert_count : 0,
+        pb->stats.insert_count ? (pb->stats.insert_moves * 100 / pb->stats.insert_count) % 100 : 0,
+        pb->stats.insert_moves_max);
+    SYS_ACLQOS_ENTRY_DBG_INFO("defrag       : %s, %u passes, %u moves\n",
+        pb->defrag_active ? "active" : "idle", pb->stats.defrag_count, pb->stats.defrag_moves);
+    SYS_ACLQOS_ENTRY_DBG_INFO("move_cnt     : %u\n", pb->stats.move_count);
 
     SYS_ACLQOS_ENTRY_DBG_INFO("Entries      :\n");
     SYS_ACLQOS_ENTRY_DBG_INFO(" ----- ---------- ---------- ----- ------\n");
@@ -8104,6 +8515,284 @@ sys_humber_show_aclqos_block(int32 asic_type)
     return CTC_E_NONE;
 }
 
+/*
+ *open need free entries right after the used entry of rank - 1 (before the
+ *first used entry for rank 0), shifting the entries between them and the
+ *nearest free entry one row at a time. Free entries at or above *p_floor_idx
+ *are holes kept for an earlier rank and are not used, *p_floor_idx returns
+ *the last hole opened here. Fails once a hole needs more than
+ *SYS_ACL_RESERVE_SHIFT_MAX moves or more than *p_budget.
+ */
+static int32
+_sys_humber_acl_reserve_holes(sys_acl_block_t* pb, int32 rank, uint32 need,
+                              int32* p_floor_idx, uint32* p_budget)
+{
+    int32   real_num;
+    int32   after_idx;
+    int32   next_used_idx;
+    int32   prev_null_idx;
+    int32   next_null_idx;
+    int32   shift_up_amount;
+    int32   shift_down_amount;
+
+    real_num = pb->entry_count - pb->free_count;
+
+    while (1)
+    {
+        after_idx = rank ? _sys_humber_acl_free_tree_find(pb, rank, TRUE) : SYS_ACL_INVALID_INDEX;
+        next_used_idx = (rank < real_num) ? _sys_humber_acl_free_tree_find(pb, rank + 1, TRUE) : pb->entry_count;
+
+        if ((uint32)(next_used_idx - after_idx - 1) >= need)
+        {
+            /* inserts after an entry take the rows right below it, inserts
+               at the head take the rows right above the first entry */
+            *p_floor_idx = rank ? (after_idx + (int32)need) : (next_used_idx - 1);
+            return CTC_E_NONE;
+        }
+
+        shift_up_amount = pb->entry_count;
+        if (after_idx != SYS_ACL_INVALID_INDEX)
+        {
+            prev_null_idx = _sys_humber_acl_prev_free_index(pb, after_idx);
+            if ((prev_null_idx != SYS_ACL_INVALID_INDEX) && (prev_null_idx > *p_floor_idx))
+            {
+                shift_up_amount = after_idx - prev_null_idx;
+            }
+        }
+
+        shift_down_amount = pb->entry_count;
+        if (next_used_idx < pb->entry_count)
+        {
+            next_null_idx = _sys_humber_acl_next_free_index(pb, next_used_idx);
+            if (next_null_idx != SYS_ACL_INVALID_INDEX)
+            {
+                shift_down_amount = next_null_idx - next_used_idx;
+            }
+        }
+
+        if (shift_down_amount <= shift_up_amount)
+        {
+            if ((shift_down_amount > SYS_ACL_RESERVE_SHIFT_MAX) || (shift_down_amount > *p_budget))
+            {
+                return CTC_E_ACL_GET_BLOCK_INDEX_FAILED;
+            }
+            CTC_ERROR_RETURN(_sys_humber_acl_entry_shift_down(pb, next_used_idx, next_null_idx));
+            *p_budget -= shift_down_amount;
+        }
+        else
+        {
+            if ((shift_up_amount > SYS_ACL_RESERVE_SHIFT_MAX) || (shift_up_amount > *p_budget))
+            {
+                return CTC_E_ACL_GET_BLOCK_INDEX_FAILED;
+            }
+            CTC_ERROR_RETURN(_sys_humber_acl_entry_shift_up(pb, after_idx, prev_null_idx));
+            *p_budget -= shift_up_amount;
+        }
+    }
+}
+
+/**
+ @brief open free entries right after the entries a batch of inserts will
+        follow, so the inserts need no shift. p_entry_id and p_after_entry_id
+        give the batch in insert order, an after entry id may be one of the
+        batch. Small batches shift toward the nearest free entry, big ones or
+        crowded blocks re-spread the block, at most SYS_ACL_RESERVE_MOVE_MAX
+        rows move in all. Fails without moving anything if the block is too
+        small.
+*/
+int32
+sys_humber_aclqos_entry_reserve(ctc_aclqos_key_type_t key_type, const uint32* p_entry_id,
+                                const uint32* p_after_entry_id, uint32 count)
+{
+    sys_acl_block_t* pb = NULL;
+    sys_acl_entry_t* pe = NULL;
+    _fpa_target_t*   target_a = NULL;
+    uint32* need = NULL;   /* need[0] before the first entry, need[r + 1] after rank r */
+    int32*  anchor = NULL; /* need index of every insert, -1 if not placed in the block */
+    uint32  real_num;
+    uint32  hole_num = 0;
+    uint32  spare;
+    uint32  budget = SYS_ACL_RESERVE_MOVE_MAX;
+    uint32  i;
+    int32   j;
+    int32   idx;
+    int32   rank;
+    int32   floor_idx = SYS_ACL_INVALID_INDEX;
+    int32   ret = CTC_E_NONE;
+
+    CTC_PTR_VALID_CHECK(p_entry_id);
+    CTC_PTR_VALID_CHECK(p_after_entry_id);
+    CTC_MAX_VALUE_CHECK(key_type, MAX_CTC_ACLQOS_KEY - 1);
+    SYS_ACLQOS_ENTRY_DBG_FUNC();
+
+    pb = &acl_master->block[acl_master->asic_type[key_type]];
+    if (count > pb->free_count)
+    {
+        return CTC_E_ACL_GET_BLOCK_INDEX_FAILED;
+    }
+
+    real_num = pb->entry_count - pb->free_count;
+    if (!count || !real_num)
+    {
+        return CTC_E_NONE;
+    }
+
+    need = (uint32*)mem_malloc(MEM_ACLQOS_MODULE, (real_num + 1) * sizeof(uint32));
+    anchor = (int32*)mem_malloc(MEM_ACLQOS_MODULE, count * sizeof(int32));
+    target_a = (_fpa_target_t*)mem_malloc(MEM_ACLQOS_MODULE, real_num * sizeof(_fpa_target_t));
+    if (!need || !anchor || !target_a)
+    {
+        ret = CTC_E_NO_MEMORY;
+        goto cleanup;
+    }
+    kal_memset(need, 0, (real_num + 1) * sizeof(uint32));
+
+    for (i = 0; i < count; i++)
+    {
+        anchor[i] = -1;
+
+        if (CTC_ACLQOS_ENTRY_ID_TAIL == p_after_entry_id[i])
+        {
+            continue;
+        }
+        else if (CTC_ACLQOS_ENTRY_ID_HEAD == p_after_entry_id[i])
+        {
+            anchor[i] = 0;
+        }
+        else if (i && (p_after_entry_id[i] == p_entry_id[i - 1]))
+        {
+            anchor[i] = anchor[i - 1];
+        }
+        else
+        {
+            _sys_humber_acl_get_sys_entry_by_eid(p_after_entry_id[i], &pe);
+            if (pe && (pe->block_index < pb->entry_count) && (pb->entries[pe->block_index] == pe))
+            {
+                rank = pe->block_index - _sys_humber_acl_free_tree_count(pb, pe->block_index);
+                anchor[i] = rank + 1;
+            }
+            else
+            {
+                for (j = (int32)i - 2; j >= 0; j--)
+                {
+                    if (p_entry_id[j] == p_after_entry_id[i])
+                    {
+                        anchor[i] = anchor[j];
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (anchor[i] >= 0)
+        {
+            need[anchor[i]]++;
+            hole_num++;
+        }
+    }
+
+    if (count <= SYS_ACL_RESERVE_LOCAL_MAX)
+    {
+        for (rank = 0; rank <= (int32)real_num; rank++)
+        {
+            if (!need[rank])
+            {
+                continue;
+            }
+            ret = _sys_humber_acl_reserve_holes(pb, rank, need[rank], &floor_idx, &budget);
+            if (CTC_E_ACL_GET_BLOCK_INDEX_FAILED == ret)
+            {
+                break;
+            }
+            else if (ret < 0)
+            {
+                goto cleanup;
+            }
+        }
+
+        if (rank > (int32)real_num)
+        {
+            goto cleanup;
+        }
+    }
+
+    /* entry of rank r goes after the holes wanted before it, the spare free
+       entries are spread evenly as in _sys_humber_acl_reorder */
+    spare = pb->free_count - hole_num;
+    hole_num = 0;
+    rank = 0;
+    for (idx = 0; idx < pb->entry_count; idx++)
+    {
+        if (!pb->entries[idx])
+        {
+            continue;
+        }
+        hole_num += need[rank];
+        target_a[rank].o_idx = idx;
+        target_a[rank].t_idx = rank + hole_num + (uint32)(((uint64)spare * (rank + 1)) / (real_num + 1));
+        rank++;
+    }
+
+    ret = _sys_humber_acl_move_to_target(pb, target_a, real_num, budget, NULL);
+
+cleanup:
+    if (need)
+    {
+        mem_free(need);
+    }
+    if (anchor)
+    {
+        mem_free(anchor);
+    }
+    if (target_a)
+    {
+        mem_free(target_a);
+    }
+
+    return ret;
+}
+
+/**
+ @brief move at most max_moves acl/qos entries to reopen free entries
+        between long runs of used entries, p_moves returns the moves done
+*/
+int32
+sys_humber_aclqos_entry_defrag(uint32 max_moves, uint32* p_moves)
+{
+    uint8  asic_type;
+    uint32 moves = 0;
+
+    CTC_PTR_VALID_CHECK(p_moves);
+
+    *p_moves = 0;
+    for (asic_type = 0; asic_type < SYS_ACL_ASIC_TYPE_MAX && *p_moves < max_moves; asic_type++)
+    {
+        CTC_ERROR_RETURN(_sys_humber_acl_defrag_block(&acl_master->block[asic_type],
+                                                      max_moves - *p_moves, &moves));
+        *p_moves += moves;
+    }
+
+    return CTC_E_NONE;
+}
+
+/**
+ @brief get the placement counters of an acl/qos block
+*/
+int32
+sys_humber_aclqos_entry_get_block_stats(int32 asic_type, sys_acl_block_stats_t* p_stats)
+{
+    CTC_PTR_VALID_CHECK(p_stats);
+
+    if (asic_type < 0 || asic_type >= SYS_ACL_ASIC_TYPE_MAX)
+    {
+        return CTC_E_INVALID_PARAM;
+    }
+
+    kal_memcpy(p_stats, &acl_master->block[asic_type].stats, sizeof(sys_acl_block_stats_t));
+
+    return CTC_E_NONE;
+}
+
 int32
 sys_humber_acl_get_all_permit_entry_stats(uint32 label_id, ctc_stats_basic_t* entry_stats)
 {
@@ -8740,10 +9429,16 @@ sys_humber_aclqos_entry_init(ctc_aclqos_global_cfg_t* aclqos_global_cfg)
     uint32 fwd_opf_start_offset = 0;
     uint32 acl_head = 0, acl_tail = 0;
     uint32 pbr_head = 0, pbr_tail = 0;
+    uint8 asic_type;
     sys_acl_block_t*    pb;
 
     CTC_MAX_VALUE_CHECK(aclqos_global_cfg->entry_sort_mode, MAX_CTC_ACLQOS_ENTRY_SORT_MODE-1);
 
+    /* the blocks of an earlier init are dropped with the rest of the control */
+    for (asic_type = 0; asic_type < SYS_ACL_ASIC_TYPE_MAX; asic_type++)
+    {
+        _sys_humber_acl_block_free(&sys_aclqos_entry_ctl.block[asic_type]);
+    }
     kal_memset(&sys_aclqos_entry_ctl, 0, sizeof(sys_aclqos_entry_ctl));
 
     sys_aclqos_entry_ctl.entry_sort_mode = aclqos_global_cfg->entry_sort_mode;
@@ -8855,6 +9550,11 @@ sys_humber_aclqos_entry_init(ctc_aclqos_global_cfg_t* aclqos_global_cfg)
             return CTC_E_NO_MEMORY;
         }
         kal_memset(pb->entries, 0, size);
+        if (_sys_humber_acl_free_tree_init(pb) < 0)
+        {
+            _sys_humber_acl_block_free(pb);
+            return CTC_E_NO_MEMORY;
+        }
 
         /* mac key use IPV4's entry number */
         CTC_ERROR_RETURN(sys_alloc_get_table_entry_num(DS_QOS_IPV4_KEY, &entry_num));
@@ -8874,6 +9574,11 @@ sys_humber_aclqos_entry_init(ctc_aclqos_global_cfg_t* aclqos_global_cfg)
             return CTC_E_NO_MEMORY;
         }
         kal_memset(pb->entries, 0, size);
+        if (_sys_humber_acl_free_tree_init(pb) < 0)
+        {
+            _sys_humber_acl_block_free(pb);
+            return CTC_E_NO_MEMORY;
+        }
 
     }
     acl_master->asic_type[CTC_ACLQOS_MAC_KEY]  = SYS_ACL_ASIC_TYPE_MAC;
@@ -390,7 +390,11 @@ _sys_humber_qos_policer_profile_new(uint8 lchip, sys_qos_policer_profile_t *p_pr
     p_new_profile->ref   = 1;
     p_new_profile->index = INVALID_POLICER_PROFILE_INDEX;
 
-    ctc_hash_insert(p_sys_policer_profile_hash[lchip], p_new_profile);
+    if (NULL == ctc_hash_insert(p_sys_policer_profile_hash[lchip], p_new_profile))
+    {
+        mem_free(p_new_profile);
+        return CTC_E_NO_MEMORY;
+    }
 
     *pp_profile = p_new_profile;
 
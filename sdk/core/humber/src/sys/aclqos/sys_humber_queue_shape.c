@@ -550,7 +550,11 @@ _sys_humber_queue_shape_profile_create(uint8 lchip, sys_queue_shape_profile_t* p
     p_new_profile->ref   = 1;
     p_new_profile->index = 0;
 
-    ctc_hash_insert(p_sys_queue_shape_hash[lchip], p_new_profile);
+    if (NULL == ctc_hash_insert(p_sys_queue_shape_hash[lchip], p_new_profile))
+    {
+        mem_free(p_new_profile);
+        return CTC_E_NO_MEMORY;
+    }
 
     *pp_profile = p_new_profile;
 
@@ -946,7 +950,12 @@ _sys_humber_group_shape_profile_create(uint8 lchip, sys_group_shape_profile_t* p
     p_new_profile->ref   = 1;
     p_new_profile->index = offset;
 
-    ctc_hash_insert(p_sys_group_shape_hash[lchip], p_new_profile);
+    if (NULL == ctc_hash_insert(p_sys_group_shape_hash[lchip], p_new_profile))
+    {
+        mem_free(p_new_profile);
+        sys_humber_opf_free_offset(&opf, 1, offset);
+        return CTC_E_NO_MEMORY;
+    }
 
     *pp_profile = p_new_profile;
 
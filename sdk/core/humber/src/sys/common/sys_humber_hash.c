@@ -8,18 +8,65 @@
  The file implement hash CRC arithmetic
 */
 
+#include "ctc_error.h"
 #include "sys_humber_hash.h"
 
+/****************************************************************************
+ *
+* Defines and Macros
+*
+****************************************************************************/
+
+/*
+ * The bucket CRCs start from a zero register, so each of them is linear over
+ * the key bits: the CRC of a key is the XOR of the CRCs of its single bit keys.
+ * sys_humber_hash_init() precomputes, per key byte, the CRC of all 256 values
+ * of that byte from the bit by bit functions, a lookup then XORs one table
+ * entry per key byte.
+ */
+enum sys_hash_crc_type_e
+{
+    SYS_HASH_CRC_MAC0,
+    SYS_HASH_CRC_MAC1,
+    SYS_HASH_CRC_IPV4_0,
+    SYS_HASH_CRC_IPV4_1,
+    SYS_HASH_CRC_IPV6_0,
+    SYS_HASH_CRC_IPV6_1,
+    SYS_HASH_CRC_MAX
+};
+typedef enum sys_hash_crc_type_e sys_hash_crc_type_t;
+
+#define SYS_HASH_CRC_MAC_KEY_LEN    8
+#define SYS_HASH_CRC_IPV4_KEY_LEN   6
+#define SYS_HASH_CRC_IPV6_KEY_LEN   18
+#define SYS_HASH_CRC_TBL_ROWS       (2 * (SYS_HASH_CRC_MAC_KEY_LEN + SYS_HASH_CRC_IPV4_KEY_LEN \
+                                          + SYS_HASH_CRC_IPV6_KEY_LEN))
+
+#define SYS_HASH_CRC_MASK(bit_num)  ((1 << (8 + (bit_num))) - 1)
+
+typedef uint16 (*sys_hash_crc_bitwise_fn_t)(uint8* sed);
+
+struct sys_hash_crc_info_s
+{
+    sys_hash_crc_bitwise_fn_t bitwise;
+    uint8 key_len;
+    uint8 row;  /*first row of the type in sys_humber_hash_crc_tbl*/
+};
+typedef struct sys_hash_crc_info_s sys_hash_crc_info_t;
+
+static uint16 sys_humber_hash_crc_tbl[SYS_HASH_CRC_TBL_ROWS][256];
+static bool sys_humber_hash_crc_tbl_ready = FALSE;
+
 /**
- @brief mac hash left bucket arithmetic
+ @brief mac hash left bucket arithmetic, bit by bit
 */
-int16
-sys_humber_hash_generate_mac_hash0(uint8* sed, uint32 bit_num)
+static uint16
+_sys_humber_hash_mac_hash0_bitwise(uint8* sed)
 {
     uint8 D[64] = {0}, C[16] = {0};
     uint8 NewCRC[16] = {0};
     uint32 i ;
-    int16 result = 0;
+    uint16 result = 0;
 
     for (i = 0; i < 64; i++)
     {
@@ -95,15 +142,15 @@ sys_humber_hash_generate_mac_hash0(uint8* sed, uint32 bit_num)
                | NewCRC[7] << 7 | NewCRC[6] << 6 | NewCRC[5] << 5 | NewCRC[4] << 4
                | NewCRC[3] << 3 | NewCRC[2] << 2 | NewCRC[1] << 1 | NewCRC[0];
 
-    return  (result & ((1 << (8 + bit_num)) - 1));
+    return result;
 
 }
 
 /**
- @brief mac hash right bucket arithmetic
+ @brief mac hash right bucket arithmetic, bit by bit
 */
-int16
-sys_humber_hash_generate_mac_hash1(uint8* sed, uint32 bit_num)
+static uint16
+_sys_humber_hash_mac_hash1_bitwise(uint8* sed)
 {
     uint8 D[64] = {0}, C[16] = {0};
     uint8 NewCRC[16] = {0};
@@ -210,15 +257,15 @@ sys_humber_hash_generate_mac_hash1(uint8* sed, uint32 bit_num)
                | NewCRC[11] << 11 | NewCRC[10] << 10 | NewCRC[9] << 9 | NewCRC[8] << 8
                | NewCRC[7] << 7 | NewCRC[6] << 6 | NewCRC[5] << 5 | NewCRC[4] << 4
                | NewCRC[3] << 3 | NewCRC[2] << 2 | NewCRC[1] << 1 | NewCRC[0];
-    return (result & ((1 << (8 + bit_num)) - 1));
+    return result;
 
 }
 
 /**
- @brief ipv4 hash left bucket arithmetic
+ @brief ipv4 hash left bucket arithmetic, bit by bit
 */
-int16
-sys_humber_hash_generate_ipv4_hash0(uint8* sed, uint32 bit_num)
+static uint16
+_sys_humber_hash_ipv4_hash0_bitwise(uint8* sed)
 {
     uint8 D[48] = {0}, C[16] = {0};
     uint8 NewCRC[16] = {0};
@@ -283,15 +330,15 @@ sys_humber_hash_generate_ipv4_hash0(uint8* sed, uint32 bit_num)
                | NewCRC[11] << 11 | NewCRC[10] << 10 | NewCRC[9] << 9 | NewCRC[8] << 8
                | NewCRC[7] << 7 | NewCRC[6] << 6 | NewCRC[5] << 5 | NewCRC[4] << 4
                | NewCRC[3] << 3 | NewCRC[2] << 2 | NewCRC[1] << 1 | NewCRC[0];
-    return result & ((1 << (8 + bit_num)) - 1);
+    return result;
 
 }
 
 /**
- @brief ipv4 hash right bucket arithmetic
+ @brief ipv4 hash right bucket arithmetic, bit by bit
 */
-int16
-sys_humber_hash_generate_ipv4_hash1(uint8* sed, uint32 bit_num)
+static uint16
+_sys_humber_hash_ipv4_hash1_bitwise(uint8* sed)
 {
     uint8 D[48] = {0}, C[16] = {0};
     uint8 NewCRC[16] = {0};
@@ -365,14 +412,14 @@ sys_humber_hash_generate_ipv4_hash1(uint8* sed, uint32 bit_num)
                | NewCRC[11] << 11 | NewCRC[10] << 10 | NewCRC[9] << 9 | NewCRC[8] << 8
                | NewCRC[7] << 7 | NewCRC[6] << 6 | NewCRC[5] << 5 | NewCRC[4] << 4
                | NewCRC[3] << 3 | NewCRC[2] << 2 | NewCRC[1] << 1 | NewCRC[0];
-    return result & ((1 << (8 + bit_num)) - 1);
+    return result;
 }
 
 /**
- @brief ipv6 hash left bucket arithmetic
+ @brief ipv6 hash left bucket arithmetic, bit by bit
 */
-int16
-sys_humber_hash_generate_ipv6_hash0(uint8* sed, uint32 bit_num)
+static uint16
+_sys_humber_hash_ipv6_hash0_bitwise(uint8* sed)
 {
     uint8 D[144] = {0}, C[16] = {0};
     uint8 NewCRC[16] = {0};
@@ -529,14 +576,14 @@ sys_humber_hash_generate_ipv6_hash0(uint8* sed, uint32 bit_num)
                | NewCRC[11] << 11 | NewCRC[10] << 10 | NewCRC[9] << 9 | NewCRC[8] << 8
                | NewCRC[7] << 7 | NewCRC[6] << 6 | NewCRC[5] << 5 | NewCRC[4] << 4
                | NewCRC[3] << 3 | NewCRC[2] << 2 | NewCRC[1] << 1 | NewCRC[0];
-    return result & ((1 << (8 + bit_num)) - 1);
+    return result;
 }
 
 /**
- @brief ipv6 hash right bucket arithmetic
+ @brief ipv6 hash right bucket arithmetic, bit by bit
 */
-int16
-sys_humber_hash_generate_ipv6_hash1(uint8* sed, uint32 bit_num)
+static uint16
+_sys_humber_hash_ipv6_hash1_bitwise(uint8* sed)
 {
     uint8 D[144] = {0}, C[16] = {0};
     uint8 NewCRC[16] = {0};
@@ -738,7 +785,146 @@ sys_humber_hash_generate_ipv6_hash1(uint8* sed, uint32 bit_num)
                | NewCRC[11] << 11 | NewCRC[10] << 10 | NewCRC[9] << 9 | NewCRC[8] << 8
                | NewCRC[7] << 7 | NewCRC[6] << 6 | NewCRC[5] << 5 | NewCRC[4] << 4
                | NewCRC[3] << 3 | NewCRC[2] << 2 | NewCRC[1] << 1 | NewCRC[0];
-    return result & ((1 << (8 + bit_num)) - 1);
+    return result;
+}
+
+static sys_hash_crc_info_t sys_humber_hash_crc_info[SYS_HASH_CRC_MAX] =
+{
+    {_sys_humber_hash_mac_hash0_bitwise,  SYS_HASH_CRC_MAC_KEY_LEN,  0},
+    {_sys_humber_hash_mac_hash1_bitwise,  SYS_HASH_CRC_MAC_KEY_LEN,  8},
+    {_sys_humber_hash_ipv4_hash0_bitwise, SYS_HASH_CRC_IPV4_KEY_LEN, 16},
+    {_sys_humber_hash_ipv4_hash1_bitwise, SYS_HASH_CRC_IPV4_KEY_LEN, 22},
+    {_sys_humber_hash_ipv6_hash0_bitwise, SYS_HASH_CRC_IPV6_KEY_LEN, 28},
+    {_sys_humber_hash_ipv6_hash1_bitwise, SYS_HASH_CRC_IPV6_KEY_LEN, 46},
+};
+
+static INLINE int16
+_sys_humber_hash_crc(sys_hash_crc_type_t type, uint8* sed, uint32 bit_num)
+{
+    sys_hash_crc_info_t* p_info = &sys_humber_hash_crc_info[type];
+    uint16 (*p_tbl)[256] = &sys_humber_hash_crc_tbl[p_info->row];
+    uint16 crc = 0;
+    uint8 i = 0;
+
+    if (!sys_humber_hash_crc_tbl_ready)
+    {
+        crc = p_info->bitwise(sed);
+        return (int16)(crc & SYS_HASH_CRC_MASK(bit_num));
+    }
+
+    /*keys are 6, 8 or 18 bytes, take two bytes per round*/
+    for (i = 0; i < p_info->key_len; i += 2)
+    {
+        crc ^= p_tbl[i][sed[i]] ^ p_tbl[i + 1][sed[i + 1]];
+    }
+
+    return (int16)(crc & SYS_HASH_CRC_MASK(bit_num));
 }
 
+/**
+ @brief build the per byte CRC tables of the bucket hashes
+*/
+int32
+sys_humber_hash_init(void)
+{
+    sys_hash_crc_info_t* p_info = NULL;
+    uint16 (*p_tbl)[256] = NULL;
+    uint8 key[SYS_HASH_CRC_IPV6_KEY_LEN];
+    uint16 bit_crc[8];
+    uint8 type = 0;
+    uint8 byte = 0;
+    uint8 bit = 0;
+    uint32 value = 0;
+
+    if (sys_humber_hash_crc_tbl_ready)
+    {
+        return CTC_E_NONE;
+    }
+
+    for (type = 0; type < SYS_HASH_CRC_MAX; type++)
+    {
+        p_info = &sys_humber_hash_crc_info[type];
+        p_tbl = &sys_humber_hash_crc_tbl[p_info->row];
+
+        for (byte = 0; byte < p_info->key_len; byte++)
+        {
+            for (bit = 0; bit < 8; bit++)
+            {
+                kal_memset(key, 0, sizeof(key));
+                key[byte] = 1 << bit;
+                bit_crc[bit] = p_info->bitwise(key);
+            }
+
+            /*value with its lowest set bit cleared is already done*/
+            p_tbl[byte][0] = 0;
+            for (value = 1; value < 256; value++)
+            {
+                for (bit = 0; !IS_BIT_SET(value, bit); bit++)
+                {
+                    ;
+                }
+
+                p_tbl[byte][value] = p_tbl[byte][value & (value - 1)] ^ bit_crc[bit];
+            }
+        }
+    }
+
+    sys_humber_hash_crc_tbl_ready = TRUE;
+
+    return CTC_E_NONE;
+}
+
+/**
+ @brief mac hash left bucket arithmetic
+*/
+int16
+sys_humber_hash_generate_mac_hash0(uint8* sed, uint32 bit_num)
+{
+    return _sys_humber_hash_crc(SYS_HASH_CRC_MAC0, sed, bit_num);
+}
+
+/**
+ @brief mac hash right bucket arithmetic
+*/
+int16
+sys_humber_hash_generate_mac_hash1(uint8* sed, uint32 bit_num)
+{
+    return _sys_humber_hash_crc(SYS_HASH_CRC_MAC1, sed, bit_num);
+}
+
+/**
+ @brief ipv4 hash left bucket arithmetic
+*/
+int16
+sys_humber_hash_generate_ipv4_hash0(uint8* sed, uint32 bit_num)
+{
+    return _sys_humber_hash_crc(SYS_HASH_CRC_IPV4_0, sed, bit_num);
+}
+
+/**
+ @brief ipv4 hash right bucket arithmetic
+*/
+int16
+sys_humber_hash_generate_ipv4_hash1(uint8* sed, uint32 bit_num)
+{
+    return _sys_humber_hash_crc(SYS_HASH_CRC_IPV4_1, sed, bit_num);
+}
+
+/**
+ @brief ipv6 hash left bucket arithmetic
+*/
+int16
+sys_humber_hash_generate_ipv6_hash0(uint8* sed, uint32 bit_num)
+{
+    return _sys_humber_hash_crc(SYS_HASH_CRC_IPV6_0, sed, bit_num);
+}
+
+/**
+ @brief ipv6 hash right bucket arithmetic
+*/
+int16
+sys_humber_hash_generate_ipv6_hash1(uint8* sed, uint32 bit_num)
+{
+    return _sys_humber_hash_crc(SYS_HASH_CRC_IPV6_1, sed, bit_num);
+}
 
@@ -5,6 +5,17 @@
 
  @version v2.0
 
+ The free offsets of a pool are a bitmap, bit n set when offset
+ start_offset + n is free. A segment tree over the bitmap words keeps, per
+ node, the free run at its left end (pre), at its right end (suf) and the
+ longest one inside it (best), so the first or last fit of a block is found
+ by descending the tree, and alloc or free only updates the words of the
+ block and their ancestors.
+
+ Previous (forward) allocation takes offsets from the low end and reverse
+ allocation from the high end of the pool: forward blocks stay under
+ min_offset_for_rev_alloc and reverse blocks at or above
+ max_offset_for_pre_alloc, so a free is routed by its offset as before.
 */
 
 /****************************************************************************
@@ -24,6 +35,9 @@
 *
 *****************************************************************************/
 
+#define SYS_OPF_WORD_BITS           32
+#define SYS_OPF_BIT_IS_FREE(w, bit) (((w) >> (bit)) & 1)
+
 struct sys_offset_node_s
 {
     ctc_slistnode_t head;
@@ -32,6 +46,17 @@ struct sys_offset_node_s
 };
 typedef struct sys_offset_node_s sys_offset_node_t;
 
+struct sys_humber_opf_pool_s
+{
+    uint32 *p_bitmap;   /* bit set: offset is free */
+    uint32 *p_pre;      /* free offsets at the left end of a node */
+    uint32 *p_suf;      /* free offsets at the right end of a node */
+    uint32 *p_best;     /* longest free run in a node */
+    uint32 word_num;
+    uint32 leaf_base;   /* node of bitmap word 0, a power of 2; node 1 is the root */
+    uint32 free_num;
+};
+
 /****************************************************************************
  *
 * Global and Declaration
@@ -39,15 +64,6 @@ typedef struct sys_offset_node_s sys_offset_node_t;
 *****************************************************************************/
 
 sys_humber_opf_master_t *p_opf_master = NULL;
-/****************************************************************************
- *
-* Function prototype
-*
-*****************************************************************************/
-static int32
-_sys_humber_opf_pre_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 offset);
-static int32
-_sys_humber_opf_reverse_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 offset);
 
 /****************************************************************************
  *
@@ -55,74 +71,8 @@ _sys_humber_opf_reverse_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint
 *
 *****************************************************************************/
 
-int32
-sys_humber_opf_init(enum sys_humber_opf_type opf_type, uint8 pool_num)
-{
-    uint8 type_index = 0;
-
-    if (NULL == p_opf_master)
-    {
-        p_opf_master = (sys_humber_opf_master_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_master_t));
-        CTC_PTR_VALID_CHECK(p_opf_master);
-
-        p_opf_master->ppp_opf_pre = (sys_humber_opf_entry_t ***)mem_malloc(MEM_OPF_MODULE, MAX_OPF_TBL_NUM * sizeof(void*));
-        CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_pre);
-        kal_memset(p_opf_master->ppp_opf_pre, 0, MAX_OPF_TBL_NUM * sizeof(void*));
-
-
-        p_opf_master->ppp_opf_rev = (sys_humber_opf_entry_t ***)mem_malloc(MEM_OPF_MODULE, MAX_OPF_TBL_NUM * sizeof(void*));
-        CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_rev);
-        kal_memset(p_opf_master->ppp_opf_rev, 0, MAX_OPF_TBL_NUM * sizeof(void*));
-
-    }
-
-    type_index = opf_type;
-
-    if (type_index >= MAX_OPF_TBL_NUM )
-    {
-
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
-
-        return CTC_E_INVALID_PARAM;
-    }
-
-    if (NULL != p_opf_master->ppp_opf_pre[type_index] || NULL != p_opf_master->ppp_opf_rev[type_index])
-    {
-        return CTC_E_NONE;
-    }
-
-
-    p_opf_master->ppp_opf_pre[type_index] = (sys_humber_opf_entry_t **)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(void*));
-    CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_pre[type_index]);
-    kal_memset(p_opf_master->ppp_opf_pre[type_index], 0, pool_num * sizeof(void*));
-
-    p_opf_master->ppp_opf_rev[type_index] = (sys_humber_opf_entry_t **)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(void*));
-    CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_rev[type_index]);
-    kal_memset(p_opf_master->ppp_opf_rev[type_index], 0, pool_num * sizeof(void*));
-
-    p_opf_master->start_offset_a[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
-    CTC_PTR_VALID_CHECK(p_opf_master->start_offset_a[type_index]);
-
-    p_opf_master->max_size_a[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
-    CTC_PTR_VALID_CHECK(p_opf_master->max_size_a[type_index]);
-
-    p_opf_master->max_offset_for_pre_alloc[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
-    CTC_PTR_VALID_CHECK(p_opf_master->max_offset_for_pre_alloc[type_index]);
-
-    p_opf_master->min_offset_for_rev_alloc[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
-    CTC_PTR_VALID_CHECK(p_opf_master->max_offset_for_pre_alloc[type_index]);
-
-    p_opf_master->is_reserve[type_index] = (uint8 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint8));
-    CTC_PTR_VALID_CHECK(p_opf_master->is_reserve[type_index]);
-
-
-    p_opf_master->max_tbl_num[type_index] = pool_num;
-
-	return CTC_E_NONE;
-}
-
-int32
-sys_humber_opf_init_offset( sys_humber_opf_t *opf , uint32 start_offset,uint32 max_size)
+static int32
+_sys_humber_opf_get_pool(sys_humber_opf_t *opf, sys_humber_opf_pool_t **pp_pool)
 {
     uint8 type_index = 0;
     uint8 pool_index = 0;
@@ -131,6 +81,11 @@ sys_humber_opf_init_offset( sys_humber_opf_t *opf , uint32 start_offset,uint32 m
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
+    if (NULL == p_opf_master)
+    {
+        return CTC_E_NOT_INIT;
+    }
+
     if (type_index >= MAX_OPF_TBL_NUM)
     {
         SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
@@ -138,733 +93,753 @@ sys_humber_opf_init_offset( sys_humber_opf_t *opf , uint32 start_offset,uint32 m
         return CTC_E_INVALID_PARAM;
     }
 
-    if (pool_index >= p_opf_master->max_tbl_num[opf->pool_type])
+    if (pool_index >= p_opf_master->max_tbl_num[type_index])
     {
         SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
 
         return CTC_E_INVALID_PARAM;
     }
 
-    if (NULL != p_opf_master->ppp_opf_pre[type_index][pool_index])
+    *pp_pool = p_opf_master->ppp_opf_pool[type_index][pool_index];
+    if (NULL == *pp_pool)
     {
-        return CTC_E_NONE;
+        return CTC_E_NOT_INIT;
     }
 
-    p_opf_master->ppp_opf_pre[type_index][pool_index] = (sys_humber_opf_entry_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-    CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_pre[type_index][pool_index]);
-
-    p_opf_master->ppp_opf_rev[type_index][pool_index] = (sys_humber_opf_entry_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-    CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_rev[type_index][pool_index]);
-
-
-    p_opf_master->start_offset_a[type_index][pool_index] = start_offset;
-    p_opf_master->max_size_a[type_index][pool_index] = max_size;
-
-    p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = start_offset;
-
-    p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] =  start_offset + max_size;
-    p_opf_master->is_reserve[type_index][pool_index] = FALSE;
-
-    p_opf_master->ppp_opf_pre[type_index][pool_index]->next = NULL;
-    p_opf_master->ppp_opf_pre[type_index][pool_index]->prev = NULL;
-    p_opf_master->ppp_opf_pre[type_index][pool_index]->offset = start_offset;
-    p_opf_master->ppp_opf_pre[type_index][pool_index]->size = max_size;
-
-    p_opf_master->ppp_opf_rev[type_index][pool_index]->next = NULL;
-    p_opf_master->ppp_opf_rev[type_index][pool_index]->prev = NULL;
-    p_opf_master->ppp_opf_rev[type_index][pool_index]->offset = start_offset;
-    p_opf_master->ppp_opf_rev[type_index][pool_index]->size = max_size;
-
     return CTC_E_NONE;
 }
 
-int32
-sys_humber_opf_reserve_size_for_reverse_alloc(sys_humber_opf_t *opf,uint32 block_size)
+static void
+_sys_humber_opf_word_runs(uint32 word, uint32 *p_pre, uint32 *p_suf, uint32 *p_best)
 {
-   uint8 type_index = 0;
-    uint8 pool_index = 0;
-    uint32 start_offset = 0;
-    uint32 max_size = 0;
-
+    uint32 bit = 0;
+    uint32 run = 0;
 
-    CTC_PTR_VALID_CHECK(opf);
-    type_index = opf->pool_type;
-    pool_index = opf->pool_index;
-
-    if (type_index >= MAX_OPF_TBL_NUM)
-    {
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
-
-        return CTC_E_INVALID_PARAM;
-    }
-
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
+    *p_pre = 0;
+    *p_best = 0;
+    for (bit = 0; bit < SYS_OPF_WORD_BITS; bit++)
     {
-        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
-
-        return CTC_E_INVALID_PARAM;
+        if (SYS_OPF_BIT_IS_FREE(word, bit))
+        {
+            run++;
+            if (run > *p_best)
+            {
+                *p_best = run;
+            }
+        }
+        else
+        {
+            if (run == bit)
+            {
+                *p_pre = run;
+            }
+            run = 0;
+        }
     }
 
-    if (block_size > p_opf_master->max_size_a[type_index][pool_index])
+    if (*p_best == SYS_OPF_WORD_BITS)
     {
-        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
-
-        return CTC_E_INVALID_PARAM;
-    }
-    if (block_size != 0)
-    {
-        start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-        max_size = p_opf_master->max_size_a[type_index][pool_index];
-
-        p_opf_master->is_reserve[type_index][pool_index] = TRUE;
-        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = start_offset + max_size - block_size;
-        p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] = start_offset + max_size - block_size;
+        *p_pre = SYS_OPF_WORD_BITS;
     }
-   return CTC_E_NONE;
+    *p_suf = run;
 }
 
-int32
-sys_humber_opf_reverse_alloc_offset(sys_humber_opf_t *opf,uint32 block_size,uint32*offset)
+/* child_len: offsets in each child of node, returns TRUE if the node changed */
+static bool
+_sys_humber_opf_pull(sys_humber_opf_pool_t *p_pool, uint32 node, uint32 child_len)
 {
-    uint8  type_index = 0;
-    uint8  pool_index = 0;
-    uint32 start_offset = 0;
-    uint32 end_offset = 0;
-    uint32 revise_offset = 0;
-    uint32 max_size = 0;
-    uint32 min_offset = 0;
-    sys_humber_opf_entry_t *entry, *next;
+    uint32 left = 2 * node;
+    uint32 right = 2 * node + 1;
+    uint32 pre = 0;
+    uint32 suf = 0;
+    uint32 best = 0;
 
-    CTC_PTR_VALID_CHECK(opf);
-    *offset = CTC_MAX_UINT32_VALUE;
-    type_index = opf->pool_type;
-    pool_index = opf->pool_index;
+    pre = (p_pool->p_pre[left] == child_len) ? child_len + p_pool->p_pre[right] : p_pool->p_pre[left];
+    suf = (p_pool->p_suf[right] == child_len) ? child_len + p_pool->p_suf[left] : p_pool->p_suf[right];
 
-    if (type_index >= MAX_OPF_TBL_NUM)
+    best = p_pool->p_suf[left] + p_pool->p_pre[right];
+    if (p_pool->p_best[left] > best)
     {
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
-
-        return CTC_E_INVALID_PARAM;
+        best = p_pool->p_best[left];
     }
-
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
+    if (p_pool->p_best[right] > best)
     {
-        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
-
-        return CTC_E_INVALID_PARAM;
+        best = p_pool->p_best[right];
     }
 
-    if (block_size > p_opf_master->max_size_a[type_index][pool_index])
+    if ((pre == p_pool->p_pre[node]) && (suf == p_pool->p_suf[node]) && (best == p_pool->p_best[node]))
     {
-        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
-
-        return CTC_E_INVALID_PARAM;
+        return FALSE;
     }
-    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-    max_size     = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset   = start_offset + max_size;
 
+    p_pool->p_pre[node] = pre;
+    p_pool->p_suf[node] = suf;
+    p_pool->p_best[node] = best;
 
-    entry = p_opf_master->ppp_opf_rev[type_index][pool_index];
+    return TRUE;
+}
 
-    if (block_size == 0)
-    {
-        block_size = 1;
-    }
+/* mark offsets [begin, end) of the pool, relative to start_offset, free or used */
+static void
+_sys_humber_opf_set_range(sys_humber_opf_pool_t *p_pool, uint32 begin, uint32 end, bool is_free)
+{
+    uint32 word = 0;
+    uint32 first_word = begin / SYS_OPF_WORD_BITS;
+    uint32 last_word = (end - 1) / SYS_OPF_WORD_BITS;
+    uint32 mask = 0;
+    uint32 lo = 0;
+    uint32 hi = 0;
+    uint32 node = 0;
+    uint32 child_len = SYS_OPF_WORD_BITS;
+    bool changed = TRUE;
+
+    for (word = first_word; word <= last_word; word++)
+    {
+        mask = 0xFFFFFFFF;
+        if (word == first_word)
+        {
+            mask &= 0xFFFFFFFF << (begin % SYS_OPF_WORD_BITS);
+        }
+        if (word == last_word)
+        {
+            mask &= 0xFFFFFFFF >> (SYS_OPF_WORD_BITS - 1 - (end - 1) % SYS_OPF_WORD_BITS);
+        }
 
-    while (entry)
-    {
-        revise_offset = (end_offset - entry->offset - block_size) + start_offset;
-        if (entry->size >= block_size
-           && (revise_offset >= p_opf_master->max_offset_for_pre_alloc[type_index][pool_index]))
+        if (is_free)
         {
-            break;
+            p_pool->p_bitmap[word] |= mask;
         }
         else
         {
-            entry = entry->next;
+            p_pool->p_bitmap[word] &= ~mask;
         }
+
+        node = p_pool->leaf_base + word;
+        _sys_humber_opf_word_runs(p_pool->p_bitmap[word], &p_pool->p_pre[node],
+                                  &p_pool->p_suf[node], &p_pool->p_best[node]);
     }
 
-    if (!entry)
+    /* the ancestors of an unchanged level are unchanged too */
+    lo = p_pool->leaf_base + first_word;
+    hi = p_pool->leaf_base + last_word;
+    while ((lo > 1) && changed)
     {
-        SYS_OPF_DBG_INFO(
-                        "type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
-
-        return CTC_E_NO_ALLOC_OFFSET;
+        lo >>= 1;
+        hi >>= 1;
+        changed = FALSE;
+        for (node = lo; node <= hi; node++)
+        {
+            changed |= _sys_humber_opf_pull(p_pool, node, child_len);
+        }
+        child_len <<= 1;
     }
 
-    *offset = revise_offset;
-
-    if (entry->size > block_size)
+    if (is_free)
     {
-        entry->size -= block_size;
-        entry->offset += block_size;
-        min_offset = entry->offset;
+        p_pool->free_num += end - begin;
     }
     else
     {
-        /* entry->size == block_size */
-        entry->size -= block_size;
-        entry->offset += block_size;
-        min_offset = entry->offset;
-        next = entry->next;
+        p_pool->free_num -= end - begin;
+    }
+}
 
-        if (entry->prev && next)
-        {
-            entry->prev->next = next;
-            next->prev = entry->prev;
+static bool
+_sys_humber_opf_range_is(sys_humber_opf_pool_t *p_pool, uint32 begin, uint32 end, bool is_free)
+{
+    uint32 pos = 0;
+    uint32 word = 0;
 
-            mem_free(entry);
-        }
-        else if (next)
+    for (pos = begin; pos < end; pos++)
+    {
+        word = p_pool->p_bitmap[pos / SYS_OPF_WORD_BITS];
+        if ((0 == (pos % SYS_OPF_WORD_BITS)) && (pos + SYS_OPF_WORD_BITS <= end)
+            && (word == (is_free ? 0xFFFFFFFF : 0)))
         {
-            /* entry->prev == NULL && next != NULL */
-            p_opf_master->ppp_opf_rev[type_index][pool_index] = next;
-            next->prev = entry->prev;
-
-            mem_free(entry);
+            pos += SYS_OPF_WORD_BITS - 1;
+            continue;
         }
-        /* next == NULL in this condition this node cannot be free */
-    }
 
-    if (*offset <  p_opf_master->min_offset_for_rev_alloc[type_index][pool_index])
-    {
-        p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] = *offset;
+        if (SYS_OPF_BIT_IS_FREE(word, pos % SYS_OPF_WORD_BITS) != (is_free ? 1 : 0))
+        {
+            return FALSE;
+        }
     }
 
-	return CTC_E_NONE;
+    return TRUE;
 }
 
-static int32
-_sys_humber_opf_reverse_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 offset)
+/*
+ lowest pos >= from with [pos, pos + size) free; *p_run is the free run
+ ending at lo that started at or after from
+*/
+static bool
+_sys_humber_opf_first_fit(sys_humber_opf_pool_t *p_pool, uint32 node, uint32 lo, uint32 len,
+                          uint32 from, uint32 size, uint32 *p_run, uint32 *p_pos)
 {
-    uint8  type_index = 0;
-    uint8  pool_index = 0;
-    uint32 start_offset = 0;
-    uint32 end_offset = 0;
-    uint32 revise_offset = 0;
-    uint32 max_size = 0;
-    uint32 prev_offset = 0;
-    sys_humber_opf_entry_t *entry, *next, *prev, *node;
-
-    CTC_PTR_VALID_CHECK(opf);
-
-    type_index = opf->pool_type;
-    pool_index = opf->pool_index;
-
-    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-    max_size     = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset   = start_offset + max_size;
-
-    if (block_size > max_size)
-    {
-        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
-
-        return CTC_E_INVALID_PARAM;
-    }
-    /*revise offset for pre-allocation freelist*/
-    revise_offset = end_offset - offset - block_size + start_offset;
+    uint32 word = 0;
+    uint32 bit = 0;
 
-    if (revise_offset < start_offset || revise_offset > end_offset )
+    if (lo + len <= from)
     {
-        SYS_OPF_DBG_INFO( "invalid offset: %d\n", revise_offset);
-
-        return CTC_E_INVALID_PARAM;
+        *p_run = 0;
+        return FALSE;
     }
-    entry = p_opf_master->ppp_opf_rev[type_index][pool_index];
 
-    while (entry != NULL)
+    if (lo >= from)
     {
-        if (revise_offset + block_size > entry->offset)
+        if (*p_run + p_pool->p_pre[node] >= size)
         {
-            prev_offset = entry->offset + entry->size;
-            entry = entry->next;
+            *p_pos = lo - *p_run;
+            return TRUE;
         }
-        else if (revise_offset + block_size == entry->offset)
+
+        if (p_pool->p_best[node] < size)
         {
-            /*change offset and block size */
-            entry->offset = revise_offset;
-            entry->size += block_size;
-            break;
+            *p_run = (p_pool->p_suf[node] == len) ? *p_run + len : p_pool->p_suf[node];
+            return FALSE;
         }
-        else
-        {
-            if (revise_offset < prev_offset)
-            {
-                /* an error condition */
-                entry = NULL;
-                break;
-            }
-            /* insert a new free node */
-            node = (sys_humber_opf_entry_t*)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-
-            CTC_PTR_VALID_CHECK(node);
-
-            node->offset = revise_offset;
-            node->size = block_size;
-            prev = entry->prev;
+    }
 
-            if (prev)
+    if (node >= p_pool->leaf_base)
+    {
+        word = p_pool->p_bitmap[node - p_pool->leaf_base];
+        for (bit = (from > lo) ? from - lo : 0; bit < SYS_OPF_WORD_BITS; bit++)
+        {
+            if (!SYS_OPF_BIT_IS_FREE(word, bit))
             {
-                prev->next = node;
+                *p_run = 0;
             }
-            else
+            else if (++(*p_run) >= size)
             {
-                /* if the enry is the first node, we must update global database */
-                p_opf_master->ppp_opf_rev[type_index][pool_index] = node;
+                *p_pos = lo + bit + 1 - size;
+                return TRUE;
             }
-            node->next = entry;
-            node->prev = prev;
-            entry->prev = node;
-            entry = node;
-            break;
         }
+        return FALSE;
     }
 
-    if (entry != NULL)
-    {
-        prev = entry->prev;
-        next = entry->next;
+    return _sys_humber_opf_first_fit(p_pool, 2 * node, lo, len / 2, from, size, p_run, p_pos)
+        || _sys_humber_opf_first_fit(p_pool, 2 * node + 1, lo + len / 2, len / 2, from, size, p_run, p_pos);
+}
 
-        if (prev && (prev_offset == entry->offset))
-        {
-            prev->next = next;
+/*
+ highest pos with [pos, pos + size) free and pos + size <= below; *p_run is
+ the free run starting at lo + len that ends at or before below
+*/
+static bool
+_sys_humber_opf_last_fit(sys_humber_opf_pool_t *p_pool, uint32 node, uint32 lo, uint32 len,
+                         uint32 below, uint32 size, uint32 *p_run, uint32 *p_pos)
+{
+    uint32 word = 0;
+    uint32 bit = 0;
 
-            if (next)
-            {
-                next->prev = prev;
-            }
-            prev->size += entry->size;
-            mem_free(entry);
+    if (lo >= below)
+    {
+        *p_run = 0;
+        return FALSE;
+    }
 
-            entry = prev;
+    if (lo + len <= below)
+    {
+        if (*p_run + p_pool->p_suf[node] >= size)
+        {
+            *p_pos = lo + len + *p_run - size;
+            return TRUE;
         }
 
-        if ((!entry->next) && (!p_opf_master->is_reserve[type_index][pool_index]))
+        if (p_pool->p_best[node] < size)
         {
-            p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] = end_offset - entry->offset + start_offset;
+            *p_run = (p_pool->p_pre[node] == len) ? *p_run + len : p_pool->p_pre[node];
+            return FALSE;
         }
     }
-    else
+
+    if (node >= p_pool->leaf_base)
     {
-        SYS_OPF_DBG_INFO("invalid offset: %d invalid block_size:%d\n",
-                          revise_offset, block_size);
-        return CTC_E_INVALID_PARAM;
+        word = p_pool->p_bitmap[node - p_pool->leaf_base];
+        for (bit = (lo + len > below) ? below - lo : SYS_OPF_WORD_BITS; bit-- > 0; )
+        {
+            if (!SYS_OPF_BIT_IS_FREE(word, bit))
+            {
+                *p_run = 0;
+            }
+            else if (++(*p_run) >= size)
+            {
+                *p_pos = lo + bit;
+                return TRUE;
+            }
+        }
+        return FALSE;
     }
 
-    return CTC_E_NONE;
+    return _sys_humber_opf_last_fit(p_pool, 2 * node + 1, lo + len / 2, len / 2, below, size, p_run, p_pos)
+        || _sys_humber_opf_last_fit(p_pool, 2 * node, lo, len / 2, below, size, p_run, p_pos);
 }
 
-int32
-sys_humber_opf_alloc_offset(sys_humber_opf_t *opf,uint32 block_size,uint32*offset)
+/* free offsets right under below, returns TRUE once a used one is met */
+static bool
+_sys_humber_opf_run_under(sys_humber_opf_pool_t *p_pool, uint32 node, uint32 lo, uint32 len,
+                          uint32 below, uint32 *p_run)
 {
-    uint8  type_index = 0;
-    uint8  pool_index = 0;
-    uint32 start_offset = 0;
-    uint32 max_size = 0;
-    uint32 end_offset = 0;
-    uint32 revise_offset =0;
-
-    sys_humber_opf_entry_t *entry, *next;
-
-    CTC_PTR_VALID_CHECK(opf);
-    *offset = CTC_MAX_UINT32_VALUE;
-    type_index = opf->pool_type;
-    pool_index = opf->pool_index;
+    uint32 word = 0;
+    uint32 bit = 0;
 
-
-    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-    max_size     = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset   = start_offset + max_size;
-
-    if (type_index >= MAX_OPF_TBL_NUM)
+    if (lo >= below)
     {
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
-
-        return CTC_E_INVALID_PARAM;
+        return FALSE;
     }
 
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
+    if (lo + len <= below)
     {
-        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
+        if (p_pool->p_pre[node] == len)
+        {
+            *p_run += len;
+            return FALSE;
+        }
+        *p_run += p_pool->p_suf[node];
+        return TRUE;
+    }
 
-        return CTC_E_INVALID_PARAM;
+    if (node >= p_pool->leaf_base)
+    {
+        word = p_pool->p_bitmap[node - p_pool->leaf_base];
+        for (bit = below - lo; bit-- > 0; )
+        {
+            if (!SYS_OPF_BIT_IS_FREE(word, bit))
+            {
+                return TRUE;
+            }
+            (*p_run)++;
+        }
+        return FALSE;
     }
 
-    if (block_size == 0)
+    return _sys_humber_opf_run_under(p_pool, 2 * node + 1, lo + len / 2, len / 2, below, p_run)
+        || _sys_humber_opf_run_under(p_pool, 2 * node, lo, len / 2, below, p_run);
+}
+
+/* free offsets from from up, returns TRUE once a used one is met */
+static bool
+_sys_humber_opf_run_from(sys_humber_opf_pool_t *p_pool, uint32 node, uint32 lo, uint32 len,
+                         uint32 from, uint32 *p_run)
+{
+    uint32 word = 0;
+    uint32 bit = 0;
+
+    if (lo + len <= from)
     {
-        block_size = 1;
+        return FALSE;
     }
 
-    if (block_size > p_opf_master->max_size_a[type_index][pool_index])
+    if (lo >= from)
     {
-        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
+        if (p_pool->p_pre[node] == len)
+        {
+            *p_run += len;
+            return FALSE;
+        }
+        *p_run += p_pool->p_pre[node];
+        return TRUE;
+    }
 
-        return CTC_E_INVALID_PARAM;
+    if (node >= p_pool->leaf_base)
+    {
+        word = p_pool->p_bitmap[node - p_pool->leaf_base];
+        for (bit = from - lo; bit < SYS_OPF_WORD_BITS; bit++)
+        {
+            if (!SYS_OPF_BIT_IS_FREE(word, bit))
+            {
+                return TRUE;
+            }
+            (*p_run)++;
+        }
+        return FALSE;
     }
 
-    entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
+    return _sys_humber_opf_run_from(p_pool, 2 * node, lo, len / 2, from, p_run)
+        || _sys_humber_opf_run_from(p_pool, 2 * node + 1, lo + len / 2, len / 2, from, p_run);
+}
 
-    while (entry)
-    {
-        revise_offset = entry->offset + block_size -1 ;
+/*
+ lowest pos >= from, pos + size <= below and (start_offset + pos) % multiple == 0
+ with [pos, pos + size) free
+*/
+static bool
+_sys_humber_opf_find_first(sys_humber_opf_pool_t *p_pool, uint32 start_offset, uint32 from, uint32 below,
+                           uint32 multiple, uint32 size, uint32 *p_pos)
+{
+    uint32 run = 0;
+    uint32 pos = 0;
+    uint32 aligned = 0;
 
-        if (entry->size >= block_size
-           && (revise_offset <  p_opf_master->min_offset_for_rev_alloc[type_index][pool_index]))
+    while (from + size <= below)
+    {
+        run = 0;
+        if (!_sys_humber_opf_first_fit(p_pool, 1, 0, p_pool->leaf_base * SYS_OPF_WORD_BITS,
+                                       from, size, &run, &pos))
         {
-            break;
+            return FALSE;
         }
-        else
+
+        aligned = (start_offset + pos + multiple - 1) / multiple * multiple - start_offset;
+        if (aligned + size > below)
         {
-            entry = entry->next;
+            return FALSE;
         }
-    }
 
-    if (!entry)
-    {
-        SYS_OPF_DBG_INFO(
-                        "type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
+        if ((aligned == pos) || _sys_humber_opf_range_is(p_pool, aligned, aligned + size, TRUE))
+        {
+            *p_pos = aligned;
+            return TRUE;
+        }
 
-        return CTC_E_NO_ALLOC_OFFSET;
+        /* no aligned block in this free run, go on after the aligned offset */
+        from = aligned + 1;
     }
 
-    *offset = entry->offset;
+    return FALSE;
+}
+
+/*
+ highest pos >= above, pos + size <= below and (start_offset + pos) % multiple == 0
+ with [pos, pos + size) free
+*/
+static bool
+_sys_humber_opf_find_last(sys_humber_opf_pool_t *p_pool, uint32 start_offset, uint32 above, uint32 below,
+                          uint32 multiple, uint32 size, uint32 *p_pos)
+{
+    uint32 run = 0;
+    uint32 pos = 0;
+    uint32 aligned = 0;
 
-    entry->size -= block_size;
-    if(entry->size == 0)
+    while (above + size <= below)
     {
-        next = entry->next;
-        if(entry->prev)
+        run = 0;
+        if (!_sys_humber_opf_last_fit(p_pool, 1, 0, p_pool->leaf_base * SYS_OPF_WORD_BITS,
+                                      below, size, &run, &pos))
         {
-            entry->prev->next = next;
+            return FALSE;
+        }
+
+        if (start_offset + pos < multiple)
+        {
+            aligned = (0 == start_offset) ? 0 : pos + 1;
         }
         else
         {
-            p_opf_master->ppp_opf_pre[type_index][pool_index] = next;
+            aligned = (start_offset + pos) / multiple * multiple - start_offset;
+        }
+        if ((aligned > pos) || (aligned < above))
+        {
+            return FALSE;
         }
-        if(next)
+
+        if ((aligned == pos) || _sys_humber_opf_range_is(p_pool, aligned, aligned + size, TRUE))
         {
-            next->prev = entry->prev;
+            *p_pos = aligned;
+            return TRUE;
         }
-        mem_free(entry);
+
+        /* no aligned block in this free run, go on under the aligned offset */
+        below = aligned + size - 1;
     }
-    else
+
+    return FALSE;
+}
+
+static void
+_sys_humber_opf_pool_free(sys_humber_opf_pool_t *p_pool)
+{
+    if (p_pool->p_bitmap)
     {
-        entry->offset += block_size;
+        mem_free(p_pool->p_bitmap);
     }
-
-    if ((*offset + block_size) > p_opf_master->max_offset_for_pre_alloc[type_index][pool_index])
+    if (p_pool->p_pre)
     {
-        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = *offset + block_size;
+        mem_free(p_pool->p_pre);
     }
-
-	return CTC_E_NONE;
+    if (p_pool->p_suf)
+    {
+        mem_free(p_pool->p_suf);
+    }
+    if (p_pool->p_best)
+    {
+        mem_free(p_pool->p_best);
+    }
+    mem_free(p_pool);
 }
 
-int32
-sys_humber_opf_alloc_offset_last(sys_humber_opf_t *opf, uint32 block_size, uint32*offset)
+static sys_humber_opf_pool_t *
+_sys_humber_opf_pool_new(uint32 max_size)
 {
-    uint8  type_index = 0;
-    uint8  pool_index = 0;
-    uint32 start_offset = 0;
-    uint32 max_size = 0;
-    uint32 end_offset = 0;
-    uint32 revise_offset =0;
-
-    sys_humber_opf_entry_t *entry, *next, *select = NULL;
-
-    CTC_PTR_VALID_CHECK(opf);
-    *offset = CTC_MAX_UINT32_VALUE;
-    type_index = opf->pool_type;
-    pool_index = opf->pool_index;
+    sys_humber_opf_pool_t *p_pool = NULL;
+    uint32 node_num = 0;
+    uint32 node = 0;
+    uint32 lo = 0;
+    uint32 child_len = SYS_OPF_WORD_BITS;
 
-    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-    max_size     = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset   = start_offset + max_size;
-
-    if(type_index >= MAX_OPF_TBL_NUM)
+    p_pool = (sys_humber_opf_pool_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_pool_t));
+    if (NULL == p_pool)
     {
-        SYS_OPF_DBG_INFO("invalid type index : %d\n", type_index);
-        return CTC_E_INVALID_PARAM;
+        return NULL;
     }
+    kal_memset(p_pool, 0, sizeof(sys_humber_opf_pool_t));
 
-    if(pool_index >= p_opf_master->max_tbl_num[type_index])
+    p_pool->word_num = (max_size + SYS_OPF_WORD_BITS - 1) / SYS_OPF_WORD_BITS;
+    if (0 == p_pool->word_num)
     {
-        SYS_OPF_DBG_INFO("invalid pool index : %d\n", pool_index);
-        return CTC_E_INVALID_PARAM;
+        p_pool->word_num = 1;
     }
-
-    if(block_size == 0)
+    p_pool->leaf_base = 1;
+    while (p_pool->leaf_base < p_pool->word_num)
     {
-        block_size = 1;
+        p_pool->leaf_base <<= 1;
     }
+    node_num = 2 * p_pool->leaf_base;
 
-    if(block_size > p_opf_master->max_size_a[type_index][pool_index])
+    p_pool->p_bitmap = (uint32 *)mem_malloc(MEM_OPF_MODULE, p_pool->leaf_base * sizeof(uint32));
+    p_pool->p_pre = (uint32 *)mem_malloc(MEM_OPF_MODULE, node_num * sizeof(uint32));
+    p_pool->p_suf = (uint32 *)mem_malloc(MEM_OPF_MODULE, node_num * sizeof(uint32));
+    p_pool->p_best = (uint32 *)mem_malloc(MEM_OPF_MODULE, node_num * sizeof(uint32));
+    if (!p_pool->p_bitmap || !p_pool->p_pre || !p_pool->p_suf || !p_pool->p_best)
     {
-        SYS_OPF_DBG_INFO("invalid block_size:%d\n", block_size);
-        return CTC_E_INVALID_PARAM;
+        _sys_humber_opf_pool_free(p_pool);
+        return NULL;
     }
+    kal_memset(p_pool->p_bitmap, 0, p_pool->leaf_base * sizeof(uint32));
+    kal_memset(p_pool->p_pre, 0, node_num * sizeof(uint32));
+    kal_memset(p_pool->p_suf, 0, node_num * sizeof(uint32));
+    kal_memset(p_pool->p_best, 0, node_num * sizeof(uint32));
 
-    entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
-
-    while(entry)
+    /* the offsets past max_size stay used */
+    if (max_size)
     {
-        revise_offset = (end_offset - entry->offset - block_size) + start_offset;
+        _sys_humber_opf_set_range(p_pool, 0, max_size, TRUE);
+    }
 
-        if (entry->size >= block_size &&
-            revise_offset < p_opf_master->min_offset_for_rev_alloc[type_index][pool_index])
+    for (lo = p_pool->leaf_base; lo > 1; lo >>= 1, child_len <<= 1)
+    {
+        for (node = lo / 2; node < lo; node++)
         {
-            select = entry;
+            _sys_humber_opf_pull(p_pool, node, child_len);
         }
-        entry = entry->next;
     }
 
-    if(!select)
+    return p_pool;
+}
+
+int32
+sys_humber_opf_init(enum sys_humber_opf_type opf_type, uint8 pool_num)
+{
+    uint8 type_index = 0;
+
+    if (NULL == p_opf_master)
     {
-        SYS_OPF_DBG_INFO("type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
-        return CTC_E_NO_ALLOC_OFFSET;
+        p_opf_master = (sys_humber_opf_master_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_master_t));
+        CTC_PTR_VALID_CHECK(p_opf_master);
+        kal_memset(p_opf_master, 0, sizeof(sys_humber_opf_master_t));
+
+        p_opf_master->ppp_opf_pool = (sys_humber_opf_pool_t ***)mem_malloc(MEM_OPF_MODULE, MAX_OPF_TBL_NUM * sizeof(void*));
+        CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_pool);
+        kal_memset(p_opf_master->ppp_opf_pool, 0, MAX_OPF_TBL_NUM * sizeof(void*));
     }
 
-    *offset = select->offset + select->size - block_size;
+    type_index = opf_type;
 
-    select->size -= block_size;
-    if(select->size == 0)
+    if (type_index >= MAX_OPF_TBL_NUM )
     {
-        next = select->next;
-        if(select->prev)
-        {
-            select->prev->next = next;
-        }
-        else
-        {
-            p_opf_master->ppp_opf_pre[type_index][pool_index] = next;
-        }
-        if(next)
-        {
-            next->prev = select->prev;
-        }
-        mem_free(select);
+
+        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
+
+        return CTC_E_INVALID_PARAM;
     }
 
-    if((*offset + block_size) > p_opf_master->max_offset_for_pre_alloc[type_index][pool_index])
+    if (NULL != p_opf_master->ppp_opf_pool[type_index])
     {
-        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = *offset + block_size;
+        return CTC_E_NONE;
     }
 
+
+    p_opf_master->ppp_opf_pool[type_index] = (sys_humber_opf_pool_t **)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(void*));
+    CTC_PTR_VALID_CHECK(p_opf_master->ppp_opf_pool[type_index]);
+    kal_memset(p_opf_master->ppp_opf_pool[type_index], 0, pool_num * sizeof(void*));
+
+    p_opf_master->start_offset_a[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
+    CTC_PTR_VALID_CHECK(p_opf_master->start_offset_a[type_index]);
+
+    p_opf_master->max_size_a[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
+    CTC_PTR_VALID_CHECK(p_opf_master->max_size_a[type_index]);
+
+    p_opf_master->max_offset_for_pre_alloc[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
+    CTC_PTR_VALID_CHECK(p_opf_master->max_offset_for_pre_alloc[type_index]);
+
+    p_opf_master->min_offset_for_rev_alloc[type_index] = (uint32 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint32));
+    CTC_PTR_VALID_CHECK(p_opf_master->min_offset_for_rev_alloc[type_index]);
+
+    p_opf_master->is_reserve[type_index] = (uint8 *)mem_malloc(MEM_OPF_MODULE, pool_num * sizeof(uint8));
+    CTC_PTR_VALID_CHECK(p_opf_master->is_reserve[type_index]);
+
+
+    p_opf_master->max_tbl_num[type_index] = pool_num;
+
 	return CTC_E_NONE;
 }
 
-
 int32
-sys_humber_opf_alloc_offset_from_position(sys_humber_opf_t *opf, uint32 block_size, uint32 begin)
+sys_humber_opf_init_offset( sys_humber_opf_t *opf , uint32 start_offset,uint32 max_size)
 {
-    uint8  type_index = 0;
-    uint8  pool_index = 0;
-    uint32 start_offset = 0;
-    uint32 max_size = 0;
-    uint32 end_offset = 0;
-    int32 revise_offset =0;
-    uint32 end;
-
-    sys_humber_opf_entry_t *entry, *next, *node;
+    uint8 type_index = 0;
+    uint8 pool_index = 0;
 
     CTC_PTR_VALID_CHECK(opf);
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
-    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-    max_size     = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset   = start_offset + max_size;
-
-    if(type_index >= MAX_OPF_TBL_NUM)
+    if (type_index >= MAX_OPF_TBL_NUM)
     {
-        SYS_OPF_DBG_INFO("invalid type index : %d\n", type_index);
+        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
+
         return CTC_E_INVALID_PARAM;
     }
 
-    if(pool_index >= p_opf_master->max_tbl_num[type_index])
+    if (pool_index >= p_opf_master->max_tbl_num[opf->pool_type])
     {
-        SYS_OPF_DBG_INFO("invalid pool index : %d\n", pool_index);
+        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
+
         return CTC_E_INVALID_PARAM;
     }
 
-    if(block_size == 0)
+    if (NULL != p_opf_master->ppp_opf_pool[type_index][pool_index])
     {
-        block_size = 1;
+        return CTC_E_NONE;
     }
 
-    if(block_size > p_opf_master->max_size_a[type_index][pool_index])
+    p_opf_master->ppp_opf_pool[type_index][pool_index] = _sys_humber_opf_pool_new(max_size);
+    if (NULL == p_opf_master->ppp_opf_pool[type_index][pool_index])
     {
-        SYS_OPF_DBG_INFO("invalid block_size:%d\n", block_size);
-        return CTC_E_INVALID_PARAM;
+        return CTC_E_NO_MEMORY;
     }
 
-    end = begin + block_size - 1;
+    p_opf_master->start_offset_a[type_index][pool_index] = start_offset;
+    p_opf_master->max_size_a[type_index][pool_index] = max_size;
 
-    revise_offset = end_offset - begin - block_size + start_offset;
-    if( (revise_offset > p_opf_master->min_offset_for_rev_alloc[type_index][pool_index]))
-    {
-        return CTC_E_NO_OFFSET_LEFT;
-    }
+    p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = start_offset;
 
-    entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
-    while(entry)
-    {
-        if(begin >= entry->offset + entry->size)
-        {
-            entry = entry->next;
-        }
-        else
-        {
-            if(begin < entry->offset || entry->offset + entry->size < begin + block_size)
-            {
-                entry = NULL;
-            }
-            break;
-        }
-    }
+    p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] =  start_offset + max_size;
+    p_opf_master->is_reserve[type_index][pool_index] = FALSE;
 
-    if(!entry)
-    {
-        SYS_OPF_DBG_INFO("type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
-        return CTC_E_NO_ALLOC_OFFSET;
-    }
+    return CTC_E_NONE;
+}
+
+int32
+sys_humber_opf_reserve_size_for_reverse_alloc(sys_humber_opf_t *opf,uint32 block_size)
+{
+   uint8 type_index = 0;
+    uint8 pool_index = 0;
+    uint32 start_offset = 0;
+    uint32 max_size = 0;
+
+
+    CTC_PTR_VALID_CHECK(opf);
+    type_index = opf->pool_type;
+    pool_index = opf->pool_index;
 
-    if(entry->offset == begin || entry->offset + entry->size - 1 == end)
+    if (type_index >= MAX_OPF_TBL_NUM)
     {
-        entry->size -= block_size;
-        if(entry->size == 0)
-        {
-            next = entry->next;
-            if(entry->prev)
-            {
-                entry->prev->next = next;
-            }
-            else
-            {
-                p_opf_master->ppp_opf_pre[type_index][pool_index] = next;
-            }
-            if(next)
-            {
-                next->prev = entry->prev;
-            }
-            mem_free(entry);
-        }
-        else if(entry->offset == begin)
-        {
-            entry->offset = end + 1;
-        }
+        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
+
+        return CTC_E_INVALID_PARAM;
     }
-    else
-    {
-        /* insert a new free node */
-        node = (sys_humber_opf_entry_t*)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-        CTC_PTR_VALID_CHECK(node);
 
-        node->offset = end + 1;
-        node->size = entry->offset + entry->size - end - 1;
-        node->prev = entry;
-        node->next = entry->next;
+    if (pool_index >= p_opf_master->max_tbl_num[type_index])
+    {
+        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
 
-        entry->size = begin - entry->offset;
-        entry->next = node;
+        return CTC_E_INVALID_PARAM;
     }
 
-    if(end + 1 > p_opf_master->max_offset_for_pre_alloc[type_index][pool_index])
+    if (block_size > p_opf_master->max_size_a[type_index][pool_index])
     {
-        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = end + 1;
+        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
+
+        return CTC_E_INVALID_PARAM;
     }
+    if (block_size != 0)
+    {
+        start_offset = p_opf_master->start_offset_a[type_index][pool_index];
+        max_size = p_opf_master->max_size_a[type_index][pool_index];
 
-	return CTC_E_NONE;
+        p_opf_master->is_reserve[type_index][pool_index] = TRUE;
+        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = start_offset + max_size - block_size;
+        p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] = start_offset + max_size - block_size;
+    }
+   return CTC_E_NONE;
 }
 
-/*alloc multiple offset*/
-extern int32
-sys_humber_opf_alloc_multiple_offset(sys_humber_opf_t *opf,uint8 multiple,uint32 block_size,uint32*offset)
+/*
+ forward blocks: [start_offset, min_offset_for_rev_alloc)
+ reverse blocks: [max_offset_for_pre_alloc, start_offset + max_size)
+*/
+static int32
+_sys_humber_opf_alloc(sys_humber_opf_t *opf, bool is_reverse, bool is_last, uint32 multiple,
+                      uint32 block_size, uint32 *offset)
 {
+    sys_humber_opf_pool_t *p_pool = NULL;
     uint8  type_index = 0;
     uint8  pool_index = 0;
-    uint32 remainder = 0;
-    uint32 skip_value = 0;
     uint32 start_offset = 0;
-    uint32 end_offset = 0;
-    uint32 revise_offset =0;
     uint32 max_size = 0;
-    sys_humber_opf_entry_t *entry, *next;
-    sys_humber_opf_entry_t  *node;
+    uint32 *p_max_pre = NULL;
+    uint32 *p_min_rev = NULL;
+    uint32 pos = 0;
+    bool   found = FALSE;
 
-    CTC_PTR_VALID_CHECK(opf);
+    CTC_PTR_VALID_CHECK(offset);
     *offset = CTC_MAX_UINT32_VALUE;
+    CTC_ERROR_RETURN(_sys_humber_opf_get_pool(opf, &p_pool));
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
     start_offset = p_opf_master->start_offset_a[type_index][pool_index];
     max_size     = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset   = start_offset + max_size;
+    p_max_pre    = &p_opf_master->max_offset_for_pre_alloc[type_index][pool_index];
+    p_min_rev    = &p_opf_master->min_offset_for_rev_alloc[type_index][pool_index];
 
-    if (type_index >= MAX_OPF_TBL_NUM)
+    if (block_size == 0)
     {
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
+        block_size = 1;
+    }
 
-        return CTC_E_INVALID_PARAM;
+    if (multiple == 0)
+    {
+        multiple = 1;
     }
 
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
+    if (block_size > max_size)
     {
-        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
+        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
 
         return CTC_E_INVALID_PARAM;
     }
 
-    if (block_size == 0)
+    if (is_reverse)
     {
-        block_size = 1;
+        found = _sys_humber_opf_find_last(p_pool, start_offset, *p_max_pre - start_offset, max_size,
+                                          multiple, block_size, &pos);
     }
-
-    if (block_size > p_opf_master->max_size_a[type_index][pool_index])
+    else if (is_last)
     {
-        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
-
-        return CTC_E_INVALID_PARAM;
+        found = _sys_humber_opf_find_last(p_pool, start_offset, 0, *p_min_rev - start_offset,
+                                          multiple, block_size, &pos);
     }
-
-    entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
-
-    while (entry)
+    else
     {
-        revise_offset = entry->offset + block_size -1 ;
-
-        if (entry->size >= block_size
-            && (revise_offset <=  p_opf_master->min_offset_for_rev_alloc[type_index][pool_index]))
-        {
-            remainder = entry->offset % multiple;
-
-            skip_value = remainder ? (multiple - remainder): remainder;
-
-            if (entry->size >= (skip_value + block_size))
-            {
-                if (remainder)
-                {
-                    /*insert a node, allocate offset from first multiple offset*/
-                    node = (sys_humber_opf_entry_t*) mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-                    kal_memset(node, 0, sizeof(sys_humber_opf_entry_t));
-                    node->size = entry->size - skip_value;
-                    node->offset = entry->offset + skip_value;
-                    node->prev = entry;
-                    node->next = entry->next;
-
-                    entry->size = skip_value;
-                    entry->next = node;
-                    entry = node;
-                }
-                break;
-            }
-        }
-        entry = entry->next;
+        found = _sys_humber_opf_find_first(p_pool, start_offset, 0, *p_min_rev - start_offset,
+                                           multiple, block_size, &pos);
     }
 
-    if (!entry)
+    if (!found)
     {
         SYS_OPF_DBG_INFO(
                         "type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
@@ -872,189 +847,129 @@ sys_humber_opf_alloc_multiple_offset(sys_humber_opf_t *opf,uint8 multiple,uint32
         return CTC_E_NO_ALLOC_OFFSET;
     }
 
+    _sys_humber_opf_set_range(p_pool, pos, pos + block_size, FALSE);
+    *offset = start_offset + pos;
 
-    *offset = entry->offset;
-
-    entry->size -= block_size;
-    if(entry->size == 0)
+    if (is_reverse)
     {
-        next = entry->next;
-        if(entry->prev)
-        {
-            entry->prev->next = next;
-        }
-        else
-        {
-            p_opf_master->ppp_opf_pre[type_index][pool_index] = next;
-        }
-        if(next)
+        if (*offset < *p_min_rev)
         {
-            next->prev = entry->prev;
+            *p_min_rev = *offset;
         }
-        mem_free(entry);
-    }
-    else
-    {
-        entry->offset += block_size;
     }
-
-    if ((*offset + block_size) > p_opf_master->max_offset_for_pre_alloc[type_index][pool_index])
+    else if ((*offset + block_size) > *p_max_pre)
     {
-        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = *offset +block_size;
+        *p_max_pre = *offset + block_size;
     }
 
     return CTC_E_NONE;
 }
 
+int32
+sys_humber_opf_reverse_alloc_offset(sys_humber_opf_t *opf,uint32 block_size,uint32*offset)
+{
+    return _sys_humber_opf_alloc(opf, TRUE, FALSE, 1, block_size, offset);
+}
+
+int32
+sys_humber_opf_alloc_offset(sys_humber_opf_t *opf,uint32 block_size,uint32*offset)
+{
+    return _sys_humber_opf_alloc(opf, FALSE, FALSE, 1, block_size, offset);
+}
 
-extern int32
-sys_humber_opf_reverse_alloc_multiple_offset(sys_humber_opf_t *opf,uint8 multiple,uint32 block_size,uint32*offset)
+/*alloc the highest offset under the reverse allocated ones*/
+int32
+sys_humber_opf_alloc_offset_last(sys_humber_opf_t *opf, uint32 block_size, uint32*offset)
+{
+    return _sys_humber_opf_alloc(opf, FALSE, TRUE, 1, block_size, offset);
+}
+
+
+int32
+sys_humber_opf_alloc_offset_from_position(sys_humber_opf_t *opf, uint32 block_size, uint32 begin)
 {
+    sys_humber_opf_pool_t *p_pool = NULL;
     uint8  type_index = 0;
     uint8  pool_index = 0;
     uint32 start_offset = 0;
-    uint32 end_offset = 0;
-    uint32 revise_offset = 0;
     uint32 max_size = 0;
-    uint32 remainder = 0;
-    uint32 skip_value = 0;
-    uint32 min_offset = 0;
-    sys_humber_opf_entry_t *entry, *next;
-    sys_humber_opf_entry_t  *node;
+    uint32 end = 0;
 
-    CTC_PTR_VALID_CHECK(opf);
-    *offset = CTC_MAX_UINT32_VALUE;
+    CTC_ERROR_RETURN(_sys_humber_opf_get_pool(opf, &p_pool));
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
-    if (type_index >= MAX_OPF_TBL_NUM)
-    {
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
-
-        return CTC_E_INVALID_PARAM;
-    }
-
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
-    {
-        SYS_OPF_DBG_INFO( "invalid pool index : %d\n", pool_index);
-
-        return CTC_E_INVALID_PARAM;
-    }
+    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
+    max_size     = p_opf_master->max_size_a[type_index][pool_index];
 
-    if (block_size == 0)
+    if(block_size == 0)
     {
         block_size = 1;
     }
 
-    if (block_size > p_opf_master->max_size_a[type_index][pool_index])
+    if(block_size > max_size)
     {
-        SYS_OPF_DBG_INFO( "invalid block_size:%d\n", block_size);
-
+        SYS_OPF_DBG_INFO("invalid block_size:%d\n", block_size);
         return CTC_E_INVALID_PARAM;
     }
-    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
-    max_size = p_opf_master->max_size_a[type_index][pool_index];
-    end_offset = start_offset + max_size;
 
+    end = begin + block_size - 1;
 
-    entry = p_opf_master->ppp_opf_rev[type_index][pool_index];
-
-    while (entry)
+    if ((begin < start_offset) || (end + 1 > p_opf_master->min_offset_for_rev_alloc[type_index][pool_index]))
     {
-        revise_offset = (end_offset - entry->offset - block_size) + start_offset;
-        if (entry->size >= block_size
-           && (revise_offset >= p_opf_master->max_offset_for_pre_alloc[type_index][pool_index]))
-        {
-            remainder = revise_offset % multiple;
-            skip_value = multiple - remainder;
-
-            if (entry->size >= (remainder ? (skip_value + block_size) : block_size))
-            {
-                if (remainder)
-                {
-                    /*insert a node, allocate offset from first multiple offset*/
-                    node = (sys_humber_opf_entry_t*) mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-                    kal_memset(node, 0, sizeof(sys_humber_opf_entry_t));
-                    node->size = entry->size - skip_value;
-                    node->offset = entry->offset + skip_value;
-                    node->prev = entry;
-                    node->next = entry->next;
-
-                    entry->size = skip_value;
-                    entry->next = node;
-                    entry = node;
-                }
-                break;
-            }
-        }
-            entry = entry->next;
+        return CTC_E_NO_OFFSET_LEFT;
     }
 
-
-    if (!entry)
+    if (!_sys_humber_opf_range_is(p_pool, begin - start_offset, end + 1 - start_offset, TRUE))
     {
-        SYS_OPF_DBG_INFO(
-                        "type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
-
+        SYS_OPF_DBG_INFO("type_index=%d pool_index=%d This pool don't have enough memory!\n", type_index, pool_index);
         return CTC_E_NO_ALLOC_OFFSET;
     }
-    revise_offset = (end_offset - entry->offset - block_size) + start_offset;
 
-    if (entry->size > block_size)
+    _sys_humber_opf_set_range(p_pool, begin - start_offset, end + 1 - start_offset, FALSE);
+
+    if(end + 1 > p_opf_master->max_offset_for_pre_alloc[type_index][pool_index])
     {
-        entry->size -= block_size;
-        entry->offset += block_size;
+        p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = end + 1;
     }
-    else
-    {
-        /* entry->size == block_size */
-        entry->size -= block_size;
-        entry->offset += block_size;
-        min_offset = entry->offset;
-        next = entry->next;
 
-        if (entry->prev && next)
-        {
-            entry->prev->next = next;
-            next->prev = entry->prev;
-
-            mem_free(entry);
-        }
-        else if (next)
-        {
-            /* entry->prev == NULL && next != NULL */
-            p_opf_master->ppp_opf_rev[type_index][pool_index] = next;
-            next->prev = entry->prev;
+	return CTC_E_NONE;
+}
 
-            mem_free(entry);
-        }
-        /* next == NULL in this condition this node cannot be free */
-    }
+/*alloc multiple offset*/
+extern int32
+sys_humber_opf_alloc_multiple_offset(sys_humber_opf_t *opf,uint8 multiple,uint32 block_size,uint32*offset)
+{
+    return _sys_humber_opf_alloc(opf, FALSE, FALSE, multiple, block_size, offset);
+}
 
-    *offset = revise_offset ;
 
-    if (*offset <  p_opf_master->min_offset_for_rev_alloc[type_index][pool_index])
-    {
-        p_opf_master->min_offset_for_rev_alloc[type_index][pool_index] = *offset;
-    }
-    return CTC_E_NONE;
+extern int32
+sys_humber_opf_reverse_alloc_multiple_offset(sys_humber_opf_t *opf,uint8 multiple,uint32 block_size,uint32*offset)
+{
+    return _sys_humber_opf_alloc(opf, TRUE, FALSE, multiple, block_size, offset);
 }
 
-static int32
-_sys_humber_opf_pre_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 offset)
+int32
+sys_humber_opf_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 offset)
 {
+    sys_humber_opf_pool_t *p_pool = NULL;
     uint8  type_index = 0;
     uint8  pool_index = 0;
-    uint32 start_offset;
+    uint32 start_offset = 0;
     uint32 max_size = 0;
-    sys_humber_opf_entry_t *entry, *prev = NULL, *next = NULL, *node;
-    uint8  is_merged = 0;
+    uint32 *p_max_pre = NULL;
+    uint32 *p_min_rev = NULL;
+    uint32 run = 0;
 
+    CTC_ERROR_RETURN(_sys_humber_opf_get_pool(opf, &p_pool));
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
     start_offset = p_opf_master->start_offset_a[type_index][pool_index];
     max_size     = p_opf_master->max_size_a[type_index][pool_index];
+    p_max_pre    = &p_opf_master->max_offset_for_pre_alloc[type_index][pool_index];
+    p_min_rev    = &p_opf_master->min_offset_for_rev_alloc[type_index][pool_index];
 
     if (block_size == 0)
     {
@@ -1075,124 +990,36 @@ _sys_humber_opf_pre_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 o
         return CTC_E_INVALID_PARAM;
     }
 
-    entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
-    while(entry != NULL)
+    /* a block that is not fully allocated is rejected */
+    if (!_sys_humber_opf_range_is(p_pool, offset - start_offset, offset + block_size - start_offset, FALSE))
     {
-        /* |              ..********      | */
-        if(offset + block_size == entry->offset)
-        {
-            /*change offset and block size */
-            entry->offset = offset;
-            entry->size += block_size;
-            is_merged = 1;
-            break;
-        }
-        /* |              ********..      | */
-        if(entry->offset + entry->size == offset)
-        {
-            /*change block size */
-            entry->size += block_size;
-            is_merged = 1;
-            if(entry->next && entry->next->offset == entry->offset + entry->size)
-            {
-                next = entry->next;
-                entry->size += next->size;
-                entry->next = next->next;
-                if(entry->next)
-                {
-                    entry->next->prev = entry;
-                }
-                mem_free(next);
-            }
-            break;
-        }
-        /* |            ..  ********      | */
-        if(offset + block_size < entry->offset)
-        {
-            break;
-        }
-        /* |            ********  ..      | */
-        if(offset > entry->offset + entry->size)
-        {
-            prev = entry;
-            entry = entry->next;
-            continue;
-        }
-        /* |            ********          | */
-        /* |              ..              | */
         SYS_OPF_DBG_INFO("invalid offset: %d invalid block_size:%d\n",
                           offset, block_size);
         return CTC_E_INVALID_PARAM;
     }
 
-    if(!is_merged)
-    {
-        node = (sys_humber_opf_entry_t*)mem_malloc(MEM_OPF_MODULE, sizeof(sys_humber_opf_entry_t));
-        CTC_PTR_VALID_CHECK(node);
-
-        node->offset = offset;
-        node->size = block_size;
-        node->prev = prev;
-        node->next = entry;
-
-        if(prev)
-        {
-            prev->next = node;
-        }
-        else
-        {
-            p_opf_master->ppp_opf_pre[type_index][pool_index] = node;
-        }
-
-        if(entry)
-        {
-            entry->prev = node;
-        }
-    }
-    else
-    {
-        if( (p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] <= entry->offset + entry->size)
-            && (!p_opf_master->is_reserve[type_index][pool_index]))
-        {
-            p_opf_master->max_offset_for_pre_alloc[type_index][pool_index] = entry->offset;
-        }
-    }
-
-    return CTC_E_NONE;
-}
-int32
-sys_humber_opf_free_offset(sys_humber_opf_t *opf,uint32 block_size,uint32 offset)
-{
-    uint8  type_index = 0;
-    uint8  pool_index = 0;
-
-    CTC_PTR_VALID_CHECK(opf);
-
-    type_index = opf->pool_type;
-    pool_index = opf->pool_index;
-
-    if (type_index >= MAX_OPF_TBL_NUM)
-    {
-        SYS_OPF_DBG_INFO( "invalid type index : %d\n", type_index);
-
-        return CTC_E_INVALID_PARAM;
-    }
+    _sys_humber_opf_set_range(p_pool, offset - start_offset, offset + block_size - start_offset, TRUE);
 
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
+    if (p_opf_master->is_reserve[type_index][pool_index])
     {
-        SYS_OPF_DBG_INFO( "invalid pool index : %d\n",  pool_index);
-
-        return CTC_E_INVALID_PARAM;
+        return CTC_E_NONE;
     }
 
-    if (offset >= p_opf_master->max_offset_for_pre_alloc[type_index][pool_index])
+    /* pull the allocation marks back over the free run the block joined */
+    if (offset >= *p_max_pre)
     {
-        return  _sys_humber_opf_reverse_free_offset(opf, block_size, offset);
+        _sys_humber_opf_run_from(p_pool, 1, 0, p_pool->leaf_base * SYS_OPF_WORD_BITS,
+                                 *p_min_rev - start_offset, &run);
+        *p_min_rev += run;
     }
     else
     {
-        return  _sys_humber_opf_pre_free_offset(opf, block_size, offset);
+        _sys_humber_opf_run_under(p_pool, 1, 0, p_pool->leaf_base * SYS_OPF_WORD_BITS,
+                                  *p_max_pre - start_offset, &run);
+        *p_max_pre -= run;
     }
+
+    return CTC_E_NONE;
 }
 
 static int32
@@ -1200,7 +1027,7 @@ sys_humber_opf_print_used_offset_list(ctc_slist_t *opf_used_offset_list,sys_humb
 {
     uint8 all_offset_len = 0;
     uint8 row_length = 32;
-    char out_offset[11];
+    char out_offset[24];
     char all_offset_one_row[32];
     sys_offset_node_t *offset_node = NULL;
     ctc_slistnode_t *node = NULL, *next_node = NULL;
@@ -1214,14 +1041,7 @@ sys_humber_opf_print_used_offset_list(ctc_slist_t *opf_used_offset_list,sys_humb
     /* print and free all nodes */
     if (0 == opf_used_offset_list->count)
     {
-        if( NULL == p_opf_master->ppp_opf_pre[opf->pool_type][opf->pool_index])
-        {
-            SYS_OPF_DBG_INFO("all offset used\n");
-        }
-        else
-        {
-            SYS_OPF_DBG_INFO("no offset used\n");
-        }
+        SYS_OPF_DBG_INFO("no offset used\n");
     }
     else
     {
@@ -1254,8 +1074,11 @@ sys_humber_opf_print_used_offset_list(ctc_slist_t *opf_used_offset_list,sys_humb
         }
     }
 
-    all_offset_one_row[kal_strlen(all_offset_one_row)-1] = '\0';
-    SYS_OPF_DBG_INFO("%s\n", all_offset_one_row);
+    if (kal_strlen(all_offset_one_row))
+    {
+        all_offset_one_row[kal_strlen(all_offset_one_row)-1] = '\0';
+        SYS_OPF_DBG_INFO("%s\n", all_offset_one_row);
+    }
     SYS_OPF_DBG_INFO( "-----------------------------------\n");
 
     return CTC_E_NONE;
@@ -1282,143 +1105,94 @@ sys_humber_opf_free_used_offset_list(ctc_slist_t *opf_used_offset_list)
     return CTC_E_NONE;
 }
 
+/* offsets [pos, *p_end) all free or all used from pos, returns the state */
+static bool
+_sys_humber_opf_next_range(sys_humber_opf_pool_t *p_pool, uint32 pos, uint32 max_size, uint32 *p_end)
+{
+    uint32 word = p_pool->p_bitmap[pos / SYS_OPF_WORD_BITS];
+    bool is_free = SYS_OPF_BIT_IS_FREE(word, pos % SYS_OPF_WORD_BITS);
+
+    for (*p_end = pos + 1; *p_end < max_size; (*p_end)++)
+    {
+        word = p_pool->p_bitmap[*p_end / SYS_OPF_WORD_BITS];
+        if (SYS_OPF_BIT_IS_FREE(word, *p_end % SYS_OPF_WORD_BITS) != (uint32)is_free)
+        {
+            break;
+        }
+    }
+
+    return is_free;
+}
+
 int32
 sys_humber_opf_print_alloc_info(sys_humber_opf_t *opf)
 {
+    sys_humber_opf_pool_t *p_pool = NULL;
     uint8 type_index = 0;
     uint8 pool_index = 0;
     uint32 offset_index = 0;
     uint32 min_offset = 0;
     uint32 max_offset = 0;
-    uint32 pre_start = 0;
-    uint32 pre_end = 0;
-    uint32 start = 0;
-    uint32 end = 0 ;
+    uint32 max_size = 0;
+    uint32 pos = 0;
+    uint32 end = 0;
+    uint32 free_run_num = 0;
+    uint32 largest_run = 0;
 
-    sys_humber_opf_entry_t* entry;
     sys_offset_node_t* offset_node = NULL;
-    ctc_slist_t* offset_slist_pr = NULL;
-    ctc_slist_t* offset_slist_bf = NULL;
-    ctc_slistnode_t *tmp_head_node = NULL;
-
-    CTC_PTR_VALID_CHECK(opf);
-
-    offset_slist_pr = ctc_slist_new();
-    CTC_PTR_VALID_CHECK(offset_slist_pr);
-
-    offset_slist_bf = ctc_slist_new();
-    CTC_PTR_VALID_CHECK(offset_slist_bf);
+    ctc_slist_t* offset_slist = NULL;
 
+    CTC_ERROR_RETURN(_sys_humber_opf_get_pool(opf, &p_pool));
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
-      if (type_index >= MAX_OPF_TBL_NUM)
-      {
-          SYS_OPF_DBG_INFO( "invalid type index: %d \n", type_index);
-
-          return CTC_E_INVALID_PARAM;
-      }
-
-      if (pool_index >= p_opf_master->max_tbl_num[type_index])
-      {
-          SYS_OPF_DBG_INFO( "invalid pool index:%d\n", pool_index);
+    offset_slist = ctc_slist_new();
+    CTC_PTR_VALID_CHECK(offset_slist);
 
-          return CTC_E_INVALID_PARAM;
-      }
-     max_offset = p_opf_master->start_offset_a[type_index][pool_index] + p_opf_master->max_size_a[type_index][pool_index];
+     max_size = p_opf_master->max_size_a[type_index][pool_index];
+     max_offset = p_opf_master->start_offset_a[type_index][pool_index] + max_size;
      min_offset = p_opf_master->start_offset_a[type_index][pool_index];
      SYS_OPF_DBG_INFO( "min offset:%d \n", min_offset);
      SYS_OPF_DBG_INFO( "max offset:%d \n",max_offset);
      SYS_OPF_DBG_INFO( "current allocated max offset for previous allocation scheme:%d \n", p_opf_master->max_offset_for_pre_alloc[type_index][pool_index]);
      SYS_OPF_DBG_INFO( "current allocated min offset for reverse allocation scheme:%d \n", p_opf_master->min_offset_for_rev_alloc[type_index][pool_index]);
 
-     SYS_OPF_DBG_INFO( "previous allocation scheme\n");
+     SYS_OPF_DBG_INFO( "free offset\n");
      SYS_OPF_DBG_INFO( "%6s    %7s    %4s\n", "index","offset","size");
      SYS_OPF_DBG_INFO( "-----------------------------------\n");
 
-     pre_end = max_offset - 1;
-
-     entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
-     /* walk through the entry list */
-     while (entry)
+     /* walk through the free and used ranges */
+     for (pos = 0; pos < max_size; pos = end)
      {
-        SYS_OPF_DBG_INFO("%6d    %7d    %4d \n", offset_index,entry->offset,entry->size);
-
-        if (min_offset == entry->offset)
-        {
-            pre_start = entry->size;
-        }
-        else
+        if (_sys_humber_opf_next_range(p_pool, pos, max_size, &end))
         {
-            start = pre_start;
-            end = entry->offset - 1;
-
-            /* offset_slist_pr add node */
-            offset_node = (sys_offset_node_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_offset_node_t));
-            if (NULL == offset_node)
-            {
-                return CTC_E_NO_MEMORY;
-            }
-            offset_node->start = start;
-            offset_node->end = end;
-            offset_node->head.next = NULL;
-
-            /* different from offset_slist_bf */
-            ctc_slist_add_tail(offset_slist_pr, &offset_node->head);
-            pre_start = entry->offset + entry->size;
+            SYS_OPF_DBG_INFO("%6d    %7d    %4d \n", offset_index, min_offset + pos, end - pos);
+            offset_index++;
+            continue;
         }
 
-        entry = entry->next;
-        offset_index++;
-     }
-     SYS_OPF_DBG_INFO( "-----------------------------------\n");
-     SYS_OPF_DBG_INFO( "\nreverse allocation scheme\n");
-     SYS_OPF_DBG_INFO( "%6s    %7s    %4s\n", "index","offset","size");
-     SYS_OPF_DBG_INFO( "-----------------------------------\n");
-     offset_index = 0;
-     entry = p_opf_master->ppp_opf_rev[type_index][pool_index];
-     /* walk through the entry list */
-     while (entry)
-     {
-        SYS_OPF_DBG_INFO("%6d    %7d    %4d \n", offset_index, entry->offset, entry->size);
-
-        if (min_offset == entry->offset)
+        offset_node = (sys_offset_node_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_offset_node_t));
+        if (NULL == offset_node)
         {
-            pre_end = max_offset - entry->size -1;
-        }
-        else
-        {
-            start = max_offset - entry->offset;
-            end = pre_end;
-
-            /* offset_slist_bf add node */
-            offset_node = (sys_offset_node_t *)mem_malloc(MEM_OPF_MODULE, sizeof(sys_offset_node_t));
-            if (NULL == offset_node)
-            {
-                return CTC_E_NO_MEMORY;
-            }
-            offset_node->start = start;
-            offset_node->end = end;
-            offset_node->head.next = NULL;
-            ctc_slist_add_head(offset_slist_bf, &offset_node->head);
-
-            pre_end = max_offset - entry->offset - entry->size -1;
+            sys_humber_opf_free_used_offset_list(offset_slist);
+            return CTC_E_NO_MEMORY;
         }
-
-        entry = entry->next;
-        offset_index++;
+        offset_node->start = min_offset + pos;
+        offset_node->end = min_offset + end - 1;
+        offset_node->head.next = NULL;
+        ctc_slist_add_tail(offset_slist, &offset_node->head);
      }
      SYS_OPF_DBG_INFO( "-----------------------------------\n");
 
-    /* merge offset_slist_pr and offset_slist_bf */
-    tmp_head_node = CTC_SLISTHEAD(offset_slist_bf);
-    ctc_slist_add_tail(offset_slist_pr, tmp_head_node);
+    free_run_num = offset_index;
+    largest_run = p_pool->p_best[1];
+    SYS_OPF_DBG_INFO("free offset num:%u, free range num:%u, largest free range:%u\n",
+                     p_pool->free_num, free_run_num, largest_run);
+    SYS_OPF_DBG_INFO("fragmentation:%u%%\n",
+                     p_pool->free_num ? 100 - (largest_run * 100 / p_pool->free_num) : 0);
 
-    CTC_ERROR_RETURN(sys_humber_opf_print_used_offset_list(offset_slist_pr,opf));
-    CTC_ERROR_RETURN(sys_humber_opf_free_used_offset_list(offset_slist_pr));
-    ctc_slist_delete(offset_slist_bf);
-
-    tmp_head_node = NULL;
+    CTC_ERROR_RETURN(sys_humber_opf_print_used_offset_list(offset_slist,opf));
+    CTC_ERROR_RETURN(sys_humber_opf_free_used_offset_list(offset_slist));
 
     return CTC_E_NONE;
 }
@@ -1426,34 +1200,29 @@ sys_humber_opf_print_alloc_info(sys_humber_opf_t *opf)
 int32
 sys_humber_opf_print_sample_info(sys_humber_opf_t *opf)
 {
+    sys_humber_opf_pool_t *p_pool = NULL;
     uint8 type_index = 0;
     uint8 pool_index = 0;
-    sys_humber_opf_entry_t *entry;
+    uint32 start_offset = 0;
+    uint32 max_size = 0;
+    uint32 pos = 0;
+    uint32 end = 0;
 
+    CTC_ERROR_RETURN(_sys_humber_opf_get_pool(opf, &p_pool));
     type_index = opf->pool_type;
     pool_index = opf->pool_index;
 
-    if (type_index >= MAX_OPF_TBL_NUM)
-    {
-        return CTC_E_INVALID_PARAM;
-    }
-
-    if (pool_index >= p_opf_master->max_tbl_num[type_index])
-    {
-        return CTC_E_INVALID_PARAM;
-    }
-    entry = p_opf_master->ppp_opf_pre[type_index][pool_index];
+    start_offset = p_opf_master->start_offset_a[type_index][pool_index];
+    max_size = p_opf_master->max_size_a[type_index][pool_index];
 
-    /* walk through the entry list */
-    while(entry)
+    /* walk through the free ranges */
+    for (pos = 0; pos < max_size; pos = end)
     {
-        SYS_OPF_DBG_INFO("offset %u    size %u\n", entry->offset, entry->size);
-        entry = entry->next;
+        if (_sys_humber_opf_next_range(p_pool, pos, max_size, &end))
+        {
+            SYS_OPF_DBG_INFO("offset %u    size %u\n", start_offset + pos, end - pos);
+        }
     }
 
     return CTC_E_NONE;
 }
-
-
-
-
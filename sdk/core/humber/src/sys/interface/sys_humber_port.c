@@ -42,11 +42,33 @@
 *****************************************************************************/
 static sys_port_master_t *p_port_master = NULL;
 
+/* port tables are software only, the driver serves their field
+   read-modify-writes from a shadow copy instead of the chip */
+static const tbl_id_t sys_humber_port_shadow_tbl[] =
+{
+    DS_PHY_PORT, DS_PHY_PORT_EXT, DS_SRC_PORT, DS_DEST_PHY_PORT, DS_DEST_PORT
+};
+
 /****************************************************************************
  *
 * Function
 *
 *****************************************************************************/
+static void
+_sys_humber_port_shadow_disable(uint8 lchip_num)
+{
+    uint8 chip = 0;
+    uint32 i = 0;
+
+    for (chip = 0; chip < lchip_num; chip++)
+    {
+        for (i = 0; i < sizeof(sys_humber_port_shadow_tbl) / sizeof(sys_humber_port_shadow_tbl[0]); i++)
+        {
+            drv_tbl_shadow_disable(chip, sys_humber_port_shadow_tbl[i]);
+        }
+    }
+}
+
 /**
  @brief initialize the port module
 */
@@ -58,6 +80,7 @@ sys_humber_port_init(void)
     uint16 gport = 0;
     //uint8 lport = 0;
     uint32 lport = 0;
+    uint32 i = 0;
     uint8 chip = 0;
     uint8 gchip = 0;
     uint8 lchip_num = 0;
@@ -157,6 +180,16 @@ sys_humber_port_init(void)
     {
         sys_humber_get_gchip_id(chip, &gchip);
 
+        for (i = 0; i < sizeof(sys_humber_port_shadow_tbl) / sizeof(sys_humber_port_shadow_tbl[0]); i++)
+        {
+            ret = drv_tbl_shadow_enable(chip, sys_humber_port_shadow_tbl[i]);
+            if (ret)
+            {
+                _sys_humber_port_shadow_disable(chip + 1);
+                return ret;
+            }
+        }
+
         for (index = 0; index < MAX_PORT_NUM_PER_CHIP; index++)
         {
             CTC_ERROR_RETURN(drv_tbl_ioctl(chip, index, phy_cmd, &phy_port));
@@ -230,6 +263,31 @@ sys_humber_port_init(void)
 
 }
 
+/**
+ @brief de-initialize the port module, the shadow copies of the port tables are dropped
+*/
+int32
+sys_humber_port_deinit(void)
+{
+    uint8 lchip_num = 0;
+
+    if (NULL == p_port_master)
+    {
+        return CTC_E_NONE;
+    }
+
+    lchip_num = sys_humber_get_local_chip_num();
+    _sys_humber_port_shadow_disable(lchip_num);
+
+    FREE_2D_POINTER(p_port_master->egs_port_prop, lchip_num);
+    FREE_2D_POINTER(p_port_master->igs_port_prop, lchip_num);
+    kal_mutex_destroy(p_port_master->p_port_mutex);
+    mem_free(p_port_master);
+    p_port_master = NULL;
+
+    return CTC_E_NONE;
+}
+
 /**
  @brief set the port global_src_port and global_dest_port in system
 */
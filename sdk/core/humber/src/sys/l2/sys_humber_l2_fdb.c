@@ -302,7 +302,10 @@ _sys_humber_l2_fdb_hash_compare (sys_l2_node_t* backet_node,sys_l2_node_t* lkup_
 static int32
 _sys_humber_l2_fdb_add_to_hash_table(sys_l2_node_t* p_fdb_node)
 {
-    ctc_hash_insert(pl2_master->fdb_hash, p_fdb_node);
+    if (NULL == ctc_hash_insert(pl2_master->fdb_hash, p_fdb_node))
+    {
+        return CTC_E_NO_MEMORY;
+    }
     return CTC_E_NONE;
 }
 
@@ -368,7 +371,10 @@ _sys_humber_l2_fdb_fid_entry_add_to_hash_table(sys_l2_fdb_vlan_node_t* fid_node)
 {
 
     fid_node->gport = fid_node->port_valid ? fid_node->gport:0xFFFF;
-    ctc_hash_insert(pl2_master->fdb_dft_entry_hash, fid_node);
+    if (NULL == ctc_hash_insert(pl2_master->fdb_dft_entry_hash, fid_node))
+    {
+        return CTC_E_NO_MEMORY;
+    }
     return CTC_E_NONE;
 }
 
@@ -427,7 +433,10 @@ _sys_humber_l2_fdb_mac_entry_hash_make (sys_l2_node_t* backet)
 static int32
 _sys_humber_l2_fdb_mac_entry_add_to_hash_table(sys_l2_node_t* p_fdb_node)
 {
-    ctc_hash_insert(pl2_master->fdb_mac_hash, p_fdb_node);
+    if (NULL == ctc_hash_insert(pl2_master->fdb_mac_hash, p_fdb_node))
+    {
+        return CTC_E_NO_MEMORY;
+    }
     return CTC_E_NONE;
 }
 
@@ -567,7 +576,13 @@ _sys_humber_l2_fdb_add_to_fdb_vlan_list(sys_l2_node_t* l2_node)
       }
       fid_node->fid = l2_node->key.fid;
       fid_node->port_valid = 0;
-      _sys_humber_l2_fdb_fid_entry_add_to_hash_table(fid_node);
+      if (CTC_E_NONE != _sys_humber_l2_fdb_fid_entry_add_to_hash_table(fid_node))
+      {
+          ctc_list_delete(fid_node->vlan_fdb_list);
+          mem_free(fid_node);
+          fid_node = NULL;
+          return CTC_E_NO_MEMORY;
+      }
     }
 
     l2_node->vlan_entey = ctc_listnode_add_tail(fid_node->vlan_fdb_list, l2_node);
@@ -655,7 +670,13 @@ _sys_humber_l2_fdb_add_to_dflt_entry(sys_l2_node_t* pfdb_node, uint16 gport, uin
         p_fid_node->fid = pfdb_node->key.fid;
         p_fid_node->gport = gport;
         p_fid_node->port_valid = port_valid;
-        _sys_humber_l2_fdb_fid_entry_add_to_hash_table(p_fid_node);
+        if (CTC_E_NONE != _sys_humber_l2_fdb_fid_entry_add_to_hash_table(p_fid_node))
+        {
+            ctc_list_free(p_fid_node->vlan_fdb_list);
+            mem_free(p_fid_node);
+            p_fid_node = NULL;
+            return CTC_E_NO_MEMORY;
+        }
     }
     p_fid_node->fdb_dft_node = pfdb_node;
 
@@ -1688,8 +1709,20 @@ L2_LOCK;
             CTC_ERROR_RETURN_WITH_UNLOCK(ret, pl2_master->l2_mutex);
         }
 
-        _sys_humber_l2_fdb_add_to_hash_table(p_l2_node);
-        _sys_humber_l2_fdb_mac_entry_add_to_hash_table(p_l2_node);
+        ret = _sys_humber_l2_fdb_add_to_hash_table(p_l2_node);
+        if (CTC_E_NONE == ret)
+        {
+            ret = _sys_humber_l2_fdb_mac_entry_add_to_hash_table(p_l2_node);
+        }
+        if (CTC_E_NONE != ret)
+        {
+            _sys_humber_l2_fdb_remove_from_hash_table(p_l2_node);
+            _sys_humber_l2_fdb_remove_from_fdb_vlan_list(p_l2_node);
+            _sys_humber_l2_fdb_remove_from_fdb_port_list(p_l2_node);
+            _sys_humber_l2_free_index(p_l2_node, &bd_hw_entry);
+            mem_free(p_l2_node);
+            CTC_ERROR_RETURN_WITH_UNLOCK(ret, pl2_master->l2_mutex);
+        }
 
     }
     else
@@ -2012,8 +2045,21 @@ L2_LOCK;
            mem_free(p_l2_node);
            CTC_ERROR_RETURN_WITH_UNLOCK(ret, pl2_master->l2_mutex);
        }
-        _sys_humber_l2_fdb_add_to_hash_table(p_l2_node);
-        _sys_humber_l2_fdb_mac_entry_add_to_hash_table(p_l2_node);
+
+        ret = _sys_humber_l2_fdb_add_to_hash_table(p_l2_node);
+        if (CTC_E_NONE == ret)
+        {
+            ret = _sys_humber_l2_fdb_mac_entry_add_to_hash_table(p_l2_node);
+        }
+        if (CTC_E_NONE != ret)
+        {
+            _sys_humber_l2_fdb_remove_from_hash_table(p_l2_node);
+            _sys_humber_l2_fdb_remove_from_fdb_vlan_list(p_l2_node);
+            _sys_humber_l2_fdb_remove_from_fdb_port_list(p_l2_node);
+            _sys_humber_l2_free_index(p_l2_node, &bd_hw_entry);
+            mem_free(p_l2_node);
+            CTC_ERROR_RETURN_WITH_UNLOCK(ret, pl2_master->l2_mutex);
+        }
     }
     else
     {
@@ -5058,6 +5104,8 @@ sys_humber_l2_fdb_init(void* l2_fdb_global_cfg)
         return CTC_E_NONE;
     }
 
+    CTC_ERROR_RETURN(sys_humber_hash_init());
+
     pl2_master = (sys_l2_master_t *)mem_malloc(MEM_FDB_MODULE, sizeof(sys_l2_master_t));
     if (NULL == pl2_master)
     {
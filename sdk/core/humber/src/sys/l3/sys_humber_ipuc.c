@@ -1391,6 +1391,8 @@ sys_humber_ipuc_init(void)
         return CTC_E_NONE;
     }
 
+    CTC_ERROR_RETURN(sys_humber_hash_init());
+
     CTC_ERROR_RETURN(sys_alloc_get_table_entry_num(DS_IPV4_UCAST_HASH_KEY0, &bucket_num[CTC_IP_VER_4]));
     CTC_ERROR_RETURN(sys_alloc_get_table_entry_num(DS_IPV6_UCAST_HASH_KEY0, &bucket_num[CTC_IP_VER_6]));
 
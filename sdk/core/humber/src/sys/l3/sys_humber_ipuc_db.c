@@ -210,7 +210,10 @@ _sys_humber_ipv6_hash_cmp(sys_ipuc_info_t* p_ipuc_info1, sys_ipuc_info_t* p_ipuc
 static int32
 _sys_humber_ipuc_db_add(sys_ipuc_info_t* p_ipuc_info)
 {
-    ctc_hash_insert(p_ipuc_db_master->ipuc_hash[p_ipuc_info->ip_ver], p_ipuc_info);
+    if (NULL == ctc_hash_insert(p_ipuc_db_master->ipuc_hash[p_ipuc_info->ip_ver], p_ipuc_info))
+    {
+        return CTC_E_NO_MEMORY;
+    }
 
     return CTC_E_NONE;
 }
@@ -677,12 +680,22 @@ sys_humber_ipuc_db_index_lookup(sys_ipuc_info_t** pp_ipuc_info)
 int32
 sys_humber_ipuc_db_add(sys_ipuc_info_t* p_ipuc_info)
 {
+    int32 ret;
+
     if(!p_ipuc_info->in_sram)
     {
         CTC_ERROR_RETURN(sys_humber_ipuc_db_get_offset(p_ipuc_info));
     }
 
-    CTC_ERROR_RETURN(_sys_humber_ipuc_db_add(p_ipuc_info));
+    ret = _sys_humber_ipuc_db_add(p_ipuc_info);
+    if (CTC_E_NONE != ret)
+    {
+        if(!p_ipuc_info->in_sram)
+        {
+            _sys_humber_ipuc_db_free_offset(p_ipuc_info);
+        }
+        return ret;
+    }
 
     return CTC_E_NONE;
 }
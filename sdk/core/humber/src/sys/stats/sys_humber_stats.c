@@ -133,6 +133,7 @@ struct sys_stats_master_s
     uint16 mtu2_length[SYS_STATS_MAC_STATS_RAM_MAX];
     uint16 dot1q_subtract[SYS_STATS_CPUMAC_STATS_RAM+1];
 
+    kal_mutex_t* p_fwd_stats_mutex; /* DS_FORWARDING_STATS access and sys_fwd_stats_hash */
 };
 typedef struct sys_stats_master_s sys_stats_master_t;
 
@@ -142,6 +143,30 @@ static ctc_hash_t* sys_fwd_stats_hash[CTC_MAX_LOCAL_CHIP_NUM];
 #define SYS_FWD_STATS_HASH_BLOCK_NUM      16
 #define SYS_FWD_STATS_HASH_BLOCK_SIZE    256  /* total 8 * 512 = 4096 stats */
 
+#define SYS_FWD_STATS_LOCK \
+    do { \
+        if (stats_master->p_fwd_stats_mutex) \
+        { \
+            kal_mutex_lock(stats_master->p_fwd_stats_mutex); \
+        } \
+    } while (0)
+#define SYS_FWD_STATS_UNLOCK \
+    do { \
+        if (stats_master->p_fwd_stats_mutex) \
+        { \
+            kal_mutex_unlock(stats_master->p_fwd_stats_mutex); \
+        } \
+    } while (0)
+#define SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(op) \
+    do { \
+        int32 rv = (op); \
+        if (rv < 0) \
+        { \
+            SYS_FWD_STATS_UNLOCK; \
+            return rv; \
+        } \
+    } while (0)
+
 #define SYS_STATS_INIT_CHECK() \
     {\
         if(  stats_master == NULL)\
@@ -172,6 +197,14 @@ _sys_humber_stats_hash_cmp (sys_stats_fwd_stats_t* pv_node_a, sys_stats_fwd_stat
     return TRUE;
 }
 
+static int32
+_sys_humber_stats_hash_free(void* bucket_data, void* user_data)
+{
+    mem_free(bucket_data);
+
+    return TRUE;
+}
+
 static int32
 _sys_humber_stats_init_start(void)
 {
@@ -572,6 +605,11 @@ sys_humber_stats_init(void)
     }
     kal_memset(stats_master, 0, sizeof(sys_stats_master_t));
 
+    if((ret = kal_mutex_create(&(stats_master->p_fwd_stats_mutex))) < 0)
+    {
+        goto error;
+    }
+
     /*fwd stats dynamic alloc sram*/
     if((ret = sys_humber_opf_init(FWD_STATS_SRAM, chip_num)) < 0)
     {
@@ -844,11 +882,52 @@ sys_humber_stats_init(void)
     return CTC_E_NONE;
 
     error:
+        if (stats_master->p_fwd_stats_mutex)
+        {
+            kal_mutex_destroy(stats_master->p_fwd_stats_mutex);
+            stats_master->p_fwd_stats_mutex = NULL;
+        }
         _sys_humber_stats_deinit_start();
 
         return ret;
 }
 
+/**
+ @brief De-initialize the stats module, the fwd stats nodes and the fwd stats mutex are freed
+*/
+int32
+sys_humber_stats_deinit(void)
+{
+    uint8 lchip;
+
+    if (NULL == stats_master)
+    {
+        return CTC_E_NONE;
+    }
+
+    CTC_ERROR_RETURN(_sys_humber_stats_deinit_start());
+
+    for (lchip = 0; lchip < MAX_LOCAL_CHIP_NUM; lchip++)
+    {
+        if (NULL == sys_fwd_stats_hash[lchip])
+        {
+            continue;
+        }
+        ctc_hash_traverse_remove(sys_fwd_stats_hash[lchip], _sys_humber_stats_hash_free, NULL);
+        ctc_hash_free(sys_fwd_stats_hash[lchip]);
+        sys_fwd_stats_hash[lchip] = NULL;
+    }
+
+    if (stats_master->p_fwd_stats_mutex)
+    {
+        kal_mutex_destroy(stats_master->p_fwd_stats_mutex);
+    }
+    mem_free(stats_master);
+    stats_master = NULL;
+
+    return CTC_E_NONE;
+}
+
 static int32
 _sys_humber_stats_get_mac_ram_type(uint16 gport, uint8* ram_type)
 {
@@ -4043,11 +4122,35 @@ sys_humber_stats_reset_egs_port_log_stats(uint16 gport)
     return CTC_E_NONE;
 }
 
+static int32
+_sys_stats_fwd_stats_entry_lookup(uint8 lchip, uint16 stats_ptr, sys_stats_fwd_stats_t** pp_fwd_stats)
+{
+    sys_stats_fwd_stats_t lookup_key;
+
+    CTC_PTR_VALID_CHECK(pp_fwd_stats);
+
+    *pp_fwd_stats = NULL;
+
+    lookup_key.stats_ptr = stats_ptr;
+    *pp_fwd_stats = ctc_hash_lookup(sys_fwd_stats_hash[lchip], &lookup_key);
+
+    return CTC_E_NONE;
+}
+
 static int32
 _sys_stats_fwd_stats_entry_create(uint8 lchip, uint16 stats_ptr)
 {
     sys_stats_fwd_stats_t *p_fwd_stats;
 
+    /* a stats ptr given out again starts from zero, never add a second node */
+    CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &p_fwd_stats));
+    if (NULL != p_fwd_stats)
+    {
+        p_fwd_stats->packet_count = 0;
+        p_fwd_stats->byte_count = 0;
+        return CTC_E_NONE;
+    }
+
     p_fwd_stats = (sys_stats_fwd_stats_t *)mem_malloc(MEM_STATS_MODULE, sizeof(sys_stats_fwd_stats_t));
     if (NULL == p_fwd_stats)
     {
@@ -4057,7 +4160,11 @@ _sys_stats_fwd_stats_entry_create(uint8 lchip, uint16 stats_ptr)
     kal_memset(p_fwd_stats, 0, sizeof(sys_stats_fwd_stats_t));
     p_fwd_stats->stats_ptr = stats_ptr;
 
-    ctc_hash_insert(sys_fwd_stats_hash[lchip], p_fwd_stats);
+    if (NULL == ctc_hash_insert(sys_fwd_stats_hash[lchip], p_fwd_stats))
+    {
+        mem_free(p_fwd_stats);
+        return CTC_E_NO_MEMORY;
+    }
 
     return CTC_E_NONE;
 }
@@ -4074,21 +4181,6 @@ _sys_stats_fwd_stats_entry_delete(uint8 lchip, uint16 stats_ptr, sys_stats_fwd_s
     return CTC_E_NONE;
 }
 
-static int32
-_sys_stats_fwd_stats_entry_lookup(uint8 lchip, uint16 stats_ptr, sys_stats_fwd_stats_t** pp_fwd_stats)
-{
-    sys_stats_fwd_stats_t lookup_key;
-
-    CTC_PTR_VALID_CHECK(pp_fwd_stats);
-
-    *pp_fwd_stats = NULL;
-
-    lookup_key.stats_ptr = stats_ptr;
-    *pp_fwd_stats = ctc_hash_lookup(sys_fwd_stats_hash[lchip], &lookup_key);
-
-    return CTC_E_NONE;
-}
-
 int32
 sys_humber_stats_create_statsptr(uint8 lchip, uint8 stats_szie, uint16* p_stats_ptr)
 {
@@ -4107,7 +4199,9 @@ sys_humber_stats_create_statsptr(uint8 lchip, uint8 stats_szie, uint16* p_stats_
     *p_stats_ptr = offset;
 
     /*add to fwd stats list,special for acl/qos,mpls stats*/
-    CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_create(lchip, offset));
+    SYS_FWD_STATS_LOCK;
+    SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_stats_fwd_stats_entry_create(lchip, offset));
+    SYS_FWD_STATS_UNLOCK;
 
     return CTC_E_NONE;
 }
@@ -4129,11 +4223,13 @@ sys_humber_stats_delete_statsptr(uint8 lchip, uint8 stats_szie, uint16 stats_ptr
     CTC_ERROR_RETURN(sys_humber_opf_free_offset(&opf, stats_szie, offset));
 
     /*remove from fwd stats list,special for acl/qos,mpls stats*/
-    CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
+    SYS_FWD_STATS_LOCK;
+    SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
     if(NULL != fwd_stats)
     {
-        CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_delete(lchip, stats_ptr, fwd_stats));
+        SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_stats_fwd_stats_entry_delete(lchip, stats_ptr, fwd_stats));
     }
+    SYS_FWD_STATS_UNLOCK;
 
     return CTC_E_NONE;
 }
@@ -4149,17 +4245,13 @@ sys_humber_stats_get_fwd_stats_enable(ctc_stats_fwd_type_t fwd_stats_type, bool*
     return CTC_E_NONE;
 }
 
-int32
-sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t* p_stats)
+/* Caller holds p_fwd_stats_mutex, fwd_stats is the db node of stats_ptr or NULL */
+static int32
+_sys_humber_stats_read_flow_stats(uint8 lchip, uint16 stats_ptr, sys_stats_fwd_stats_t* fwd_stats,
+                                  ctc_stats_basic_t* p_stats)
 {
     uint32 cmd = 0;
     ds_forwarding_stats_t ds_stats;
-    sys_stats_fwd_stats_t *fwd_stats;
-
-    SYS_STATS_INIT_CHECK();
-    CTC_PTR_VALID_CHECK(p_stats);
-
-    fwd_stats = NULL;
 
     kal_memset(&ds_stats, 0, sizeof(ds_forwarding_stats_t));
     kal_memset(p_stats, 0, sizeof(ctc_stats_basic_t));
@@ -4168,7 +4260,6 @@ sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t
     CTC_ERROR_RETURN(drv_tbl_ioctl(lchip, stats_ptr, cmd, &ds_stats));
     _sys_humber_stats_ds_stats_to_basic(ds_stats, p_stats);
 
-    CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
     if(NULL != fwd_stats)
     {
         /*add to db*/
@@ -4199,12 +4290,78 @@ sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t
         fwd_stats->packet_count = p_stats->packet_count;
         fwd_stats->byte_count = p_stats->byte_count;
 
-        ctc_hash_insert(sys_fwd_stats_hash[lchip], fwd_stats);
+        if (NULL == ctc_hash_insert(sys_fwd_stats_hash[lchip], fwd_stats))
+        {
+            mem_free(fwd_stats);
+            return CTC_E_NO_MEMORY;
+        }
     }
 
     return CTC_E_NONE;
 }
 
+/* Caller holds p_fwd_stats_mutex */
+static int32
+_sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t* p_stats)
+{
+    sys_stats_fwd_stats_t *fwd_stats = NULL;
+
+    CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
+    CTC_ERROR_RETURN(_sys_humber_stats_read_flow_stats(lchip, stats_ptr, fwd_stats, p_stats));
+
+    return CTC_E_NONE;
+}
+
+int32
+sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t* p_stats)
+{
+    SYS_STATS_INIT_CHECK();
+    CTC_PTR_VALID_CHECK(p_stats);
+
+    SYS_FWD_STATS_LOCK;
+    SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_humber_stats_get_flow_stats(lchip, stats_ptr, p_stats));
+    SYS_FWD_STATS_UNLOCK;
+
+    return CTC_E_NONE;
+}
+
+/**
+ @brief Read the forwarding stats of count stats pointers in one pass.
+        p_stats_ptr should be sorted so the SRAM is walked in address order,
+        p_stats[i] receives the stats of p_stats_ptr[i].
+*/
+int32
+sys_humber_stats_get_flow_stats_bulk(uint8 lchip, const uint16* p_stats_ptr, uint32 count,
+                                     ctc_stats_basic_t* p_stats)
+{
+    uint32 index = 0;
+    sys_stats_fwd_stats_t *fwd_stats = NULL;
+
+    SYS_STATS_INIT_CHECK();
+    CTC_PTR_VALID_CHECK(p_stats_ptr);
+    CTC_PTR_VALID_CHECK(p_stats);
+
+    SYS_FWD_STATS_LOCK;
+    for (index = 0; index < count; index++)
+    {
+        /* the caller reads a snapshot of stats ptrs, one freed since then has
+           no db node and is skipped so the read does not bring it back */
+        fwd_stats = NULL;
+        SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_stats_fwd_stats_entry_lookup(lchip, p_stats_ptr[index], &fwd_stats));
+        if (NULL == fwd_stats)
+        {
+            kal_memset(&p_stats[index], 0, sizeof(ctc_stats_basic_t));
+            continue;
+        }
+
+        SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(
+            _sys_humber_stats_read_flow_stats(lchip, p_stats_ptr[index], fwd_stats, &p_stats[index]));
+    }
+    SYS_FWD_STATS_UNLOCK;
+
+    return CTC_E_NONE;
+}
+
 int32
 sys_humber_stats_reset_flow_stats(uint8 lchip, uint16 stats_ptr)
 {
@@ -4218,15 +4375,17 @@ sys_humber_stats_reset_flow_stats(uint8 lchip, uint16 stats_ptr)
 
     kal_memset(&ds_stats, 0, sizeof(ds_forwarding_stats_t));
 
+    SYS_FWD_STATS_LOCK;
     cmd = DRV_IOW(IOC_TABLE, DS_FORWARDING_STATS, DRV_ENTRY_FLAG);
-    CTC_ERROR_RETURN(drv_tbl_ioctl(lchip, stats_ptr, cmd, &ds_stats));
+    SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(drv_tbl_ioctl(lchip, stats_ptr, cmd, &ds_stats));
 
-    CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
+    SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
     if(NULL != fwd_stats)
     {
         fwd_stats->packet_count = 0;
         fwd_stats->byte_count = 0;
     }
+    SYS_FWD_STATS_UNLOCK;
 
     return CTC_E_NONE;
 }
@@ -5422,14 +5581,16 @@ sys_humber_stats_intr_callback_func(uint8* gchip)
         }
 
         /*get stats from stats ptr*/
-        CTC_ERROR_RETURN(_sys_humber_stats_get_fwd_stats(lchip, stats_ptr, &stats));
+        SYS_FWD_STATS_LOCK;
+        SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_humber_stats_get_fwd_stats(lchip, stats_ptr, &stats));
 
-        CTC_ERROR_RETURN(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
+        SYS_FWD_STATS_ERROR_RETURN_WITH_UNLOCK(_sys_stats_fwd_stats_entry_lookup(lchip, stats_ptr, &fwd_stats));
         if(NULL == fwd_stats)
         {
             fwd_stats = (sys_stats_fwd_stats_t *)mem_malloc(MEM_STATS_MODULE, sizeof(sys_stats_fwd_stats_t));
             if (!fwd_stats)
             {
+                SYS_FWD_STATS_UNLOCK;
                 return CTC_E_NO_MEMORY;
             }
 
@@ -5437,14 +5598,19 @@ sys_humber_stats_intr_callback_func(uint8* gchip)
             fwd_stats->packet_count = stats.packet_count;
             fwd_stats->byte_count = stats.byte_count;
 
-            ctc_hash_insert(sys_fwd_stats_hash[lchip], fwd_stats);
-
+            if (NULL == ctc_hash_insert(sys_fwd_stats_hash[lchip], fwd_stats))
+            {
+                mem_free(fwd_stats);
+                SYS_FWD_STATS_UNLOCK;
+                return CTC_E_NO_MEMORY;
+            }
         }
         else
         {
             fwd_stats->packet_count += stats.packet_count;
             fwd_stats->byte_count += stats.byte_count;
         }
+        SYS_FWD_STATS_UNLOCK;
     }
 
     return CTC_E_NONE;
@@ -40,9 +40,39 @@ typedef struct dal_op_s{
     int32   (*pci_write)(uint8 chip_id, uint32 offset, uint32 value);
 } dal_op_t;
 
+/*
+ * batched chip access: ops queued in a dal_batch_t are executed in queue
+ * order by a single CMD_BATCH_CHIP ioctl on flush. A full batch flushes
+ * itself; read results land in the queued p_value when the batch flushes.
+ */
+#define DAL_BATCH_OP_WRITE      0
+#define DAL_BATCH_OP_READ       1
+#define DAL_BATCH_OP_BARRIER    2
+
+#define DAL_BATCH_MAX_OPS       32
+
+/* same layout as cmdpara_batch_op_t */
+typedef struct dal_batch_op_s{
+    uint32 chip_id;
+    uint32 op;
+    uint32 reg_addr;
+    uint32 value;
+} dal_batch_op_t;
+
+typedef struct dal_batch_s{
+    uint32 count;
+    dal_batch_op_t ops[DAL_BATCH_MAX_OPS];
+    uint32* p_value[DAL_BATCH_MAX_OPS];
+} dal_batch_t;
+
 int32 dal_usrctrl_init(dal_op_t *dal_op);
 int32 dal_usrctrl_write_chip(uint8 chip_id, uint32 offset, uint32 value);
 int32 dal_usrctrl_read_chip(uint8 chip_id, uint32 offset, uint32 p_value);
+void  dal_usrctrl_batch_init(dal_batch_t* p_batch);
+int32 dal_usrctrl_batch_write(dal_batch_t* p_batch, uint8 chip_id, uint32 offset, uint32 value);
+int32 dal_usrctrl_batch_read(dal_batch_t* p_batch, uint8 chip_id, uint32 offset, uint32* p_value);
+int32 dal_usrctrl_batch_barrier(dal_batch_t* p_batch);
+int32 dal_usrctrl_batch_flush(dal_batch_t* p_batch);
 int32 ctckal_usrctrl_read_bay_4w(uint32 chip_id, uint32 fpga_id, uint32 reg_offset, uint32 p_value);
 int32 ctckal_usrctrl_write_bay_4w(uint32 chip_id, uint32 fpga_id, uint32 reg_offset, uint32 p_value);
 int32 ctckal_usrctrl_read_bay_4w(uint32 chip_id, uint32 fpga_id, uint32 reg_offset, uint32 p_value);
@@ -24,6 +24,7 @@ enum cmd_type_e
 {
     CMD_WRITE_CHIP,
     CMD_READ_CHIP,
+    CMD_BATCH_CHIP = 4,     /* 2 and 3 are the 4-word bay write/read */
 
     CMD_TYPE_MAX
 };
@@ -39,6 +40,38 @@ struct cmdpara_chip_s
 };
 typedef struct cmdpara_chip_s cmdpara_chip_t;
 
+#define CMDPARA_BATCH_OP_WRITE    0
+#define CMDPARA_BATCH_OP_READ     1
+#define CMDPARA_BATCH_OP_BARRIER  2
+
+#define CMDPARA_BATCH_MAX_OPS     256
+
+struct cmdpara_batch_op_s
+{
+    uint32 chip_id;
+    uint32 op;          /* CMDPARA_BATCH_OP_XXX */
+    uint32 reg_addr;
+    uint32 value;       /* write data, or read result on return */
+};
+typedef struct cmdpara_batch_op_s cmdpara_batch_op_t;
+
+/*
+ * CMD_BATCH_CHIP executes ops[0..count) in order and stops at the first
+ * failed access: done is the number of ops executed, ret the error of the
+ * failed one. rsv must be 0 and done must come back within the first
+ * sizeof(cmdpara_chip_t) bytes, so a module that predates CMD_BATCH_CHIP
+ * echoes the header with done == 0 and the caller can tell.
+ */
+struct cmdpara_batch_s
+{
+    uint32 rsv;
+    uint32 count;
+    uint32 ops;         /* user address of cmdpara_batch_op_t[count] */
+    uint32 done;
+    int32  ret;
+};
+typedef struct cmdpara_batch_s cmdpara_batch_t;
+
 
 
 #endif
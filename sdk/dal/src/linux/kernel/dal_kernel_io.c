@@ -43,6 +43,9 @@ typedef int32_t int32; /**< 32-bit unsigned integer */
 
 #define CTC_ASIC_CHIP_NUM_MAX 2
 
+/* batch ops are copied in from user space this many at a time */
+#define CTC_ASIC_BATCH_CHUNK 16
+
 /*****************************************************************************
  * typedef
  *****************************************************************************/
@@ -145,6 +148,91 @@ linux_dal_write(unsigned int chip_id, unsigned int reg_offset, unsigned int val)
     return ret;
 }
 
+static int
+linux_dal_batch(unsigned long arg)
+{
+    cmdpara_batch_t batch;
+    cmdpara_batch_op_t ops[CTC_ASIC_BATCH_CHUNK];
+    cmdpara_batch_op_t __user *p_user_ops;
+    unsigned int done = 0;
+    unsigned int num;
+    unsigned int i;
+    int ret = 0;
+
+    if(copy_from_user(&batch, (void*)arg, sizeof(cmdpara_batch_t)))
+    {
+        return -EFAULT;
+    }
+
+    if(batch.count > CMDPARA_BATCH_MAX_OPS)
+    {
+        return -EINVAL;
+    }
+
+    p_user_ops = (cmdpara_batch_op_t __user *)(unsigned long)batch.ops;
+
+    while((done < batch.count) && (0 == ret))
+    {
+        num = min_t(unsigned int, batch.count - done, CTC_ASIC_BATCH_CHUNK);
+        if(copy_from_user(ops, p_user_ops + done, num * sizeof(cmdpara_batch_op_t)))
+        {
+            return -EFAULT;
+        }
+
+        for(i = 0; i < num; i++)
+        {
+            if(CMDPARA_BATCH_OP_BARRIER == ops[i].op)
+            {
+                /* everything before the barrier has reached the chip */
+                mb();
+                continue;
+            }
+
+            if((ops[i].chip_id >= CTC_ASIC_CHIP_NUM_MAX)
+                || (0 == pci_phy_addr[ops[i].chip_id]))
+            {
+                printk("chip %d is not existed\n", ops[i].chip_id);
+                ret = -ENODEV;
+                break;
+            }
+
+            if(CMDPARA_BATCH_OP_READ == ops[i].op)
+            {
+                ret = linux_dal_read(ops[i].chip_id, ops[i].reg_addr, &ops[i].value);
+            }
+            else if(CMDPARA_BATCH_OP_WRITE == ops[i].op)
+            {
+                ret = linux_dal_write(ops[i].chip_id, ops[i].reg_addr, ops[i].value);
+            }
+            else
+            {
+                ret = -EINVAL;
+            }
+
+            if(ret)
+            {
+                break;
+            }
+        }
+
+        /* hand back read results of the ops that ran */
+        if(i && copy_to_user(p_user_ops + done, ops, i * sizeof(cmdpara_batch_op_t)))
+        {
+            return -EFAULT;
+        }
+        done += i;
+    }
+
+    batch.done = done;
+    batch.ret = ret;
+    if(copy_to_user((void*)arg, (void*)&batch, sizeof(cmdpara_batch_t)))
+    {
+        return -EFAULT;
+    }
+
+    return 0;
+}
+
 #ifdef _CTC_OCTEON_CN50XX_
 static long linux_dal_ioctl (struct file *file,
             unsigned int cmd, unsigned long arg)
@@ -156,6 +244,11 @@ static int linux_dal_ioctl (struct inode *inode, struct file *file,
     int ret = 0;
     cmdpara_chip_t access_para;
 
+    if(CMD_BATCH_CHIP == cmd)
+    {
+        return linux_dal_batch(arg);
+    }
+
     if(copy_from_user(&access_para, (void*)arg, sizeof(cmdpara_chip_t)))
     {
         return -EFAULT;
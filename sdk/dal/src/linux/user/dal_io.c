@@ -22,7 +22,12 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <dirent.h>
 #include <sys/klog.h>
+#if defined(DAL_USER_IO) && (defined(__i386__) || defined(__x86_64__))
+#include <sys/io.h>
+#define DAL_USER_IO_PORT
+#endif
 
 #include "kal.h"
 #include "dal_common_io.h"
@@ -35,6 +40,12 @@
 #define CTC_ASIC_IO_WRITE_4W 2
 #define CTC_ASIC_IO_READ_4W  3
 
+#define DAL_PCI_SYSFS_DIR    "/sys/bus/pci/devices"
+#define DAL_PCI_VENDOR_ID    0x18e8
+#define DAL_PCI_DEVICE_ID    0x6048
+#define DAL_MAP_CHIP_NUM_MAX 2
+#define DAL_PCI_IORESOURCE_IO 0x00000100 /* IORESOURCE_IO in the sysfs resource flags */
+
 /*****************************************************************************
  * typedef
  *****************************************************************************/
@@ -71,11 +82,35 @@ typedef struct cmdpara_asic_4w_w_s{
 
 #define CHECK_FD(fd)                    if (fd < 0) return E_FD
 #define	CHECK_PTR(ptr)                  if (!ptr) return E_PTR
+
+/* chip accesses bypass the kernel once a dal_op_t has been installed */
+#define DAL_USER_ACCESS()               (NULL != dal_user_op.pci_write)
 /*****************************************************************************
  * global variables
  *****************************************************************************/
 static int32 dal_devfd  = -1;
 
+/* cleared once the kernel module turns out to predate CMD_BATCH_CHIP */
+static int32 dal_batch_supported = 1;
+
+/* set while a failed CMD_BATCH_CHIP ioctl has the batches run op by op,
+ * cleared by the next flush that succeeds */
+static int32 dal_batch_suspended = 0;
+
+/* user space access path, see dal_usrctrl_init() */
+static dal_op_t dal_user_op;
+
+/* serializes the data, address, status sequence on the indirect window */
+static kal_mutex_t* dal_user_mutex = NULL;
+
+#ifdef DAL_USER_IO_PORT
+/* I/O port base of every humber, see dal_usrctrl_io_op() */
+static uint32 dal_io_base[DAL_MAP_CHIP_NUM_MAX];
+#endif
+
+/* dal_batch_op_t is handed to the kernel as cmdpara_batch_op_t */
+typedef char dal_batch_op_size_check[(sizeof(dal_batch_op_t) == sizeof(cmdpara_batch_op_t)) ? 1 : -1];
+
 /*****************************************************************************
  * static functions
  *****************************************************************************/
@@ -88,12 +123,292 @@ dal_usrctrl_do_cmd(uint32 cmd, uint32 p_para)
     return ioctl(dal_devfd, cmd, p_para);
 }
 
+/* poll the window until the access is acked and decode the status */
+static int32
+dal_usrctrl_user_wait(uint8 chip_id)
+{
+    uint32 status;
+    int32 timeout;
+    int32 ret = 0;
+
+    timeout = HUMBER_PCI_ACCESS_TIMEOUT;
+    status = dal_user_op.pci_read(chip_id, HUMBER_PCI_STATUS);
+    while ((!(status & (1 << HUMBER_PCI_STATUS_REGISTER_ACK))) && (--timeout))
+    {
+        status = dal_user_op.pci_read(chip_id, HUMBER_PCI_STATUS);
+    }
+
+    if (!timeout)
+    {
+        ret += -2;
+    }
+
+    ret += status&(1<<HUMBER_PCI_STATUS_BAD_PARITY)? -4 : 0;
+    ret += status&(1<<HUMBER_PCI_STATUS_CPU_ACCESS_ERR)? -8 : 0;
+    ret += status&(1<<HUMBER_PCI_STATUS_REGISTER_ERR)? -16 : 0;
+
+    return ret;
+}
+
+static int32
+dal_usrctrl_user_read(uint8 chip_id, uint32 offset, uint32* p_value)
+{
+    int32 ret;
+
+    kal_mutex_lock(dal_user_mutex);
+    dal_user_op.pci_write(chip_id, HUMBER_PCI_READ_ADDR, offset);
+    __sync_synchronize();
+
+    ret = dal_usrctrl_user_wait(chip_id);
+
+    /* no read of the data register ahead of the ack */
+    __sync_synchronize();
+    *p_value = dal_user_op.pci_read(chip_id, HUMBER_PCI_READ_DATA);
+    kal_mutex_unlock(dal_user_mutex);
+
+    return ret;
+}
+
+static int32
+dal_usrctrl_user_write(uint8 chip_id, uint32 offset, uint32 value)
+{
+    int32 ret;
+
+    kal_mutex_lock(dal_user_mutex);
+    dal_user_op.pci_write(chip_id, HUMBER_PCI_WRITE_DATA, value);
+
+    /* writing the address kicks off the access, the data must be there */
+    __sync_synchronize();
+    dal_user_op.pci_write(chip_id, HUMBER_PCI_WRITE_ADDR, offset);
+    __sync_synchronize();
+
+    ret = dal_usrctrl_user_wait(chip_id);
+    kal_mutex_unlock(dal_user_mutex);
+
+    return ret;
+}
+
+#ifdef DAL_USER_IO_PORT
+static int32
+dal_usrctrl_io_read(uint8 chip_id, uint32 offset)
+{
+    if ((chip_id >= DAL_MAP_CHIP_NUM_MAX) || (0 == dal_io_base[chip_id]))
+        return -1;
+
+    return inl(dal_io_base[chip_id] + offset);
+}
+
+static int32
+dal_usrctrl_io_write(uint8 chip_id, uint32 offset, uint32 value)
+{
+    if ((chip_id >= DAL_MAP_CHIP_NUM_MAX) || (0 == dal_io_base[chip_id]))
+        return E_CHIPID;
+
+    outl(value, dal_io_base[chip_id] + offset);
+
+    return 0;
+}
+
+static int32
+dal_usrctrl_read_sysfs_id(const char* dev, const char* attr, uint32* p_id)
+{
+    char path[256];
+    FILE* fp;
+    int32 ret;
+
+    snprintf(path, sizeof(path), DAL_PCI_SYSFS_DIR"/%s/%s", dev, attr);
+    fp = fopen(path, "r");
+    if (NULL == fp)
+        return E_FILEO;
+
+    ret = (1 == fscanf(fp, "%x", p_id)) ? 0 : E_FILER;
+    fclose(fp);
+
+    return ret;
+}
+
+/* I/O port range of BAR0, fails unless BAR0 is an I/O port BAR as linux_dal_probe() wants */
+static int32
+dal_usrctrl_read_sysfs_bar0(const char* dev, uint32* p_start, uint32* p_size)
+{
+    char path[256];
+    unsigned long long start;
+    unsigned long long end;
+    unsigned long long flags;
+    FILE* fp;
+    int32 ret;
+
+    snprintf(path, sizeof(path), DAL_PCI_SYSFS_DIR"/%s/resource", dev);
+    fp = fopen(path, "r");
+    if (NULL == fp)
+        return E_FILEO;
+
+    ret = (3 == fscanf(fp, "%llx %llx %llx", &start, &end, &flags)) ? 0 : E_FILER;
+    fclose(fp);
+
+    if (ret || !(flags & DAL_PCI_IORESOURCE_IO) || (0 == start) || (end < start) || (end > 0xFFFF))
+        return E_FILER;
+
+    *p_start = (uint32)start;
+    *p_size = (uint32)(end - start + 1);
+
+    return 0;
+}
+
+/*
+ * Find the I/O port BAR of every humber on the PCI bus, in bus order as the
+ * kernel module numbers them, get access to the ports and fill dal_op with
+ * inl/outl accessors, all or nothing.
+ */
+static int32
+dal_usrctrl_io_op(dal_op_t *dal_op)
+{
+    struct dirent** p_list = NULL;
+    uint32 vendor;
+    uint32 device;
+    uint32 start;
+    uint32 size;
+    uint32 chip_num = 0;
+    int32 num;
+    int32 i;
+    int32 ret = 0;
+
+    CHECK_PTR(dal_op);
+
+    num = scandir(DAL_PCI_SYSFS_DIR, &p_list, NULL, alphasort);
+    if (num < 0)
+        return E_FILEO;
+
+    for (i = 0; i < num; i++)
+    {
+        if ((0 == ret) && (chip_num < DAL_MAP_CHIP_NUM_MAX)
+            && ('.' != p_list[i]->d_name[0])
+            && (0 == dal_usrctrl_read_sysfs_id(p_list[i]->d_name, "vendor", &vendor))
+            && (0 == dal_usrctrl_read_sysfs_id(p_list[i]->d_name, "device", &device))
+            && (DAL_PCI_VENDOR_ID == vendor) && (DAL_PCI_DEVICE_ID == device))
+        {
+            ret = dal_usrctrl_read_sysfs_bar0(p_list[i]->d_name, &start, &size);
+            if (0 == ret)
+            {
+                /* ioperm only reaches the first 0x400 ports */
+                ret = ((start + size) <= 0x400) ? ioperm(start, size, 1) : iopl(3);
+            }
+
+            if (0 == ret)
+            {
+                dal_io_base[chip_num++] = start;
+            }
+            else
+            {
+                KAL_LOG_DEBUG("Get I/O ports of %s fail\n", p_list[i]->d_name);
+                ret = E_FILEO;
+            }
+        }
+        free(p_list[i]);
+    }
+    free(p_list);
+
+    if (ret || (0 == chip_num))
+    {
+        /* a half accessible system would mix both paths */
+        for (i = 0; i < DAL_MAP_CHIP_NUM_MAX; i++)
+        {
+            dal_io_base[i] = 0;
+        }
+        return E_FILEO;
+    }
+
+    dal_op->pci_read = dal_usrctrl_io_read;
+    dal_op->pci_write = dal_usrctrl_io_write;
+
+    return 0;
+}
+#endif
+
+static int32
+dal_usrctrl_batch_queue(dal_batch_t* p_batch, uint32 op, uint8 chip_id,
+                        uint32 offset, uint32 value, uint32* p_value)
+{
+    int32 ret;
+    uint32 idx;
+
+    CHECK_PTR(p_batch);
+
+    if (p_batch->count >= DAL_BATCH_MAX_OPS)
+    {
+        ret = dal_usrctrl_batch_flush(p_batch);
+        if (ret)
+            return ret;
+    }
+
+    idx = p_batch->count++;
+    p_batch->ops[idx].chip_id = chip_id;
+    p_batch->ops[idx].op = op;
+    p_batch->ops[idx].reg_addr = offset;
+    p_batch->ops[idx].value = value;
+    p_batch->p_value[idx] = p_value;
+
+    return 0;
+}
+
+/* one ioctl per op, for kernel modules without CMD_BATCH_CHIP */
+static int32
+dal_usrctrl_batch_run_single(dal_batch_t* p_batch)
+{
+    dal_batch_op_t* p_op;
+    uint32 i;
+    int32 ret = 0;
+
+    for (i = 0; (i < p_batch->count) && (0 == ret); i++)
+    {
+        p_op = &p_batch->ops[i];
+        if (DAL_BATCH_OP_WRITE == p_op->op)
+        {
+            ret = dal_usrctrl_write_chip(p_op->chip_id, p_op->reg_addr, p_op->value);
+        }
+        else if (DAL_BATCH_OP_READ == p_op->op)
+        {
+            ret = dal_usrctrl_read_chip(p_op->chip_id, p_op->reg_addr, (uint32)&p_op->value);
+            if ((0 == ret) && p_batch->p_value[i])
+                *p_batch->p_value[i] = p_op->value;
+        }
+    }
+
+    return ret;
+}
+
 /*****************************************************************************
  * exported functions
  *****************************************************************************/
+/*
+ * dal_op is optional: with it, 32-bit chip accesses drive the PCI window
+ * from user space through dal_op instead of one ioctl per access. Built
+ * with DAL_USER_IO on x86, a NULL dal_op takes the I/O port BARs with
+ * ioperm/iopl and drives the window with inl/outl, falling back to the
+ * ioctl path when that fails. The device is still opened for the 4-word
+ * bay accesses.
+ */
 int32
 dal_usrctrl_init(dal_op_t *dal_op)
 {
+#ifdef DAL_USER_IO_PORT
+    dal_op_t io_op;
+
+    if ((NULL == dal_op) && (0 == dal_usrctrl_io_op(&io_op)))
+    {
+        dal_op = &io_op;
+    }
+#endif
+
+    if (dal_op && dal_op->pci_read && dal_op->pci_write)
+    {
+        if ((NULL == dal_user_mutex) && kal_mutex_create(&dal_user_mutex))
+            return -1;
+
+        dal_user_op.pci_read = dal_op->pci_read;
+        dal_user_op.pci_write = dal_op->pci_write;
+    }
+
     if (dal_devfd >= 0)
         return 0;
 
@@ -101,7 +416,7 @@ dal_usrctrl_init(dal_op_t *dal_op)
     if (dal_devfd < 0)
     {
         perror("Warning: can not open device "LINUX_DAL_DEV_NAME);
-        return -1;
+        return DAL_USER_ACCESS() ? 0 : -1;
     }
 
     return 0;
@@ -138,6 +453,14 @@ dal_usrctrl_write_chip(uint8 chip_id, uint32 offset, uint32 value)
     int32 ret;
     cmdpara_chip_t cmdpara_chip;
 
+    if (DAL_USER_ACCESS())
+    {
+        ret = dal_usrctrl_user_write(chip_id, offset, value);
+        if (ret)
+            KAL_LOG_DEBUG("Write addr :%08X fail, ret:%d\n", offset, ret);
+        return ret;
+    }
+
     CMDPARA_ENCODE_CHIP(chip_id, offset, value, cmdpara_chip);
     ret = dal_usrctrl_do_cmd(CMD_WRITE_CHIP, (uint32)&cmdpara_chip);
     if (ret)
@@ -177,6 +500,14 @@ dal_usrctrl_read_chip(uint8 chip_id, uint32 offset, uint32 p_value)
     int32 ret;
     cmdpara_chip_t cmdpara_chip;
 
+    if (DAL_USER_ACCESS())
+    {
+        ret = dal_usrctrl_user_read(chip_id, offset, (uint32*)p_value);
+        if (ret)
+            KAL_LOG_DEBUG("Read addr :%08X fail, ret:%d\n", offset, ret);
+        return ret;
+    }
+
     CMDPARA_ENCODE_CHIP(chip_id, offset, 0x0, cmdpara_chip);
     ret = dal_usrctrl_do_cmd(CMD_READ_CHIP, (uint32)&cmdpara_chip);
     *(uint32 *)p_value = cmdpara_chip.value;
@@ -186,3 +517,93 @@ dal_usrctrl_read_chip(uint8 chip_id, uint32 offset, uint32 p_value)
     return ret;
 }
 
+void
+dal_usrctrl_batch_init(dal_batch_t* p_batch)
+{
+    if (p_batch)
+        p_batch->count = 0;
+}
+
+int32
+dal_usrctrl_batch_write(dal_batch_t* p_batch, uint8 chip_id, uint32 offset, uint32 value)
+{
+    return dal_usrctrl_batch_queue(p_batch, DAL_BATCH_OP_WRITE, chip_id, offset, value, NULL);
+}
+
+int32
+dal_usrctrl_batch_read(dal_batch_t* p_batch, uint8 chip_id, uint32 offset, uint32* p_value)
+{
+    CHECK_PTR(p_value);
+
+    return dal_usrctrl_batch_queue(p_batch, DAL_BATCH_OP_READ, chip_id, offset, 0, p_value);
+}
+
+int32
+dal_usrctrl_batch_barrier(dal_batch_t* p_batch)
+{
+    return dal_usrctrl_batch_queue(p_batch, DAL_BATCH_OP_BARRIER, 0, 0, 0, NULL);
+}
+
+int32
+dal_usrctrl_batch_flush(dal_batch_t* p_batch)
+{
+    cmdpara_batch_t cmdpara_batch;
+    uint32 i;
+    int32 ret;
+
+    CHECK_PTR(p_batch);
+
+    if (0 == p_batch->count)
+        return 0;
+
+    /* without a syscall per access there is nothing to amortize */
+    if (DAL_USER_ACCESS() || !dal_batch_supported || dal_batch_suspended)
+    {
+        ret = dal_usrctrl_batch_run_single(p_batch);
+        if (0 == ret)
+            dal_batch_suspended = 0;
+        p_batch->count = 0;
+        return ret;
+    }
+
+    cmdpara_batch.rsv = 0;
+    cmdpara_batch.count = p_batch->count;
+    cmdpara_batch.ops = (uint32)p_batch->ops;
+    cmdpara_batch.done = 0;
+    cmdpara_batch.ret = 0;
+
+    ret = dal_usrctrl_do_cmd(CMD_BATCH_CHIP, (uint32)&cmdpara_batch);
+    if (ret || (0 == cmdpara_batch.done && 0 == cmdpara_batch.ret))
+    {
+        if (ret)
+        {
+            KAL_LOG_DEBUG("Batch chip access fail, ret:%d\n", ret);
+        }
+        else
+        {
+            /* nothing was executed: the module does not know CMD_BATCH_CHIP */
+            KAL_LOG_DEBUG("Batch chip access unsupported\n");
+            dal_batch_supported = 0;
+        }
+        /* a failed ioctl does not disable batching, only until an access goes through */
+        ret = dal_usrctrl_batch_run_single(p_batch);
+        dal_batch_suspended = (0 != ret);
+        p_batch->count = 0;
+        return ret;
+    }
+
+    for (i = 0; i < cmdpara_batch.done; i++)
+    {
+        if ((DAL_BATCH_OP_READ == p_batch->ops[i].op) && p_batch->p_value[i])
+            *p_batch->p_value[i] = p_batch->ops[i].value;
+    }
+
+    ret = cmdpara_batch.ret;
+    if (ret)
+        KAL_LOG_DEBUG("Batch op %d addr :%08X fail, ret:%d\n", cmdpara_batch.done,
+                      p_batch->ops[cmdpara_batch.done].reg_addr, ret);
+
+    p_batch->count = 0;
+
+    return ret;
+}
@@ -113,3 +113,88 @@ dal_usrctrl_write_chip(uint8 chip_id, uint32 reg_offset, uint32 value)
     return ret;
 }
 
+/* no ioctl to amortize here: the batch is run op by op on flush */
+void
+dal_usrctrl_batch_init(dal_batch_t* p_batch)
+{
+    if(NULL != p_batch)
+        p_batch->count = 0;
+}
+
+static int32
+dal_usrctrl_batch_queue(dal_batch_t* p_batch, uint32 op, uint8 chip_id,
+                        uint32 reg_offset, uint32 value, uint32* p_value)
+{
+    int32 ret;
+    uint32 idx;
+
+    if(NULL == p_batch)
+        return E_PTR;
+
+    if(p_batch->count >= DAL_BATCH_MAX_OPS)
+    {
+        ret = dal_usrctrl_batch_flush(p_batch);
+        if(ret)
+            return ret;
+    }
+
+    idx = p_batch->count++;
+    p_batch->ops[idx].chip_id = chip_id;
+    p_batch->ops[idx].op = op;
+    p_batch->ops[idx].reg_addr = reg_offset;
+    p_batch->ops[idx].value = value;
+    p_batch->p_value[idx] = p_value;
+
+    return 0;
+}
+
+int32
+dal_usrctrl_batch_write(dal_batch_t* p_batch, uint8 chip_id, uint32 reg_offset, uint32 value)
+{
+    return dal_usrctrl_batch_queue(p_batch, DAL_BATCH_OP_WRITE, chip_id, reg_offset, value, NULL);
+}
+
+int32
+dal_usrctrl_batch_read(dal_batch_t* p_batch, uint8 chip_id, uint32 reg_offset, uint32* p_value)
+{
+    if(NULL == p_value)
+        return E_PTR;
+
+    return dal_usrctrl_batch_queue(p_batch, DAL_BATCH_OP_READ, chip_id, reg_offset, 0, p_value);
+}
+
+int32
+dal_usrctrl_batch_barrier(dal_batch_t* p_batch)
+{
+    return dal_usrctrl_batch_queue(p_batch, DAL_BATCH_OP_BARRIER, 0, 0, 0, NULL);
+}
+
+int32
+dal_usrctrl_batch_flush(dal_batch_t* p_batch)
+{
+    dal_batch_op_t* p_op;
+    uint32 i;
+    int32 ret = 0;
+
+    if(NULL == p_batch)
+        return E_PTR;
+
+    for(i = 0; (i < p_batch->count) && (0 == ret); i++)
+    {
+        p_op = &p_batch->ops[i];
+        if(DAL_BATCH_OP_WRITE == p_op->op)
+        {
+            ret = dal_usrctrl_write_chip(p_op->chip_id, p_op->reg_addr, p_op->value);
+        }
+        else if(DAL_BATCH_OP_READ == p_op->op)
+        {
+            ret = dal_usrctrl_read_chip(p_op->chip_id, p_op->reg_addr, (uint32)&p_op->value);
+            if((0 == ret) && p_batch->p_value[i])
+                *p_batch->p_value[i] = p_op->value;
+        }
+    }
+
+    p_batch->count = 0;
+
+    return ret;
+}
@@ -0,0 +1,265 @@
+#
+# drv_humber_field.awk
+#
+# Generate the constant field accessors from the table field registry in
+# src/drv_humber.c:
+#
+#     awk -v out=h -f drv_humber_field.awk src/drv_humber.c > include/drv_humber_field.h
+#     awk -v out=c -f drv_humber_field.awk src/drv_humber.c > src/drv_humber_field.c
+#
+# or "make field" in this directory.
+#
+# Every "static fields_t xxx_tbl_field[]" entry
+#     { len, word_offset, bit_offset STR_DSCP("NAME")}, /*FIELD_ID*/
+# becomes DRV_FIELD_ACCESSOR(field_id, word_offset, bit_offset, len) in the
+# header. The drv_tbl_register() calls map each table id to its field array,
+# the source gets one switch case per field of every registered table.
+#
+
+BEGIN {
+    if ((out != "h") && (out != "c"))
+    {
+        print "drv_humber_field.awk: use -v out=h or -v out=c" > "/dev/stderr"
+        failed = 1
+        exit 1
+    }
+
+    in_tbl = 0
+    in_reg = 0
+    num_tbl = 0
+}
+
+/^static fields_t [a-z0-9_]+_tbl_field\[\] = \{/ {
+    in_tbl = 1
+    tbl = $3
+    sub(/_tbl_field\[\]$/, "", tbl)
+    num_fld[tbl] = 0
+    next
+}
+
+in_tbl && /^};/ {
+    in_tbl = 0
+    next
+}
+
+in_tbl && /STR_DSCP/ {
+    line = $0
+    if (!match(line, /\/\*[A-Z0-9_]+\*\//))
+    {
+        print "drv_humber_field.awk: no field id at line " NR > "/dev/stderr"
+        failed = 1
+        exit 1
+    }
+    id = substr(line, RSTART + 2, RLENGTH - 4)
+
+    sub(/STR_DSCP.*$/, "", line)
+    gsub(/[{,]/, " ", line)
+    split(line, f, " ")
+    len = f[1] + 0
+    word = f[2] + 0
+    shift = f[3] + 0
+
+    if ((len < 1) || (len + shift > 32))
+    {
+        print "drv_humber_field.awk: bad field " id " at line " NR > "/dev/stderr"
+        failed = 1
+        exit 1
+    }
+
+    n = num_fld[tbl]
+    fld_id[tbl, n] = id
+    fld_word[tbl, n] = word
+    fld_shift[tbl, n] = shift
+    fld_len[tbl, n] = len
+    num_fld[tbl] = n + 1
+    next
+}
+
+/drv_tbl_register\($/ {
+    in_reg = 1
+    reg_id = ""
+    next
+}
+
+in_reg && (reg_id == "") && /[A-Z0-9_]+,/ {
+    reg_id = $1
+    sub(/,$/, "", reg_id)
+    next
+}
+
+in_reg && /NUM_OF\([a-z0-9_]+_tbl_field\)/ {
+    match($0, /NUM_OF\([a-z0-9_]+_tbl_field\)/)
+    arr = substr($0, RSTART + 7, RLENGTH - 8)
+    sub(/_tbl_field$/, "", arr)
+    if (!(arr in num_fld))
+    {
+        print "drv_humber_field.awk: " reg_id " has no field array " arr > "/dev/stderr"
+        failed = 1
+        exit 1
+    }
+    tbl_id[num_tbl] = reg_id
+    tbl_arr[num_tbl] = arr
+    num_tbl++
+    in_reg = 0
+    next
+}
+
+function gen_header(    t, i, n)
+{
+    print "/**"
+    print " @file drv_humber_field.h"
+    print ""
+    print " The file is generated from the table field registry in drv_humber.c"
+    print " by drv_humber_field.awk, do not edit it by hand."
+    print ""
+    print " Per field set/get of a raw table entry with the word index, shift and"
+    print " width as constants. Unlike drv_tbl_field_set()/drv_tbl_field_get()"
+    print " nothing is looked up or checked at run time: the set truncates value"
+    print " to the field width."
+    print "*/"
+    print ""
+    print "#ifndef _DRV_HUMBER_FIELD_H_"
+    print "#define _DRV_HUMBER_FIELD_H_"
+    print ""
+    print "#include \"kal.h\""
+    print ""
+    print "#define DRV_FIELD_MASK(len)    (0xFFFFFFFFU >> (32 - (len)))"
+    print ""
+    print "#define DRV_FIELD_ACCESSOR(name, word, shift, len) \\"
+    print "static INLINE void \\"
+    print "drv_##name##_set(uint32* entry, uint32 value) \\"
+    print "{ \\"
+    print "    entry[word] = (entry[word] & ~(DRV_FIELD_MASK(len) << (shift))) \\"
+    print "                  | ((value & DRV_FIELD_MASK(len)) << (shift)); \\"
+    print "} \\"
+    print "static INLINE uint32 \\"
+    print "drv_##name##_get(const uint32* entry) \\"
+    print "{ \\"
+    print "    return (entry[word] >> (shift)) & DRV_FIELD_MASK(len); \\"
+    print "}"
+
+    for (t = 0; t < num_tbl; t++)
+    {
+        n = tbl_arr[t]
+        print ""
+        print "/* " tolower(tbl_id[t]) " */"
+        for (i = 0; i < num_fld[n]; i++)
+        {
+            printf "DRV_FIELD_ACCESSOR(%s, %d, %d, %d)\n", tolower(fld_id[n, i]),
+                   fld_word[n, i], fld_shift[n, i], fld_len[n, i]
+        }
+    }
+
+    print ""
+    print "#endif /*end of _DRV_HUMBER_FIELD_H_*/"
+}
+
+function gen_cases(op,    t, i, n)
+{
+    for (t = 0; t < num_tbl; t++)
+    {
+        n = tbl_arr[t]
+        print "    case " tbl_id[t] ":"
+        print "        switch (field_id)"
+        print "        {"
+        for (i = 0; i < num_fld[n]; i++)
+        {
+            printf "        DRV_FIELD_%s_CASE(%s, %s, %d)\n", op, fld_id[n, i],
+                   tolower(fld_id[n, i]), fld_len[n, i]
+        }
+        print "        default:"
+        print "            break;"
+        print "        }"
+        print "        break;"
+        print ""
+    }
+    print "    default:"
+    print "        break;"
+}
+
+function gen_source()
+{
+    print "/**"
+    print " @file drv_humber_field.c"
+    print ""
+    print " The file is generated from the table field registry in drv_humber.c"
+    print " by drv_humber_field.awk, do not edit it by hand."
+    print ""
+    print " Table field set/get for drv_tbl_ioctl(): the table and field ids pick"
+    print " a drv_humber_field.h accessor through a switch instead of walking the"
+    print " registered field descriptors."
+    print "*/"
+    print ""
+    print "#include \"drv_tbl_reg.h\""
+    print "#include \"drv_humber_field.h\""
+    print ""
+    print "#define DRV_FIELD_SET_CASE(id, name, len) \\"
+    print "        case id: \\"
+    print "            if (value & ~DRV_FIELD_MASK(len)) \\"
+    print "            { \\"
+    print "                break; \\"
+    print "            } \\"
+    print "            drv_##name##_set(entry, value); \\"
+    print "            return DRV_E_NONE;"
+    print ""
+    print "#define DRV_FIELD_GET_CASE(id, name, len) \\"
+    print "        case id: \\"
+    print "            *value = drv_##name##_get(entry); \\"
+    print "            return DRV_E_NONE;"
+    print ""
+    print "/**"
+    print " @brief Set a field of a table data entry in memory with the constant accessor"
+    print ""
+    print " Anything the switch does not take, an unknown table or field or a value"
+    print " too big for the field, goes to drv_tbl_field_set() for its error."
+    print "*/"
+    print "int32"
+    print "drv_humber_tbl_field_set(tbl_id_t tbl_id, fld_id_t field_id,"
+    print "                         uint32* entry, uint32 value)"
+    print "{"
+    print "    DRV_PTR_VALID_CHECK(entry)"
+    print ""
+    print "    switch (tbl_id)"
+    print "    {"
+    gen_cases("SET")
+    print "    }"
+    print ""
+    print "    return drv_tbl_field_set(tbl_id, field_id, entry, value);"
+    print "}"
+    print ""
+    print "/**"
+    print " @brief Get a field of a table data entry in memory with the constant accessor"
+    print ""
+    print " An unknown table or field goes to drv_tbl_field_get() for its error."
+    print "*/"
+    print "int32"
+    print "drv_humber_tbl_field_get(tbl_id_t tbl_id, fld_id_t field_id,"
+    print "                         uint32* entry, uint32* value)"
+    print "{"
+    print "    DRV_PTR_VALID_CHECK(entry)"
+    print "    DRV_PTR_VALID_CHECK(value)"
+    print ""
+    print "    switch (tbl_id)"
+    print "    {"
+    gen_cases("GET")
+    print "    }"
+    print ""
+    print "    return drv_tbl_field_get(tbl_id, field_id, entry, value);"
+    print "}"
+}
+
+END {
+    if (failed)
+    {
+        exit 1
+    }
+
+    if (out == "h")
+    {
+        gen_header()
+    }
+    else
+    {
+        gen_source()
+    }
+}
@@ -0,0 +1,3531 @@
+/**
+ @file drv_humber_field.h
+
+ The file is generated from the table field registry in drv_humber.c
+ by drv_humber_field.awk, do not edit it by hand.
+
+ Per field set/get of a raw table entry with the word index, shift and
+ width as constants. Unlike drv_tbl_field_set()/drv_tbl_field_get()
+ nothing is looked up or checked at run time: the set truncates value
+ to the field width.
+*/
+
+#ifndef _DRV_HUMBER_FIELD_H_
+#define _DRV_HUMBER_FIELD_H_
+
+#include "kal.h"
+
+#define DRV_FIELD_MASK(len)    (0xFFFFFFFFU >> (32 - (len)))
+
+#define DRV_FIELD_ACCESSOR(name, word, shift, len) \
+static INLINE void \
+drv_##name##_set(uint32* entry, uint32 value) \
+{ \
+    entry[word] = (entry[word] & ~(DRV_FIELD_MASK(len) << (shift))) \
+                  | ((value & DRV_FIELD_MASK(len)) << (shift)); \
+} \
+static INLINE uint32 \
+drv_##name##_get(const uint32* entry) \
+{ \
+    return (entry[word] >> (shift)) & DRV_FIELD_MASK(len); \
+}
+
+/* buf_retrv_pkt_msg_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_msg_mem_data0, 0, 0, 7)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_msg_mem_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_msg_mem_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_msg_mem_data3, 3, 0, 32)
+
+/* buf_retrv_buf_ram */
+DRV_FIELD_ACCESSOR(buf_retrv_buf_ram_data0, 0, 0, 25)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_ram_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_ram_data3, 3, 0, 32)
+
+/* buf_retrv_pkt_config_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_config_mem_pkt_config_end, 0, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_config_mem_pkt_config_start, 1, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_config_mem_pkt_config_weight, 0, 16, 6)
+
+/* buf_retrv_pkt_status_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_status_mem_pkt_status_count, 0, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_status_mem_pkt_status_head, 1, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_status_mem_pkt_status_tail, 1, 16, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_status_mem_pkt_status_weight, 0, 16, 6)
+
+/* buf_retrv_pkt_park_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_park_mem_data0, 0, 0, 29)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_park_mem_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_park_mem_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(buf_retrv_pkt_park_mem_data3, 3, 0, 32)
+
+/* buf_retrv_buf_config_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_buf_config_mem_buf_config_burst_cnt_sel, 0, 16, 2)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_config_mem_buf_config_end, 1, 16, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_config_mem_buf_config_start, 1, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_config_mem_buf_config_weight, 0, 0, 6)
+
+/* buf_retrv_buf_status_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status1st_data, 0, 31, 1)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status_count, 0, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status_data_cnt, 0, 24, 3)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status_head, 1, 0, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status_offset, 1, 24, 3)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status_tail, 1, 12, 11)
+DRV_FIELD_ACCESSOR(buf_retrv_buf_status_mem_buf_status_weight, 0, 12, 6)
+
+/* buf_retrv_credit_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_credit_mem_credit, 0, 0, 12)
+
+/* buf_retrv_credit_config_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_credit_config_mem_credit_config, 0, 0, 3)
+
+/* buf_retrv_exception_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_exception_mem_exception_data, 0, 0, 20)
+DRV_FIELD_ACCESSOR(buf_retrv_exception_mem_exception_sub_index_en, 0, 24, 1)
+
+/* buf_retrv_buf_credit_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_buf_credit_mem_credit, 0, 0, 4)
+
+/* buf_retrv_buf_credit_config_mem */
+DRV_FIELD_ACCESSOR(buf_retrv_buf_credit_config_mem_credit_config, 0, 0, 2)
+
+/* ds_buf_retrv_color_map */
+DRV_FIELD_ACCESSOR(ds_buf_retrv_color_map_color_map, 0, 0, 2)
+
+/* met_fifo_priority_map_table */
+DRV_FIELD_ACCESSOR(met_fifo_priority_map_table_drop_precedence, 0, 8, 2)
+DRV_FIELD_ACCESSOR(met_fifo_priority_map_table_met_fifo_priority, 0, 12, 1)
+DRV_FIELD_ACCESSOR(met_fifo_priority_map_table_queue_select, 0, 0, 6)
+DRV_FIELD_ACCESSOR(met_fifo_priority_map_table_resrc_drop_precedence, 0, 10, 2)
+
+/* buffer_store_resrc_cnt */
+DRV_FIELD_ACCESSOR(buffer_store_resrc_cnt_resrc_cnt, 0, 0, 16)
+
+/* buffer_store_resrc_threshold */
+DRV_FIELD_ACCESSOR(buffer_store_resrc_threshold_resrc_drop_threshold0, 1, 0, 16)
+DRV_FIELD_ACCESSOR(buffer_store_resrc_threshold_resrc_drop_threshold1, 1, 16, 16)
+DRV_FIELD_ACCESSOR(buffer_store_resrc_threshold_resrc_drop_threshold2, 0, 0, 16)
+DRV_FIELD_ACCESSOR(buffer_store_resrc_threshold_resrc_drop_threshold3, 0, 16, 16)
+
+/* buf_store_channel_info_ram */
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word0, 0, 0, 17)
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(buf_store_channel_info_ram_word6, 6, 0, 32)
+
+/* buf_store_buf_ptr */
+DRV_FIELD_ACCESSOR(buf_store_buf_ptr_buf_ptr, 0, 0, 17)
+
+/* buffer_store_stall_threshold */
+DRV_FIELD_ACCESSOR(buffer_store_stall_threshold_stall_high, 0, 16, 16)
+DRV_FIELD_ACCESSOR(buffer_store_stall_threshold_stall_low, 0, 0, 16)
+
+/* cpumac_stats_ram */
+DRV_FIELD_ACCESSOR(cpumac_stats_ram_byte_cnt_data_high, 2, 0, 4)
+DRV_FIELD_ACCESSOR(cpumac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(cpumac_stats_ram_frame_cnt_data_high, 0, 0, 4)
+DRV_FIELD_ACCESSOR(cpumac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* tcam_int_key_ram */
+DRV_FIELD_ACCESSOR(tcam_int_key_ram_key0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(tcam_int_key_ram_key1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_int_key_ram_key2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_int_key_ram_key3, 3, 0, 32)
+
+/* tcam_int_mask_ram */
+DRV_FIELD_ACCESSOR(tcam_int_mask_ram_mask0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(tcam_int_mask_ram_mask1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_int_mask_ram_mask2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_int_mask_ram_mask3, 3, 0, 32)
+
+/* tcam_ext_key_ram */
+DRV_FIELD_ACCESSOR(tcam_ext_key_ram_key0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(tcam_ext_key_ram_key1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ext_key_ram_key2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ext_key_ram_key3, 3, 0, 32)
+
+/* tcam_ext_mask_ram */
+DRV_FIELD_ACCESSOR(tcam_ext_mask_ram_mask0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(tcam_ext_mask_ram_mask1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ext_mask_ram_mask2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ext_mask_ram_mask3, 3, 0, 32)
+
+/* int_sram_ram */
+DRV_FIELD_ACCESSOR(int_sram_ram_data0, 0, 0, 8)
+DRV_FIELD_ACCESSOR(int_sram_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(int_sram_ram_data2, 2, 0, 32)
+
+/* hash_tab98k_ram */
+DRV_FIELD_ACCESSOR(hash_tab98k_ram_data0, 0, 0, 8)
+DRV_FIELD_ACCESSOR(hash_tab98k_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(hash_tab98k_ram_data2, 2, 0, 32)
+
+/* ext_ddr_ram */
+DRV_FIELD_ACCESSOR(ext_ddr_ram_data0, 0, 0, 8)
+DRV_FIELD_ACCESSOR(ext_ddr_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ext_ddr_ram_data2, 2, 0, 32)
+
+/* hash_tab50k_ram */
+DRV_FIELD_ACCESSOR(hash_tab50k_ram_data0, 0, 0, 8)
+DRV_FIELD_ACCESSOR(hash_tab50k_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(hash_tab50k_ram_data2, 2, 0, 32)
+
+/* tcam_ext_reg_ram */
+DRV_FIELD_ACCESSOR(tcam_ext_reg_ram_data0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(tcam_ext_reg_ram_data1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ext_reg_ram_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ext_reg_ram_data3, 3, 0, 32)
+
+/* epe_classification_phb_offset_table */
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset0, 0, 30, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset1, 0, 28, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset2, 0, 26, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset3, 0, 24, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset4, 0, 22, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset5, 0, 20, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset6, 0, 18, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset7, 0, 16, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset8, 0, 14, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset9, 0, 12, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset10, 0, 10, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset11, 0, 8, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset12, 0, 6, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset13, 0, 4, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset14, 0, 2, 2)
+DRV_FIELD_ACCESSOR(epe_classification_phb_offset_table_offset15, 0, 0, 2)
+
+/* ds_dest_phy_port */
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_dest_discard, 0, 22, 1)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_discard_non8023_oam, 0, 21, 1)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_global_dest_port, 0, 0, 13)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_l2_span_en, 0, 18, 1)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_l2_span_id, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_mux_port_type, 0, 19, 2)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_random_log_en, 0, 23, 1)
+DRV_FIELD_ACCESSOR(ds_dest_phy_port_random_threshold, 1, 0, 15)
+
+/* epe_hdr_edit_l2_edit_loopback_ram */
+DRV_FIELD_ACCESSOR(epe_hdr_edit_l2_edit_loopback_ram_lb_dest_map, 1, 0, 22)
+DRV_FIELD_ACCESSOR(epe_hdr_edit_l2_edit_loopback_ram_lb_length_adjust_type, 1, 22, 1)
+DRV_FIELD_ACCESSOR(epe_hdr_edit_l2_edit_loopback_ram_lb_next_hop_ext, 3, 20, 1)
+DRV_FIELD_ACCESSOR(epe_hdr_edit_l2_edit_loopback_ram_lb_next_hop_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(epe_hdr_edit_l2_edit_loopback_ram_parity0, 0, 3, 1)
+DRV_FIELD_ACCESSOR(epe_hdr_edit_l2_edit_loopback_ram_parity1, 2, 3, 1)
+
+/* epe_header_edit_sgmac_priority_map_mem */
+DRV_FIELD_ACCESSOR(epe_header_edit_sgmac_priority_map_mem_dp, 0, 8, 2)
+DRV_FIELD_ACCESSOR(epe_header_edit_sgmac_priority_map_mem_tc, 0, 0, 4)
+
+/* epe_hdr_edit_discard_type_stats */
+DRV_FIELD_ACCESSOR(epe_hdr_edit_discard_type_stats_discard_count, 0, 0, 8)
+
+/* ds_l3_edit_tunnel_v6_ip */
+DRV_FIELD_ACCESSOR(ds_l3_edit_tunnel_v6_ip_ip_sa31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3_edit_tunnel_v6_ip_ip_sa63_to32, 2, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3_edit_tunnel_v6_ip_ip_sa95_to64, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3_edit_tunnel_v6_ip_ip_sa127_to96, 0, 0, 32)
+
+/* ds_l3_edit_sequence_num */
+DRV_FIELD_ACCESSOR(ds_l3_edit_sequence_num_seq_num31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3_edit_sequence_num_seq_num63_to32, 2, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3_edit_sequence_num_seq_num95_to64, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3_edit_sequence_num_seq_num127_to96, 0, 0, 32)
+
+/* ds_l3_edit_tunnel_v4_ip_sa */
+DRV_FIELD_ACCESSOR(ds_l3_edit_tunnel_v4_ip_sa_ip_sa, 0, 0, 32)
+
+/* ds_dest_port */
+DRV_FIELD_ACCESSOR(ds_dest_port_bridge_en, 0, 27, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_bridge_l2_match_disable, 0, 16, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_default_vlan_id, 0, 0, 12)
+DRV_FIELD_ACCESSOR(ds_dest_port_dest_port_isolation_id, 2, 4, 6)
+DRV_FIELD_ACCESSOR(ds_dest_port_dot1q_en, 1, 3, 2)
+DRV_FIELD_ACCESSOR(ds_dest_port_egress_filter_en, 0, 19, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_ether_oam_valid, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_force_ipv4_to_mac_key, 0, 21, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_force_ipv6_to_mac_key, 0, 23, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_ipg_index, 1, 0, 2)
+DRV_FIELD_ACCESSOR(ds_dest_port_l2_acl_en, 0, 29, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_l2_acl_high_priority, 0, 14, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_l2_acl_label, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_dest_port_l2_qos_high_priority, 0, 20, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_l2_qos_lable, 1, 16, 8)
+DRV_FIELD_ACCESSOR(ds_dest_port_l2_qos_lookup_en, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_mcast_flooding_disable, 2, 11, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_md_level, 2, 1, 3)
+DRV_FIELD_ACCESSOR(ds_dest_port_pbb_port_type, 2, 24, 3)
+DRV_FIELD_ACCESSOR(ds_dest_port_pip_mac_sa, 2, 16, 8)
+DRV_FIELD_ACCESSOR(ds_dest_port_port_policer_valid, 0, 31, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_qos_domain, 0, 24, 3)
+DRV_FIELD_ACCESSOR(ds_dest_port_replace_cos, 0, 13, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_replace_dscp, 0, 12, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_routed_port, 0, 18, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_stp_check_disable, 0, 15, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_svlan_tpid_index, 1, 5, 2)
+DRV_FIELD_ACCESSOR(ds_dest_port_transmit_en, 0, 30, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_ucast_flooding_disable, 2, 10, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_untag_default_svlan, 1, 14, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_untag_default_vlan_id, 1, 2, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_vlan_flow_policer_valid, 0, 22, 1)
+DRV_FIELD_ACCESSOR(ds_dest_port_vpls_port_type, 1, 15, 1)
+
+/* epe_edit_priority_map_table */
+DRV_FIELD_ACCESSOR(epe_edit_priority_map_table_mapped_cfi, 0, 11, 1)
+DRV_FIELD_ACCESSOR(epe_edit_priority_map_table_mapped_cos, 0, 8, 3)
+DRV_FIELD_ACCESSOR(epe_edit_priority_map_table_mapped_dscp, 0, 0, 6)
+DRV_FIELD_ACCESSOR(epe_edit_priority_map_table_mapped_exp, 0, 12, 3)
+
+/* ds_dest_interface */
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_acl_en, 0, 29, 1)
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_acl_label, 1, 8, 8)
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_acl_routed_only, 0, 30, 1)
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_qos_label, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_qos_lookup_en, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_span_en, 0, 20, 1)
+DRV_FIELD_ACCESSOR(ds_dest_interface_l3_span_id, 0, 18, 2)
+DRV_FIELD_ACCESSOR(ds_dest_interface_mac_sa, 0, 0, 8)
+DRV_FIELD_ACCESSOR(ds_dest_interface_mac_sa_type, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ds_dest_interface_mcast_ttl_threshold, 0, 10, 8)
+DRV_FIELD_ACCESSOR(ds_dest_interface_mtu_check_en, 0, 22, 1)
+DRV_FIELD_ACCESSOR(ds_dest_interface_mtu_exception_en, 0, 27, 1)
+DRV_FIELD_ACCESSOR(ds_dest_interface_mtu_size, 1, 16, 14)
+
+/* ds_vpls_port */
+DRV_FIELD_ACCESSOR(ds_vpls_port_vpls_port_type, 0, 0, 32)
+
+/* epe_next_hop_internal4w */
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_by_pass_all, 1, 23, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_copy_ctag_cos, 1, 27, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_cvlan_tagged, 1, 25, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_derive_stag_cos, 3, 15, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_dest_vlan_ptr, 3, 16, 14)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_l2edit_ptr, 3, 0, 12)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_l2_rewrite_type, 0, 0, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_l3edit_ptr, 1, 0, 18)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_l3_rewrite_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_mtu_check_en, 1, 24, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_output_cvlan_id_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_output_svlan_id_valid, 1, 19, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_payload_operation, 1, 20, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_replace_ctag_cos, 3, 30, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_replace_dscp, 3, 31, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_service_acl_qos_en, 3, 14, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_service_policer_vld, 3, 13, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_stag_cfi, 1, 31, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_stag_cos, 1, 28, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_svlan_tagged, 1, 26, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal4w_tagged_mode, 3, 12, 1)
+
+/* epe_next_hop_internal8w */
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_by_pass_all, 1, 23, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_community_port, 7, 30, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_copy_ctag_cos, 1, 27, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_cvlan_tagged, 1, 25, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_derive_stag_cos, 3, 15, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_dest_vlan_ptr, 3, 16, 14)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l2edit_ptr12to0, 3, 0, 12)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l2edit_ptr19to13, 5, 24, 7)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l2_rewrite_type, 0, 0, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l3edit_ptr18, 5, 31, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l3edit_ptr19, 4, 0, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l3edit_ptr170, 1, 0, 18)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_l3_rewrite_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_mtu_check_en, 1, 24, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_output_cvlan_id_ext, 5, 0, 12)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_output_cvlan_id_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_output_cvlan_id_valid_ext, 4, 1, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_output_svlan_id_ext, 5, 12, 12)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_output_svlan_id_valid, 1, 19, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_output_svlan_id_valid_ext, 4, 2, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_payload_operation, 1, 20, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_replace_ctag_cos, 3, 30, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_replace_dscp, 3, 31, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_service_acl_qos_en, 3, 14, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_service_id, 7, 16, 14)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_service_id_en, 6, 0, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_service_policer_valid, 3, 13, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_stag_cfi, 1, 31, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_stag_cos, 1, 28, 3)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_svlan_tagged, 1, 26, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_svlan_tpid, 7, 14, 2)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_svlan_tpid_en, 7, 13, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_tagged_mode, 3, 12, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_tunnel_mtu_check, 6, 1, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_tunnel_update_disable, 7, 31, 1)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_vpls_dest_port, 7, 0, 13)
+DRV_FIELD_ACCESSOR(epe_next_hop_internal8w_vpls_port_check, 6, 2, 1)
+
+/* epe_statsramepephbintf */
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_byte_count31_to0_epe_phb_intf, 3, 0, 32)
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_byte_count34_to32_epe_phb_intf, 2, 0, 3)
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_byte_count36_to35_epe_phb_intf, 0, 0, 2)
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_packet_count31_to0_epe_phb_intf, 1, 0, 32)
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_parity0_epe_phb_intf, 0, 3, 1)
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_parity1_epe_phb_intf, 2, 3, 1)
+DRV_FIELD_ACCESSOR(epe_statsramepephbintf_use_l3_length_epe_phb_intf, 0, 2, 1)
+
+/* epe_statsramepeportlog */
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_byte_count31_to0_epe_port_log, 3, 0, 32)
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_byte_count34_to32_epe_port_log, 2, 0, 3)
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_byte_count36_to35_epe_port_log, 0, 0, 2)
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_packet_count31_to0_epe_port_log, 1, 0, 32)
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_parity0_epe_port_log, 0, 3, 1)
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_parity1_epe_port_log, 2, 3, 1)
+DRV_FIELD_ACCESSOR(epe_statsramepeportlog_use_l3_length_epe_port_log, 0, 2, 1)
+
+/* epe_statsramepeoverallfwd */
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_byte_count31_to0_epe_overall_fwd, 3, 0, 32)
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_byte_count34_to32_epe_overall_fwd, 2, 0, 3)
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_byte_count36_to35_epe_overall_fwd, 0, 0, 2)
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_packet_count31_to0_epe_overall_fwd, 1, 0, 32)
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_parity0_epe_overall_fwd, 0, 3, 1)
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_parity1_epe_overall_fwd, 2, 3, 1)
+DRV_FIELD_ACCESSOR(epe_statsramepeoverallfwd_use_l3_length_epe_overall_fwd, 0, 2, 1)
+
+/* fabric_cas_info_ram */
+DRV_FIELD_ACCESSOR(fabric_cas_info_ram_info_data, 0, 0, 27)
+
+/* fabric_cas_data_ram */
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data0, 0, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data6, 6, 0, 32)
+DRV_FIELD_ACCESSOR(fabric_cas_data_ram_data7, 7, 0, 32)
+
+/* fabriccrbcellbu_f0 */
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_parity, 8, 0, 8)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word0, 0, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word6, 6, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f0_word7, 7, 0, 32)
+
+/* fabriccrbcellbu_f1 */
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_parity, 8, 0, 8)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word0, 0, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word6, 6, 0, 32)
+DRV_FIELD_ACCESSOR(fabriccrbcellbu_f1_word7, 7, 0, 32)
+
+/* fabriccrbvalidtabl_e0 */
+DRV_FIELD_ACCESSOR(fabriccrbvalidtabl_e0_valid, 0, 0, 1)
+
+/* fabriccrbvalidtabl_e1 */
+DRV_FIELD_ACCESSOR(fabriccrbvalidtabl_e1_valid, 0, 0, 1)
+
+/* fabriccrbptrtabl_e0 */
+DRV_FIELD_ACCESSOR(fabriccrbptrtabl_e0_addr_ptr, 0, 0, 4)
+
+/* fabriccrbptrtabl_e1 */
+DRV_FIELD_ACCESSOR(fabriccrbptrtabl_e1_addr_ptr, 0, 0, 4)
+
+/* fabriccrbcellinfobu_f0 */
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f0_cell_infor, 0, 2, 14)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f0_idle_cell, 0, 23, 1)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f0_priority, 0, 21, 2)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f0_seq_num, 0, 0, 2)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f0_src_chip_id, 0, 16, 5)
+
+/* fabriccrbcellinfobu_f1 */
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f1_cell_infor, 0, 2, 14)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f1_idle_cell, 0, 23, 1)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f1_priority, 0, 21, 2)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f1_seq_num, 0, 0, 2)
+DRV_FIELD_ACCESSOR(fabriccrbcellinfobu_f1_src_chip_id, 0, 16, 5)
+
+/* fabric_gts_rts_track_ram */
+DRV_FIELD_ACCESSOR(fabric_gts_rts_track_ram_data, 0, 0, 16)
+
+/* fabricrtscounter */
+DRV_FIELD_ACCESSOR(fabricrtscounter_count, 0, 0, 11)
+
+/* chaninfotable */
+DRV_FIELD_ACCESSOR(chaninfotable_chan_cell_count, 0, 16, 9)
+DRV_FIELD_ACCESSOR(chaninfotable_chan_cell_head, 1, 0, 9)
+DRV_FIELD_ACCESSOR(chaninfotable_chan_cell_tail, 1, 16, 9)
+DRV_FIELD_ACCESSOR(chaninfotable_tail_cell_write_offset, 0, 0, 3)
+DRV_FIELD_ACCESSOR(chaninfotable_two_frag, 0, 3, 1)
+
+/* cellinfotable */
+DRV_FIELD_ACCESSOR(cellinfotable_first_frag_eop, 0, 1, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_first_frag_error, 0, 9, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_first_frag_full, 0, 8, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_first_frag_length, 0, 4, 3)
+DRV_FIELD_ACCESSOR(cellinfotable_first_frag_sop, 0, 0, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_second_frag_eop, 0, 17, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_second_frag_error, 0, 25, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_second_frag_full, 0, 24, 1)
+DRV_FIELD_ACCESSOR(cellinfotable_second_frag_length, 0, 20, 3)
+DRV_FIELD_ACCESSOR(cellinfotable_second_frag_sop, 0, 16, 1)
+
+/* celltable */
+DRV_FIELD_ACCESSOR(celltable_cell_ptr, 0, 0, 9)
+
+/* hash_ds_ctl_hash_table */
+DRV_FIELD_ACCESSOR(hash_ds_ctl_hash_table_data31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(hash_ds_ctl_hash_table_data34_to32, 2, 0, 3)
+DRV_FIELD_ACCESSOR(hash_ds_ctl_hash_table_data66_to35, 1, 0, 32)
+DRV_FIELD_ACCESSOR(hash_ds_ctl_hash_table_data69_to67, 0, 0, 3)
+DRV_FIELD_ACCESSOR(hash_ds_ctl_hash_table_parity0, 0, 3, 1)
+DRV_FIELD_ACCESSOR(hash_ds_ctl_hash_table_parity1, 2, 3, 1)
+
+/* ipe_aging_ram */
+DRV_FIELD_ACCESSOR(ipe_aging_ram_aging_status, 0, 0, 32)
+
+/* fwdexttable */
+DRV_FIELD_ACCESSOR(fwdexttable_aps_group_id, 0, 16, 16)
+DRV_FIELD_ACCESSOR(fwdexttable_stats_ptr, 0, 0, 16)
+
+/* apsbridgetable */
+DRV_FIELD_ACCESSOR(apsbridgetable_protecting_dest_map, 1, 0, 22)
+DRV_FIELD_ACCESSOR(apsbridgetable_protecting_en, 1, 24, 1)
+DRV_FIELD_ACCESSOR(apsbridgetable_working_dest_map, 0, 0, 16)
+
+/* sequencenumbertable */
+DRV_FIELD_ACCESSOR(sequencenumbertable_sequence_number, 0, 0, 32)
+
+/* apsselecttable */
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en1, 0, 1, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en2, 0, 2, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en3, 0, 3, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en4, 0, 4, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en5, 0, 5, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en6, 0, 6, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en7, 0, 7, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en8, 0, 8, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en9, 0, 9, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en10, 0, 10, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en11, 0, 11, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en12, 0, 12, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en13, 0, 13, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en14, 0, 14, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en15, 0, 15, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en16, 0, 16, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en17, 0, 17, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en18, 0, 18, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en19, 0, 19, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en20, 0, 20, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en21, 0, 21, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en22, 0, 22, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en23, 0, 23, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en24, 0, 24, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en25, 0, 25, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en26, 0, 26, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en27, 0, 27, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en28, 0, 28, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en29, 0, 29, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en30, 0, 30, 1)
+DRV_FIELD_ACCESSOR(apsselecttable_protecting_en31, 0, 31, 1)
+
+/* discardcount */
+DRV_FIELD_ACCESSOR(discardcount_counter, 0, 0, 8)
+
+/* phy_port_map_table */
+DRV_FIELD_ACCESSOR(phy_port_map_table_local_phy_port, 0, 0, 6)
+
+/* sgmac_tc_map_table */
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_color0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_color1, 0, 8, 2)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_color2, 0, 16, 2)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_color3, 0, 24, 2)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_priority0, 0, 2, 6)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_priority1, 0, 10, 6)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_priority2, 0, 18, 6)
+DRV_FIELD_ACCESSOR(sgmac_tc_map_table_priority3, 0, 26, 6)
+
+/* ds_phy_port */
+DRV_FIELD_ACCESSOR(ds_phy_port_keep_vlan_tag, 0, 7, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_l2_span_en, 0, 13, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_l2_span_id, 0, 11, 2)
+DRV_FIELD_ACCESSOR(ds_phy_port_outer_vlan_is_cvlan, 0, 14, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_packet_type, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_phy_port_packet_type_valid, 0, 3, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_pbb_port_type, 0, 4, 3)
+DRV_FIELD_ACCESSOR(ds_phy_port_ptp_en, 0, 10, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_random_log_en, 0, 31, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_random_threshold, 0, 16, 15)
+DRV_FIELD_ACCESSOR(ds_phy_port_src_discard, 0, 15, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_svlan_tpid_index, 0, 8, 2)
+
+/* ds_protocol_vlan */
+DRV_FIELD_ACCESSOR(ds_protocol_vlan_cpu_exception_en, 0, 14, 1)
+DRV_FIELD_ACCESSOR(ds_protocol_vlan_discard, 0, 13, 1)
+DRV_FIELD_ACCESSOR(ds_protocol_vlan_protocol_vlan_id, 0, 0, 12)
+DRV_FIELD_ACCESSOR(ds_protocol_vlan_protocol_vlan_id_valid, 0, 15, 1)
+DRV_FIELD_ACCESSOR(ds_protocol_vlan_replace_tag_en, 0, 12, 1)
+
+/* ds_router_mac */
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac0_byte, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac0_type, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac1_byte, 1, 8, 8)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac1_type, 0, 2, 2)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac2_byte, 1, 16, 8)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac2_type, 0, 4, 2)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac3_byte, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_router_mac_router_mac3_type, 0, 6, 2)
+
+/* ds_vrf */
+DRV_FIELD_ACCESSOR(ds_vrf_pfm0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_vrf_pfm1, 0, 2, 2)
+DRV_FIELD_ACCESSOR(ds_vrf_pfm2, 0, 4, 2)
+DRV_FIELD_ACCESSOR(ds_vrf_pfm3, 0, 6, 2)
+
+/* ds_src_port */
+DRV_FIELD_ACCESSOR(ds_src_port_allow_mcast_mac_sa, 0, 13, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_bridge_en, 0, 27, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_default_replace_tag_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_equal_cos_path_num, 3, 20, 3)
+DRV_FIELD_ACCESSOR(ds_src_port_ether_oam_valid, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_force_acl_qos_ipv4_to_mac_key, 1, 13, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_force_acl_qos_ipv6_to_mac_key, 2, 19, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_ingress_filtering_en, 0, 31, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_ipg_index, 3, 14, 2)
+DRV_FIELD_ACCESSOR(ds_src_port_l2_acl_en, 0, 29, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_l2_acl_high_priority, 0, 19, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_l2_acl_label, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_src_port_l2_qos_high_priority, 1, 12, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_l2_qos_label, 1, 16, 8)
+DRV_FIELD_ACCESSOR(ds_src_port_l2_qos_lookup_en, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_learning_disable, 1, 14, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_mac_security_discard, 0, 30, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_md_level, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_src_port_oam_link_max_md_level, 2, 13, 3)
+DRV_FIELD_ACCESSOR(ds_src_port_oam_tunnel_en, 2, 31, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_pip_mac_sa, 0, 0, 8)
+DRV_FIELD_ACCESSOR(ds_src_port_port_check_en, 0, 8, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_port_cross_connect, 1, 4, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_port_policer_valid, 1, 5, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_port_security_en, 2, 30, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_port_security_exception_en, 1, 8, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_priority_path_en, 3, 18, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_protocol_vlan_en, 0, 12, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_qos_domain, 1, 9, 3)
+DRV_FIELD_ACCESSOR(ds_src_port_qos_policy, 0, 20, 3)
+DRV_FIELD_ACCESSOR(ds_src_port_receive_en, 0, 9, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_routed_port, 0, 10, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_routed_port_vlan_ptr, 3, 0, 14)
+DRV_FIELD_ACCESSOR(ds_src_port_route_disable, 0, 11, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_source_port_isolated, 2, 24, 6)
+DRV_FIELD_ACCESSOR(ds_src_port_use_btag_cos, 2, 18, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_use_outer_ttl, 0, 23, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_use_stag_cos, 3, 16, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_vlan_flow_policer_valid, 1, 6, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_vlan_tag_ctl, 1, 0, 4)
+DRV_FIELD_ACCESSOR(ds_src_port_vpls_port_type, 1, 7, 1)
+DRV_FIELD_ACCESSOR(ds_src_port_vpls_src_port, 2, 0, 13)
+
+/* ds_phy_port_ext */
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_default_dei, 2, 3, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_default_pcp, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_default_vlan_id, 1, 16, 12)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_disable_user_id_ipv4, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_disable_user_id_ipv6, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_egress_user_id_en, 0, 29, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_egress_user_id_type, 0, 30, 2)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_exception2_discard, 2, 16, 16)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_exception2_en, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_force_user_id_ipv4_to_mac_key, 1, 28, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_force_user_id_ipv6_to_mac_key, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_global_src_port, 0, 0, 13)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_oam_obey_user_id, 0, 27, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_src_outer_vlan_is_svlan, 0, 26, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_svlan_key_first, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_user_id_en, 0, 24, 1)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_user_id_label, 0, 16, 6)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_user_id_type, 0, 22, 2)
+DRV_FIELD_ACCESSOR(ds_phy_port_ext_use_default_vlan_lookup, 0, 25, 1)
+
+/* ds_src_interface */
+DRV_FIELD_ACCESSOR(ds_src_interface_exception3_en, 1, 16, 16)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_acl_en, 0, 15, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_acl_label, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_acl_routed_only, 0, 13, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_if_type, 0, 10, 2)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_qos_label, 1, 8, 8)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_qos_lookup_en, 0, 14, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_span_en, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_l3_span_id, 2, 0, 2)
+DRV_FIELD_ACCESSOR(ds_src_interface_lookup_mode, 0, 23, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_mpls_en, 0, 20, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_mpls_label_space, 2, 8, 8)
+DRV_FIELD_ACCESSOR(ds_src_interface_pbr_label, 0, 24, 6)
+DRV_FIELD_ACCESSOR(ds_src_interface_router_mac_label, 0, 0, 6)
+DRV_FIELD_ACCESSOR(ds_src_interface_router_mac_type, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ds_src_interface_route_all_packets, 0, 12, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_v4_mcast_rpf_en, 0, 22, 1)
+DRV_FIELD_ACCESSOR(ds_src_interface_v6_mcast_rpf_en, 0, 21, 1)
+
+/* ds_mpls_ctl */
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_interface_label_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_interface_label_valid_mcast, 0, 18, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_label_base, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_label_base_mcast, 0, 0, 12)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_label_space_sizetype, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_label_space_sizetype_mcast, 0, 12, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_num_of_label, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_ctl_num_of_label_mcast, 0, 16, 2)
+
+/* ds_bidi_pim_group_table */
+DRV_FIELD_ACCESSOR(ds_bidi_pim_group_table_bidi_pim_block, 0, 0, 8)
+
+/* ds_storm_ctl_table */
+DRV_FIELD_ACCESSOR(ds_storm_ctl_table_exception_en, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_storm_ctl_table_running_count, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_storm_ctl_table_storm_en, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_storm_ctl_table_threshold, 0, 0, 32)
+DRV_FIELD_ACCESSOR(ds_storm_ctl_table_use_packet_count, 2, 0, 1)
+
+/* ipe_ds_pbb_mac_table */
+DRV_FIELD_ACCESSOR(ipe_ds_pbb_mac_table_bmac_sa_bit31_to0, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_ds_pbb_mac_table_bmac_sa_bit47_to32, 0, 0, 16)
+DRV_FIELD_ACCESSOR(ipe_ds_pbb_mac_table_global_src_port, 0, 16, 13)
+
+/* ipe_learning_cache */
+DRV_FIELD_ACCESSOR(ipe_learning_cache_cmac_sa_lsb, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_cmac_sa_msb, 4, 0, 16)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_cvlan_id, 0, 0, 12)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_ether_oam_md_level, 1, 13, 3)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_global_src_port, 1, 0, 13)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_is_ether_oam, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_is_vpls_src_port, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_mac_sa_lsb, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_mac_sa_msb, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_mapped_vlan_id, 2, 16, 16)
+DRV_FIELD_ACCESSOR(ipe_learning_cache_svlan_id, 1, 16, 12)
+
+/* ipe_classification_dscp_map_table */
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_color0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_color1, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_color2, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_color3, 0, 24, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_priority0, 0, 2, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_priority1, 0, 10, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_priority2, 0, 18, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_dscp_map_table_dscp_priority3, 0, 26, 6)
+
+/* ipe_classification_cos_map_table */
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_color0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_color1, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_color2, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_color3, 0, 24, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_priority0, 0, 2, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_priority1, 0, 10, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_priority2, 0, 18, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_cos_map_table_cos_priority3, 0, 26, 6)
+
+/* ipe_classification_precedence_map_table */
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_color0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_color1, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_color2, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_color3, 0, 24, 2)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_priority0, 0, 2, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_priority1, 0, 10, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_priority2, 0, 18, 6)
+DRV_FIELD_ACCESSOR(ipe_classification_precedence_map_table_pre_priority3, 0, 26, 6)
+
+/* ipe_mpls_exp_map_table */
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_color0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_color1, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_color2, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_color3, 0, 24, 2)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_priority0, 0, 2, 6)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_priority1, 0, 10, 6)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_priority2, 0, 18, 6)
+DRV_FIELD_ACCESSOR(ipe_mpls_exp_map_table_mpls_priority3, 0, 26, 6)
+
+/* ipe_statsramipephbintf */
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_byte_count31_to0_ipe_phb_intf, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_byte_count34_to32_ipe_phb_intf, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_byte_count36_to35_ipe_phb_intf, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_packet_count31_to0_ipe_phb_intf, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_parity0_ipe_phb_intf, 0, 3, 1)
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_parity1_ipe_phb_intf, 2, 3, 1)
+DRV_FIELD_ACCESSOR(ipe_statsramipephbintf_use_l3_length_ipe_phb_intf, 0, 2, 1)
+
+/* ipe_statsramipeportlog */
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_byte_count31_to0_ipe_port_log, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_byte_count34_to32_ipe_port_log, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_byte_count36_to35_ipe_port_log, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_packet_count31_to0_ipe_port_log, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_parity0_ipe_port_log, 0, 3, 1)
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_parity1_ipe_port_log, 2, 3, 1)
+DRV_FIELD_ACCESSOR(ipe_statsramipeportlog_use_l3_length_ipe_port_log, 0, 2, 1)
+
+/* ipe_statsramipeoverallfwd */
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_byte_count31_to0_ipe_overall_fwd, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_byte_count34_to32_ipe_overall_fwd, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_byte_count36_to35_ipe_overall_fwd, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_packet_count31_to0_ipe_overall_fwd, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_parity0_ipe_overall_fwd, 0, 3, 1)
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_parity1_ipe_overall_fwd, 2, 3, 1)
+DRV_FIELD_ACCESSOR(ipe_statsramipeoverallfwd_use_l3_length_ipe_overall_fwd, 0, 2, 1)
+
+/* met_fifo_rcd_ram */
+DRV_FIELD_ACCESSOR(met_fifo_rcd_ram_rcd, 0, 0, 8)
+
+/* met_fifo_msg_ram */
+DRV_FIELD_ACCESSOR(met_fifo_msg_ram_data0, 0, 0, 31)
+DRV_FIELD_ACCESSOR(met_fifo_msg_ram_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(met_fifo_msg_ram_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(met_fifo_msg_ram_data3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(met_fifo_msg_ram_data4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(met_fifo_msg_ram_data5, 5, 0, 32)
+
+/* ds_met_fifo_excp */
+DRV_FIELD_ACCESSOR(ds_met_fifo_excp_dest_map, 0, 0, 22)
+DRV_FIELD_ACCESSOR(ds_met_fifo_excp_exception_sub_index_en, 0, 22, 1)
+DRV_FIELD_ACCESSOR(ds_met_fifo_excp_length_adjust_type, 0, 24, 1)
+DRV_FIELD_ACCESSOR(ds_met_fifo_excp_next_hop_ext, 0, 23, 1)
+
+/* ds_aps_bridge_mcast */
+DRV_FIELD_ACCESSOR(ds_aps_bridge_mcast_protecting_en, 0, 31, 1)
+DRV_FIELD_ACCESSOR(ds_aps_bridge_mcast_protecting_ucast_id, 0, 0, 12)
+DRV_FIELD_ACCESSOR(ds_aps_bridge_mcast_working_ucast_id, 0, 16, 12)
+
+/* ds_link_agg_block_mask */
+DRV_FIELD_ACCESSOR(ds_link_agg_block_mask_mask_hi, 0, 0, 32)
+DRV_FIELD_ACCESSOR(ds_link_agg_block_mask_mask_lo, 1, 0, 32)
+
+/* ds_link_agg_bitmap */
+DRV_FIELD_ACCESSOR(ds_link_agg_bitmap_block_mask_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_link_agg_bitmap_member_hi, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_link_agg_bitmap_member_lo, 2, 0, 32)
+
+/* net_rx_channel_info_ram */
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_bpdu_state, 0, 5, 1)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_buf_cnt, 0, 0, 2)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_curr_ptr, 1, 0, 9)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_data_error_seen, 0, 4, 1)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_entry_offset, 0, 2, 1)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_head_ptr, 1, 9, 9)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_no_sop_error_seen, 0, 3, 1)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_pkt_len, 1, 18, 14)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_sob_state, 0, 6, 1)
+DRV_FIELD_ACCESSOR(net_rx_channel_info_ram_channel_info_data_state, 0, 7, 1)
+
+/* net_rx_link_list_table */
+DRV_FIELD_ACCESSOR(net_rx_link_list_table_link_list_table_word, 0, 0, 9)
+
+/* net_rx_pkt_buf_ram */
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word0, 0, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word6, 6, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word7, 7, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word8, 8, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word9, 9, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word10, 10, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word11, 11, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word12, 12, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word13, 13, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word14, 14, 0, 32)
+DRV_FIELD_ACCESSOR(net_rx_pkt_buf_ram_pkt_buf_word15, 15, 0, 32)
+
+/* pkt_mem */
+DRV_FIELD_ACCESSOR(pkt_mem_data0, 2, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data1, 3, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data2, 4, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data3, 5, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data4, 6, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data5, 7, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data6, 8, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data7, 9, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data8, 10, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data9, 11, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data10, 12, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data11, 13, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data12, 14, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data13, 15, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data14, 16, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data15, 17, 0, 32)
+DRV_FIELD_ACCESSOR(pkt_mem_data_info, 0, 0, 13)
+DRV_FIELD_ACCESSOR(pkt_mem_pkt_info, 1, 0, 32)
+
+/* ch_static_info_regs */
+DRV_FIELD_ACCESSOR(ch_static_info_regs_end_ptr, 0, 0, 11)
+DRV_FIELD_ACCESSOR(ch_static_info_regs_fifo_depth, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ch_static_info_regs_start_ptr, 0, 16, 11)
+DRV_FIELD_ACCESSOR(ch_static_info_regs_threshold, 1, 16, 8)
+
+/* ch_dynamic_info_regs */
+DRV_FIELD_ACCESSOR(ch_dynamic_info_regs_data_unit_cnt, 0, 0, 8)
+DRV_FIELD_ACCESSOR(ch_dynamic_info_regs_last_pkt_unit_cnt, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ch_dynamic_info_regs_rd_ptr, 2, 0, 11)
+DRV_FIELD_ACCESSOR(ch_dynamic_info_regs_rd_state, 2, 31, 1)
+DRV_FIELD_ACCESSOR(ch_dynamic_info_regs_wr_ptr, 3, 0, 11)
+DRV_FIELD_ACCESSOR(ch_dynamic_info_regs_wr_state, 3, 31, 1)
+
+/* calendar_ctl */
+DRV_FIELD_ACCESSOR(calendar_ctl_cal_entry, 0, 0, 6)
+
+/* oam_ds_oam_excp */
+DRV_FIELD_ACCESSOR(oam_ds_oam_excp_next_hop_ptr, 0, 0, 20)
+
+/* ds_mep_chan_table */
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data0, 0, 0, 4)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data2, 2, 0, 4)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data4, 4, 0, 4)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data6, 6, 0, 4)
+DRV_FIELD_ACCESSOR(ds_mep_chan_table_data7, 7, 0, 32)
+
+/* oam_ds_ma */
+DRV_FIELD_ACCESSOR(oam_ds_ma_aps_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(oam_ds_ma_aps_signal_fail_local, 3, 25, 1)
+DRV_FIELD_ACCESSOR(oam_ds_ma_aps_signal_fail_remote, 3, 24, 1)
+DRV_FIELD_ACCESSOR(oam_ds_ma_ccm_interval, 2, 0, 3)
+DRV_FIELD_ACCESSOR(oam_ds_ma_defect_priority, 1, 6, 6)
+DRV_FIELD_ACCESSOR(oam_ds_ma_intf_status, 3, 21, 3)
+DRV_FIELD_ACCESSOR(oam_ds_ma_ma_id_len, 1, 0, 6)
+DRV_FIELD_ACCESSOR(oam_ds_ma_ma_id_type, 0, 1, 2)
+DRV_FIELD_ACCESSOR(oam_ds_ma_ma_name_index, 1, 16, 15)
+DRV_FIELD_ACCESSOR(oam_ds_ma_md_lvl, 3, 28, 3)
+DRV_FIELD_ACCESSOR(oam_ds_ma_next_hop_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(oam_ds_ma_oam_tunnel_disable, 1, 31, 1)
+DRV_FIELD_ACCESSOR(oam_ds_ma_port_status, 3, 26, 2)
+DRV_FIELD_ACCESSOR(oam_ds_ma_priority_index, 1, 12, 3)
+DRV_FIELD_ACCESSOR(oam_ds_ma_tx_untagged_oam, 0, 0, 1)
+DRV_FIELD_ACCESSOR(oam_ds_ma_tx_with_intf_status, 3, 31, 1)
+DRV_FIELD_ACCESSOR(oam_ds_ma_tx_with_port_status, 3, 20, 1)
+
+/* oam_ds_ma_name */
+DRV_FIELD_ACCESSOR(oam_ds_ma_name_ma_id_icc_index_hi, 0, 0, 3)
+DRV_FIELD_ACCESSOR(oam_ds_ma_name_ma_id_icc_index_lo, 2, 0, 3)
+DRV_FIELD_ACCESSOR(oam_ds_ma_name_ma_id_umc0, 1, 0, 32)
+DRV_FIELD_ACCESSOR(oam_ds_ma_name_ma_id_umc1, 3, 0, 32)
+
+/* oam_ds_icc */
+DRV_FIELD_ACCESSOR(oam_ds_icc_icc_hi, 0, 0, 16)
+DRV_FIELD_ACCESSOR(oam_ds_icc_icc_lo, 1, 0, 32)
+
+/* oam_ds_port_property */
+DRV_FIELD_ACCESSOR(oam_ds_port_property_global_src_port, 0, 16, 14)
+DRV_FIELD_ACCESSOR(oam_ds_port_property_mac_sa_byte, 0, 0, 8)
+
+/* oam_ds_defect_priority */
+DRV_FIELD_ACCESSOR(oam_ds_defect_priority_defect_priority, 0, 0, 6)
+
+/* oam_err_cache */
+DRV_FIELD_ACCESSOR(oam_err_cache_defect_priority_err_cache0, 0, 0, 6)
+DRV_FIELD_ACCESSOR(oam_err_cache_defect_sub_type_err_cache0, 0, 23, 3)
+DRV_FIELD_ACCESSOR(oam_err_cache_defect_type_err_cache0, 0, 26, 3)
+DRV_FIELD_ACCESSOR(oam_err_cache_intf_status_valid_err_cache0, 0, 19, 1)
+DRV_FIELD_ACCESSOR(oam_err_cache_intf_status_value_err_cache0, 0, 16, 3)
+DRV_FIELD_ACCESSOR(oam_err_cache_is_mpls_err_cache0, 0, 29, 1)
+DRV_FIELD_ACCESSOR(oam_err_cache_mep_index_err_cache0, 1, 0, 15)
+DRV_FIELD_ACCESSOR(oam_err_cache_port_status_valid_err_cache0, 0, 22, 1)
+DRV_FIELD_ACCESSOR(oam_err_cache_port_status_value_err_cache0, 0, 20, 2)
+DRV_FIELD_ACCESSOR(oam_err_cache_rmep_index_err_cache0, 1, 16, 15)
+
+/* pktbuf */
+DRV_FIELD_ACCESSOR(pktbuf_data0, 0, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data2, 2, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data3, 3, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data4, 4, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data5, 5, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data6, 6, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data7, 7, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data8, 8, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data9, 9, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data10, 10, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data11, 11, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data12, 12, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data13, 13, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data14, 14, 0, 32)
+DRV_FIELD_ACCESSOR(pktbuf_data15, 15, 0, 32)
+
+/* intprofileram */
+DRV_FIELD_ACCESSOR(intprofileram_data31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(intprofileram_data35_to32, 2, 0, 4)
+DRV_FIELD_ACCESSOR(intprofileram_data67_to36, 1, 0, 32)
+DRV_FIELD_ACCESSOR(intprofileram_data71_to68, 0, 0, 4)
+
+/* extprofileram */
+DRV_FIELD_ACCESSOR(extprofileram_data31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(extprofileram_data35_to32, 2, 0, 4)
+DRV_FIELD_ACCESSOR(extprofileram_data67_to36, 1, 0, 32)
+DRV_FIELD_ACCESSOR(extprofileram_data71_to68, 0, 0, 4)
+
+/* ram_bist_qdr */
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_access_read, 0, 29, 1)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_access_valid, 0, 30, 1)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_access_write, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_data31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_data35_to32, 2, 0, 4)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_data67_to36, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_data71_to68, 0, 0, 4)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_read_address, 0, 8, 20)
+DRV_FIELD_ACCESSOR(ram_bist_qdr_ram_write_address, 2, 8, 20)
+
+/* ram_qdr */
+DRV_FIELD_ACCESSOR(ram_qdr_ram_data31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ram_qdr_ram_data35_to32, 2, 0, 4)
+DRV_FIELD_ACCESSOR(ram_qdr_ram_data67_to36, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ram_qdr_ram_data71_to68, 0, 0, 4)
+
+/* ds_queue_ipg_index */
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index1, 0, 2, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index2, 0, 4, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index3, 0, 6, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index4, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index5, 0, 10, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index6, 0, 12, 2)
+DRV_FIELD_ACCESSOR(ds_queue_ipg_index_ipg_index7, 0, 14, 2)
+
+/* ds_queue_depth */
+DRV_FIELD_ACCESSOR(ds_queue_depth_queue_avg_depth, 0, 16, 16)
+DRV_FIELD_ACCESSOR(ds_queue_depth_queue_inst_depth, 0, 0, 16)
+
+/* ds_link_aggregation */
+DRV_FIELD_ACCESSOR(ds_link_aggregation_dest_chip_id, 0, 16, 5)
+DRV_FIELD_ACCESSOR(ds_link_aggregation_dest_queue, 0, 0, 8)
+
+/* ds_queue_drop_profile_id */
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_force_random_drop0, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_force_random_drop1, 0, 12, 1)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_force_random_drop2, 1, 28, 1)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_force_random_drop3, 1, 12, 1)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_prof_id0, 0, 16, 8)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_prof_id1, 0, 0, 8)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_prof_id2, 1, 16, 8)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_prof_id3, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_que_depth_wt0, 0, 24, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_que_depth_wt1, 0, 8, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_que_depth_wt2, 1, 24, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_id_que_depth_wt3, 1, 8, 4)
+
+/* ds_queue_drop_profile */
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_factor0, 4, 24, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_factor1, 4, 16, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_factor2, 4, 8, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_factor3, 4, 0, 4)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_drop_mode, 5, 0, 1)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_max_thrd0, 0, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_max_thrd1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_max_thrd2, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_max_thrd3, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_min_thrd0, 0, 16, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_min_thrd1, 1, 16, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_min_thrd2, 2, 16, 16)
+DRV_FIELD_ACCESSOR(ds_queue_drop_profile_wred_min_thrd3, 3, 16, 16)
+
+/* ds_queue_num_gen_ctl */
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_dest_chip_id_base, 2, 16, 5)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_dest_chip_id_mask, 0, 0, 5)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_dest_chip_id_shift, 0, 24, 4)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_dest_que_base, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_dest_que_mask, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_dest_que_shift, 0, 16, 4)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_flow_id_base, 4, 0, 8)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_flow_id_mask, 4, 16, 8)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_flow_id_shift, 4, 28, 4)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_que_num_base, 2, 0, 13)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_que_sel_mask, 0, 8, 6)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_que_sel_shift, 0, 28, 4)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_service_que_en, 0, 20, 1)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_sgmac_base, 2, 24, 2)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_sgmac_mask, 2, 26, 2)
+DRV_FIELD_ACCESSOR(ds_queue_num_gen_ctl_sgmac_shift, 2, 28, 4)
+
+/* dsq_mgr_egress_resrc_threshold */
+DRV_FIELD_ACCESSOR(dsq_mgr_egress_resrc_threshold_pri0_que_entry_thrd, 0, 0, 16)
+DRV_FIELD_ACCESSOR(dsq_mgr_egress_resrc_threshold_pri1_que_entry_thrd, 1, 0, 16)
+DRV_FIELD_ACCESSOR(dsq_mgr_egress_resrc_threshold_pri2_que_entry_thrd, 2, 0, 16)
+DRV_FIELD_ACCESSOR(dsq_mgr_egress_resrc_threshold_pri3_que_entry_thrd, 3, 0, 16)
+
+/* dsq_mgr_egress_resrc_count */
+DRV_FIELD_ACCESSOR(dsq_mgr_egress_resrc_count_egress_que_entry_count, 0, 0, 16)
+
+/* ds_link_agg_member_num */
+DRV_FIELD_ACCESSOR(ds_link_agg_member_num_hash_mode, 0, 8, 1)
+DRV_FIELD_ACCESSOR(ds_link_agg_member_num_link_agg_mem_num, 0, 0, 5)
+
+/* ds_sgmac_map */
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac1, 0, 4, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac2, 0, 8, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac3, 0, 12, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac4, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac5, 0, 20, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac6, 0, 24, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac7, 0, 28, 2)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override0, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override1, 0, 6, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override2, 0, 10, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override3, 0, 14, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override4, 0, 18, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override5, 0, 22, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override6, 0, 26, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_override7, 0, 30, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode0, 0, 3, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode1, 0, 7, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode2, 0, 11, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode3, 0, 15, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode4, 0, 19, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode5, 0, 23, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode6, 0, 27, 1)
+DRV_FIELD_ACCESSOR(ds_sgmac_map_sgmac_trunk_grp_mode7, 0, 31, 1)
+
+/* ds_head_hash_mod */
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod3, 0, 9, 2)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod5, 0, 6, 3)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod6, 0, 3, 3)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod7, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod9, 1, 24, 4)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod10, 1, 20, 4)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod11, 1, 16, 4)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod12, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod13, 1, 8, 4)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod14, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_head_hash_mod_mod15, 1, 0, 4)
+
+/* ds_service_queue_hash_key */
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_dest_id0, 0, 16, 10)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_dest_id1, 1, 16, 10)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_dest_id2, 2, 16, 10)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_dest_id3, 3, 16, 10)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_service_id0, 0, 0, 16)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_service_id1, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_service_id2, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_service_queue_hash_key_service_id3, 3, 0, 16)
+
+/* ds_service_queue */
+DRV_FIELD_ACCESSOR(ds_service_queue_service_queue_base_offset, 0, 0, 12)
+
+/* q_mgrq_hash_cam_hash_ctl */
+DRV_FIELD_ACCESSOR(q_mgrq_hash_cam_hash_ctl_service_que_base_offset, 0, 0, 12)
+
+/* dsq_mgrq_link_list */
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_list_next_ptr, 0, 0, 15)
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_list_pkt_length, 0, 16, 14)
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_list_rep_count, 1, 0, 12)
+
+/* dsq_mgrq_link_state */
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_state_head_ptr, 0, 0, 15)
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_state_pkt_length, 0, 16, 14)
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_state_queue_empty, 0, 30, 1)
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_state_rep_count, 1, 16, 12)
+DRV_FIELD_ACCESSOR(dsq_mgrq_link_state_tail_ptr, 1, 0, 15)
+
+/* ds_queue_shape */
+DRV_FIELD_ACCESSOR(ds_queue_shape_commit_token, 0, 0, 24)
+DRV_FIELD_ACCESSOR(ds_queue_shape_peak_token, 1, 0, 24)
+
+/* ds_queue_drr_deficit */
+DRV_FIELD_ACCESSOR(ds_queue_drr_deficit_deficit, 0, 0, 27)
+
+/* ds_in_profile_next_queue_ptr */
+DRV_FIELD_ACCESSOR(ds_in_profile_next_queue_ptr_in_prof_next_grp_id, 0, 16, 9)
+DRV_FIELD_ACCESSOR(ds_in_profile_next_queue_ptr_in_prof_next_que_ptr, 0, 0, 11)
+DRV_FIELD_ACCESSOR(ds_in_profile_next_queue_ptr_in_prof_next_que_shp_en, 0, 31, 1)
+
+/* ds_out_profile_next_queue_ptr */
+DRV_FIELD_ACCESSOR(ds_out_profile_next_queue_ptr_out_prof_next_grp_id, 0, 16, 9)
+DRV_FIELD_ACCESSOR(ds_out_profile_next_queue_ptr_out_prof_next_que_ptr, 0, 0, 11)
+DRV_FIELD_ACCESSOR(ds_out_profile_next_queue_ptr_out_prof_next_que_shp_en, 0, 31, 1)
+
+/* ds_queue_drr_weight */
+DRV_FIELD_ACCESSOR(ds_queue_drr_weight_weight, 0, 0, 24)
+
+/* ds_queue_map */
+DRV_FIELD_ACCESSOR(ds_queue_map_channel_id, 0, 16, 8)
+DRV_FIELD_ACCESSOR(ds_queue_map_grp_id, 0, 0, 9)
+DRV_FIELD_ACCESSOR(ds_queue_map_priority_id, 0, 24, 2)
+DRV_FIELD_ACCESSOR(ds_queue_map_que_shp_en, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ds_queue_map_sgmac_id, 0, 12, 2)
+DRV_FIELD_ACCESSOR(ds_queue_map_sgmac_valid, 0, 14, 1)
+
+/* ds_channel_link_state */
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_grp_id0, 0, 16, 9)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_grp_id1, 0, 0, 9)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_head_que0, 1, 16, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_head_que1, 2, 16, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_que_shp_en0, 3, 0, 1)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_que_shp_en1, 3, 4, 1)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_sub_ch_state1, 3, 8, 1)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_tail_que0, 1, 0, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_in_prof_tail_que1, 2, 0, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_grp_id0, 4, 16, 9)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_grp_id1, 4, 0, 9)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_head_que0, 5, 16, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_head_que1, 6, 16, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_que_shp_en0, 7, 0, 1)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_que_shp_en1, 7, 4, 1)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_sub_ch_state1, 7, 8, 1)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_tail_que0, 5, 0, 11)
+DRV_FIELD_ACCESSOR(ds_channel_link_state_out_prof_tail_que1, 6, 0, 11)
+
+/* ds_queue_state */
+DRV_FIELD_ACCESSOR(ds_queue_state_que_in_in_prof_list, 0, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_state_que_in_out_prof_list, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_queue_state_que_not_empty, 0, 16, 16)
+
+/* ds_queue_shape_state */
+DRV_FIELD_ACCESSOR(ds_queue_shape_state_que_shp_ok, 0, 0, 32)
+
+/* ds_group_shape_profile_id */
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_id_grp_shp_prof_id0, 0, 24, 8)
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_id_grp_shp_prof_id1, 0, 16, 8)
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_id_grp_shp_prof_id2, 0, 8, 8)
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_id_grp_shp_prof_id3, 0, 0, 8)
+
+/* ds_group_shape_state */
+DRV_FIELD_ACCESSOR(ds_group_shape_state_grp_shp_ok0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_group_shape_state_grp_shp_ok1, 0, 4, 1)
+DRV_FIELD_ACCESSOR(ds_group_shape_state_grp_shp_ok2, 0, 8, 1)
+DRV_FIELD_ACCESSOR(ds_group_shape_state_grp_shp_ok3, 0, 12, 1)
+
+/* ds_group_shape_profile */
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_grp_token_rate, 0, 0, 22)
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_grp_token_thrd, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_group_shape_profile_grp_token_thrd_shift, 1, 8, 4)
+
+/* ds_group_context */
+DRV_FIELD_ACCESSOR(ds_group_context_priority, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_group_context_valid, 0, 4, 1)
+
+/* ds_queue_shape_profile_id */
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_id_que_shp_prof_id0, 0, 24, 8)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_id_que_shp_prof_id1, 0, 16, 8)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_id_que_shp_prof_id2, 0, 8, 8)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_id_que_shp_prof_id3, 0, 0, 8)
+
+/* ds_queue_shape_profile */
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_que_commit_token_rate, 0, 0, 22)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_que_commit_token_thrd, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_que_commit_token_thrd_shift, 1, 8, 4)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_que_peak_token_rate, 2, 0, 22)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_que_peak_token_thrd, 3, 0, 8)
+DRV_FIELD_ACCESSOR(ds_queue_shape_profile_que_peak_token_thrd_shift, 3, 8, 4)
+
+/* ds_group_shape */
+DRV_FIELD_ACCESSOR(ds_group_shape_grp_token, 0, 0, 24)
+
+/* ds_group_cache */
+DRV_FIELD_ACCESSOR(ds_group_cache_cir0, 0, 20, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_cir1, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_cir2, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_cir3, 3, 20, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_pri_id0, 0, 16, 2)
+DRV_FIELD_ACCESSOR(ds_group_cache_pri_id1, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_group_cache_pri_id2, 2, 16, 2)
+DRV_FIELD_ACCESSOR(ds_group_cache_pri_id3, 3, 16, 2)
+DRV_FIELD_ACCESSOR(ds_group_cache_que_id0, 0, 0, 11)
+DRV_FIELD_ACCESSOR(ds_group_cache_que_id1, 1, 0, 11)
+DRV_FIELD_ACCESSOR(ds_group_cache_que_id2, 2, 0, 11)
+DRV_FIELD_ACCESSOR(ds_group_cache_que_id3, 3, 0, 11)
+DRV_FIELD_ACCESSOR(ds_group_cache_valid0, 0, 24, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_valid1, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_valid2, 2, 24, 1)
+DRV_FIELD_ACCESSOR(ds_group_cache_valid3, 3, 24, 1)
+
+/* ds_channel_credit */
+DRV_FIELD_ACCESSOR(ds_channel_credit_ch_credit, 0, 0, 10)
+
+/* ds_channel_shape_profile */
+DRV_FIELD_ACCESSOR(ds_channel_shape_profile_shape_en, 1, 16, 1)
+DRV_FIELD_ACCESSOR(ds_channel_shape_profile_token_rate, 0, 0, 22)
+DRV_FIELD_ACCESSOR(ds_channel_shape_profile_token_thrd, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_channel_shape_profile_token_thrd_shift, 1, 8, 4)
+
+/* ds_channel_shape */
+DRV_FIELD_ACCESSOR(ds_channel_shape_token, 0, 0, 24)
+
+/* ds_ch_credit */
+DRV_FIELD_ACCESSOR(ds_ch_credit_ch_credit, 0, 0, 10)
+
+/* ds_fabric_wrr_weight_cfg */
+DRV_FIELD_ACCESSOR(ds_fabric_wrr_weight_cfg_wt_cfg, 0, 0, 8)
+
+/* ds_fabric_wrr_weight */
+DRV_FIELD_ACCESSOR(ds_fabric_wrr_weight_wt, 0, 0, 8)
+
+/* ds_network_wrr_weight_cfg */
+DRV_FIELD_ACCESSOR(ds_network_wrr_weight_cfg_wt_cfg, 0, 0, 8)
+
+/* q_mgr_network_out_profile_wrr_weight_cfg */
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_cfg_pri0_wt_cfg, 0, 24, 8)
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_cfg_pri1_wt_cfg, 0, 16, 8)
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_cfg_pri2_wt_cfg, 0, 8, 8)
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_cfg_pri3_wt_cfg, 0, 0, 8)
+
+/* q_mgr_network_out_profile_wrr_weight */
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_pri0_wt, 0, 24, 8)
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_pri1_wt, 0, 16, 8)
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_pri2_wt, 0, 8, 8)
+DRV_FIELD_ACCESSOR(q_mgr_network_out_profile_wrr_weight_pri3_wt, 0, 0, 8)
+
+/* q_mgr_fabric_out_profile_wrr_weight_cfg */
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_cfg_pri0_wt_cfg, 0, 24, 8)
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_cfg_pri1_wt_cfg, 0, 16, 8)
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_cfg_pri2_wt_cfg, 0, 8, 8)
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_cfg_pri3_wt_cfg, 0, 0, 8)
+
+/* q_mgr_fabric_out_profile_wrr_weight */
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_pri0_wt, 0, 24, 8)
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_pri1_wt, 0, 16, 8)
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_pri2_wt, 0, 8, 8)
+DRV_FIELD_ACCESSOR(q_mgr_fabric_out_profile_wrr_weight_pri3_wt, 0, 0, 8)
+
+/* ds_network_wrr_weight */
+DRV_FIELD_ACCESSOR(ds_network_wrr_weight_wt, 0, 0, 8)
+
+/* ds_queue_entry */
+DRV_FIELD_ACCESSOR(ds_queue_entry_buffer_count, 3, 24, 6)
+DRV_FIELD_ACCESSOR(ds_queue_entry_dest_map, 7, 0, 22)
+DRV_FIELD_ACCESSOR(ds_queue_entry_dest_select, 5, 28, 1)
+DRV_FIELD_ACCESSOR(ds_queue_entry_ecc_bit3_to0, 2, 0, 4)
+DRV_FIELD_ACCESSOR(ds_queue_entry_ecc_bit7_to4, 0, 0, 4)
+DRV_FIELD_ACCESSOR(ds_queue_entry_header_version, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_queue_entry_head_buffer_ptr, 1, 16, 15)
+DRV_FIELD_ACCESSOR(ds_queue_entry_head_ptr_bank_offset, 3, 14, 2)
+DRV_FIELD_ACCESSOR(ds_queue_entry_length_adjust_type, 5, 30, 1)
+DRV_FIELD_ACCESSOR(ds_queue_entry_mcast_rcd, 5, 29, 1)
+DRV_FIELD_ACCESSOR(ds_queue_entry_next_hop_ext, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_queue_entry_packet_length, 3, 0, 14)
+DRV_FIELD_ACCESSOR(ds_queue_entry_parity, 4, 0, 2)
+DRV_FIELD_ACCESSOR(ds_queue_entry_pt_enable, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_queue_entry_rcd, 7, 24, 8)
+DRV_FIELD_ACCESSOR(ds_queue_entry_replication_ctl, 5, 0, 20)
+DRV_FIELD_ACCESSOR(ds_queue_entry_resource_group_id, 3, 16, 8)
+
+/* quadmacapp0_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp0_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp0_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp0_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp0_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp10_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp10_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp10_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp10_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp10_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp11_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp11_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp11_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp11_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp11_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp1_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp1_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp1_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp1_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp1_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp2_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp2_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp2_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp2_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp2_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp3_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp3_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp3_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp3_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp3_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp4_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp4_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp4_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp4_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp4_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp5_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp5_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp5_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp5_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp5_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp6_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp6_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp6_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp6_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp6_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp7_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp7_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp7_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp7_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp7_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp8_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp8_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp8_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp8_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp8_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* quadmacapp9_stats_ram */
+DRV_FIELD_ACCESSOR(quadmacapp9_stats_ram_byte_cnt_data_hi, 2, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp9_stats_ram_byte_cnt_data_lo, 3, 0, 32)
+DRV_FIELD_ACCESSOR(quadmacapp9_stats_ram_frame_cnt_data_hi, 0, 0, 4)
+DRV_FIELD_ACCESSOR(quadmacapp9_stats_ram_frame_cnt_data_lo, 1, 0, 32)
+
+/* sgmac0_sgmac_stats_ram */
+DRV_FIELD_ACCESSOR(sgmac0_sgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac0_sgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(sgmac0_sgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac0_sgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* sgmac1_sgmac_stats_ram */
+DRV_FIELD_ACCESSOR(sgmac1_sgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac1_sgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(sgmac1_sgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac1_sgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* sgmac2_sgmac_stats_ram */
+DRV_FIELD_ACCESSOR(sgmac2_sgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac2_sgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(sgmac2_sgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac2_sgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* sgmac3_sgmac_stats_ram */
+DRV_FIELD_ACCESSOR(sgmac3_sgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac3_sgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(sgmac3_sgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(sgmac3_sgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* shared_ds_vlan_mem */
+DRV_FIELD_ACCESSOR(shared_ds_vlan_mem_data0, 0, 0, 4)
+DRV_FIELD_ACCESSOR(shared_ds_vlan_mem_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(shared_ds_vlan_mem_data2, 2, 0, 4)
+DRV_FIELD_ACCESSOR(shared_ds_vlan_mem_data3, 3, 0, 32)
+
+/* ds_link_aggreagation_group */
+DRV_FIELD_ACCESSOR(ds_link_aggreagation_group_link_aggregate_group_en, 0, 7, 1)
+DRV_FIELD_ACCESSOR(ds_link_aggreagation_group_link_aggregate_group_id, 0, 0, 7)
+
+/* stp_state_ram */
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state1, 0, 2, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state2, 0, 4, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state3, 0, 6, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state4, 0, 8, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state5, 0, 10, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state6, 0, 12, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state7, 0, 14, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state8, 0, 16, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state9, 0, 18, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state10, 0, 20, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state11, 0, 22, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state12, 0, 24, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state13, 0, 26, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state14, 0, 28, 2)
+DRV_FIELD_ACCESSOR(stp_state_ram_stp_state15, 0, 30, 2)
+
+/* tb_info_int_mem */
+DRV_FIELD_ACCESSOR(tb_info_int_mem_data0, 0, 0, 4)
+DRV_FIELD_ACCESSOR(tb_info_int_mem_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(tb_info_int_mem_data2, 2, 0, 4)
+DRV_FIELD_ACCESSOR(tb_info_int_mem_data3, 3, 0, 32)
+
+/* tb_info_hash_mem */
+DRV_FIELD_ACCESSOR(tb_info_hash_mem_data0, 0, 0, 4)
+DRV_FIELD_ACCESSOR(tb_info_hash_mem_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(tb_info_hash_mem_data2, 2, 0, 4)
+DRV_FIELD_ACCESSOR(tb_info_hash_mem_data3, 3, 0, 32)
+
+/* tb_info_ext_mem */
+DRV_FIELD_ACCESSOR(tb_info_ext_mem_data0, 0, 0, 4)
+DRV_FIELD_ACCESSOR(tb_info_ext_mem_data1, 1, 0, 32)
+DRV_FIELD_ACCESSOR(tb_info_ext_mem_data2, 2, 0, 4)
+DRV_FIELD_ACCESSOR(tb_info_ext_mem_data3, 3, 0, 32)
+
+/* ram_bist_tb_info_ext_ddr */
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_access_load, 0, 28, 1)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_access_read, 0, 29, 1)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_access_valid, 0, 30, 1)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_address, 0, 8, 20)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_data31_to0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_data35_to32, 2, 0, 4)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_data67_to36, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ram_bist_tb_info_ext_ddr_ram_data71_to68, 0, 0, 4)
+
+/* tcam_ctl_ext_bist_request_mem */
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key31_to0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key63_to32, 6, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key79_to64, 5, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key111_to80, 3, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key143_to112, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key159_to144, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key_cmd, 0, 0, 8)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key_inst, 0, 10, 3)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key_size, 0, 8, 2)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_key_valid, 0, 31, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_link_training_cmd, 4, 0, 13)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_request_mem_link_training_valid, 4, 31, 1)
+
+/* tcam_ctl_ext_bist_result_mem */
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_result_mem_index0, 0, 0, 20)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_result_mem_index0_compare_en, 0, 20, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_result_mem_index1, 1, 0, 20)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_result_mem_index1_compare_en, 1, 20, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_result_mem_index_valid, 0, 24, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_ext_bist_result_mem_result_compare_valid, 0, 31, 1)
+
+/* tcam_ctl_int_cpu_request_mem */
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key31_to0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key63_to32, 6, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key79_to64, 5, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key111_to80, 3, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key143_to112, 2, 0, 32)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key159_to144, 1, 0, 16)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key_cmd, 0, 0, 8)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key_size, 0, 8, 2)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_request_mem_key_valid, 0, 31, 1)
+
+/* tcam_ctl_int_cpu_result_mem */
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_result_mem_index_acl, 0, 0, 20)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_result_mem_index_acl_comp_en, 0, 20, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_result_mem_index_qos, 1, 0, 20)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_result_mem_index_qos_comp_en, 1, 20, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_result_mem_index_valid, 0, 24, 1)
+DRV_FIELD_ACCESSOR(tcam_ctl_int_cpu_result_mem_result_compare_valid, 0, 31, 1)
+
+/* xgmac0_xgmac_stats_ram */
+DRV_FIELD_ACCESSOR(xgmac0_xgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac0_xgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(xgmac0_xgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac0_xgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* xgmac1_xgmac_stats_ram */
+DRV_FIELD_ACCESSOR(xgmac1_xgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac1_xgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(xgmac1_xgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac1_xgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* xgmac2_xgmac_stats_ram */
+DRV_FIELD_ACCESSOR(xgmac2_xgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac2_xgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(xgmac2_xgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac2_xgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* xgmac3_xgmac_stats_ram */
+DRV_FIELD_ACCESSOR(xgmac3_xgmac_stats_ram_byte_cnt_data_high, 2, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac3_xgmac_stats_ram_byte_cnt_data_low, 3, 0, 32)
+DRV_FIELD_ACCESSOR(xgmac3_xgmac_stats_ram_frame_cnt_data_high, 0, 0, 8)
+DRV_FIELD_ACCESSOR(xgmac3_xgmac_stats_ram_frame_cnt_data_low, 1, 0, 32)
+
+/* ds_mac_acl */
+DRV_FIELD_ACCESSOR(ds_mac_acl_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_mac_acl_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_mac_acl_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mac_acl_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_mac_acl_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_mac_acl_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mac_acl_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_mac_acl_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mac_acl_stats_ptr, 3, 16, 16)
+
+/* ds_ipv4_acl */
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_acl_stats_ptr, 3, 16, 16)
+
+/* ds_mpls_acl */
+DRV_FIELD_ACCESSOR(ds_mpls_acl_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_acl_stats_ptr, 3, 16, 16)
+
+/* ds_ipv6_acl */
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_acl_stats_ptr, 3, 16, 16)
+
+/* ds_mac_qos */
+DRV_FIELD_ACCESSOR(ds_mac_qos_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_mac_qos_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_mac_qos_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mac_qos_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_mac_qos_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_mac_qos_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mac_qos_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_mac_qos_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mac_qos_stats_ptr, 3, 16, 16)
+
+/* ds_ipv4_qos */
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_qos_stats_ptr, 3, 16, 16)
+
+/* ds_mpls_qos */
+DRV_FIELD_ACCESSOR(ds_mpls_qos_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_qos_stats_ptr, 3, 16, 16)
+
+/* ds_ipv6_qos */
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_acl_log_id, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_color, 1, 8, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_deny_bridge, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_deny_learning, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_deny_replace_cos, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_deny_replace_dscp, 1, 3, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_deny_route, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_discard_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_flow_policer_ptr, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_fwd_ptr, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_priority, 1, 10, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_priority_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_qos_policy, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_random_log_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_random_threshold_shift, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_stats_mode, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_qos_stats_ptr, 3, 16, 16)
+
+/* ds_ipv4_ucast_da */
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_bidi_pim_group, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_bidi_pim_group_valid, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_deny_pbr, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_equal_cost_path_num2, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_equal_cost_path_num, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_excep_sub_index, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_exp3_ctl_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_icmp_check_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_ip_da_exception_en, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_isatap_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_l3_if_type, 3, 22, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_mcast_rpf_fail_cpu_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_payload_select, 3, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_priority_path_en, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_ttl_check_en, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_tunnel_gre_options, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_tunnel_packet_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_tunnel_payload_offset, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_tunnel_payload_offset_type, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_vpls_en, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_da_vrf_id, 1, 0, 15)
+
+/* ds_ipv4_mcast_da */
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_bidi_pim_group, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_bidi_pim_group_valid, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_deny_pbr, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_equal_cost_path_num2, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_equal_cost_path_num, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_excep_sub_index, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_exp3_ctl_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_icmp_check_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_ip_da_exception_en, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_isatap_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_l3_if_type, 3, 22, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_mcast_rpf_fail_cpu_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_payload_select, 3, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_priority_path_en, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_ttl_check_en, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_tunnel_gre_options, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_tunnel_packet_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_tunnel_payload_offset, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_tunnel_payload_offset_type, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_vpls_en, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_da_vrf_id, 1, 0, 15)
+
+/* ds_ipv6_ucast_da */
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_bidi_pim_group, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_bidi_pim_group_valid, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_deny_pbr, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_equal_cost_path_num2, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_equal_cost_path_num, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_excep_sub_index, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_exp3_ctl_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_icmp_check_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_ip_da_exception_en, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_isatap_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_l3_if_type, 3, 22, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_mcast_rpf_fail_cpu_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_payload_select, 3, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_priority_path_en, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_ttl_check_en, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_tunnel_gre_options, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_tunnel_packet_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_tunnel_payload_offset, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_tunnel_payload_offset_type, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_vpls_en, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_da_vrf_id, 1, 0, 15)
+
+/* ds_ipv6_mcast_da */
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_bidi_pim_group, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_bidi_pim_group_valid, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_deny_pbr, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_equal_cost_path_num2, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_equal_cost_path_num, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_excep_sub_index, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_exp3_ctl_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_icmp_check_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_ip_da_exception_en, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_isatap_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_l3_if_type, 3, 22, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_mcast_rpf_fail_cpu_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_payload_select, 3, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_priority_path_en, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_ttl_check_en, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_tunnel_gre_options, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_tunnel_packet_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_tunnel_payload_offset, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_tunnel_payload_offset_type, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_vpls_en, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_da_vrf_id, 1, 0, 15)
+
+/* ds_ipv4_ucast_pbr_dual_da */
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_bidi_pim_group, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_bidi_pim_group_valid, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_deny_pbr, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_equal_cost_path_num2, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_equal_cost_path_num, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_excep_sub_index, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_exp3_ctl_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_icmp_check_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_ip_da_exception_en, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_isatap_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_l3_if_type, 3, 22, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_mcast_rpf_fail_cpu_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_payload_select, 3, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_priority_path_en, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_ttl_check_en, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_tunnel_gre_options, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_tunnel_packet_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_tunnel_payload_offset, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_tunnel_payload_offset_type, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_vpls_en, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_pbr_dual_da_vrf_id, 1, 0, 15)
+
+/* ds_ipv6_ucast_pbr_dual_da */
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_bidi_pim_group, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_bidi_pim_group_valid, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_deny_pbr, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_equal_cost_path_num2, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_equal_cost_path_num, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_excep_sub_index, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_exp3_ctl_en, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_icmp_check_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_ip_da_exception_en, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_isatap_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_l3_if_type, 3, 22, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_mcast_rpf_fail_cpu_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_payload_select, 3, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_priority_path_en, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_ttl_check_en, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_tunnel_gre_options, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_tunnel_packet_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_tunnel_payload_offset, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_tunnel_payload_offset_type, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_vpls_en, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_pbr_dual_da_vrf_id, 1, 0, 15)
+
+/* ds_ipv4_ucast_sa */
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id0, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id1, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id2, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id3, 1, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id_valid0, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id_valid1, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id_valid2, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_if_id_valid3, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_sa_ipsa_more_rpf_if, 2, 2, 1)
+
+/* ds_ipv6_ucast_sa */
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id0, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id1, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id2, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id3, 1, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id_valid0, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id_valid1, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id_valid2, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_if_id_valid3, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_sa_ipsa_more_rpf_if, 2, 2, 1)
+
+/* ds_ipv4_mcast_rpf */
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id0, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id1, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id2, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id3, 1, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id_valid0, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id_valid1, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id_valid2, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_if_id_valid3, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_rpf_ipsa_more_rpf_if, 2, 2, 1)
+
+/* ds_ipv6_mcast_rpf */
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_check_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id0, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id1, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id2, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id3, 1, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id_valid0, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id_valid1, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id_valid2, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_if_id_valid3, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_rpf_ipsa_more_rpf_if, 2, 2, 1)
+
+/* ds_ipv4_sa_nat */
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_force_ip_sa_fwd, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_ipv4_embed_mode, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_ip_sa, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_ip_sa_fwd_ptr_valid, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_ip_sa_mode, 1, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_ip_sa_prefix, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_ip_sa_prefix_len, 1, 16, 3)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_l4_source_port, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_replace_ip_sa, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_sa_nat_replace_l4_source_port, 0, 0, 1)
+
+/* ds_ipv6_sa_nat */
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_force_ip_sa_fwd, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_ipv4_embed_mode, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_ip_sa, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_ip_sa_fwd_ptr_valid, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_ip_sa_mode, 1, 20, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_ip_sa_prefix, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_ip_sa_prefix_len, 1, 16, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_l4_source_port, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_replace_ip_sa, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_sa_nat_replace_l4_source_port, 0, 0, 1)
+
+/* ds_user_id_vlan */
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_aps_select_valid, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_binding_datah, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_binding_datal, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_binding_datam, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_binding_en, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_binding_mac_sa, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_by_pass_all, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_ds_fwd_ptr_valid, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_exception_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_src_communicate_port, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_src_queue_select, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_user_vlan_ptr, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_vpls_port_type, 1, 30, 1)
+
+/* ds_user_id_mac */
+DRV_FIELD_ACCESSOR(ds_user_id_mac_aps_select_valid, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_binding_datah, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_binding_datal, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_binding_datam, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_binding_en, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_binding_mac_sa, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_by_pass_all, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_ds_fwd_ptr_valid, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_exception_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_src_communicate_port, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_src_queue_select, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_user_vlan_ptr, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_vpls_port_type, 1, 30, 1)
+
+/* ds_user_id_ipv4 */
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_aps_select_valid, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_binding_datah, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_binding_datal, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_binding_datam, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_binding_en, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_binding_mac_sa, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_by_pass_all, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_ds_fwd_ptr_valid, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_exception_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_src_communicate_port, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_src_queue_select, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_user_vlan_ptr, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_vpls_port_type, 1, 30, 1)
+
+/* ds_user_id_ipv6 */
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_aps_select_valid, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_binding_datah, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_binding_datal, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_binding_datam, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_binding_en, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_binding_mac_sa, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_by_pass_all, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_ds_fwd_ptr_valid, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_exception_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_src_communicate_port, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_src_queue_select, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_user_vlan_ptr, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_vpls_port_type, 1, 30, 1)
+
+/* ds_l2_edit_eth4w */
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_derive_mcast_mac, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_mac_dah, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_mac_dal, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_mac_sa_valid, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_output_cvlanid_valid, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_output_vlanid_is_svlan, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_output_vlan_id, 1, 16, 12)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_output_vlan_id_valid, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_overwrite_ether_type, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_packet_type, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth4w_type, 0, 0, 1)
+
+/* ds_l2_edit_eth8w */
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_derive_mcast_mac, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_mac_dah, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_mac_dal, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_mac_sah, 5, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_mac_sal, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_mac_sa_valid, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_cvlan_idh, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_cvlan_idl, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_cvlan_idm, 5, 26, 6)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_cvlan_id_valid, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_vlanid_is_svlan, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_vlan_id, 1, 16, 12)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_output_vlan_id_valid, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_overwrite_ether_type, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_packet_type, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_eth8w_type, 0, 0, 1)
+
+/* ds_l2_edit_flex4w */
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex4w_packet_type, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex4w_rewrite_byte_num, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex4w_rewrite_stringh, 1, 0, 24)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex4w_rewrite_stringl, 3, 0, 32)
+
+/* ds_l2_edit_flex8w */
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex8w_packet_type, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex8w_rewrite_byte_num, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex8w_rewrite_string0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex8w_rewrite_string1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex8w_rewrite_string2, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_flex8w_rewrite_string3, 1, 0, 24)
+
+/* ds_l2_edit_loopback */
+DRV_FIELD_ACCESSOR(ds_l2_edit_loopback_lb_dest_map, 1, 0, 22)
+DRV_FIELD_ACCESSOR(ds_l2_edit_loopback_lb_length_adjust_type, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_loopback_lb_next_hop_ext, 3, 20, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_loopback_lb_next_hop_ptr, 3, 0, 20)
+
+/* ds_l2_edit_pbb8w */
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_btag_cfi, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_btag_cos, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_bvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_bvlan_tagged, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_bvlan_tag_disable, 1, 12, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_bvlan_valid, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_copy_nca_res, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_derive_btag_cos, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_derive_itag_cos, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_derive_mac_da, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_isid_valid, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_itag_cfi, 1, 14, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_itag_cos, 1, 16, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_i_sid, 3, 0, 24)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_mac_da310, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_mac_da4732, 5, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_mac_da_valid, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_mac_sa_valid, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_nca, 3, 27, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_pbb_header_op_type, 1, 13, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_res1, 3, 26, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb8w_res2, 3, 24, 2)
+
+/* ds_l2_edit_pbb4w */
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_btag_cfi, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_btag_cos, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_bvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_bvlan_tagged, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_bvlan_tag_disable, 1, 12, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_bvlan_valid, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_copy_nca_res, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_derive_itag_cos, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_derive_mac_da, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_isid_valid, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_itag_cfi, 1, 14, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_itag_cos, 1, 16, 3)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_i_sid, 3, 0, 24)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_macda_valid, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_mac_sa_valid, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_map_btag_cos, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_nca, 3, 27, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_pbb_header_op_type, 1, 13, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_res1, 3, 26, 1)
+DRV_FIELD_ACCESSOR(ds_l2_edit_pbb4w_res2, 3, 24, 2)
+
+/* ds_l3edit_mpls4w */
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_derive_exp0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_derive_exp1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_exp0, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_exp1, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_label0, 1, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_label1, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_label_valid1, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_map_ttl0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_map_ttl1, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_martini_encap_valid, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_mcast_label0, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_mcast_label1, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_ttl0, 1, 20, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls4w_ttl1, 3, 20, 8)
+
+/* ds_l3edit_mpls8w */
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_derive_exp0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_derive_exp1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_derive_exp2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_derive_exp3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_exp0, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_exp1, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_exp2, 5, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_exp3, 7, 28, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label0, 1, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label1, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label2, 5, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label3, 7, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label_valid1, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label_valid2, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_label_valid3, 6, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_map_ttl0, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_map_ttl1, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_map_ttl2, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_map_ttl3, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_martini_encap_valid, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_mcast_label0, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_mcast_label1, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_mcast_label2, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_mcast_label3, 6, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_ttl0, 1, 20, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_ttl1, 3, 20, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_ttl2, 5, 20, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_mpls8w_ttl3, 7, 20, 8)
+
+/* ds_l3edit_nat4w */
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_ipda104, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_ipda105, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_ipda3932, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_ipda, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_ipda_prefix_len, 1, 16, 7)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_ipv4_embed_mode, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_l4_dest_port, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_nat_mode, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_replace_ipda, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_replace_l4_dest_port, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat4w_use_port, 1, 23, 1)
+
+/* ds_l3edit_nat8w */
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda104, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda105, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda3932, 1, 24, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda7140, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda10372, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda108106, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda111109, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda_prefix_len, 1, 16, 7)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipda_use_port, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_ipv4_embed_mode, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_l4_dest_port, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_nat_mode, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_replace_ipda, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_nat8w_replace_l4_dest_port, 0, 0, 1)
+
+/* ds_l3edit_tunnel_v4 */
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_copy_dont_frag, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_derive_dscp, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_dont_frag, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_dscp, 1, 16, 6)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_gre_flags, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_gre_key_udp_dest_port, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_gre_protocol_udp_src_port, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_gre_sequence_id108, 1, 25, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_gre_version, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_inner_header_type, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_inner_header_valid, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_ip_da, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_ip_identific_type, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_ip_protocol_type, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_ip_sa, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_is_atp_tunnel, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_map_ttl, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_mtu_check_en, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_t6to4_tunnel, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_t6to4_tunnel_sa, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_ttl, 1, 8, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v4_vpls_port_chk_en, 6, 2, 1)
+
+/* ds_l3edit_tunnel_v6 */
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_derive_dscp, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_flow_label, 5, 0, 20)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_gre_flags, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_gre_key150, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_gre_key3116, 7, 16, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_gre_protocol, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_gre_sequence_id108, 1, 25, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_gre_version, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_inner_header_type, 4, 0, 2)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_inner_header_valid, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_ipda_index, 7, 0, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_ipsa_index, 7, 8, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_ip_protocol_type, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_map_ttl, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_mtu_check_en, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_new_flow_label_valid, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_tos, 1, 16, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_ttl, 1, 8, 8)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_vpls_dest_port11to0, 5, 20, 12)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_vpls_dest_port12, 6, 2, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_tunnel_v6_vpls_port_chk_en, 0, 2, 1)
+
+/* ds_l3edit_flex */
+DRV_FIELD_ACCESSOR(ds_l3edit_flex_packet_type, 1, 24, 3)
+DRV_FIELD_ACCESSOR(ds_l3edit_flex_rewrite_byte_num, 1, 28, 4)
+DRV_FIELD_ACCESSOR(ds_l3edit_flex_rewrite_string0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_flex_rewrite_string1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_flex_rewrite_string2, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_l3edit_flex_rewrite_string3, 1, 0, 24)
+
+/* ds_l3edit_loop_back */
+DRV_FIELD_ACCESSOR(ds_l3edit_loop_back_dest_map, 1, 0, 22)
+DRV_FIELD_ACCESSOR(ds_l3edit_loop_back_length_adjust_type, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_loop_back_next_hop_ext, 3, 20, 1)
+DRV_FIELD_ACCESSOR(ds_l3edit_loop_back_next_hop_ptr, 3, 0, 20)
+
+/* ds_met_entry */
+DRV_FIELD_ACCESSOR(ds_met_entry_aps_brg_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_aps_brg_mismatch_discard, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_aps_brg_protect_path, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_end_local_rep, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_is_link_aggregation, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_length_adjust_type, 3, 27, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_nexthop_ext, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_next_met_entry_ptr, 1, 0, 18)
+DRV_FIELD_ACCESSOR(ds_met_entry_port_check_discard, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_remote_bay, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_met_entry_replication_ctl, 3, 0, 27)
+DRV_FIELD_ACCESSOR(ds_met_entry_ucast_id_lower, 1, 20, 12)
+DRV_FIELD_ACCESSOR(ds_met_entry_ucast_id_upper, 3, 28, 4)
+
+/* ds_mpls */
+DRV_FIELD_ACCESSOR(ds_mpls_aps_select_valid, 3, 23, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_ds_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_equal_cost_path_num2, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_equal_cost_path_num10, 1, 24, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_flow_policer_ptr7to0, 1, 8, 8)
+DRV_FIELD_ACCESSOR(ds_mpls_flow_policer_ptr10to8, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_flow_policer_ptr11, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_flow_policer_ptr15to12, 1, 0, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_is_vc_label, 3, 24, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_llsp_priority, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_llsp_valid, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_check, 3, 25, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_offset_bytes, 3, 20, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_over_write_priority, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_packet_type, 3, 28, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_priority_path_en, 1, 26, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_sbit, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_scontinue, 3, 26, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_stats_ptr_mode, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_s_bit_check_en, 3, 27, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_ttl_check_mode, 1, 6, 2)
+DRV_FIELD_ACCESSOR(ds_mpls_ttl_decrease_mode, 1, 5, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_ttl_threshhold, 1, 16, 7)
+DRV_FIELD_ACCESSOR(ds_mpls_use_label_exp, 1, 4, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_use_label_ttl, 1, 28, 1)
+
+/* ds_nexthop */
+DRV_FIELD_ACCESSOR(ds_nexthop_by_pass_all, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_copy_ctag_cos, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_cvlan_tagged, 1, 25, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_derive_stag_cos, 3, 15, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_dest_vlan_ptr, 3, 16, 14)
+DRV_FIELD_ACCESSOR(ds_nexthop_l2edit_ptr, 3, 0, 12)
+DRV_FIELD_ACCESSOR(ds_nexthop_l2_rewrite_type, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop_l3edit_ptr, 1, 0, 18)
+DRV_FIELD_ACCESSOR(ds_nexthop_l3_rewrite_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop_mtu_check_en, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_output_cvlan_id_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_output_svlan_id_valid, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_payload_operation, 1, 20, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop_replace_ctag_cos, 3, 30, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_replace_dscp, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_service_acl_qos_en, 3, 14, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_service_policer_vld, 3, 13, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_stag_cfi, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_stag_cos, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop_svlan_tagged, 1, 26, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop_tagged_mode, 3, 12, 1)
+
+/* ds_nexthop8w */
+DRV_FIELD_ACCESSOR(ds_nexthop8w_by_pass_all, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_community_port, 7, 30, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_copy_ctag_cos, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_cvlan_tagged, 1, 25, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_derive_stag_cos, 3, 15, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_dest_vlan_ptr, 3, 16, 14)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l2edit_ptr11to0, 3, 0, 12)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l2edit_ptr18to12, 5, 24, 7)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l2_rewrite_type, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l3edit_ptr18, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l3edit_ptr19, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l3edit_ptr170, 1, 0, 18)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_l3_rewrite_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_mtu_check_en, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_output_cvlan_id_ext, 5, 0, 12)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_output_cvlan_id_valid, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_output_cvlan_id_valid_ext, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_output_svlan_id_ext, 5, 12, 12)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_output_svlan_id_valid, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_output_svlan_id_valid_ext, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_payload_operation, 1, 20, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_replace_ctag_cos, 3, 30, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_replace_dscp, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_service_acl_qos_en, 3, 14, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_service_id, 7, 16, 14)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_service_id_en, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_service_policer_valid, 3, 13, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_stag_cfi, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_stag_cos, 1, 28, 3)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_svlan_tagged, 1, 26, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_svlan_tpid, 7, 14, 2)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_svlan_tpid_en, 7, 13, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_tagged_mode, 3, 12, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_tunnel_mtu_check, 6, 1, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_tunnel_update_disable, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_vpls_dest_port, 7, 0, 13)
+DRV_FIELD_ACCESSOR(ds_nexthop8w_vpls_port_check, 6, 2, 1)
+
+/* ds_policer */
+DRV_FIELD_ACCESSOR(ds_policer_color_blind_mode, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_policer_color_drop_code, 2, 0, 2)
+DRV_FIELD_ACCESSOR(ds_policer_commit_count_lower, 3, 20, 12)
+DRV_FIELD_ACCESSOR(ds_policer_commit_count_upper, 1, 0, 10)
+DRV_FIELD_ACCESSOR(ds_policer_old_ts, 3, 8, 12)
+DRV_FIELD_ACCESSOR(ds_policer_peak_count, 1, 10, 22)
+DRV_FIELD_ACCESSOR(ds_policer_profile, 3, 0, 8)
+DRV_FIELD_ACCESSOR(ds_policer_sr_tcm_mode, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_policer_stats_en, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_policer_use_layer3_length, 0, 2, 1)
+
+/* ds_forwarding_stats */
+DRV_FIELD_ACCESSOR(ds_forwarding_stats_byte_count_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_forwarding_stats_byte_count_upper0, 0, 0, 2)
+DRV_FIELD_ACCESSOR(ds_forwarding_stats_byte_count_upper, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_forwarding_stats_packet_count, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_forwarding_stats_use_layer3_length, 0, 2, 1)
+
+/* ds_vlan */
+DRV_FIELD_ACCESSOR(ds_vlan_arp_exception_type, 1, 0, 2)
+DRV_FIELD_ACCESSOR(ds_vlan_brg_dis, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_dhcp_exception_type, 1, 2, 2)
+DRV_FIELD_ACCESSOR(ds_vlan_ether_oamv, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_e_ether_oamv, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_e_md_level, 1, 21, 3)
+DRV_FIELD_ACCESSOR(ds_vlan_if_id, 3, 0, 10)
+DRV_FIELD_ACCESSOR(ds_vlan_igmp_snoop_en, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_learn_dis, 1, 14, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_mac_sec_vlan_dis, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_md_level, 1, 5, 3)
+DRV_FIELD_ACCESSOR(ds_vlan_pfm, 1, 30, 2)
+DRV_FIELD_ACCESSOR(ds_vlan_rec_en, 1, 19, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_replace_dscp, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_route_disable, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_src_que_select, 1, 4, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_stp_id6, 1, 18, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_stp_id, 1, 8, 6)
+DRV_FIELD_ACCESSOR(ds_vlan_trans_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_v4_mcast_en, 1, 27, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_v4_ucast_en, 1, 28, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_v4_ucast_sa_type, 1, 16, 2)
+DRV_FIELD_ACCESSOR(ds_vlan_v6_mcast_en, 1, 25, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_v6_ucast_en, 1, 26, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_v6_ucast_sa_type, 3, 14, 2)
+DRV_FIELD_ACCESSOR(ds_vlan_vlan_cross_connect, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_vlan_sec_exp_en, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_vlan_vrf_id, 3, 16, 16)
+
+/* ds_vlan_status */
+DRV_FIELD_ACCESSOR(ds_vlan_status_vlanid_validh, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_vlan_status_vlanid_validl, 3, 0, 32)
+
+/* ds_mac */
+DRV_FIELD_ACCESSOR(ds_mac_aps_select_protect_path, 1, 14, 1)
+DRV_FIELD_ACCESSOR(ds_mac_aps_select_valid, 1, 13, 1)
+DRV_FIELD_ACCESSOR(ds_mac_brg_aps_select_valid, 3, 26, 1)
+DRV_FIELD_ACCESSOR(ds_mac_equal_cost_path_num10, 2, 0, 2)
+DRV_FIELD_ACCESSOR(ds_mac_esp_key_or_oam, 1, 0, 13)
+DRV_FIELD_ACCESSOR(ds_mac_exception_sub_index, 3, 20, 4)
+DRV_FIELD_ACCESSOR(ds_mac_fwd_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mac_global_src_port, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_mac_learn_en, 3, 28, 1)
+DRV_FIELD_ACCESSOR(ds_mac_learn_source0, 3, 27, 1)
+DRV_FIELD_ACCESSOR(ds_mac_learn_source1, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mac_mac_da_exception_en, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mac_mac_known, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_mac_mac_sa_exception_en, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mac_mcast_discard, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mac_priority_path_en, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mac_proto_exception_en, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_mac_source_port_check_en, 3, 25, 1)
+DRV_FIELD_ACCESSOR(ds_mac_src_discard, 3, 29, 1)
+DRV_FIELD_ACCESSOR(ds_mac_src_mismatch_discard, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mac_src_mismatch_learn_en, 3, 30, 1)
+DRV_FIELD_ACCESSOR(ds_mac_storm_ctl_en, 3, 24, 1)
+DRV_FIELD_ACCESSOR(ds_mac_ucast_discard, 1, 15, 1)
+
+/* ds_fwd */
+DRV_FIELD_ACCESSOR(ds_fwd_aps_select_group_valid, 0, 2, 1)
+DRV_FIELD_ACCESSOR(ds_fwd_aps_type, 1, 28, 2)
+DRV_FIELD_ACCESSOR(ds_fwd_critical_packet, 0, 0, 1)
+DRV_FIELD_ACCESSOR(ds_fwd_dest_map, 1, 0, 22)
+DRV_FIELD_ACCESSOR(ds_fwd_length_adjust_type, 0, 1, 1)
+DRV_FIELD_ACCESSOR(ds_fwd_next_hop_ext, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_fwd_next_hop_ptr, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_fwd_send_local_phy_port, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_fwd_sequence_number_chk_en, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_fwd_stats_ptr_lower, 3, 20, 12)
+DRV_FIELD_ACCESSOR(ds_fwd_stats_ptr_upper, 1, 24, 4)
+DRV_FIELD_ACCESSOR(ds_fwd_stats_valid, 1, 31, 1)
+
+/* ds_eth_oam_chan */
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_active_max_mdlvl, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mem_index0, 1, 16, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mem_index1, 1, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mem_on_remote_chip, 1, 15, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mep_index2, 3, 16, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mep_index3, 3, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mep_index4, 5, 16, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mep_index5, 5, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mep_index6, 7, 16, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_mep_index7, 7, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_oam_dest_chip_id1_to0, 6, 0, 2)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_oam_dest_chip_id4_to2, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_passive_max_md_lvl, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_chan_passive_valid, 1, 31, 1)
+
+/* ds_mpls_pbt_oam_chan */
+DRV_FIELD_ACCESSOR(ds_mpls_pbt_oam_chan_md_lvl, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_pbt_oam_chan_md_lvl_check_valid, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_pbt_oam_chan_mep_idex, 1, 0, 15)
+DRV_FIELD_ACCESSOR(ds_mpls_pbt_oam_chan_mep_on_remote_chip, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_pbt_oam_chan_rmep_id, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_mpls_pbt_oam_chan_rmep_id_check_valid, 1, 15, 1)
+
+/* ds_rmep_chan */
+DRV_FIELD_ACCESSOR(ds_rmep_chan_rmep_index0, 1, 0, 15)
+
+/* ds_eth_mep */
+DRV_FIELD_ACCESSOR(ds_eth_mep_active, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_cci_en, 5, 15, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_cci_while, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_mep_ccm_sep_num, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_eth_mep_dest_chip, 7, 26, 5)
+DRV_FIELD_ACCESSOR(ds_eth_mep_dest_id, 5, 16, 16)
+DRV_FIELD_ACCESSOR(ds_eth_mep_d_meg_lvl, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_d_meg_lvl_timer, 1, 0, 4)
+DRV_FIELD_ACCESSOR(ds_eth_mep_d_mismerge, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_d_mismerge_timer, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_eth_mep_d_unexp_mep, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_d_unexp_mep_timer, 1, 8, 4)
+DRV_FIELD_ACCESSOR(ds_eth_mep_enable_pm, 1, 29, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_is_mpls, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_is_remote, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_is_up, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_ma_id_check_disable, 7, 25, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_ma_index, 5, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_mep_mep_id, 7, 0, 13)
+DRV_FIELD_ACCESSOR(ds_eth_mep_mep_primary_vid, 7, 13, 12)
+DRV_FIELD_ACCESSOR(ds_eth_mep_mep_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_mep_port_id, 1, 12, 8)
+DRV_FIELD_ACCESSOR(ds_eth_mep_present_rdi, 1, 25, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_present_traffic, 6, 1, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_present_traffic_check_en, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_rmep_last_rdi, 1, 26, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_seq_num_en, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_share_mac_en, 6, 2, 1)
+DRV_FIELD_ACCESSOR(ds_eth_mep_tpid_type, 1, 23, 2)
+DRV_FIELD_ACCESSOR(ds_eth_mep_tx_with_send_id, 1, 30, 1)
+
+/* ds_eth_rmep */
+DRV_FIELD_ACCESSOR(ds_eth_rmep_active, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_ccm_sep_num, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_cnt_shift_while, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_d_loc, 1, 11, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_d_unexp_period, 1, 16, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_d_unexp_period_timer, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_exp_ccm_num, 1, 3, 8)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_first_pkt_rx, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_is_mpls, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_is_remote, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_mac_addr_update_disable, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_mep_index, 7, 16, 15)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_rmep_last_intf_status, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_rmep_last_port_status, 1, 29, 2)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_rmep_last_rdi, 1, 17, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_rmep_mac_sa31_to0, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_rmep_mac_sa47_to32, 7, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_rmep_while, 1, 18, 4)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_seq_num_en, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_eth_rmep_seq_num_fail_counter, 1, 23, 6)
+
+/* ds_mpls_mep */
+DRV_FIELD_ACCESSOR(ds_mpls_mep_active, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_cci_en, 5, 15, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_cci_while, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_dest_chip, 7, 26, 5)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_dest_id, 5, 16, 16)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_d_excess, 1, 22, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_d_locv, 1, 23, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_d_ttsi_mismatch, 1, 21, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_d_ttsi_mismerge, 1, 24, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_expectedcvh, 1, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_expected_cv, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_first_pkt_rx, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_is_available, 1, 20, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_is_mpls, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_is_remote, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_is_up, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_ma_index, 5, 0, 15)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_mep_type, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_near_end_fsm_up_disable, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_period, 7, 0, 8)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_recv_fdi, 1, 12, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_t1_valid, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_t1_while, 1, 26, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_t2_pending_valid, 1, 16, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_ten_cycle_expectedcv, 1, 1, 7)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_ten_unexpcv, 1, 8, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_mep_tri_cycle_unexpcv, 1, 13, 3)
+
+/* ds_mpls_rmep */
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_active, 4, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_bdi_tx, 2, 2, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_bdi_while, 1, 26, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_cci_while, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_defect_location, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_defect_type, 3, 16, 6)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_dest_chip, 7, 26, 5)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_dest_id, 5, 16, 16)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_far_end_fsm_up_disable, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_is_available, 1, 5, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_is_mpls, 4, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_is_remote, 4, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_ma_index, 5, 0, 15)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_period, 7, 0, 8)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_rmep_while, 3, 24, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_rx_bdi, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_t3_cycle, 1, 6, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_t3_valid, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_t3_while, 1, 10, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_t4_valid, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_ten_bdiloop, 2, 1, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_ten_bdi, 1, 0, 4)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_tri_bdi_loop, 1, 4, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_rmep_tri_cycle_bdi, 3, 22, 2)
+
+/* ds_mac_key */
+DRV_FIELD_ACCESSOR(ds_mac_key_cfi, 3, 20, 1)
+DRV_FIELD_ACCESSOR(ds_mac_key_cos, 3, 21, 3)
+DRV_FIELD_ACCESSOR(ds_mac_key_gbl_src_port, 2, 0, 13)
+DRV_FIELD_ACCESSOR(ds_mac_key_layer2_header_protocol, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mac_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_mac_key_layer3_type, 3, 16, 4)
+DRV_FIELD_ACCESSOR(ds_mac_key_mapped_mac_da_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mac_key_mapped_mac_da_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mac_key_mapped_vlan_id, 6, 16, 16)
+DRV_FIELD_ACCESSOR(ds_mac_key_table_id0, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_mac_key_table_id1, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_mac_key_vlan_id1, 5, 0, 12)
+DRV_FIELD_ACCESSOR(ds_mac_key_vlan_id2, 2, 20, 12)
+DRV_FIELD_ACCESSOR(ds_mac_key_vlan_ptrh, 1, 0, 10)
+DRV_FIELD_ACCESSOR(ds_mac_key_vlan_ptrl, 3, 24, 4)
+
+/* ds_mac_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_mac_hash_key0_mapped_mach, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mac_hash_key0_mapped_macl, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mac_hash_key0_mapped_vlanid, 1, 16, 16)
+
+/* ds_mac_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_mac_hash_key1_mapped_mach, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_mac_hash_key1_mapped_macl, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mac_hash_key1_mapped_vlanid, 1, 16, 16)
+
+/* ds_acl_mac_key */
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_acl_labelh, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_acl_labell, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_cos, 10, 20, 3)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_ctag_cfi, 7, 0, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_ctag_cos, 7, 1, 3)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_cvlan_id4to0, 10, 23, 5)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_cvlan_id11to5, 9, 5, 7)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_ether_type, 7, 16, 16)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_is_ip_key, 9, 4, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_is_label, 13, 11, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_layer2_type, 14, 28, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_layer3_type, 10, 16, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_mac_dah, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_mac_dal, 11, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_mac_sah, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_mac_sal, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_qos_label, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_stag_cfi, 7, 4, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_stag_cos, 7, 5, 3)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_svlan_id, 14, 16, 12)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_tableid0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_tableid1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_tableid2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_tableid3, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mac_key_vlan_ptr, 6, 0, 14)
+
+/* ds_qos_mac_key */
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_acl_labelh, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_acl_labell, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_cos, 10, 20, 3)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_ctag_cfi, 7, 0, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_ctag_cos, 7, 1, 3)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_cvlan_id4to0, 10, 23, 5)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_cvlan_id11to5, 9, 5, 7)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_ether_type, 7, 16, 16)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_is_ip_key, 9, 4, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_is_label, 13, 11, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_layer2_type, 14, 28, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_layer3_type, 10, 16, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_mac_dah, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_mac_dal, 11, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_mac_sah, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_mac_sal, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_qos_label, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_stag_cfi, 7, 4, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_stag_cos, 7, 5, 3)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_svlan_id, 14, 16, 12)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_tableid0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_tableid1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_tableid2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_tableid3, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mac_key_vlan_ptr, 6, 0, 14)
+
+/* ds_acl_ipv4_key */
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_acl_label_lower, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_acl_label_upper, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_cos, 13, 9, 3)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_dscp, 10, 16, 6)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_frag_info, 10, 22, 2)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_ip_da, 14, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_ip_header_error, 9, 7, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_ip_options, 10, 24, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_ip_sa, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_is_application, 10, 25, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_is_ip_key, 9, 4, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_is_label, 13, 8, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_is_mpls_key, 9, 6, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_is_tcp, 10, 27, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_is_udp, 10, 26, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_l4info_mapped, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_l4_dest_port, 11, 16, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_l4_source_port, 11, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_layer3_type, 9, 8, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_macda_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_macda_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_qos_label, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_routed_packet, 9, 5, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_svlan_id, 6, 16, 12)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_tableid0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_tableid1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_tableid2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv4_key_tableid3, 1, 12, 4)
+
+/* ds_qos_ipv4_key */
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_acl_label_lower, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_acl_label_upper, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_cos, 13, 9, 3)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_dscp, 10, 16, 6)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_frag_info, 10, 22, 2)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_ip_da, 14, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_ip_header_error, 9, 7, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_ip_options, 10, 24, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_ip_sa, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_is_application, 10, 25, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_is_ip_key, 9, 4, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_is_label, 13, 8, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_is_mpls_key, 9, 6, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_is_tcp, 10, 27, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_is_udp, 10, 26, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_l4info_mapped, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_l4_dest_port, 11, 16, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_l4_source_port, 11, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_layer3_type, 9, 8, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_macda_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_macda_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_qos_label, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_routed_packet, 9, 5, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_svlan_id, 6, 16, 12)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_tableid0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_tableid1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_tableid2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv4_key_tableid3, 1, 12, 4)
+
+/* ds_acl_mpls_key */
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_acl_label_lower, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_acl_label_upper, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_cos, 13, 9, 3)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_is_ip_key, 9, 4, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_is_label, 13, 8, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_is_mpls_key, 9, 6, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_macda_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_macda_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mpls_label0, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mpls_label1, 14, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mpls_label2, 11, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mpls_label327to0, 10, 0, 28)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_mpls_label331to28, 9, 8, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_qos_label, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_route_pkt, 9, 5, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_svlan_id, 6, 16, 12)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_tableid0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_tableid1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_tableid2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_mpls_key_tableid3, 1, 12, 4)
+
+/* ds_qos_mpls_key */
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_acl_label_lower, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_acl_label_upper, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_cos, 13, 9, 3)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_is_ip_key, 9, 4, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_is_label, 13, 8, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_is_mpls_key, 9, 6, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_macda_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_macda_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mpls_label0, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mpls_label1, 14, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mpls_label2, 11, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mpls_label327to0, 10, 0, 28)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_mpls_label331to28, 9, 8, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_qos_label, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_route_pkt, 9, 5, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_svlan_id, 6, 16, 12)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_tableid0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_tableid1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_tableid2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_mpls_key_tableid3, 1, 12, 4)
+
+/* ds_acl_ipv6_key */
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_aclqos_ipv6key_tableid7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_acl_label_lower, 18, 28, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_acl_label_middle, 17, 0, 2)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_acl_label_upper, 14, 26, 2)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_cos, 10, 28, 3)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_cvlan_id, 9, 0, 12)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_dscp, 11, 20, 6)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ether_type, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_frag_info, 14, 16, 2)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ipv6_extension_headers, 13, 4, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ipv6_flow_label, 11, 0, 20)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_da31to0, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_da63to32, 22, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_da71to64, 21, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_da103to72, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_da127to104, 18, 0, 24)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_head_error, 14, 19, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_options, 14, 18, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_sa31to0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_sa63to32, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_sa71to64, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_sa103to72, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_ip_sa127to104, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_is_application, 14, 20, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_is_label, 18, 24, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_is_tcp, 18, 26, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_is_udp, 18, 25, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4destport_or_l4info5to0, 25, 6, 6)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4destport_or_l4info15to6, 17, 2, 10)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4_destport, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4_source_port3to0, 29, 8, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4_source_port11to4, 26, 24, 8)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_l4_source_port15to12, 21, 8, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_layer3_type, 13, 0, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_mac_da_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_mac_da_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_qos_label_lower, 25, 0, 6)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_qos_label_upper, 14, 24, 2)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_routed_packet, 18, 27, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_svlan_id, 10, 16, 12)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_tableid6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_acl_ipv6_key_vlan_ptr, 6, 16, 14)
+
+/* ds_qos_ipv6_key */
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_aclqos_ipv6key_tableid7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_acl_label_lower, 18, 28, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_acl_label_middle, 17, 0, 2)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_acl_label_upper, 14, 26, 2)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_cos, 10, 28, 3)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_cvlan_id, 9, 0, 12)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_dscp, 11, 20, 6)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ether_type, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_frag_info, 14, 16, 2)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ipv6_extension_headers, 13, 4, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ipv6_flow_label, 11, 0, 20)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_da31to0, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_da63to32, 22, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_da71to64, 21, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_da103to72, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_da127to104, 18, 0, 24)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_head_error, 14, 19, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_options, 14, 18, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_sa31to0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_sa63to32, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_sa71to64, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_sa103to72, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_ip_sa127to104, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_is_application, 14, 20, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_is_label, 18, 24, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_is_tcp, 18, 26, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_is_udp, 18, 25, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l2_qos_label, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l3_qos_label, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4destport_or_l4info5to0, 25, 6, 6)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4destport_or_l4info15to6, 17, 2, 10)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4_destport, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4_source_port3to0, 29, 8, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4_source_port11to4, 26, 24, 8)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_l4_source_port15to12, 21, 8, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_layer3_type, 13, 0, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_mac_da_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_mac_da_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_qos_label_lower, 25, 0, 6)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_qos_label_upper, 14, 24, 2)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_routed_packet, 18, 27, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_svlan_id, 10, 16, 12)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_tableid6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_qos_ipv6_key_vlan_ptr, 6, 16, 14)
+
+/* ds_ipv4_ucast_route_key */
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_dscp, 2, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_frag_info, 5, 4, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_ip_da, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_ip_options, 5, 6, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_ip_sa, 6, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_is_application, 5, 7, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_is_tcp, 5, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_is_udp, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_l4info_mapped, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_l4_dest_port, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_l4_source_port, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_layer4_type, 5, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_lkp_mode, 5, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_pbr_label, 2, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_table_id0, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_table_id1, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_vrf_idh, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_route_key_vrf_idl, 2, 28, 4)
+
+/* ds_ipv4_mcast_route_key */
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_dscp, 2, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_frag_info, 5, 4, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_ip_da, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_ip_options, 5, 6, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_ip_sa, 6, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_is_application, 5, 7, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_is_tcp, 5, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_is_udp, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_l4info_mapped, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_l4_dest_port, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_l4_source_port, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_layer4_type, 5, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_lkp_mode, 5, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_pbr_label, 2, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_table_id0, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_table_id1, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_vrf_idh, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_route_key_vrf_idl, 2, 28, 4)
+
+/* ds_ipv4_nat_key */
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_dscp, 2, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_frag_info, 5, 4, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_ip_da, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_ip_options, 5, 6, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_ip_sa, 6, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_is_application, 5, 7, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_is_tcp, 5, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_is_udp, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_l4info_mapped, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_l4_dest_port, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_l4_source_port, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_layer4_type, 5, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_lkp_mode, 5, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_pbr_label, 2, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_table_id0, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_table_id1, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_vrf_idh, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv4_nat_key_vrf_idl, 2, 28, 4)
+
+/* ds_ipv4_pbr_dualda_key */
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_dscp, 2, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_frag_info, 5, 4, 2)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_ip_da, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_ip_options, 5, 6, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_ip_sa, 6, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_is_application, 5, 7, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_is_tcp, 5, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_is_udp, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_l4info_mapped, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_l4_dest_port, 3, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_l4_source_port, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_layer4_type, 5, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_lkp_mode, 5, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_pbr_label, 2, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_table_id0, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_table_id1, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_vrf_idh, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv4_pbr_dualda_key_vrf_idl, 2, 28, 4)
+
+/* ds_ipv4_ucast_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_hash_key0_key_mapped_ip, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_hash_key0_key_vrfid, 1, 0, 16)
+
+/* ds_ipv4_ucast_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_hash_key1_key_mapped_ip, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_ucast_hash_key1_key_vrfid, 1, 0, 16)
+
+/* ds_ipv4_mcast_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_hash_key0_key_mapped_ip, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_hash_key0_key_vrfid, 1, 0, 16)
+
+/* ds_ipv4_mcast_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_hash_key1_key_mapped_ip, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv4_mcast_hash_key1_key_vrfid, 1, 0, 16)
+
+/* ds_ipv6_ucast_route_key */
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_dscp, 14, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ds_vlan_ptr, 6, 16, 14)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ether_typeh, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ether_typel, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_frag_info, 26, 28, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ipv6_extension_headers, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ipv6_flow_labelh, 17, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ipv6_flow_labell, 18, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ipv6_rtk_table_id7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_da0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_da1, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_da2, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_da3, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_da4, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_header_error, 26, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_options, 26, 30, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_sa0, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_sa1, 22, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_sa2, 21, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_sa3, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_ip_sa4, 18, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_is_application, 21, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_is_tcp, 21, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_is_udp, 21, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_l4_dest_port, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_l4_info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_l4_source_port, 15, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_layer3_type, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_layer4_type, 26, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_mac_dah, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_mac_dal, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_mac_sah, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_mac_sal, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_pbr_label, 14, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_scvlan_id, 11, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_table_id6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_vrf_idh, 25, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_route_key_vrf_idl, 29, 8, 4)
+
+/* ds_ipv6_nat_key */
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_dscp, 14, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ds_vlan_ptr, 6, 16, 14)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ether_typeh, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ether_typel, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_frag_info, 26, 28, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ipv6_extension_headers, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ipv6_flow_labelh, 17, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ipv6_flow_labell, 18, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ipv6_rtk_table_id7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_da0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_da1, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_da2, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_da3, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_da4, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_header_error, 26, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_options, 26, 30, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_sa0, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_sa1, 22, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_sa2, 21, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_sa3, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_ip_sa4, 18, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_is_application, 21, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_is_tcp, 21, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_is_udp, 21, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_l4_dest_port, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_l4_info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_l4_source_port, 15, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_layer3_type, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_layer4_type, 26, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_mac_dah, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_mac_dal, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_mac_sah, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_mac_sal, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_pbr_label, 14, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_scvlan_id, 11, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_table_id6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_vrf_idh, 25, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_nat_key_vrf_idl, 29, 8, 4)
+
+/* ds_ipv6_pbr_dualda_key */
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_dscp, 14, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ds_vlan_ptr, 6, 16, 14)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ether_typeh, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ether_typel, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_frag_info, 26, 28, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ipv6_extension_headers, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ipv6_flow_labelh, 17, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ipv6_flow_labell, 18, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ipv6_rtk_table_id7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_da0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_da1, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_da2, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_da3, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_da4, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_header_error, 26, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_options, 26, 30, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_sa0, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_sa1, 22, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_sa2, 21, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_sa3, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_ip_sa4, 18, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_is_application, 21, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_is_tcp, 21, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_is_udp, 21, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_l4_dest_port, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_l4_info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_l4_source_port, 15, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_layer3_type, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_layer4_type, 26, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_mac_dah, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_mac_dal, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_mac_sah, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_mac_sal, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_pbr_label, 14, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_scvlan_id, 11, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_table_id6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_vrf_idh, 25, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_pbr_dualda_key_vrf_idl, 29, 8, 4)
+
+/* ds_ipv6_mcast_route_key */
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ctag_cfi, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ctag_cos, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_cvlan_id, 1, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_dscp, 14, 16, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ds_vlan_ptr, 6, 16, 14)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ether_typeh, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ether_typel, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_frag_info, 26, 28, 2)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ipv6_extension_headers, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ipv6_flow_labelh, 17, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ipv6_flow_labell, 18, 24, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ipv6_rtk_table_id7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_da0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_da1, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_da2, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_da3, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_da4, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_header_error, 26, 31, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_options, 26, 30, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_sa0, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_sa1, 22, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_sa2, 21, 0, 8)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_sa3, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_ip_sa4, 18, 0, 24)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_is_application, 21, 8, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_is_tcp, 21, 10, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_is_udp, 21, 9, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_l4_dest_port, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_l4_info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_l4_source_port, 15, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_layer3_type, 9, 0, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_layer4_type, 26, 24, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_mac_dah, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_mac_dal, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_mac_sah, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_mac_sal, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_pbr_label, 14, 22, 6)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_scvlan_id, 11, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_table_id6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_vrf_idh, 25, 0, 12)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_route_key_vrf_idl, 29, 8, 4)
+
+/* ds_ipv6_ucast_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_key_ipda0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_key_ipda1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_key_ipda2, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_key_ipda3, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_vrfid0, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_vrfid1, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_vrfid2, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key0_vrfid3, 0, 0, 3)
+
+/* ds_ipv6_mcast_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_key_ipda0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_key_ipda1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_key_ipda2, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_key_ipda3, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_vrfid0, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_vrfid1, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_vrfid2, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key0_vrfid3, 0, 0, 3)
+
+/* ds_ipv6_ucast_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_key_ipda0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_key_ipda1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_key_ipda2, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_key_ipda3, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_vrfid0, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_vrfid1, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_vrfid2, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_ucast_hash_key1_vrfid3, 0, 0, 3)
+
+/* ds_ipv6_mcast_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_key_ipda0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_key_ipda1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_key_ipda2, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_key_ipda3, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_vrfid0, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_vrfid1, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_vrfid2, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_ipv6_mcast_hash_key1_vrfid3, 0, 0, 3)
+
+/* ds_user_id_vlan_key */
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_customer_id, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_cvlan_idh, 1, 6, 6)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_cvlan_idl, 2, 26, 6)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_from_sgmac, 2, 13, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_global_src_port, 2, 0, 13)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_svlan_id, 2, 14, 12)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_table_id, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_vlan_key_user_id_label, 1, 0, 6)
+
+/* ds_user_id_mac_key */
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_cfi1, 5, 8, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_cfi2, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_cos1, 5, 9, 3)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_cos2, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_exp2, 1, 8, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_exp_sub_idx, 1, 4, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_from_sgmac, 5, 6, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_layer3_type, 6, 28, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_mac_da_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_mac_da_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_mac_sa_lower, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_mac_sa_upper, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_table_id0, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_table_id1, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_user_id_label, 5, 0, 6)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_vlan_id1, 6, 16, 12)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_vlan_id27to0, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_mac_key_vlan_id211to8, 1, 0, 4)
+
+/* ds_user_id_ipv4_key */
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ctag_cfi, 6, 28, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ctag_cos, 6, 29, 3)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_cvlan_id, 9, 0, 12)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_dscp, 6, 16, 6)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ether_type_lower, 1, 0, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ether_type_upper, 2, 24, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_exp2, 5, 10, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_exp_sub_idx, 5, 6, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_frag_info, 6, 22, 2)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_from_sgmac, 13, 6, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ip_da, 14, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ip_header_error, 5, 4, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ip_options, 6, 24, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_ip_sa, 15, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_is_application, 6, 25, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_is_tcp, 6, 27, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_is_udp, 6, 26, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_l4dest_port, 7, 16, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_l4info_mapped, 6, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_l4source_port, 7, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_layer2_type, 2, 16, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_layer3_type, 10, 28, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_mac_da_lower, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_mac_da_upper, 2, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_mac_sa_lower, 11, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_mac_sa_upper, 10, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_routed_packet, 5, 5, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_stag_cfi, 2, 20, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_stag_cos, 2, 21, 3)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_svlan_id, 10, 16, 12)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_table_id0, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_table_id1, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_table_id2, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_table_id3, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv4_key_user_id_label, 13, 0, 6)
+
+/* ds_user_id_ipv6_key */
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ctag_cfi, 10, 20, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ctag_cos, 10, 21, 3)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_cvlan_id, 21, 0, 12)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_dscp, 14, 16, 6)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ether_type7to0, 11, 0, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ether_type15to8, 18, 24, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_exp2, 25, 11, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_exp_sub_idx, 25, 7, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_frag_info, 26, 28, 2)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_from_sgmac, 25, 6, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ipv6_externsion_headers, 13, 0, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ipv6_flow_label, 11, 12, 20)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_da31_to0, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_da63_to32, 6, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_da71_to64, 5, 0, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_da103_to72, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_da127_to104, 2, 0, 24)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_header_error, 26, 31, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_options, 26, 30, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_sa31_to0, 31, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_sa63_to32, 30, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_sa71_to64, 29, 0, 8)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_sa103_to72, 27, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_ip_sa127_to104, 26, 0, 24)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_is_app, 14, 22, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_is_tcp, 14, 24, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_is_udp, 14, 23, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_l4dest_port, 15, 16, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_l4info_mapped, 14, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_l4source_port, 15, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_layer2_type, 18, 16, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_layer3_type, 22, 28, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_mac_da_lower, 19, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_mac_da_upper, 18, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_mac_sa_lower, 23, 0, 32)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_mac_sa_upper, 22, 0, 16)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_routed_packet, 14, 25, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_stag_cfi, 18, 20, 1)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_stag_cos, 18, 21, 3)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_svlan_id, 22, 16, 12)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id0, 29, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id1, 25, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id2, 21, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id3, 17, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id4, 13, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id5, 9, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id6, 5, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_table_id7, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_user_id_ipv6_key_user_id_label, 25, 0, 6)
+
+/* ds_eth_oam_key */
+DRV_FIELD_ACCESSOR(ds_eth_oam_key_is_up, 2, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_key_oam_lookup_type, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_key_port, 2, 0, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_key_table_id, 1, 12, 4)
+DRV_FIELD_ACCESSOR(ds_eth_oam_key_vlan_ptr, 3, 0, 16)
+
+/* ds_eth_oam_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_global_src_port0, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_global_src_port1, 3, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_global_src_port2, 5, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_global_src_port3, 7, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_is_up0, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_is_up1, 3, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_is_up2, 5, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_is_up3, 7, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_oam_hash_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_oam_hash_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_oam_hash_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_oam_hash_type3, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_vlan_ptr0, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_vlan_ptr1, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_vlan_ptr2, 5, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key0_vlan_ptr3, 7, 0, 16)
+
+/* ds_eth_oam_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_global_src_port0, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_global_src_port1, 3, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_global_src_port2, 5, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_global_src_port3, 7, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_is_up0, 1, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_is_up1, 3, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_is_up2, 5, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_is_up3, 7, 30, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_oam_hash_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_oam_hash_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_oam_hash_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_oam_hash_type3, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_vlan_ptr0, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_vlan_ptr1, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_vlan_ptr2, 5, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_hash_key1_vlan_ptr3, 7, 0, 16)
+
+/* ds_pbt_oam_key */
+DRV_FIELD_ACCESSOR(ds_pbt_oam_key_esp_id, 3, 0, 13)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_key_oam_lookup_type, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_key_pbt_oam_port, 3, 16, 12)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_key_table_id, 1, 12, 4)
+
+/* ds_pbt_oam_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_esp_id0, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_esp_id1, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_esp_id2, 5, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_esp_id3, 7, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_oam_lookup_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_oam_lookup_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_oam_lookup_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_oam_lookup_type3, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_pbt_oam_port0, 1, 16, 15)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_pbt_oam_port1, 3, 16, 15)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_pbt_oam_port2, 5, 16, 15)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key0_pbt_oam_port3, 7, 16, 15)
+
+/* ds_pbt_oam_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_esp_id0, 1, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_esp_id1, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_esp_id2, 5, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_esp_id3, 7, 0, 16)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_oam_lookup_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_oam_lookup_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_oam_lookup_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_oam_lookup_type3, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_pbt_oam_port0, 1, 16, 15)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_pbt_oam_port1, 3, 16, 15)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_pbt_oam_port2, 5, 16, 15)
+DRV_FIELD_ACCESSOR(ds_pbt_oam_hash_key1_pbt_oam_port3, 7, 16, 15)
+
+/* ds_mpls_oam_label_key */
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_key_mpls_lable, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_key_oam_lookup_type, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_key_table_id, 1, 12, 4)
+
+/* ds_mpls_oam_label_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_mpls_label0, 1, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_mpls_label1, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_mpls_label2, 5, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_mpls_label3, 7, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_oam_look_up_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_oam_look_up_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_oam_look_up_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key0_oam_look_up_type3, 6, 0, 3)
+
+/* ds_mpls_oam_label_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_mpls_label0, 1, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_mpls_label1, 3, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_mpls_label2, 5, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_mpls_label3, 7, 0, 20)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_oam_look_up_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_oam_look_up_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_oam_look_up_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_label_hash_key1_oam_look_up_type3, 6, 0, 3)
+
+/* ds_mpls_oam_ipv4_ttsi_key */
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_key_lsp_id, 2, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_key_lsr_id, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_key_oam_lookup_type, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_key_table_id, 1, 12, 4)
+
+/* ds_mpls_oam_ipv4_ttsi_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_invalid0, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_invalid1, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_lsp_id0, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_lsp_id1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_lsr_id0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_lsr_id1, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_oam_lookup_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key0_oam_lookup_type1, 4, 0, 3)
+
+/* ds_mpls_oam_ipv4_ttsi_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_invalid0, 2, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_invalid1, 6, 0, 1)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_lsp_id0, 1, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_lsp_id1, 5, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_lsr_id0, 3, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_lsr_id1, 7, 0, 32)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_oam_lookup_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_mpls_oam_ipv4_ttsi_hash_key1_oam_lookup_type1, 4, 0, 3)
+
+/* ds_eth_oam_rmep_key */
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_key_mep_index, 3, 0, 16)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_key_oam_lookup_type, 1, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_key_rmep_id, 3, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_key_table_id, 1, 12, 4)
+
+/* ds_eth_oam_rmep_hash_key0 */
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_mep_index0, 1, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_mep_index1, 3, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_mep_index2, 5, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_mep_index3, 7, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_oam_lookup_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_oam_lookup_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_oam_lookup_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_oam_lookup_type3, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_rmep_id0, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_rmep_id1, 3, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_rmep_id2, 5, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key0_rmep_id3, 7, 16, 13)
+
+/* ds_eth_oam_rmep_hash_key1 */
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_invalid0, 1, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_invalid1, 3, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_invalid2, 5, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_invalid3, 7, 31, 1)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_mep_index0, 1, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_mep_index1, 3, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_mep_index2, 5, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_mep_index3, 7, 0, 15)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_oam_lookup_type0, 0, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_oam_lookup_type1, 2, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_oam_lookup_type2, 4, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_oam_lookup_type3, 6, 0, 3)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_rmep_id0, 1, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_rmep_id1, 3, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_rmep_id2, 5, 16, 13)
+DRV_FIELD_ACCESSOR(ds_eth_oam_rmep_hash_key1_rmep_id3, 7, 16, 13)
+
+#endif /*end of _DRV_HUMBER_FIELD_H_*/
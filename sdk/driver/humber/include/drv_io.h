@@ -37,6 +37,24 @@
 extern int32
 drv_tbl_ioctl(uint8 chip_id, int32 index, uint32 cmd, void* val );
 
+/**
+ @brief keep a write-through software copy of a sram table for drv_tbl_ioctl
+*/
+extern int32
+drv_tbl_shadow_enable(uint8 chip_id, tbl_id_t tbl_id);
+
+/**
+ @brief drop the software copy of a table
+*/
+extern int32
+drv_tbl_shadow_disable(uint8 chip_id, tbl_id_t tbl_id);
+
+/**
+ @brief compare a table's software copy with the chip
+*/
+extern int32
+drv_tbl_shadow_check(uint8 chip_id, tbl_id_t tbl_id, uint32* p_mismatch);
+
 /**
  @brief the register I/O control API
 */
@@ -323,6 +323,22 @@ drv_tbl_field_get(tbl_id_t tbl_id, fld_id_t field_id,
                   uint32* entry, uint32* value);
 
 
+/**
+ @brief set a field of a table data entry in memory, generated constant accessor
+*/
+extern int32
+drv_humber_tbl_field_set(tbl_id_t tbl_id, fld_id_t field_id,
+                         uint32* entry, uint32 value);
+
+
+/**
+ @brief get a field of a table data entry in memory, generated constant accessor
+*/
+extern int32
+drv_humber_tbl_field_get(tbl_id_t tbl_id, fld_id_t field_id,
+                         uint32* entry, uint32* value);
+
+
 /**
  @brief set a field of a register data entry in memory
 */
@@ -344,16 +344,71 @@ drv_chip_write_sram_entry(uint8 chip_id, uint32 addr,
     }
     else
     {
+        dal_batch_t batch;
 
+        /* the whole entry goes down in one ioctl */
+        dal_usrctrl_batch_init(&batch);
         for (i = 0; i < length; i++)
         {
-            DRV_IF_ERROR_RETURN(dal_usrctrl_write_chip(chip_id, addr, data[i]));
+            DRV_IF_ERROR_RETURN(dal_usrctrl_batch_write(&batch, chip_id, addr, data[i]));
             addr += 4;
         }
+        DRV_IF_ERROR_RETURN(dal_usrctrl_batch_flush(&batch));
     }
     return DRV_E_NONE;
 }
 
+/**
+ @brief Queue a whole register entry write into a dal batch
+*/
+static int32
+_drv_chip_batch_reg_write(dal_batch_t* p_batch, uint8 chip_id, reg_id_t reg_id, void* ds)
+{
+    uint32 entry[MAX_ENTRY_WORD] = {0};
+    uint32 addr;
+    int32 words;
+    int32 i;
+
+    DRV_IF_ERROR_RETURN(drv_io_api[chip_id].drv_sram_reg_ds_to_entry(reg_id, ds, entry));
+
+    addr = DRV_REG_GET_INFO(reg_id).hw_data_base;
+    words = DRV_REG_ENTRY_SIZE(reg_id) >> 2;
+    for (i = 0; i < words; i++)
+    {
+        DRV_IF_ERROR_RETURN(dal_usrctrl_batch_write(p_batch, chip_id, addr, entry[i]));
+        addr += 4;
+    }
+
+    return DRV_E_NONE;
+}
+
+/**
+ @brief Write the tcam mask and data registers and fire the access request,
+        all in one dal batch
+*/
+static int32
+_drv_chip_batch_tcam_write(uint8 chip_id, reg_id_t mask_reg, void* mask_ds,
+                           reg_id_t data_reg, void* data_ds,
+                           reg_id_t access_reg, void* access_ds)
+{
+    dal_batch_t batch;
+    int32 ret;
+
+    dal_usrctrl_batch_init(&batch);
+    DRV_IF_ERROR_RETURN(_drv_chip_batch_reg_write(&batch, chip_id, mask_reg, mask_ds));
+    DRV_IF_ERROR_RETURN(_drv_chip_batch_reg_write(&batch, chip_id, data_reg, data_ds));
+
+    /* mask and data must have landed before the request is raised */
+    DRV_IF_ERROR_RETURN(dal_usrctrl_batch_barrier(&batch));
+    DRV_IF_ERROR_RETURN(_drv_chip_batch_reg_write(&batch, chip_id, access_reg, access_ds));
+
+    REG_LOCK(chip_id);
+    ret = dal_usrctrl_batch_flush(&batch);
+    REG_UNLOCK(chip_id);
+
+    return ret;
+}
+
 /**
  @brief Real sram direct read operation I/O
 */
@@ -508,7 +563,6 @@ _drv_chip_write_int_tcam_data_mask(uint8 chip_id, uint32 index,
     tcam_ctl_int_access_t access;
     tcam_ctl_int_cpu_wr_data_t tcam_data;
     tcam_ctl_int_cpu_wr_mask_t tcam_mask;
-    uint32 cmd;
     int32 ret = DRV_E_NONE;
 
     DRV_PTR_VALID_CHECK(data);
@@ -540,29 +594,13 @@ _drv_chip_write_int_tcam_data_mask(uint8 chip_id, uint32 index,
     tcam_mask.tcam_write_data11 = mask[2];
     tcam_mask.tcam_write_data12 = mask[3];
 
-
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_INT_CPU_WR_MASK, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &tcam_mask);
-    if (ret < DRV_E_NONE)
-    {
-        TCAM_UNLOCK(chip_id);
-        return ret;
-    }
-
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_INT_CPU_WR_DATA, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &tcam_data);
-    if (ret < DRV_E_NONE)
-    {
-        TCAM_UNLOCK(chip_id);
-        return ret;
-    }
-
     access.cpu_index = index;
     access.cpu_req_type = CPU_ACCESS_REQ_WRITE;
     access.cpu_req = TRUE;
 
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_INT_ACCESS, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &access);
+    ret = _drv_chip_batch_tcam_write(chip_id, TCAM_CTL_INT_CPU_WR_MASK, &tcam_mask,
+                                     TCAM_CTL_INT_CPU_WR_DATA, &tcam_data,
+                                     TCAM_CTL_INT_ACCESS, &access);
     if (ret < DRV_E_NONE)
     {
         TCAM_UNLOCK(chip_id);
@@ -731,7 +769,6 @@ _drv_chip_write_ext_tcam_data_mask(uint8 chip_id, uint32 index,
     tcam_ctl_ext_access_t access;
     tcam_ctl_ext_write_data_t tcam_data;
     tcam_ctl_ext_write_mask_t tcam_mask;
-    uint32 cmd;
     int32 ret = DRV_E_NONE;
 
     DRV_PTR_VALID_CHECK(data);
@@ -761,29 +798,13 @@ _drv_chip_write_ext_tcam_data_mask(uint8 chip_id, uint32 index,
     tcam_mask.tcam_write_data11 = ~mask[2];
     tcam_mask.tcam_write_data12 = ~mask[3];
 
-
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_EXT_WRITE_MASK, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &tcam_mask);
-    if (ret < DRV_E_NONE)
-    {
-        TCAM_UNLOCK(chip_id);
-        return ret;
-    }
-
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_EXT_WRITE_DATA, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &tcam_data);
-    if (ret < DRV_E_NONE)
-    {
-        TCAM_UNLOCK(chip_id);
-        return ret;
-    }
-
     access.cpu_index = index;
     access.cpu_req_type = CPU_ACCESS_REQ_WRITE;
     access.cpu_req = TRUE;
 
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_EXT_ACCESS, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &access);
+    ret = _drv_chip_batch_tcam_write(chip_id, TCAM_CTL_EXT_WRITE_MASK, &tcam_mask,
+                                     TCAM_CTL_EXT_WRITE_DATA, &tcam_data,
+                                     TCAM_CTL_EXT_ACCESS, &access);
     if (ret < DRV_E_NONE)
     {
         TCAM_UNLOCK(chip_id);
@@ -805,7 +826,6 @@ _drv_chip_write_ext_tcam_reg_entry(uint8 chip_id, uint32 index, uint32 *data)
     tcam_ctl_ext_access_t access;
     tcam_ctl_ext_write_data_t tcam_data;
     tcam_ctl_ext_write_mask_t tcam_mask;
-    uint32 cmd = 0;
     int32 ret = DRV_E_NONE;
 
     DRV_PTR_VALID_CHECK(data);
@@ -816,32 +836,20 @@ _drv_chip_write_ext_tcam_reg_entry(uint8 chip_id, uint32 index, uint32 *data)
     tcam_mask.tcam_write_data10 = 0;
     tcam_mask.tcam_write_data11 = 0;
     tcam_mask.tcam_write_data12 = 0;
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_EXT_WRITE_MASK, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &tcam_mask);
-    if (ret < DRV_E_NONE)
-    {
-        TCAM_UNLOCK(chip_id);
-        return ret;
-    }
 
     kal_memset(&tcam_data, 0, sizeof(tcam_data));
     tcam_data.tcam_write_data00 = data[2] & 0xFFFF;
     tcam_data.tcam_write_data01 = data[1];
     tcam_data.tcam_write_data02 = data[0];
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_EXT_WRITE_DATA, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &tcam_data);
-    if (ret < DRV_E_NONE)
-    {
-        TCAM_UNLOCK(chip_id);
-        return ret;
-    }
 
     kal_memset(&access, 0, sizeof(access));
     access.cpu_index = index;
     access.cpu_req_type = CPU_ACCESS_REQ_WRITE_REG;
     access.cpu_req = TRUE;
-    cmd = DRV_IOW(IOC_REG, TCAM_CTL_EXT_ACCESS, DRV_ENTRY_FLAG);
-    ret = drv_reg_ioctl(chip_id, 0, cmd, &access);
+
+    ret = _drv_chip_batch_tcam_write(chip_id, TCAM_CTL_EXT_WRITE_MASK, &tcam_mask,
+                                     TCAM_CTL_EXT_WRITE_DATA, &tcam_data,
+                                     TCAM_CTL_EXT_ACCESS, &access);
     if (ret < DRV_E_NONE)
     {
         TCAM_UNLOCK(chip_id);
@@ -0,0 +1,10593 @@
+/**
+ @file drv_humber_field.c
+
+ The file is generated from the table field registry in drv_humber.c
+ by drv_humber_field.awk, do not edit it by hand.
+
+ Table field set/get for drv_tbl_ioctl(): the table and field ids pick
+ a drv_humber_field.h accessor through a switch instead of walking the
+ registered field descriptors.
+*/
+
+#include "drv_tbl_reg.h"
+#include "drv_humber_field.h"
+
+#define DRV_FIELD_SET_CASE(id, name, len) \
+        case id: \
+            if (value & ~DRV_FIELD_MASK(len)) \
+            { \
+                break; \
+            } \
+            drv_##name##_set(entry, value); \
+            return DRV_E_NONE;
+
+#define DRV_FIELD_GET_CASE(id, name, len) \
+        case id: \
+            *value = drv_##name##_get(entry); \
+            return DRV_E_NONE;
+
+/**
+ @brief Set a field of a table data entry in memory with the constant accessor
+
+ Anything the switch does not take, an unknown table or field or a value
+ too big for the field, goes to drv_tbl_field_set() for its error.
+*/
+int32
+drv_humber_tbl_field_set(tbl_id_t tbl_id, fld_id_t field_id,
+                         uint32* entry, uint32 value)
+{
+    DRV_PTR_VALID_CHECK(entry)
+
+    switch (tbl_id)
+    {
+    case BUF_RETRV_PKT_MSG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA0, buf_retrv_pkt_msg_mem_data0, 7)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA1, buf_retrv_pkt_msg_mem_data1, 32)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA2, buf_retrv_pkt_msg_mem_data2, 32)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA3, buf_retrv_pkt_msg_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_RAM_DATA0, buf_retrv_buf_ram_data0, 25)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_RAM_DATA1, buf_retrv_buf_ram_data1, 32)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_RAM_DATA2, buf_retrv_buf_ram_data2, 32)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_RAM_DATA3, buf_retrv_buf_ram_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_PKT_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_CONFIG_MEM_PKT_CONFIG_END, buf_retrv_pkt_config_mem_pkt_config_end, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_CONFIG_MEM_PKT_CONFIG_START, buf_retrv_pkt_config_mem_pkt_config_start, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_CONFIG_MEM_PKT_CONFIG_WEIGHT, buf_retrv_pkt_config_mem_pkt_config_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_PKT_STATUS_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_COUNT, buf_retrv_pkt_status_mem_pkt_status_count, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_HEAD, buf_retrv_pkt_status_mem_pkt_status_head, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_TAIL, buf_retrv_pkt_status_mem_pkt_status_tail, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_WEIGHT, buf_retrv_pkt_status_mem_pkt_status_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_PKT_PARK_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA0, buf_retrv_pkt_park_mem_data0, 29)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA1, buf_retrv_pkt_park_mem_data1, 32)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA2, buf_retrv_pkt_park_mem_data2, 32)
+        DRV_FIELD_SET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA3, buf_retrv_pkt_park_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_BURST_CNT_SEL, buf_retrv_buf_config_mem_buf_config_burst_cnt_sel, 2)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_END, buf_retrv_buf_config_mem_buf_config_end, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_START, buf_retrv_buf_config_mem_buf_config_start, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_WEIGHT, buf_retrv_buf_config_mem_buf_config_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_STATUS_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS1ST_DATA, buf_retrv_buf_status_mem_buf_status1st_data, 1)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_COUNT, buf_retrv_buf_status_mem_buf_status_count, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_DATA_CNT, buf_retrv_buf_status_mem_buf_status_data_cnt, 3)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_HEAD, buf_retrv_buf_status_mem_buf_status_head, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_OFFSET, buf_retrv_buf_status_mem_buf_status_offset, 3)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_TAIL, buf_retrv_buf_status_mem_buf_status_tail, 11)
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_WEIGHT, buf_retrv_buf_status_mem_buf_status_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_CREDIT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_CREDIT_MEM_CREDIT, buf_retrv_credit_mem_credit, 12)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_CREDIT_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_CREDIT_CONFIG_MEM_CREDIT_CONFIG, buf_retrv_credit_config_mem_credit_config, 3)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_EXCEPTION_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_EXCEPTION_MEM_EXCEPTION_DATA, buf_retrv_exception_mem_exception_data, 20)
+        DRV_FIELD_SET_CASE(BUF_RETRV_EXCEPTION_MEM_EXCEPTION_SUB_INDEX_EN, buf_retrv_exception_mem_exception_sub_index_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_CREDIT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_CREDIT_MEM_CREDIT, buf_retrv_buf_credit_mem_credit, 4)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_CREDIT_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_RETRV_BUF_CREDIT_CONFIG_MEM_CREDIT_CONFIG, buf_retrv_buf_credit_config_mem_credit_config, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_BUF_RETRV_COLOR_MAP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_BUF_RETRV_COLOR_MAP_COLOR_MAP, ds_buf_retrv_color_map_color_map, 2)
+        default:
+            break;
+        }
+        break;
+
+    case MET_FIFO_PRIORITY_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_DROP_PRECEDENCE, met_fifo_priority_map_table_drop_precedence, 2)
+        DRV_FIELD_SET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_MET_FIFO_PRIORITY, met_fifo_priority_map_table_met_fifo_priority, 1)
+        DRV_FIELD_SET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_QUEUE_SELECT, met_fifo_priority_map_table_queue_select, 6)
+        DRV_FIELD_SET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_RESRC_DROP_PRECEDENCE, met_fifo_priority_map_table_resrc_drop_precedence, 2)
+        default:
+            break;
+        }
+        break;
+
+    case BUFFER_STORE_RESRC_CNT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUFFER_STORE_RESRC_CNT_RESRC_CNT, buffer_store_resrc_cnt_resrc_cnt, 16)
+        default:
+            break;
+        }
+        break;
+
+    case BUFFER_STORE_RESRC_THRESHOLD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD0, buffer_store_resrc_threshold_resrc_drop_threshold0, 16)
+        DRV_FIELD_SET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD1, buffer_store_resrc_threshold_resrc_drop_threshold1, 16)
+        DRV_FIELD_SET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD2, buffer_store_resrc_threshold_resrc_drop_threshold2, 16)
+        DRV_FIELD_SET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD3, buffer_store_resrc_threshold_resrc_drop_threshold3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_STORE_CHANNEL_INFO_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD0, buf_store_channel_info_ram_word0, 17)
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD1, buf_store_channel_info_ram_word1, 32)
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD2, buf_store_channel_info_ram_word2, 32)
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD3, buf_store_channel_info_ram_word3, 32)
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD4, buf_store_channel_info_ram_word4, 32)
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD5, buf_store_channel_info_ram_word5, 32)
+        DRV_FIELD_SET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD6, buf_store_channel_info_ram_word6, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_STORE_BUF_PTR:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUF_STORE_BUF_PTR_BUF_PTR, buf_store_buf_ptr_buf_ptr, 17)
+        default:
+            break;
+        }
+        break;
+
+    case BUFFER_STORE_STALL_THRESHOLD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(BUFFER_STORE_STALL_THRESHOLD_STALL_HIGH, buffer_store_stall_threshold_stall_high, 16)
+        DRV_FIELD_SET_CASE(BUFFER_STORE_STALL_THRESHOLD_STALL_LOW, buffer_store_stall_threshold_stall_low, 16)
+        default:
+            break;
+        }
+        break;
+
+    case CPUMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CPUMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, cpumac_stats_ram_byte_cnt_data_high, 4)
+        DRV_FIELD_SET_CASE(CPUMAC_STATS_RAM_BYTE_CNT_DATA_LOW, cpumac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(CPUMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, cpumac_stats_ram_frame_cnt_data_high, 4)
+        DRV_FIELD_SET_CASE(CPUMAC_STATS_RAM_FRAME_CNT_DATA_LOW, cpumac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_INT_KEY_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_INT_KEY_RAM_KEY0, tcam_int_key_ram_key0, 1)
+        DRV_FIELD_SET_CASE(TCAM_INT_KEY_RAM_KEY1, tcam_int_key_ram_key1, 16)
+        DRV_FIELD_SET_CASE(TCAM_INT_KEY_RAM_KEY2, tcam_int_key_ram_key2, 32)
+        DRV_FIELD_SET_CASE(TCAM_INT_KEY_RAM_KEY3, tcam_int_key_ram_key3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_INT_MASK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_INT_MASK_RAM_MASK0, tcam_int_mask_ram_mask0, 1)
+        DRV_FIELD_SET_CASE(TCAM_INT_MASK_RAM_MASK1, tcam_int_mask_ram_mask1, 16)
+        DRV_FIELD_SET_CASE(TCAM_INT_MASK_RAM_MASK2, tcam_int_mask_ram_mask2, 32)
+        DRV_FIELD_SET_CASE(TCAM_INT_MASK_RAM_MASK3, tcam_int_mask_ram_mask3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_EXT_KEY_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_EXT_KEY_RAM_KEY0, tcam_ext_key_ram_key0, 1)
+        DRV_FIELD_SET_CASE(TCAM_EXT_KEY_RAM_KEY1, tcam_ext_key_ram_key1, 16)
+        DRV_FIELD_SET_CASE(TCAM_EXT_KEY_RAM_KEY2, tcam_ext_key_ram_key2, 32)
+        DRV_FIELD_SET_CASE(TCAM_EXT_KEY_RAM_KEY3, tcam_ext_key_ram_key3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_EXT_MASK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_EXT_MASK_RAM_MASK0, tcam_ext_mask_ram_mask0, 1)
+        DRV_FIELD_SET_CASE(TCAM_EXT_MASK_RAM_MASK1, tcam_ext_mask_ram_mask1, 16)
+        DRV_FIELD_SET_CASE(TCAM_EXT_MASK_RAM_MASK2, tcam_ext_mask_ram_mask2, 32)
+        DRV_FIELD_SET_CASE(TCAM_EXT_MASK_RAM_MASK3, tcam_ext_mask_ram_mask3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case INT_SRAM_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(INT_SRAM_RAM_DATA0, int_sram_ram_data0, 8)
+        DRV_FIELD_SET_CASE(INT_SRAM_RAM_DATA1, int_sram_ram_data1, 32)
+        DRV_FIELD_SET_CASE(INT_SRAM_RAM_DATA2, int_sram_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case HASH_TAB98K_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(HASH_TAB98K_RAM_DATA0, hash_tab98k_ram_data0, 8)
+        DRV_FIELD_SET_CASE(HASH_TAB98K_RAM_DATA1, hash_tab98k_ram_data1, 32)
+        DRV_FIELD_SET_CASE(HASH_TAB98K_RAM_DATA2, hash_tab98k_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case EXT_DDR_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EXT_DDR_RAM_DATA0, ext_ddr_ram_data0, 8)
+        DRV_FIELD_SET_CASE(EXT_DDR_RAM_DATA1, ext_ddr_ram_data1, 32)
+        DRV_FIELD_SET_CASE(EXT_DDR_RAM_DATA2, ext_ddr_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case HASH_TAB50K_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(HASH_TAB50K_RAM_DATA0, hash_tab50k_ram_data0, 8)
+        DRV_FIELD_SET_CASE(HASH_TAB50K_RAM_DATA1, hash_tab50k_ram_data1, 32)
+        DRV_FIELD_SET_CASE(HASH_TAB50K_RAM_DATA2, hash_tab50k_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_EXT_REG_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_EXT_REG_RAM_DATA0, tcam_ext_reg_ram_data0, 1)
+        DRV_FIELD_SET_CASE(TCAM_EXT_REG_RAM_DATA1, tcam_ext_reg_ram_data1, 16)
+        DRV_FIELD_SET_CASE(TCAM_EXT_REG_RAM_DATA2, tcam_ext_reg_ram_data2, 32)
+        DRV_FIELD_SET_CASE(TCAM_EXT_REG_RAM_DATA3, tcam_ext_reg_ram_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_CLASSIFICATION_PHB_OFFSET_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET0, epe_classification_phb_offset_table_offset0, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET1, epe_classification_phb_offset_table_offset1, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET2, epe_classification_phb_offset_table_offset2, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET3, epe_classification_phb_offset_table_offset3, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET4, epe_classification_phb_offset_table_offset4, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET5, epe_classification_phb_offset_table_offset5, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET6, epe_classification_phb_offset_table_offset6, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET7, epe_classification_phb_offset_table_offset7, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET8, epe_classification_phb_offset_table_offset8, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET9, epe_classification_phb_offset_table_offset9, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET10, epe_classification_phb_offset_table_offset10, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET11, epe_classification_phb_offset_table_offset11, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET12, epe_classification_phb_offset_table_offset12, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET13, epe_classification_phb_offset_table_offset13, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET14, epe_classification_phb_offset_table_offset14, 2)
+        DRV_FIELD_SET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET15, epe_classification_phb_offset_table_offset15, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_DEST_PHY_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_DEST_DISCARD, ds_dest_phy_port_dest_discard, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_DISCARD_NON8023_OAM, ds_dest_phy_port_discard_non8023_oam, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_GLOBAL_DEST_PORT, ds_dest_phy_port_global_dest_port, 13)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_L2_SPAN_EN, ds_dest_phy_port_l2_span_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_L2_SPAN_ID, ds_dest_phy_port_l2_span_id, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_MUX_PORT_TYPE, ds_dest_phy_port_mux_port_type, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_RANDOM_LOG_EN, ds_dest_phy_port_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PHY_PORT_RANDOM_THRESHOLD, ds_dest_phy_port_random_threshold, 15)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_DEST_MAP, epe_hdr_edit_l2_edit_loopback_ram_lb_dest_map, 22)
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_LENGTH_ADJUST_TYPE, epe_hdr_edit_l2_edit_loopback_ram_lb_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_NEXT_HOP_EXT, epe_hdr_edit_l2_edit_loopback_ram_lb_next_hop_ext, 1)
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_NEXT_HOP_PTR, epe_hdr_edit_l2_edit_loopback_ram_lb_next_hop_ptr, 20)
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_PARITY0, epe_hdr_edit_l2_edit_loopback_ram_parity0, 1)
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_PARITY1, epe_hdr_edit_l2_edit_loopback_ram_parity1, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_HEADER_EDIT_SGMAC_PRIORITY_MAP_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_HEADER_EDIT_SGMAC_PRIORITY_MAP_MEM_DP, epe_header_edit_sgmac_priority_map_mem_dp, 2)
+        DRV_FIELD_SET_CASE(EPE_HEADER_EDIT_SGMAC_PRIORITY_MAP_MEM_TC, epe_header_edit_sgmac_priority_map_mem_tc, 4)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_HDR_EDIT_DISCARD_TYPE_STATS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_HDR_EDIT_DISCARD_TYPE_STATS_DISCARD_COUNT, epe_hdr_edit_discard_type_stats_discard_count, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3_EDIT_TUNNEL_V6_IP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA31_TO0, ds_l3_edit_tunnel_v6_ip_ip_sa31_to0, 32)
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA63_TO32, ds_l3_edit_tunnel_v6_ip_ip_sa63_to32, 32)
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA95_TO64, ds_l3_edit_tunnel_v6_ip_ip_sa95_to64, 32)
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA127_TO96, ds_l3_edit_tunnel_v6_ip_ip_sa127_to96, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3_EDIT_SEQUENCE_NUM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM31_TO0, ds_l3_edit_sequence_num_seq_num31_to0, 32)
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM63_TO32, ds_l3_edit_sequence_num_seq_num63_to32, 32)
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM95_TO64, ds_l3_edit_sequence_num_seq_num95_to64, 32)
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM127_TO96, ds_l3_edit_sequence_num_seq_num127_to96, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3_EDIT_TUNNEL_V4_IP_SA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3_EDIT_TUNNEL_V4_IP_SA_IP_SA, ds_l3_edit_tunnel_v4_ip_sa_ip_sa, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_DEST_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_BRIDGE_EN, ds_dest_port_bridge_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_BRIDGE_L2_MATCH_DISABLE, ds_dest_port_bridge_l2_match_disable, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_DEFAULT_VLAN_ID, ds_dest_port_default_vlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_DEST_PORT_ISOLATION_ID, ds_dest_port_dest_port_isolation_id, 6)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_DOT1Q_EN, ds_dest_port_dot1q_en, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_EGRESS_FILTER_EN, ds_dest_port_egress_filter_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_ETHER_OAM_VALID, ds_dest_port_ether_oam_valid, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_FORCE_IPV4_TO_MAC_KEY, ds_dest_port_force_ipv4_to_mac_key, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_FORCE_IPV6_TO_MAC_KEY, ds_dest_port_force_ipv6_to_mac_key, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_IPG_INDEX, ds_dest_port_ipg_index, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_L2_ACL_EN, ds_dest_port_l2_acl_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_L2_ACL_HIGH_PRIORITY, ds_dest_port_l2_acl_high_priority, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_L2_ACL_LABEL, ds_dest_port_l2_acl_label, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_L2_QOS_HIGH_PRIORITY, ds_dest_port_l2_qos_high_priority, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_L2_QOS_LABLE, ds_dest_port_l2_qos_lable, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_L2_QOS_LOOKUP_EN, ds_dest_port_l2_qos_lookup_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_MCAST_FLOODING_DISABLE, ds_dest_port_mcast_flooding_disable, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_MD_LEVEL, ds_dest_port_md_level, 3)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_PBB_PORT_TYPE, ds_dest_port_pbb_port_type, 3)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_PIP_MAC_SA, ds_dest_port_pip_mac_sa, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_PORT_POLICER_VALID, ds_dest_port_port_policer_valid, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_QOS_DOMAIN, ds_dest_port_qos_domain, 3)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_REPLACE_COS, ds_dest_port_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_REPLACE_DSCP, ds_dest_port_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_ROUTED_PORT, ds_dest_port_routed_port, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_STP_CHECK_DISABLE, ds_dest_port_stp_check_disable, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_SVLAN_TPID_INDEX, ds_dest_port_svlan_tpid_index, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_TRANSMIT_EN, ds_dest_port_transmit_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_UCAST_FLOODING_DISABLE, ds_dest_port_ucast_flooding_disable, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_UNTAG_DEFAULT_SVLAN, ds_dest_port_untag_default_svlan, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_UNTAG_DEFAULT_VLAN_ID, ds_dest_port_untag_default_vlan_id, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_VLAN_FLOW_POLICER_VALID, ds_dest_port_vlan_flow_policer_valid, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_PORT_VPLS_PORT_TYPE, ds_dest_port_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_EDIT_PRIORITY_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_CFI, epe_edit_priority_map_table_mapped_cfi, 1)
+        DRV_FIELD_SET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_COS, epe_edit_priority_map_table_mapped_cos, 3)
+        DRV_FIELD_SET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_DSCP, epe_edit_priority_map_table_mapped_dscp, 6)
+        DRV_FIELD_SET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_EXP, epe_edit_priority_map_table_mapped_exp, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_DEST_INTERFACE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_ACL_EN, ds_dest_interface_l3_acl_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_ACL_LABEL, ds_dest_interface_l3_acl_label, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_ACL_ROUTED_ONLY, ds_dest_interface_l3_acl_routed_only, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_QOS_LABEL, ds_dest_interface_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_QOS_LOOKUP_EN, ds_dest_interface_l3_qos_lookup_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_SPAN_EN, ds_dest_interface_l3_span_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_L3_SPAN_ID, ds_dest_interface_l3_span_id, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_MAC_SA, ds_dest_interface_mac_sa, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_MAC_SA_TYPE, ds_dest_interface_mac_sa_type, 2)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_MCAST_TTL_THRESHOLD, ds_dest_interface_mcast_ttl_threshold, 8)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_MTU_CHECK_EN, ds_dest_interface_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_MTU_EXCEPTION_EN, ds_dest_interface_mtu_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_DEST_INTERFACE_MTU_SIZE, ds_dest_interface_mtu_size, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VPLS_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_VPLS_PORT_VPLS_PORT_TYPE, ds_vpls_port_vpls_port_type, 32)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_NEXT_HOP_INTERNAL4W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_BY_PASS_ALL, epe_next_hop_internal4w_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_COPY_CTAG_COS, epe_next_hop_internal4w_copy_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_CVLAN_TAGGED, epe_next_hop_internal4w_cvlan_tagged, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_DERIVE_STAG_COS, epe_next_hop_internal4w_derive_stag_cos, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_DEST_VLAN_PTR, epe_next_hop_internal4w_dest_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_L2EDIT_PTR, epe_next_hop_internal4w_l2edit_ptr, 12)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_L2_REWRITE_TYPE, epe_next_hop_internal4w_l2_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_L3EDIT_PTR, epe_next_hop_internal4w_l3edit_ptr, 18)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_L3_REWRITE_TYPE, epe_next_hop_internal4w_l3_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_MTU_CHECK_EN, epe_next_hop_internal4w_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_OUTPUT_CVLAN_ID_VALID, epe_next_hop_internal4w_output_cvlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_OUTPUT_SVLAN_ID_VALID, epe_next_hop_internal4w_output_svlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_PAYLOAD_OPERATION, epe_next_hop_internal4w_payload_operation, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_REPLACE_CTAG_COS, epe_next_hop_internal4w_replace_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_REPLACE_DSCP, epe_next_hop_internal4w_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_SERVICE_ACL_QOS_EN, epe_next_hop_internal4w_service_acl_qos_en, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_SERVICE_POLICER_VLD, epe_next_hop_internal4w_service_policer_vld, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_STAG_CFI, epe_next_hop_internal4w_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_STAG_COS, epe_next_hop_internal4w_stag_cos, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_SVLAN_TAGGED, epe_next_hop_internal4w_svlan_tagged, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL4W_TAGGED_MODE, epe_next_hop_internal4w_tagged_mode, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_NEXT_HOP_INTERNAL8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_BY_PASS_ALL, epe_next_hop_internal8w_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_COMMUNITY_PORT, epe_next_hop_internal8w_community_port, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_COPY_CTAG_COS, epe_next_hop_internal8w_copy_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_CVLAN_TAGGED, epe_next_hop_internal8w_cvlan_tagged, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_DERIVE_STAG_COS, epe_next_hop_internal8w_derive_stag_cos, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_DEST_VLAN_PTR, epe_next_hop_internal8w_dest_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L2EDIT_PTR12TO0, epe_next_hop_internal8w_l2edit_ptr12to0, 12)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L2EDIT_PTR19TO13, epe_next_hop_internal8w_l2edit_ptr19to13, 7)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L2_REWRITE_TYPE, epe_next_hop_internal8w_l2_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3EDIT_PTR18, epe_next_hop_internal8w_l3edit_ptr18, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3EDIT_PTR19, epe_next_hop_internal8w_l3edit_ptr19, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3EDIT_PTR170, epe_next_hop_internal8w_l3edit_ptr170, 18)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3_REWRITE_TYPE, epe_next_hop_internal8w_l3_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_MTU_CHECK_EN, epe_next_hop_internal8w_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_CVLAN_ID_EXT, epe_next_hop_internal8w_output_cvlan_id_ext, 12)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_CVLAN_ID_VALID, epe_next_hop_internal8w_output_cvlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_CVLAN_ID_VALID_EXT, epe_next_hop_internal8w_output_cvlan_id_valid_ext, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_SVLAN_ID_EXT, epe_next_hop_internal8w_output_svlan_id_ext, 12)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_SVLAN_ID_VALID, epe_next_hop_internal8w_output_svlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_SVLAN_ID_VALID_EXT, epe_next_hop_internal8w_output_svlan_id_valid_ext, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_PAYLOAD_OPERATION, epe_next_hop_internal8w_payload_operation, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_REPLACE_CTAG_COS, epe_next_hop_internal8w_replace_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_REPLACE_DSCP, epe_next_hop_internal8w_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_ACL_QOS_EN, epe_next_hop_internal8w_service_acl_qos_en, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_ID, epe_next_hop_internal8w_service_id, 14)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_ID_EN, epe_next_hop_internal8w_service_id_en, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_POLICER_VALID, epe_next_hop_internal8w_service_policer_valid, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_STAG_CFI, epe_next_hop_internal8w_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_STAG_COS, epe_next_hop_internal8w_stag_cos, 3)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SVLAN_TAGGED, epe_next_hop_internal8w_svlan_tagged, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SVLAN_TPID, epe_next_hop_internal8w_svlan_tpid, 2)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_SVLAN_TPID_EN, epe_next_hop_internal8w_svlan_tpid_en, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_TAGGED_MODE, epe_next_hop_internal8w_tagged_mode, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_TUNNEL_MTU_CHECK, epe_next_hop_internal8w_tunnel_mtu_check, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_TUNNEL_UPDATE_DISABLE, epe_next_hop_internal8w_tunnel_update_disable, 1)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_VPLS_DEST_PORT, epe_next_hop_internal8w_vpls_dest_port, 13)
+        DRV_FIELD_SET_CASE(EPE_NEXT_HOP_INTERNAL8W_VPLS_PORT_CHECK, epe_next_hop_internal8w_vpls_port_check, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_STATSRAMEPEPHBINTF:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_BYTE_COUNT31_TO0_EPE_PHB_INTF, epe_statsramepephbintf_byte_count31_to0_epe_phb_intf, 32)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_BYTE_COUNT34_TO32_EPE_PHB_INTF, epe_statsramepephbintf_byte_count34_to32_epe_phb_intf, 3)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_BYTE_COUNT36_TO35_EPE_PHB_INTF, epe_statsramepephbintf_byte_count36_to35_epe_phb_intf, 2)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_PACKET_COUNT31_TO0_EPE_PHB_INTF, epe_statsramepephbintf_packet_count31_to0_epe_phb_intf, 32)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_PARITY0_EPE_PHB_INTF, epe_statsramepephbintf_parity0_epe_phb_intf, 1)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_PARITY1_EPE_PHB_INTF, epe_statsramepephbintf_parity1_epe_phb_intf, 1)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPHBINTF_USE_L3_LENGTH_EPE_PHB_INTF, epe_statsramepephbintf_use_l3_length_epe_phb_intf, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_STATSRAMEPEPORTLOG:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_BYTE_COUNT31_TO0_EPE_PORT_LOG, epe_statsramepeportlog_byte_count31_to0_epe_port_log, 32)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_BYTE_COUNT34_TO32_EPE_PORT_LOG, epe_statsramepeportlog_byte_count34_to32_epe_port_log, 3)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_BYTE_COUNT36_TO35_EPE_PORT_LOG, epe_statsramepeportlog_byte_count36_to35_epe_port_log, 2)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_PACKET_COUNT31_TO0_EPE_PORT_LOG, epe_statsramepeportlog_packet_count31_to0_epe_port_log, 32)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_PARITY0_EPE_PORT_LOG, epe_statsramepeportlog_parity0_epe_port_log, 1)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_PARITY1_EPE_PORT_LOG, epe_statsramepeportlog_parity1_epe_port_log, 1)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEPORTLOG_USE_L3_LENGTH_EPE_PORT_LOG, epe_statsramepeportlog_use_l3_length_epe_port_log, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_STATSRAMEPEOVERALLFWD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_BYTE_COUNT31_TO0_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_byte_count31_to0_epe_overall_fwd, 32)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_BYTE_COUNT34_TO32_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_byte_count34_to32_epe_overall_fwd, 3)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_BYTE_COUNT36_TO35_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_byte_count36_to35_epe_overall_fwd, 2)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_PACKET_COUNT31_TO0_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_packet_count31_to0_epe_overall_fwd, 32)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_PARITY0_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_parity0_epe_overall_fwd, 1)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_PARITY1_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_parity1_epe_overall_fwd, 1)
+        DRV_FIELD_SET_CASE(EPE_STATSRAMEPEOVERALLFWD_USE_L3_LENGTH_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_use_l3_length_epe_overall_fwd, 1)
+        default:
+            break;
+        }
+        break;
+
+    case FABRIC_CAS_INFO_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRIC_CAS_INFO_RAM_INFO_DATA, fabric_cas_info_ram_info_data, 27)
+        default:
+            break;
+        }
+        break;
+
+    case FABRIC_CAS_DATA_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA0, fabric_cas_data_ram_data0, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA1, fabric_cas_data_ram_data1, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA2, fabric_cas_data_ram_data2, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA3, fabric_cas_data_ram_data3, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA4, fabric_cas_data_ram_data4, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA5, fabric_cas_data_ram_data5, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA6, fabric_cas_data_ram_data6, 32)
+        DRV_FIELD_SET_CASE(FABRIC_CAS_DATA_RAM_DATA7, fabric_cas_data_ram_data7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLBU_F0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_PARITY, fabriccrbcellbu_f0_parity, 8)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD0, fabriccrbcellbu_f0_word0, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD1, fabriccrbcellbu_f0_word1, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD2, fabriccrbcellbu_f0_word2, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD3, fabriccrbcellbu_f0_word3, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD4, fabriccrbcellbu_f0_word4, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD5, fabriccrbcellbu_f0_word5, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD6, fabriccrbcellbu_f0_word6, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F0_WORD7, fabriccrbcellbu_f0_word7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLBU_F1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_PARITY, fabriccrbcellbu_f1_parity, 8)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD0, fabriccrbcellbu_f1_word0, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD1, fabriccrbcellbu_f1_word1, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD2, fabriccrbcellbu_f1_word2, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD3, fabriccrbcellbu_f1_word3, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD4, fabriccrbcellbu_f1_word4, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD5, fabriccrbcellbu_f1_word5, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD6, fabriccrbcellbu_f1_word6, 32)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLBU_F1_WORD7, fabriccrbcellbu_f1_word7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBVALIDTABL_E0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBVALIDTABL_E0_VALID, fabriccrbvalidtabl_e0_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBVALIDTABL_E1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBVALIDTABL_E1_VALID, fabriccrbvalidtabl_e1_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBPTRTABL_E0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBPTRTABL_E0_ADDR_PTR, fabriccrbptrtabl_e0_addr_ptr, 4)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBPTRTABL_E1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBPTRTABL_E1_ADDR_PTR, fabriccrbptrtabl_e1_addr_ptr, 4)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLINFOBU_F0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F0_CELL_INFOR, fabriccrbcellinfobu_f0_cell_infor, 14)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F0_IDLE_CELL, fabriccrbcellinfobu_f0_idle_cell, 1)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F0_PRIORITY, fabriccrbcellinfobu_f0_priority, 2)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F0_SEQ_NUM, fabriccrbcellinfobu_f0_seq_num, 2)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F0_SRC_CHIP_ID, fabriccrbcellinfobu_f0_src_chip_id, 5)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLINFOBU_F1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F1_CELL_INFOR, fabriccrbcellinfobu_f1_cell_infor, 14)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F1_IDLE_CELL, fabriccrbcellinfobu_f1_idle_cell, 1)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F1_PRIORITY, fabriccrbcellinfobu_f1_priority, 2)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F1_SEQ_NUM, fabriccrbcellinfobu_f1_seq_num, 2)
+        DRV_FIELD_SET_CASE(FABRICCRBCELLINFOBU_F1_SRC_CHIP_ID, fabriccrbcellinfobu_f1_src_chip_id, 5)
+        default:
+            break;
+        }
+        break;
+
+    case FABRIC_GTS_RTS_TRACK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRIC_GTS_RTS_TRACK_RAM_DATA, fabric_gts_rts_track_ram_data, 16)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICRTSCOUNTER:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FABRICRTSCOUNTER_COUNT, fabricrtscounter_count, 11)
+        default:
+            break;
+        }
+        break;
+
+    case CHANINFOTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CHANINFOTABLE_CHAN_CELL_COUNT, chaninfotable_chan_cell_count, 9)
+        DRV_FIELD_SET_CASE(CHANINFOTABLE_CHAN_CELL_HEAD, chaninfotable_chan_cell_head, 9)
+        DRV_FIELD_SET_CASE(CHANINFOTABLE_CHAN_CELL_TAIL, chaninfotable_chan_cell_tail, 9)
+        DRV_FIELD_SET_CASE(CHANINFOTABLE_TAIL_CELL_WRITE_OFFSET, chaninfotable_tail_cell_write_offset, 3)
+        DRV_FIELD_SET_CASE(CHANINFOTABLE_TWO_FRAG, chaninfotable_two_frag, 1)
+        default:
+            break;
+        }
+        break;
+
+    case CELLINFOTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_FIRST_FRAG_EOP, cellinfotable_first_frag_eop, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_FIRST_FRAG_ERROR, cellinfotable_first_frag_error, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_FIRST_FRAG_FULL, cellinfotable_first_frag_full, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_FIRST_FRAG_LENGTH, cellinfotable_first_frag_length, 3)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_FIRST_FRAG_SOP, cellinfotable_first_frag_sop, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_SECOND_FRAG_EOP, cellinfotable_second_frag_eop, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_SECOND_FRAG_ERROR, cellinfotable_second_frag_error, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_SECOND_FRAG_FULL, cellinfotable_second_frag_full, 1)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_SECOND_FRAG_LENGTH, cellinfotable_second_frag_length, 3)
+        DRV_FIELD_SET_CASE(CELLINFOTABLE_SECOND_FRAG_SOP, cellinfotable_second_frag_sop, 1)
+        default:
+            break;
+        }
+        break;
+
+    case CELLTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CELLTABLE_CELL_PTR, celltable_cell_ptr, 9)
+        default:
+            break;
+        }
+        break;
+
+    case HASH_DS_CTL_HASH_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(HASH_DS_CTL_HASH_TABLE_DATA31_TO0, hash_ds_ctl_hash_table_data31_to0, 32)
+        DRV_FIELD_SET_CASE(HASH_DS_CTL_HASH_TABLE_DATA34_TO32, hash_ds_ctl_hash_table_data34_to32, 3)
+        DRV_FIELD_SET_CASE(HASH_DS_CTL_HASH_TABLE_DATA66_TO35, hash_ds_ctl_hash_table_data66_to35, 32)
+        DRV_FIELD_SET_CASE(HASH_DS_CTL_HASH_TABLE_DATA69_TO67, hash_ds_ctl_hash_table_data69_to67, 3)
+        DRV_FIELD_SET_CASE(HASH_DS_CTL_HASH_TABLE_PARITY0, hash_ds_ctl_hash_table_parity0, 1)
+        DRV_FIELD_SET_CASE(HASH_DS_CTL_HASH_TABLE_PARITY1, hash_ds_ctl_hash_table_parity1, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_AGING_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_AGING_RAM_AGING_STATUS, ipe_aging_ram_aging_status, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FWDEXTTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(FWDEXTTABLE_APS_GROUP_ID, fwdexttable_aps_group_id, 16)
+        DRV_FIELD_SET_CASE(FWDEXTTABLE_STATS_PTR, fwdexttable_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case APSBRIDGETABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(APSBRIDGETABLE_PROTECTING_DEST_MAP, apsbridgetable_protecting_dest_map, 22)
+        DRV_FIELD_SET_CASE(APSBRIDGETABLE_PROTECTING_EN, apsbridgetable_protecting_en, 1)
+        DRV_FIELD_SET_CASE(APSBRIDGETABLE_WORKING_DEST_MAP, apsbridgetable_working_dest_map, 16)
+        default:
+            break;
+        }
+        break;
+
+    case SEQUENCENUMBERTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SEQUENCENUMBERTABLE_SEQUENCE_NUMBER, sequencenumbertable_sequence_number, 32)
+        default:
+            break;
+        }
+        break;
+
+    case APSSELECTTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN0, apsselecttable_protecting_en0, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN1, apsselecttable_protecting_en1, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN2, apsselecttable_protecting_en2, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN3, apsselecttable_protecting_en3, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN4, apsselecttable_protecting_en4, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN5, apsselecttable_protecting_en5, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN6, apsselecttable_protecting_en6, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN7, apsselecttable_protecting_en7, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN8, apsselecttable_protecting_en8, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN9, apsselecttable_protecting_en9, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN10, apsselecttable_protecting_en10, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN11, apsselecttable_protecting_en11, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN12, apsselecttable_protecting_en12, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN13, apsselecttable_protecting_en13, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN14, apsselecttable_protecting_en14, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN15, apsselecttable_protecting_en15, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN16, apsselecttable_protecting_en16, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN17, apsselecttable_protecting_en17, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN18, apsselecttable_protecting_en18, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN19, apsselecttable_protecting_en19, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN20, apsselecttable_protecting_en20, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN21, apsselecttable_protecting_en21, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN22, apsselecttable_protecting_en22, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN23, apsselecttable_protecting_en23, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN24, apsselecttable_protecting_en24, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN25, apsselecttable_protecting_en25, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN26, apsselecttable_protecting_en26, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN27, apsselecttable_protecting_en27, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN28, apsselecttable_protecting_en28, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN29, apsselecttable_protecting_en29, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN30, apsselecttable_protecting_en30, 1)
+        DRV_FIELD_SET_CASE(APSSELECTTABLE_PROTECTING_EN31, apsselecttable_protecting_en31, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DISCARDCOUNT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DISCARDCOUNT_COUNTER, discardcount_counter, 8)
+        default:
+            break;
+        }
+        break;
+
+    case PHY_PORT_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(PHY_PORT_MAP_TABLE_LOCAL_PHY_PORT, phy_port_map_table_local_phy_port, 6)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC_TC_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_COLOR0, sgmac_tc_map_table_color0, 2)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_COLOR1, sgmac_tc_map_table_color1, 2)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_COLOR2, sgmac_tc_map_table_color2, 2)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_COLOR3, sgmac_tc_map_table_color3, 2)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY0, sgmac_tc_map_table_priority0, 6)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY1, sgmac_tc_map_table_priority1, 6)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY2, sgmac_tc_map_table_priority2, 6)
+        DRV_FIELD_SET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY3, sgmac_tc_map_table_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PHY_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_KEEP_VLAN_TAG, ds_phy_port_keep_vlan_tag, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_L2_SPAN_EN, ds_phy_port_l2_span_en, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_L2_SPAN_ID, ds_phy_port_l2_span_id, 2)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_OUTER_VLAN_IS_CVLAN, ds_phy_port_outer_vlan_is_cvlan, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_PACKET_TYPE, ds_phy_port_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_PACKET_TYPE_VALID, ds_phy_port_packet_type_valid, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_PBB_PORT_TYPE, ds_phy_port_pbb_port_type, 3)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_PTP_EN, ds_phy_port_ptp_en, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_RANDOM_LOG_EN, ds_phy_port_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_RANDOM_THRESHOLD, ds_phy_port_random_threshold, 15)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_SRC_DISCARD, ds_phy_port_src_discard, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_SVLAN_TPID_INDEX, ds_phy_port_svlan_tpid_index, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PROTOCOL_VLAN:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_PROTOCOL_VLAN_CPU_EXCEPTION_EN, ds_protocol_vlan_cpu_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_PROTOCOL_VLAN_DISCARD, ds_protocol_vlan_discard, 1)
+        DRV_FIELD_SET_CASE(DS_PROTOCOL_VLAN_PROTOCOL_VLAN_ID, ds_protocol_vlan_protocol_vlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_PROTOCOL_VLAN_PROTOCOL_VLAN_ID_VALID, ds_protocol_vlan_protocol_vlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_PROTOCOL_VLAN_REPLACE_TAG_EN, ds_protocol_vlan_replace_tag_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ROUTER_MAC:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC0_BYTE, ds_router_mac_router_mac0_byte, 8)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC0_TYPE, ds_router_mac_router_mac0_type, 2)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC1_BYTE, ds_router_mac_router_mac1_byte, 8)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC1_TYPE, ds_router_mac_router_mac1_type, 2)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC2_BYTE, ds_router_mac_router_mac2_byte, 8)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC2_TYPE, ds_router_mac_router_mac2_type, 2)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC3_BYTE, ds_router_mac_router_mac3_byte, 8)
+        DRV_FIELD_SET_CASE(DS_ROUTER_MAC_ROUTER_MAC3_TYPE, ds_router_mac_router_mac3_type, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VRF:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_VRF_PFM0, ds_vrf_pfm0, 2)
+        DRV_FIELD_SET_CASE(DS_VRF_PFM1, ds_vrf_pfm1, 2)
+        DRV_FIELD_SET_CASE(DS_VRF_PFM2, ds_vrf_pfm2, 2)
+        DRV_FIELD_SET_CASE(DS_VRF_PFM3, ds_vrf_pfm3, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SRC_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_ALLOW_MCAST_MAC_SA, ds_src_port_allow_mcast_mac_sa, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_BRIDGE_EN, ds_src_port_bridge_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_DEFAULT_REPLACE_TAG_EN, ds_src_port_default_replace_tag_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_EQUAL_COS_PATH_NUM, ds_src_port_equal_cos_path_num, 3)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_ETHER_OAM_VALID, ds_src_port_ether_oam_valid, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_FORCE_ACL_QOS_IPV4_TO_MAC_KEY, ds_src_port_force_acl_qos_ipv4_to_mac_key, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_FORCE_ACL_QOS_IPV6_TO_MAC_KEY, ds_src_port_force_acl_qos_ipv6_to_mac_key, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_INGRESS_FILTERING_EN, ds_src_port_ingress_filtering_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_IPG_INDEX, ds_src_port_ipg_index, 2)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_L2_ACL_EN, ds_src_port_l2_acl_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_L2_ACL_HIGH_PRIORITY, ds_src_port_l2_acl_high_priority, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_L2_ACL_LABEL, ds_src_port_l2_acl_label, 8)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_L2_QOS_HIGH_PRIORITY, ds_src_port_l2_qos_high_priority, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_L2_QOS_LABEL, ds_src_port_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_L2_QOS_LOOKUP_EN, ds_src_port_l2_qos_lookup_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_LEARNING_DISABLE, ds_src_port_learning_disable, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_MAC_SECURITY_DISCARD, ds_src_port_mac_security_discard, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_MD_LEVEL, ds_src_port_md_level, 3)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_OAM_LINK_MAX_MD_LEVEL, ds_src_port_oam_link_max_md_level, 3)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_OAM_TUNNEL_EN, ds_src_port_oam_tunnel_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PIP_MAC_SA, ds_src_port_pip_mac_sa, 8)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PORT_CHECK_EN, ds_src_port_port_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PORT_CROSS_CONNECT, ds_src_port_port_cross_connect, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PORT_POLICER_VALID, ds_src_port_port_policer_valid, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PORT_SECURITY_EN, ds_src_port_port_security_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PORT_SECURITY_EXCEPTION_EN, ds_src_port_port_security_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PRIORITY_PATH_EN, ds_src_port_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_PROTOCOL_VLAN_EN, ds_src_port_protocol_vlan_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_QOS_DOMAIN, ds_src_port_qos_domain, 3)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_QOS_POLICY, ds_src_port_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_RECEIVE_EN, ds_src_port_receive_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_ROUTED_PORT, ds_src_port_routed_port, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_ROUTED_PORT_VLAN_PTR, ds_src_port_routed_port_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_ROUTE_DISABLE, ds_src_port_route_disable, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_SOURCE_PORT_ISOLATED, ds_src_port_source_port_isolated, 6)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_USE_BTAG_COS, ds_src_port_use_btag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_USE_OUTER_TTL, ds_src_port_use_outer_ttl, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_USE_STAG_COS, ds_src_port_use_stag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_VLAN_FLOW_POLICER_VALID, ds_src_port_vlan_flow_policer_valid, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_VLAN_TAG_CTL, ds_src_port_vlan_tag_ctl, 4)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_VPLS_PORT_TYPE, ds_src_port_vpls_port_type, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_PORT_VPLS_SRC_PORT, ds_src_port_vpls_src_port, 13)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PHY_PORT_EXT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_DEFAULT_DEI, ds_phy_port_ext_default_dei, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_DEFAULT_PCP, ds_phy_port_ext_default_pcp, 3)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_DEFAULT_VLAN_ID, ds_phy_port_ext_default_vlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_DISABLE_USER_ID_IPV4, ds_phy_port_ext_disable_user_id_ipv4, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_DISABLE_USER_ID_IPV6, ds_phy_port_ext_disable_user_id_ipv6, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_EGRESS_USER_ID_EN, ds_phy_port_ext_egress_user_id_en, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_EGRESS_USER_ID_TYPE, ds_phy_port_ext_egress_user_id_type, 2)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_EXCEPTION2_DISCARD, ds_phy_port_ext_exception2_discard, 16)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_EXCEPTION2_EN, ds_phy_port_ext_exception2_en, 16)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_FORCE_USER_ID_IPV4_TO_MAC_KEY, ds_phy_port_ext_force_user_id_ipv4_to_mac_key, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_FORCE_USER_ID_IPV6_TO_MAC_KEY, ds_phy_port_ext_force_user_id_ipv6_to_mac_key, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_GLOBAL_SRC_PORT, ds_phy_port_ext_global_src_port, 13)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_OAM_OBEY_USER_ID, ds_phy_port_ext_oam_obey_user_id, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_SRC_OUTER_VLAN_IS_SVLAN, ds_phy_port_ext_src_outer_vlan_is_svlan, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_SVLAN_KEY_FIRST, ds_phy_port_ext_svlan_key_first, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_USER_ID_EN, ds_phy_port_ext_user_id_en, 1)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_USER_ID_LABEL, ds_phy_port_ext_user_id_label, 6)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_USER_ID_TYPE, ds_phy_port_ext_user_id_type, 2)
+        DRV_FIELD_SET_CASE(DS_PHY_PORT_EXT_USE_DEFAULT_VLAN_LOOKUP, ds_phy_port_ext_use_default_vlan_lookup, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SRC_INTERFACE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_EXCEPTION3_EN, ds_src_interface_exception3_en, 16)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_ACL_EN, ds_src_interface_l3_acl_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_ACL_LABEL, ds_src_interface_l3_acl_label, 8)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_ACL_ROUTED_ONLY, ds_src_interface_l3_acl_routed_only, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_IF_TYPE, ds_src_interface_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_QOS_LABEL, ds_src_interface_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_QOS_LOOKUP_EN, ds_src_interface_l3_qos_lookup_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_SPAN_EN, ds_src_interface_l3_span_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_L3_SPAN_ID, ds_src_interface_l3_span_id, 2)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_LOOKUP_MODE, ds_src_interface_lookup_mode, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_MPLS_EN, ds_src_interface_mpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_MPLS_LABEL_SPACE, ds_src_interface_mpls_label_space, 8)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_PBR_LABEL, ds_src_interface_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_ROUTER_MAC_LABEL, ds_src_interface_router_mac_label, 6)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_ROUTER_MAC_TYPE, ds_src_interface_router_mac_type, 2)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_ROUTE_ALL_PACKETS, ds_src_interface_route_all_packets, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_V4_MCAST_RPF_EN, ds_src_interface_v4_mcast_rpf_en, 1)
+        DRV_FIELD_SET_CASE(DS_SRC_INTERFACE_V6_MCAST_RPF_EN, ds_src_interface_v6_mcast_rpf_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_INTERFACE_LABEL_VALID, ds_mpls_ctl_interface_label_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_INTERFACE_LABEL_VALID_MCAST, ds_mpls_ctl_interface_label_valid_mcast, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_LABEL_BASE, ds_mpls_ctl_label_base, 12)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_LABEL_BASE_MCAST, ds_mpls_ctl_label_base_mcast, 12)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_LABEL_SPACE_SIZETYPE, ds_mpls_ctl_label_space_sizetype, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_LABEL_SPACE_SIZETYPE_MCAST, ds_mpls_ctl_label_space_sizetype_mcast, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_NUM_OF_LABEL, ds_mpls_ctl_num_of_label, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_CTL_NUM_OF_LABEL_MCAST, ds_mpls_ctl_num_of_label_mcast, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_BIDI_PIM_GROUP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_BIDI_PIM_GROUP_TABLE_BIDI_PIM_BLOCK, ds_bidi_pim_group_table_bidi_pim_block, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_STORM_CTL_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_STORM_CTL_TABLE_EXCEPTION_EN, ds_storm_ctl_table_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_STORM_CTL_TABLE_RUNNING_COUNT, ds_storm_ctl_table_running_count, 32)
+        DRV_FIELD_SET_CASE(DS_STORM_CTL_TABLE_STORM_EN, ds_storm_ctl_table_storm_en, 1)
+        DRV_FIELD_SET_CASE(DS_STORM_CTL_TABLE_THRESHOLD, ds_storm_ctl_table_threshold, 32)
+        DRV_FIELD_SET_CASE(DS_STORM_CTL_TABLE_USE_PACKET_COUNT, ds_storm_ctl_table_use_packet_count, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_DS_PBB_MAC_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_DS_PBB_MAC_TABLE_BMAC_SA_BIT31_TO0, ipe_ds_pbb_mac_table_bmac_sa_bit31_to0, 32)
+        DRV_FIELD_SET_CASE(IPE_DS_PBB_MAC_TABLE_BMAC_SA_BIT47_TO32, ipe_ds_pbb_mac_table_bmac_sa_bit47_to32, 16)
+        DRV_FIELD_SET_CASE(IPE_DS_PBB_MAC_TABLE_GLOBAL_SRC_PORT, ipe_ds_pbb_mac_table_global_src_port, 13)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_LEARNING_CACHE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_CMAC_SA_LSB, ipe_learning_cache_cmac_sa_lsb, 32)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_CMAC_SA_MSB, ipe_learning_cache_cmac_sa_msb, 16)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_CVLAN_ID, ipe_learning_cache_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_ETHER_OAM_MD_LEVEL, ipe_learning_cache_ether_oam_md_level, 3)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_GLOBAL_SRC_PORT, ipe_learning_cache_global_src_port, 13)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_IS_ETHER_OAM, ipe_learning_cache_is_ether_oam, 1)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_IS_VPLS_SRC_PORT, ipe_learning_cache_is_vpls_src_port, 1)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_MAC_SA_LSB, ipe_learning_cache_mac_sa_lsb, 32)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_MAC_SA_MSB, ipe_learning_cache_mac_sa_msb, 16)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_MAPPED_VLAN_ID, ipe_learning_cache_mapped_vlan_id, 16)
+        DRV_FIELD_SET_CASE(IPE_LEARNING_CACHE_SVLAN_ID, ipe_learning_cache_svlan_id, 12)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_CLASSIFICATION_DSCP_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR0, ipe_classification_dscp_map_table_dscp_color0, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR1, ipe_classification_dscp_map_table_dscp_color1, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR2, ipe_classification_dscp_map_table_dscp_color2, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR3, ipe_classification_dscp_map_table_dscp_color3, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY0, ipe_classification_dscp_map_table_dscp_priority0, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY1, ipe_classification_dscp_map_table_dscp_priority1, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY2, ipe_classification_dscp_map_table_dscp_priority2, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY3, ipe_classification_dscp_map_table_dscp_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_CLASSIFICATION_COS_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR0, ipe_classification_cos_map_table_cos_color0, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR1, ipe_classification_cos_map_table_cos_color1, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR2, ipe_classification_cos_map_table_cos_color2, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR3, ipe_classification_cos_map_table_cos_color3, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY0, ipe_classification_cos_map_table_cos_priority0, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY1, ipe_classification_cos_map_table_cos_priority1, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY2, ipe_classification_cos_map_table_cos_priority2, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY3, ipe_classification_cos_map_table_cos_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR0, ipe_classification_precedence_map_table_pre_color0, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR1, ipe_classification_precedence_map_table_pre_color1, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR2, ipe_classification_precedence_map_table_pre_color2, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR3, ipe_classification_precedence_map_table_pre_color3, 2)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY0, ipe_classification_precedence_map_table_pre_priority0, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY1, ipe_classification_precedence_map_table_pre_priority1, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY2, ipe_classification_precedence_map_table_pre_priority2, 6)
+        DRV_FIELD_SET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY3, ipe_classification_precedence_map_table_pre_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_MPLS_EXP_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR0, ipe_mpls_exp_map_table_mpls_color0, 2)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR1, ipe_mpls_exp_map_table_mpls_color1, 2)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR2, ipe_mpls_exp_map_table_mpls_color2, 2)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR3, ipe_mpls_exp_map_table_mpls_color3, 2)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY0, ipe_mpls_exp_map_table_mpls_priority0, 6)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY1, ipe_mpls_exp_map_table_mpls_priority1, 6)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY2, ipe_mpls_exp_map_table_mpls_priority2, 6)
+        DRV_FIELD_SET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY3, ipe_mpls_exp_map_table_mpls_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_STATSRAMIPEPHBINTF:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_BYTE_COUNT31_TO0_IPE_PHB_INTF, ipe_statsramipephbintf_byte_count31_to0_ipe_phb_intf, 32)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_BYTE_COUNT34_TO32_IPE_PHB_INTF, ipe_statsramipephbintf_byte_count34_to32_ipe_phb_intf, 3)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_BYTE_COUNT36_TO35_IPE_PHB_INTF, ipe_statsramipephbintf_byte_count36_to35_ipe_phb_intf, 2)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_PACKET_COUNT31_TO0_IPE_PHB_INTF, ipe_statsramipephbintf_packet_count31_to0_ipe_phb_intf, 32)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_PARITY0_IPE_PHB_INTF, ipe_statsramipephbintf_parity0_ipe_phb_intf, 1)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_PARITY1_IPE_PHB_INTF, ipe_statsramipephbintf_parity1_ipe_phb_intf, 1)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPHBINTF_USE_L3_LENGTH_IPE_PHB_INTF, ipe_statsramipephbintf_use_l3_length_ipe_phb_intf, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_STATSRAMIPEPORTLOG:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_BYTE_COUNT31_TO0_IPE_PORT_LOG, ipe_statsramipeportlog_byte_count31_to0_ipe_port_log, 32)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_BYTE_COUNT34_TO32_IPE_PORT_LOG, ipe_statsramipeportlog_byte_count34_to32_ipe_port_log, 3)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_BYTE_COUNT36_TO35_IPE_PORT_LOG, ipe_statsramipeportlog_byte_count36_to35_ipe_port_log, 2)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_PACKET_COUNT31_TO0_IPE_PORT_LOG, ipe_statsramipeportlog_packet_count31_to0_ipe_port_log, 32)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_PARITY0_IPE_PORT_LOG, ipe_statsramipeportlog_parity0_ipe_port_log, 1)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_PARITY1_IPE_PORT_LOG, ipe_statsramipeportlog_parity1_ipe_port_log, 1)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEPORTLOG_USE_L3_LENGTH_IPE_PORT_LOG, ipe_statsramipeportlog_use_l3_length_ipe_port_log, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_STATSRAMIPEOVERALLFWD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_BYTE_COUNT31_TO0_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_byte_count31_to0_ipe_overall_fwd, 32)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_BYTE_COUNT34_TO32_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_byte_count34_to32_ipe_overall_fwd, 3)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_BYTE_COUNT36_TO35_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_byte_count36_to35_ipe_overall_fwd, 2)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_PACKET_COUNT31_TO0_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_packet_count31_to0_ipe_overall_fwd, 32)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_PARITY0_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_parity0_ipe_overall_fwd, 1)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_PARITY1_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_parity1_ipe_overall_fwd, 1)
+        DRV_FIELD_SET_CASE(IPE_STATSRAMIPEOVERALLFWD_USE_L3_LENGTH_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_use_l3_length_ipe_overall_fwd, 1)
+        default:
+            break;
+        }
+        break;
+
+    case MET_FIFO_RCD_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(MET_FIFO_RCD_RAM_RCD, met_fifo_rcd_ram_rcd, 8)
+        default:
+            break;
+        }
+        break;
+
+    case MET_FIFO_MSG_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(MET_FIFO_MSG_RAM_DATA0, met_fifo_msg_ram_data0, 31)
+        DRV_FIELD_SET_CASE(MET_FIFO_MSG_RAM_DATA1, met_fifo_msg_ram_data1, 32)
+        DRV_FIELD_SET_CASE(MET_FIFO_MSG_RAM_DATA2, met_fifo_msg_ram_data2, 32)
+        DRV_FIELD_SET_CASE(MET_FIFO_MSG_RAM_DATA3, met_fifo_msg_ram_data3, 32)
+        DRV_FIELD_SET_CASE(MET_FIFO_MSG_RAM_DATA4, met_fifo_msg_ram_data4, 32)
+        DRV_FIELD_SET_CASE(MET_FIFO_MSG_RAM_DATA5, met_fifo_msg_ram_data5, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MET_FIFO_EXCP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MET_FIFO_EXCP_DEST_MAP, ds_met_fifo_excp_dest_map, 22)
+        DRV_FIELD_SET_CASE(DS_MET_FIFO_EXCP_EXCEPTION_SUB_INDEX_EN, ds_met_fifo_excp_exception_sub_index_en, 1)
+        DRV_FIELD_SET_CASE(DS_MET_FIFO_EXCP_LENGTH_ADJUST_TYPE, ds_met_fifo_excp_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(DS_MET_FIFO_EXCP_NEXT_HOP_EXT, ds_met_fifo_excp_next_hop_ext, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_APS_BRIDGE_MCAST:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_APS_BRIDGE_MCAST_PROTECTING_EN, ds_aps_bridge_mcast_protecting_en, 1)
+        DRV_FIELD_SET_CASE(DS_APS_BRIDGE_MCAST_PROTECTING_UCAST_ID, ds_aps_bridge_mcast_protecting_ucast_id, 12)
+        DRV_FIELD_SET_CASE(DS_APS_BRIDGE_MCAST_WORKING_UCAST_ID, ds_aps_bridge_mcast_working_ucast_id, 12)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGG_BLOCK_MASK:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_BLOCK_MASK_MASK_HI, ds_link_agg_block_mask_mask_hi, 32)
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_BLOCK_MASK_MASK_LO, ds_link_agg_block_mask_mask_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGG_BITMAP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_BITMAP_BLOCK_MASK_EN, ds_link_agg_bitmap_block_mask_en, 1)
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_BITMAP_MEMBER_HI, ds_link_agg_bitmap_member_hi, 32)
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_BITMAP_MEMBER_LO, ds_link_agg_bitmap_member_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case NET_RX_CHANNEL_INFO_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_BPDU_STATE, net_rx_channel_info_ram_channel_info_data_bpdu_state, 1)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_BUF_CNT, net_rx_channel_info_ram_channel_info_data_buf_cnt, 2)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_CURR_PTR, net_rx_channel_info_ram_channel_info_data_curr_ptr, 9)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_DATA_ERROR_SEEN, net_rx_channel_info_ram_channel_info_data_data_error_seen, 1)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_ENTRY_OFFSET, net_rx_channel_info_ram_channel_info_data_entry_offset, 1)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_HEAD_PTR, net_rx_channel_info_ram_channel_info_data_head_ptr, 9)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_NO_SOP_ERROR_SEEN, net_rx_channel_info_ram_channel_info_data_no_sop_error_seen, 1)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_PKT_LEN, net_rx_channel_info_ram_channel_info_data_pkt_len, 14)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_SOB_STATE, net_rx_channel_info_ram_channel_info_data_sob_state, 1)
+        DRV_FIELD_SET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_STATE, net_rx_channel_info_ram_channel_info_data_state, 1)
+        default:
+            break;
+        }
+        break;
+
+    case NET_RX_LINK_LIST_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(NET_RX_LINK_LIST_TABLE_LINK_LIST_TABLE_WORD, net_rx_link_list_table_link_list_table_word, 9)
+        default:
+            break;
+        }
+        break;
+
+    case NET_RX_PKT_BUF_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD0, net_rx_pkt_buf_ram_pkt_buf_word0, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD1, net_rx_pkt_buf_ram_pkt_buf_word1, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD2, net_rx_pkt_buf_ram_pkt_buf_word2, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD3, net_rx_pkt_buf_ram_pkt_buf_word3, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD4, net_rx_pkt_buf_ram_pkt_buf_word4, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD5, net_rx_pkt_buf_ram_pkt_buf_word5, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD6, net_rx_pkt_buf_ram_pkt_buf_word6, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD7, net_rx_pkt_buf_ram_pkt_buf_word7, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD8, net_rx_pkt_buf_ram_pkt_buf_word8, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD9, net_rx_pkt_buf_ram_pkt_buf_word9, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD10, net_rx_pkt_buf_ram_pkt_buf_word10, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD11, net_rx_pkt_buf_ram_pkt_buf_word11, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD12, net_rx_pkt_buf_ram_pkt_buf_word12, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD13, net_rx_pkt_buf_ram_pkt_buf_word13, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD14, net_rx_pkt_buf_ram_pkt_buf_word14, 32)
+        DRV_FIELD_SET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD15, net_rx_pkt_buf_ram_pkt_buf_word15, 32)
+        default:
+            break;
+        }
+        break;
+
+    case PKT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA0, pkt_mem_data0, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA1, pkt_mem_data1, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA2, pkt_mem_data2, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA3, pkt_mem_data3, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA4, pkt_mem_data4, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA5, pkt_mem_data5, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA6, pkt_mem_data6, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA7, pkt_mem_data7, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA8, pkt_mem_data8, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA9, pkt_mem_data9, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA10, pkt_mem_data10, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA11, pkt_mem_data11, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA12, pkt_mem_data12, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA13, pkt_mem_data13, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA14, pkt_mem_data14, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA15, pkt_mem_data15, 32)
+        DRV_FIELD_SET_CASE(PKT_MEM_DATA_INFO, pkt_mem_data_info, 13)
+        DRV_FIELD_SET_CASE(PKT_MEM_PKT_INFO, pkt_mem_pkt_info, 32)
+        default:
+            break;
+        }
+        break;
+
+    case CH_STATIC_INFO_REGS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CH_STATIC_INFO_REGS_END_PTR, ch_static_info_regs_end_ptr, 11)
+        DRV_FIELD_SET_CASE(CH_STATIC_INFO_REGS_FIFO_DEPTH, ch_static_info_regs_fifo_depth, 8)
+        DRV_FIELD_SET_CASE(CH_STATIC_INFO_REGS_START_PTR, ch_static_info_regs_start_ptr, 11)
+        DRV_FIELD_SET_CASE(CH_STATIC_INFO_REGS_THRESHOLD, ch_static_info_regs_threshold, 8)
+        default:
+            break;
+        }
+        break;
+
+    case CH_DYNAMIC_INFO_REGS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CH_DYNAMIC_INFO_REGS_DATA_UNIT_CNT, ch_dynamic_info_regs_data_unit_cnt, 8)
+        DRV_FIELD_SET_CASE(CH_DYNAMIC_INFO_REGS_LAST_PKT_UNIT_CNT, ch_dynamic_info_regs_last_pkt_unit_cnt, 8)
+        DRV_FIELD_SET_CASE(CH_DYNAMIC_INFO_REGS_RD_PTR, ch_dynamic_info_regs_rd_ptr, 11)
+        DRV_FIELD_SET_CASE(CH_DYNAMIC_INFO_REGS_RD_STATE, ch_dynamic_info_regs_rd_state, 1)
+        DRV_FIELD_SET_CASE(CH_DYNAMIC_INFO_REGS_WR_PTR, ch_dynamic_info_regs_wr_ptr, 11)
+        DRV_FIELD_SET_CASE(CH_DYNAMIC_INFO_REGS_WR_STATE, ch_dynamic_info_regs_wr_state, 1)
+        default:
+            break;
+        }
+        break;
+
+    case CALENDAR_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(CALENDAR_CTL_CAL_ENTRY, calendar_ctl_cal_entry, 6)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_OAM_EXCP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_DS_OAM_EXCP_NEXT_HOP_PTR, oam_ds_oam_excp_next_hop_ptr, 20)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MEP_CHAN_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA0, ds_mep_chan_table_data0, 4)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA1, ds_mep_chan_table_data1, 32)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA2, ds_mep_chan_table_data2, 4)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA3, ds_mep_chan_table_data3, 32)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA4, ds_mep_chan_table_data4, 4)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA5, ds_mep_chan_table_data5, 32)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA6, ds_mep_chan_table_data6, 4)
+        DRV_FIELD_SET_CASE(DS_MEP_CHAN_TABLE_DATA7, ds_mep_chan_table_data7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_MA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_DS_MA_APS_EN, oam_ds_ma_aps_en, 1)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_APS_SIGNAL_FAIL_LOCAL, oam_ds_ma_aps_signal_fail_local, 1)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_APS_SIGNAL_FAIL_REMOTE, oam_ds_ma_aps_signal_fail_remote, 1)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_CCM_INTERVAL, oam_ds_ma_ccm_interval, 3)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_DEFECT_PRIORITY, oam_ds_ma_defect_priority, 6)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_INTF_STATUS, oam_ds_ma_intf_status, 3)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_MA_ID_LEN, oam_ds_ma_ma_id_len, 6)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_MA_ID_TYPE, oam_ds_ma_ma_id_type, 2)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_MA_NAME_INDEX, oam_ds_ma_ma_name_index, 15)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_MD_LVL, oam_ds_ma_md_lvl, 3)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_NEXT_HOP_PTR, oam_ds_ma_next_hop_ptr, 20)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_OAM_TUNNEL_DISABLE, oam_ds_ma_oam_tunnel_disable, 1)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_PORT_STATUS, oam_ds_ma_port_status, 2)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_PRIORITY_INDEX, oam_ds_ma_priority_index, 3)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_TX_UNTAGGED_OAM, oam_ds_ma_tx_untagged_oam, 1)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_TX_WITH_INTF_STATUS, oam_ds_ma_tx_with_intf_status, 1)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_TX_WITH_PORT_STATUS, oam_ds_ma_tx_with_port_status, 1)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_MA_NAME:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_DS_MA_NAME_MA_ID_ICC_INDEX_HI, oam_ds_ma_name_ma_id_icc_index_hi, 3)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_NAME_MA_ID_ICC_INDEX_LO, oam_ds_ma_name_ma_id_icc_index_lo, 3)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_NAME_MA_ID_UMC0, oam_ds_ma_name_ma_id_umc0, 32)
+        DRV_FIELD_SET_CASE(OAM_DS_MA_NAME_MA_ID_UMC1, oam_ds_ma_name_ma_id_umc1, 32)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_ICC:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_DS_ICC_ICC_HI, oam_ds_icc_icc_hi, 16)
+        DRV_FIELD_SET_CASE(OAM_DS_ICC_ICC_LO, oam_ds_icc_icc_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_PORT_PROPERTY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_DS_PORT_PROPERTY_GLOBAL_SRC_PORT, oam_ds_port_property_global_src_port, 14)
+        DRV_FIELD_SET_CASE(OAM_DS_PORT_PROPERTY_MAC_SA_BYTE, oam_ds_port_property_mac_sa_byte, 8)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_DEFECT_PRIORITY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_DS_DEFECT_PRIORITY_DEFECT_PRIORITY, oam_ds_defect_priority_defect_priority, 6)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_ERR_CACHE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_DEFECT_PRIORITY_ERR_CACHE0, oam_err_cache_defect_priority_err_cache0, 6)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_DEFECT_SUB_TYPE_ERR_CACHE0, oam_err_cache_defect_sub_type_err_cache0, 3)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_DEFECT_TYPE_ERR_CACHE0, oam_err_cache_defect_type_err_cache0, 3)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_INTF_STATUS_VALID_ERR_CACHE0, oam_err_cache_intf_status_valid_err_cache0, 1)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_INTF_STATUS_VALUE_ERR_CACHE0, oam_err_cache_intf_status_value_err_cache0, 3)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_IS_MPLS_ERR_CACHE0, oam_err_cache_is_mpls_err_cache0, 1)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_MEP_INDEX_ERR_CACHE0, oam_err_cache_mep_index_err_cache0, 15)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_PORT_STATUS_VALID_ERR_CACHE0, oam_err_cache_port_status_valid_err_cache0, 1)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_PORT_STATUS_VALUE_ERR_CACHE0, oam_err_cache_port_status_value_err_cache0, 2)
+        DRV_FIELD_SET_CASE(OAM_ERR_CACHE_RMEP_INDEX_ERR_CACHE0, oam_err_cache_rmep_index_err_cache0, 15)
+        default:
+            break;
+        }
+        break;
+
+    case PKTBUF:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(PKTBUF_DATA0, pktbuf_data0, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA1, pktbuf_data1, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA2, pktbuf_data2, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA3, pktbuf_data3, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA4, pktbuf_data4, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA5, pktbuf_data5, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA6, pktbuf_data6, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA7, pktbuf_data7, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA8, pktbuf_data8, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA9, pktbuf_data9, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA10, pktbuf_data10, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA11, pktbuf_data11, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA12, pktbuf_data12, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA13, pktbuf_data13, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA14, pktbuf_data14, 32)
+        DRV_FIELD_SET_CASE(PKTBUF_DATA15, pktbuf_data15, 32)
+        default:
+            break;
+        }
+        break;
+
+    case INTPROFILERAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(INTPROFILERAM_DATA31_TO0, intprofileram_data31_to0, 32)
+        DRV_FIELD_SET_CASE(INTPROFILERAM_DATA35_TO32, intprofileram_data35_to32, 4)
+        DRV_FIELD_SET_CASE(INTPROFILERAM_DATA67_TO36, intprofileram_data67_to36, 32)
+        DRV_FIELD_SET_CASE(INTPROFILERAM_DATA71_TO68, intprofileram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case EXTPROFILERAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(EXTPROFILERAM_DATA31_TO0, extprofileram_data31_to0, 32)
+        DRV_FIELD_SET_CASE(EXTPROFILERAM_DATA35_TO32, extprofileram_data35_to32, 4)
+        DRV_FIELD_SET_CASE(EXTPROFILERAM_DATA67_TO36, extprofileram_data67_to36, 32)
+        DRV_FIELD_SET_CASE(EXTPROFILERAM_DATA71_TO68, extprofileram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case RAM_BIST_QDR:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_ACCESS_READ, ram_bist_qdr_ram_access_read, 1)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_ACCESS_VALID, ram_bist_qdr_ram_access_valid, 1)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_ACCESS_WRITE, ram_bist_qdr_ram_access_write, 1)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_DATA31_TO0, ram_bist_qdr_ram_data31_to0, 32)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_DATA35_TO32, ram_bist_qdr_ram_data35_to32, 4)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_DATA67_TO36, ram_bist_qdr_ram_data67_to36, 32)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_DATA71_TO68, ram_bist_qdr_ram_data71_to68, 4)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_READ_ADDRESS, ram_bist_qdr_ram_read_address, 20)
+        DRV_FIELD_SET_CASE(RAM_BIST_QDR_RAM_WRITE_ADDRESS, ram_bist_qdr_ram_write_address, 20)
+        default:
+            break;
+        }
+        break;
+
+    case RAM_QDR:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(RAM_QDR_RAM_DATA31_TO0, ram_qdr_ram_data31_to0, 32)
+        DRV_FIELD_SET_CASE(RAM_QDR_RAM_DATA35_TO32, ram_qdr_ram_data35_to32, 4)
+        DRV_FIELD_SET_CASE(RAM_QDR_RAM_DATA67_TO36, ram_qdr_ram_data67_to36, 32)
+        DRV_FIELD_SET_CASE(RAM_QDR_RAM_DATA71_TO68, ram_qdr_ram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_IPG_INDEX:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX0, ds_queue_ipg_index_ipg_index0, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX1, ds_queue_ipg_index_ipg_index1, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX2, ds_queue_ipg_index_ipg_index2, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX3, ds_queue_ipg_index_ipg_index3, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX4, ds_queue_ipg_index_ipg_index4, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX5, ds_queue_ipg_index_ipg_index5, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX6, ds_queue_ipg_index_ipg_index6, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX7, ds_queue_ipg_index_ipg_index7, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DEPTH:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_DEPTH_QUEUE_AVG_DEPTH, ds_queue_depth_queue_avg_depth, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DEPTH_QUEUE_INST_DEPTH, ds_queue_depth_queue_inst_depth, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGGREGATION:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_LINK_AGGREGATION_DEST_CHIP_ID, ds_link_aggregation_dest_chip_id, 5)
+        DRV_FIELD_SET_CASE(DS_LINK_AGGREGATION_DEST_QUEUE, ds_link_aggregation_dest_queue, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DROP_PROFILE_ID:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP0, ds_queue_drop_profile_id_force_random_drop0, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP1, ds_queue_drop_profile_id_force_random_drop1, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP2, ds_queue_drop_profile_id_force_random_drop2, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP3, ds_queue_drop_profile_id_force_random_drop3, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID0, ds_queue_drop_profile_id_prof_id0, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID1, ds_queue_drop_profile_id_prof_id1, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID2, ds_queue_drop_profile_id_prof_id2, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID3, ds_queue_drop_profile_id_prof_id3, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT0, ds_queue_drop_profile_id_que_depth_wt0, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT1, ds_queue_drop_profile_id_que_depth_wt1, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT2, ds_queue_drop_profile_id_que_depth_wt2, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT3, ds_queue_drop_profile_id_que_depth_wt3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DROP_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR0, ds_queue_drop_profile_factor0, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR1, ds_queue_drop_profile_factor1, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR2, ds_queue_drop_profile_factor2, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR3, ds_queue_drop_profile_factor3, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_DROP_MODE, ds_queue_drop_profile_wred_drop_mode, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD0, ds_queue_drop_profile_wred_max_thrd0, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD1, ds_queue_drop_profile_wred_max_thrd1, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD2, ds_queue_drop_profile_wred_max_thrd2, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD3, ds_queue_drop_profile_wred_max_thrd3, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD0, ds_queue_drop_profile_wred_min_thrd0, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD1, ds_queue_drop_profile_wred_min_thrd1, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD2, ds_queue_drop_profile_wred_min_thrd2, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD3, ds_queue_drop_profile_wred_min_thrd3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_NUM_GEN_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_CHIP_ID_BASE, ds_queue_num_gen_ctl_dest_chip_id_base, 5)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_CHIP_ID_MASK, ds_queue_num_gen_ctl_dest_chip_id_mask, 5)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_CHIP_ID_SHIFT, ds_queue_num_gen_ctl_dest_chip_id_shift, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_QUE_BASE, ds_queue_num_gen_ctl_dest_que_base, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_QUE_MASK, ds_queue_num_gen_ctl_dest_que_mask, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_QUE_SHIFT, ds_queue_num_gen_ctl_dest_que_shift, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_FLOW_ID_BASE, ds_queue_num_gen_ctl_flow_id_base, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_FLOW_ID_MASK, ds_queue_num_gen_ctl_flow_id_mask, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_FLOW_ID_SHIFT, ds_queue_num_gen_ctl_flow_id_shift, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_QUE_NUM_BASE, ds_queue_num_gen_ctl_que_num_base, 13)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_QUE_SEL_MASK, ds_queue_num_gen_ctl_que_sel_mask, 6)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_QUE_SEL_SHIFT, ds_queue_num_gen_ctl_que_sel_shift, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_SERVICE_QUE_EN, ds_queue_num_gen_ctl_service_que_en, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_SGMAC_BASE, ds_queue_num_gen_ctl_sgmac_base, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_SGMAC_MASK, ds_queue_num_gen_ctl_sgmac_mask, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_NUM_GEN_CTL_SGMAC_SHIFT, ds_queue_num_gen_ctl_sgmac_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGR_EGRESS_RESRC_THRESHOLD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI0_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri0_que_entry_thrd, 16)
+        DRV_FIELD_SET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI1_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri1_que_entry_thrd, 16)
+        DRV_FIELD_SET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI2_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri2_que_entry_thrd, 16)
+        DRV_FIELD_SET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI3_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri3_que_entry_thrd, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGR_EGRESS_RESRC_COUNT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DSQ_MGR_EGRESS_RESRC_COUNT_EGRESS_QUE_ENTRY_COUNT, dsq_mgr_egress_resrc_count_egress_que_entry_count, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGG_MEMBER_NUM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_MEMBER_NUM_HASH_MODE, ds_link_agg_member_num_hash_mode, 1)
+        DRV_FIELD_SET_CASE(DS_LINK_AGG_MEMBER_NUM_LINK_AGG_MEM_NUM, ds_link_agg_member_num_link_agg_mem_num, 5)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SGMAC_MAP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC0, ds_sgmac_map_sgmac0, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC1, ds_sgmac_map_sgmac1, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC2, ds_sgmac_map_sgmac2, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC3, ds_sgmac_map_sgmac3, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC4, ds_sgmac_map_sgmac4, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC5, ds_sgmac_map_sgmac5, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC6, ds_sgmac_map_sgmac6, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC7, ds_sgmac_map_sgmac7, 2)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE0, ds_sgmac_map_sgmac_override0, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE1, ds_sgmac_map_sgmac_override1, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE2, ds_sgmac_map_sgmac_override2, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE3, ds_sgmac_map_sgmac_override3, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE4, ds_sgmac_map_sgmac_override4, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE5, ds_sgmac_map_sgmac_override5, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE6, ds_sgmac_map_sgmac_override6, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE7, ds_sgmac_map_sgmac_override7, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE0, ds_sgmac_map_sgmac_trunk_grp_mode0, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE1, ds_sgmac_map_sgmac_trunk_grp_mode1, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE2, ds_sgmac_map_sgmac_trunk_grp_mode2, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE3, ds_sgmac_map_sgmac_trunk_grp_mode3, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE4, ds_sgmac_map_sgmac_trunk_grp_mode4, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE5, ds_sgmac_map_sgmac_trunk_grp_mode5, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE6, ds_sgmac_map_sgmac_trunk_grp_mode6, 1)
+        DRV_FIELD_SET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE7, ds_sgmac_map_sgmac_trunk_grp_mode7, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_HEAD_HASH_MOD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD3, ds_head_hash_mod_mod3, 2)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD5, ds_head_hash_mod_mod5, 3)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD6, ds_head_hash_mod_mod6, 3)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD7, ds_head_hash_mod_mod7, 3)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD9, ds_head_hash_mod_mod9, 4)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD10, ds_head_hash_mod_mod10, 4)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD11, ds_head_hash_mod_mod11, 4)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD12, ds_head_hash_mod_mod12, 4)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD13, ds_head_hash_mod_mod13, 4)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD14, ds_head_hash_mod_mod14, 4)
+        DRV_FIELD_SET_CASE(DS_HEAD_HASH_MOD_MOD15, ds_head_hash_mod_mod15, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SERVICE_QUEUE_HASH_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID0, ds_service_queue_hash_key_dest_id0, 10)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID1, ds_service_queue_hash_key_dest_id1, 10)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID2, ds_service_queue_hash_key_dest_id2, 10)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID3, ds_service_queue_hash_key_dest_id3, 10)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID0, ds_service_queue_hash_key_service_id0, 16)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID1, ds_service_queue_hash_key_service_id1, 16)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID2, ds_service_queue_hash_key_service_id2, 16)
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID3, ds_service_queue_hash_key_service_id3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SERVICE_QUEUE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_SERVICE_QUEUE_SERVICE_QUEUE_BASE_OFFSET, ds_service_queue_service_queue_base_offset, 12)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGRQ_HASH_CAM_HASH_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(Q_MGRQ_HASH_CAM_HASH_CTL_SERVICE_QUE_BASE_OFFSET, q_mgrq_hash_cam_hash_ctl_service_que_base_offset, 12)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGRQ_LINK_LIST:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_LIST_NEXT_PTR, dsq_mgrq_link_list_next_ptr, 15)
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_LIST_PKT_LENGTH, dsq_mgrq_link_list_pkt_length, 14)
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_LIST_REP_COUNT, dsq_mgrq_link_list_rep_count, 12)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGRQ_LINK_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_STATE_HEAD_PTR, dsq_mgrq_link_state_head_ptr, 15)
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_STATE_PKT_LENGTH, dsq_mgrq_link_state_pkt_length, 14)
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_STATE_QUEUE_EMPTY, dsq_mgrq_link_state_queue_empty, 1)
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_STATE_REP_COUNT, dsq_mgrq_link_state_rep_count, 12)
+        DRV_FIELD_SET_CASE(DSQ_MGRQ_LINK_STATE_TAIL_PTR, dsq_mgrq_link_state_tail_ptr, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_COMMIT_TOKEN, ds_queue_shape_commit_token, 24)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PEAK_TOKEN, ds_queue_shape_peak_token, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DRR_DEFICIT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_DRR_DEFICIT_DEFICIT, ds_queue_drr_deficit_deficit, 27)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IN_PROFILE_NEXT_QUEUE_PTR:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IN_PROFILE_NEXT_QUEUE_PTR_IN_PROF_NEXT_GRP_ID, ds_in_profile_next_queue_ptr_in_prof_next_grp_id, 9)
+        DRV_FIELD_SET_CASE(DS_IN_PROFILE_NEXT_QUEUE_PTR_IN_PROF_NEXT_QUE_PTR, ds_in_profile_next_queue_ptr_in_prof_next_que_ptr, 11)
+        DRV_FIELD_SET_CASE(DS_IN_PROFILE_NEXT_QUEUE_PTR_IN_PROF_NEXT_QUE_SHP_EN, ds_in_profile_next_queue_ptr_in_prof_next_que_shp_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_OUT_PROFILE_NEXT_QUEUE_PTR:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_OUT_PROFILE_NEXT_QUEUE_PTR_OUT_PROF_NEXT_GRP_ID, ds_out_profile_next_queue_ptr_out_prof_next_grp_id, 9)
+        DRV_FIELD_SET_CASE(DS_OUT_PROFILE_NEXT_QUEUE_PTR_OUT_PROF_NEXT_QUE_PTR, ds_out_profile_next_queue_ptr_out_prof_next_que_ptr, 11)
+        DRV_FIELD_SET_CASE(DS_OUT_PROFILE_NEXT_QUEUE_PTR_OUT_PROF_NEXT_QUE_SHP_EN, ds_out_profile_next_queue_ptr_out_prof_next_que_shp_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_DRR_WEIGHT_WEIGHT, ds_queue_drr_weight_weight, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_MAP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_MAP_CHANNEL_ID, ds_queue_map_channel_id, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_MAP_GRP_ID, ds_queue_map_grp_id, 9)
+        DRV_FIELD_SET_CASE(DS_QUEUE_MAP_PRIORITY_ID, ds_queue_map_priority_id, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_MAP_QUE_SHP_EN, ds_queue_map_que_shp_en, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_MAP_SGMAC_ID, ds_queue_map_sgmac_id, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_MAP_SGMAC_VALID, ds_queue_map_sgmac_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_LINK_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_GRP_ID0, ds_channel_link_state_in_prof_grp_id0, 9)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_GRP_ID1, ds_channel_link_state_in_prof_grp_id1, 9)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_HEAD_QUE0, ds_channel_link_state_in_prof_head_que0, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_HEAD_QUE1, ds_channel_link_state_in_prof_head_que1, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_QUE_SHP_EN0, ds_channel_link_state_in_prof_que_shp_en0, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_QUE_SHP_EN1, ds_channel_link_state_in_prof_que_shp_en1, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_SUB_CH_STATE1, ds_channel_link_state_in_prof_sub_ch_state1, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_TAIL_QUE0, ds_channel_link_state_in_prof_tail_que0, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_TAIL_QUE1, ds_channel_link_state_in_prof_tail_que1, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_GRP_ID0, ds_channel_link_state_out_prof_grp_id0, 9)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_GRP_ID1, ds_channel_link_state_out_prof_grp_id1, 9)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_HEAD_QUE0, ds_channel_link_state_out_prof_head_que0, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_HEAD_QUE1, ds_channel_link_state_out_prof_head_que1, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_QUE_SHP_EN0, ds_channel_link_state_out_prof_que_shp_en0, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_QUE_SHP_EN1, ds_channel_link_state_out_prof_que_shp_en1, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_SUB_CH_STATE1, ds_channel_link_state_out_prof_sub_ch_state1, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_TAIL_QUE0, ds_channel_link_state_out_prof_tail_que0, 11)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_TAIL_QUE1, ds_channel_link_state_out_prof_tail_que1, 11)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_STATE_QUE_IN_IN_PROF_LIST, ds_queue_state_que_in_in_prof_list, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_STATE_QUE_IN_OUT_PROF_LIST, ds_queue_state_que_in_out_prof_list, 16)
+        DRV_FIELD_SET_CASE(DS_QUEUE_STATE_QUE_NOT_EMPTY, ds_queue_state_que_not_empty, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_STATE_QUE_SHP_OK, ds_queue_shape_state_que_shp_ok, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE_PROFILE_ID:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID0, ds_group_shape_profile_id_grp_shp_prof_id0, 8)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID1, ds_group_shape_profile_id_grp_shp_prof_id1, 8)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID2, ds_group_shape_profile_id_grp_shp_prof_id2, 8)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID3, ds_group_shape_profile_id_grp_shp_prof_id3, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK0, ds_group_shape_state_grp_shp_ok0, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK1, ds_group_shape_state_grp_shp_ok1, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK2, ds_group_shape_state_grp_shp_ok2, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK3, ds_group_shape_state_grp_shp_ok3, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_GRP_TOKEN_RATE, ds_group_shape_profile_grp_token_rate, 22)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_GRP_TOKEN_THRD, ds_group_shape_profile_grp_token_thrd, 8)
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_PROFILE_GRP_TOKEN_THRD_SHIFT, ds_group_shape_profile_grp_token_thrd_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_CONTEXT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_GROUP_CONTEXT_PRIORITY, ds_group_context_priority, 2)
+        DRV_FIELD_SET_CASE(DS_GROUP_CONTEXT_VALID, ds_group_context_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE_PROFILE_ID:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID0, ds_queue_shape_profile_id_que_shp_prof_id0, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID1, ds_queue_shape_profile_id_que_shp_prof_id1, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID2, ds_queue_shape_profile_id_que_shp_prof_id2, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID3, ds_queue_shape_profile_id_que_shp_prof_id3, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_COMMIT_TOKEN_RATE, ds_queue_shape_profile_que_commit_token_rate, 22)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_COMMIT_TOKEN_THRD, ds_queue_shape_profile_que_commit_token_thrd, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_COMMIT_TOKEN_THRD_SHIFT, ds_queue_shape_profile_que_commit_token_thrd_shift, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_PEAK_TOKEN_RATE, ds_queue_shape_profile_que_peak_token_rate, 22)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_PEAK_TOKEN_THRD, ds_queue_shape_profile_que_peak_token_thrd, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_PEAK_TOKEN_THRD_SHIFT, ds_queue_shape_profile_que_peak_token_thrd_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_GROUP_SHAPE_GRP_TOKEN, ds_group_shape_grp_token, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_CACHE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_CIR0, ds_group_cache_cir0, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_CIR1, ds_group_cache_cir1, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_CIR2, ds_group_cache_cir2, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_CIR3, ds_group_cache_cir3, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_PRI_ID0, ds_group_cache_pri_id0, 2)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_PRI_ID1, ds_group_cache_pri_id1, 2)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_PRI_ID2, ds_group_cache_pri_id2, 2)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_PRI_ID3, ds_group_cache_pri_id3, 2)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_QUE_ID0, ds_group_cache_que_id0, 11)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_QUE_ID1, ds_group_cache_que_id1, 11)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_QUE_ID2, ds_group_cache_que_id2, 11)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_QUE_ID3, ds_group_cache_que_id3, 11)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_VALID0, ds_group_cache_valid0, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_VALID1, ds_group_cache_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_VALID2, ds_group_cache_valid2, 1)
+        DRV_FIELD_SET_CASE(DS_GROUP_CACHE_VALID3, ds_group_cache_valid3, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_CREDIT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_CHANNEL_CREDIT_CH_CREDIT, ds_channel_credit_ch_credit, 10)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_SHAPE_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_CHANNEL_SHAPE_PROFILE_SHAPE_EN, ds_channel_shape_profile_shape_en, 1)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_SHAPE_PROFILE_TOKEN_RATE, ds_channel_shape_profile_token_rate, 22)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_SHAPE_PROFILE_TOKEN_THRD, ds_channel_shape_profile_token_thrd, 8)
+        DRV_FIELD_SET_CASE(DS_CHANNEL_SHAPE_PROFILE_TOKEN_THRD_SHIFT, ds_channel_shape_profile_token_thrd_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_SHAPE:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_CHANNEL_SHAPE_TOKEN, ds_channel_shape_token, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CH_CREDIT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_CH_CREDIT_CH_CREDIT, ds_ch_credit_ch_credit, 10)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FABRIC_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_FABRIC_WRR_WEIGHT_CFG_WT_CFG, ds_fabric_wrr_weight_cfg_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FABRIC_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_FABRIC_WRR_WEIGHT_WT, ds_fabric_wrr_weight_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NETWORK_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_NETWORK_WRR_WEIGHT_CFG_WT_CFG, ds_network_wrr_weight_cfg_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI0_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri0_wt_cfg, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI1_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri1_wt_cfg, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI2_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri2_wt_cfg, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI3_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri3_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI0_WT, q_mgr_network_out_profile_wrr_weight_pri0_wt, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI1_WT, q_mgr_network_out_profile_wrr_weight_pri1_wt, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI2_WT, q_mgr_network_out_profile_wrr_weight_pri2_wt, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI3_WT, q_mgr_network_out_profile_wrr_weight_pri3_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI0_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri0_wt_cfg, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI1_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri1_wt_cfg, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI2_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri2_wt_cfg, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI3_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri3_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI0_WT, q_mgr_fabric_out_profile_wrr_weight_pri0_wt, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI1_WT, q_mgr_fabric_out_profile_wrr_weight_pri1_wt, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI2_WT, q_mgr_fabric_out_profile_wrr_weight_pri2_wt, 8)
+        DRV_FIELD_SET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI3_WT, q_mgr_fabric_out_profile_wrr_weight_pri3_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NETWORK_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_NETWORK_WRR_WEIGHT_WT, ds_network_wrr_weight_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_ENTRY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_BUFFER_COUNT, ds_queue_entry_buffer_count, 6)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_DEST_MAP, ds_queue_entry_dest_map, 22)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_DEST_SELECT, ds_queue_entry_dest_select, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_ECC_BIT3_TO0, ds_queue_entry_ecc_bit3_to0, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_ECC_BIT7_TO4, ds_queue_entry_ecc_bit7_to4, 4)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_HEADER_VERSION, ds_queue_entry_header_version, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_HEAD_BUFFER_PTR, ds_queue_entry_head_buffer_ptr, 15)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_HEAD_PTR_BANK_OFFSET, ds_queue_entry_head_ptr_bank_offset, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_LENGTH_ADJUST_TYPE, ds_queue_entry_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_MCAST_RCD, ds_queue_entry_mcast_rcd, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_NEXT_HOP_EXT, ds_queue_entry_next_hop_ext, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_PACKET_LENGTH, ds_queue_entry_packet_length, 14)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_PARITY, ds_queue_entry_parity, 2)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_PT_ENABLE, ds_queue_entry_pt_enable, 1)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_RCD, ds_queue_entry_rcd, 8)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_REPLICATION_CTL, ds_queue_entry_replication_ctl, 20)
+        DRV_FIELD_SET_CASE(DS_QUEUE_ENTRY_RESOURCE_GROUP_ID, ds_queue_entry_resource_group_id, 8)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP0_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP0_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp0_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP0_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp0_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP0_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp0_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP0_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp0_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP10_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP10_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp10_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP10_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp10_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP10_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp10_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP10_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp10_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP11_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP11_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp11_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP11_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp11_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP11_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp11_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP11_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp11_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP1_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP1_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp1_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP1_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp1_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP1_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp1_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP1_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp1_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP2_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP2_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp2_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP2_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp2_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP2_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp2_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP2_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp2_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP3_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP3_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp3_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP3_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp3_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP3_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp3_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP3_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp3_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP4_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP4_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp4_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP4_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp4_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP4_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp4_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP4_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp4_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP5_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP5_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp5_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP5_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp5_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP5_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp5_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP5_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp5_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP6_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP6_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp6_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP6_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp6_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP6_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp6_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP6_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp6_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP7_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP7_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp7_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP7_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp7_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP7_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp7_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP7_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp7_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP8_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP8_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp8_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP8_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp8_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP8_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp8_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP8_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp8_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP9_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(QUADMACAPP9_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp9_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP9_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp9_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_SET_CASE(QUADMACAPP9_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp9_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_SET_CASE(QUADMACAPP9_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp9_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC0_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SGMAC0_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac0_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC0_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac0_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(SGMAC0_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac0_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC0_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac0_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC1_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SGMAC1_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac1_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC1_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac1_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(SGMAC1_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac1_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC1_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac1_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC2_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SGMAC2_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac2_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC2_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac2_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(SGMAC2_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac2_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC2_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac2_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC3_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SGMAC3_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac3_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC3_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac3_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(SGMAC3_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac3_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(SGMAC3_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac3_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SHARED_DS_VLAN_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(SHARED_DS_VLAN_MEM_DATA0, shared_ds_vlan_mem_data0, 4)
+        DRV_FIELD_SET_CASE(SHARED_DS_VLAN_MEM_DATA1, shared_ds_vlan_mem_data1, 32)
+        DRV_FIELD_SET_CASE(SHARED_DS_VLAN_MEM_DATA2, shared_ds_vlan_mem_data2, 4)
+        DRV_FIELD_SET_CASE(SHARED_DS_VLAN_MEM_DATA3, shared_ds_vlan_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGGREAGATION_GROUP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_LINK_AGGREAGATION_GROUP_LINK_AGGREGATE_GROUP_EN, ds_link_aggreagation_group_link_aggregate_group_en, 1)
+        DRV_FIELD_SET_CASE(DS_LINK_AGGREAGATION_GROUP_LINK_AGGREGATE_GROUP_ID, ds_link_aggreagation_group_link_aggregate_group_id, 7)
+        default:
+            break;
+        }
+        break;
+
+    case STP_STATE_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE0, stp_state_ram_stp_state0, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE1, stp_state_ram_stp_state1, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE2, stp_state_ram_stp_state2, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE3, stp_state_ram_stp_state3, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE4, stp_state_ram_stp_state4, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE5, stp_state_ram_stp_state5, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE6, stp_state_ram_stp_state6, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE7, stp_state_ram_stp_state7, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE8, stp_state_ram_stp_state8, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE9, stp_state_ram_stp_state9, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE10, stp_state_ram_stp_state10, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE11, stp_state_ram_stp_state11, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE12, stp_state_ram_stp_state12, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE13, stp_state_ram_stp_state13, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE14, stp_state_ram_stp_state14, 2)
+        DRV_FIELD_SET_CASE(STP_STATE_RAM_STP_STATE15, stp_state_ram_stp_state15, 2)
+        default:
+            break;
+        }
+        break;
+
+    case TB_INFO_INT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TB_INFO_INT_MEM_DATA0, tb_info_int_mem_data0, 4)
+        DRV_FIELD_SET_CASE(TB_INFO_INT_MEM_DATA1, tb_info_int_mem_data1, 32)
+        DRV_FIELD_SET_CASE(TB_INFO_INT_MEM_DATA2, tb_info_int_mem_data2, 4)
+        DRV_FIELD_SET_CASE(TB_INFO_INT_MEM_DATA3, tb_info_int_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TB_INFO_HASH_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TB_INFO_HASH_MEM_DATA0, tb_info_hash_mem_data0, 4)
+        DRV_FIELD_SET_CASE(TB_INFO_HASH_MEM_DATA1, tb_info_hash_mem_data1, 32)
+        DRV_FIELD_SET_CASE(TB_INFO_HASH_MEM_DATA2, tb_info_hash_mem_data2, 4)
+        DRV_FIELD_SET_CASE(TB_INFO_HASH_MEM_DATA3, tb_info_hash_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TB_INFO_EXT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TB_INFO_EXT_MEM_DATA0, tb_info_ext_mem_data0, 4)
+        DRV_FIELD_SET_CASE(TB_INFO_EXT_MEM_DATA1, tb_info_ext_mem_data1, 32)
+        DRV_FIELD_SET_CASE(TB_INFO_EXT_MEM_DATA2, tb_info_ext_mem_data2, 4)
+        DRV_FIELD_SET_CASE(TB_INFO_EXT_MEM_DATA3, tb_info_ext_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case RAM_BIST_TB_INFO_EXT_DDR:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ACCESS_LOAD, ram_bist_tb_info_ext_ddr_ram_access_load, 1)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ACCESS_READ, ram_bist_tb_info_ext_ddr_ram_access_read, 1)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ACCESS_VALID, ram_bist_tb_info_ext_ddr_ram_access_valid, 1)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ADDRESS, ram_bist_tb_info_ext_ddr_ram_address, 20)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA31_TO0, ram_bist_tb_info_ext_ddr_ram_data31_to0, 32)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA35_TO32, ram_bist_tb_info_ext_ddr_ram_data35_to32, 4)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA67_TO36, ram_bist_tb_info_ext_ddr_ram_data67_to36, 32)
+        DRV_FIELD_SET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA71_TO68, ram_bist_tb_info_ext_ddr_ram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_EXT_BIST_REQUEST_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY31_TO0, tcam_ctl_ext_bist_request_mem_key31_to0, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY63_TO32, tcam_ctl_ext_bist_request_mem_key63_to32, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY79_TO64, tcam_ctl_ext_bist_request_mem_key79_to64, 16)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY111_TO80, tcam_ctl_ext_bist_request_mem_key111_to80, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY143_TO112, tcam_ctl_ext_bist_request_mem_key143_to112, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY159_TO144, tcam_ctl_ext_bist_request_mem_key159_to144, 16)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_CMD, tcam_ctl_ext_bist_request_mem_key_cmd, 8)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_INST, tcam_ctl_ext_bist_request_mem_key_inst, 3)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_SIZE, tcam_ctl_ext_bist_request_mem_key_size, 2)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_VALID, tcam_ctl_ext_bist_request_mem_key_valid, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_LINK_TRAINING_CMD, tcam_ctl_ext_bist_request_mem_link_training_cmd, 13)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_LINK_TRAINING_VALID, tcam_ctl_ext_bist_request_mem_link_training_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_EXT_BIST_RESULT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX0, tcam_ctl_ext_bist_result_mem_index0, 20)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX0_COMPARE_EN, tcam_ctl_ext_bist_result_mem_index0_compare_en, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX1, tcam_ctl_ext_bist_result_mem_index1, 20)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX1_COMPARE_EN, tcam_ctl_ext_bist_result_mem_index1_compare_en, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX_VALID, tcam_ctl_ext_bist_result_mem_index_valid, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_RESULT_COMPARE_VALID, tcam_ctl_ext_bist_result_mem_result_compare_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_INT_CPU_REQUEST_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY31_TO0, tcam_ctl_int_cpu_request_mem_key31_to0, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY63_TO32, tcam_ctl_int_cpu_request_mem_key63_to32, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY79_TO64, tcam_ctl_int_cpu_request_mem_key79_to64, 16)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY111_TO80, tcam_ctl_int_cpu_request_mem_key111_to80, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY143_TO112, tcam_ctl_int_cpu_request_mem_key143_to112, 32)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY159_TO144, tcam_ctl_int_cpu_request_mem_key159_to144, 16)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY_CMD, tcam_ctl_int_cpu_request_mem_key_cmd, 8)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY_SIZE, tcam_ctl_int_cpu_request_mem_key_size, 2)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY_VALID, tcam_ctl_int_cpu_request_mem_key_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_INT_CPU_RESULT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_ACL, tcam_ctl_int_cpu_result_mem_index_acl, 20)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_ACL_COMP_EN, tcam_ctl_int_cpu_result_mem_index_acl_comp_en, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_QOS, tcam_ctl_int_cpu_result_mem_index_qos, 20)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_QOS_COMP_EN, tcam_ctl_int_cpu_result_mem_index_qos_comp_en, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_VALID, tcam_ctl_int_cpu_result_mem_index_valid, 1)
+        DRV_FIELD_SET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_RESULT_COMPARE_VALID, tcam_ctl_int_cpu_result_mem_result_compare_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC0_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(XGMAC0_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac0_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC0_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac0_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(XGMAC0_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac0_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC0_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac0_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC1_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(XGMAC1_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac1_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC1_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac1_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(XGMAC1_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac1_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC1_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac1_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC2_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(XGMAC2_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac2_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC2_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac2_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(XGMAC2_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac2_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC2_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac2_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC3_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(XGMAC3_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac3_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC3_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac3_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_SET_CASE(XGMAC3_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac3_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_SET_CASE(XGMAC3_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac3_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_ACL_LOG_ID, ds_mac_acl_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_COLOR, ds_mac_acl_color, 2)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_DENY_BRIDGE, ds_mac_acl_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_DENY_LEARNING, ds_mac_acl_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_DENY_REPLACE_COS, ds_mac_acl_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_DENY_REPLACE_DSCP, ds_mac_acl_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_DENY_ROUTE, ds_mac_acl_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_DISCARD_PACKET, ds_mac_acl_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_FLOW_POLICER_PTR, ds_mac_acl_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_FWD_PTR, ds_mac_acl_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_PRIORITY, ds_mac_acl_priority, 6)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_PRIORITY_VALID, ds_mac_acl_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_QOS_POLICY, ds_mac_acl_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_RANDOM_LOG_EN, ds_mac_acl_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_RANDOM_THRESHOLD_SHIFT, ds_mac_acl_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_STATS_MODE, ds_mac_acl_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_ACL_STATS_PTR, ds_mac_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_ACL_LOG_ID, ds_ipv4_acl_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_COLOR, ds_ipv4_acl_color, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_DENY_BRIDGE, ds_ipv4_acl_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_DENY_LEARNING, ds_ipv4_acl_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_DENY_REPLACE_COS, ds_ipv4_acl_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_DENY_REPLACE_DSCP, ds_ipv4_acl_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_DENY_ROUTE, ds_ipv4_acl_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_DISCARD_PACKET, ds_ipv4_acl_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_FLOW_POLICER_PTR, ds_ipv4_acl_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_FWD_PTR, ds_ipv4_acl_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_PRIORITY, ds_ipv4_acl_priority, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_PRIORITY_VALID, ds_ipv4_acl_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_QOS_POLICY, ds_ipv4_acl_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_RANDOM_LOG_EN, ds_ipv4_acl_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_RANDOM_THRESHOLD_SHIFT, ds_ipv4_acl_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_STATS_MODE, ds_ipv4_acl_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_ACL_STATS_PTR, ds_ipv4_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_ACL_LOG_ID, ds_mpls_acl_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_COLOR, ds_mpls_acl_color, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_DENY_BRIDGE, ds_mpls_acl_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_DENY_LEARNING, ds_mpls_acl_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_DENY_REPLACE_COS, ds_mpls_acl_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_DENY_REPLACE_DSCP, ds_mpls_acl_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_DENY_ROUTE, ds_mpls_acl_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_DISCARD_PACKET, ds_mpls_acl_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_FLOW_POLICER_PTR, ds_mpls_acl_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_FWD_PTR, ds_mpls_acl_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_PRIORITY, ds_mpls_acl_priority, 6)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_PRIORITY_VALID, ds_mpls_acl_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_QOS_POLICY, ds_mpls_acl_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_RANDOM_LOG_EN, ds_mpls_acl_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_RANDOM_THRESHOLD_SHIFT, ds_mpls_acl_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_STATS_MODE, ds_mpls_acl_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_ACL_STATS_PTR, ds_mpls_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_ACL_LOG_ID, ds_ipv6_acl_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_COLOR, ds_ipv6_acl_color, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_DENY_BRIDGE, ds_ipv6_acl_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_DENY_LEARNING, ds_ipv6_acl_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_DENY_REPLACE_COS, ds_ipv6_acl_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_DENY_REPLACE_DSCP, ds_ipv6_acl_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_DENY_ROUTE, ds_ipv6_acl_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_DISCARD_PACKET, ds_ipv6_acl_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_FLOW_POLICER_PTR, ds_ipv6_acl_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_FWD_PTR, ds_ipv6_acl_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_PRIORITY, ds_ipv6_acl_priority, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_PRIORITY_VALID, ds_ipv6_acl_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_QOS_POLICY, ds_ipv6_acl_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_RANDOM_LOG_EN, ds_ipv6_acl_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_RANDOM_THRESHOLD_SHIFT, ds_ipv6_acl_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_STATS_MODE, ds_ipv6_acl_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_ACL_STATS_PTR, ds_ipv6_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_ACL_LOG_ID, ds_mac_qos_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_COLOR, ds_mac_qos_color, 2)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_DENY_BRIDGE, ds_mac_qos_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_DENY_LEARNING, ds_mac_qos_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_DENY_REPLACE_COS, ds_mac_qos_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_DENY_REPLACE_DSCP, ds_mac_qos_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_DENY_ROUTE, ds_mac_qos_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_DISCARD_PACKET, ds_mac_qos_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_FLOW_POLICER_PTR, ds_mac_qos_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_FWD_PTR, ds_mac_qos_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_PRIORITY, ds_mac_qos_priority, 6)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_PRIORITY_VALID, ds_mac_qos_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_QOS_POLICY, ds_mac_qos_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_RANDOM_LOG_EN, ds_mac_qos_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_RANDOM_THRESHOLD_SHIFT, ds_mac_qos_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_STATS_MODE, ds_mac_qos_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_QOS_STATS_PTR, ds_mac_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_ACL_LOG_ID, ds_ipv4_qos_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_COLOR, ds_ipv4_qos_color, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_DENY_BRIDGE, ds_ipv4_qos_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_DENY_LEARNING, ds_ipv4_qos_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_DENY_REPLACE_COS, ds_ipv4_qos_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_DENY_REPLACE_DSCP, ds_ipv4_qos_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_DENY_ROUTE, ds_ipv4_qos_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_DISCARD_PACKET, ds_ipv4_qos_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_FLOW_POLICER_PTR, ds_ipv4_qos_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_FWD_PTR, ds_ipv4_qos_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_PRIORITY, ds_ipv4_qos_priority, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_PRIORITY_VALID, ds_ipv4_qos_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_QOS_POLICY, ds_ipv4_qos_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_RANDOM_LOG_EN, ds_ipv4_qos_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_RANDOM_THRESHOLD_SHIFT, ds_ipv4_qos_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_STATS_MODE, ds_ipv4_qos_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_QOS_STATS_PTR, ds_ipv4_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_ACL_LOG_ID, ds_mpls_qos_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_COLOR, ds_mpls_qos_color, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_DENY_BRIDGE, ds_mpls_qos_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_DENY_LEARNING, ds_mpls_qos_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_DENY_REPLACE_COS, ds_mpls_qos_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_DENY_REPLACE_DSCP, ds_mpls_qos_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_DENY_ROUTE, ds_mpls_qos_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_DISCARD_PACKET, ds_mpls_qos_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_FLOW_POLICER_PTR, ds_mpls_qos_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_FWD_PTR, ds_mpls_qos_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_PRIORITY, ds_mpls_qos_priority, 6)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_PRIORITY_VALID, ds_mpls_qos_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_QOS_POLICY, ds_mpls_qos_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_RANDOM_LOG_EN, ds_mpls_qos_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_RANDOM_THRESHOLD_SHIFT, ds_mpls_qos_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_STATS_MODE, ds_mpls_qos_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_QOS_STATS_PTR, ds_mpls_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_ACL_LOG_ID, ds_ipv6_qos_acl_log_id, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_COLOR, ds_ipv6_qos_color, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_DENY_BRIDGE, ds_ipv6_qos_deny_bridge, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_DENY_LEARNING, ds_ipv6_qos_deny_learning, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_DENY_REPLACE_COS, ds_ipv6_qos_deny_replace_cos, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_DENY_REPLACE_DSCP, ds_ipv6_qos_deny_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_DENY_ROUTE, ds_ipv6_qos_deny_route, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_DISCARD_PACKET, ds_ipv6_qos_discard_packet, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_FLOW_POLICER_PTR, ds_ipv6_qos_flow_policer_ptr, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_FWD_PTR, ds_ipv6_qos_fwd_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_PRIORITY, ds_ipv6_qos_priority, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_PRIORITY_VALID, ds_ipv6_qos_priority_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_QOS_POLICY, ds_ipv6_qos_qos_policy, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_RANDOM_LOG_EN, ds_ipv6_qos_random_log_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_RANDOM_THRESHOLD_SHIFT, ds_ipv6_qos_random_threshold_shift, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_STATS_MODE, ds_ipv6_qos_stats_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_QOS_STATS_PTR, ds_ipv6_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_BIDI_PIM_GROUP, ds_ipv4_ucast_da_bidi_pim_group, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv4_ucast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_DENY_PBR, ds_ipv4_ucast_da_deny_pbr, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_DS_FWD_PTR, ds_ipv4_ucast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv4_ucast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv4_ucast_da_equal_cost_path_num, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_EXCEP_SUB_INDEX, ds_ipv4_ucast_da_excep_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_EXP3_CTL_EN, ds_ipv4_ucast_da_exp3_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_ICMP_CHECK_EN, ds_ipv4_ucast_da_icmp_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv4_ucast_da_ip_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_ISATAP_CHECK_EN, ds_ipv4_ucast_da_isatap_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_L3_IF_TYPE, ds_ipv4_ucast_da_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv4_ucast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_PAYLOAD_SELECT, ds_ipv4_ucast_da_payload_select, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_PRIORITY_PATH_EN, ds_ipv4_ucast_da_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_TTL_CHECK_EN, ds_ipv4_ucast_da_ttl_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv4_ucast_da_tunnel_gre_options, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv4_ucast_da_tunnel_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv4_ucast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv4_ucast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_VPLS_EN, ds_ipv4_ucast_da_vpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_DA_VRF_ID, ds_ipv4_ucast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_BIDI_PIM_GROUP, ds_ipv4_mcast_da_bidi_pim_group, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv4_mcast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_DENY_PBR, ds_ipv4_mcast_da_deny_pbr, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_DS_FWD_PTR, ds_ipv4_mcast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv4_mcast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv4_mcast_da_equal_cost_path_num, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_EXCEP_SUB_INDEX, ds_ipv4_mcast_da_excep_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_EXP3_CTL_EN, ds_ipv4_mcast_da_exp3_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_ICMP_CHECK_EN, ds_ipv4_mcast_da_icmp_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv4_mcast_da_ip_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_ISATAP_CHECK_EN, ds_ipv4_mcast_da_isatap_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_L3_IF_TYPE, ds_ipv4_mcast_da_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv4_mcast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_PAYLOAD_SELECT, ds_ipv4_mcast_da_payload_select, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_PRIORITY_PATH_EN, ds_ipv4_mcast_da_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_TTL_CHECK_EN, ds_ipv4_mcast_da_ttl_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv4_mcast_da_tunnel_gre_options, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv4_mcast_da_tunnel_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv4_mcast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv4_mcast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_VPLS_EN, ds_ipv4_mcast_da_vpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_DA_VRF_ID, ds_ipv4_mcast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_BIDI_PIM_GROUP, ds_ipv6_ucast_da_bidi_pim_group, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv6_ucast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_DENY_PBR, ds_ipv6_ucast_da_deny_pbr, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_DS_FWD_PTR, ds_ipv6_ucast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv6_ucast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv6_ucast_da_equal_cost_path_num, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_EXCEP_SUB_INDEX, ds_ipv6_ucast_da_excep_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_EXP3_CTL_EN, ds_ipv6_ucast_da_exp3_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_ICMP_CHECK_EN, ds_ipv6_ucast_da_icmp_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv6_ucast_da_ip_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_ISATAP_CHECK_EN, ds_ipv6_ucast_da_isatap_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_L3_IF_TYPE, ds_ipv6_ucast_da_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv6_ucast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_PAYLOAD_SELECT, ds_ipv6_ucast_da_payload_select, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_PRIORITY_PATH_EN, ds_ipv6_ucast_da_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_TTL_CHECK_EN, ds_ipv6_ucast_da_ttl_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv6_ucast_da_tunnel_gre_options, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv6_ucast_da_tunnel_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv6_ucast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv6_ucast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_VPLS_EN, ds_ipv6_ucast_da_vpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_DA_VRF_ID, ds_ipv6_ucast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_BIDI_PIM_GROUP, ds_ipv6_mcast_da_bidi_pim_group, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv6_mcast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_DENY_PBR, ds_ipv6_mcast_da_deny_pbr, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_DS_FWD_PTR, ds_ipv6_mcast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv6_mcast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv6_mcast_da_equal_cost_path_num, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_EXCEP_SUB_INDEX, ds_ipv6_mcast_da_excep_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_EXP3_CTL_EN, ds_ipv6_mcast_da_exp3_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_ICMP_CHECK_EN, ds_ipv6_mcast_da_icmp_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv6_mcast_da_ip_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_ISATAP_CHECK_EN, ds_ipv6_mcast_da_isatap_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_L3_IF_TYPE, ds_ipv6_mcast_da_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv6_mcast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_PAYLOAD_SELECT, ds_ipv6_mcast_da_payload_select, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_PRIORITY_PATH_EN, ds_ipv6_mcast_da_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_TTL_CHECK_EN, ds_ipv6_mcast_da_ttl_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv6_mcast_da_tunnel_gre_options, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv6_mcast_da_tunnel_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv6_mcast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv6_mcast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_VPLS_EN, ds_ipv6_mcast_da_vpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_DA_VRF_ID, ds_ipv6_mcast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_PBR_DUAL_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP, ds_ipv4_ucast_pbr_dual_da_bidi_pim_group, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP_VALID, ds_ipv4_ucast_pbr_dual_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_DENY_PBR, ds_ipv4_ucast_pbr_dual_da_deny_pbr, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_DS_FWD_PTR, ds_ipv4_ucast_pbr_dual_da_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM2, ds_ipv4_ucast_pbr_dual_da_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM, ds_ipv4_ucast_pbr_dual_da_equal_cost_path_num, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EXCEP_SUB_INDEX, ds_ipv4_ucast_pbr_dual_da_excep_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EXP3_CTL_EN, ds_ipv4_ucast_pbr_dual_da_exp3_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_ICMP_CHECK_EN, ds_ipv4_ucast_pbr_dual_da_icmp_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_IP_DA_EXCEPTION_EN, ds_ipv4_ucast_pbr_dual_da_ip_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_ISATAP_CHECK_EN, ds_ipv4_ucast_pbr_dual_da_isatap_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_L3_IF_TYPE, ds_ipv4_ucast_pbr_dual_da_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv4_ucast_pbr_dual_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_PAYLOAD_SELECT, ds_ipv4_ucast_pbr_dual_da_payload_select, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_PRIORITY_PATH_EN, ds_ipv4_ucast_pbr_dual_da_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TTL_CHECK_EN, ds_ipv4_ucast_pbr_dual_da_ttl_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_GRE_OPTIONS, ds_ipv4_ucast_pbr_dual_da_tunnel_gre_options, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_PACKET_TYPE, ds_ipv4_ucast_pbr_dual_da_tunnel_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv4_ucast_pbr_dual_da_tunnel_payload_offset, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv4_ucast_pbr_dual_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_VPLS_EN, ds_ipv4_ucast_pbr_dual_da_vpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_VRF_ID, ds_ipv4_ucast_pbr_dual_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_PBR_DUAL_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP, ds_ipv6_ucast_pbr_dual_da_bidi_pim_group, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP_VALID, ds_ipv6_ucast_pbr_dual_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_DENY_PBR, ds_ipv6_ucast_pbr_dual_da_deny_pbr, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_DS_FWD_PTR, ds_ipv6_ucast_pbr_dual_da_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM2, ds_ipv6_ucast_pbr_dual_da_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM, ds_ipv6_ucast_pbr_dual_da_equal_cost_path_num, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EXCEP_SUB_INDEX, ds_ipv6_ucast_pbr_dual_da_excep_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EXP3_CTL_EN, ds_ipv6_ucast_pbr_dual_da_exp3_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_ICMP_CHECK_EN, ds_ipv6_ucast_pbr_dual_da_icmp_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_IP_DA_EXCEPTION_EN, ds_ipv6_ucast_pbr_dual_da_ip_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_ISATAP_CHECK_EN, ds_ipv6_ucast_pbr_dual_da_isatap_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_L3_IF_TYPE, ds_ipv6_ucast_pbr_dual_da_l3_if_type, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv6_ucast_pbr_dual_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_PAYLOAD_SELECT, ds_ipv6_ucast_pbr_dual_da_payload_select, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_PRIORITY_PATH_EN, ds_ipv6_ucast_pbr_dual_da_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TTL_CHECK_EN, ds_ipv6_ucast_pbr_dual_da_ttl_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_GRE_OPTIONS, ds_ipv6_ucast_pbr_dual_da_tunnel_gre_options, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_PACKET_TYPE, ds_ipv6_ucast_pbr_dual_da_tunnel_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv6_ucast_pbr_dual_da_tunnel_payload_offset, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv6_ucast_pbr_dual_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_VPLS_EN, ds_ipv6_ucast_pbr_dual_da_vpls_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_VRF_ID, ds_ipv6_ucast_pbr_dual_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_SA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_CHECK_EN, ds_ipv4_ucast_sa_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID0, ds_ipv4_ucast_sa_if_id0, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID1, ds_ipv4_ucast_sa_if_id1, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID2, ds_ipv4_ucast_sa_if_id2, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID3, ds_ipv4_ucast_sa_if_id3, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID0, ds_ipv4_ucast_sa_if_id_valid0, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID1, ds_ipv4_ucast_sa_if_id_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID2, ds_ipv4_ucast_sa_if_id_valid2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID3, ds_ipv4_ucast_sa_if_id_valid3, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_SA_IPSA_MORE_RPF_IF, ds_ipv4_ucast_sa_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_SA:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_CHECK_EN, ds_ipv6_ucast_sa_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID0, ds_ipv6_ucast_sa_if_id0, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID1, ds_ipv6_ucast_sa_if_id1, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID2, ds_ipv6_ucast_sa_if_id2, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID3, ds_ipv6_ucast_sa_if_id3, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID0, ds_ipv6_ucast_sa_if_id_valid0, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID1, ds_ipv6_ucast_sa_if_id_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID2, ds_ipv6_ucast_sa_if_id_valid2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID3, ds_ipv6_ucast_sa_if_id_valid3, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_SA_IPSA_MORE_RPF_IF, ds_ipv6_ucast_sa_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_RPF:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_CHECK_EN, ds_ipv4_mcast_rpf_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID0, ds_ipv4_mcast_rpf_if_id0, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID1, ds_ipv4_mcast_rpf_if_id1, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID2, ds_ipv4_mcast_rpf_if_id2, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID3, ds_ipv4_mcast_rpf_if_id3, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID0, ds_ipv4_mcast_rpf_if_id_valid0, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID1, ds_ipv4_mcast_rpf_if_id_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID2, ds_ipv4_mcast_rpf_if_id_valid2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID3, ds_ipv4_mcast_rpf_if_id_valid3, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_RPF_IPSA_MORE_RPF_IF, ds_ipv4_mcast_rpf_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_RPF:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_CHECK_EN, ds_ipv6_mcast_rpf_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID0, ds_ipv6_mcast_rpf_if_id0, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID1, ds_ipv6_mcast_rpf_if_id1, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID2, ds_ipv6_mcast_rpf_if_id2, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID3, ds_ipv6_mcast_rpf_if_id3, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID0, ds_ipv6_mcast_rpf_if_id_valid0, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID1, ds_ipv6_mcast_rpf_if_id_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID2, ds_ipv6_mcast_rpf_if_id_valid2, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID3, ds_ipv6_mcast_rpf_if_id_valid3, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_RPF_IPSA_MORE_RPF_IF, ds_ipv6_mcast_rpf_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_SA_NAT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_FORCE_IP_SA_FWD, ds_ipv4_sa_nat_force_ip_sa_fwd, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_IPV4_EMBED_MODE, ds_ipv4_sa_nat_ipv4_embed_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_IP_SA, ds_ipv4_sa_nat_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_IP_SA_FWD_PTR_VALID, ds_ipv4_sa_nat_ip_sa_fwd_ptr_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_IP_SA_MODE, ds_ipv4_sa_nat_ip_sa_mode, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_IP_SA_PREFIX, ds_ipv4_sa_nat_ip_sa_prefix, 8)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_IP_SA_PREFIX_LEN, ds_ipv4_sa_nat_ip_sa_prefix_len, 3)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_L4_SOURCE_PORT, ds_ipv4_sa_nat_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_REPLACE_IP_SA, ds_ipv4_sa_nat_replace_ip_sa, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_SA_NAT_REPLACE_L4_SOURCE_PORT, ds_ipv4_sa_nat_replace_l4_source_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_SA_NAT:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_FORCE_IP_SA_FWD, ds_ipv6_sa_nat_force_ip_sa_fwd, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_IPV4_EMBED_MODE, ds_ipv6_sa_nat_ipv4_embed_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_IP_SA, ds_ipv6_sa_nat_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_IP_SA_FWD_PTR_VALID, ds_ipv6_sa_nat_ip_sa_fwd_ptr_valid, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_IP_SA_MODE, ds_ipv6_sa_nat_ip_sa_mode, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_IP_SA_PREFIX, ds_ipv6_sa_nat_ip_sa_prefix, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_IP_SA_PREFIX_LEN, ds_ipv6_sa_nat_ip_sa_prefix_len, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_L4_SOURCE_PORT, ds_ipv6_sa_nat_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_REPLACE_IP_SA, ds_ipv6_sa_nat_replace_ip_sa, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_SA_NAT_REPLACE_L4_SOURCE_PORT, ds_ipv6_sa_nat_replace_l4_source_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_VLAN:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_APS_SELECT_VALID, ds_user_id_vlan_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_BINDING_DATAH, ds_user_id_vlan_binding_datah, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_BINDING_DATAL, ds_user_id_vlan_binding_datal, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_BINDING_DATAM, ds_user_id_vlan_binding_datam, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_BINDING_EN, ds_user_id_vlan_binding_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_BINDING_MAC_SA, ds_user_id_vlan_binding_mac_sa, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_BY_PASS_ALL, ds_user_id_vlan_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_DS_FWD_PTR_VALID, ds_user_id_vlan_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_EXCEPTION_EN, ds_user_id_vlan_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_SRC_COMMUNICATE_PORT, ds_user_id_vlan_src_communicate_port, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_SRC_QUEUE_SELECT, ds_user_id_vlan_src_queue_select, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_USER_VLAN_PTR, ds_user_id_vlan_user_vlan_ptr, 13)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_VPLS_PORT_TYPE, ds_user_id_vlan_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_MAC:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_APS_SELECT_VALID, ds_user_id_mac_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_BINDING_DATAH, ds_user_id_mac_binding_datah, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_BINDING_DATAL, ds_user_id_mac_binding_datal, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_BINDING_DATAM, ds_user_id_mac_binding_datam, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_BINDING_EN, ds_user_id_mac_binding_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_BINDING_MAC_SA, ds_user_id_mac_binding_mac_sa, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_BY_PASS_ALL, ds_user_id_mac_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_DS_FWD_PTR_VALID, ds_user_id_mac_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_EXCEPTION_EN, ds_user_id_mac_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_SRC_COMMUNICATE_PORT, ds_user_id_mac_src_communicate_port, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_SRC_QUEUE_SELECT, ds_user_id_mac_src_queue_select, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_USER_VLAN_PTR, ds_user_id_mac_user_vlan_ptr, 13)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_VPLS_PORT_TYPE, ds_user_id_mac_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV4:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_APS_SELECT_VALID, ds_user_id_ipv4_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_BINDING_DATAH, ds_user_id_ipv4_binding_datah, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_BINDING_DATAL, ds_user_id_ipv4_binding_datal, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_BINDING_DATAM, ds_user_id_ipv4_binding_datam, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_BINDING_EN, ds_user_id_ipv4_binding_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_BINDING_MAC_SA, ds_user_id_ipv4_binding_mac_sa, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_BY_PASS_ALL, ds_user_id_ipv4_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_DS_FWD_PTR_VALID, ds_user_id_ipv4_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_EXCEPTION_EN, ds_user_id_ipv4_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_SRC_COMMUNICATE_PORT, ds_user_id_ipv4_src_communicate_port, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_SRC_QUEUE_SELECT, ds_user_id_ipv4_src_queue_select, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_USER_VLAN_PTR, ds_user_id_ipv4_user_vlan_ptr, 13)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_VPLS_PORT_TYPE, ds_user_id_ipv4_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV6:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_APS_SELECT_VALID, ds_user_id_ipv6_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_BINDING_DATAH, ds_user_id_ipv6_binding_datah, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_BINDING_DATAL, ds_user_id_ipv6_binding_datal, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_BINDING_DATAM, ds_user_id_ipv6_binding_datam, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_BINDING_EN, ds_user_id_ipv6_binding_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_BINDING_MAC_SA, ds_user_id_ipv6_binding_mac_sa, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_BY_PASS_ALL, ds_user_id_ipv6_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_DS_FWD_PTR_VALID, ds_user_id_ipv6_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_EXCEPTION_EN, ds_user_id_ipv6_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_SRC_COMMUNICATE_PORT, ds_user_id_ipv6_src_communicate_port, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_SRC_QUEUE_SELECT, ds_user_id_ipv6_src_queue_select, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_USER_VLAN_PTR, ds_user_id_ipv6_user_vlan_ptr, 13)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_VPLS_PORT_TYPE, ds_user_id_ipv6_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_ETH4W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_DERIVE_MCAST_MAC, ds_l2_edit_eth4w_derive_mcast_mac, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_MAC_DAH, ds_l2_edit_eth4w_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_MAC_DAL, ds_l2_edit_eth4w_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_MAC_SA_VALID, ds_l2_edit_eth4w_mac_sa_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_CVLANID_VALID, ds_l2_edit_eth4w_output_cvlanid_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_VLANID_IS_SVLAN, ds_l2_edit_eth4w_output_vlanid_is_svlan, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_VLAN_ID, ds_l2_edit_eth4w_output_vlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_VLAN_ID_VALID, ds_l2_edit_eth4w_output_vlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_OVERWRITE_ETHER_TYPE, ds_l2_edit_eth4w_overwrite_ether_type, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_PACKET_TYPE, ds_l2_edit_eth4w_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH4W_TYPE, ds_l2_edit_eth4w_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_ETH8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_DERIVE_MCAST_MAC, ds_l2_edit_eth8w_derive_mcast_mac, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_MAC_DAH, ds_l2_edit_eth8w_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_MAC_DAL, ds_l2_edit_eth8w_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_MAC_SAH, ds_l2_edit_eth8w_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_MAC_SAL, ds_l2_edit_eth8w_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_MAC_SA_VALID, ds_l2_edit_eth8w_mac_sa_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_IDH, ds_l2_edit_eth8w_output_cvlan_idh, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_IDL, ds_l2_edit_eth8w_output_cvlan_idl, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_IDM, ds_l2_edit_eth8w_output_cvlan_idm, 6)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_ID_VALID, ds_l2_edit_eth8w_output_cvlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_VLANID_IS_SVLAN, ds_l2_edit_eth8w_output_vlanid_is_svlan, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_VLAN_ID, ds_l2_edit_eth8w_output_vlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_VLAN_ID_VALID, ds_l2_edit_eth8w_output_vlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_OVERWRITE_ETHER_TYPE, ds_l2_edit_eth8w_overwrite_ether_type, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_PACKET_TYPE, ds_l2_edit_eth8w_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_ETH8W_TYPE, ds_l2_edit_eth8w_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_FLEX4W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX4W_PACKET_TYPE, ds_l2_edit_flex4w_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX4W_REWRITE_BYTE_NUM, ds_l2_edit_flex4w_rewrite_byte_num, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX4W_REWRITE_STRINGH, ds_l2_edit_flex4w_rewrite_stringh, 24)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX4W_REWRITE_STRINGL, ds_l2_edit_flex4w_rewrite_stringl, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_FLEX8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX8W_PACKET_TYPE, ds_l2_edit_flex8w_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_BYTE_NUM, ds_l2_edit_flex8w_rewrite_byte_num, 4)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING0, ds_l2_edit_flex8w_rewrite_string0, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING1, ds_l2_edit_flex8w_rewrite_string1, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING2, ds_l2_edit_flex8w_rewrite_string2, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING3, ds_l2_edit_flex8w_rewrite_string3, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_LOOPBACK:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_LOOPBACK_LB_DEST_MAP, ds_l2_edit_loopback_lb_dest_map, 22)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_LOOPBACK_LB_LENGTH_ADJUST_TYPE, ds_l2_edit_loopback_lb_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_LOOPBACK_LB_NEXT_HOP_EXT, ds_l2_edit_loopback_lb_next_hop_ext, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_LOOPBACK_LB_NEXT_HOP_PTR, ds_l2_edit_loopback_lb_next_hop_ptr, 20)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_PBB8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_BTAG_CFI, ds_l2_edit_pbb8w_btag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_BTAG_COS, ds_l2_edit_pbb8w_btag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_BVLAN_ID, ds_l2_edit_pbb8w_bvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_BVLAN_TAGGED, ds_l2_edit_pbb8w_bvlan_tagged, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_BVLAN_TAG_DISABLE, ds_l2_edit_pbb8w_bvlan_tag_disable, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_BVLAN_VALID, ds_l2_edit_pbb8w_bvlan_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_COPY_NCA_RES, ds_l2_edit_pbb8w_copy_nca_res, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_DERIVE_BTAG_COS, ds_l2_edit_pbb8w_derive_btag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_DERIVE_ITAG_COS, ds_l2_edit_pbb8w_derive_itag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_DERIVE_MAC_DA, ds_l2_edit_pbb8w_derive_mac_da, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_ISID_VALID, ds_l2_edit_pbb8w_isid_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_ITAG_CFI, ds_l2_edit_pbb8w_itag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_ITAG_COS, ds_l2_edit_pbb8w_itag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_I_SID, ds_l2_edit_pbb8w_i_sid, 24)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_MAC_DA310, ds_l2_edit_pbb8w_mac_da310, 32)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_MAC_DA4732, ds_l2_edit_pbb8w_mac_da4732, 16)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_MAC_DA_VALID, ds_l2_edit_pbb8w_mac_da_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_MAC_SA_VALID, ds_l2_edit_pbb8w_mac_sa_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_NCA, ds_l2_edit_pbb8w_nca, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_PBB_HEADER_OP_TYPE, ds_l2_edit_pbb8w_pbb_header_op_type, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_RES1, ds_l2_edit_pbb8w_res1, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB8W_RES2, ds_l2_edit_pbb8w_res2, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_PBB4W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_BTAG_CFI, ds_l2_edit_pbb4w_btag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_BTAG_COS, ds_l2_edit_pbb4w_btag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_BVLAN_ID, ds_l2_edit_pbb4w_bvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_BVLAN_TAGGED, ds_l2_edit_pbb4w_bvlan_tagged, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_BVLAN_TAG_DISABLE, ds_l2_edit_pbb4w_bvlan_tag_disable, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_BVLAN_VALID, ds_l2_edit_pbb4w_bvlan_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_COPY_NCA_RES, ds_l2_edit_pbb4w_copy_nca_res, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_DERIVE_ITAG_COS, ds_l2_edit_pbb4w_derive_itag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_DERIVE_MAC_DA, ds_l2_edit_pbb4w_derive_mac_da, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_ISID_VALID, ds_l2_edit_pbb4w_isid_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_ITAG_CFI, ds_l2_edit_pbb4w_itag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_ITAG_COS, ds_l2_edit_pbb4w_itag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_I_SID, ds_l2_edit_pbb4w_i_sid, 24)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_MACDA_VALID, ds_l2_edit_pbb4w_macda_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_MAC_SA_VALID, ds_l2_edit_pbb4w_mac_sa_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_MAP_BTAG_COS, ds_l2_edit_pbb4w_map_btag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_NCA, ds_l2_edit_pbb4w_nca, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_PBB_HEADER_OP_TYPE, ds_l2_edit_pbb4w_pbb_header_op_type, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_RES1, ds_l2_edit_pbb4w_res1, 1)
+        DRV_FIELD_SET_CASE(DS_L2_EDIT_PBB4W_RES2, ds_l2_edit_pbb4w_res2, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_MPLS4W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_DERIVE_EXP0, ds_l3edit_mpls4w_derive_exp0, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_DERIVE_EXP1, ds_l3edit_mpls4w_derive_exp1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_EXP0, ds_l3edit_mpls4w_exp0, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_EXP1, ds_l3edit_mpls4w_exp1, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_LABEL0, ds_l3edit_mpls4w_label0, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_LABEL1, ds_l3edit_mpls4w_label1, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_LABEL_VALID1, ds_l3edit_mpls4w_label_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_MAP_TTL0, ds_l3edit_mpls4w_map_ttl0, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_MAP_TTL1, ds_l3edit_mpls4w_map_ttl1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_MARTINI_ENCAP_VALID, ds_l3edit_mpls4w_martini_encap_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_MCAST_LABEL0, ds_l3edit_mpls4w_mcast_label0, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_MCAST_LABEL1, ds_l3edit_mpls4w_mcast_label1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_TTL0, ds_l3edit_mpls4w_ttl0, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS4W_TTL1, ds_l3edit_mpls4w_ttl1, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_MPLS8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP0, ds_l3edit_mpls8w_derive_exp0, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP1, ds_l3edit_mpls8w_derive_exp1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP2, ds_l3edit_mpls8w_derive_exp2, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP3, ds_l3edit_mpls8w_derive_exp3, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_EXP0, ds_l3edit_mpls8w_exp0, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_EXP1, ds_l3edit_mpls8w_exp1, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_EXP2, ds_l3edit_mpls8w_exp2, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_EXP3, ds_l3edit_mpls8w_exp3, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL0, ds_l3edit_mpls8w_label0, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL1, ds_l3edit_mpls8w_label1, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL2, ds_l3edit_mpls8w_label2, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL3, ds_l3edit_mpls8w_label3, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL_VALID1, ds_l3edit_mpls8w_label_valid1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL_VALID2, ds_l3edit_mpls8w_label_valid2, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_LABEL_VALID3, ds_l3edit_mpls8w_label_valid3, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL0, ds_l3edit_mpls8w_map_ttl0, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL1, ds_l3edit_mpls8w_map_ttl1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL2, ds_l3edit_mpls8w_map_ttl2, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL3, ds_l3edit_mpls8w_map_ttl3, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MARTINI_ENCAP_VALID, ds_l3edit_mpls8w_martini_encap_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL0, ds_l3edit_mpls8w_mcast_label0, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL1, ds_l3edit_mpls8w_mcast_label1, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL2, ds_l3edit_mpls8w_mcast_label2, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL3, ds_l3edit_mpls8w_mcast_label3, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_TTL0, ds_l3edit_mpls8w_ttl0, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_TTL1, ds_l3edit_mpls8w_ttl1, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_TTL2, ds_l3edit_mpls8w_ttl2, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_MPLS8W_TTL3, ds_l3edit_mpls8w_ttl3, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_NAT4W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_IPDA104, ds_l3edit_nat4w_ipda104, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_IPDA105, ds_l3edit_nat4w_ipda105, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_IPDA3932, ds_l3edit_nat4w_ipda3932, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_IPDA, ds_l3edit_nat4w_ipda, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_IPDA_PREFIX_LEN, ds_l3edit_nat4w_ipda_prefix_len, 7)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_IPV4_EMBED_MODE, ds_l3edit_nat4w_ipv4_embed_mode, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_L4_DEST_PORT, ds_l3edit_nat4w_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_NAT_MODE, ds_l3edit_nat4w_nat_mode, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_REPLACE_IPDA, ds_l3edit_nat4w_replace_ipda, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_REPLACE_L4_DEST_PORT, ds_l3edit_nat4w_replace_l4_dest_port, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT4W_USE_PORT, ds_l3edit_nat4w_use_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_NAT8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA104, ds_l3edit_nat8w_ipda104, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA105, ds_l3edit_nat8w_ipda105, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA3932, ds_l3edit_nat8w_ipda3932, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA7140, ds_l3edit_nat8w_ipda7140, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA10372, ds_l3edit_nat8w_ipda10372, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA108106, ds_l3edit_nat8w_ipda108106, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA111109, ds_l3edit_nat8w_ipda111109, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA, ds_l3edit_nat8w_ipda, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA_PREFIX_LEN, ds_l3edit_nat8w_ipda_prefix_len, 7)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPDA_USE_PORT, ds_l3edit_nat8w_ipda_use_port, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_IPV4_EMBED_MODE, ds_l3edit_nat8w_ipv4_embed_mode, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_L4_DEST_PORT, ds_l3edit_nat8w_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_NAT_MODE, ds_l3edit_nat8w_nat_mode, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_REPLACE_IPDA, ds_l3edit_nat8w_replace_ipda, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_NAT8W_REPLACE_L4_DEST_PORT, ds_l3edit_nat8w_replace_l4_dest_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_TUNNEL_V4:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_COPY_DONT_FRAG, ds_l3edit_tunnel_v4_copy_dont_frag, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_DERIVE_DSCP, ds_l3edit_tunnel_v4_derive_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_DONT_FRAG, ds_l3edit_tunnel_v4_dont_frag, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_DSCP, ds_l3edit_tunnel_v4_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_FLAGS, ds_l3edit_tunnel_v4_gre_flags, 4)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_KEY_UDP_DEST_PORT, ds_l3edit_tunnel_v4_gre_key_udp_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_PROTOCOL_UDP_SRC_PORT, ds_l3edit_tunnel_v4_gre_protocol_udp_src_port, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_SEQUENCE_ID108, ds_l3edit_tunnel_v4_gre_sequence_id108, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_VERSION, ds_l3edit_tunnel_v4_gre_version, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_INNER_HEADER_TYPE, ds_l3edit_tunnel_v4_inner_header_type, 2)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_INNER_HEADER_VALID, ds_l3edit_tunnel_v4_inner_header_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_IP_DA, ds_l3edit_tunnel_v4_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_IP_IDENTIFIC_TYPE, ds_l3edit_tunnel_v4_ip_identific_type, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_IP_PROTOCOL_TYPE, ds_l3edit_tunnel_v4_ip_protocol_type, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_IP_SA, ds_l3edit_tunnel_v4_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_IS_ATP_TUNNEL, ds_l3edit_tunnel_v4_is_atp_tunnel, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_MAP_TTL, ds_l3edit_tunnel_v4_map_ttl, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_MTU_CHECK_EN, ds_l3edit_tunnel_v4_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_T6TO4_TUNNEL, ds_l3edit_tunnel_v4_t6to4_tunnel, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_T6TO4_TUNNEL_SA, ds_l3edit_tunnel_v4_t6to4_tunnel_sa, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_TTL, ds_l3edit_tunnel_v4_ttl, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V4_VPLS_PORT_CHK_EN, ds_l3edit_tunnel_v4_vpls_port_chk_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_TUNNEL_V6:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_DERIVE_DSCP, ds_l3edit_tunnel_v6_derive_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_FLOW_LABEL, ds_l3edit_tunnel_v6_flow_label, 20)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_FLAGS, ds_l3edit_tunnel_v6_gre_flags, 4)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_KEY150, ds_l3edit_tunnel_v6_gre_key150, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_KEY3116, ds_l3edit_tunnel_v6_gre_key3116, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_PROTOCOL, ds_l3edit_tunnel_v6_gre_protocol, 16)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_SEQUENCE_ID108, ds_l3edit_tunnel_v6_gre_sequence_id108, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_VERSION, ds_l3edit_tunnel_v6_gre_version, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_INNER_HEADER_TYPE, ds_l3edit_tunnel_v6_inner_header_type, 2)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_INNER_HEADER_VALID, ds_l3edit_tunnel_v6_inner_header_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_IPDA_INDEX, ds_l3edit_tunnel_v6_ipda_index, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_IPSA_INDEX, ds_l3edit_tunnel_v6_ipsa_index, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_IP_PROTOCOL_TYPE, ds_l3edit_tunnel_v6_ip_protocol_type, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_MAP_TTL, ds_l3edit_tunnel_v6_map_ttl, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_MTU_CHECK_EN, ds_l3edit_tunnel_v6_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_NEW_FLOW_LABEL_VALID, ds_l3edit_tunnel_v6_new_flow_label_valid, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_TOS, ds_l3edit_tunnel_v6_tos, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_TTL, ds_l3edit_tunnel_v6_ttl, 8)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_VPLS_DEST_PORT11TO0, ds_l3edit_tunnel_v6_vpls_dest_port11to0, 12)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_VPLS_DEST_PORT12, ds_l3edit_tunnel_v6_vpls_dest_port12, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_TUNNEL_V6_VPLS_PORT_CHK_EN, ds_l3edit_tunnel_v6_vpls_port_chk_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_FLEX:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_FLEX_PACKET_TYPE, ds_l3edit_flex_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_FLEX_REWRITE_BYTE_NUM, ds_l3edit_flex_rewrite_byte_num, 4)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING0, ds_l3edit_flex_rewrite_string0, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING1, ds_l3edit_flex_rewrite_string1, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING2, ds_l3edit_flex_rewrite_string2, 32)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING3, ds_l3edit_flex_rewrite_string3, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_LOOP_BACK:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_L3EDIT_LOOP_BACK_DEST_MAP, ds_l3edit_loop_back_dest_map, 22)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_LOOP_BACK_LENGTH_ADJUST_TYPE, ds_l3edit_loop_back_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_LOOP_BACK_NEXT_HOP_EXT, ds_l3edit_loop_back_next_hop_ext, 1)
+        DRV_FIELD_SET_CASE(DS_L3EDIT_LOOP_BACK_NEXT_HOP_PTR, ds_l3edit_loop_back_next_hop_ptr, 20)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MET_ENTRY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_APS_BRG_EN, ds_met_entry_aps_brg_en, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_APS_BRG_MISMATCH_DISCARD, ds_met_entry_aps_brg_mismatch_discard, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_APS_BRG_PROTECT_PATH, ds_met_entry_aps_brg_protect_path, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_END_LOCAL_REP, ds_met_entry_end_local_rep, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_IS_LINK_AGGREGATION, ds_met_entry_is_link_aggregation, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_LENGTH_ADJUST_TYPE, ds_met_entry_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_NEXTHOP_EXT, ds_met_entry_nexthop_ext, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_NEXT_MET_ENTRY_PTR, ds_met_entry_next_met_entry_ptr, 18)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_PORT_CHECK_DISCARD, ds_met_entry_port_check_discard, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_REMOTE_BAY, ds_met_entry_remote_bay, 1)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_REPLICATION_CTL, ds_met_entry_replication_ctl, 27)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_UCAST_ID_LOWER, ds_met_entry_ucast_id_lower, 12)
+        DRV_FIELD_SET_CASE(DS_MET_ENTRY_UCAST_ID_UPPER, ds_met_entry_ucast_id_upper, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_APS_SELECT_VALID, ds_mpls_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_DS_FWD_PTR, ds_mpls_ds_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_EQUAL_COST_PATH_NUM2, ds_mpls_equal_cost_path_num2, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_EQUAL_COST_PATH_NUM10, ds_mpls_equal_cost_path_num10, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_FLOW_POLICER_PTR7TO0, ds_mpls_flow_policer_ptr7to0, 8)
+        DRV_FIELD_SET_CASE(DS_MPLS_FLOW_POLICER_PTR10TO8, ds_mpls_flow_policer_ptr10to8, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_FLOW_POLICER_PTR11, ds_mpls_flow_policer_ptr11, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_FLOW_POLICER_PTR15TO12, ds_mpls_flow_policer_ptr15to12, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_IS_VC_LABEL, ds_mpls_is_vc_label, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_LLSP_PRIORITY, ds_mpls_llsp_priority, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_LLSP_VALID, ds_mpls_llsp_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_CHECK, ds_mpls_oam_check, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OFFSET_BYTES, ds_mpls_offset_bytes, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OVER_WRITE_PRIORITY, ds_mpls_over_write_priority, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_PACKET_TYPE, ds_mpls_packet_type, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_PRIORITY_PATH_EN, ds_mpls_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_SBIT, ds_mpls_sbit, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_SCONTINUE, ds_mpls_scontinue, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_STATS_PTR_MODE, ds_mpls_stats_ptr_mode, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_S_BIT_CHECK_EN, ds_mpls_s_bit_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_TTL_CHECK_MODE, ds_mpls_ttl_check_mode, 2)
+        DRV_FIELD_SET_CASE(DS_MPLS_TTL_DECREASE_MODE, ds_mpls_ttl_decrease_mode, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_TTL_THRESHHOLD, ds_mpls_ttl_threshhold, 7)
+        DRV_FIELD_SET_CASE(DS_MPLS_USE_LABEL_EXP, ds_mpls_use_label_exp, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_USE_LABEL_TTL, ds_mpls_use_label_ttl, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NEXTHOP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_BY_PASS_ALL, ds_nexthop_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_COPY_CTAG_COS, ds_nexthop_copy_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_CVLAN_TAGGED, ds_nexthop_cvlan_tagged, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_DERIVE_STAG_COS, ds_nexthop_derive_stag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_DEST_VLAN_PTR, ds_nexthop_dest_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_L2EDIT_PTR, ds_nexthop_l2edit_ptr, 12)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_L2_REWRITE_TYPE, ds_nexthop_l2_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_L3EDIT_PTR, ds_nexthop_l3edit_ptr, 18)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_L3_REWRITE_TYPE, ds_nexthop_l3_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_MTU_CHECK_EN, ds_nexthop_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_OUTPUT_CVLAN_ID_VALID, ds_nexthop_output_cvlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_OUTPUT_SVLAN_ID_VALID, ds_nexthop_output_svlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_PAYLOAD_OPERATION, ds_nexthop_payload_operation, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_REPLACE_CTAG_COS, ds_nexthop_replace_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_REPLACE_DSCP, ds_nexthop_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_SERVICE_ACL_QOS_EN, ds_nexthop_service_acl_qos_en, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_SERVICE_POLICER_VLD, ds_nexthop_service_policer_vld, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_STAG_CFI, ds_nexthop_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_STAG_COS, ds_nexthop_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_SVLAN_TAGGED, ds_nexthop_svlan_tagged, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP_TAGGED_MODE, ds_nexthop_tagged_mode, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NEXTHOP8W:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_BY_PASS_ALL, ds_nexthop8w_by_pass_all, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_COMMUNITY_PORT, ds_nexthop8w_community_port, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_COPY_CTAG_COS, ds_nexthop8w_copy_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_CVLAN_TAGGED, ds_nexthop8w_cvlan_tagged, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_DERIVE_STAG_COS, ds_nexthop8w_derive_stag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_DEST_VLAN_PTR, ds_nexthop8w_dest_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L2EDIT_PTR11TO0, ds_nexthop8w_l2edit_ptr11to0, 12)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L2EDIT_PTR18TO12, ds_nexthop8w_l2edit_ptr18to12, 7)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L2_REWRITE_TYPE, ds_nexthop8w_l2_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L3EDIT_PTR18, ds_nexthop8w_l3edit_ptr18, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L3EDIT_PTR19, ds_nexthop8w_l3edit_ptr19, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L3EDIT_PTR170, ds_nexthop8w_l3edit_ptr170, 18)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_L3_REWRITE_TYPE, ds_nexthop8w_l3_rewrite_type, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_MTU_CHECK_EN, ds_nexthop8w_mtu_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_OUTPUT_CVLAN_ID_EXT, ds_nexthop8w_output_cvlan_id_ext, 12)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_OUTPUT_CVLAN_ID_VALID, ds_nexthop8w_output_cvlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_OUTPUT_CVLAN_ID_VALID_EXT, ds_nexthop8w_output_cvlan_id_valid_ext, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_OUTPUT_SVLAN_ID_EXT, ds_nexthop8w_output_svlan_id_ext, 12)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_OUTPUT_SVLAN_ID_VALID, ds_nexthop8w_output_svlan_id_valid, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_OUTPUT_SVLAN_ID_VALID_EXT, ds_nexthop8w_output_svlan_id_valid_ext, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_PAYLOAD_OPERATION, ds_nexthop8w_payload_operation, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_REPLACE_CTAG_COS, ds_nexthop8w_replace_ctag_cos, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_REPLACE_DSCP, ds_nexthop8w_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SERVICE_ACL_QOS_EN, ds_nexthop8w_service_acl_qos_en, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SERVICE_ID, ds_nexthop8w_service_id, 14)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SERVICE_ID_EN, ds_nexthop8w_service_id_en, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SERVICE_POLICER_VALID, ds_nexthop8w_service_policer_valid, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_STAG_CFI, ds_nexthop8w_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_STAG_COS, ds_nexthop8w_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SVLAN_TAGGED, ds_nexthop8w_svlan_tagged, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SVLAN_TPID, ds_nexthop8w_svlan_tpid, 2)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_SVLAN_TPID_EN, ds_nexthop8w_svlan_tpid_en, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_TAGGED_MODE, ds_nexthop8w_tagged_mode, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_TUNNEL_MTU_CHECK, ds_nexthop8w_tunnel_mtu_check, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_TUNNEL_UPDATE_DISABLE, ds_nexthop8w_tunnel_update_disable, 1)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_VPLS_DEST_PORT, ds_nexthop8w_vpls_dest_port, 13)
+        DRV_FIELD_SET_CASE(DS_NEXTHOP8W_VPLS_PORT_CHECK, ds_nexthop8w_vpls_port_check, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_POLICER:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_POLICER_COLOR_BLIND_MODE, ds_policer_color_blind_mode, 1)
+        DRV_FIELD_SET_CASE(DS_POLICER_COLOR_DROP_CODE, ds_policer_color_drop_code, 2)
+        DRV_FIELD_SET_CASE(DS_POLICER_COMMIT_COUNT_LOWER, ds_policer_commit_count_lower, 12)
+        DRV_FIELD_SET_CASE(DS_POLICER_COMMIT_COUNT_UPPER, ds_policer_commit_count_upper, 10)
+        DRV_FIELD_SET_CASE(DS_POLICER_OLD_TS, ds_policer_old_ts, 12)
+        DRV_FIELD_SET_CASE(DS_POLICER_PEAK_COUNT, ds_policer_peak_count, 22)
+        DRV_FIELD_SET_CASE(DS_POLICER_PROFILE, ds_policer_profile, 8)
+        DRV_FIELD_SET_CASE(DS_POLICER_SR_TCM_MODE, ds_policer_sr_tcm_mode, 1)
+        DRV_FIELD_SET_CASE(DS_POLICER_STATS_EN, ds_policer_stats_en, 1)
+        DRV_FIELD_SET_CASE(DS_POLICER_USE_LAYER3_LENGTH, ds_policer_use_layer3_length, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FORWARDING_STATS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_FORWARDING_STATS_BYTE_COUNT_LOWER, ds_forwarding_stats_byte_count_lower, 32)
+        DRV_FIELD_SET_CASE(DS_FORWARDING_STATS_BYTE_COUNT_UPPER0, ds_forwarding_stats_byte_count_upper0, 2)
+        DRV_FIELD_SET_CASE(DS_FORWARDING_STATS_BYTE_COUNT_UPPER, ds_forwarding_stats_byte_count_upper, 3)
+        DRV_FIELD_SET_CASE(DS_FORWARDING_STATS_PACKET_COUNT, ds_forwarding_stats_packet_count, 32)
+        DRV_FIELD_SET_CASE(DS_FORWARDING_STATS_USE_LAYER3_LENGTH, ds_forwarding_stats_use_layer3_length, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VLAN:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_VLAN_ARP_EXCEPTION_TYPE, ds_vlan_arp_exception_type, 2)
+        DRV_FIELD_SET_CASE(DS_VLAN_BRG_DIS, ds_vlan_brg_dis, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_DHCP_EXCEPTION_TYPE, ds_vlan_dhcp_exception_type, 2)
+        DRV_FIELD_SET_CASE(DS_VLAN_ETHER_OAMV, ds_vlan_ether_oamv, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_E_ETHER_OAMV, ds_vlan_e_ether_oamv, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_E_MD_LEVEL, ds_vlan_e_md_level, 3)
+        DRV_FIELD_SET_CASE(DS_VLAN_IF_ID, ds_vlan_if_id, 10)
+        DRV_FIELD_SET_CASE(DS_VLAN_IGMP_SNOOP_EN, ds_vlan_igmp_snoop_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_LEARN_DIS, ds_vlan_learn_dis, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_MAC_SEC_VLAN_DIS, ds_vlan_mac_sec_vlan_dis, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_MD_LEVEL, ds_vlan_md_level, 3)
+        DRV_FIELD_SET_CASE(DS_VLAN_PFM, ds_vlan_pfm, 2)
+        DRV_FIELD_SET_CASE(DS_VLAN_REC_EN, ds_vlan_rec_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_REPLACE_DSCP, ds_vlan_replace_dscp, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_ROUTE_DISABLE, ds_vlan_route_disable, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_SRC_QUE_SELECT, ds_vlan_src_que_select, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_STP_ID6, ds_vlan_stp_id6, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_STP_ID, ds_vlan_stp_id, 6)
+        DRV_FIELD_SET_CASE(DS_VLAN_TRANS_EN, ds_vlan_trans_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_V4_MCAST_EN, ds_vlan_v4_mcast_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_V4_UCAST_EN, ds_vlan_v4_ucast_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_V4_UCAST_SA_TYPE, ds_vlan_v4_ucast_sa_type, 2)
+        DRV_FIELD_SET_CASE(DS_VLAN_V6_MCAST_EN, ds_vlan_v6_mcast_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_V6_UCAST_EN, ds_vlan_v6_ucast_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_V6_UCAST_SA_TYPE, ds_vlan_v6_ucast_sa_type, 2)
+        DRV_FIELD_SET_CASE(DS_VLAN_VLAN_CROSS_CONNECT, ds_vlan_vlan_cross_connect, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_VLAN_SEC_EXP_EN, ds_vlan_vlan_sec_exp_en, 1)
+        DRV_FIELD_SET_CASE(DS_VLAN_VRF_ID, ds_vlan_vrf_id, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VLAN_STATUS:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_VLAN_STATUS_VLANID_VALIDH, ds_vlan_status_vlanid_validh, 32)
+        DRV_FIELD_SET_CASE(DS_VLAN_STATUS_VLANID_VALIDL, ds_vlan_status_vlanid_validl, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MAC_APS_SELECT_PROTECT_PATH, ds_mac_aps_select_protect_path, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_APS_SELECT_VALID, ds_mac_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_BRG_APS_SELECT_VALID, ds_mac_brg_aps_select_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_EQUAL_COST_PATH_NUM10, ds_mac_equal_cost_path_num10, 2)
+        DRV_FIELD_SET_CASE(DS_MAC_ESP_KEY_OR_OAM, ds_mac_esp_key_or_oam, 13)
+        DRV_FIELD_SET_CASE(DS_MAC_EXCEPTION_SUB_INDEX, ds_mac_exception_sub_index, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_FWD_PTR, ds_mac_fwd_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_MAC_GLOBAL_SRC_PORT, ds_mac_global_src_port, 13)
+        DRV_FIELD_SET_CASE(DS_MAC_LEARN_EN, ds_mac_learn_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_LEARN_SOURCE0, ds_mac_learn_source0, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_LEARN_SOURCE1, ds_mac_learn_source1, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_MAC_DA_EXCEPTION_EN, ds_mac_mac_da_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_MAC_KNOWN, ds_mac_mac_known, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_MAC_SA_EXCEPTION_EN, ds_mac_mac_sa_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_MCAST_DISCARD, ds_mac_mcast_discard, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_PRIORITY_PATH_EN, ds_mac_priority_path_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_PROTO_EXCEPTION_EN, ds_mac_proto_exception_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_SOURCE_PORT_CHECK_EN, ds_mac_source_port_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_SRC_DISCARD, ds_mac_src_discard, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_SRC_MISMATCH_DISCARD, ds_mac_src_mismatch_discard, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_SRC_MISMATCH_LEARN_EN, ds_mac_src_mismatch_learn_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_STORM_CTL_EN, ds_mac_storm_ctl_en, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_UCAST_DISCARD, ds_mac_ucast_discard, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FWD:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_FWD_APS_SELECT_GROUP_VALID, ds_fwd_aps_select_group_valid, 1)
+        DRV_FIELD_SET_CASE(DS_FWD_APS_TYPE, ds_fwd_aps_type, 2)
+        DRV_FIELD_SET_CASE(DS_FWD_CRITICAL_PACKET, ds_fwd_critical_packet, 1)
+        DRV_FIELD_SET_CASE(DS_FWD_DEST_MAP, ds_fwd_dest_map, 22)
+        DRV_FIELD_SET_CASE(DS_FWD_LENGTH_ADJUST_TYPE, ds_fwd_length_adjust_type, 1)
+        DRV_FIELD_SET_CASE(DS_FWD_NEXT_HOP_EXT, ds_fwd_next_hop_ext, 1)
+        DRV_FIELD_SET_CASE(DS_FWD_NEXT_HOP_PTR, ds_fwd_next_hop_ptr, 20)
+        DRV_FIELD_SET_CASE(DS_FWD_SEND_LOCAL_PHY_PORT, ds_fwd_send_local_phy_port, 1)
+        DRV_FIELD_SET_CASE(DS_FWD_SEQUENCE_NUMBER_CHK_EN, ds_fwd_sequence_number_chk_en, 1)
+        DRV_FIELD_SET_CASE(DS_FWD_STATS_PTR_LOWER, ds_fwd_stats_ptr_lower, 12)
+        DRV_FIELD_SET_CASE(DS_FWD_STATS_PTR_UPPER, ds_fwd_stats_ptr_upper, 4)
+        DRV_FIELD_SET_CASE(DS_FWD_STATS_VALID, ds_fwd_stats_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_CHAN:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_ACTIVE_MAX_MDLVL, ds_eth_oam_chan_active_max_mdlvl, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEM_INDEX0, ds_eth_oam_chan_mem_index0, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEM_INDEX1, ds_eth_oam_chan_mem_index1, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEM_ON_REMOTE_CHIP, ds_eth_oam_chan_mem_on_remote_chip, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX2, ds_eth_oam_chan_mep_index2, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX3, ds_eth_oam_chan_mep_index3, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX4, ds_eth_oam_chan_mep_index4, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX5, ds_eth_oam_chan_mep_index5, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX6, ds_eth_oam_chan_mep_index6, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX7, ds_eth_oam_chan_mep_index7, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_OAM_DEST_CHIP_ID1_TO0, ds_eth_oam_chan_oam_dest_chip_id1_to0, 2)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_OAM_DEST_CHIP_ID4_TO2, ds_eth_oam_chan_oam_dest_chip_id4_to2, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_PASSIVE_MAX_MD_LVL, ds_eth_oam_chan_passive_max_md_lvl, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_CHAN_PASSIVE_VALID, ds_eth_oam_chan_passive_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_PBT_OAM_CHAN:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_PBT_OAM_CHAN_MD_LVL, ds_mpls_pbt_oam_chan_md_lvl, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_PBT_OAM_CHAN_MD_LVL_CHECK_VALID, ds_mpls_pbt_oam_chan_md_lvl_check_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_PBT_OAM_CHAN_MEP_IDEX, ds_mpls_pbt_oam_chan_mep_idex, 15)
+        DRV_FIELD_SET_CASE(DS_MPLS_PBT_OAM_CHAN_MEP_ON_REMOTE_CHIP, ds_mpls_pbt_oam_chan_mep_on_remote_chip, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_PBT_OAM_CHAN_RMEP_ID, ds_mpls_pbt_oam_chan_rmep_id, 13)
+        DRV_FIELD_SET_CASE(DS_MPLS_PBT_OAM_CHAN_RMEP_ID_CHECK_VALID, ds_mpls_pbt_oam_chan_rmep_id_check_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_RMEP_CHAN:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_RMEP_CHAN_RMEP_INDEX0, ds_rmep_chan_rmep_index0, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_MEP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_ACTIVE, ds_eth_mep_active, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_CCI_EN, ds_eth_mep_cci_en, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_CCI_WHILE, ds_eth_mep_cci_while, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_CCM_SEP_NUM, ds_eth_mep_ccm_sep_num, 32)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_DEST_CHIP, ds_eth_mep_dest_chip, 5)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_DEST_ID, ds_eth_mep_dest_id, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_D_MEG_LVL, ds_eth_mep_d_meg_lvl, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_D_MEG_LVL_TIMER, ds_eth_mep_d_meg_lvl_timer, 4)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_D_MISMERGE, ds_eth_mep_d_mismerge, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_D_MISMERGE_TIMER, ds_eth_mep_d_mismerge_timer, 4)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_D_UNEXP_MEP, ds_eth_mep_d_unexp_mep, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_D_UNEXP_MEP_TIMER, ds_eth_mep_d_unexp_mep_timer, 4)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_ENABLE_PM, ds_eth_mep_enable_pm, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_IS_MPLS, ds_eth_mep_is_mpls, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_IS_REMOTE, ds_eth_mep_is_remote, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_IS_UP, ds_eth_mep_is_up, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_MA_ID_CHECK_DISABLE, ds_eth_mep_ma_id_check_disable, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_MA_INDEX, ds_eth_mep_ma_index, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_MEP_ID, ds_eth_mep_mep_id, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_MEP_PRIMARY_VID, ds_eth_mep_mep_primary_vid, 12)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_MEP_TYPE, ds_eth_mep_mep_type, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_PORT_ID, ds_eth_mep_port_id, 8)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_PRESENT_RDI, ds_eth_mep_present_rdi, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_PRESENT_TRAFFIC, ds_eth_mep_present_traffic, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_PRESENT_TRAFFIC_CHECK_EN, ds_eth_mep_present_traffic_check_en, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_RMEP_LAST_RDI, ds_eth_mep_rmep_last_rdi, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_SEQ_NUM_EN, ds_eth_mep_seq_num_en, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_SHARE_MAC_EN, ds_eth_mep_share_mac_en, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_TPID_TYPE, ds_eth_mep_tpid_type, 2)
+        DRV_FIELD_SET_CASE(DS_ETH_MEP_TX_WITH_SEND_ID, ds_eth_mep_tx_with_send_id, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_RMEP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_ACTIVE, ds_eth_rmep_active, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_CCM_SEP_NUM, ds_eth_rmep_ccm_sep_num, 32)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_CNT_SHIFT_WHILE, ds_eth_rmep_cnt_shift_while, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_D_LOC, ds_eth_rmep_d_loc, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_D_UNEXP_PERIOD, ds_eth_rmep_d_unexp_period, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_D_UNEXP_PERIOD_TIMER, ds_eth_rmep_d_unexp_period_timer, 4)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_EXP_CCM_NUM, ds_eth_rmep_exp_ccm_num, 8)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_FIRST_PKT_RX, ds_eth_rmep_first_pkt_rx, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_IS_MPLS, ds_eth_rmep_is_mpls, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_IS_REMOTE, ds_eth_rmep_is_remote, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_MAC_ADDR_UPDATE_DISABLE, ds_eth_rmep_mac_addr_update_disable, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_MEP_INDEX, ds_eth_rmep_mep_index, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_RMEP_LAST_INTF_STATUS, ds_eth_rmep_rmep_last_intf_status, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_RMEP_LAST_PORT_STATUS, ds_eth_rmep_rmep_last_port_status, 2)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_RMEP_LAST_RDI, ds_eth_rmep_rmep_last_rdi, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_RMEP_MAC_SA31_TO0, ds_eth_rmep_rmep_mac_sa31_to0, 32)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_RMEP_MAC_SA47_TO32, ds_eth_rmep_rmep_mac_sa47_to32, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_RMEP_WHILE, ds_eth_rmep_rmep_while, 4)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_SEQ_NUM_EN, ds_eth_rmep_seq_num_en, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_RMEP_SEQ_NUM_FAIL_COUNTER, ds_eth_rmep_seq_num_fail_counter, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_MEP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_ACTIVE, ds_mpls_mep_active, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_CCI_EN, ds_mpls_mep_cci_en, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_CCI_WHILE, ds_mpls_mep_cci_while, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_DEST_CHIP, ds_mpls_mep_dest_chip, 5)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_DEST_ID, ds_mpls_mep_dest_id, 16)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_D_EXCESS, ds_mpls_mep_d_excess, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_D_LOCV, ds_mpls_mep_d_locv, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_D_TTSI_MISMATCH, ds_mpls_mep_d_ttsi_mismatch, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_D_TTSI_MISMERGE, ds_mpls_mep_d_ttsi_mismerge, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_EXPECTEDCVH, ds_mpls_mep_expectedcvh, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_EXPECTED_CV, ds_mpls_mep_expected_cv, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_FIRST_PKT_RX, ds_mpls_mep_first_pkt_rx, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_IS_AVAILABLE, ds_mpls_mep_is_available, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_IS_MPLS, ds_mpls_mep_is_mpls, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_IS_REMOTE, ds_mpls_mep_is_remote, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_IS_UP, ds_mpls_mep_is_up, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_MA_INDEX, ds_mpls_mep_ma_index, 15)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_MEP_TYPE, ds_mpls_mep_mep_type, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_NEAR_END_FSM_UP_DISABLE, ds_mpls_mep_near_end_fsm_up_disable, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_PERIOD, ds_mpls_mep_period, 8)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_RECV_FDI, ds_mpls_mep_recv_fdi, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_T1_VALID, ds_mpls_mep_t1_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_T1_WHILE, ds_mpls_mep_t1_while, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_T2_PENDING_VALID, ds_mpls_mep_t2_pending_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_TEN_CYCLE_EXPECTEDCV, ds_mpls_mep_ten_cycle_expectedcv, 7)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_TEN_UNEXPCV, ds_mpls_mep_ten_unexpcv, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_MEP_TRI_CYCLE_UNEXPCV, ds_mpls_mep_tri_cycle_unexpcv, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_RMEP:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_ACTIVE, ds_mpls_rmep_active, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_BDI_TX, ds_mpls_rmep_bdi_tx, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_BDI_WHILE, ds_mpls_rmep_bdi_while, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_CCI_WHILE, ds_mpls_rmep_cci_while, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_DEFECT_LOCATION, ds_mpls_rmep_defect_location, 16)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_DEFECT_TYPE, ds_mpls_rmep_defect_type, 6)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_DEST_CHIP, ds_mpls_rmep_dest_chip, 5)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_DEST_ID, ds_mpls_rmep_dest_id, 16)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_FAR_END_FSM_UP_DISABLE, ds_mpls_rmep_far_end_fsm_up_disable, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_IS_AVAILABLE, ds_mpls_rmep_is_available, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_IS_MPLS, ds_mpls_rmep_is_mpls, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_IS_REMOTE, ds_mpls_rmep_is_remote, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_MA_INDEX, ds_mpls_rmep_ma_index, 15)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_PERIOD, ds_mpls_rmep_period, 8)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_RMEP_WHILE, ds_mpls_rmep_rmep_while, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_RX_BDI, ds_mpls_rmep_rx_bdi, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_T3_CYCLE, ds_mpls_rmep_t3_cycle, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_T3_VALID, ds_mpls_rmep_t3_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_T3_WHILE, ds_mpls_rmep_t3_while, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_T4_VALID, ds_mpls_rmep_t4_valid, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_TEN_BDILOOP, ds_mpls_rmep_ten_bdiloop, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_TEN_BDI, ds_mpls_rmep_ten_bdi, 4)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_TRI_BDI_LOOP, ds_mpls_rmep_tri_bdi_loop, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_RMEP_TRI_CYCLE_BDI, ds_mpls_rmep_tri_cycle_bdi, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_CFI, ds_mac_key_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_COS, ds_mac_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_GBL_SRC_PORT, ds_mac_key_gbl_src_port, 13)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_LAYER2_HEADER_PROTOCOL, ds_mac_key_layer2_header_protocol, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_LAYER2_TYPE, ds_mac_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_LAYER3_TYPE, ds_mac_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_MAPPED_MAC_DA_LOWER, ds_mac_key_mapped_mac_da_lower, 32)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_MAPPED_MAC_DA_UPPER, ds_mac_key_mapped_mac_da_upper, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_MAPPED_VLAN_ID, ds_mac_key_mapped_vlan_id, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_TABLE_ID0, ds_mac_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_TABLE_ID1, ds_mac_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_VLAN_ID1, ds_mac_key_vlan_id1, 12)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_VLAN_ID2, ds_mac_key_vlan_id2, 12)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_VLAN_PTRH, ds_mac_key_vlan_ptrh, 10)
+        DRV_FIELD_SET_CASE(DS_MAC_KEY_VLAN_PTRL, ds_mac_key_vlan_ptrl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MAC_HASH_KEY0_MAPPED_MACH, ds_mac_hash_key0_mapped_mach, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_HASH_KEY0_MAPPED_MACL, ds_mac_hash_key0_mapped_macl, 32)
+        DRV_FIELD_SET_CASE(DS_MAC_HASH_KEY0_MAPPED_VLANID, ds_mac_hash_key0_mapped_vlanid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MAC_HASH_KEY1_MAPPED_MACH, ds_mac_hash_key1_mapped_mach, 16)
+        DRV_FIELD_SET_CASE(DS_MAC_HASH_KEY1_MAPPED_MACL, ds_mac_hash_key1_mapped_macl, 32)
+        DRV_FIELD_SET_CASE(DS_MAC_HASH_KEY1_MAPPED_VLANID, ds_mac_hash_key1_mapped_vlanid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_ACL_LABELH, ds_acl_mac_key_acl_labelh, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_ACL_LABELL, ds_acl_mac_key_acl_labell, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_COS, ds_acl_mac_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_CTAG_CFI, ds_acl_mac_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_CTAG_COS, ds_acl_mac_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_CVLAN_ID4TO0, ds_acl_mac_key_cvlan_id4to0, 5)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_CVLAN_ID11TO5, ds_acl_mac_key_cvlan_id11to5, 7)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_ETHER_TYPE, ds_acl_mac_key_ether_type, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_IS_IP_KEY, ds_acl_mac_key_is_ip_key, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_IS_LABEL, ds_acl_mac_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_L2_QOS_LABEL, ds_acl_mac_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_L3_QOS_LABEL, ds_acl_mac_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_LAYER2_TYPE, ds_acl_mac_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_LAYER3_TYPE, ds_acl_mac_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_MAC_DAH, ds_acl_mac_key_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_MAC_DAL, ds_acl_mac_key_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_MAC_SAH, ds_acl_mac_key_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_MAC_SAL, ds_acl_mac_key_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_QOS_LABEL, ds_acl_mac_key_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_STAG_CFI, ds_acl_mac_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_STAG_COS, ds_acl_mac_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_SVLAN_ID, ds_acl_mac_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_TABLEID0, ds_acl_mac_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_TABLEID1, ds_acl_mac_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_TABLEID2, ds_acl_mac_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_TABLEID3, ds_acl_mac_key_tableid3, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MAC_KEY_VLAN_PTR, ds_acl_mac_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_ACL_LABELH, ds_qos_mac_key_acl_labelh, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_ACL_LABELL, ds_qos_mac_key_acl_labell, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_COS, ds_qos_mac_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_CTAG_CFI, ds_qos_mac_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_CTAG_COS, ds_qos_mac_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_CVLAN_ID4TO0, ds_qos_mac_key_cvlan_id4to0, 5)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_CVLAN_ID11TO5, ds_qos_mac_key_cvlan_id11to5, 7)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_ETHER_TYPE, ds_qos_mac_key_ether_type, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_IS_IP_KEY, ds_qos_mac_key_is_ip_key, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_IS_LABEL, ds_qos_mac_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_L2_QOS_LABEL, ds_qos_mac_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_L3_QOS_LABEL, ds_qos_mac_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_LAYER2_TYPE, ds_qos_mac_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_LAYER3_TYPE, ds_qos_mac_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_MAC_DAH, ds_qos_mac_key_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_MAC_DAL, ds_qos_mac_key_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_MAC_SAH, ds_qos_mac_key_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_MAC_SAL, ds_qos_mac_key_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_QOS_LABEL, ds_qos_mac_key_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_STAG_CFI, ds_qos_mac_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_STAG_COS, ds_qos_mac_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_SVLAN_ID, ds_qos_mac_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_TABLEID0, ds_qos_mac_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_TABLEID1, ds_qos_mac_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_TABLEID2, ds_qos_mac_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_TABLEID3, ds_qos_mac_key_tableid3, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MAC_KEY_VLAN_PTR, ds_qos_mac_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_IPV4_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_ACL_LABEL_LOWER, ds_acl_ipv4_key_acl_label_lower, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_ACL_LABEL_UPPER, ds_acl_ipv4_key_acl_label_upper, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_COS, ds_acl_ipv4_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_CTAG_CFI, ds_acl_ipv4_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_CTAG_COS, ds_acl_ipv4_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_CVLAN_ID, ds_acl_ipv4_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_DSCP, ds_acl_ipv4_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_FRAG_INFO, ds_acl_ipv4_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IP_DA, ds_acl_ipv4_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IP_HEADER_ERROR, ds_acl_ipv4_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IP_OPTIONS, ds_acl_ipv4_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IP_SA, ds_acl_ipv4_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IS_APPLICATION, ds_acl_ipv4_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IS_IP_KEY, ds_acl_ipv4_key_is_ip_key, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IS_LABEL, ds_acl_ipv4_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IS_MPLS_KEY, ds_acl_ipv4_key_is_mpls_key, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IS_TCP, ds_acl_ipv4_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_IS_UDP, ds_acl_ipv4_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_L2_QOS_LABEL, ds_acl_ipv4_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_L3_QOS_LABEL, ds_acl_ipv4_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_L4INFO_MAPPED, ds_acl_ipv4_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_L4_DEST_PORT, ds_acl_ipv4_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_L4_SOURCE_PORT, ds_acl_ipv4_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_LAYER2_TYPE, ds_acl_ipv4_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_LAYER3_TYPE, ds_acl_ipv4_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_MACDA_LOWER, ds_acl_ipv4_key_macda_lower, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_MACDA_UPPER, ds_acl_ipv4_key_macda_upper, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_MAC_SA_LOWER, ds_acl_ipv4_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_MAC_SA_UPPER, ds_acl_ipv4_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_QOS_LABEL, ds_acl_ipv4_key_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_ROUTED_PACKET, ds_acl_ipv4_key_routed_packet, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_STAG_CFI, ds_acl_ipv4_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_STAG_COS, ds_acl_ipv4_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_SVLAN_ID, ds_acl_ipv4_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_TABLEID0, ds_acl_ipv4_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_TABLEID1, ds_acl_ipv4_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_TABLEID2, ds_acl_ipv4_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV4_KEY_TABLEID3, ds_acl_ipv4_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_IPV4_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_ACL_LABEL_LOWER, ds_qos_ipv4_key_acl_label_lower, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_ACL_LABEL_UPPER, ds_qos_ipv4_key_acl_label_upper, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_COS, ds_qos_ipv4_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_CTAG_CFI, ds_qos_ipv4_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_CTAG_COS, ds_qos_ipv4_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_CVLAN_ID, ds_qos_ipv4_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_DSCP, ds_qos_ipv4_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_FRAG_INFO, ds_qos_ipv4_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IP_DA, ds_qos_ipv4_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IP_HEADER_ERROR, ds_qos_ipv4_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IP_OPTIONS, ds_qos_ipv4_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IP_SA, ds_qos_ipv4_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IS_APPLICATION, ds_qos_ipv4_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IS_IP_KEY, ds_qos_ipv4_key_is_ip_key, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IS_LABEL, ds_qos_ipv4_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IS_MPLS_KEY, ds_qos_ipv4_key_is_mpls_key, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IS_TCP, ds_qos_ipv4_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_IS_UDP, ds_qos_ipv4_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_L2_QOS_LABEL, ds_qos_ipv4_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_L3_QOS_LABEL, ds_qos_ipv4_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_L4INFO_MAPPED, ds_qos_ipv4_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_L4_DEST_PORT, ds_qos_ipv4_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_L4_SOURCE_PORT, ds_qos_ipv4_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_LAYER2_TYPE, ds_qos_ipv4_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_LAYER3_TYPE, ds_qos_ipv4_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_MACDA_LOWER, ds_qos_ipv4_key_macda_lower, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_MACDA_UPPER, ds_qos_ipv4_key_macda_upper, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_MAC_SA_LOWER, ds_qos_ipv4_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_MAC_SA_UPPER, ds_qos_ipv4_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_QOS_LABEL, ds_qos_ipv4_key_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_ROUTED_PACKET, ds_qos_ipv4_key_routed_packet, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_STAG_CFI, ds_qos_ipv4_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_STAG_COS, ds_qos_ipv4_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_SVLAN_ID, ds_qos_ipv4_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_TABLEID0, ds_qos_ipv4_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_TABLEID1, ds_qos_ipv4_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_TABLEID2, ds_qos_ipv4_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV4_KEY_TABLEID3, ds_qos_ipv4_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_MPLS_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_ACL_LABEL_LOWER, ds_acl_mpls_key_acl_label_lower, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_ACL_LABEL_UPPER, ds_acl_mpls_key_acl_label_upper, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_COS, ds_acl_mpls_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_CTAG_CFI, ds_acl_mpls_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_CTAG_COS, ds_acl_mpls_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_CVLAN_ID, ds_acl_mpls_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_IS_IP_KEY, ds_acl_mpls_key_is_ip_key, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_IS_LABEL, ds_acl_mpls_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_IS_MPLS_KEY, ds_acl_mpls_key_is_mpls_key, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_L2_QOS_LABEL, ds_acl_mpls_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_L3_QOS_LABEL, ds_acl_mpls_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_LAYER2_TYPE, ds_acl_mpls_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MACDA_LOWER, ds_acl_mpls_key_macda_lower, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MACDA_UPPER, ds_acl_mpls_key_macda_upper, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MAC_SA_LOWER, ds_acl_mpls_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MAC_SA_UPPER, ds_acl_mpls_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL0, ds_acl_mpls_key_mpls_label0, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL1, ds_acl_mpls_key_mpls_label1, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL2, ds_acl_mpls_key_mpls_label2, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL327TO0, ds_acl_mpls_key_mpls_label327to0, 28)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL331TO28, ds_acl_mpls_key_mpls_label331to28, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_QOS_LABEL, ds_acl_mpls_key_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_ROUTE_PKT, ds_acl_mpls_key_route_pkt, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_STAG_CFI, ds_acl_mpls_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_STAG_COS, ds_acl_mpls_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_SVLAN_ID, ds_acl_mpls_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_TABLEID0, ds_acl_mpls_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_TABLEID1, ds_acl_mpls_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_TABLEID2, ds_acl_mpls_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_MPLS_KEY_TABLEID3, ds_acl_mpls_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_MPLS_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_ACL_LABEL_LOWER, ds_qos_mpls_key_acl_label_lower, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_ACL_LABEL_UPPER, ds_qos_mpls_key_acl_label_upper, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_COS, ds_qos_mpls_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_CTAG_CFI, ds_qos_mpls_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_CTAG_COS, ds_qos_mpls_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_CVLAN_ID, ds_qos_mpls_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_IS_IP_KEY, ds_qos_mpls_key_is_ip_key, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_IS_LABEL, ds_qos_mpls_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_IS_MPLS_KEY, ds_qos_mpls_key_is_mpls_key, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_L2_QOS_LABEL, ds_qos_mpls_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_L3_QOS_LABEL, ds_qos_mpls_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_LAYER2_TYPE, ds_qos_mpls_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MACDA_LOWER, ds_qos_mpls_key_macda_lower, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MACDA_UPPER, ds_qos_mpls_key_macda_upper, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MAC_SA_LOWER, ds_qos_mpls_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MAC_SA_UPPER, ds_qos_mpls_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL0, ds_qos_mpls_key_mpls_label0, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL1, ds_qos_mpls_key_mpls_label1, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL2, ds_qos_mpls_key_mpls_label2, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL327TO0, ds_qos_mpls_key_mpls_label327to0, 28)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL331TO28, ds_qos_mpls_key_mpls_label331to28, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_QOS_LABEL, ds_qos_mpls_key_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_ROUTE_PKT, ds_qos_mpls_key_route_pkt, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_STAG_CFI, ds_qos_mpls_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_STAG_COS, ds_qos_mpls_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_SVLAN_ID, ds_qos_mpls_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_TABLEID0, ds_qos_mpls_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_TABLEID1, ds_qos_mpls_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_TABLEID2, ds_qos_mpls_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_MPLS_KEY_TABLEID3, ds_qos_mpls_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_IPV6_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_ACLQOS_IPV6KEY_TABLEID7, ds_acl_ipv6_key_aclqos_ipv6key_tableid7, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_ACL_LABEL_LOWER, ds_acl_ipv6_key_acl_label_lower, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_ACL_LABEL_MIDDLE, ds_acl_ipv6_key_acl_label_middle, 2)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_ACL_LABEL_UPPER, ds_acl_ipv6_key_acl_label_upper, 2)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_COS, ds_acl_ipv6_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_CTAG_CFI, ds_acl_ipv6_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_CTAG_COS, ds_acl_ipv6_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_CVLAN_ID, ds_acl_ipv6_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_DSCP, ds_acl_ipv6_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_ETHER_TYPE, ds_acl_ipv6_key_ether_type, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_FRAG_INFO, ds_acl_ipv6_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IPV6_EXTENSION_HEADERS, ds_acl_ipv6_key_ipv6_extension_headers, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IPV6_FLOW_LABEL, ds_acl_ipv6_key_ipv6_flow_label, 20)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_DA31TO0, ds_acl_ipv6_key_ip_da31to0, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_DA63TO32, ds_acl_ipv6_key_ip_da63to32, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_DA71TO64, ds_acl_ipv6_key_ip_da71to64, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_DA103TO72, ds_acl_ipv6_key_ip_da103to72, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_DA127TO104, ds_acl_ipv6_key_ip_da127to104, 24)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_HEAD_ERROR, ds_acl_ipv6_key_ip_head_error, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_OPTIONS, ds_acl_ipv6_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_SA31TO0, ds_acl_ipv6_key_ip_sa31to0, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_SA63TO32, ds_acl_ipv6_key_ip_sa63to32, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_SA71TO64, ds_acl_ipv6_key_ip_sa71to64, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_SA103TO72, ds_acl_ipv6_key_ip_sa103to72, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IP_SA127TO104, ds_acl_ipv6_key_ip_sa127to104, 24)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IS_APPLICATION, ds_acl_ipv6_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IS_LABEL, ds_acl_ipv6_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IS_TCP, ds_acl_ipv6_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_IS_UDP, ds_acl_ipv6_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L2_QOS_LABEL, ds_acl_ipv6_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L3_QOS_LABEL, ds_acl_ipv6_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4DESTPORT_OR_L4INFO5TO0, ds_acl_ipv6_key_l4destport_or_l4info5to0, 6)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4DESTPORT_OR_L4INFO15TO6, ds_acl_ipv6_key_l4destport_or_l4info15to6, 10)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4INFO_MAPPED, ds_acl_ipv6_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4_DESTPORT, ds_acl_ipv6_key_l4_destport, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4_SOURCE_PORT3TO0, ds_acl_ipv6_key_l4_source_port3to0, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4_SOURCE_PORT11TO4, ds_acl_ipv6_key_l4_source_port11to4, 8)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_L4_SOURCE_PORT15TO12, ds_acl_ipv6_key_l4_source_port15to12, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_LAYER2_TYPE, ds_acl_ipv6_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_LAYER3_TYPE, ds_acl_ipv6_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_MAC_DA_LOWER, ds_acl_ipv6_key_mac_da_lower, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_MAC_DA_UPPER, ds_acl_ipv6_key_mac_da_upper, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_MAC_SA_LOWER, ds_acl_ipv6_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_MAC_SA_UPPER, ds_acl_ipv6_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_QOS_LABEL_LOWER, ds_acl_ipv6_key_qos_label_lower, 6)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_QOS_LABEL_UPPER, ds_acl_ipv6_key_qos_label_upper, 2)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_ROUTED_PACKET, ds_acl_ipv6_key_routed_packet, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_STAG_CFI, ds_acl_ipv6_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_STAG_COS, ds_acl_ipv6_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_SVLAN_ID, ds_acl_ipv6_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID0, ds_acl_ipv6_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID1, ds_acl_ipv6_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID2, ds_acl_ipv6_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID3, ds_acl_ipv6_key_tableid3, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID4, ds_acl_ipv6_key_tableid4, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID5, ds_acl_ipv6_key_tableid5, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_TABLEID6, ds_acl_ipv6_key_tableid6, 4)
+        DRV_FIELD_SET_CASE(DS_ACL_IPV6_KEY_VLAN_PTR, ds_acl_ipv6_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_IPV6_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_ACLQOS_IPV6KEY_TABLEID7, ds_qos_ipv6_key_aclqos_ipv6key_tableid7, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_ACL_LABEL_LOWER, ds_qos_ipv6_key_acl_label_lower, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_ACL_LABEL_MIDDLE, ds_qos_ipv6_key_acl_label_middle, 2)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_ACL_LABEL_UPPER, ds_qos_ipv6_key_acl_label_upper, 2)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_COS, ds_qos_ipv6_key_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_CTAG_CFI, ds_qos_ipv6_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_CTAG_COS, ds_qos_ipv6_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_CVLAN_ID, ds_qos_ipv6_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_DSCP, ds_qos_ipv6_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_ETHER_TYPE, ds_qos_ipv6_key_ether_type, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_FRAG_INFO, ds_qos_ipv6_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IPV6_EXTENSION_HEADERS, ds_qos_ipv6_key_ipv6_extension_headers, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IPV6_FLOW_LABEL, ds_qos_ipv6_key_ipv6_flow_label, 20)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_DA31TO0, ds_qos_ipv6_key_ip_da31to0, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_DA63TO32, ds_qos_ipv6_key_ip_da63to32, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_DA71TO64, ds_qos_ipv6_key_ip_da71to64, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_DA103TO72, ds_qos_ipv6_key_ip_da103to72, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_DA127TO104, ds_qos_ipv6_key_ip_da127to104, 24)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_HEAD_ERROR, ds_qos_ipv6_key_ip_head_error, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_OPTIONS, ds_qos_ipv6_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_SA31TO0, ds_qos_ipv6_key_ip_sa31to0, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_SA63TO32, ds_qos_ipv6_key_ip_sa63to32, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_SA71TO64, ds_qos_ipv6_key_ip_sa71to64, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_SA103TO72, ds_qos_ipv6_key_ip_sa103to72, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IP_SA127TO104, ds_qos_ipv6_key_ip_sa127to104, 24)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IS_APPLICATION, ds_qos_ipv6_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IS_LABEL, ds_qos_ipv6_key_is_label, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IS_TCP, ds_qos_ipv6_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_IS_UDP, ds_qos_ipv6_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L2_QOS_LABEL, ds_qos_ipv6_key_l2_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L3_QOS_LABEL, ds_qos_ipv6_key_l3_qos_label, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4DESTPORT_OR_L4INFO5TO0, ds_qos_ipv6_key_l4destport_or_l4info5to0, 6)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4DESTPORT_OR_L4INFO15TO6, ds_qos_ipv6_key_l4destport_or_l4info15to6, 10)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4INFO_MAPPED, ds_qos_ipv6_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4_DESTPORT, ds_qos_ipv6_key_l4_destport, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4_SOURCE_PORT3TO0, ds_qos_ipv6_key_l4_source_port3to0, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4_SOURCE_PORT11TO4, ds_qos_ipv6_key_l4_source_port11to4, 8)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_L4_SOURCE_PORT15TO12, ds_qos_ipv6_key_l4_source_port15to12, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_LAYER2_TYPE, ds_qos_ipv6_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_LAYER3_TYPE, ds_qos_ipv6_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_MAC_DA_LOWER, ds_qos_ipv6_key_mac_da_lower, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_MAC_DA_UPPER, ds_qos_ipv6_key_mac_da_upper, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_MAC_SA_LOWER, ds_qos_ipv6_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_MAC_SA_UPPER, ds_qos_ipv6_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_QOS_LABEL_LOWER, ds_qos_ipv6_key_qos_label_lower, 6)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_QOS_LABEL_UPPER, ds_qos_ipv6_key_qos_label_upper, 2)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_ROUTED_PACKET, ds_qos_ipv6_key_routed_packet, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_STAG_CFI, ds_qos_ipv6_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_STAG_COS, ds_qos_ipv6_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_SVLAN_ID, ds_qos_ipv6_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID0, ds_qos_ipv6_key_tableid0, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID1, ds_qos_ipv6_key_tableid1, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID2, ds_qos_ipv6_key_tableid2, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID3, ds_qos_ipv6_key_tableid3, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID4, ds_qos_ipv6_key_tableid4, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID5, ds_qos_ipv6_key_tableid5, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_TABLEID6, ds_qos_ipv6_key_tableid6, 4)
+        DRV_FIELD_SET_CASE(DS_QOS_IPV6_KEY_VLAN_PTR, ds_qos_ipv6_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_DSCP, ds_ipv4_ucast_route_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_FRAG_INFO, ds_ipv4_ucast_route_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IP_DA, ds_ipv4_ucast_route_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv4_ucast_route_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IP_SA, ds_ipv4_ucast_route_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv4_ucast_route_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IS_TCP, ds_ipv4_ucast_route_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IS_UDP, ds_ipv4_ucast_route_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_L4INFO_MAPPED, ds_ipv4_ucast_route_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv4_ucast_route_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv4_ucast_route_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv4_ucast_route_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_LKP_MODE, ds_ipv4_ucast_route_key_lkp_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_PBR_LABEL, ds_ipv4_ucast_route_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_TABLE_ID0, ds_ipv4_ucast_route_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_TABLE_ID1, ds_ipv4_ucast_route_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_VRF_IDH, ds_ipv4_ucast_route_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_ROUTE_KEY_VRF_IDL, ds_ipv4_ucast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_DSCP, ds_ipv4_mcast_route_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_FRAG_INFO, ds_ipv4_mcast_route_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IP_DA, ds_ipv4_mcast_route_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv4_mcast_route_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IP_SA, ds_ipv4_mcast_route_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv4_mcast_route_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IS_TCP, ds_ipv4_mcast_route_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IS_UDP, ds_ipv4_mcast_route_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_L4INFO_MAPPED, ds_ipv4_mcast_route_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv4_mcast_route_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv4_mcast_route_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv4_mcast_route_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_LKP_MODE, ds_ipv4_mcast_route_key_lkp_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_PBR_LABEL, ds_ipv4_mcast_route_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_TABLE_ID0, ds_ipv4_mcast_route_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_TABLE_ID1, ds_ipv4_mcast_route_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_VRF_IDH, ds_ipv4_mcast_route_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_ROUTE_KEY_VRF_IDL, ds_ipv4_mcast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_NAT_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_DSCP, ds_ipv4_nat_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_FRAG_INFO, ds_ipv4_nat_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_IP_DA, ds_ipv4_nat_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_IP_OPTIONS, ds_ipv4_nat_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_IP_SA, ds_ipv4_nat_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_IS_APPLICATION, ds_ipv4_nat_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_IS_TCP, ds_ipv4_nat_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_IS_UDP, ds_ipv4_nat_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_L4INFO_MAPPED, ds_ipv4_nat_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_L4_DEST_PORT, ds_ipv4_nat_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_L4_SOURCE_PORT, ds_ipv4_nat_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_LAYER4_TYPE, ds_ipv4_nat_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_LKP_MODE, ds_ipv4_nat_key_lkp_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_PBR_LABEL, ds_ipv4_nat_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_TABLE_ID0, ds_ipv4_nat_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_TABLE_ID1, ds_ipv4_nat_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_VRF_IDH, ds_ipv4_nat_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV4_NAT_KEY_VRF_IDL, ds_ipv4_nat_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_PBR_DUALDA_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_DSCP, ds_ipv4_pbr_dualda_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_FRAG_INFO, ds_ipv4_pbr_dualda_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_IP_DA, ds_ipv4_pbr_dualda_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_IP_OPTIONS, ds_ipv4_pbr_dualda_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_IP_SA, ds_ipv4_pbr_dualda_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_IS_APPLICATION, ds_ipv4_pbr_dualda_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_IS_TCP, ds_ipv4_pbr_dualda_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_IS_UDP, ds_ipv4_pbr_dualda_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_L4INFO_MAPPED, ds_ipv4_pbr_dualda_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_L4_DEST_PORT, ds_ipv4_pbr_dualda_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_L4_SOURCE_PORT, ds_ipv4_pbr_dualda_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_LAYER4_TYPE, ds_ipv4_pbr_dualda_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_LKP_MODE, ds_ipv4_pbr_dualda_key_lkp_mode, 1)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_PBR_LABEL, ds_ipv4_pbr_dualda_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_TABLE_ID0, ds_ipv4_pbr_dualda_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_TABLE_ID1, ds_ipv4_pbr_dualda_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_VRF_IDH, ds_ipv4_pbr_dualda_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV4_PBR_DUALDA_KEY_VRF_IDL, ds_ipv4_pbr_dualda_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_HASH_KEY0_KEY_MAPPED_IP, ds_ipv4_ucast_hash_key0_key_mapped_ip, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_HASH_KEY0_KEY_VRFID, ds_ipv4_ucast_hash_key0_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_HASH_KEY1_KEY_MAPPED_IP, ds_ipv4_ucast_hash_key1_key_mapped_ip, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_UCAST_HASH_KEY1_KEY_VRFID, ds_ipv4_ucast_hash_key1_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_HASH_KEY0_KEY_MAPPED_IP, ds_ipv4_mcast_hash_key0_key_mapped_ip, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_HASH_KEY0_KEY_VRFID, ds_ipv4_mcast_hash_key0_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_HASH_KEY1_KEY_MAPPED_IP, ds_ipv4_mcast_hash_key1_key_mapped_ip, 32)
+        DRV_FIELD_SET_CASE(DS_IPV4_MCAST_HASH_KEY1_KEY_VRFID, ds_ipv4_mcast_hash_key1_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_CTAG_CFI, ds_ipv6_ucast_route_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_CTAG_COS, ds_ipv6_ucast_route_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_CVLAN_ID, ds_ipv6_ucast_route_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_DSCP, ds_ipv6_ucast_route_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_DS_VLAN_PTR, ds_ipv6_ucast_route_key_ds_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_ETHER_TYPEH, ds_ipv6_ucast_route_key_ether_typeh, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_ETHER_TYPEL, ds_ipv6_ucast_route_key_ether_typel, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_FRAG_INFO, ds_ipv6_ucast_route_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_ucast_route_key_ipv6_extension_headers, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_FLOW_LABELH, ds_ipv6_ucast_route_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_FLOW_LABELL, ds_ipv6_ucast_route_key_ipv6_flow_labell, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_ucast_route_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA0, ds_ipv6_ucast_route_key_ip_da0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA1, ds_ipv6_ucast_route_key_ip_da1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA2, ds_ipv6_ucast_route_key_ip_da2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA3, ds_ipv6_ucast_route_key_ip_da3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA4, ds_ipv6_ucast_route_key_ip_da4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_HEADER_ERROR, ds_ipv6_ucast_route_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv6_ucast_route_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA0, ds_ipv6_ucast_route_key_ip_sa0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA1, ds_ipv6_ucast_route_key_ip_sa1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA2, ds_ipv6_ucast_route_key_ip_sa2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA3, ds_ipv6_ucast_route_key_ip_sa3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA4, ds_ipv6_ucast_route_key_ip_sa4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv6_ucast_route_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IS_TCP, ds_ipv6_ucast_route_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IS_UDP, ds_ipv6_ucast_route_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv6_ucast_route_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_L4_INFO_MAPPED, ds_ipv6_ucast_route_key_l4_info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv6_ucast_route_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_LAYER2_TYPE, ds_ipv6_ucast_route_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_LAYER3_TYPE, ds_ipv6_ucast_route_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv6_ucast_route_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_DAH, ds_ipv6_ucast_route_key_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_DAL, ds_ipv6_ucast_route_key_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_SAH, ds_ipv6_ucast_route_key_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_SAL, ds_ipv6_ucast_route_key_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_PBR_LABEL, ds_ipv6_ucast_route_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_SCVLAN_ID, ds_ipv6_ucast_route_key_scvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_STAG_CFI, ds_ipv6_ucast_route_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_STAG_COS, ds_ipv6_ucast_route_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID0, ds_ipv6_ucast_route_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID1, ds_ipv6_ucast_route_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID2, ds_ipv6_ucast_route_key_table_id2, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID3, ds_ipv6_ucast_route_key_table_id3, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID4, ds_ipv6_ucast_route_key_table_id4, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID5, ds_ipv6_ucast_route_key_table_id5, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID6, ds_ipv6_ucast_route_key_table_id6, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_VRF_IDH, ds_ipv6_ucast_route_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_ROUTE_KEY_VRF_IDL, ds_ipv6_ucast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_NAT_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_CTAG_CFI, ds_ipv6_nat_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_CTAG_COS, ds_ipv6_nat_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_CVLAN_ID, ds_ipv6_nat_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_DSCP, ds_ipv6_nat_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_DS_VLAN_PTR, ds_ipv6_nat_key_ds_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_ETHER_TYPEH, ds_ipv6_nat_key_ether_typeh, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_ETHER_TYPEL, ds_ipv6_nat_key_ether_typel, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_FRAG_INFO, ds_ipv6_nat_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_nat_key_ipv6_extension_headers, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IPV6_FLOW_LABELH, ds_ipv6_nat_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IPV6_FLOW_LABELL, ds_ipv6_nat_key_ipv6_flow_labell, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_nat_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_DA0, ds_ipv6_nat_key_ip_da0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_DA1, ds_ipv6_nat_key_ip_da1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_DA2, ds_ipv6_nat_key_ip_da2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_DA3, ds_ipv6_nat_key_ip_da3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_DA4, ds_ipv6_nat_key_ip_da4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_HEADER_ERROR, ds_ipv6_nat_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_OPTIONS, ds_ipv6_nat_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_SA0, ds_ipv6_nat_key_ip_sa0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_SA1, ds_ipv6_nat_key_ip_sa1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_SA2, ds_ipv6_nat_key_ip_sa2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_SA3, ds_ipv6_nat_key_ip_sa3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IP_SA4, ds_ipv6_nat_key_ip_sa4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IS_APPLICATION, ds_ipv6_nat_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IS_TCP, ds_ipv6_nat_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_IS_UDP, ds_ipv6_nat_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_L4_DEST_PORT, ds_ipv6_nat_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_L4_INFO_MAPPED, ds_ipv6_nat_key_l4_info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_L4_SOURCE_PORT, ds_ipv6_nat_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_LAYER2_TYPE, ds_ipv6_nat_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_LAYER3_TYPE, ds_ipv6_nat_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_LAYER4_TYPE, ds_ipv6_nat_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_MAC_DAH, ds_ipv6_nat_key_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_MAC_DAL, ds_ipv6_nat_key_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_MAC_SAH, ds_ipv6_nat_key_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_MAC_SAL, ds_ipv6_nat_key_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_PBR_LABEL, ds_ipv6_nat_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_SCVLAN_ID, ds_ipv6_nat_key_scvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_STAG_CFI, ds_ipv6_nat_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_STAG_COS, ds_ipv6_nat_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID0, ds_ipv6_nat_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID1, ds_ipv6_nat_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID2, ds_ipv6_nat_key_table_id2, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID3, ds_ipv6_nat_key_table_id3, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID4, ds_ipv6_nat_key_table_id4, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID5, ds_ipv6_nat_key_table_id5, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_TABLE_ID6, ds_ipv6_nat_key_table_id6, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_VRF_IDH, ds_ipv6_nat_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_NAT_KEY_VRF_IDL, ds_ipv6_nat_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_PBR_DUALDA_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_CTAG_CFI, ds_ipv6_pbr_dualda_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_CTAG_COS, ds_ipv6_pbr_dualda_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_CVLAN_ID, ds_ipv6_pbr_dualda_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_DSCP, ds_ipv6_pbr_dualda_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_DS_VLAN_PTR, ds_ipv6_pbr_dualda_key_ds_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_ETHER_TYPEH, ds_ipv6_pbr_dualda_key_ether_typeh, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_ETHER_TYPEL, ds_ipv6_pbr_dualda_key_ether_typel, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_FRAG_INFO, ds_ipv6_pbr_dualda_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_pbr_dualda_key_ipv6_extension_headers, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_FLOW_LABELH, ds_ipv6_pbr_dualda_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_FLOW_LABELL, ds_ipv6_pbr_dualda_key_ipv6_flow_labell, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_pbr_dualda_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA0, ds_ipv6_pbr_dualda_key_ip_da0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA1, ds_ipv6_pbr_dualda_key_ip_da1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA2, ds_ipv6_pbr_dualda_key_ip_da2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA3, ds_ipv6_pbr_dualda_key_ip_da3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA4, ds_ipv6_pbr_dualda_key_ip_da4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_HEADER_ERROR, ds_ipv6_pbr_dualda_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_OPTIONS, ds_ipv6_pbr_dualda_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA0, ds_ipv6_pbr_dualda_key_ip_sa0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA1, ds_ipv6_pbr_dualda_key_ip_sa1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA2, ds_ipv6_pbr_dualda_key_ip_sa2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA3, ds_ipv6_pbr_dualda_key_ip_sa3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA4, ds_ipv6_pbr_dualda_key_ip_sa4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IS_APPLICATION, ds_ipv6_pbr_dualda_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IS_TCP, ds_ipv6_pbr_dualda_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_IS_UDP, ds_ipv6_pbr_dualda_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_L4_DEST_PORT, ds_ipv6_pbr_dualda_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_L4_INFO_MAPPED, ds_ipv6_pbr_dualda_key_l4_info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_L4_SOURCE_PORT, ds_ipv6_pbr_dualda_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_LAYER2_TYPE, ds_ipv6_pbr_dualda_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_LAYER3_TYPE, ds_ipv6_pbr_dualda_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_LAYER4_TYPE, ds_ipv6_pbr_dualda_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_DAH, ds_ipv6_pbr_dualda_key_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_DAL, ds_ipv6_pbr_dualda_key_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_SAH, ds_ipv6_pbr_dualda_key_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_SAL, ds_ipv6_pbr_dualda_key_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_PBR_LABEL, ds_ipv6_pbr_dualda_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_SCVLAN_ID, ds_ipv6_pbr_dualda_key_scvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_STAG_CFI, ds_ipv6_pbr_dualda_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_STAG_COS, ds_ipv6_pbr_dualda_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID0, ds_ipv6_pbr_dualda_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID1, ds_ipv6_pbr_dualda_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID2, ds_ipv6_pbr_dualda_key_table_id2, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID3, ds_ipv6_pbr_dualda_key_table_id3, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID4, ds_ipv6_pbr_dualda_key_table_id4, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID5, ds_ipv6_pbr_dualda_key_table_id5, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID6, ds_ipv6_pbr_dualda_key_table_id6, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_VRF_IDH, ds_ipv6_pbr_dualda_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_PBR_DUALDA_KEY_VRF_IDL, ds_ipv6_pbr_dualda_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_CTAG_CFI, ds_ipv6_mcast_route_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_CTAG_COS, ds_ipv6_mcast_route_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_CVLAN_ID, ds_ipv6_mcast_route_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_DSCP, ds_ipv6_mcast_route_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_DS_VLAN_PTR, ds_ipv6_mcast_route_key_ds_vlan_ptr, 14)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_ETHER_TYPEH, ds_ipv6_mcast_route_key_ether_typeh, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_ETHER_TYPEL, ds_ipv6_mcast_route_key_ether_typel, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_FRAG_INFO, ds_ipv6_mcast_route_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_mcast_route_key_ipv6_extension_headers, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_FLOW_LABELH, ds_ipv6_mcast_route_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_FLOW_LABELL, ds_ipv6_mcast_route_key_ipv6_flow_labell, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_mcast_route_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA0, ds_ipv6_mcast_route_key_ip_da0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA1, ds_ipv6_mcast_route_key_ip_da1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA2, ds_ipv6_mcast_route_key_ip_da2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA3, ds_ipv6_mcast_route_key_ip_da3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA4, ds_ipv6_mcast_route_key_ip_da4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_HEADER_ERROR, ds_ipv6_mcast_route_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv6_mcast_route_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA0, ds_ipv6_mcast_route_key_ip_sa0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA1, ds_ipv6_mcast_route_key_ip_sa1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA2, ds_ipv6_mcast_route_key_ip_sa2, 8)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA3, ds_ipv6_mcast_route_key_ip_sa3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA4, ds_ipv6_mcast_route_key_ip_sa4, 24)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv6_mcast_route_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IS_TCP, ds_ipv6_mcast_route_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IS_UDP, ds_ipv6_mcast_route_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv6_mcast_route_key_l4_dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_L4_INFO_MAPPED, ds_ipv6_mcast_route_key_l4_info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv6_mcast_route_key_l4_source_port, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_LAYER2_TYPE, ds_ipv6_mcast_route_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_LAYER3_TYPE, ds_ipv6_mcast_route_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv6_mcast_route_key_layer4_type, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_DAH, ds_ipv6_mcast_route_key_mac_dah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_DAL, ds_ipv6_mcast_route_key_mac_dal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_SAH, ds_ipv6_mcast_route_key_mac_sah, 16)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_SAL, ds_ipv6_mcast_route_key_mac_sal, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_PBR_LABEL, ds_ipv6_mcast_route_key_pbr_label, 6)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_SCVLAN_ID, ds_ipv6_mcast_route_key_scvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_STAG_CFI, ds_ipv6_mcast_route_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_STAG_COS, ds_ipv6_mcast_route_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID0, ds_ipv6_mcast_route_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID1, ds_ipv6_mcast_route_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID2, ds_ipv6_mcast_route_key_table_id2, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID3, ds_ipv6_mcast_route_key_table_id3, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID4, ds_ipv6_mcast_route_key_table_id4, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID5, ds_ipv6_mcast_route_key_table_id5, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID6, ds_ipv6_mcast_route_key_table_id6, 4)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_VRF_IDH, ds_ipv6_mcast_route_key_vrf_idh, 12)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_ROUTE_KEY_VRF_IDL, ds_ipv6_mcast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA0, ds_ipv6_ucast_hash_key0_key_ipda0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA1, ds_ipv6_ucast_hash_key0_key_ipda1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA2, ds_ipv6_ucast_hash_key0_key_ipda2, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA3, ds_ipv6_ucast_hash_key0_key_ipda3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID0, ds_ipv6_ucast_hash_key0_vrfid0, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID1, ds_ipv6_ucast_hash_key0_vrfid1, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID2, ds_ipv6_ucast_hash_key0_vrfid2, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID3, ds_ipv6_ucast_hash_key0_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA0, ds_ipv6_mcast_hash_key0_key_ipda0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA1, ds_ipv6_mcast_hash_key0_key_ipda1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA2, ds_ipv6_mcast_hash_key0_key_ipda2, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA3, ds_ipv6_mcast_hash_key0_key_ipda3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID0, ds_ipv6_mcast_hash_key0_vrfid0, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID1, ds_ipv6_mcast_hash_key0_vrfid1, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID2, ds_ipv6_mcast_hash_key0_vrfid2, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID3, ds_ipv6_mcast_hash_key0_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA0, ds_ipv6_ucast_hash_key1_key_ipda0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA1, ds_ipv6_ucast_hash_key1_key_ipda1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA2, ds_ipv6_ucast_hash_key1_key_ipda2, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA3, ds_ipv6_ucast_hash_key1_key_ipda3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID0, ds_ipv6_ucast_hash_key1_vrfid0, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID1, ds_ipv6_ucast_hash_key1_vrfid1, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID2, ds_ipv6_ucast_hash_key1_vrfid2, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID3, ds_ipv6_ucast_hash_key1_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA0, ds_ipv6_mcast_hash_key1_key_ipda0, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA1, ds_ipv6_mcast_hash_key1_key_ipda1, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA2, ds_ipv6_mcast_hash_key1_key_ipda2, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA3, ds_ipv6_mcast_hash_key1_key_ipda3, 32)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID0, ds_ipv6_mcast_hash_key1_vrfid0, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID1, ds_ipv6_mcast_hash_key1_vrfid1, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID2, ds_ipv6_mcast_hash_key1_vrfid2, 3)
+        DRV_FIELD_SET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID3, ds_ipv6_mcast_hash_key1_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_VLAN_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_CUSTOMER_ID, ds_user_id_vlan_key_customer_id, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_CVLAN_IDH, ds_user_id_vlan_key_cvlan_idh, 6)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_CVLAN_IDL, ds_user_id_vlan_key_cvlan_idl, 6)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_FROM_SGMAC, ds_user_id_vlan_key_from_sgmac, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_GLOBAL_SRC_PORT, ds_user_id_vlan_key_global_src_port, 13)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_SVLAN_ID, ds_user_id_vlan_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_TABLE_ID, ds_user_id_vlan_key_table_id, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_VLAN_KEY_USER_ID_LABEL, ds_user_id_vlan_key_user_id_label, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_CFI1, ds_user_id_mac_key_cfi1, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_CFI2, ds_user_id_mac_key_cfi2, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_COS1, ds_user_id_mac_key_cos1, 3)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_COS2, ds_user_id_mac_key_cos2, 3)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_EXP2, ds_user_id_mac_key_exp2, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_EXP_SUB_IDX, ds_user_id_mac_key_exp_sub_idx, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_FROM_SGMAC, ds_user_id_mac_key_from_sgmac, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_LAYER2_TYPE, ds_user_id_mac_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_LAYER3_TYPE, ds_user_id_mac_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_MAC_DA_LOWER, ds_user_id_mac_key_mac_da_lower, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_MAC_DA_UPPER, ds_user_id_mac_key_mac_da_upper, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_MAC_SA_LOWER, ds_user_id_mac_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_MAC_SA_UPPER, ds_user_id_mac_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_TABLE_ID0, ds_user_id_mac_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_TABLE_ID1, ds_user_id_mac_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_USER_ID_LABEL, ds_user_id_mac_key_user_id_label, 6)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_VLAN_ID1, ds_user_id_mac_key_vlan_id1, 12)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_VLAN_ID27TO0, ds_user_id_mac_key_vlan_id27to0, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_MAC_KEY_VLAN_ID211TO8, ds_user_id_mac_key_vlan_id211to8, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV4_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_CTAG_CFI, ds_user_id_ipv4_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_CTAG_COS, ds_user_id_ipv4_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_CVLAN_ID, ds_user_id_ipv4_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_DSCP, ds_user_id_ipv4_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_ETHER_TYPE_LOWER, ds_user_id_ipv4_key_ether_type_lower, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_ETHER_TYPE_UPPER, ds_user_id_ipv4_key_ether_type_upper, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_EXP2, ds_user_id_ipv4_key_exp2, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_EXP_SUB_IDX, ds_user_id_ipv4_key_exp_sub_idx, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_FRAG_INFO, ds_user_id_ipv4_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_FROM_SGMAC, ds_user_id_ipv4_key_from_sgmac, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IP_DA, ds_user_id_ipv4_key_ip_da, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IP_HEADER_ERROR, ds_user_id_ipv4_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IP_OPTIONS, ds_user_id_ipv4_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IP_SA, ds_user_id_ipv4_key_ip_sa, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IS_APPLICATION, ds_user_id_ipv4_key_is_application, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IS_TCP, ds_user_id_ipv4_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_IS_UDP, ds_user_id_ipv4_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_L4DEST_PORT, ds_user_id_ipv4_key_l4dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_L4INFO_MAPPED, ds_user_id_ipv4_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_L4SOURCE_PORT, ds_user_id_ipv4_key_l4source_port, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_LAYER2_TYPE, ds_user_id_ipv4_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_LAYER3_TYPE, ds_user_id_ipv4_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_MAC_DA_LOWER, ds_user_id_ipv4_key_mac_da_lower, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_MAC_DA_UPPER, ds_user_id_ipv4_key_mac_da_upper, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_MAC_SA_LOWER, ds_user_id_ipv4_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_MAC_SA_UPPER, ds_user_id_ipv4_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_ROUTED_PACKET, ds_user_id_ipv4_key_routed_packet, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_STAG_CFI, ds_user_id_ipv4_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_STAG_COS, ds_user_id_ipv4_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_SVLAN_ID, ds_user_id_ipv4_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID0, ds_user_id_ipv4_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID1, ds_user_id_ipv4_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID2, ds_user_id_ipv4_key_table_id2, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID3, ds_user_id_ipv4_key_table_id3, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV4_KEY_USER_ID_LABEL, ds_user_id_ipv4_key_user_id_label, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV6_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_CTAG_CFI, ds_user_id_ipv6_key_ctag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_CTAG_COS, ds_user_id_ipv6_key_ctag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_CVLAN_ID, ds_user_id_ipv6_key_cvlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_DSCP, ds_user_id_ipv6_key_dscp, 6)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_ETHER_TYPE7TO0, ds_user_id_ipv6_key_ether_type7to0, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_ETHER_TYPE15TO8, ds_user_id_ipv6_key_ether_type15to8, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_EXP2, ds_user_id_ipv6_key_exp2, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_EXP_SUB_IDX, ds_user_id_ipv6_key_exp_sub_idx, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_FRAG_INFO, ds_user_id_ipv6_key_frag_info, 2)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_FROM_SGMAC, ds_user_id_ipv6_key_from_sgmac, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IPV6_EXTERNSION_HEADERS, ds_user_id_ipv6_key_ipv6_externsion_headers, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IPV6_FLOW_LABEL, ds_user_id_ipv6_key_ipv6_flow_label, 20)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_DA31_TO0, ds_user_id_ipv6_key_ip_da31_to0, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_DA63_TO32, ds_user_id_ipv6_key_ip_da63_to32, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_DA71_TO64, ds_user_id_ipv6_key_ip_da71_to64, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_DA103_TO72, ds_user_id_ipv6_key_ip_da103_to72, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_DA127_TO104, ds_user_id_ipv6_key_ip_da127_to104, 24)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_HEADER_ERROR, ds_user_id_ipv6_key_ip_header_error, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_OPTIONS, ds_user_id_ipv6_key_ip_options, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_SA31_TO0, ds_user_id_ipv6_key_ip_sa31_to0, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_SA63_TO32, ds_user_id_ipv6_key_ip_sa63_to32, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_SA71_TO64, ds_user_id_ipv6_key_ip_sa71_to64, 8)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_SA103_TO72, ds_user_id_ipv6_key_ip_sa103_to72, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IP_SA127_TO104, ds_user_id_ipv6_key_ip_sa127_to104, 24)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IS_APP, ds_user_id_ipv6_key_is_app, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IS_TCP, ds_user_id_ipv6_key_is_tcp, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_IS_UDP, ds_user_id_ipv6_key_is_udp, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_L4DEST_PORT, ds_user_id_ipv6_key_l4dest_port, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_L4INFO_MAPPED, ds_user_id_ipv6_key_l4info_mapped, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_L4SOURCE_PORT, ds_user_id_ipv6_key_l4source_port, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_LAYER2_TYPE, ds_user_id_ipv6_key_layer2_type, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_LAYER3_TYPE, ds_user_id_ipv6_key_layer3_type, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_MAC_DA_LOWER, ds_user_id_ipv6_key_mac_da_lower, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_MAC_DA_UPPER, ds_user_id_ipv6_key_mac_da_upper, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_MAC_SA_LOWER, ds_user_id_ipv6_key_mac_sa_lower, 32)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_MAC_SA_UPPER, ds_user_id_ipv6_key_mac_sa_upper, 16)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_ROUTED_PACKET, ds_user_id_ipv6_key_routed_packet, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_STAG_CFI, ds_user_id_ipv6_key_stag_cfi, 1)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_STAG_COS, ds_user_id_ipv6_key_stag_cos, 3)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_SVLAN_ID, ds_user_id_ipv6_key_svlan_id, 12)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID0, ds_user_id_ipv6_key_table_id0, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID1, ds_user_id_ipv6_key_table_id1, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID2, ds_user_id_ipv6_key_table_id2, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID3, ds_user_id_ipv6_key_table_id3, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID4, ds_user_id_ipv6_key_table_id4, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID5, ds_user_id_ipv6_key_table_id5, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID6, ds_user_id_ipv6_key_table_id6, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID7, ds_user_id_ipv6_key_table_id7, 4)
+        DRV_FIELD_SET_CASE(DS_USER_ID_IPV6_KEY_USER_ID_LABEL, ds_user_id_ipv6_key_user_id_label, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_KEY_IS_UP, ds_eth_oam_key_is_up, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_KEY_OAM_LOOKUP_TYPE, ds_eth_oam_key_oam_lookup_type, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_KEY_PORT, ds_eth_oam_key_port, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_KEY_TABLE_ID, ds_eth_oam_key_table_id, 4)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_KEY_VLAN_PTR, ds_eth_oam_key_vlan_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT0, ds_eth_oam_hash_key0_global_src_port0, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT1, ds_eth_oam_hash_key0_global_src_port1, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT2, ds_eth_oam_hash_key0_global_src_port2, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT3, ds_eth_oam_hash_key0_global_src_port3, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID0, ds_eth_oam_hash_key0_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID1, ds_eth_oam_hash_key0_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID2, ds_eth_oam_hash_key0_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID3, ds_eth_oam_hash_key0_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP0, ds_eth_oam_hash_key0_is_up0, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP1, ds_eth_oam_hash_key0_is_up1, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP2, ds_eth_oam_hash_key0_is_up2, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP3, ds_eth_oam_hash_key0_is_up3, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE0, ds_eth_oam_hash_key0_oam_hash_type0, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE1, ds_eth_oam_hash_key0_oam_hash_type1, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE2, ds_eth_oam_hash_key0_oam_hash_type2, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE3, ds_eth_oam_hash_key0_oam_hash_type3, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR0, ds_eth_oam_hash_key0_vlan_ptr0, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR1, ds_eth_oam_hash_key0_vlan_ptr1, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR2, ds_eth_oam_hash_key0_vlan_ptr2, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR3, ds_eth_oam_hash_key0_vlan_ptr3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT0, ds_eth_oam_hash_key1_global_src_port0, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT1, ds_eth_oam_hash_key1_global_src_port1, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT2, ds_eth_oam_hash_key1_global_src_port2, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT3, ds_eth_oam_hash_key1_global_src_port3, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID0, ds_eth_oam_hash_key1_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID1, ds_eth_oam_hash_key1_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID2, ds_eth_oam_hash_key1_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID3, ds_eth_oam_hash_key1_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP0, ds_eth_oam_hash_key1_is_up0, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP1, ds_eth_oam_hash_key1_is_up1, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP2, ds_eth_oam_hash_key1_is_up2, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP3, ds_eth_oam_hash_key1_is_up3, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE0, ds_eth_oam_hash_key1_oam_hash_type0, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE1, ds_eth_oam_hash_key1_oam_hash_type1, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE2, ds_eth_oam_hash_key1_oam_hash_type2, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE3, ds_eth_oam_hash_key1_oam_hash_type3, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR0, ds_eth_oam_hash_key1_vlan_ptr0, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR1, ds_eth_oam_hash_key1_vlan_ptr1, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR2, ds_eth_oam_hash_key1_vlan_ptr2, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR3, ds_eth_oam_hash_key1_vlan_ptr3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PBT_OAM_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_KEY_ESP_ID, ds_pbt_oam_key_esp_id, 13)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_KEY_OAM_LOOKUP_TYPE, ds_pbt_oam_key_oam_lookup_type, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_KEY_PBT_OAM_PORT, ds_pbt_oam_key_pbt_oam_port, 12)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_KEY_TABLE_ID, ds_pbt_oam_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PBT_OAM_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID0, ds_pbt_oam_hash_key0_esp_id0, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID1, ds_pbt_oam_hash_key0_esp_id1, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID2, ds_pbt_oam_hash_key0_esp_id2, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID3, ds_pbt_oam_hash_key0_esp_id3, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID0, ds_pbt_oam_hash_key0_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID1, ds_pbt_oam_hash_key0_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID2, ds_pbt_oam_hash_key0_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID3, ds_pbt_oam_hash_key0_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE0, ds_pbt_oam_hash_key0_oam_lookup_type0, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE1, ds_pbt_oam_hash_key0_oam_lookup_type1, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE2, ds_pbt_oam_hash_key0_oam_lookup_type2, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE3, ds_pbt_oam_hash_key0_oam_lookup_type3, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT0, ds_pbt_oam_hash_key0_pbt_oam_port0, 15)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT1, ds_pbt_oam_hash_key0_pbt_oam_port1, 15)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT2, ds_pbt_oam_hash_key0_pbt_oam_port2, 15)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT3, ds_pbt_oam_hash_key0_pbt_oam_port3, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PBT_OAM_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID0, ds_pbt_oam_hash_key1_esp_id0, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID1, ds_pbt_oam_hash_key1_esp_id1, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID2, ds_pbt_oam_hash_key1_esp_id2, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID3, ds_pbt_oam_hash_key1_esp_id3, 16)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID0, ds_pbt_oam_hash_key1_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID1, ds_pbt_oam_hash_key1_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID2, ds_pbt_oam_hash_key1_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID3, ds_pbt_oam_hash_key1_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE0, ds_pbt_oam_hash_key1_oam_lookup_type0, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE1, ds_pbt_oam_hash_key1_oam_lookup_type1, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE2, ds_pbt_oam_hash_key1_oam_lookup_type2, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE3, ds_pbt_oam_hash_key1_oam_lookup_type3, 3)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT0, ds_pbt_oam_hash_key1_pbt_oam_port0, 15)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT1, ds_pbt_oam_hash_key1_pbt_oam_port1, 15)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT2, ds_pbt_oam_hash_key1_pbt_oam_port2, 15)
+        DRV_FIELD_SET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT3, ds_pbt_oam_hash_key1_pbt_oam_port3, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_LABEL_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_KEY_MPLS_LABLE, ds_mpls_oam_label_key_mpls_lable, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_KEY_OAM_LOOKUP_TYPE, ds_mpls_oam_label_key_oam_lookup_type, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_KEY_TABLE_ID, ds_mpls_oam_label_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_LABEL_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID0, ds_mpls_oam_label_hash_key0_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID1, ds_mpls_oam_label_hash_key0_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID2, ds_mpls_oam_label_hash_key0_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID3, ds_mpls_oam_label_hash_key0_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL0, ds_mpls_oam_label_hash_key0_mpls_label0, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL1, ds_mpls_oam_label_hash_key0_mpls_label1, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL2, ds_mpls_oam_label_hash_key0_mpls_label2, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL3, ds_mpls_oam_label_hash_key0_mpls_label3, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE0, ds_mpls_oam_label_hash_key0_oam_look_up_type0, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE1, ds_mpls_oam_label_hash_key0_oam_look_up_type1, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE2, ds_mpls_oam_label_hash_key0_oam_look_up_type2, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE3, ds_mpls_oam_label_hash_key0_oam_look_up_type3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_LABEL_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID0, ds_mpls_oam_label_hash_key1_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID1, ds_mpls_oam_label_hash_key1_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID2, ds_mpls_oam_label_hash_key1_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID3, ds_mpls_oam_label_hash_key1_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL0, ds_mpls_oam_label_hash_key1_mpls_label0, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL1, ds_mpls_oam_label_hash_key1_mpls_label1, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL2, ds_mpls_oam_label_hash_key1_mpls_label2, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL3, ds_mpls_oam_label_hash_key1_mpls_label3, 20)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE0, ds_mpls_oam_label_hash_key1_oam_look_up_type0, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE1, ds_mpls_oam_label_hash_key1_oam_look_up_type1, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE2, ds_mpls_oam_label_hash_key1_oam_look_up_type2, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE3, ds_mpls_oam_label_hash_key1_oam_look_up_type3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_IPV4_TTSI_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_LSP_ID, ds_mpls_oam_ipv4_ttsi_key_lsp_id, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_LSR_ID, ds_mpls_oam_ipv4_ttsi_key_lsr_id, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_OAM_LOOKUP_TYPE, ds_mpls_oam_ipv4_ttsi_key_oam_lookup_type, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_TABLE_ID, ds_mpls_oam_ipv4_ttsi_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_INVALID0, ds_mpls_oam_ipv4_ttsi_hash_key0_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_INVALID1, ds_mpls_oam_ipv4_ttsi_hash_key0_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSP_ID0, ds_mpls_oam_ipv4_ttsi_hash_key0_lsp_id0, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSP_ID1, ds_mpls_oam_ipv4_ttsi_hash_key0_lsp_id1, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSR_ID0, ds_mpls_oam_ipv4_ttsi_hash_key0_lsr_id0, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSR_ID1, ds_mpls_oam_ipv4_ttsi_hash_key0_lsr_id1, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_OAM_LOOKUP_TYPE0, ds_mpls_oam_ipv4_ttsi_hash_key0_oam_lookup_type0, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_OAM_LOOKUP_TYPE1, ds_mpls_oam_ipv4_ttsi_hash_key0_oam_lookup_type1, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_INVALID0, ds_mpls_oam_ipv4_ttsi_hash_key1_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_INVALID1, ds_mpls_oam_ipv4_ttsi_hash_key1_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSP_ID0, ds_mpls_oam_ipv4_ttsi_hash_key1_lsp_id0, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSP_ID1, ds_mpls_oam_ipv4_ttsi_hash_key1_lsp_id1, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSR_ID0, ds_mpls_oam_ipv4_ttsi_hash_key1_lsr_id0, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSR_ID1, ds_mpls_oam_ipv4_ttsi_hash_key1_lsr_id1, 32)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_OAM_LOOKUP_TYPE0, ds_mpls_oam_ipv4_ttsi_hash_key1_oam_lookup_type0, 3)
+        DRV_FIELD_SET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_OAM_LOOKUP_TYPE1, ds_mpls_oam_ipv4_ttsi_hash_key1_oam_lookup_type1, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_RMEP_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_KEY_MEP_INDEX, ds_eth_oam_rmep_key_mep_index, 16)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_KEY_OAM_LOOKUP_TYPE, ds_eth_oam_rmep_key_oam_lookup_type, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_KEY_RMEP_ID, ds_eth_oam_rmep_key_rmep_id, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_KEY_TABLE_ID, ds_eth_oam_rmep_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_RMEP_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID0, ds_eth_oam_rmep_hash_key0_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID1, ds_eth_oam_rmep_hash_key0_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID2, ds_eth_oam_rmep_hash_key0_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID3, ds_eth_oam_rmep_hash_key0_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX0, ds_eth_oam_rmep_hash_key0_mep_index0, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX1, ds_eth_oam_rmep_hash_key0_mep_index1, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX2, ds_eth_oam_rmep_hash_key0_mep_index2, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX3, ds_eth_oam_rmep_hash_key0_mep_index3, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE0, ds_eth_oam_rmep_hash_key0_oam_lookup_type0, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE1, ds_eth_oam_rmep_hash_key0_oam_lookup_type1, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE2, ds_eth_oam_rmep_hash_key0_oam_lookup_type2, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE3, ds_eth_oam_rmep_hash_key0_oam_lookup_type3, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID0, ds_eth_oam_rmep_hash_key0_rmep_id0, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID1, ds_eth_oam_rmep_hash_key0_rmep_id1, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID2, ds_eth_oam_rmep_hash_key0_rmep_id2, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID3, ds_eth_oam_rmep_hash_key0_rmep_id3, 13)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_RMEP_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID0, ds_eth_oam_rmep_hash_key1_invalid0, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID1, ds_eth_oam_rmep_hash_key1_invalid1, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID2, ds_eth_oam_rmep_hash_key1_invalid2, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID3, ds_eth_oam_rmep_hash_key1_invalid3, 1)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX0, ds_eth_oam_rmep_hash_key1_mep_index0, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX1, ds_eth_oam_rmep_hash_key1_mep_index1, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX2, ds_eth_oam_rmep_hash_key1_mep_index2, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX3, ds_eth_oam_rmep_hash_key1_mep_index3, 15)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE0, ds_eth_oam_rmep_hash_key1_oam_lookup_type0, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE1, ds_eth_oam_rmep_hash_key1_oam_lookup_type1, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE2, ds_eth_oam_rmep_hash_key1_oam_lookup_type2, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE3, ds_eth_oam_rmep_hash_key1_oam_lookup_type3, 3)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID0, ds_eth_oam_rmep_hash_key1_rmep_id0, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID1, ds_eth_oam_rmep_hash_key1_rmep_id1, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID2, ds_eth_oam_rmep_hash_key1_rmep_id2, 13)
+        DRV_FIELD_SET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID3, ds_eth_oam_rmep_hash_key1_rmep_id3, 13)
+        default:
+            break;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return drv_tbl_field_set(tbl_id, field_id, entry, value);
+}
+
+/**
+ @brief Get a field of a table data entry in memory with the constant accessor
+
+ An unknown table or field goes to drv_tbl_field_get() for its error.
+*/
+int32
+drv_humber_tbl_field_get(tbl_id_t tbl_id, fld_id_t field_id,
+                         uint32* entry, uint32* value)
+{
+    DRV_PTR_VALID_CHECK(entry)
+    DRV_PTR_VALID_CHECK(value)
+
+    switch (tbl_id)
+    {
+    case BUF_RETRV_PKT_MSG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA0, buf_retrv_pkt_msg_mem_data0, 7)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA1, buf_retrv_pkt_msg_mem_data1, 32)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA2, buf_retrv_pkt_msg_mem_data2, 32)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_MSG_MEM_DATA3, buf_retrv_pkt_msg_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_RAM_DATA0, buf_retrv_buf_ram_data0, 25)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_RAM_DATA1, buf_retrv_buf_ram_data1, 32)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_RAM_DATA2, buf_retrv_buf_ram_data2, 32)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_RAM_DATA3, buf_retrv_buf_ram_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_PKT_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_CONFIG_MEM_PKT_CONFIG_END, buf_retrv_pkt_config_mem_pkt_config_end, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_CONFIG_MEM_PKT_CONFIG_START, buf_retrv_pkt_config_mem_pkt_config_start, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_CONFIG_MEM_PKT_CONFIG_WEIGHT, buf_retrv_pkt_config_mem_pkt_config_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_PKT_STATUS_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_COUNT, buf_retrv_pkt_status_mem_pkt_status_count, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_HEAD, buf_retrv_pkt_status_mem_pkt_status_head, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_TAIL, buf_retrv_pkt_status_mem_pkt_status_tail, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_STATUS_MEM_PKT_STATUS_WEIGHT, buf_retrv_pkt_status_mem_pkt_status_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_PKT_PARK_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA0, buf_retrv_pkt_park_mem_data0, 29)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA1, buf_retrv_pkt_park_mem_data1, 32)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA2, buf_retrv_pkt_park_mem_data2, 32)
+        DRV_FIELD_GET_CASE(BUF_RETRV_PKT_PARK_MEM_DATA3, buf_retrv_pkt_park_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_BURST_CNT_SEL, buf_retrv_buf_config_mem_buf_config_burst_cnt_sel, 2)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_END, buf_retrv_buf_config_mem_buf_config_end, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_START, buf_retrv_buf_config_mem_buf_config_start, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_CONFIG_MEM_BUF_CONFIG_WEIGHT, buf_retrv_buf_config_mem_buf_config_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_STATUS_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS1ST_DATA, buf_retrv_buf_status_mem_buf_status1st_data, 1)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_COUNT, buf_retrv_buf_status_mem_buf_status_count, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_DATA_CNT, buf_retrv_buf_status_mem_buf_status_data_cnt, 3)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_HEAD, buf_retrv_buf_status_mem_buf_status_head, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_OFFSET, buf_retrv_buf_status_mem_buf_status_offset, 3)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_TAIL, buf_retrv_buf_status_mem_buf_status_tail, 11)
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_STATUS_MEM_BUF_STATUS_WEIGHT, buf_retrv_buf_status_mem_buf_status_weight, 6)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_CREDIT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_CREDIT_MEM_CREDIT, buf_retrv_credit_mem_credit, 12)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_CREDIT_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_CREDIT_CONFIG_MEM_CREDIT_CONFIG, buf_retrv_credit_config_mem_credit_config, 3)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_EXCEPTION_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_EXCEPTION_MEM_EXCEPTION_DATA, buf_retrv_exception_mem_exception_data, 20)
+        DRV_FIELD_GET_CASE(BUF_RETRV_EXCEPTION_MEM_EXCEPTION_SUB_INDEX_EN, buf_retrv_exception_mem_exception_sub_index_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_CREDIT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_CREDIT_MEM_CREDIT, buf_retrv_buf_credit_mem_credit, 4)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_RETRV_BUF_CREDIT_CONFIG_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_RETRV_BUF_CREDIT_CONFIG_MEM_CREDIT_CONFIG, buf_retrv_buf_credit_config_mem_credit_config, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_BUF_RETRV_COLOR_MAP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_BUF_RETRV_COLOR_MAP_COLOR_MAP, ds_buf_retrv_color_map_color_map, 2)
+        default:
+            break;
+        }
+        break;
+
+    case MET_FIFO_PRIORITY_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_DROP_PRECEDENCE, met_fifo_priority_map_table_drop_precedence, 2)
+        DRV_FIELD_GET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_MET_FIFO_PRIORITY, met_fifo_priority_map_table_met_fifo_priority, 1)
+        DRV_FIELD_GET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_QUEUE_SELECT, met_fifo_priority_map_table_queue_select, 6)
+        DRV_FIELD_GET_CASE(MET_FIFO_PRIORITY_MAP_TABLE_RESRC_DROP_PRECEDENCE, met_fifo_priority_map_table_resrc_drop_precedence, 2)
+        default:
+            break;
+        }
+        break;
+
+    case BUFFER_STORE_RESRC_CNT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUFFER_STORE_RESRC_CNT_RESRC_CNT, buffer_store_resrc_cnt_resrc_cnt, 16)
+        default:
+            break;
+        }
+        break;
+
+    case BUFFER_STORE_RESRC_THRESHOLD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD0, buffer_store_resrc_threshold_resrc_drop_threshold0, 16)
+        DRV_FIELD_GET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD1, buffer_store_resrc_threshold_resrc_drop_threshold1, 16)
+        DRV_FIELD_GET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD2, buffer_store_resrc_threshold_resrc_drop_threshold2, 16)
+        DRV_FIELD_GET_CASE(BUFFER_STORE_RESRC_THRESHOLD_RESRC_DROP_THRESHOLD3, buffer_store_resrc_threshold_resrc_drop_threshold3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_STORE_CHANNEL_INFO_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD0, buf_store_channel_info_ram_word0, 17)
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD1, buf_store_channel_info_ram_word1, 32)
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD2, buf_store_channel_info_ram_word2, 32)
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD3, buf_store_channel_info_ram_word3, 32)
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD4, buf_store_channel_info_ram_word4, 32)
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD5, buf_store_channel_info_ram_word5, 32)
+        DRV_FIELD_GET_CASE(BUF_STORE_CHANNEL_INFO_RAM_WORD6, buf_store_channel_info_ram_word6, 32)
+        default:
+            break;
+        }
+        break;
+
+    case BUF_STORE_BUF_PTR:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUF_STORE_BUF_PTR_BUF_PTR, buf_store_buf_ptr_buf_ptr, 17)
+        default:
+            break;
+        }
+        break;
+
+    case BUFFER_STORE_STALL_THRESHOLD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(BUFFER_STORE_STALL_THRESHOLD_STALL_HIGH, buffer_store_stall_threshold_stall_high, 16)
+        DRV_FIELD_GET_CASE(BUFFER_STORE_STALL_THRESHOLD_STALL_LOW, buffer_store_stall_threshold_stall_low, 16)
+        default:
+            break;
+        }
+        break;
+
+    case CPUMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CPUMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, cpumac_stats_ram_byte_cnt_data_high, 4)
+        DRV_FIELD_GET_CASE(CPUMAC_STATS_RAM_BYTE_CNT_DATA_LOW, cpumac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(CPUMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, cpumac_stats_ram_frame_cnt_data_high, 4)
+        DRV_FIELD_GET_CASE(CPUMAC_STATS_RAM_FRAME_CNT_DATA_LOW, cpumac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_INT_KEY_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_INT_KEY_RAM_KEY0, tcam_int_key_ram_key0, 1)
+        DRV_FIELD_GET_CASE(TCAM_INT_KEY_RAM_KEY1, tcam_int_key_ram_key1, 16)
+        DRV_FIELD_GET_CASE(TCAM_INT_KEY_RAM_KEY2, tcam_int_key_ram_key2, 32)
+        DRV_FIELD_GET_CASE(TCAM_INT_KEY_RAM_KEY3, tcam_int_key_ram_key3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_INT_MASK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_INT_MASK_RAM_MASK0, tcam_int_mask_ram_mask0, 1)
+        DRV_FIELD_GET_CASE(TCAM_INT_MASK_RAM_MASK1, tcam_int_mask_ram_mask1, 16)
+        DRV_FIELD_GET_CASE(TCAM_INT_MASK_RAM_MASK2, tcam_int_mask_ram_mask2, 32)
+        DRV_FIELD_GET_CASE(TCAM_INT_MASK_RAM_MASK3, tcam_int_mask_ram_mask3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_EXT_KEY_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_EXT_KEY_RAM_KEY0, tcam_ext_key_ram_key0, 1)
+        DRV_FIELD_GET_CASE(TCAM_EXT_KEY_RAM_KEY1, tcam_ext_key_ram_key1, 16)
+        DRV_FIELD_GET_CASE(TCAM_EXT_KEY_RAM_KEY2, tcam_ext_key_ram_key2, 32)
+        DRV_FIELD_GET_CASE(TCAM_EXT_KEY_RAM_KEY3, tcam_ext_key_ram_key3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_EXT_MASK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_EXT_MASK_RAM_MASK0, tcam_ext_mask_ram_mask0, 1)
+        DRV_FIELD_GET_CASE(TCAM_EXT_MASK_RAM_MASK1, tcam_ext_mask_ram_mask1, 16)
+        DRV_FIELD_GET_CASE(TCAM_EXT_MASK_RAM_MASK2, tcam_ext_mask_ram_mask2, 32)
+        DRV_FIELD_GET_CASE(TCAM_EXT_MASK_RAM_MASK3, tcam_ext_mask_ram_mask3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case INT_SRAM_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(INT_SRAM_RAM_DATA0, int_sram_ram_data0, 8)
+        DRV_FIELD_GET_CASE(INT_SRAM_RAM_DATA1, int_sram_ram_data1, 32)
+        DRV_FIELD_GET_CASE(INT_SRAM_RAM_DATA2, int_sram_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case HASH_TAB98K_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(HASH_TAB98K_RAM_DATA0, hash_tab98k_ram_data0, 8)
+        DRV_FIELD_GET_CASE(HASH_TAB98K_RAM_DATA1, hash_tab98k_ram_data1, 32)
+        DRV_FIELD_GET_CASE(HASH_TAB98K_RAM_DATA2, hash_tab98k_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case EXT_DDR_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EXT_DDR_RAM_DATA0, ext_ddr_ram_data0, 8)
+        DRV_FIELD_GET_CASE(EXT_DDR_RAM_DATA1, ext_ddr_ram_data1, 32)
+        DRV_FIELD_GET_CASE(EXT_DDR_RAM_DATA2, ext_ddr_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case HASH_TAB50K_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(HASH_TAB50K_RAM_DATA0, hash_tab50k_ram_data0, 8)
+        DRV_FIELD_GET_CASE(HASH_TAB50K_RAM_DATA1, hash_tab50k_ram_data1, 32)
+        DRV_FIELD_GET_CASE(HASH_TAB50K_RAM_DATA2, hash_tab50k_ram_data2, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_EXT_REG_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_EXT_REG_RAM_DATA0, tcam_ext_reg_ram_data0, 1)
+        DRV_FIELD_GET_CASE(TCAM_EXT_REG_RAM_DATA1, tcam_ext_reg_ram_data1, 16)
+        DRV_FIELD_GET_CASE(TCAM_EXT_REG_RAM_DATA2, tcam_ext_reg_ram_data2, 32)
+        DRV_FIELD_GET_CASE(TCAM_EXT_REG_RAM_DATA3, tcam_ext_reg_ram_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_CLASSIFICATION_PHB_OFFSET_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET0, epe_classification_phb_offset_table_offset0, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET1, epe_classification_phb_offset_table_offset1, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET2, epe_classification_phb_offset_table_offset2, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET3, epe_classification_phb_offset_table_offset3, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET4, epe_classification_phb_offset_table_offset4, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET5, epe_classification_phb_offset_table_offset5, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET6, epe_classification_phb_offset_table_offset6, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET7, epe_classification_phb_offset_table_offset7, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET8, epe_classification_phb_offset_table_offset8, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET9, epe_classification_phb_offset_table_offset9, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET10, epe_classification_phb_offset_table_offset10, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET11, epe_classification_phb_offset_table_offset11, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET12, epe_classification_phb_offset_table_offset12, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET13, epe_classification_phb_offset_table_offset13, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET14, epe_classification_phb_offset_table_offset14, 2)
+        DRV_FIELD_GET_CASE(EPE_CLASSIFICATION_PHB_OFFSET_TABLE_OFFSET15, epe_classification_phb_offset_table_offset15, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_DEST_PHY_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_DEST_DISCARD, ds_dest_phy_port_dest_discard, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_DISCARD_NON8023_OAM, ds_dest_phy_port_discard_non8023_oam, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_GLOBAL_DEST_PORT, ds_dest_phy_port_global_dest_port, 13)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_L2_SPAN_EN, ds_dest_phy_port_l2_span_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_L2_SPAN_ID, ds_dest_phy_port_l2_span_id, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_MUX_PORT_TYPE, ds_dest_phy_port_mux_port_type, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_RANDOM_LOG_EN, ds_dest_phy_port_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PHY_PORT_RANDOM_THRESHOLD, ds_dest_phy_port_random_threshold, 15)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_DEST_MAP, epe_hdr_edit_l2_edit_loopback_ram_lb_dest_map, 22)
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_LENGTH_ADJUST_TYPE, epe_hdr_edit_l2_edit_loopback_ram_lb_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_NEXT_HOP_EXT, epe_hdr_edit_l2_edit_loopback_ram_lb_next_hop_ext, 1)
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_LB_NEXT_HOP_PTR, epe_hdr_edit_l2_edit_loopback_ram_lb_next_hop_ptr, 20)
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_PARITY0, epe_hdr_edit_l2_edit_loopback_ram_parity0, 1)
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_L2_EDIT_LOOPBACK_RAM_PARITY1, epe_hdr_edit_l2_edit_loopback_ram_parity1, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_HEADER_EDIT_SGMAC_PRIORITY_MAP_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_HEADER_EDIT_SGMAC_PRIORITY_MAP_MEM_DP, epe_header_edit_sgmac_priority_map_mem_dp, 2)
+        DRV_FIELD_GET_CASE(EPE_HEADER_EDIT_SGMAC_PRIORITY_MAP_MEM_TC, epe_header_edit_sgmac_priority_map_mem_tc, 4)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_HDR_EDIT_DISCARD_TYPE_STATS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_HDR_EDIT_DISCARD_TYPE_STATS_DISCARD_COUNT, epe_hdr_edit_discard_type_stats_discard_count, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3_EDIT_TUNNEL_V6_IP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA31_TO0, ds_l3_edit_tunnel_v6_ip_ip_sa31_to0, 32)
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA63_TO32, ds_l3_edit_tunnel_v6_ip_ip_sa63_to32, 32)
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA95_TO64, ds_l3_edit_tunnel_v6_ip_ip_sa95_to64, 32)
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_TUNNEL_V6_IP_IP_SA127_TO96, ds_l3_edit_tunnel_v6_ip_ip_sa127_to96, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3_EDIT_SEQUENCE_NUM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM31_TO0, ds_l3_edit_sequence_num_seq_num31_to0, 32)
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM63_TO32, ds_l3_edit_sequence_num_seq_num63_to32, 32)
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM95_TO64, ds_l3_edit_sequence_num_seq_num95_to64, 32)
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_SEQUENCE_NUM_SEQ_NUM127_TO96, ds_l3_edit_sequence_num_seq_num127_to96, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3_EDIT_TUNNEL_V4_IP_SA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3_EDIT_TUNNEL_V4_IP_SA_IP_SA, ds_l3_edit_tunnel_v4_ip_sa_ip_sa, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_DEST_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_BRIDGE_EN, ds_dest_port_bridge_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_BRIDGE_L2_MATCH_DISABLE, ds_dest_port_bridge_l2_match_disable, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_DEFAULT_VLAN_ID, ds_dest_port_default_vlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_DEST_PORT_ISOLATION_ID, ds_dest_port_dest_port_isolation_id, 6)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_DOT1Q_EN, ds_dest_port_dot1q_en, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_EGRESS_FILTER_EN, ds_dest_port_egress_filter_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_ETHER_OAM_VALID, ds_dest_port_ether_oam_valid, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_FORCE_IPV4_TO_MAC_KEY, ds_dest_port_force_ipv4_to_mac_key, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_FORCE_IPV6_TO_MAC_KEY, ds_dest_port_force_ipv6_to_mac_key, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_IPG_INDEX, ds_dest_port_ipg_index, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_L2_ACL_EN, ds_dest_port_l2_acl_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_L2_ACL_HIGH_PRIORITY, ds_dest_port_l2_acl_high_priority, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_L2_ACL_LABEL, ds_dest_port_l2_acl_label, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_L2_QOS_HIGH_PRIORITY, ds_dest_port_l2_qos_high_priority, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_L2_QOS_LABLE, ds_dest_port_l2_qos_lable, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_L2_QOS_LOOKUP_EN, ds_dest_port_l2_qos_lookup_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_MCAST_FLOODING_DISABLE, ds_dest_port_mcast_flooding_disable, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_MD_LEVEL, ds_dest_port_md_level, 3)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_PBB_PORT_TYPE, ds_dest_port_pbb_port_type, 3)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_PIP_MAC_SA, ds_dest_port_pip_mac_sa, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_PORT_POLICER_VALID, ds_dest_port_port_policer_valid, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_QOS_DOMAIN, ds_dest_port_qos_domain, 3)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_REPLACE_COS, ds_dest_port_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_REPLACE_DSCP, ds_dest_port_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_ROUTED_PORT, ds_dest_port_routed_port, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_STP_CHECK_DISABLE, ds_dest_port_stp_check_disable, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_SVLAN_TPID_INDEX, ds_dest_port_svlan_tpid_index, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_TRANSMIT_EN, ds_dest_port_transmit_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_UCAST_FLOODING_DISABLE, ds_dest_port_ucast_flooding_disable, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_UNTAG_DEFAULT_SVLAN, ds_dest_port_untag_default_svlan, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_UNTAG_DEFAULT_VLAN_ID, ds_dest_port_untag_default_vlan_id, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_VLAN_FLOW_POLICER_VALID, ds_dest_port_vlan_flow_policer_valid, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_PORT_VPLS_PORT_TYPE, ds_dest_port_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_EDIT_PRIORITY_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_CFI, epe_edit_priority_map_table_mapped_cfi, 1)
+        DRV_FIELD_GET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_COS, epe_edit_priority_map_table_mapped_cos, 3)
+        DRV_FIELD_GET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_DSCP, epe_edit_priority_map_table_mapped_dscp, 6)
+        DRV_FIELD_GET_CASE(EPE_EDIT_PRIORITY_MAP_TABLE_MAPPED_EXP, epe_edit_priority_map_table_mapped_exp, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_DEST_INTERFACE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_ACL_EN, ds_dest_interface_l3_acl_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_ACL_LABEL, ds_dest_interface_l3_acl_label, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_ACL_ROUTED_ONLY, ds_dest_interface_l3_acl_routed_only, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_QOS_LABEL, ds_dest_interface_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_QOS_LOOKUP_EN, ds_dest_interface_l3_qos_lookup_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_SPAN_EN, ds_dest_interface_l3_span_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_L3_SPAN_ID, ds_dest_interface_l3_span_id, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_MAC_SA, ds_dest_interface_mac_sa, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_MAC_SA_TYPE, ds_dest_interface_mac_sa_type, 2)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_MCAST_TTL_THRESHOLD, ds_dest_interface_mcast_ttl_threshold, 8)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_MTU_CHECK_EN, ds_dest_interface_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_MTU_EXCEPTION_EN, ds_dest_interface_mtu_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_DEST_INTERFACE_MTU_SIZE, ds_dest_interface_mtu_size, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VPLS_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_VPLS_PORT_VPLS_PORT_TYPE, ds_vpls_port_vpls_port_type, 32)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_NEXT_HOP_INTERNAL4W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_BY_PASS_ALL, epe_next_hop_internal4w_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_COPY_CTAG_COS, epe_next_hop_internal4w_copy_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_CVLAN_TAGGED, epe_next_hop_internal4w_cvlan_tagged, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_DERIVE_STAG_COS, epe_next_hop_internal4w_derive_stag_cos, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_DEST_VLAN_PTR, epe_next_hop_internal4w_dest_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_L2EDIT_PTR, epe_next_hop_internal4w_l2edit_ptr, 12)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_L2_REWRITE_TYPE, epe_next_hop_internal4w_l2_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_L3EDIT_PTR, epe_next_hop_internal4w_l3edit_ptr, 18)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_L3_REWRITE_TYPE, epe_next_hop_internal4w_l3_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_MTU_CHECK_EN, epe_next_hop_internal4w_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_OUTPUT_CVLAN_ID_VALID, epe_next_hop_internal4w_output_cvlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_OUTPUT_SVLAN_ID_VALID, epe_next_hop_internal4w_output_svlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_PAYLOAD_OPERATION, epe_next_hop_internal4w_payload_operation, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_REPLACE_CTAG_COS, epe_next_hop_internal4w_replace_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_REPLACE_DSCP, epe_next_hop_internal4w_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_SERVICE_ACL_QOS_EN, epe_next_hop_internal4w_service_acl_qos_en, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_SERVICE_POLICER_VLD, epe_next_hop_internal4w_service_policer_vld, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_STAG_CFI, epe_next_hop_internal4w_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_STAG_COS, epe_next_hop_internal4w_stag_cos, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_SVLAN_TAGGED, epe_next_hop_internal4w_svlan_tagged, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL4W_TAGGED_MODE, epe_next_hop_internal4w_tagged_mode, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_NEXT_HOP_INTERNAL8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_BY_PASS_ALL, epe_next_hop_internal8w_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_COMMUNITY_PORT, epe_next_hop_internal8w_community_port, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_COPY_CTAG_COS, epe_next_hop_internal8w_copy_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_CVLAN_TAGGED, epe_next_hop_internal8w_cvlan_tagged, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_DERIVE_STAG_COS, epe_next_hop_internal8w_derive_stag_cos, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_DEST_VLAN_PTR, epe_next_hop_internal8w_dest_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L2EDIT_PTR12TO0, epe_next_hop_internal8w_l2edit_ptr12to0, 12)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L2EDIT_PTR19TO13, epe_next_hop_internal8w_l2edit_ptr19to13, 7)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L2_REWRITE_TYPE, epe_next_hop_internal8w_l2_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3EDIT_PTR18, epe_next_hop_internal8w_l3edit_ptr18, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3EDIT_PTR19, epe_next_hop_internal8w_l3edit_ptr19, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3EDIT_PTR170, epe_next_hop_internal8w_l3edit_ptr170, 18)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_L3_REWRITE_TYPE, epe_next_hop_internal8w_l3_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_MTU_CHECK_EN, epe_next_hop_internal8w_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_CVLAN_ID_EXT, epe_next_hop_internal8w_output_cvlan_id_ext, 12)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_CVLAN_ID_VALID, epe_next_hop_internal8w_output_cvlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_CVLAN_ID_VALID_EXT, epe_next_hop_internal8w_output_cvlan_id_valid_ext, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_SVLAN_ID_EXT, epe_next_hop_internal8w_output_svlan_id_ext, 12)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_SVLAN_ID_VALID, epe_next_hop_internal8w_output_svlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_OUTPUT_SVLAN_ID_VALID_EXT, epe_next_hop_internal8w_output_svlan_id_valid_ext, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_PAYLOAD_OPERATION, epe_next_hop_internal8w_payload_operation, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_REPLACE_CTAG_COS, epe_next_hop_internal8w_replace_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_REPLACE_DSCP, epe_next_hop_internal8w_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_ACL_QOS_EN, epe_next_hop_internal8w_service_acl_qos_en, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_ID, epe_next_hop_internal8w_service_id, 14)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_ID_EN, epe_next_hop_internal8w_service_id_en, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SERVICE_POLICER_VALID, epe_next_hop_internal8w_service_policer_valid, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_STAG_CFI, epe_next_hop_internal8w_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_STAG_COS, epe_next_hop_internal8w_stag_cos, 3)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SVLAN_TAGGED, epe_next_hop_internal8w_svlan_tagged, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SVLAN_TPID, epe_next_hop_internal8w_svlan_tpid, 2)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_SVLAN_TPID_EN, epe_next_hop_internal8w_svlan_tpid_en, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_TAGGED_MODE, epe_next_hop_internal8w_tagged_mode, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_TUNNEL_MTU_CHECK, epe_next_hop_internal8w_tunnel_mtu_check, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_TUNNEL_UPDATE_DISABLE, epe_next_hop_internal8w_tunnel_update_disable, 1)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_VPLS_DEST_PORT, epe_next_hop_internal8w_vpls_dest_port, 13)
+        DRV_FIELD_GET_CASE(EPE_NEXT_HOP_INTERNAL8W_VPLS_PORT_CHECK, epe_next_hop_internal8w_vpls_port_check, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_STATSRAMEPEPHBINTF:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_BYTE_COUNT31_TO0_EPE_PHB_INTF, epe_statsramepephbintf_byte_count31_to0_epe_phb_intf, 32)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_BYTE_COUNT34_TO32_EPE_PHB_INTF, epe_statsramepephbintf_byte_count34_to32_epe_phb_intf, 3)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_BYTE_COUNT36_TO35_EPE_PHB_INTF, epe_statsramepephbintf_byte_count36_to35_epe_phb_intf, 2)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_PACKET_COUNT31_TO0_EPE_PHB_INTF, epe_statsramepephbintf_packet_count31_to0_epe_phb_intf, 32)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_PARITY0_EPE_PHB_INTF, epe_statsramepephbintf_parity0_epe_phb_intf, 1)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_PARITY1_EPE_PHB_INTF, epe_statsramepephbintf_parity1_epe_phb_intf, 1)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPHBINTF_USE_L3_LENGTH_EPE_PHB_INTF, epe_statsramepephbintf_use_l3_length_epe_phb_intf, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_STATSRAMEPEPORTLOG:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_BYTE_COUNT31_TO0_EPE_PORT_LOG, epe_statsramepeportlog_byte_count31_to0_epe_port_log, 32)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_BYTE_COUNT34_TO32_EPE_PORT_LOG, epe_statsramepeportlog_byte_count34_to32_epe_port_log, 3)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_BYTE_COUNT36_TO35_EPE_PORT_LOG, epe_statsramepeportlog_byte_count36_to35_epe_port_log, 2)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_PACKET_COUNT31_TO0_EPE_PORT_LOG, epe_statsramepeportlog_packet_count31_to0_epe_port_log, 32)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_PARITY0_EPE_PORT_LOG, epe_statsramepeportlog_parity0_epe_port_log, 1)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_PARITY1_EPE_PORT_LOG, epe_statsramepeportlog_parity1_epe_port_log, 1)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEPORTLOG_USE_L3_LENGTH_EPE_PORT_LOG, epe_statsramepeportlog_use_l3_length_epe_port_log, 1)
+        default:
+            break;
+        }
+        break;
+
+    case EPE_STATSRAMEPEOVERALLFWD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_BYTE_COUNT31_TO0_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_byte_count31_to0_epe_overall_fwd, 32)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_BYTE_COUNT34_TO32_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_byte_count34_to32_epe_overall_fwd, 3)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_BYTE_COUNT36_TO35_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_byte_count36_to35_epe_overall_fwd, 2)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_PACKET_COUNT31_TO0_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_packet_count31_to0_epe_overall_fwd, 32)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_PARITY0_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_parity0_epe_overall_fwd, 1)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_PARITY1_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_parity1_epe_overall_fwd, 1)
+        DRV_FIELD_GET_CASE(EPE_STATSRAMEPEOVERALLFWD_USE_L3_LENGTH_EPE_OVERALL_FWD, epe_statsramepeoverallfwd_use_l3_length_epe_overall_fwd, 1)
+        default:
+            break;
+        }
+        break;
+
+    case FABRIC_CAS_INFO_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRIC_CAS_INFO_RAM_INFO_DATA, fabric_cas_info_ram_info_data, 27)
+        default:
+            break;
+        }
+        break;
+
+    case FABRIC_CAS_DATA_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA0, fabric_cas_data_ram_data0, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA1, fabric_cas_data_ram_data1, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA2, fabric_cas_data_ram_data2, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA3, fabric_cas_data_ram_data3, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA4, fabric_cas_data_ram_data4, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA5, fabric_cas_data_ram_data5, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA6, fabric_cas_data_ram_data6, 32)
+        DRV_FIELD_GET_CASE(FABRIC_CAS_DATA_RAM_DATA7, fabric_cas_data_ram_data7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLBU_F0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_PARITY, fabriccrbcellbu_f0_parity, 8)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD0, fabriccrbcellbu_f0_word0, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD1, fabriccrbcellbu_f0_word1, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD2, fabriccrbcellbu_f0_word2, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD3, fabriccrbcellbu_f0_word3, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD4, fabriccrbcellbu_f0_word4, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD5, fabriccrbcellbu_f0_word5, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD6, fabriccrbcellbu_f0_word6, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F0_WORD7, fabriccrbcellbu_f0_word7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLBU_F1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_PARITY, fabriccrbcellbu_f1_parity, 8)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD0, fabriccrbcellbu_f1_word0, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD1, fabriccrbcellbu_f1_word1, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD2, fabriccrbcellbu_f1_word2, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD3, fabriccrbcellbu_f1_word3, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD4, fabriccrbcellbu_f1_word4, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD5, fabriccrbcellbu_f1_word5, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD6, fabriccrbcellbu_f1_word6, 32)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLBU_F1_WORD7, fabriccrbcellbu_f1_word7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBVALIDTABL_E0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBVALIDTABL_E0_VALID, fabriccrbvalidtabl_e0_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBVALIDTABL_E1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBVALIDTABL_E1_VALID, fabriccrbvalidtabl_e1_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBPTRTABL_E0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBPTRTABL_E0_ADDR_PTR, fabriccrbptrtabl_e0_addr_ptr, 4)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBPTRTABL_E1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBPTRTABL_E1_ADDR_PTR, fabriccrbptrtabl_e1_addr_ptr, 4)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLINFOBU_F0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F0_CELL_INFOR, fabriccrbcellinfobu_f0_cell_infor, 14)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F0_IDLE_CELL, fabriccrbcellinfobu_f0_idle_cell, 1)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F0_PRIORITY, fabriccrbcellinfobu_f0_priority, 2)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F0_SEQ_NUM, fabriccrbcellinfobu_f0_seq_num, 2)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F0_SRC_CHIP_ID, fabriccrbcellinfobu_f0_src_chip_id, 5)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICCRBCELLINFOBU_F1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F1_CELL_INFOR, fabriccrbcellinfobu_f1_cell_infor, 14)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F1_IDLE_CELL, fabriccrbcellinfobu_f1_idle_cell, 1)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F1_PRIORITY, fabriccrbcellinfobu_f1_priority, 2)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F1_SEQ_NUM, fabriccrbcellinfobu_f1_seq_num, 2)
+        DRV_FIELD_GET_CASE(FABRICCRBCELLINFOBU_F1_SRC_CHIP_ID, fabriccrbcellinfobu_f1_src_chip_id, 5)
+        default:
+            break;
+        }
+        break;
+
+    case FABRIC_GTS_RTS_TRACK_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRIC_GTS_RTS_TRACK_RAM_DATA, fabric_gts_rts_track_ram_data, 16)
+        default:
+            break;
+        }
+        break;
+
+    case FABRICRTSCOUNTER:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FABRICRTSCOUNTER_COUNT, fabricrtscounter_count, 11)
+        default:
+            break;
+        }
+        break;
+
+    case CHANINFOTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CHANINFOTABLE_CHAN_CELL_COUNT, chaninfotable_chan_cell_count, 9)
+        DRV_FIELD_GET_CASE(CHANINFOTABLE_CHAN_CELL_HEAD, chaninfotable_chan_cell_head, 9)
+        DRV_FIELD_GET_CASE(CHANINFOTABLE_CHAN_CELL_TAIL, chaninfotable_chan_cell_tail, 9)
+        DRV_FIELD_GET_CASE(CHANINFOTABLE_TAIL_CELL_WRITE_OFFSET, chaninfotable_tail_cell_write_offset, 3)
+        DRV_FIELD_GET_CASE(CHANINFOTABLE_TWO_FRAG, chaninfotable_two_frag, 1)
+        default:
+            break;
+        }
+        break;
+
+    case CELLINFOTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_FIRST_FRAG_EOP, cellinfotable_first_frag_eop, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_FIRST_FRAG_ERROR, cellinfotable_first_frag_error, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_FIRST_FRAG_FULL, cellinfotable_first_frag_full, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_FIRST_FRAG_LENGTH, cellinfotable_first_frag_length, 3)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_FIRST_FRAG_SOP, cellinfotable_first_frag_sop, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_SECOND_FRAG_EOP, cellinfotable_second_frag_eop, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_SECOND_FRAG_ERROR, cellinfotable_second_frag_error, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_SECOND_FRAG_FULL, cellinfotable_second_frag_full, 1)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_SECOND_FRAG_LENGTH, cellinfotable_second_frag_length, 3)
+        DRV_FIELD_GET_CASE(CELLINFOTABLE_SECOND_FRAG_SOP, cellinfotable_second_frag_sop, 1)
+        default:
+            break;
+        }
+        break;
+
+    case CELLTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CELLTABLE_CELL_PTR, celltable_cell_ptr, 9)
+        default:
+            break;
+        }
+        break;
+
+    case HASH_DS_CTL_HASH_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(HASH_DS_CTL_HASH_TABLE_DATA31_TO0, hash_ds_ctl_hash_table_data31_to0, 32)
+        DRV_FIELD_GET_CASE(HASH_DS_CTL_HASH_TABLE_DATA34_TO32, hash_ds_ctl_hash_table_data34_to32, 3)
+        DRV_FIELD_GET_CASE(HASH_DS_CTL_HASH_TABLE_DATA66_TO35, hash_ds_ctl_hash_table_data66_to35, 32)
+        DRV_FIELD_GET_CASE(HASH_DS_CTL_HASH_TABLE_DATA69_TO67, hash_ds_ctl_hash_table_data69_to67, 3)
+        DRV_FIELD_GET_CASE(HASH_DS_CTL_HASH_TABLE_PARITY0, hash_ds_ctl_hash_table_parity0, 1)
+        DRV_FIELD_GET_CASE(HASH_DS_CTL_HASH_TABLE_PARITY1, hash_ds_ctl_hash_table_parity1, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_AGING_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_AGING_RAM_AGING_STATUS, ipe_aging_ram_aging_status, 32)
+        default:
+            break;
+        }
+        break;
+
+    case FWDEXTTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(FWDEXTTABLE_APS_GROUP_ID, fwdexttable_aps_group_id, 16)
+        DRV_FIELD_GET_CASE(FWDEXTTABLE_STATS_PTR, fwdexttable_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case APSBRIDGETABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(APSBRIDGETABLE_PROTECTING_DEST_MAP, apsbridgetable_protecting_dest_map, 22)
+        DRV_FIELD_GET_CASE(APSBRIDGETABLE_PROTECTING_EN, apsbridgetable_protecting_en, 1)
+        DRV_FIELD_GET_CASE(APSBRIDGETABLE_WORKING_DEST_MAP, apsbridgetable_working_dest_map, 16)
+        default:
+            break;
+        }
+        break;
+
+    case SEQUENCENUMBERTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SEQUENCENUMBERTABLE_SEQUENCE_NUMBER, sequencenumbertable_sequence_number, 32)
+        default:
+            break;
+        }
+        break;
+
+    case APSSELECTTABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN0, apsselecttable_protecting_en0, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN1, apsselecttable_protecting_en1, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN2, apsselecttable_protecting_en2, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN3, apsselecttable_protecting_en3, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN4, apsselecttable_protecting_en4, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN5, apsselecttable_protecting_en5, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN6, apsselecttable_protecting_en6, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN7, apsselecttable_protecting_en7, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN8, apsselecttable_protecting_en8, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN9, apsselecttable_protecting_en9, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN10, apsselecttable_protecting_en10, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN11, apsselecttable_protecting_en11, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN12, apsselecttable_protecting_en12, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN13, apsselecttable_protecting_en13, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN14, apsselecttable_protecting_en14, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN15, apsselecttable_protecting_en15, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN16, apsselecttable_protecting_en16, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN17, apsselecttable_protecting_en17, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN18, apsselecttable_protecting_en18, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN19, apsselecttable_protecting_en19, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN20, apsselecttable_protecting_en20, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN21, apsselecttable_protecting_en21, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN22, apsselecttable_protecting_en22, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN23, apsselecttable_protecting_en23, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN24, apsselecttable_protecting_en24, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN25, apsselecttable_protecting_en25, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN26, apsselecttable_protecting_en26, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN27, apsselecttable_protecting_en27, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN28, apsselecttable_protecting_en28, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN29, apsselecttable_protecting_en29, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN30, apsselecttable_protecting_en30, 1)
+        DRV_FIELD_GET_CASE(APSSELECTTABLE_PROTECTING_EN31, apsselecttable_protecting_en31, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DISCARDCOUNT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DISCARDCOUNT_COUNTER, discardcount_counter, 8)
+        default:
+            break;
+        }
+        break;
+
+    case PHY_PORT_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(PHY_PORT_MAP_TABLE_LOCAL_PHY_PORT, phy_port_map_table_local_phy_port, 6)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC_TC_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_COLOR0, sgmac_tc_map_table_color0, 2)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_COLOR1, sgmac_tc_map_table_color1, 2)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_COLOR2, sgmac_tc_map_table_color2, 2)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_COLOR3, sgmac_tc_map_table_color3, 2)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY0, sgmac_tc_map_table_priority0, 6)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY1, sgmac_tc_map_table_priority1, 6)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY2, sgmac_tc_map_table_priority2, 6)
+        DRV_FIELD_GET_CASE(SGMAC_TC_MAP_TABLE_PRIORITY3, sgmac_tc_map_table_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PHY_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_KEEP_VLAN_TAG, ds_phy_port_keep_vlan_tag, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_L2_SPAN_EN, ds_phy_port_l2_span_en, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_L2_SPAN_ID, ds_phy_port_l2_span_id, 2)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_OUTER_VLAN_IS_CVLAN, ds_phy_port_outer_vlan_is_cvlan, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_PACKET_TYPE, ds_phy_port_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_PACKET_TYPE_VALID, ds_phy_port_packet_type_valid, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_PBB_PORT_TYPE, ds_phy_port_pbb_port_type, 3)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_PTP_EN, ds_phy_port_ptp_en, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_RANDOM_LOG_EN, ds_phy_port_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_RANDOM_THRESHOLD, ds_phy_port_random_threshold, 15)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_SRC_DISCARD, ds_phy_port_src_discard, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_SVLAN_TPID_INDEX, ds_phy_port_svlan_tpid_index, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PROTOCOL_VLAN:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_PROTOCOL_VLAN_CPU_EXCEPTION_EN, ds_protocol_vlan_cpu_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_PROTOCOL_VLAN_DISCARD, ds_protocol_vlan_discard, 1)
+        DRV_FIELD_GET_CASE(DS_PROTOCOL_VLAN_PROTOCOL_VLAN_ID, ds_protocol_vlan_protocol_vlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_PROTOCOL_VLAN_PROTOCOL_VLAN_ID_VALID, ds_protocol_vlan_protocol_vlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_PROTOCOL_VLAN_REPLACE_TAG_EN, ds_protocol_vlan_replace_tag_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ROUTER_MAC:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC0_BYTE, ds_router_mac_router_mac0_byte, 8)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC0_TYPE, ds_router_mac_router_mac0_type, 2)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC1_BYTE, ds_router_mac_router_mac1_byte, 8)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC1_TYPE, ds_router_mac_router_mac1_type, 2)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC2_BYTE, ds_router_mac_router_mac2_byte, 8)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC2_TYPE, ds_router_mac_router_mac2_type, 2)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC3_BYTE, ds_router_mac_router_mac3_byte, 8)
+        DRV_FIELD_GET_CASE(DS_ROUTER_MAC_ROUTER_MAC3_TYPE, ds_router_mac_router_mac3_type, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VRF:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_VRF_PFM0, ds_vrf_pfm0, 2)
+        DRV_FIELD_GET_CASE(DS_VRF_PFM1, ds_vrf_pfm1, 2)
+        DRV_FIELD_GET_CASE(DS_VRF_PFM2, ds_vrf_pfm2, 2)
+        DRV_FIELD_GET_CASE(DS_VRF_PFM3, ds_vrf_pfm3, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SRC_PORT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_ALLOW_MCAST_MAC_SA, ds_src_port_allow_mcast_mac_sa, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_BRIDGE_EN, ds_src_port_bridge_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_DEFAULT_REPLACE_TAG_EN, ds_src_port_default_replace_tag_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_EQUAL_COS_PATH_NUM, ds_src_port_equal_cos_path_num, 3)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_ETHER_OAM_VALID, ds_src_port_ether_oam_valid, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_FORCE_ACL_QOS_IPV4_TO_MAC_KEY, ds_src_port_force_acl_qos_ipv4_to_mac_key, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_FORCE_ACL_QOS_IPV6_TO_MAC_KEY, ds_src_port_force_acl_qos_ipv6_to_mac_key, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_INGRESS_FILTERING_EN, ds_src_port_ingress_filtering_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_IPG_INDEX, ds_src_port_ipg_index, 2)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_L2_ACL_EN, ds_src_port_l2_acl_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_L2_ACL_HIGH_PRIORITY, ds_src_port_l2_acl_high_priority, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_L2_ACL_LABEL, ds_src_port_l2_acl_label, 8)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_L2_QOS_HIGH_PRIORITY, ds_src_port_l2_qos_high_priority, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_L2_QOS_LABEL, ds_src_port_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_L2_QOS_LOOKUP_EN, ds_src_port_l2_qos_lookup_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_LEARNING_DISABLE, ds_src_port_learning_disable, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_MAC_SECURITY_DISCARD, ds_src_port_mac_security_discard, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_MD_LEVEL, ds_src_port_md_level, 3)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_OAM_LINK_MAX_MD_LEVEL, ds_src_port_oam_link_max_md_level, 3)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_OAM_TUNNEL_EN, ds_src_port_oam_tunnel_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PIP_MAC_SA, ds_src_port_pip_mac_sa, 8)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PORT_CHECK_EN, ds_src_port_port_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PORT_CROSS_CONNECT, ds_src_port_port_cross_connect, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PORT_POLICER_VALID, ds_src_port_port_policer_valid, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PORT_SECURITY_EN, ds_src_port_port_security_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PORT_SECURITY_EXCEPTION_EN, ds_src_port_port_security_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PRIORITY_PATH_EN, ds_src_port_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_PROTOCOL_VLAN_EN, ds_src_port_protocol_vlan_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_QOS_DOMAIN, ds_src_port_qos_domain, 3)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_QOS_POLICY, ds_src_port_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_RECEIVE_EN, ds_src_port_receive_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_ROUTED_PORT, ds_src_port_routed_port, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_ROUTED_PORT_VLAN_PTR, ds_src_port_routed_port_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_ROUTE_DISABLE, ds_src_port_route_disable, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_SOURCE_PORT_ISOLATED, ds_src_port_source_port_isolated, 6)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_USE_BTAG_COS, ds_src_port_use_btag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_USE_OUTER_TTL, ds_src_port_use_outer_ttl, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_USE_STAG_COS, ds_src_port_use_stag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_VLAN_FLOW_POLICER_VALID, ds_src_port_vlan_flow_policer_valid, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_VLAN_TAG_CTL, ds_src_port_vlan_tag_ctl, 4)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_VPLS_PORT_TYPE, ds_src_port_vpls_port_type, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_PORT_VPLS_SRC_PORT, ds_src_port_vpls_src_port, 13)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PHY_PORT_EXT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_DEFAULT_DEI, ds_phy_port_ext_default_dei, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_DEFAULT_PCP, ds_phy_port_ext_default_pcp, 3)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_DEFAULT_VLAN_ID, ds_phy_port_ext_default_vlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_DISABLE_USER_ID_IPV4, ds_phy_port_ext_disable_user_id_ipv4, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_DISABLE_USER_ID_IPV6, ds_phy_port_ext_disable_user_id_ipv6, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_EGRESS_USER_ID_EN, ds_phy_port_ext_egress_user_id_en, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_EGRESS_USER_ID_TYPE, ds_phy_port_ext_egress_user_id_type, 2)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_EXCEPTION2_DISCARD, ds_phy_port_ext_exception2_discard, 16)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_EXCEPTION2_EN, ds_phy_port_ext_exception2_en, 16)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_FORCE_USER_ID_IPV4_TO_MAC_KEY, ds_phy_port_ext_force_user_id_ipv4_to_mac_key, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_FORCE_USER_ID_IPV6_TO_MAC_KEY, ds_phy_port_ext_force_user_id_ipv6_to_mac_key, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_GLOBAL_SRC_PORT, ds_phy_port_ext_global_src_port, 13)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_OAM_OBEY_USER_ID, ds_phy_port_ext_oam_obey_user_id, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_SRC_OUTER_VLAN_IS_SVLAN, ds_phy_port_ext_src_outer_vlan_is_svlan, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_SVLAN_KEY_FIRST, ds_phy_port_ext_svlan_key_first, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_USER_ID_EN, ds_phy_port_ext_user_id_en, 1)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_USER_ID_LABEL, ds_phy_port_ext_user_id_label, 6)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_USER_ID_TYPE, ds_phy_port_ext_user_id_type, 2)
+        DRV_FIELD_GET_CASE(DS_PHY_PORT_EXT_USE_DEFAULT_VLAN_LOOKUP, ds_phy_port_ext_use_default_vlan_lookup, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SRC_INTERFACE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_EXCEPTION3_EN, ds_src_interface_exception3_en, 16)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_ACL_EN, ds_src_interface_l3_acl_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_ACL_LABEL, ds_src_interface_l3_acl_label, 8)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_ACL_ROUTED_ONLY, ds_src_interface_l3_acl_routed_only, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_IF_TYPE, ds_src_interface_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_QOS_LABEL, ds_src_interface_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_QOS_LOOKUP_EN, ds_src_interface_l3_qos_lookup_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_SPAN_EN, ds_src_interface_l3_span_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_L3_SPAN_ID, ds_src_interface_l3_span_id, 2)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_LOOKUP_MODE, ds_src_interface_lookup_mode, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_MPLS_EN, ds_src_interface_mpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_MPLS_LABEL_SPACE, ds_src_interface_mpls_label_space, 8)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_PBR_LABEL, ds_src_interface_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_ROUTER_MAC_LABEL, ds_src_interface_router_mac_label, 6)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_ROUTER_MAC_TYPE, ds_src_interface_router_mac_type, 2)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_ROUTE_ALL_PACKETS, ds_src_interface_route_all_packets, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_V4_MCAST_RPF_EN, ds_src_interface_v4_mcast_rpf_en, 1)
+        DRV_FIELD_GET_CASE(DS_SRC_INTERFACE_V6_MCAST_RPF_EN, ds_src_interface_v6_mcast_rpf_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_INTERFACE_LABEL_VALID, ds_mpls_ctl_interface_label_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_INTERFACE_LABEL_VALID_MCAST, ds_mpls_ctl_interface_label_valid_mcast, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_LABEL_BASE, ds_mpls_ctl_label_base, 12)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_LABEL_BASE_MCAST, ds_mpls_ctl_label_base_mcast, 12)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_LABEL_SPACE_SIZETYPE, ds_mpls_ctl_label_space_sizetype, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_LABEL_SPACE_SIZETYPE_MCAST, ds_mpls_ctl_label_space_sizetype_mcast, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_NUM_OF_LABEL, ds_mpls_ctl_num_of_label, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_CTL_NUM_OF_LABEL_MCAST, ds_mpls_ctl_num_of_label_mcast, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_BIDI_PIM_GROUP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_BIDI_PIM_GROUP_TABLE_BIDI_PIM_BLOCK, ds_bidi_pim_group_table_bidi_pim_block, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_STORM_CTL_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_STORM_CTL_TABLE_EXCEPTION_EN, ds_storm_ctl_table_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_STORM_CTL_TABLE_RUNNING_COUNT, ds_storm_ctl_table_running_count, 32)
+        DRV_FIELD_GET_CASE(DS_STORM_CTL_TABLE_STORM_EN, ds_storm_ctl_table_storm_en, 1)
+        DRV_FIELD_GET_CASE(DS_STORM_CTL_TABLE_THRESHOLD, ds_storm_ctl_table_threshold, 32)
+        DRV_FIELD_GET_CASE(DS_STORM_CTL_TABLE_USE_PACKET_COUNT, ds_storm_ctl_table_use_packet_count, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_DS_PBB_MAC_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_DS_PBB_MAC_TABLE_BMAC_SA_BIT31_TO0, ipe_ds_pbb_mac_table_bmac_sa_bit31_to0, 32)
+        DRV_FIELD_GET_CASE(IPE_DS_PBB_MAC_TABLE_BMAC_SA_BIT47_TO32, ipe_ds_pbb_mac_table_bmac_sa_bit47_to32, 16)
+        DRV_FIELD_GET_CASE(IPE_DS_PBB_MAC_TABLE_GLOBAL_SRC_PORT, ipe_ds_pbb_mac_table_global_src_port, 13)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_LEARNING_CACHE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_CMAC_SA_LSB, ipe_learning_cache_cmac_sa_lsb, 32)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_CMAC_SA_MSB, ipe_learning_cache_cmac_sa_msb, 16)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_CVLAN_ID, ipe_learning_cache_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_ETHER_OAM_MD_LEVEL, ipe_learning_cache_ether_oam_md_level, 3)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_GLOBAL_SRC_PORT, ipe_learning_cache_global_src_port, 13)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_IS_ETHER_OAM, ipe_learning_cache_is_ether_oam, 1)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_IS_VPLS_SRC_PORT, ipe_learning_cache_is_vpls_src_port, 1)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_MAC_SA_LSB, ipe_learning_cache_mac_sa_lsb, 32)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_MAC_SA_MSB, ipe_learning_cache_mac_sa_msb, 16)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_MAPPED_VLAN_ID, ipe_learning_cache_mapped_vlan_id, 16)
+        DRV_FIELD_GET_CASE(IPE_LEARNING_CACHE_SVLAN_ID, ipe_learning_cache_svlan_id, 12)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_CLASSIFICATION_DSCP_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR0, ipe_classification_dscp_map_table_dscp_color0, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR1, ipe_classification_dscp_map_table_dscp_color1, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR2, ipe_classification_dscp_map_table_dscp_color2, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_COLOR3, ipe_classification_dscp_map_table_dscp_color3, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY0, ipe_classification_dscp_map_table_dscp_priority0, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY1, ipe_classification_dscp_map_table_dscp_priority1, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY2, ipe_classification_dscp_map_table_dscp_priority2, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_DSCP_MAP_TABLE_DSCP_PRIORITY3, ipe_classification_dscp_map_table_dscp_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_CLASSIFICATION_COS_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR0, ipe_classification_cos_map_table_cos_color0, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR1, ipe_classification_cos_map_table_cos_color1, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR2, ipe_classification_cos_map_table_cos_color2, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_COLOR3, ipe_classification_cos_map_table_cos_color3, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY0, ipe_classification_cos_map_table_cos_priority0, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY1, ipe_classification_cos_map_table_cos_priority1, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY2, ipe_classification_cos_map_table_cos_priority2, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_COS_MAP_TABLE_COS_PRIORITY3, ipe_classification_cos_map_table_cos_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR0, ipe_classification_precedence_map_table_pre_color0, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR1, ipe_classification_precedence_map_table_pre_color1, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR2, ipe_classification_precedence_map_table_pre_color2, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_COLOR3, ipe_classification_precedence_map_table_pre_color3, 2)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY0, ipe_classification_precedence_map_table_pre_priority0, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY1, ipe_classification_precedence_map_table_pre_priority1, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY2, ipe_classification_precedence_map_table_pre_priority2, 6)
+        DRV_FIELD_GET_CASE(IPE_CLASSIFICATION_PRECEDENCE_MAP_TABLE_PRE_PRIORITY3, ipe_classification_precedence_map_table_pre_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_MPLS_EXP_MAP_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR0, ipe_mpls_exp_map_table_mpls_color0, 2)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR1, ipe_mpls_exp_map_table_mpls_color1, 2)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR2, ipe_mpls_exp_map_table_mpls_color2, 2)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_COLOR3, ipe_mpls_exp_map_table_mpls_color3, 2)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY0, ipe_mpls_exp_map_table_mpls_priority0, 6)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY1, ipe_mpls_exp_map_table_mpls_priority1, 6)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY2, ipe_mpls_exp_map_table_mpls_priority2, 6)
+        DRV_FIELD_GET_CASE(IPE_MPLS_EXP_MAP_TABLE_MPLS_PRIORITY3, ipe_mpls_exp_map_table_mpls_priority3, 6)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_STATSRAMIPEPHBINTF:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_BYTE_COUNT31_TO0_IPE_PHB_INTF, ipe_statsramipephbintf_byte_count31_to0_ipe_phb_intf, 32)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_BYTE_COUNT34_TO32_IPE_PHB_INTF, ipe_statsramipephbintf_byte_count34_to32_ipe_phb_intf, 3)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_BYTE_COUNT36_TO35_IPE_PHB_INTF, ipe_statsramipephbintf_byte_count36_to35_ipe_phb_intf, 2)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_PACKET_COUNT31_TO0_IPE_PHB_INTF, ipe_statsramipephbintf_packet_count31_to0_ipe_phb_intf, 32)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_PARITY0_IPE_PHB_INTF, ipe_statsramipephbintf_parity0_ipe_phb_intf, 1)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_PARITY1_IPE_PHB_INTF, ipe_statsramipephbintf_parity1_ipe_phb_intf, 1)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPHBINTF_USE_L3_LENGTH_IPE_PHB_INTF, ipe_statsramipephbintf_use_l3_length_ipe_phb_intf, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_STATSRAMIPEPORTLOG:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_BYTE_COUNT31_TO0_IPE_PORT_LOG, ipe_statsramipeportlog_byte_count31_to0_ipe_port_log, 32)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_BYTE_COUNT34_TO32_IPE_PORT_LOG, ipe_statsramipeportlog_byte_count34_to32_ipe_port_log, 3)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_BYTE_COUNT36_TO35_IPE_PORT_LOG, ipe_statsramipeportlog_byte_count36_to35_ipe_port_log, 2)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_PACKET_COUNT31_TO0_IPE_PORT_LOG, ipe_statsramipeportlog_packet_count31_to0_ipe_port_log, 32)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_PARITY0_IPE_PORT_LOG, ipe_statsramipeportlog_parity0_ipe_port_log, 1)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_PARITY1_IPE_PORT_LOG, ipe_statsramipeportlog_parity1_ipe_port_log, 1)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEPORTLOG_USE_L3_LENGTH_IPE_PORT_LOG, ipe_statsramipeportlog_use_l3_length_ipe_port_log, 1)
+        default:
+            break;
+        }
+        break;
+
+    case IPE_STATSRAMIPEOVERALLFWD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_BYTE_COUNT31_TO0_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_byte_count31_to0_ipe_overall_fwd, 32)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_BYTE_COUNT34_TO32_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_byte_count34_to32_ipe_overall_fwd, 3)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_BYTE_COUNT36_TO35_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_byte_count36_to35_ipe_overall_fwd, 2)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_PACKET_COUNT31_TO0_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_packet_count31_to0_ipe_overall_fwd, 32)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_PARITY0_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_parity0_ipe_overall_fwd, 1)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_PARITY1_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_parity1_ipe_overall_fwd, 1)
+        DRV_FIELD_GET_CASE(IPE_STATSRAMIPEOVERALLFWD_USE_L3_LENGTH_IPE_OVERALL_FWD, ipe_statsramipeoverallfwd_use_l3_length_ipe_overall_fwd, 1)
+        default:
+            break;
+        }
+        break;
+
+    case MET_FIFO_RCD_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(MET_FIFO_RCD_RAM_RCD, met_fifo_rcd_ram_rcd, 8)
+        default:
+            break;
+        }
+        break;
+
+    case MET_FIFO_MSG_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(MET_FIFO_MSG_RAM_DATA0, met_fifo_msg_ram_data0, 31)
+        DRV_FIELD_GET_CASE(MET_FIFO_MSG_RAM_DATA1, met_fifo_msg_ram_data1, 32)
+        DRV_FIELD_GET_CASE(MET_FIFO_MSG_RAM_DATA2, met_fifo_msg_ram_data2, 32)
+        DRV_FIELD_GET_CASE(MET_FIFO_MSG_RAM_DATA3, met_fifo_msg_ram_data3, 32)
+        DRV_FIELD_GET_CASE(MET_FIFO_MSG_RAM_DATA4, met_fifo_msg_ram_data4, 32)
+        DRV_FIELD_GET_CASE(MET_FIFO_MSG_RAM_DATA5, met_fifo_msg_ram_data5, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MET_FIFO_EXCP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MET_FIFO_EXCP_DEST_MAP, ds_met_fifo_excp_dest_map, 22)
+        DRV_FIELD_GET_CASE(DS_MET_FIFO_EXCP_EXCEPTION_SUB_INDEX_EN, ds_met_fifo_excp_exception_sub_index_en, 1)
+        DRV_FIELD_GET_CASE(DS_MET_FIFO_EXCP_LENGTH_ADJUST_TYPE, ds_met_fifo_excp_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(DS_MET_FIFO_EXCP_NEXT_HOP_EXT, ds_met_fifo_excp_next_hop_ext, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_APS_BRIDGE_MCAST:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_APS_BRIDGE_MCAST_PROTECTING_EN, ds_aps_bridge_mcast_protecting_en, 1)
+        DRV_FIELD_GET_CASE(DS_APS_BRIDGE_MCAST_PROTECTING_UCAST_ID, ds_aps_bridge_mcast_protecting_ucast_id, 12)
+        DRV_FIELD_GET_CASE(DS_APS_BRIDGE_MCAST_WORKING_UCAST_ID, ds_aps_bridge_mcast_working_ucast_id, 12)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGG_BLOCK_MASK:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_BLOCK_MASK_MASK_HI, ds_link_agg_block_mask_mask_hi, 32)
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_BLOCK_MASK_MASK_LO, ds_link_agg_block_mask_mask_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGG_BITMAP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_BITMAP_BLOCK_MASK_EN, ds_link_agg_bitmap_block_mask_en, 1)
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_BITMAP_MEMBER_HI, ds_link_agg_bitmap_member_hi, 32)
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_BITMAP_MEMBER_LO, ds_link_agg_bitmap_member_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case NET_RX_CHANNEL_INFO_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_BPDU_STATE, net_rx_channel_info_ram_channel_info_data_bpdu_state, 1)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_BUF_CNT, net_rx_channel_info_ram_channel_info_data_buf_cnt, 2)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_CURR_PTR, net_rx_channel_info_ram_channel_info_data_curr_ptr, 9)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_DATA_ERROR_SEEN, net_rx_channel_info_ram_channel_info_data_data_error_seen, 1)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_ENTRY_OFFSET, net_rx_channel_info_ram_channel_info_data_entry_offset, 1)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_HEAD_PTR, net_rx_channel_info_ram_channel_info_data_head_ptr, 9)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_NO_SOP_ERROR_SEEN, net_rx_channel_info_ram_channel_info_data_no_sop_error_seen, 1)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_PKT_LEN, net_rx_channel_info_ram_channel_info_data_pkt_len, 14)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_SOB_STATE, net_rx_channel_info_ram_channel_info_data_sob_state, 1)
+        DRV_FIELD_GET_CASE(NET_RX_CHANNEL_INFO_RAM_CHANNEL_INFO_DATA_STATE, net_rx_channel_info_ram_channel_info_data_state, 1)
+        default:
+            break;
+        }
+        break;
+
+    case NET_RX_LINK_LIST_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(NET_RX_LINK_LIST_TABLE_LINK_LIST_TABLE_WORD, net_rx_link_list_table_link_list_table_word, 9)
+        default:
+            break;
+        }
+        break;
+
+    case NET_RX_PKT_BUF_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD0, net_rx_pkt_buf_ram_pkt_buf_word0, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD1, net_rx_pkt_buf_ram_pkt_buf_word1, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD2, net_rx_pkt_buf_ram_pkt_buf_word2, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD3, net_rx_pkt_buf_ram_pkt_buf_word3, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD4, net_rx_pkt_buf_ram_pkt_buf_word4, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD5, net_rx_pkt_buf_ram_pkt_buf_word5, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD6, net_rx_pkt_buf_ram_pkt_buf_word6, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD7, net_rx_pkt_buf_ram_pkt_buf_word7, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD8, net_rx_pkt_buf_ram_pkt_buf_word8, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD9, net_rx_pkt_buf_ram_pkt_buf_word9, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD10, net_rx_pkt_buf_ram_pkt_buf_word10, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD11, net_rx_pkt_buf_ram_pkt_buf_word11, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD12, net_rx_pkt_buf_ram_pkt_buf_word12, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD13, net_rx_pkt_buf_ram_pkt_buf_word13, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD14, net_rx_pkt_buf_ram_pkt_buf_word14, 32)
+        DRV_FIELD_GET_CASE(NET_RX_PKT_BUF_RAM_PKT_BUF_WORD15, net_rx_pkt_buf_ram_pkt_buf_word15, 32)
+        default:
+            break;
+        }
+        break;
+
+    case PKT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA0, pkt_mem_data0, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA1, pkt_mem_data1, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA2, pkt_mem_data2, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA3, pkt_mem_data3, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA4, pkt_mem_data4, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA5, pkt_mem_data5, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA6, pkt_mem_data6, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA7, pkt_mem_data7, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA8, pkt_mem_data8, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA9, pkt_mem_data9, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA10, pkt_mem_data10, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA11, pkt_mem_data11, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA12, pkt_mem_data12, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA13, pkt_mem_data13, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA14, pkt_mem_data14, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA15, pkt_mem_data15, 32)
+        DRV_FIELD_GET_CASE(PKT_MEM_DATA_INFO, pkt_mem_data_info, 13)
+        DRV_FIELD_GET_CASE(PKT_MEM_PKT_INFO, pkt_mem_pkt_info, 32)
+        default:
+            break;
+        }
+        break;
+
+    case CH_STATIC_INFO_REGS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CH_STATIC_INFO_REGS_END_PTR, ch_static_info_regs_end_ptr, 11)
+        DRV_FIELD_GET_CASE(CH_STATIC_INFO_REGS_FIFO_DEPTH, ch_static_info_regs_fifo_depth, 8)
+        DRV_FIELD_GET_CASE(CH_STATIC_INFO_REGS_START_PTR, ch_static_info_regs_start_ptr, 11)
+        DRV_FIELD_GET_CASE(CH_STATIC_INFO_REGS_THRESHOLD, ch_static_info_regs_threshold, 8)
+        default:
+            break;
+        }
+        break;
+
+    case CH_DYNAMIC_INFO_REGS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CH_DYNAMIC_INFO_REGS_DATA_UNIT_CNT, ch_dynamic_info_regs_data_unit_cnt, 8)
+        DRV_FIELD_GET_CASE(CH_DYNAMIC_INFO_REGS_LAST_PKT_UNIT_CNT, ch_dynamic_info_regs_last_pkt_unit_cnt, 8)
+        DRV_FIELD_GET_CASE(CH_DYNAMIC_INFO_REGS_RD_PTR, ch_dynamic_info_regs_rd_ptr, 11)
+        DRV_FIELD_GET_CASE(CH_DYNAMIC_INFO_REGS_RD_STATE, ch_dynamic_info_regs_rd_state, 1)
+        DRV_FIELD_GET_CASE(CH_DYNAMIC_INFO_REGS_WR_PTR, ch_dynamic_info_regs_wr_ptr, 11)
+        DRV_FIELD_GET_CASE(CH_DYNAMIC_INFO_REGS_WR_STATE, ch_dynamic_info_regs_wr_state, 1)
+        default:
+            break;
+        }
+        break;
+
+    case CALENDAR_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(CALENDAR_CTL_CAL_ENTRY, calendar_ctl_cal_entry, 6)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_OAM_EXCP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_DS_OAM_EXCP_NEXT_HOP_PTR, oam_ds_oam_excp_next_hop_ptr, 20)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MEP_CHAN_TABLE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA0, ds_mep_chan_table_data0, 4)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA1, ds_mep_chan_table_data1, 32)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA2, ds_mep_chan_table_data2, 4)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA3, ds_mep_chan_table_data3, 32)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA4, ds_mep_chan_table_data4, 4)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA5, ds_mep_chan_table_data5, 32)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA6, ds_mep_chan_table_data6, 4)
+        DRV_FIELD_GET_CASE(DS_MEP_CHAN_TABLE_DATA7, ds_mep_chan_table_data7, 32)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_MA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_DS_MA_APS_EN, oam_ds_ma_aps_en, 1)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_APS_SIGNAL_FAIL_LOCAL, oam_ds_ma_aps_signal_fail_local, 1)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_APS_SIGNAL_FAIL_REMOTE, oam_ds_ma_aps_signal_fail_remote, 1)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_CCM_INTERVAL, oam_ds_ma_ccm_interval, 3)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_DEFECT_PRIORITY, oam_ds_ma_defect_priority, 6)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_INTF_STATUS, oam_ds_ma_intf_status, 3)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_MA_ID_LEN, oam_ds_ma_ma_id_len, 6)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_MA_ID_TYPE, oam_ds_ma_ma_id_type, 2)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_MA_NAME_INDEX, oam_ds_ma_ma_name_index, 15)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_MD_LVL, oam_ds_ma_md_lvl, 3)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_NEXT_HOP_PTR, oam_ds_ma_next_hop_ptr, 20)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_OAM_TUNNEL_DISABLE, oam_ds_ma_oam_tunnel_disable, 1)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_PORT_STATUS, oam_ds_ma_port_status, 2)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_PRIORITY_INDEX, oam_ds_ma_priority_index, 3)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_TX_UNTAGGED_OAM, oam_ds_ma_tx_untagged_oam, 1)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_TX_WITH_INTF_STATUS, oam_ds_ma_tx_with_intf_status, 1)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_TX_WITH_PORT_STATUS, oam_ds_ma_tx_with_port_status, 1)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_MA_NAME:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_DS_MA_NAME_MA_ID_ICC_INDEX_HI, oam_ds_ma_name_ma_id_icc_index_hi, 3)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_NAME_MA_ID_ICC_INDEX_LO, oam_ds_ma_name_ma_id_icc_index_lo, 3)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_NAME_MA_ID_UMC0, oam_ds_ma_name_ma_id_umc0, 32)
+        DRV_FIELD_GET_CASE(OAM_DS_MA_NAME_MA_ID_UMC1, oam_ds_ma_name_ma_id_umc1, 32)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_ICC:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_DS_ICC_ICC_HI, oam_ds_icc_icc_hi, 16)
+        DRV_FIELD_GET_CASE(OAM_DS_ICC_ICC_LO, oam_ds_icc_icc_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_PORT_PROPERTY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_DS_PORT_PROPERTY_GLOBAL_SRC_PORT, oam_ds_port_property_global_src_port, 14)
+        DRV_FIELD_GET_CASE(OAM_DS_PORT_PROPERTY_MAC_SA_BYTE, oam_ds_port_property_mac_sa_byte, 8)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_DS_DEFECT_PRIORITY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_DS_DEFECT_PRIORITY_DEFECT_PRIORITY, oam_ds_defect_priority_defect_priority, 6)
+        default:
+            break;
+        }
+        break;
+
+    case OAM_ERR_CACHE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_DEFECT_PRIORITY_ERR_CACHE0, oam_err_cache_defect_priority_err_cache0, 6)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_DEFECT_SUB_TYPE_ERR_CACHE0, oam_err_cache_defect_sub_type_err_cache0, 3)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_DEFECT_TYPE_ERR_CACHE0, oam_err_cache_defect_type_err_cache0, 3)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_INTF_STATUS_VALID_ERR_CACHE0, oam_err_cache_intf_status_valid_err_cache0, 1)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_INTF_STATUS_VALUE_ERR_CACHE0, oam_err_cache_intf_status_value_err_cache0, 3)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_IS_MPLS_ERR_CACHE0, oam_err_cache_is_mpls_err_cache0, 1)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_MEP_INDEX_ERR_CACHE0, oam_err_cache_mep_index_err_cache0, 15)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_PORT_STATUS_VALID_ERR_CACHE0, oam_err_cache_port_status_valid_err_cache0, 1)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_PORT_STATUS_VALUE_ERR_CACHE0, oam_err_cache_port_status_value_err_cache0, 2)
+        DRV_FIELD_GET_CASE(OAM_ERR_CACHE_RMEP_INDEX_ERR_CACHE0, oam_err_cache_rmep_index_err_cache0, 15)
+        default:
+            break;
+        }
+        break;
+
+    case PKTBUF:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(PKTBUF_DATA0, pktbuf_data0, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA1, pktbuf_data1, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA2, pktbuf_data2, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA3, pktbuf_data3, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA4, pktbuf_data4, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA5, pktbuf_data5, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA6, pktbuf_data6, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA7, pktbuf_data7, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA8, pktbuf_data8, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA9, pktbuf_data9, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA10, pktbuf_data10, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA11, pktbuf_data11, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA12, pktbuf_data12, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA13, pktbuf_data13, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA14, pktbuf_data14, 32)
+        DRV_FIELD_GET_CASE(PKTBUF_DATA15, pktbuf_data15, 32)
+        default:
+            break;
+        }
+        break;
+
+    case INTPROFILERAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(INTPROFILERAM_DATA31_TO0, intprofileram_data31_to0, 32)
+        DRV_FIELD_GET_CASE(INTPROFILERAM_DATA35_TO32, intprofileram_data35_to32, 4)
+        DRV_FIELD_GET_CASE(INTPROFILERAM_DATA67_TO36, intprofileram_data67_to36, 32)
+        DRV_FIELD_GET_CASE(INTPROFILERAM_DATA71_TO68, intprofileram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case EXTPROFILERAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(EXTPROFILERAM_DATA31_TO0, extprofileram_data31_to0, 32)
+        DRV_FIELD_GET_CASE(EXTPROFILERAM_DATA35_TO32, extprofileram_data35_to32, 4)
+        DRV_FIELD_GET_CASE(EXTPROFILERAM_DATA67_TO36, extprofileram_data67_to36, 32)
+        DRV_FIELD_GET_CASE(EXTPROFILERAM_DATA71_TO68, extprofileram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case RAM_BIST_QDR:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_ACCESS_READ, ram_bist_qdr_ram_access_read, 1)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_ACCESS_VALID, ram_bist_qdr_ram_access_valid, 1)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_ACCESS_WRITE, ram_bist_qdr_ram_access_write, 1)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_DATA31_TO0, ram_bist_qdr_ram_data31_to0, 32)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_DATA35_TO32, ram_bist_qdr_ram_data35_to32, 4)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_DATA67_TO36, ram_bist_qdr_ram_data67_to36, 32)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_DATA71_TO68, ram_bist_qdr_ram_data71_to68, 4)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_READ_ADDRESS, ram_bist_qdr_ram_read_address, 20)
+        DRV_FIELD_GET_CASE(RAM_BIST_QDR_RAM_WRITE_ADDRESS, ram_bist_qdr_ram_write_address, 20)
+        default:
+            break;
+        }
+        break;
+
+    case RAM_QDR:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(RAM_QDR_RAM_DATA31_TO0, ram_qdr_ram_data31_to0, 32)
+        DRV_FIELD_GET_CASE(RAM_QDR_RAM_DATA35_TO32, ram_qdr_ram_data35_to32, 4)
+        DRV_FIELD_GET_CASE(RAM_QDR_RAM_DATA67_TO36, ram_qdr_ram_data67_to36, 32)
+        DRV_FIELD_GET_CASE(RAM_QDR_RAM_DATA71_TO68, ram_qdr_ram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_IPG_INDEX:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX0, ds_queue_ipg_index_ipg_index0, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX1, ds_queue_ipg_index_ipg_index1, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX2, ds_queue_ipg_index_ipg_index2, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX3, ds_queue_ipg_index_ipg_index3, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX4, ds_queue_ipg_index_ipg_index4, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX5, ds_queue_ipg_index_ipg_index5, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX6, ds_queue_ipg_index_ipg_index6, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_IPG_INDEX_IPG_INDEX7, ds_queue_ipg_index_ipg_index7, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DEPTH:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_DEPTH_QUEUE_AVG_DEPTH, ds_queue_depth_queue_avg_depth, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DEPTH_QUEUE_INST_DEPTH, ds_queue_depth_queue_inst_depth, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGGREGATION:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_LINK_AGGREGATION_DEST_CHIP_ID, ds_link_aggregation_dest_chip_id, 5)
+        DRV_FIELD_GET_CASE(DS_LINK_AGGREGATION_DEST_QUEUE, ds_link_aggregation_dest_queue, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DROP_PROFILE_ID:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP0, ds_queue_drop_profile_id_force_random_drop0, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP1, ds_queue_drop_profile_id_force_random_drop1, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP2, ds_queue_drop_profile_id_force_random_drop2, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_FORCE_RANDOM_DROP3, ds_queue_drop_profile_id_force_random_drop3, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID0, ds_queue_drop_profile_id_prof_id0, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID1, ds_queue_drop_profile_id_prof_id1, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID2, ds_queue_drop_profile_id_prof_id2, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_PROF_ID3, ds_queue_drop_profile_id_prof_id3, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT0, ds_queue_drop_profile_id_que_depth_wt0, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT1, ds_queue_drop_profile_id_que_depth_wt1, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT2, ds_queue_drop_profile_id_que_depth_wt2, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_ID_QUE_DEPTH_WT3, ds_queue_drop_profile_id_que_depth_wt3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DROP_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR0, ds_queue_drop_profile_factor0, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR1, ds_queue_drop_profile_factor1, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR2, ds_queue_drop_profile_factor2, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_FACTOR3, ds_queue_drop_profile_factor3, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_DROP_MODE, ds_queue_drop_profile_wred_drop_mode, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD0, ds_queue_drop_profile_wred_max_thrd0, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD1, ds_queue_drop_profile_wred_max_thrd1, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD2, ds_queue_drop_profile_wred_max_thrd2, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MAX_THRD3, ds_queue_drop_profile_wred_max_thrd3, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD0, ds_queue_drop_profile_wred_min_thrd0, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD1, ds_queue_drop_profile_wred_min_thrd1, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD2, ds_queue_drop_profile_wred_min_thrd2, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_DROP_PROFILE_WRED_MIN_THRD3, ds_queue_drop_profile_wred_min_thrd3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_NUM_GEN_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_CHIP_ID_BASE, ds_queue_num_gen_ctl_dest_chip_id_base, 5)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_CHIP_ID_MASK, ds_queue_num_gen_ctl_dest_chip_id_mask, 5)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_CHIP_ID_SHIFT, ds_queue_num_gen_ctl_dest_chip_id_shift, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_QUE_BASE, ds_queue_num_gen_ctl_dest_que_base, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_QUE_MASK, ds_queue_num_gen_ctl_dest_que_mask, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_DEST_QUE_SHIFT, ds_queue_num_gen_ctl_dest_que_shift, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_FLOW_ID_BASE, ds_queue_num_gen_ctl_flow_id_base, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_FLOW_ID_MASK, ds_queue_num_gen_ctl_flow_id_mask, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_FLOW_ID_SHIFT, ds_queue_num_gen_ctl_flow_id_shift, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_QUE_NUM_BASE, ds_queue_num_gen_ctl_que_num_base, 13)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_QUE_SEL_MASK, ds_queue_num_gen_ctl_que_sel_mask, 6)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_QUE_SEL_SHIFT, ds_queue_num_gen_ctl_que_sel_shift, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_SERVICE_QUE_EN, ds_queue_num_gen_ctl_service_que_en, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_SGMAC_BASE, ds_queue_num_gen_ctl_sgmac_base, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_SGMAC_MASK, ds_queue_num_gen_ctl_sgmac_mask, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_NUM_GEN_CTL_SGMAC_SHIFT, ds_queue_num_gen_ctl_sgmac_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGR_EGRESS_RESRC_THRESHOLD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI0_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri0_que_entry_thrd, 16)
+        DRV_FIELD_GET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI1_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri1_que_entry_thrd, 16)
+        DRV_FIELD_GET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI2_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri2_que_entry_thrd, 16)
+        DRV_FIELD_GET_CASE(DSQ_MGR_EGRESS_RESRC_THRESHOLD_PRI3_QUE_ENTRY_THRD, dsq_mgr_egress_resrc_threshold_pri3_que_entry_thrd, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGR_EGRESS_RESRC_COUNT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DSQ_MGR_EGRESS_RESRC_COUNT_EGRESS_QUE_ENTRY_COUNT, dsq_mgr_egress_resrc_count_egress_que_entry_count, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGG_MEMBER_NUM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_MEMBER_NUM_HASH_MODE, ds_link_agg_member_num_hash_mode, 1)
+        DRV_FIELD_GET_CASE(DS_LINK_AGG_MEMBER_NUM_LINK_AGG_MEM_NUM, ds_link_agg_member_num_link_agg_mem_num, 5)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SGMAC_MAP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC0, ds_sgmac_map_sgmac0, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC1, ds_sgmac_map_sgmac1, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC2, ds_sgmac_map_sgmac2, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC3, ds_sgmac_map_sgmac3, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC4, ds_sgmac_map_sgmac4, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC5, ds_sgmac_map_sgmac5, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC6, ds_sgmac_map_sgmac6, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC7, ds_sgmac_map_sgmac7, 2)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE0, ds_sgmac_map_sgmac_override0, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE1, ds_sgmac_map_sgmac_override1, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE2, ds_sgmac_map_sgmac_override2, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE3, ds_sgmac_map_sgmac_override3, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE4, ds_sgmac_map_sgmac_override4, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE5, ds_sgmac_map_sgmac_override5, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE6, ds_sgmac_map_sgmac_override6, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_OVERRIDE7, ds_sgmac_map_sgmac_override7, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE0, ds_sgmac_map_sgmac_trunk_grp_mode0, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE1, ds_sgmac_map_sgmac_trunk_grp_mode1, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE2, ds_sgmac_map_sgmac_trunk_grp_mode2, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE3, ds_sgmac_map_sgmac_trunk_grp_mode3, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE4, ds_sgmac_map_sgmac_trunk_grp_mode4, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE5, ds_sgmac_map_sgmac_trunk_grp_mode5, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE6, ds_sgmac_map_sgmac_trunk_grp_mode6, 1)
+        DRV_FIELD_GET_CASE(DS_SGMAC_MAP_SGMAC_TRUNK_GRP_MODE7, ds_sgmac_map_sgmac_trunk_grp_mode7, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_HEAD_HASH_MOD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD3, ds_head_hash_mod_mod3, 2)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD5, ds_head_hash_mod_mod5, 3)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD6, ds_head_hash_mod_mod6, 3)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD7, ds_head_hash_mod_mod7, 3)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD9, ds_head_hash_mod_mod9, 4)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD10, ds_head_hash_mod_mod10, 4)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD11, ds_head_hash_mod_mod11, 4)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD12, ds_head_hash_mod_mod12, 4)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD13, ds_head_hash_mod_mod13, 4)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD14, ds_head_hash_mod_mod14, 4)
+        DRV_FIELD_GET_CASE(DS_HEAD_HASH_MOD_MOD15, ds_head_hash_mod_mod15, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SERVICE_QUEUE_HASH_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID0, ds_service_queue_hash_key_dest_id0, 10)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID1, ds_service_queue_hash_key_dest_id1, 10)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID2, ds_service_queue_hash_key_dest_id2, 10)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_DEST_ID3, ds_service_queue_hash_key_dest_id3, 10)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID0, ds_service_queue_hash_key_service_id0, 16)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID1, ds_service_queue_hash_key_service_id1, 16)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID2, ds_service_queue_hash_key_service_id2, 16)
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_HASH_KEY_SERVICE_ID3, ds_service_queue_hash_key_service_id3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_SERVICE_QUEUE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_SERVICE_QUEUE_SERVICE_QUEUE_BASE_OFFSET, ds_service_queue_service_queue_base_offset, 12)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGRQ_HASH_CAM_HASH_CTL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(Q_MGRQ_HASH_CAM_HASH_CTL_SERVICE_QUE_BASE_OFFSET, q_mgrq_hash_cam_hash_ctl_service_que_base_offset, 12)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGRQ_LINK_LIST:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_LIST_NEXT_PTR, dsq_mgrq_link_list_next_ptr, 15)
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_LIST_PKT_LENGTH, dsq_mgrq_link_list_pkt_length, 14)
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_LIST_REP_COUNT, dsq_mgrq_link_list_rep_count, 12)
+        default:
+            break;
+        }
+        break;
+
+    case DSQ_MGRQ_LINK_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_STATE_HEAD_PTR, dsq_mgrq_link_state_head_ptr, 15)
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_STATE_PKT_LENGTH, dsq_mgrq_link_state_pkt_length, 14)
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_STATE_QUEUE_EMPTY, dsq_mgrq_link_state_queue_empty, 1)
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_STATE_REP_COUNT, dsq_mgrq_link_state_rep_count, 12)
+        DRV_FIELD_GET_CASE(DSQ_MGRQ_LINK_STATE_TAIL_PTR, dsq_mgrq_link_state_tail_ptr, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_COMMIT_TOKEN, ds_queue_shape_commit_token, 24)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PEAK_TOKEN, ds_queue_shape_peak_token, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DRR_DEFICIT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_DRR_DEFICIT_DEFICIT, ds_queue_drr_deficit_deficit, 27)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IN_PROFILE_NEXT_QUEUE_PTR:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IN_PROFILE_NEXT_QUEUE_PTR_IN_PROF_NEXT_GRP_ID, ds_in_profile_next_queue_ptr_in_prof_next_grp_id, 9)
+        DRV_FIELD_GET_CASE(DS_IN_PROFILE_NEXT_QUEUE_PTR_IN_PROF_NEXT_QUE_PTR, ds_in_profile_next_queue_ptr_in_prof_next_que_ptr, 11)
+        DRV_FIELD_GET_CASE(DS_IN_PROFILE_NEXT_QUEUE_PTR_IN_PROF_NEXT_QUE_SHP_EN, ds_in_profile_next_queue_ptr_in_prof_next_que_shp_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_OUT_PROFILE_NEXT_QUEUE_PTR:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_OUT_PROFILE_NEXT_QUEUE_PTR_OUT_PROF_NEXT_GRP_ID, ds_out_profile_next_queue_ptr_out_prof_next_grp_id, 9)
+        DRV_FIELD_GET_CASE(DS_OUT_PROFILE_NEXT_QUEUE_PTR_OUT_PROF_NEXT_QUE_PTR, ds_out_profile_next_queue_ptr_out_prof_next_que_ptr, 11)
+        DRV_FIELD_GET_CASE(DS_OUT_PROFILE_NEXT_QUEUE_PTR_OUT_PROF_NEXT_QUE_SHP_EN, ds_out_profile_next_queue_ptr_out_prof_next_que_shp_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_DRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_DRR_WEIGHT_WEIGHT, ds_queue_drr_weight_weight, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_MAP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_MAP_CHANNEL_ID, ds_queue_map_channel_id, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_MAP_GRP_ID, ds_queue_map_grp_id, 9)
+        DRV_FIELD_GET_CASE(DS_QUEUE_MAP_PRIORITY_ID, ds_queue_map_priority_id, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_MAP_QUE_SHP_EN, ds_queue_map_que_shp_en, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_MAP_SGMAC_ID, ds_queue_map_sgmac_id, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_MAP_SGMAC_VALID, ds_queue_map_sgmac_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_LINK_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_GRP_ID0, ds_channel_link_state_in_prof_grp_id0, 9)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_GRP_ID1, ds_channel_link_state_in_prof_grp_id1, 9)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_HEAD_QUE0, ds_channel_link_state_in_prof_head_que0, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_HEAD_QUE1, ds_channel_link_state_in_prof_head_que1, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_QUE_SHP_EN0, ds_channel_link_state_in_prof_que_shp_en0, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_QUE_SHP_EN1, ds_channel_link_state_in_prof_que_shp_en1, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_SUB_CH_STATE1, ds_channel_link_state_in_prof_sub_ch_state1, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_TAIL_QUE0, ds_channel_link_state_in_prof_tail_que0, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_IN_PROF_TAIL_QUE1, ds_channel_link_state_in_prof_tail_que1, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_GRP_ID0, ds_channel_link_state_out_prof_grp_id0, 9)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_GRP_ID1, ds_channel_link_state_out_prof_grp_id1, 9)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_HEAD_QUE0, ds_channel_link_state_out_prof_head_que0, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_HEAD_QUE1, ds_channel_link_state_out_prof_head_que1, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_QUE_SHP_EN0, ds_channel_link_state_out_prof_que_shp_en0, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_QUE_SHP_EN1, ds_channel_link_state_out_prof_que_shp_en1, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_SUB_CH_STATE1, ds_channel_link_state_out_prof_sub_ch_state1, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_TAIL_QUE0, ds_channel_link_state_out_prof_tail_que0, 11)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_LINK_STATE_OUT_PROF_TAIL_QUE1, ds_channel_link_state_out_prof_tail_que1, 11)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_STATE_QUE_IN_IN_PROF_LIST, ds_queue_state_que_in_in_prof_list, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_STATE_QUE_IN_OUT_PROF_LIST, ds_queue_state_que_in_out_prof_list, 16)
+        DRV_FIELD_GET_CASE(DS_QUEUE_STATE_QUE_NOT_EMPTY, ds_queue_state_que_not_empty, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_STATE_QUE_SHP_OK, ds_queue_shape_state_que_shp_ok, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE_PROFILE_ID:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID0, ds_group_shape_profile_id_grp_shp_prof_id0, 8)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID1, ds_group_shape_profile_id_grp_shp_prof_id1, 8)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID2, ds_group_shape_profile_id_grp_shp_prof_id2, 8)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_ID_GRP_SHP_PROF_ID3, ds_group_shape_profile_id_grp_shp_prof_id3, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE_STATE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK0, ds_group_shape_state_grp_shp_ok0, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK1, ds_group_shape_state_grp_shp_ok1, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK2, ds_group_shape_state_grp_shp_ok2, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_STATE_GRP_SHP_OK3, ds_group_shape_state_grp_shp_ok3, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_GRP_TOKEN_RATE, ds_group_shape_profile_grp_token_rate, 22)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_GRP_TOKEN_THRD, ds_group_shape_profile_grp_token_thrd, 8)
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_PROFILE_GRP_TOKEN_THRD_SHIFT, ds_group_shape_profile_grp_token_thrd_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_CONTEXT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_GROUP_CONTEXT_PRIORITY, ds_group_context_priority, 2)
+        DRV_FIELD_GET_CASE(DS_GROUP_CONTEXT_VALID, ds_group_context_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE_PROFILE_ID:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID0, ds_queue_shape_profile_id_que_shp_prof_id0, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID1, ds_queue_shape_profile_id_que_shp_prof_id1, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID2, ds_queue_shape_profile_id_que_shp_prof_id2, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_ID_QUE_SHP_PROF_ID3, ds_queue_shape_profile_id_que_shp_prof_id3, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_SHAPE_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_COMMIT_TOKEN_RATE, ds_queue_shape_profile_que_commit_token_rate, 22)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_COMMIT_TOKEN_THRD, ds_queue_shape_profile_que_commit_token_thrd, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_COMMIT_TOKEN_THRD_SHIFT, ds_queue_shape_profile_que_commit_token_thrd_shift, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_PEAK_TOKEN_RATE, ds_queue_shape_profile_que_peak_token_rate, 22)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_PEAK_TOKEN_THRD, ds_queue_shape_profile_que_peak_token_thrd, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_SHAPE_PROFILE_QUE_PEAK_TOKEN_THRD_SHIFT, ds_queue_shape_profile_que_peak_token_thrd_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_SHAPE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_GROUP_SHAPE_GRP_TOKEN, ds_group_shape_grp_token, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_GROUP_CACHE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_CIR0, ds_group_cache_cir0, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_CIR1, ds_group_cache_cir1, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_CIR2, ds_group_cache_cir2, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_CIR3, ds_group_cache_cir3, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_PRI_ID0, ds_group_cache_pri_id0, 2)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_PRI_ID1, ds_group_cache_pri_id1, 2)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_PRI_ID2, ds_group_cache_pri_id2, 2)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_PRI_ID3, ds_group_cache_pri_id3, 2)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_QUE_ID0, ds_group_cache_que_id0, 11)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_QUE_ID1, ds_group_cache_que_id1, 11)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_QUE_ID2, ds_group_cache_que_id2, 11)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_QUE_ID3, ds_group_cache_que_id3, 11)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_VALID0, ds_group_cache_valid0, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_VALID1, ds_group_cache_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_VALID2, ds_group_cache_valid2, 1)
+        DRV_FIELD_GET_CASE(DS_GROUP_CACHE_VALID3, ds_group_cache_valid3, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_CREDIT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_CHANNEL_CREDIT_CH_CREDIT, ds_channel_credit_ch_credit, 10)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_SHAPE_PROFILE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_CHANNEL_SHAPE_PROFILE_SHAPE_EN, ds_channel_shape_profile_shape_en, 1)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_SHAPE_PROFILE_TOKEN_RATE, ds_channel_shape_profile_token_rate, 22)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_SHAPE_PROFILE_TOKEN_THRD, ds_channel_shape_profile_token_thrd, 8)
+        DRV_FIELD_GET_CASE(DS_CHANNEL_SHAPE_PROFILE_TOKEN_THRD_SHIFT, ds_channel_shape_profile_token_thrd_shift, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CHANNEL_SHAPE:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_CHANNEL_SHAPE_TOKEN, ds_channel_shape_token, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_CH_CREDIT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_CH_CREDIT_CH_CREDIT, ds_ch_credit_ch_credit, 10)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FABRIC_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_FABRIC_WRR_WEIGHT_CFG_WT_CFG, ds_fabric_wrr_weight_cfg_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FABRIC_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_FABRIC_WRR_WEIGHT_WT, ds_fabric_wrr_weight_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NETWORK_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_NETWORK_WRR_WEIGHT_CFG_WT_CFG, ds_network_wrr_weight_cfg_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI0_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri0_wt_cfg, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI1_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri1_wt_cfg, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI2_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri2_wt_cfg, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_CFG_PRI3_WT_CFG, q_mgr_network_out_profile_wrr_weight_cfg_pri3_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI0_WT, q_mgr_network_out_profile_wrr_weight_pri0_wt, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI1_WT, q_mgr_network_out_profile_wrr_weight_pri1_wt, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI2_WT, q_mgr_network_out_profile_wrr_weight_pri2_wt, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_NETWORK_OUT_PROFILE_WRR_WEIGHT_PRI3_WT, q_mgr_network_out_profile_wrr_weight_pri3_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI0_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri0_wt_cfg, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI1_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri1_wt_cfg, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI2_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri2_wt_cfg, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_CFG_PRI3_WT_CFG, q_mgr_fabric_out_profile_wrr_weight_cfg_pri3_wt_cfg, 8)
+        default:
+            break;
+        }
+        break;
+
+    case Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI0_WT, q_mgr_fabric_out_profile_wrr_weight_pri0_wt, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI1_WT, q_mgr_fabric_out_profile_wrr_weight_pri1_wt, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI2_WT, q_mgr_fabric_out_profile_wrr_weight_pri2_wt, 8)
+        DRV_FIELD_GET_CASE(Q_MGR_FABRIC_OUT_PROFILE_WRR_WEIGHT_PRI3_WT, q_mgr_fabric_out_profile_wrr_weight_pri3_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NETWORK_WRR_WEIGHT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_NETWORK_WRR_WEIGHT_WT, ds_network_wrr_weight_wt, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QUEUE_ENTRY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_BUFFER_COUNT, ds_queue_entry_buffer_count, 6)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_DEST_MAP, ds_queue_entry_dest_map, 22)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_DEST_SELECT, ds_queue_entry_dest_select, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_ECC_BIT3_TO0, ds_queue_entry_ecc_bit3_to0, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_ECC_BIT7_TO4, ds_queue_entry_ecc_bit7_to4, 4)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_HEADER_VERSION, ds_queue_entry_header_version, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_HEAD_BUFFER_PTR, ds_queue_entry_head_buffer_ptr, 15)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_HEAD_PTR_BANK_OFFSET, ds_queue_entry_head_ptr_bank_offset, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_LENGTH_ADJUST_TYPE, ds_queue_entry_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_MCAST_RCD, ds_queue_entry_mcast_rcd, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_NEXT_HOP_EXT, ds_queue_entry_next_hop_ext, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_PACKET_LENGTH, ds_queue_entry_packet_length, 14)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_PARITY, ds_queue_entry_parity, 2)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_PT_ENABLE, ds_queue_entry_pt_enable, 1)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_RCD, ds_queue_entry_rcd, 8)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_REPLICATION_CTL, ds_queue_entry_replication_ctl, 20)
+        DRV_FIELD_GET_CASE(DS_QUEUE_ENTRY_RESOURCE_GROUP_ID, ds_queue_entry_resource_group_id, 8)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP0_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP0_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp0_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP0_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp0_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP0_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp0_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP0_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp0_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP10_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP10_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp10_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP10_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp10_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP10_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp10_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP10_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp10_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP11_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP11_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp11_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP11_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp11_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP11_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp11_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP11_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp11_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP1_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP1_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp1_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP1_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp1_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP1_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp1_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP1_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp1_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP2_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP2_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp2_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP2_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp2_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP2_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp2_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP2_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp2_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP3_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP3_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp3_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP3_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp3_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP3_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp3_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP3_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp3_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP4_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP4_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp4_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP4_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp4_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP4_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp4_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP4_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp4_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP5_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP5_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp5_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP5_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp5_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP5_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp5_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP5_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp5_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP6_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP6_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp6_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP6_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp6_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP6_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp6_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP6_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp6_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP7_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP7_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp7_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP7_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp7_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP7_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp7_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP7_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp7_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP8_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP8_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp8_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP8_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp8_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP8_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp8_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP8_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp8_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case QUADMACAPP9_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(QUADMACAPP9_STATS_RAM_BYTE_CNT_DATA_HI, quadmacapp9_stats_ram_byte_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP9_STATS_RAM_BYTE_CNT_DATA_LO, quadmacapp9_stats_ram_byte_cnt_data_lo, 32)
+        DRV_FIELD_GET_CASE(QUADMACAPP9_STATS_RAM_FRAME_CNT_DATA_HI, quadmacapp9_stats_ram_frame_cnt_data_hi, 4)
+        DRV_FIELD_GET_CASE(QUADMACAPP9_STATS_RAM_FRAME_CNT_DATA_LO, quadmacapp9_stats_ram_frame_cnt_data_lo, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC0_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SGMAC0_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac0_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC0_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac0_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(SGMAC0_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac0_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC0_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac0_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC1_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SGMAC1_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac1_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC1_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac1_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(SGMAC1_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac1_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC1_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac1_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC2_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SGMAC2_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac2_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC2_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac2_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(SGMAC2_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac2_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC2_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac2_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SGMAC3_SGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SGMAC3_SGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, sgmac3_sgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC3_SGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, sgmac3_sgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(SGMAC3_SGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, sgmac3_sgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(SGMAC3_SGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, sgmac3_sgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case SHARED_DS_VLAN_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(SHARED_DS_VLAN_MEM_DATA0, shared_ds_vlan_mem_data0, 4)
+        DRV_FIELD_GET_CASE(SHARED_DS_VLAN_MEM_DATA1, shared_ds_vlan_mem_data1, 32)
+        DRV_FIELD_GET_CASE(SHARED_DS_VLAN_MEM_DATA2, shared_ds_vlan_mem_data2, 4)
+        DRV_FIELD_GET_CASE(SHARED_DS_VLAN_MEM_DATA3, shared_ds_vlan_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_LINK_AGGREAGATION_GROUP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_LINK_AGGREAGATION_GROUP_LINK_AGGREGATE_GROUP_EN, ds_link_aggreagation_group_link_aggregate_group_en, 1)
+        DRV_FIELD_GET_CASE(DS_LINK_AGGREAGATION_GROUP_LINK_AGGREGATE_GROUP_ID, ds_link_aggreagation_group_link_aggregate_group_id, 7)
+        default:
+            break;
+        }
+        break;
+
+    case STP_STATE_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE0, stp_state_ram_stp_state0, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE1, stp_state_ram_stp_state1, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE2, stp_state_ram_stp_state2, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE3, stp_state_ram_stp_state3, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE4, stp_state_ram_stp_state4, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE5, stp_state_ram_stp_state5, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE6, stp_state_ram_stp_state6, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE7, stp_state_ram_stp_state7, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE8, stp_state_ram_stp_state8, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE9, stp_state_ram_stp_state9, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE10, stp_state_ram_stp_state10, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE11, stp_state_ram_stp_state11, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE12, stp_state_ram_stp_state12, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE13, stp_state_ram_stp_state13, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE14, stp_state_ram_stp_state14, 2)
+        DRV_FIELD_GET_CASE(STP_STATE_RAM_STP_STATE15, stp_state_ram_stp_state15, 2)
+        default:
+            break;
+        }
+        break;
+
+    case TB_INFO_INT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TB_INFO_INT_MEM_DATA0, tb_info_int_mem_data0, 4)
+        DRV_FIELD_GET_CASE(TB_INFO_INT_MEM_DATA1, tb_info_int_mem_data1, 32)
+        DRV_FIELD_GET_CASE(TB_INFO_INT_MEM_DATA2, tb_info_int_mem_data2, 4)
+        DRV_FIELD_GET_CASE(TB_INFO_INT_MEM_DATA3, tb_info_int_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TB_INFO_HASH_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TB_INFO_HASH_MEM_DATA0, tb_info_hash_mem_data0, 4)
+        DRV_FIELD_GET_CASE(TB_INFO_HASH_MEM_DATA1, tb_info_hash_mem_data1, 32)
+        DRV_FIELD_GET_CASE(TB_INFO_HASH_MEM_DATA2, tb_info_hash_mem_data2, 4)
+        DRV_FIELD_GET_CASE(TB_INFO_HASH_MEM_DATA3, tb_info_hash_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case TB_INFO_EXT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TB_INFO_EXT_MEM_DATA0, tb_info_ext_mem_data0, 4)
+        DRV_FIELD_GET_CASE(TB_INFO_EXT_MEM_DATA1, tb_info_ext_mem_data1, 32)
+        DRV_FIELD_GET_CASE(TB_INFO_EXT_MEM_DATA2, tb_info_ext_mem_data2, 4)
+        DRV_FIELD_GET_CASE(TB_INFO_EXT_MEM_DATA3, tb_info_ext_mem_data3, 32)
+        default:
+            break;
+        }
+        break;
+
+    case RAM_BIST_TB_INFO_EXT_DDR:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ACCESS_LOAD, ram_bist_tb_info_ext_ddr_ram_access_load, 1)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ACCESS_READ, ram_bist_tb_info_ext_ddr_ram_access_read, 1)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ACCESS_VALID, ram_bist_tb_info_ext_ddr_ram_access_valid, 1)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_ADDRESS, ram_bist_tb_info_ext_ddr_ram_address, 20)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA31_TO0, ram_bist_tb_info_ext_ddr_ram_data31_to0, 32)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA35_TO32, ram_bist_tb_info_ext_ddr_ram_data35_to32, 4)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA67_TO36, ram_bist_tb_info_ext_ddr_ram_data67_to36, 32)
+        DRV_FIELD_GET_CASE(RAM_BIST_TB_INFO_EXT_DDR_RAM_DATA71_TO68, ram_bist_tb_info_ext_ddr_ram_data71_to68, 4)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_EXT_BIST_REQUEST_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY31_TO0, tcam_ctl_ext_bist_request_mem_key31_to0, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY63_TO32, tcam_ctl_ext_bist_request_mem_key63_to32, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY79_TO64, tcam_ctl_ext_bist_request_mem_key79_to64, 16)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY111_TO80, tcam_ctl_ext_bist_request_mem_key111_to80, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY143_TO112, tcam_ctl_ext_bist_request_mem_key143_to112, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY159_TO144, tcam_ctl_ext_bist_request_mem_key159_to144, 16)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_CMD, tcam_ctl_ext_bist_request_mem_key_cmd, 8)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_INST, tcam_ctl_ext_bist_request_mem_key_inst, 3)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_SIZE, tcam_ctl_ext_bist_request_mem_key_size, 2)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_KEY_VALID, tcam_ctl_ext_bist_request_mem_key_valid, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_LINK_TRAINING_CMD, tcam_ctl_ext_bist_request_mem_link_training_cmd, 13)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_REQUEST_MEM_LINK_TRAINING_VALID, tcam_ctl_ext_bist_request_mem_link_training_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_EXT_BIST_RESULT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX0, tcam_ctl_ext_bist_result_mem_index0, 20)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX0_COMPARE_EN, tcam_ctl_ext_bist_result_mem_index0_compare_en, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX1, tcam_ctl_ext_bist_result_mem_index1, 20)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX1_COMPARE_EN, tcam_ctl_ext_bist_result_mem_index1_compare_en, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_INDEX_VALID, tcam_ctl_ext_bist_result_mem_index_valid, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_EXT_BIST_RESULT_MEM_RESULT_COMPARE_VALID, tcam_ctl_ext_bist_result_mem_result_compare_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_INT_CPU_REQUEST_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY31_TO0, tcam_ctl_int_cpu_request_mem_key31_to0, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY63_TO32, tcam_ctl_int_cpu_request_mem_key63_to32, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY79_TO64, tcam_ctl_int_cpu_request_mem_key79_to64, 16)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY111_TO80, tcam_ctl_int_cpu_request_mem_key111_to80, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY143_TO112, tcam_ctl_int_cpu_request_mem_key143_to112, 32)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY159_TO144, tcam_ctl_int_cpu_request_mem_key159_to144, 16)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY_CMD, tcam_ctl_int_cpu_request_mem_key_cmd, 8)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY_SIZE, tcam_ctl_int_cpu_request_mem_key_size, 2)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_REQUEST_MEM_KEY_VALID, tcam_ctl_int_cpu_request_mem_key_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case TCAM_CTL_INT_CPU_RESULT_MEM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_ACL, tcam_ctl_int_cpu_result_mem_index_acl, 20)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_ACL_COMP_EN, tcam_ctl_int_cpu_result_mem_index_acl_comp_en, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_QOS, tcam_ctl_int_cpu_result_mem_index_qos, 20)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_QOS_COMP_EN, tcam_ctl_int_cpu_result_mem_index_qos_comp_en, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_INDEX_VALID, tcam_ctl_int_cpu_result_mem_index_valid, 1)
+        DRV_FIELD_GET_CASE(TCAM_CTL_INT_CPU_RESULT_MEM_RESULT_COMPARE_VALID, tcam_ctl_int_cpu_result_mem_result_compare_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC0_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(XGMAC0_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac0_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC0_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac0_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(XGMAC0_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac0_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC0_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac0_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC1_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(XGMAC1_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac1_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC1_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac1_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(XGMAC1_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac1_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC1_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac1_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC2_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(XGMAC2_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac2_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC2_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac2_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(XGMAC2_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac2_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC2_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac2_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case XGMAC3_XGMAC_STATS_RAM:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(XGMAC3_XGMAC_STATS_RAM_BYTE_CNT_DATA_HIGH, xgmac3_xgmac_stats_ram_byte_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC3_XGMAC_STATS_RAM_BYTE_CNT_DATA_LOW, xgmac3_xgmac_stats_ram_byte_cnt_data_low, 32)
+        DRV_FIELD_GET_CASE(XGMAC3_XGMAC_STATS_RAM_FRAME_CNT_DATA_HIGH, xgmac3_xgmac_stats_ram_frame_cnt_data_high, 8)
+        DRV_FIELD_GET_CASE(XGMAC3_XGMAC_STATS_RAM_FRAME_CNT_DATA_LOW, xgmac3_xgmac_stats_ram_frame_cnt_data_low, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_ACL_LOG_ID, ds_mac_acl_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_COLOR, ds_mac_acl_color, 2)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_DENY_BRIDGE, ds_mac_acl_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_DENY_LEARNING, ds_mac_acl_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_DENY_REPLACE_COS, ds_mac_acl_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_DENY_REPLACE_DSCP, ds_mac_acl_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_DENY_ROUTE, ds_mac_acl_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_DISCARD_PACKET, ds_mac_acl_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_FLOW_POLICER_PTR, ds_mac_acl_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_FWD_PTR, ds_mac_acl_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_PRIORITY, ds_mac_acl_priority, 6)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_PRIORITY_VALID, ds_mac_acl_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_QOS_POLICY, ds_mac_acl_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_RANDOM_LOG_EN, ds_mac_acl_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_RANDOM_THRESHOLD_SHIFT, ds_mac_acl_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_STATS_MODE, ds_mac_acl_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_ACL_STATS_PTR, ds_mac_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_ACL_LOG_ID, ds_ipv4_acl_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_COLOR, ds_ipv4_acl_color, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_DENY_BRIDGE, ds_ipv4_acl_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_DENY_LEARNING, ds_ipv4_acl_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_DENY_REPLACE_COS, ds_ipv4_acl_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_DENY_REPLACE_DSCP, ds_ipv4_acl_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_DENY_ROUTE, ds_ipv4_acl_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_DISCARD_PACKET, ds_ipv4_acl_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_FLOW_POLICER_PTR, ds_ipv4_acl_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_FWD_PTR, ds_ipv4_acl_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_PRIORITY, ds_ipv4_acl_priority, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_PRIORITY_VALID, ds_ipv4_acl_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_QOS_POLICY, ds_ipv4_acl_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_RANDOM_LOG_EN, ds_ipv4_acl_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_RANDOM_THRESHOLD_SHIFT, ds_ipv4_acl_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_STATS_MODE, ds_ipv4_acl_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_ACL_STATS_PTR, ds_ipv4_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_ACL_LOG_ID, ds_mpls_acl_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_COLOR, ds_mpls_acl_color, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_DENY_BRIDGE, ds_mpls_acl_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_DENY_LEARNING, ds_mpls_acl_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_DENY_REPLACE_COS, ds_mpls_acl_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_DENY_REPLACE_DSCP, ds_mpls_acl_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_DENY_ROUTE, ds_mpls_acl_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_DISCARD_PACKET, ds_mpls_acl_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_FLOW_POLICER_PTR, ds_mpls_acl_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_FWD_PTR, ds_mpls_acl_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_PRIORITY, ds_mpls_acl_priority, 6)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_PRIORITY_VALID, ds_mpls_acl_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_QOS_POLICY, ds_mpls_acl_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_RANDOM_LOG_EN, ds_mpls_acl_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_RANDOM_THRESHOLD_SHIFT, ds_mpls_acl_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_STATS_MODE, ds_mpls_acl_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_ACL_STATS_PTR, ds_mpls_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_ACL:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_ACL_LOG_ID, ds_ipv6_acl_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_COLOR, ds_ipv6_acl_color, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_DENY_BRIDGE, ds_ipv6_acl_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_DENY_LEARNING, ds_ipv6_acl_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_DENY_REPLACE_COS, ds_ipv6_acl_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_DENY_REPLACE_DSCP, ds_ipv6_acl_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_DENY_ROUTE, ds_ipv6_acl_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_DISCARD_PACKET, ds_ipv6_acl_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_FLOW_POLICER_PTR, ds_ipv6_acl_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_FWD_PTR, ds_ipv6_acl_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_PRIORITY, ds_ipv6_acl_priority, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_PRIORITY_VALID, ds_ipv6_acl_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_QOS_POLICY, ds_ipv6_acl_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_RANDOM_LOG_EN, ds_ipv6_acl_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_RANDOM_THRESHOLD_SHIFT, ds_ipv6_acl_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_STATS_MODE, ds_ipv6_acl_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_ACL_STATS_PTR, ds_ipv6_acl_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_ACL_LOG_ID, ds_mac_qos_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_COLOR, ds_mac_qos_color, 2)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_DENY_BRIDGE, ds_mac_qos_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_DENY_LEARNING, ds_mac_qos_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_DENY_REPLACE_COS, ds_mac_qos_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_DENY_REPLACE_DSCP, ds_mac_qos_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_DENY_ROUTE, ds_mac_qos_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_DISCARD_PACKET, ds_mac_qos_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_FLOW_POLICER_PTR, ds_mac_qos_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_FWD_PTR, ds_mac_qos_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_PRIORITY, ds_mac_qos_priority, 6)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_PRIORITY_VALID, ds_mac_qos_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_QOS_POLICY, ds_mac_qos_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_RANDOM_LOG_EN, ds_mac_qos_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_RANDOM_THRESHOLD_SHIFT, ds_mac_qos_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_STATS_MODE, ds_mac_qos_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_QOS_STATS_PTR, ds_mac_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_ACL_LOG_ID, ds_ipv4_qos_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_COLOR, ds_ipv4_qos_color, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_DENY_BRIDGE, ds_ipv4_qos_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_DENY_LEARNING, ds_ipv4_qos_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_DENY_REPLACE_COS, ds_ipv4_qos_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_DENY_REPLACE_DSCP, ds_ipv4_qos_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_DENY_ROUTE, ds_ipv4_qos_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_DISCARD_PACKET, ds_ipv4_qos_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_FLOW_POLICER_PTR, ds_ipv4_qos_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_FWD_PTR, ds_ipv4_qos_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_PRIORITY, ds_ipv4_qos_priority, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_PRIORITY_VALID, ds_ipv4_qos_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_QOS_POLICY, ds_ipv4_qos_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_RANDOM_LOG_EN, ds_ipv4_qos_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_RANDOM_THRESHOLD_SHIFT, ds_ipv4_qos_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_STATS_MODE, ds_ipv4_qos_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_QOS_STATS_PTR, ds_ipv4_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_ACL_LOG_ID, ds_mpls_qos_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_COLOR, ds_mpls_qos_color, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_DENY_BRIDGE, ds_mpls_qos_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_DENY_LEARNING, ds_mpls_qos_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_DENY_REPLACE_COS, ds_mpls_qos_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_DENY_REPLACE_DSCP, ds_mpls_qos_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_DENY_ROUTE, ds_mpls_qos_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_DISCARD_PACKET, ds_mpls_qos_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_FLOW_POLICER_PTR, ds_mpls_qos_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_FWD_PTR, ds_mpls_qos_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_PRIORITY, ds_mpls_qos_priority, 6)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_PRIORITY_VALID, ds_mpls_qos_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_QOS_POLICY, ds_mpls_qos_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_RANDOM_LOG_EN, ds_mpls_qos_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_RANDOM_THRESHOLD_SHIFT, ds_mpls_qos_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_STATS_MODE, ds_mpls_qos_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_QOS_STATS_PTR, ds_mpls_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_QOS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_ACL_LOG_ID, ds_ipv6_qos_acl_log_id, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_COLOR, ds_ipv6_qos_color, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_DENY_BRIDGE, ds_ipv6_qos_deny_bridge, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_DENY_LEARNING, ds_ipv6_qos_deny_learning, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_DENY_REPLACE_COS, ds_ipv6_qos_deny_replace_cos, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_DENY_REPLACE_DSCP, ds_ipv6_qos_deny_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_DENY_ROUTE, ds_ipv6_qos_deny_route, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_DISCARD_PACKET, ds_ipv6_qos_discard_packet, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_FLOW_POLICER_PTR, ds_ipv6_qos_flow_policer_ptr, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_FWD_PTR, ds_ipv6_qos_fwd_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_PRIORITY, ds_ipv6_qos_priority, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_PRIORITY_VALID, ds_ipv6_qos_priority_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_QOS_POLICY, ds_ipv6_qos_qos_policy, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_RANDOM_LOG_EN, ds_ipv6_qos_random_log_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_RANDOM_THRESHOLD_SHIFT, ds_ipv6_qos_random_threshold_shift, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_STATS_MODE, ds_ipv6_qos_stats_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_QOS_STATS_PTR, ds_ipv6_qos_stats_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_BIDI_PIM_GROUP, ds_ipv4_ucast_da_bidi_pim_group, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv4_ucast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_DENY_PBR, ds_ipv4_ucast_da_deny_pbr, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_DS_FWD_PTR, ds_ipv4_ucast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv4_ucast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv4_ucast_da_equal_cost_path_num, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_EXCEP_SUB_INDEX, ds_ipv4_ucast_da_excep_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_EXP3_CTL_EN, ds_ipv4_ucast_da_exp3_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_ICMP_CHECK_EN, ds_ipv4_ucast_da_icmp_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv4_ucast_da_ip_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_ISATAP_CHECK_EN, ds_ipv4_ucast_da_isatap_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_L3_IF_TYPE, ds_ipv4_ucast_da_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv4_ucast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_PAYLOAD_SELECT, ds_ipv4_ucast_da_payload_select, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_PRIORITY_PATH_EN, ds_ipv4_ucast_da_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_TTL_CHECK_EN, ds_ipv4_ucast_da_ttl_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv4_ucast_da_tunnel_gre_options, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv4_ucast_da_tunnel_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv4_ucast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv4_ucast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_VPLS_EN, ds_ipv4_ucast_da_vpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_DA_VRF_ID, ds_ipv4_ucast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_BIDI_PIM_GROUP, ds_ipv4_mcast_da_bidi_pim_group, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv4_mcast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_DENY_PBR, ds_ipv4_mcast_da_deny_pbr, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_DS_FWD_PTR, ds_ipv4_mcast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv4_mcast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv4_mcast_da_equal_cost_path_num, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_EXCEP_SUB_INDEX, ds_ipv4_mcast_da_excep_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_EXP3_CTL_EN, ds_ipv4_mcast_da_exp3_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_ICMP_CHECK_EN, ds_ipv4_mcast_da_icmp_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv4_mcast_da_ip_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_ISATAP_CHECK_EN, ds_ipv4_mcast_da_isatap_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_L3_IF_TYPE, ds_ipv4_mcast_da_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv4_mcast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_PAYLOAD_SELECT, ds_ipv4_mcast_da_payload_select, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_PRIORITY_PATH_EN, ds_ipv4_mcast_da_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_TTL_CHECK_EN, ds_ipv4_mcast_da_ttl_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv4_mcast_da_tunnel_gre_options, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv4_mcast_da_tunnel_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv4_mcast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv4_mcast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_VPLS_EN, ds_ipv4_mcast_da_vpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_DA_VRF_ID, ds_ipv4_mcast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_BIDI_PIM_GROUP, ds_ipv6_ucast_da_bidi_pim_group, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv6_ucast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_DENY_PBR, ds_ipv6_ucast_da_deny_pbr, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_DS_FWD_PTR, ds_ipv6_ucast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv6_ucast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv6_ucast_da_equal_cost_path_num, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_EXCEP_SUB_INDEX, ds_ipv6_ucast_da_excep_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_EXP3_CTL_EN, ds_ipv6_ucast_da_exp3_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_ICMP_CHECK_EN, ds_ipv6_ucast_da_icmp_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv6_ucast_da_ip_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_ISATAP_CHECK_EN, ds_ipv6_ucast_da_isatap_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_L3_IF_TYPE, ds_ipv6_ucast_da_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv6_ucast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_PAYLOAD_SELECT, ds_ipv6_ucast_da_payload_select, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_PRIORITY_PATH_EN, ds_ipv6_ucast_da_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_TTL_CHECK_EN, ds_ipv6_ucast_da_ttl_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv6_ucast_da_tunnel_gre_options, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv6_ucast_da_tunnel_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv6_ucast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv6_ucast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_VPLS_EN, ds_ipv6_ucast_da_vpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_DA_VRF_ID, ds_ipv6_ucast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_BIDI_PIM_GROUP, ds_ipv6_mcast_da_bidi_pim_group, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_BIDI_PIM_GROUP_VALID, ds_ipv6_mcast_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_DENY_PBR, ds_ipv6_mcast_da_deny_pbr, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_DS_FWD_PTR, ds_ipv6_mcast_da_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_EQUAL_COST_PATH_NUM2, ds_ipv6_mcast_da_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_EQUAL_COST_PATH_NUM, ds_ipv6_mcast_da_equal_cost_path_num, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_EXCEP_SUB_INDEX, ds_ipv6_mcast_da_excep_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_EXP3_CTL_EN, ds_ipv6_mcast_da_exp3_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_ICMP_CHECK_EN, ds_ipv6_mcast_da_icmp_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_IP_DA_EXCEPTION_EN, ds_ipv6_mcast_da_ip_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_ISATAP_CHECK_EN, ds_ipv6_mcast_da_isatap_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_L3_IF_TYPE, ds_ipv6_mcast_da_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv6_mcast_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_PAYLOAD_SELECT, ds_ipv6_mcast_da_payload_select, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_PRIORITY_PATH_EN, ds_ipv6_mcast_da_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_TTL_CHECK_EN, ds_ipv6_mcast_da_ttl_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_TUNNEL_GRE_OPTIONS, ds_ipv6_mcast_da_tunnel_gre_options, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_TUNNEL_PACKET_TYPE, ds_ipv6_mcast_da_tunnel_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv6_mcast_da_tunnel_payload_offset, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv6_mcast_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_VPLS_EN, ds_ipv6_mcast_da_vpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_DA_VRF_ID, ds_ipv6_mcast_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_PBR_DUAL_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP, ds_ipv4_ucast_pbr_dual_da_bidi_pim_group, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP_VALID, ds_ipv4_ucast_pbr_dual_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_DENY_PBR, ds_ipv4_ucast_pbr_dual_da_deny_pbr, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_DS_FWD_PTR, ds_ipv4_ucast_pbr_dual_da_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM2, ds_ipv4_ucast_pbr_dual_da_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM, ds_ipv4_ucast_pbr_dual_da_equal_cost_path_num, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EXCEP_SUB_INDEX, ds_ipv4_ucast_pbr_dual_da_excep_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_EXP3_CTL_EN, ds_ipv4_ucast_pbr_dual_da_exp3_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_ICMP_CHECK_EN, ds_ipv4_ucast_pbr_dual_da_icmp_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_IP_DA_EXCEPTION_EN, ds_ipv4_ucast_pbr_dual_da_ip_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_ISATAP_CHECK_EN, ds_ipv4_ucast_pbr_dual_da_isatap_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_L3_IF_TYPE, ds_ipv4_ucast_pbr_dual_da_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv4_ucast_pbr_dual_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_PAYLOAD_SELECT, ds_ipv4_ucast_pbr_dual_da_payload_select, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_PRIORITY_PATH_EN, ds_ipv4_ucast_pbr_dual_da_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TTL_CHECK_EN, ds_ipv4_ucast_pbr_dual_da_ttl_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_GRE_OPTIONS, ds_ipv4_ucast_pbr_dual_da_tunnel_gre_options, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_PACKET_TYPE, ds_ipv4_ucast_pbr_dual_da_tunnel_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv4_ucast_pbr_dual_da_tunnel_payload_offset, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv4_ucast_pbr_dual_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_VPLS_EN, ds_ipv4_ucast_pbr_dual_da_vpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_PBR_DUAL_DA_VRF_ID, ds_ipv4_ucast_pbr_dual_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_PBR_DUAL_DA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP, ds_ipv6_ucast_pbr_dual_da_bidi_pim_group, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_BIDI_PIM_GROUP_VALID, ds_ipv6_ucast_pbr_dual_da_bidi_pim_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_DENY_PBR, ds_ipv6_ucast_pbr_dual_da_deny_pbr, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_DS_FWD_PTR, ds_ipv6_ucast_pbr_dual_da_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM2, ds_ipv6_ucast_pbr_dual_da_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EQUAL_COST_PATH_NUM, ds_ipv6_ucast_pbr_dual_da_equal_cost_path_num, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EXCEP_SUB_INDEX, ds_ipv6_ucast_pbr_dual_da_excep_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_EXP3_CTL_EN, ds_ipv6_ucast_pbr_dual_da_exp3_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_ICMP_CHECK_EN, ds_ipv6_ucast_pbr_dual_da_icmp_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_IP_DA_EXCEPTION_EN, ds_ipv6_ucast_pbr_dual_da_ip_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_ISATAP_CHECK_EN, ds_ipv6_ucast_pbr_dual_da_isatap_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_L3_IF_TYPE, ds_ipv6_ucast_pbr_dual_da_l3_if_type, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_MCAST_RPF_FAIL_CPU_EN, ds_ipv6_ucast_pbr_dual_da_mcast_rpf_fail_cpu_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_PAYLOAD_SELECT, ds_ipv6_ucast_pbr_dual_da_payload_select, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_PRIORITY_PATH_EN, ds_ipv6_ucast_pbr_dual_da_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TTL_CHECK_EN, ds_ipv6_ucast_pbr_dual_da_ttl_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_GRE_OPTIONS, ds_ipv6_ucast_pbr_dual_da_tunnel_gre_options, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_PACKET_TYPE, ds_ipv6_ucast_pbr_dual_da_tunnel_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET, ds_ipv6_ucast_pbr_dual_da_tunnel_payload_offset, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_TUNNEL_PAYLOAD_OFFSET_TYPE, ds_ipv6_ucast_pbr_dual_da_tunnel_payload_offset_type, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_VPLS_EN, ds_ipv6_ucast_pbr_dual_da_vpls_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_PBR_DUAL_DA_VRF_ID, ds_ipv6_ucast_pbr_dual_da_vrf_id, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_SA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_CHECK_EN, ds_ipv4_ucast_sa_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID0, ds_ipv4_ucast_sa_if_id0, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID1, ds_ipv4_ucast_sa_if_id1, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID2, ds_ipv4_ucast_sa_if_id2, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID3, ds_ipv4_ucast_sa_if_id3, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID0, ds_ipv4_ucast_sa_if_id_valid0, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID1, ds_ipv4_ucast_sa_if_id_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID2, ds_ipv4_ucast_sa_if_id_valid2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IF_ID_VALID3, ds_ipv4_ucast_sa_if_id_valid3, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_SA_IPSA_MORE_RPF_IF, ds_ipv4_ucast_sa_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_SA:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_CHECK_EN, ds_ipv6_ucast_sa_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID0, ds_ipv6_ucast_sa_if_id0, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID1, ds_ipv6_ucast_sa_if_id1, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID2, ds_ipv6_ucast_sa_if_id2, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID3, ds_ipv6_ucast_sa_if_id3, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID0, ds_ipv6_ucast_sa_if_id_valid0, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID1, ds_ipv6_ucast_sa_if_id_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID2, ds_ipv6_ucast_sa_if_id_valid2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IF_ID_VALID3, ds_ipv6_ucast_sa_if_id_valid3, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_SA_IPSA_MORE_RPF_IF, ds_ipv6_ucast_sa_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_RPF:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_CHECK_EN, ds_ipv4_mcast_rpf_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID0, ds_ipv4_mcast_rpf_if_id0, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID1, ds_ipv4_mcast_rpf_if_id1, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID2, ds_ipv4_mcast_rpf_if_id2, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID3, ds_ipv4_mcast_rpf_if_id3, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID0, ds_ipv4_mcast_rpf_if_id_valid0, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID1, ds_ipv4_mcast_rpf_if_id_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID2, ds_ipv4_mcast_rpf_if_id_valid2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IF_ID_VALID3, ds_ipv4_mcast_rpf_if_id_valid3, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_RPF_IPSA_MORE_RPF_IF, ds_ipv4_mcast_rpf_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_RPF:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_CHECK_EN, ds_ipv6_mcast_rpf_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID0, ds_ipv6_mcast_rpf_if_id0, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID1, ds_ipv6_mcast_rpf_if_id1, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID2, ds_ipv6_mcast_rpf_if_id2, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID3, ds_ipv6_mcast_rpf_if_id3, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID0, ds_ipv6_mcast_rpf_if_id_valid0, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID1, ds_ipv6_mcast_rpf_if_id_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID2, ds_ipv6_mcast_rpf_if_id_valid2, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IF_ID_VALID3, ds_ipv6_mcast_rpf_if_id_valid3, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_RPF_IPSA_MORE_RPF_IF, ds_ipv6_mcast_rpf_ipsa_more_rpf_if, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_SA_NAT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_FORCE_IP_SA_FWD, ds_ipv4_sa_nat_force_ip_sa_fwd, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_IPV4_EMBED_MODE, ds_ipv4_sa_nat_ipv4_embed_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_IP_SA, ds_ipv4_sa_nat_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_IP_SA_FWD_PTR_VALID, ds_ipv4_sa_nat_ip_sa_fwd_ptr_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_IP_SA_MODE, ds_ipv4_sa_nat_ip_sa_mode, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_IP_SA_PREFIX, ds_ipv4_sa_nat_ip_sa_prefix, 8)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_IP_SA_PREFIX_LEN, ds_ipv4_sa_nat_ip_sa_prefix_len, 3)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_L4_SOURCE_PORT, ds_ipv4_sa_nat_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_REPLACE_IP_SA, ds_ipv4_sa_nat_replace_ip_sa, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_SA_NAT_REPLACE_L4_SOURCE_PORT, ds_ipv4_sa_nat_replace_l4_source_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_SA_NAT:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_FORCE_IP_SA_FWD, ds_ipv6_sa_nat_force_ip_sa_fwd, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_IPV4_EMBED_MODE, ds_ipv6_sa_nat_ipv4_embed_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_IP_SA, ds_ipv6_sa_nat_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_IP_SA_FWD_PTR_VALID, ds_ipv6_sa_nat_ip_sa_fwd_ptr_valid, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_IP_SA_MODE, ds_ipv6_sa_nat_ip_sa_mode, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_IP_SA_PREFIX, ds_ipv6_sa_nat_ip_sa_prefix, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_IP_SA_PREFIX_LEN, ds_ipv6_sa_nat_ip_sa_prefix_len, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_L4_SOURCE_PORT, ds_ipv6_sa_nat_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_REPLACE_IP_SA, ds_ipv6_sa_nat_replace_ip_sa, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_SA_NAT_REPLACE_L4_SOURCE_PORT, ds_ipv6_sa_nat_replace_l4_source_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_VLAN:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_APS_SELECT_VALID, ds_user_id_vlan_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_BINDING_DATAH, ds_user_id_vlan_binding_datah, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_BINDING_DATAL, ds_user_id_vlan_binding_datal, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_BINDING_DATAM, ds_user_id_vlan_binding_datam, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_BINDING_EN, ds_user_id_vlan_binding_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_BINDING_MAC_SA, ds_user_id_vlan_binding_mac_sa, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_BY_PASS_ALL, ds_user_id_vlan_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_DS_FWD_PTR_VALID, ds_user_id_vlan_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_EXCEPTION_EN, ds_user_id_vlan_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_SRC_COMMUNICATE_PORT, ds_user_id_vlan_src_communicate_port, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_SRC_QUEUE_SELECT, ds_user_id_vlan_src_queue_select, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_USER_VLAN_PTR, ds_user_id_vlan_user_vlan_ptr, 13)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_VPLS_PORT_TYPE, ds_user_id_vlan_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_MAC:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_APS_SELECT_VALID, ds_user_id_mac_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_BINDING_DATAH, ds_user_id_mac_binding_datah, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_BINDING_DATAL, ds_user_id_mac_binding_datal, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_BINDING_DATAM, ds_user_id_mac_binding_datam, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_BINDING_EN, ds_user_id_mac_binding_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_BINDING_MAC_SA, ds_user_id_mac_binding_mac_sa, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_BY_PASS_ALL, ds_user_id_mac_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_DS_FWD_PTR_VALID, ds_user_id_mac_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_EXCEPTION_EN, ds_user_id_mac_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_SRC_COMMUNICATE_PORT, ds_user_id_mac_src_communicate_port, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_SRC_QUEUE_SELECT, ds_user_id_mac_src_queue_select, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_USER_VLAN_PTR, ds_user_id_mac_user_vlan_ptr, 13)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_VPLS_PORT_TYPE, ds_user_id_mac_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV4:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_APS_SELECT_VALID, ds_user_id_ipv4_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_BINDING_DATAH, ds_user_id_ipv4_binding_datah, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_BINDING_DATAL, ds_user_id_ipv4_binding_datal, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_BINDING_DATAM, ds_user_id_ipv4_binding_datam, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_BINDING_EN, ds_user_id_ipv4_binding_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_BINDING_MAC_SA, ds_user_id_ipv4_binding_mac_sa, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_BY_PASS_ALL, ds_user_id_ipv4_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_DS_FWD_PTR_VALID, ds_user_id_ipv4_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_EXCEPTION_EN, ds_user_id_ipv4_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_SRC_COMMUNICATE_PORT, ds_user_id_ipv4_src_communicate_port, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_SRC_QUEUE_SELECT, ds_user_id_ipv4_src_queue_select, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_USER_VLAN_PTR, ds_user_id_ipv4_user_vlan_ptr, 13)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_VPLS_PORT_TYPE, ds_user_id_ipv4_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV6:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_APS_SELECT_VALID, ds_user_id_ipv6_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_BINDING_DATAH, ds_user_id_ipv6_binding_datah, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_BINDING_DATAL, ds_user_id_ipv6_binding_datal, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_BINDING_DATAM, ds_user_id_ipv6_binding_datam, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_BINDING_EN, ds_user_id_ipv6_binding_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_BINDING_MAC_SA, ds_user_id_ipv6_binding_mac_sa, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_BY_PASS_ALL, ds_user_id_ipv6_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_DS_FWD_PTR_VALID, ds_user_id_ipv6_ds_fwd_ptr_valid, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_EXCEPTION_EN, ds_user_id_ipv6_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_SRC_COMMUNICATE_PORT, ds_user_id_ipv6_src_communicate_port, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_SRC_QUEUE_SELECT, ds_user_id_ipv6_src_queue_select, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_USER_VLAN_PTR, ds_user_id_ipv6_user_vlan_ptr, 13)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_VPLS_PORT_TYPE, ds_user_id_ipv6_vpls_port_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_ETH4W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_DERIVE_MCAST_MAC, ds_l2_edit_eth4w_derive_mcast_mac, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_MAC_DAH, ds_l2_edit_eth4w_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_MAC_DAL, ds_l2_edit_eth4w_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_MAC_SA_VALID, ds_l2_edit_eth4w_mac_sa_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_CVLANID_VALID, ds_l2_edit_eth4w_output_cvlanid_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_VLANID_IS_SVLAN, ds_l2_edit_eth4w_output_vlanid_is_svlan, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_VLAN_ID, ds_l2_edit_eth4w_output_vlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_OUTPUT_VLAN_ID_VALID, ds_l2_edit_eth4w_output_vlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_OVERWRITE_ETHER_TYPE, ds_l2_edit_eth4w_overwrite_ether_type, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_PACKET_TYPE, ds_l2_edit_eth4w_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH4W_TYPE, ds_l2_edit_eth4w_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_ETH8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_DERIVE_MCAST_MAC, ds_l2_edit_eth8w_derive_mcast_mac, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_MAC_DAH, ds_l2_edit_eth8w_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_MAC_DAL, ds_l2_edit_eth8w_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_MAC_SAH, ds_l2_edit_eth8w_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_MAC_SAL, ds_l2_edit_eth8w_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_MAC_SA_VALID, ds_l2_edit_eth8w_mac_sa_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_IDH, ds_l2_edit_eth8w_output_cvlan_idh, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_IDL, ds_l2_edit_eth8w_output_cvlan_idl, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_IDM, ds_l2_edit_eth8w_output_cvlan_idm, 6)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_CVLAN_ID_VALID, ds_l2_edit_eth8w_output_cvlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_VLANID_IS_SVLAN, ds_l2_edit_eth8w_output_vlanid_is_svlan, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_VLAN_ID, ds_l2_edit_eth8w_output_vlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OUTPUT_VLAN_ID_VALID, ds_l2_edit_eth8w_output_vlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_OVERWRITE_ETHER_TYPE, ds_l2_edit_eth8w_overwrite_ether_type, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_PACKET_TYPE, ds_l2_edit_eth8w_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_ETH8W_TYPE, ds_l2_edit_eth8w_type, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_FLEX4W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX4W_PACKET_TYPE, ds_l2_edit_flex4w_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX4W_REWRITE_BYTE_NUM, ds_l2_edit_flex4w_rewrite_byte_num, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX4W_REWRITE_STRINGH, ds_l2_edit_flex4w_rewrite_stringh, 24)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX4W_REWRITE_STRINGL, ds_l2_edit_flex4w_rewrite_stringl, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_FLEX8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX8W_PACKET_TYPE, ds_l2_edit_flex8w_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_BYTE_NUM, ds_l2_edit_flex8w_rewrite_byte_num, 4)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING0, ds_l2_edit_flex8w_rewrite_string0, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING1, ds_l2_edit_flex8w_rewrite_string1, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING2, ds_l2_edit_flex8w_rewrite_string2, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_FLEX8W_REWRITE_STRING3, ds_l2_edit_flex8w_rewrite_string3, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_LOOPBACK:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_LOOPBACK_LB_DEST_MAP, ds_l2_edit_loopback_lb_dest_map, 22)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_LOOPBACK_LB_LENGTH_ADJUST_TYPE, ds_l2_edit_loopback_lb_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_LOOPBACK_LB_NEXT_HOP_EXT, ds_l2_edit_loopback_lb_next_hop_ext, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_LOOPBACK_LB_NEXT_HOP_PTR, ds_l2_edit_loopback_lb_next_hop_ptr, 20)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_PBB8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_BTAG_CFI, ds_l2_edit_pbb8w_btag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_BTAG_COS, ds_l2_edit_pbb8w_btag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_BVLAN_ID, ds_l2_edit_pbb8w_bvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_BVLAN_TAGGED, ds_l2_edit_pbb8w_bvlan_tagged, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_BVLAN_TAG_DISABLE, ds_l2_edit_pbb8w_bvlan_tag_disable, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_BVLAN_VALID, ds_l2_edit_pbb8w_bvlan_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_COPY_NCA_RES, ds_l2_edit_pbb8w_copy_nca_res, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_DERIVE_BTAG_COS, ds_l2_edit_pbb8w_derive_btag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_DERIVE_ITAG_COS, ds_l2_edit_pbb8w_derive_itag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_DERIVE_MAC_DA, ds_l2_edit_pbb8w_derive_mac_da, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_ISID_VALID, ds_l2_edit_pbb8w_isid_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_ITAG_CFI, ds_l2_edit_pbb8w_itag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_ITAG_COS, ds_l2_edit_pbb8w_itag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_I_SID, ds_l2_edit_pbb8w_i_sid, 24)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_MAC_DA310, ds_l2_edit_pbb8w_mac_da310, 32)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_MAC_DA4732, ds_l2_edit_pbb8w_mac_da4732, 16)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_MAC_DA_VALID, ds_l2_edit_pbb8w_mac_da_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_MAC_SA_VALID, ds_l2_edit_pbb8w_mac_sa_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_NCA, ds_l2_edit_pbb8w_nca, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_PBB_HEADER_OP_TYPE, ds_l2_edit_pbb8w_pbb_header_op_type, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_RES1, ds_l2_edit_pbb8w_res1, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB8W_RES2, ds_l2_edit_pbb8w_res2, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L2_EDIT_PBB4W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_BTAG_CFI, ds_l2_edit_pbb4w_btag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_BTAG_COS, ds_l2_edit_pbb4w_btag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_BVLAN_ID, ds_l2_edit_pbb4w_bvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_BVLAN_TAGGED, ds_l2_edit_pbb4w_bvlan_tagged, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_BVLAN_TAG_DISABLE, ds_l2_edit_pbb4w_bvlan_tag_disable, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_BVLAN_VALID, ds_l2_edit_pbb4w_bvlan_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_COPY_NCA_RES, ds_l2_edit_pbb4w_copy_nca_res, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_DERIVE_ITAG_COS, ds_l2_edit_pbb4w_derive_itag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_DERIVE_MAC_DA, ds_l2_edit_pbb4w_derive_mac_da, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_ISID_VALID, ds_l2_edit_pbb4w_isid_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_ITAG_CFI, ds_l2_edit_pbb4w_itag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_ITAG_COS, ds_l2_edit_pbb4w_itag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_I_SID, ds_l2_edit_pbb4w_i_sid, 24)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_MACDA_VALID, ds_l2_edit_pbb4w_macda_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_MAC_SA_VALID, ds_l2_edit_pbb4w_mac_sa_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_MAP_BTAG_COS, ds_l2_edit_pbb4w_map_btag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_NCA, ds_l2_edit_pbb4w_nca, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_PBB_HEADER_OP_TYPE, ds_l2_edit_pbb4w_pbb_header_op_type, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_RES1, ds_l2_edit_pbb4w_res1, 1)
+        DRV_FIELD_GET_CASE(DS_L2_EDIT_PBB4W_RES2, ds_l2_edit_pbb4w_res2, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_MPLS4W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_DERIVE_EXP0, ds_l3edit_mpls4w_derive_exp0, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_DERIVE_EXP1, ds_l3edit_mpls4w_derive_exp1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_EXP0, ds_l3edit_mpls4w_exp0, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_EXP1, ds_l3edit_mpls4w_exp1, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_LABEL0, ds_l3edit_mpls4w_label0, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_LABEL1, ds_l3edit_mpls4w_label1, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_LABEL_VALID1, ds_l3edit_mpls4w_label_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_MAP_TTL0, ds_l3edit_mpls4w_map_ttl0, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_MAP_TTL1, ds_l3edit_mpls4w_map_ttl1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_MARTINI_ENCAP_VALID, ds_l3edit_mpls4w_martini_encap_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_MCAST_LABEL0, ds_l3edit_mpls4w_mcast_label0, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_MCAST_LABEL1, ds_l3edit_mpls4w_mcast_label1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_TTL0, ds_l3edit_mpls4w_ttl0, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS4W_TTL1, ds_l3edit_mpls4w_ttl1, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_MPLS8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP0, ds_l3edit_mpls8w_derive_exp0, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP1, ds_l3edit_mpls8w_derive_exp1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP2, ds_l3edit_mpls8w_derive_exp2, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_DERIVE_EXP3, ds_l3edit_mpls8w_derive_exp3, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_EXP0, ds_l3edit_mpls8w_exp0, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_EXP1, ds_l3edit_mpls8w_exp1, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_EXP2, ds_l3edit_mpls8w_exp2, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_EXP3, ds_l3edit_mpls8w_exp3, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL0, ds_l3edit_mpls8w_label0, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL1, ds_l3edit_mpls8w_label1, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL2, ds_l3edit_mpls8w_label2, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL3, ds_l3edit_mpls8w_label3, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL_VALID1, ds_l3edit_mpls8w_label_valid1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL_VALID2, ds_l3edit_mpls8w_label_valid2, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_LABEL_VALID3, ds_l3edit_mpls8w_label_valid3, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL0, ds_l3edit_mpls8w_map_ttl0, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL1, ds_l3edit_mpls8w_map_ttl1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL2, ds_l3edit_mpls8w_map_ttl2, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MAP_TTL3, ds_l3edit_mpls8w_map_ttl3, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MARTINI_ENCAP_VALID, ds_l3edit_mpls8w_martini_encap_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL0, ds_l3edit_mpls8w_mcast_label0, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL1, ds_l3edit_mpls8w_mcast_label1, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL2, ds_l3edit_mpls8w_mcast_label2, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_MCAST_LABEL3, ds_l3edit_mpls8w_mcast_label3, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_TTL0, ds_l3edit_mpls8w_ttl0, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_TTL1, ds_l3edit_mpls8w_ttl1, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_TTL2, ds_l3edit_mpls8w_ttl2, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_MPLS8W_TTL3, ds_l3edit_mpls8w_ttl3, 8)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_NAT4W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_IPDA104, ds_l3edit_nat4w_ipda104, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_IPDA105, ds_l3edit_nat4w_ipda105, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_IPDA3932, ds_l3edit_nat4w_ipda3932, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_IPDA, ds_l3edit_nat4w_ipda, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_IPDA_PREFIX_LEN, ds_l3edit_nat4w_ipda_prefix_len, 7)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_IPV4_EMBED_MODE, ds_l3edit_nat4w_ipv4_embed_mode, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_L4_DEST_PORT, ds_l3edit_nat4w_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_NAT_MODE, ds_l3edit_nat4w_nat_mode, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_REPLACE_IPDA, ds_l3edit_nat4w_replace_ipda, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_REPLACE_L4_DEST_PORT, ds_l3edit_nat4w_replace_l4_dest_port, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT4W_USE_PORT, ds_l3edit_nat4w_use_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_NAT8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA104, ds_l3edit_nat8w_ipda104, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA105, ds_l3edit_nat8w_ipda105, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA3932, ds_l3edit_nat8w_ipda3932, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA7140, ds_l3edit_nat8w_ipda7140, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA10372, ds_l3edit_nat8w_ipda10372, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA108106, ds_l3edit_nat8w_ipda108106, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA111109, ds_l3edit_nat8w_ipda111109, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA, ds_l3edit_nat8w_ipda, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA_PREFIX_LEN, ds_l3edit_nat8w_ipda_prefix_len, 7)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPDA_USE_PORT, ds_l3edit_nat8w_ipda_use_port, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_IPV4_EMBED_MODE, ds_l3edit_nat8w_ipv4_embed_mode, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_L4_DEST_PORT, ds_l3edit_nat8w_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_NAT_MODE, ds_l3edit_nat8w_nat_mode, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_REPLACE_IPDA, ds_l3edit_nat8w_replace_ipda, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_NAT8W_REPLACE_L4_DEST_PORT, ds_l3edit_nat8w_replace_l4_dest_port, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_TUNNEL_V4:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_COPY_DONT_FRAG, ds_l3edit_tunnel_v4_copy_dont_frag, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_DERIVE_DSCP, ds_l3edit_tunnel_v4_derive_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_DONT_FRAG, ds_l3edit_tunnel_v4_dont_frag, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_DSCP, ds_l3edit_tunnel_v4_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_FLAGS, ds_l3edit_tunnel_v4_gre_flags, 4)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_KEY_UDP_DEST_PORT, ds_l3edit_tunnel_v4_gre_key_udp_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_PROTOCOL_UDP_SRC_PORT, ds_l3edit_tunnel_v4_gre_protocol_udp_src_port, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_SEQUENCE_ID108, ds_l3edit_tunnel_v4_gre_sequence_id108, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_GRE_VERSION, ds_l3edit_tunnel_v4_gre_version, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_INNER_HEADER_TYPE, ds_l3edit_tunnel_v4_inner_header_type, 2)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_INNER_HEADER_VALID, ds_l3edit_tunnel_v4_inner_header_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_IP_DA, ds_l3edit_tunnel_v4_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_IP_IDENTIFIC_TYPE, ds_l3edit_tunnel_v4_ip_identific_type, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_IP_PROTOCOL_TYPE, ds_l3edit_tunnel_v4_ip_protocol_type, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_IP_SA, ds_l3edit_tunnel_v4_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_IS_ATP_TUNNEL, ds_l3edit_tunnel_v4_is_atp_tunnel, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_MAP_TTL, ds_l3edit_tunnel_v4_map_ttl, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_MTU_CHECK_EN, ds_l3edit_tunnel_v4_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_T6TO4_TUNNEL, ds_l3edit_tunnel_v4_t6to4_tunnel, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_T6TO4_TUNNEL_SA, ds_l3edit_tunnel_v4_t6to4_tunnel_sa, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_TTL, ds_l3edit_tunnel_v4_ttl, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V4_VPLS_PORT_CHK_EN, ds_l3edit_tunnel_v4_vpls_port_chk_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_TUNNEL_V6:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_DERIVE_DSCP, ds_l3edit_tunnel_v6_derive_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_FLOW_LABEL, ds_l3edit_tunnel_v6_flow_label, 20)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_FLAGS, ds_l3edit_tunnel_v6_gre_flags, 4)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_KEY150, ds_l3edit_tunnel_v6_gre_key150, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_KEY3116, ds_l3edit_tunnel_v6_gre_key3116, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_PROTOCOL, ds_l3edit_tunnel_v6_gre_protocol, 16)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_SEQUENCE_ID108, ds_l3edit_tunnel_v6_gre_sequence_id108, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_GRE_VERSION, ds_l3edit_tunnel_v6_gre_version, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_INNER_HEADER_TYPE, ds_l3edit_tunnel_v6_inner_header_type, 2)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_INNER_HEADER_VALID, ds_l3edit_tunnel_v6_inner_header_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_IPDA_INDEX, ds_l3edit_tunnel_v6_ipda_index, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_IPSA_INDEX, ds_l3edit_tunnel_v6_ipsa_index, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_IP_PROTOCOL_TYPE, ds_l3edit_tunnel_v6_ip_protocol_type, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_MAP_TTL, ds_l3edit_tunnel_v6_map_ttl, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_MTU_CHECK_EN, ds_l3edit_tunnel_v6_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_NEW_FLOW_LABEL_VALID, ds_l3edit_tunnel_v6_new_flow_label_valid, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_TOS, ds_l3edit_tunnel_v6_tos, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_TTL, ds_l3edit_tunnel_v6_ttl, 8)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_VPLS_DEST_PORT11TO0, ds_l3edit_tunnel_v6_vpls_dest_port11to0, 12)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_VPLS_DEST_PORT12, ds_l3edit_tunnel_v6_vpls_dest_port12, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_TUNNEL_V6_VPLS_PORT_CHK_EN, ds_l3edit_tunnel_v6_vpls_port_chk_en, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_FLEX:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_FLEX_PACKET_TYPE, ds_l3edit_flex_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_FLEX_REWRITE_BYTE_NUM, ds_l3edit_flex_rewrite_byte_num, 4)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING0, ds_l3edit_flex_rewrite_string0, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING1, ds_l3edit_flex_rewrite_string1, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING2, ds_l3edit_flex_rewrite_string2, 32)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_FLEX_REWRITE_STRING3, ds_l3edit_flex_rewrite_string3, 24)
+        default:
+            break;
+        }
+        break;
+
+    case DS_L3EDIT_LOOP_BACK:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_L3EDIT_LOOP_BACK_DEST_MAP, ds_l3edit_loop_back_dest_map, 22)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_LOOP_BACK_LENGTH_ADJUST_TYPE, ds_l3edit_loop_back_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_LOOP_BACK_NEXT_HOP_EXT, ds_l3edit_loop_back_next_hop_ext, 1)
+        DRV_FIELD_GET_CASE(DS_L3EDIT_LOOP_BACK_NEXT_HOP_PTR, ds_l3edit_loop_back_next_hop_ptr, 20)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MET_ENTRY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_APS_BRG_EN, ds_met_entry_aps_brg_en, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_APS_BRG_MISMATCH_DISCARD, ds_met_entry_aps_brg_mismatch_discard, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_APS_BRG_PROTECT_PATH, ds_met_entry_aps_brg_protect_path, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_END_LOCAL_REP, ds_met_entry_end_local_rep, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_IS_LINK_AGGREGATION, ds_met_entry_is_link_aggregation, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_LENGTH_ADJUST_TYPE, ds_met_entry_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_NEXTHOP_EXT, ds_met_entry_nexthop_ext, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_NEXT_MET_ENTRY_PTR, ds_met_entry_next_met_entry_ptr, 18)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_PORT_CHECK_DISCARD, ds_met_entry_port_check_discard, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_REMOTE_BAY, ds_met_entry_remote_bay, 1)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_REPLICATION_CTL, ds_met_entry_replication_ctl, 27)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_UCAST_ID_LOWER, ds_met_entry_ucast_id_lower, 12)
+        DRV_FIELD_GET_CASE(DS_MET_ENTRY_UCAST_ID_UPPER, ds_met_entry_ucast_id_upper, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_APS_SELECT_VALID, ds_mpls_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_DS_FWD_PTR, ds_mpls_ds_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_EQUAL_COST_PATH_NUM2, ds_mpls_equal_cost_path_num2, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_EQUAL_COST_PATH_NUM10, ds_mpls_equal_cost_path_num10, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_FLOW_POLICER_PTR7TO0, ds_mpls_flow_policer_ptr7to0, 8)
+        DRV_FIELD_GET_CASE(DS_MPLS_FLOW_POLICER_PTR10TO8, ds_mpls_flow_policer_ptr10to8, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_FLOW_POLICER_PTR11, ds_mpls_flow_policer_ptr11, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_FLOW_POLICER_PTR15TO12, ds_mpls_flow_policer_ptr15to12, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_IS_VC_LABEL, ds_mpls_is_vc_label, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_LLSP_PRIORITY, ds_mpls_llsp_priority, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_LLSP_VALID, ds_mpls_llsp_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_CHECK, ds_mpls_oam_check, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OFFSET_BYTES, ds_mpls_offset_bytes, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OVER_WRITE_PRIORITY, ds_mpls_over_write_priority, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_PACKET_TYPE, ds_mpls_packet_type, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_PRIORITY_PATH_EN, ds_mpls_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_SBIT, ds_mpls_sbit, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_SCONTINUE, ds_mpls_scontinue, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_STATS_PTR_MODE, ds_mpls_stats_ptr_mode, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_S_BIT_CHECK_EN, ds_mpls_s_bit_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_TTL_CHECK_MODE, ds_mpls_ttl_check_mode, 2)
+        DRV_FIELD_GET_CASE(DS_MPLS_TTL_DECREASE_MODE, ds_mpls_ttl_decrease_mode, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_TTL_THRESHHOLD, ds_mpls_ttl_threshhold, 7)
+        DRV_FIELD_GET_CASE(DS_MPLS_USE_LABEL_EXP, ds_mpls_use_label_exp, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_USE_LABEL_TTL, ds_mpls_use_label_ttl, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NEXTHOP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_BY_PASS_ALL, ds_nexthop_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_COPY_CTAG_COS, ds_nexthop_copy_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_CVLAN_TAGGED, ds_nexthop_cvlan_tagged, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_DERIVE_STAG_COS, ds_nexthop_derive_stag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_DEST_VLAN_PTR, ds_nexthop_dest_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_L2EDIT_PTR, ds_nexthop_l2edit_ptr, 12)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_L2_REWRITE_TYPE, ds_nexthop_l2_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_L3EDIT_PTR, ds_nexthop_l3edit_ptr, 18)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_L3_REWRITE_TYPE, ds_nexthop_l3_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_MTU_CHECK_EN, ds_nexthop_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_OUTPUT_CVLAN_ID_VALID, ds_nexthop_output_cvlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_OUTPUT_SVLAN_ID_VALID, ds_nexthop_output_svlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_PAYLOAD_OPERATION, ds_nexthop_payload_operation, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_REPLACE_CTAG_COS, ds_nexthop_replace_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_REPLACE_DSCP, ds_nexthop_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_SERVICE_ACL_QOS_EN, ds_nexthop_service_acl_qos_en, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_SERVICE_POLICER_VLD, ds_nexthop_service_policer_vld, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_STAG_CFI, ds_nexthop_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_STAG_COS, ds_nexthop_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_SVLAN_TAGGED, ds_nexthop_svlan_tagged, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP_TAGGED_MODE, ds_nexthop_tagged_mode, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_NEXTHOP8W:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_BY_PASS_ALL, ds_nexthop8w_by_pass_all, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_COMMUNITY_PORT, ds_nexthop8w_community_port, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_COPY_CTAG_COS, ds_nexthop8w_copy_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_CVLAN_TAGGED, ds_nexthop8w_cvlan_tagged, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_DERIVE_STAG_COS, ds_nexthop8w_derive_stag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_DEST_VLAN_PTR, ds_nexthop8w_dest_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L2EDIT_PTR11TO0, ds_nexthop8w_l2edit_ptr11to0, 12)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L2EDIT_PTR18TO12, ds_nexthop8w_l2edit_ptr18to12, 7)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L2_REWRITE_TYPE, ds_nexthop8w_l2_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L3EDIT_PTR18, ds_nexthop8w_l3edit_ptr18, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L3EDIT_PTR19, ds_nexthop8w_l3edit_ptr19, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L3EDIT_PTR170, ds_nexthop8w_l3edit_ptr170, 18)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_L3_REWRITE_TYPE, ds_nexthop8w_l3_rewrite_type, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_MTU_CHECK_EN, ds_nexthop8w_mtu_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_OUTPUT_CVLAN_ID_EXT, ds_nexthop8w_output_cvlan_id_ext, 12)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_OUTPUT_CVLAN_ID_VALID, ds_nexthop8w_output_cvlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_OUTPUT_CVLAN_ID_VALID_EXT, ds_nexthop8w_output_cvlan_id_valid_ext, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_OUTPUT_SVLAN_ID_EXT, ds_nexthop8w_output_svlan_id_ext, 12)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_OUTPUT_SVLAN_ID_VALID, ds_nexthop8w_output_svlan_id_valid, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_OUTPUT_SVLAN_ID_VALID_EXT, ds_nexthop8w_output_svlan_id_valid_ext, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_PAYLOAD_OPERATION, ds_nexthop8w_payload_operation, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_REPLACE_CTAG_COS, ds_nexthop8w_replace_ctag_cos, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_REPLACE_DSCP, ds_nexthop8w_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SERVICE_ACL_QOS_EN, ds_nexthop8w_service_acl_qos_en, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SERVICE_ID, ds_nexthop8w_service_id, 14)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SERVICE_ID_EN, ds_nexthop8w_service_id_en, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SERVICE_POLICER_VALID, ds_nexthop8w_service_policer_valid, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_STAG_CFI, ds_nexthop8w_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_STAG_COS, ds_nexthop8w_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SVLAN_TAGGED, ds_nexthop8w_svlan_tagged, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SVLAN_TPID, ds_nexthop8w_svlan_tpid, 2)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_SVLAN_TPID_EN, ds_nexthop8w_svlan_tpid_en, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_TAGGED_MODE, ds_nexthop8w_tagged_mode, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_TUNNEL_MTU_CHECK, ds_nexthop8w_tunnel_mtu_check, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_TUNNEL_UPDATE_DISABLE, ds_nexthop8w_tunnel_update_disable, 1)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_VPLS_DEST_PORT, ds_nexthop8w_vpls_dest_port, 13)
+        DRV_FIELD_GET_CASE(DS_NEXTHOP8W_VPLS_PORT_CHECK, ds_nexthop8w_vpls_port_check, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_POLICER:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_POLICER_COLOR_BLIND_MODE, ds_policer_color_blind_mode, 1)
+        DRV_FIELD_GET_CASE(DS_POLICER_COLOR_DROP_CODE, ds_policer_color_drop_code, 2)
+        DRV_FIELD_GET_CASE(DS_POLICER_COMMIT_COUNT_LOWER, ds_policer_commit_count_lower, 12)
+        DRV_FIELD_GET_CASE(DS_POLICER_COMMIT_COUNT_UPPER, ds_policer_commit_count_upper, 10)
+        DRV_FIELD_GET_CASE(DS_POLICER_OLD_TS, ds_policer_old_ts, 12)
+        DRV_FIELD_GET_CASE(DS_POLICER_PEAK_COUNT, ds_policer_peak_count, 22)
+        DRV_FIELD_GET_CASE(DS_POLICER_PROFILE, ds_policer_profile, 8)
+        DRV_FIELD_GET_CASE(DS_POLICER_SR_TCM_MODE, ds_policer_sr_tcm_mode, 1)
+        DRV_FIELD_GET_CASE(DS_POLICER_STATS_EN, ds_policer_stats_en, 1)
+        DRV_FIELD_GET_CASE(DS_POLICER_USE_LAYER3_LENGTH, ds_policer_use_layer3_length, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FORWARDING_STATS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_FORWARDING_STATS_BYTE_COUNT_LOWER, ds_forwarding_stats_byte_count_lower, 32)
+        DRV_FIELD_GET_CASE(DS_FORWARDING_STATS_BYTE_COUNT_UPPER0, ds_forwarding_stats_byte_count_upper0, 2)
+        DRV_FIELD_GET_CASE(DS_FORWARDING_STATS_BYTE_COUNT_UPPER, ds_forwarding_stats_byte_count_upper, 3)
+        DRV_FIELD_GET_CASE(DS_FORWARDING_STATS_PACKET_COUNT, ds_forwarding_stats_packet_count, 32)
+        DRV_FIELD_GET_CASE(DS_FORWARDING_STATS_USE_LAYER3_LENGTH, ds_forwarding_stats_use_layer3_length, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VLAN:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_VLAN_ARP_EXCEPTION_TYPE, ds_vlan_arp_exception_type, 2)
+        DRV_FIELD_GET_CASE(DS_VLAN_BRG_DIS, ds_vlan_brg_dis, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_DHCP_EXCEPTION_TYPE, ds_vlan_dhcp_exception_type, 2)
+        DRV_FIELD_GET_CASE(DS_VLAN_ETHER_OAMV, ds_vlan_ether_oamv, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_E_ETHER_OAMV, ds_vlan_e_ether_oamv, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_E_MD_LEVEL, ds_vlan_e_md_level, 3)
+        DRV_FIELD_GET_CASE(DS_VLAN_IF_ID, ds_vlan_if_id, 10)
+        DRV_FIELD_GET_CASE(DS_VLAN_IGMP_SNOOP_EN, ds_vlan_igmp_snoop_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_LEARN_DIS, ds_vlan_learn_dis, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_MAC_SEC_VLAN_DIS, ds_vlan_mac_sec_vlan_dis, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_MD_LEVEL, ds_vlan_md_level, 3)
+        DRV_FIELD_GET_CASE(DS_VLAN_PFM, ds_vlan_pfm, 2)
+        DRV_FIELD_GET_CASE(DS_VLAN_REC_EN, ds_vlan_rec_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_REPLACE_DSCP, ds_vlan_replace_dscp, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_ROUTE_DISABLE, ds_vlan_route_disable, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_SRC_QUE_SELECT, ds_vlan_src_que_select, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_STP_ID6, ds_vlan_stp_id6, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_STP_ID, ds_vlan_stp_id, 6)
+        DRV_FIELD_GET_CASE(DS_VLAN_TRANS_EN, ds_vlan_trans_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_V4_MCAST_EN, ds_vlan_v4_mcast_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_V4_UCAST_EN, ds_vlan_v4_ucast_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_V4_UCAST_SA_TYPE, ds_vlan_v4_ucast_sa_type, 2)
+        DRV_FIELD_GET_CASE(DS_VLAN_V6_MCAST_EN, ds_vlan_v6_mcast_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_V6_UCAST_EN, ds_vlan_v6_ucast_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_V6_UCAST_SA_TYPE, ds_vlan_v6_ucast_sa_type, 2)
+        DRV_FIELD_GET_CASE(DS_VLAN_VLAN_CROSS_CONNECT, ds_vlan_vlan_cross_connect, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_VLAN_SEC_EXP_EN, ds_vlan_vlan_sec_exp_en, 1)
+        DRV_FIELD_GET_CASE(DS_VLAN_VRF_ID, ds_vlan_vrf_id, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_VLAN_STATUS:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_VLAN_STATUS_VLANID_VALIDH, ds_vlan_status_vlanid_validh, 32)
+        DRV_FIELD_GET_CASE(DS_VLAN_STATUS_VLANID_VALIDL, ds_vlan_status_vlanid_validl, 32)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MAC_APS_SELECT_PROTECT_PATH, ds_mac_aps_select_protect_path, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_APS_SELECT_VALID, ds_mac_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_BRG_APS_SELECT_VALID, ds_mac_brg_aps_select_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_EQUAL_COST_PATH_NUM10, ds_mac_equal_cost_path_num10, 2)
+        DRV_FIELD_GET_CASE(DS_MAC_ESP_KEY_OR_OAM, ds_mac_esp_key_or_oam, 13)
+        DRV_FIELD_GET_CASE(DS_MAC_EXCEPTION_SUB_INDEX, ds_mac_exception_sub_index, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_FWD_PTR, ds_mac_fwd_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_MAC_GLOBAL_SRC_PORT, ds_mac_global_src_port, 13)
+        DRV_FIELD_GET_CASE(DS_MAC_LEARN_EN, ds_mac_learn_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_LEARN_SOURCE0, ds_mac_learn_source0, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_LEARN_SOURCE1, ds_mac_learn_source1, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_MAC_DA_EXCEPTION_EN, ds_mac_mac_da_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_MAC_KNOWN, ds_mac_mac_known, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_MAC_SA_EXCEPTION_EN, ds_mac_mac_sa_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_MCAST_DISCARD, ds_mac_mcast_discard, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_PRIORITY_PATH_EN, ds_mac_priority_path_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_PROTO_EXCEPTION_EN, ds_mac_proto_exception_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_SOURCE_PORT_CHECK_EN, ds_mac_source_port_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_SRC_DISCARD, ds_mac_src_discard, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_SRC_MISMATCH_DISCARD, ds_mac_src_mismatch_discard, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_SRC_MISMATCH_LEARN_EN, ds_mac_src_mismatch_learn_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_STORM_CTL_EN, ds_mac_storm_ctl_en, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_UCAST_DISCARD, ds_mac_ucast_discard, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_FWD:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_FWD_APS_SELECT_GROUP_VALID, ds_fwd_aps_select_group_valid, 1)
+        DRV_FIELD_GET_CASE(DS_FWD_APS_TYPE, ds_fwd_aps_type, 2)
+        DRV_FIELD_GET_CASE(DS_FWD_CRITICAL_PACKET, ds_fwd_critical_packet, 1)
+        DRV_FIELD_GET_CASE(DS_FWD_DEST_MAP, ds_fwd_dest_map, 22)
+        DRV_FIELD_GET_CASE(DS_FWD_LENGTH_ADJUST_TYPE, ds_fwd_length_adjust_type, 1)
+        DRV_FIELD_GET_CASE(DS_FWD_NEXT_HOP_EXT, ds_fwd_next_hop_ext, 1)
+        DRV_FIELD_GET_CASE(DS_FWD_NEXT_HOP_PTR, ds_fwd_next_hop_ptr, 20)
+        DRV_FIELD_GET_CASE(DS_FWD_SEND_LOCAL_PHY_PORT, ds_fwd_send_local_phy_port, 1)
+        DRV_FIELD_GET_CASE(DS_FWD_SEQUENCE_NUMBER_CHK_EN, ds_fwd_sequence_number_chk_en, 1)
+        DRV_FIELD_GET_CASE(DS_FWD_STATS_PTR_LOWER, ds_fwd_stats_ptr_lower, 12)
+        DRV_FIELD_GET_CASE(DS_FWD_STATS_PTR_UPPER, ds_fwd_stats_ptr_upper, 4)
+        DRV_FIELD_GET_CASE(DS_FWD_STATS_VALID, ds_fwd_stats_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_CHAN:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_ACTIVE_MAX_MDLVL, ds_eth_oam_chan_active_max_mdlvl, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEM_INDEX0, ds_eth_oam_chan_mem_index0, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEM_INDEX1, ds_eth_oam_chan_mem_index1, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEM_ON_REMOTE_CHIP, ds_eth_oam_chan_mem_on_remote_chip, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX2, ds_eth_oam_chan_mep_index2, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX3, ds_eth_oam_chan_mep_index3, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX4, ds_eth_oam_chan_mep_index4, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX5, ds_eth_oam_chan_mep_index5, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX6, ds_eth_oam_chan_mep_index6, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_MEP_INDEX7, ds_eth_oam_chan_mep_index7, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_OAM_DEST_CHIP_ID1_TO0, ds_eth_oam_chan_oam_dest_chip_id1_to0, 2)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_OAM_DEST_CHIP_ID4_TO2, ds_eth_oam_chan_oam_dest_chip_id4_to2, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_PASSIVE_MAX_MD_LVL, ds_eth_oam_chan_passive_max_md_lvl, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_CHAN_PASSIVE_VALID, ds_eth_oam_chan_passive_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_PBT_OAM_CHAN:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_PBT_OAM_CHAN_MD_LVL, ds_mpls_pbt_oam_chan_md_lvl, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_PBT_OAM_CHAN_MD_LVL_CHECK_VALID, ds_mpls_pbt_oam_chan_md_lvl_check_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_PBT_OAM_CHAN_MEP_IDEX, ds_mpls_pbt_oam_chan_mep_idex, 15)
+        DRV_FIELD_GET_CASE(DS_MPLS_PBT_OAM_CHAN_MEP_ON_REMOTE_CHIP, ds_mpls_pbt_oam_chan_mep_on_remote_chip, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_PBT_OAM_CHAN_RMEP_ID, ds_mpls_pbt_oam_chan_rmep_id, 13)
+        DRV_FIELD_GET_CASE(DS_MPLS_PBT_OAM_CHAN_RMEP_ID_CHECK_VALID, ds_mpls_pbt_oam_chan_rmep_id_check_valid, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_RMEP_CHAN:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_RMEP_CHAN_RMEP_INDEX0, ds_rmep_chan_rmep_index0, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_MEP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_ACTIVE, ds_eth_mep_active, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_CCI_EN, ds_eth_mep_cci_en, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_CCI_WHILE, ds_eth_mep_cci_while, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_CCM_SEP_NUM, ds_eth_mep_ccm_sep_num, 32)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_DEST_CHIP, ds_eth_mep_dest_chip, 5)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_DEST_ID, ds_eth_mep_dest_id, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_D_MEG_LVL, ds_eth_mep_d_meg_lvl, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_D_MEG_LVL_TIMER, ds_eth_mep_d_meg_lvl_timer, 4)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_D_MISMERGE, ds_eth_mep_d_mismerge, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_D_MISMERGE_TIMER, ds_eth_mep_d_mismerge_timer, 4)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_D_UNEXP_MEP, ds_eth_mep_d_unexp_mep, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_D_UNEXP_MEP_TIMER, ds_eth_mep_d_unexp_mep_timer, 4)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_ENABLE_PM, ds_eth_mep_enable_pm, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_IS_MPLS, ds_eth_mep_is_mpls, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_IS_REMOTE, ds_eth_mep_is_remote, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_IS_UP, ds_eth_mep_is_up, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_MA_ID_CHECK_DISABLE, ds_eth_mep_ma_id_check_disable, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_MA_INDEX, ds_eth_mep_ma_index, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_MEP_ID, ds_eth_mep_mep_id, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_MEP_PRIMARY_VID, ds_eth_mep_mep_primary_vid, 12)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_MEP_TYPE, ds_eth_mep_mep_type, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_PORT_ID, ds_eth_mep_port_id, 8)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_PRESENT_RDI, ds_eth_mep_present_rdi, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_PRESENT_TRAFFIC, ds_eth_mep_present_traffic, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_PRESENT_TRAFFIC_CHECK_EN, ds_eth_mep_present_traffic_check_en, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_RMEP_LAST_RDI, ds_eth_mep_rmep_last_rdi, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_SEQ_NUM_EN, ds_eth_mep_seq_num_en, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_SHARE_MAC_EN, ds_eth_mep_share_mac_en, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_TPID_TYPE, ds_eth_mep_tpid_type, 2)
+        DRV_FIELD_GET_CASE(DS_ETH_MEP_TX_WITH_SEND_ID, ds_eth_mep_tx_with_send_id, 1)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_RMEP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_ACTIVE, ds_eth_rmep_active, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_CCM_SEP_NUM, ds_eth_rmep_ccm_sep_num, 32)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_CNT_SHIFT_WHILE, ds_eth_rmep_cnt_shift_while, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_D_LOC, ds_eth_rmep_d_loc, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_D_UNEXP_PERIOD, ds_eth_rmep_d_unexp_period, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_D_UNEXP_PERIOD_TIMER, ds_eth_rmep_d_unexp_period_timer, 4)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_EXP_CCM_NUM, ds_eth_rmep_exp_ccm_num, 8)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_FIRST_PKT_RX, ds_eth_rmep_first_pkt_rx, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_IS_MPLS, ds_eth_rmep_is_mpls, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_IS_REMOTE, ds_eth_rmep_is_remote, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_MAC_ADDR_UPDATE_DISABLE, ds_eth_rmep_mac_addr_update_disable, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_MEP_INDEX, ds_eth_rmep_mep_index, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_RMEP_LAST_INTF_STATUS, ds_eth_rmep_rmep_last_intf_status, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_RMEP_LAST_PORT_STATUS, ds_eth_rmep_rmep_last_port_status, 2)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_RMEP_LAST_RDI, ds_eth_rmep_rmep_last_rdi, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_RMEP_MAC_SA31_TO0, ds_eth_rmep_rmep_mac_sa31_to0, 32)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_RMEP_MAC_SA47_TO32, ds_eth_rmep_rmep_mac_sa47_to32, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_RMEP_WHILE, ds_eth_rmep_rmep_while, 4)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_SEQ_NUM_EN, ds_eth_rmep_seq_num_en, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_RMEP_SEQ_NUM_FAIL_COUNTER, ds_eth_rmep_seq_num_fail_counter, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_MEP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_ACTIVE, ds_mpls_mep_active, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_CCI_EN, ds_mpls_mep_cci_en, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_CCI_WHILE, ds_mpls_mep_cci_while, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_DEST_CHIP, ds_mpls_mep_dest_chip, 5)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_DEST_ID, ds_mpls_mep_dest_id, 16)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_D_EXCESS, ds_mpls_mep_d_excess, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_D_LOCV, ds_mpls_mep_d_locv, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_D_TTSI_MISMATCH, ds_mpls_mep_d_ttsi_mismatch, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_D_TTSI_MISMERGE, ds_mpls_mep_d_ttsi_mismerge, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_EXPECTEDCVH, ds_mpls_mep_expectedcvh, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_EXPECTED_CV, ds_mpls_mep_expected_cv, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_FIRST_PKT_RX, ds_mpls_mep_first_pkt_rx, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_IS_AVAILABLE, ds_mpls_mep_is_available, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_IS_MPLS, ds_mpls_mep_is_mpls, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_IS_REMOTE, ds_mpls_mep_is_remote, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_IS_UP, ds_mpls_mep_is_up, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_MA_INDEX, ds_mpls_mep_ma_index, 15)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_MEP_TYPE, ds_mpls_mep_mep_type, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_NEAR_END_FSM_UP_DISABLE, ds_mpls_mep_near_end_fsm_up_disable, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_PERIOD, ds_mpls_mep_period, 8)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_RECV_FDI, ds_mpls_mep_recv_fdi, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_T1_VALID, ds_mpls_mep_t1_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_T1_WHILE, ds_mpls_mep_t1_while, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_T2_PENDING_VALID, ds_mpls_mep_t2_pending_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_TEN_CYCLE_EXPECTEDCV, ds_mpls_mep_ten_cycle_expectedcv, 7)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_TEN_UNEXPCV, ds_mpls_mep_ten_unexpcv, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_MEP_TRI_CYCLE_UNEXPCV, ds_mpls_mep_tri_cycle_unexpcv, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_RMEP:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_ACTIVE, ds_mpls_rmep_active, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_BDI_TX, ds_mpls_rmep_bdi_tx, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_BDI_WHILE, ds_mpls_rmep_bdi_while, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_CCI_WHILE, ds_mpls_rmep_cci_while, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_DEFECT_LOCATION, ds_mpls_rmep_defect_location, 16)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_DEFECT_TYPE, ds_mpls_rmep_defect_type, 6)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_DEST_CHIP, ds_mpls_rmep_dest_chip, 5)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_DEST_ID, ds_mpls_rmep_dest_id, 16)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_FAR_END_FSM_UP_DISABLE, ds_mpls_rmep_far_end_fsm_up_disable, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_IS_AVAILABLE, ds_mpls_rmep_is_available, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_IS_MPLS, ds_mpls_rmep_is_mpls, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_IS_REMOTE, ds_mpls_rmep_is_remote, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_MA_INDEX, ds_mpls_rmep_ma_index, 15)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_PERIOD, ds_mpls_rmep_period, 8)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_RMEP_WHILE, ds_mpls_rmep_rmep_while, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_RX_BDI, ds_mpls_rmep_rx_bdi, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_T3_CYCLE, ds_mpls_rmep_t3_cycle, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_T3_VALID, ds_mpls_rmep_t3_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_T3_WHILE, ds_mpls_rmep_t3_while, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_T4_VALID, ds_mpls_rmep_t4_valid, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_TEN_BDILOOP, ds_mpls_rmep_ten_bdiloop, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_TEN_BDI, ds_mpls_rmep_ten_bdi, 4)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_TRI_BDI_LOOP, ds_mpls_rmep_tri_bdi_loop, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_RMEP_TRI_CYCLE_BDI, ds_mpls_rmep_tri_cycle_bdi, 2)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_CFI, ds_mac_key_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_COS, ds_mac_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_GBL_SRC_PORT, ds_mac_key_gbl_src_port, 13)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_LAYER2_HEADER_PROTOCOL, ds_mac_key_layer2_header_protocol, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_LAYER2_TYPE, ds_mac_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_LAYER3_TYPE, ds_mac_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_MAPPED_MAC_DA_LOWER, ds_mac_key_mapped_mac_da_lower, 32)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_MAPPED_MAC_DA_UPPER, ds_mac_key_mapped_mac_da_upper, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_MAPPED_VLAN_ID, ds_mac_key_mapped_vlan_id, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_TABLE_ID0, ds_mac_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_TABLE_ID1, ds_mac_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_VLAN_ID1, ds_mac_key_vlan_id1, 12)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_VLAN_ID2, ds_mac_key_vlan_id2, 12)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_VLAN_PTRH, ds_mac_key_vlan_ptrh, 10)
+        DRV_FIELD_GET_CASE(DS_MAC_KEY_VLAN_PTRL, ds_mac_key_vlan_ptrl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MAC_HASH_KEY0_MAPPED_MACH, ds_mac_hash_key0_mapped_mach, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_HASH_KEY0_MAPPED_MACL, ds_mac_hash_key0_mapped_macl, 32)
+        DRV_FIELD_GET_CASE(DS_MAC_HASH_KEY0_MAPPED_VLANID, ds_mac_hash_key0_mapped_vlanid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MAC_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MAC_HASH_KEY1_MAPPED_MACH, ds_mac_hash_key1_mapped_mach, 16)
+        DRV_FIELD_GET_CASE(DS_MAC_HASH_KEY1_MAPPED_MACL, ds_mac_hash_key1_mapped_macl, 32)
+        DRV_FIELD_GET_CASE(DS_MAC_HASH_KEY1_MAPPED_VLANID, ds_mac_hash_key1_mapped_vlanid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_ACL_LABELH, ds_acl_mac_key_acl_labelh, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_ACL_LABELL, ds_acl_mac_key_acl_labell, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_COS, ds_acl_mac_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_CTAG_CFI, ds_acl_mac_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_CTAG_COS, ds_acl_mac_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_CVLAN_ID4TO0, ds_acl_mac_key_cvlan_id4to0, 5)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_CVLAN_ID11TO5, ds_acl_mac_key_cvlan_id11to5, 7)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_ETHER_TYPE, ds_acl_mac_key_ether_type, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_IS_IP_KEY, ds_acl_mac_key_is_ip_key, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_IS_LABEL, ds_acl_mac_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_L2_QOS_LABEL, ds_acl_mac_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_L3_QOS_LABEL, ds_acl_mac_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_LAYER2_TYPE, ds_acl_mac_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_LAYER3_TYPE, ds_acl_mac_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_MAC_DAH, ds_acl_mac_key_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_MAC_DAL, ds_acl_mac_key_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_MAC_SAH, ds_acl_mac_key_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_MAC_SAL, ds_acl_mac_key_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_QOS_LABEL, ds_acl_mac_key_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_STAG_CFI, ds_acl_mac_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_STAG_COS, ds_acl_mac_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_SVLAN_ID, ds_acl_mac_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_TABLEID0, ds_acl_mac_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_TABLEID1, ds_acl_mac_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_TABLEID2, ds_acl_mac_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_TABLEID3, ds_acl_mac_key_tableid3, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MAC_KEY_VLAN_PTR, ds_acl_mac_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_ACL_LABELH, ds_qos_mac_key_acl_labelh, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_ACL_LABELL, ds_qos_mac_key_acl_labell, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_COS, ds_qos_mac_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_CTAG_CFI, ds_qos_mac_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_CTAG_COS, ds_qos_mac_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_CVLAN_ID4TO0, ds_qos_mac_key_cvlan_id4to0, 5)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_CVLAN_ID11TO5, ds_qos_mac_key_cvlan_id11to5, 7)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_ETHER_TYPE, ds_qos_mac_key_ether_type, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_IS_IP_KEY, ds_qos_mac_key_is_ip_key, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_IS_LABEL, ds_qos_mac_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_L2_QOS_LABEL, ds_qos_mac_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_L3_QOS_LABEL, ds_qos_mac_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_LAYER2_TYPE, ds_qos_mac_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_LAYER3_TYPE, ds_qos_mac_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_MAC_DAH, ds_qos_mac_key_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_MAC_DAL, ds_qos_mac_key_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_MAC_SAH, ds_qos_mac_key_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_MAC_SAL, ds_qos_mac_key_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_QOS_LABEL, ds_qos_mac_key_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_STAG_CFI, ds_qos_mac_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_STAG_COS, ds_qos_mac_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_SVLAN_ID, ds_qos_mac_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_TABLEID0, ds_qos_mac_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_TABLEID1, ds_qos_mac_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_TABLEID2, ds_qos_mac_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_TABLEID3, ds_qos_mac_key_tableid3, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MAC_KEY_VLAN_PTR, ds_qos_mac_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_IPV4_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_ACL_LABEL_LOWER, ds_acl_ipv4_key_acl_label_lower, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_ACL_LABEL_UPPER, ds_acl_ipv4_key_acl_label_upper, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_COS, ds_acl_ipv4_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_CTAG_CFI, ds_acl_ipv4_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_CTAG_COS, ds_acl_ipv4_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_CVLAN_ID, ds_acl_ipv4_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_DSCP, ds_acl_ipv4_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_FRAG_INFO, ds_acl_ipv4_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IP_DA, ds_acl_ipv4_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IP_HEADER_ERROR, ds_acl_ipv4_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IP_OPTIONS, ds_acl_ipv4_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IP_SA, ds_acl_ipv4_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IS_APPLICATION, ds_acl_ipv4_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IS_IP_KEY, ds_acl_ipv4_key_is_ip_key, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IS_LABEL, ds_acl_ipv4_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IS_MPLS_KEY, ds_acl_ipv4_key_is_mpls_key, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IS_TCP, ds_acl_ipv4_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_IS_UDP, ds_acl_ipv4_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_L2_QOS_LABEL, ds_acl_ipv4_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_L3_QOS_LABEL, ds_acl_ipv4_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_L4INFO_MAPPED, ds_acl_ipv4_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_L4_DEST_PORT, ds_acl_ipv4_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_L4_SOURCE_PORT, ds_acl_ipv4_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_LAYER2_TYPE, ds_acl_ipv4_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_LAYER3_TYPE, ds_acl_ipv4_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_MACDA_LOWER, ds_acl_ipv4_key_macda_lower, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_MACDA_UPPER, ds_acl_ipv4_key_macda_upper, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_MAC_SA_LOWER, ds_acl_ipv4_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_MAC_SA_UPPER, ds_acl_ipv4_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_QOS_LABEL, ds_acl_ipv4_key_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_ROUTED_PACKET, ds_acl_ipv4_key_routed_packet, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_STAG_CFI, ds_acl_ipv4_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_STAG_COS, ds_acl_ipv4_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_SVLAN_ID, ds_acl_ipv4_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_TABLEID0, ds_acl_ipv4_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_TABLEID1, ds_acl_ipv4_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_TABLEID2, ds_acl_ipv4_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV4_KEY_TABLEID3, ds_acl_ipv4_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_IPV4_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_ACL_LABEL_LOWER, ds_qos_ipv4_key_acl_label_lower, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_ACL_LABEL_UPPER, ds_qos_ipv4_key_acl_label_upper, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_COS, ds_qos_ipv4_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_CTAG_CFI, ds_qos_ipv4_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_CTAG_COS, ds_qos_ipv4_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_CVLAN_ID, ds_qos_ipv4_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_DSCP, ds_qos_ipv4_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_FRAG_INFO, ds_qos_ipv4_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IP_DA, ds_qos_ipv4_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IP_HEADER_ERROR, ds_qos_ipv4_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IP_OPTIONS, ds_qos_ipv4_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IP_SA, ds_qos_ipv4_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IS_APPLICATION, ds_qos_ipv4_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IS_IP_KEY, ds_qos_ipv4_key_is_ip_key, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IS_LABEL, ds_qos_ipv4_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IS_MPLS_KEY, ds_qos_ipv4_key_is_mpls_key, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IS_TCP, ds_qos_ipv4_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_IS_UDP, ds_qos_ipv4_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_L2_QOS_LABEL, ds_qos_ipv4_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_L3_QOS_LABEL, ds_qos_ipv4_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_L4INFO_MAPPED, ds_qos_ipv4_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_L4_DEST_PORT, ds_qos_ipv4_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_L4_SOURCE_PORT, ds_qos_ipv4_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_LAYER2_TYPE, ds_qos_ipv4_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_LAYER3_TYPE, ds_qos_ipv4_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_MACDA_LOWER, ds_qos_ipv4_key_macda_lower, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_MACDA_UPPER, ds_qos_ipv4_key_macda_upper, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_MAC_SA_LOWER, ds_qos_ipv4_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_MAC_SA_UPPER, ds_qos_ipv4_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_QOS_LABEL, ds_qos_ipv4_key_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_ROUTED_PACKET, ds_qos_ipv4_key_routed_packet, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_STAG_CFI, ds_qos_ipv4_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_STAG_COS, ds_qos_ipv4_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_SVLAN_ID, ds_qos_ipv4_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_TABLEID0, ds_qos_ipv4_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_TABLEID1, ds_qos_ipv4_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_TABLEID2, ds_qos_ipv4_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV4_KEY_TABLEID3, ds_qos_ipv4_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_MPLS_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_ACL_LABEL_LOWER, ds_acl_mpls_key_acl_label_lower, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_ACL_LABEL_UPPER, ds_acl_mpls_key_acl_label_upper, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_COS, ds_acl_mpls_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_CTAG_CFI, ds_acl_mpls_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_CTAG_COS, ds_acl_mpls_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_CVLAN_ID, ds_acl_mpls_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_IS_IP_KEY, ds_acl_mpls_key_is_ip_key, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_IS_LABEL, ds_acl_mpls_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_IS_MPLS_KEY, ds_acl_mpls_key_is_mpls_key, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_L2_QOS_LABEL, ds_acl_mpls_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_L3_QOS_LABEL, ds_acl_mpls_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_LAYER2_TYPE, ds_acl_mpls_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MACDA_LOWER, ds_acl_mpls_key_macda_lower, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MACDA_UPPER, ds_acl_mpls_key_macda_upper, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MAC_SA_LOWER, ds_acl_mpls_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MAC_SA_UPPER, ds_acl_mpls_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL0, ds_acl_mpls_key_mpls_label0, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL1, ds_acl_mpls_key_mpls_label1, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL2, ds_acl_mpls_key_mpls_label2, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL327TO0, ds_acl_mpls_key_mpls_label327to0, 28)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_MPLS_LABEL331TO28, ds_acl_mpls_key_mpls_label331to28, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_QOS_LABEL, ds_acl_mpls_key_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_ROUTE_PKT, ds_acl_mpls_key_route_pkt, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_STAG_CFI, ds_acl_mpls_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_STAG_COS, ds_acl_mpls_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_SVLAN_ID, ds_acl_mpls_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_TABLEID0, ds_acl_mpls_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_TABLEID1, ds_acl_mpls_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_TABLEID2, ds_acl_mpls_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_MPLS_KEY_TABLEID3, ds_acl_mpls_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_MPLS_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_ACL_LABEL_LOWER, ds_qos_mpls_key_acl_label_lower, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_ACL_LABEL_UPPER, ds_qos_mpls_key_acl_label_upper, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_COS, ds_qos_mpls_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_CTAG_CFI, ds_qos_mpls_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_CTAG_COS, ds_qos_mpls_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_CVLAN_ID, ds_qos_mpls_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_IS_IP_KEY, ds_qos_mpls_key_is_ip_key, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_IS_LABEL, ds_qos_mpls_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_IS_MPLS_KEY, ds_qos_mpls_key_is_mpls_key, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_L2_QOS_LABEL, ds_qos_mpls_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_L3_QOS_LABEL, ds_qos_mpls_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_LAYER2_TYPE, ds_qos_mpls_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MACDA_LOWER, ds_qos_mpls_key_macda_lower, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MACDA_UPPER, ds_qos_mpls_key_macda_upper, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MAC_SA_LOWER, ds_qos_mpls_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MAC_SA_UPPER, ds_qos_mpls_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL0, ds_qos_mpls_key_mpls_label0, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL1, ds_qos_mpls_key_mpls_label1, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL2, ds_qos_mpls_key_mpls_label2, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL327TO0, ds_qos_mpls_key_mpls_label327to0, 28)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_MPLS_LABEL331TO28, ds_qos_mpls_key_mpls_label331to28, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_QOS_LABEL, ds_qos_mpls_key_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_ROUTE_PKT, ds_qos_mpls_key_route_pkt, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_STAG_CFI, ds_qos_mpls_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_STAG_COS, ds_qos_mpls_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_SVLAN_ID, ds_qos_mpls_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_TABLEID0, ds_qos_mpls_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_TABLEID1, ds_qos_mpls_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_TABLEID2, ds_qos_mpls_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_MPLS_KEY_TABLEID3, ds_qos_mpls_key_tableid3, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ACL_IPV6_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_ACLQOS_IPV6KEY_TABLEID7, ds_acl_ipv6_key_aclqos_ipv6key_tableid7, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_ACL_LABEL_LOWER, ds_acl_ipv6_key_acl_label_lower, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_ACL_LABEL_MIDDLE, ds_acl_ipv6_key_acl_label_middle, 2)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_ACL_LABEL_UPPER, ds_acl_ipv6_key_acl_label_upper, 2)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_COS, ds_acl_ipv6_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_CTAG_CFI, ds_acl_ipv6_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_CTAG_COS, ds_acl_ipv6_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_CVLAN_ID, ds_acl_ipv6_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_DSCP, ds_acl_ipv6_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_ETHER_TYPE, ds_acl_ipv6_key_ether_type, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_FRAG_INFO, ds_acl_ipv6_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IPV6_EXTENSION_HEADERS, ds_acl_ipv6_key_ipv6_extension_headers, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IPV6_FLOW_LABEL, ds_acl_ipv6_key_ipv6_flow_label, 20)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_DA31TO0, ds_acl_ipv6_key_ip_da31to0, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_DA63TO32, ds_acl_ipv6_key_ip_da63to32, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_DA71TO64, ds_acl_ipv6_key_ip_da71to64, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_DA103TO72, ds_acl_ipv6_key_ip_da103to72, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_DA127TO104, ds_acl_ipv6_key_ip_da127to104, 24)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_HEAD_ERROR, ds_acl_ipv6_key_ip_head_error, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_OPTIONS, ds_acl_ipv6_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_SA31TO0, ds_acl_ipv6_key_ip_sa31to0, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_SA63TO32, ds_acl_ipv6_key_ip_sa63to32, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_SA71TO64, ds_acl_ipv6_key_ip_sa71to64, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_SA103TO72, ds_acl_ipv6_key_ip_sa103to72, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IP_SA127TO104, ds_acl_ipv6_key_ip_sa127to104, 24)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IS_APPLICATION, ds_acl_ipv6_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IS_LABEL, ds_acl_ipv6_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IS_TCP, ds_acl_ipv6_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_IS_UDP, ds_acl_ipv6_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L2_QOS_LABEL, ds_acl_ipv6_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L3_QOS_LABEL, ds_acl_ipv6_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4DESTPORT_OR_L4INFO5TO0, ds_acl_ipv6_key_l4destport_or_l4info5to0, 6)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4DESTPORT_OR_L4INFO15TO6, ds_acl_ipv6_key_l4destport_or_l4info15to6, 10)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4INFO_MAPPED, ds_acl_ipv6_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4_DESTPORT, ds_acl_ipv6_key_l4_destport, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4_SOURCE_PORT3TO0, ds_acl_ipv6_key_l4_source_port3to0, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4_SOURCE_PORT11TO4, ds_acl_ipv6_key_l4_source_port11to4, 8)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_L4_SOURCE_PORT15TO12, ds_acl_ipv6_key_l4_source_port15to12, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_LAYER2_TYPE, ds_acl_ipv6_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_LAYER3_TYPE, ds_acl_ipv6_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_MAC_DA_LOWER, ds_acl_ipv6_key_mac_da_lower, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_MAC_DA_UPPER, ds_acl_ipv6_key_mac_da_upper, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_MAC_SA_LOWER, ds_acl_ipv6_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_MAC_SA_UPPER, ds_acl_ipv6_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_QOS_LABEL_LOWER, ds_acl_ipv6_key_qos_label_lower, 6)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_QOS_LABEL_UPPER, ds_acl_ipv6_key_qos_label_upper, 2)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_ROUTED_PACKET, ds_acl_ipv6_key_routed_packet, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_STAG_CFI, ds_acl_ipv6_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_STAG_COS, ds_acl_ipv6_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_SVLAN_ID, ds_acl_ipv6_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID0, ds_acl_ipv6_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID1, ds_acl_ipv6_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID2, ds_acl_ipv6_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID3, ds_acl_ipv6_key_tableid3, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID4, ds_acl_ipv6_key_tableid4, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID5, ds_acl_ipv6_key_tableid5, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_TABLEID6, ds_acl_ipv6_key_tableid6, 4)
+        DRV_FIELD_GET_CASE(DS_ACL_IPV6_KEY_VLAN_PTR, ds_acl_ipv6_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_QOS_IPV6_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_ACLQOS_IPV6KEY_TABLEID7, ds_qos_ipv6_key_aclqos_ipv6key_tableid7, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_ACL_LABEL_LOWER, ds_qos_ipv6_key_acl_label_lower, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_ACL_LABEL_MIDDLE, ds_qos_ipv6_key_acl_label_middle, 2)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_ACL_LABEL_UPPER, ds_qos_ipv6_key_acl_label_upper, 2)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_COS, ds_qos_ipv6_key_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_CTAG_CFI, ds_qos_ipv6_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_CTAG_COS, ds_qos_ipv6_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_CVLAN_ID, ds_qos_ipv6_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_DSCP, ds_qos_ipv6_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_ETHER_TYPE, ds_qos_ipv6_key_ether_type, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_FRAG_INFO, ds_qos_ipv6_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IPV6_EXTENSION_HEADERS, ds_qos_ipv6_key_ipv6_extension_headers, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IPV6_FLOW_LABEL, ds_qos_ipv6_key_ipv6_flow_label, 20)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_DA31TO0, ds_qos_ipv6_key_ip_da31to0, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_DA63TO32, ds_qos_ipv6_key_ip_da63to32, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_DA71TO64, ds_qos_ipv6_key_ip_da71to64, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_DA103TO72, ds_qos_ipv6_key_ip_da103to72, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_DA127TO104, ds_qos_ipv6_key_ip_da127to104, 24)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_HEAD_ERROR, ds_qos_ipv6_key_ip_head_error, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_OPTIONS, ds_qos_ipv6_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_SA31TO0, ds_qos_ipv6_key_ip_sa31to0, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_SA63TO32, ds_qos_ipv6_key_ip_sa63to32, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_SA71TO64, ds_qos_ipv6_key_ip_sa71to64, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_SA103TO72, ds_qos_ipv6_key_ip_sa103to72, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IP_SA127TO104, ds_qos_ipv6_key_ip_sa127to104, 24)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IS_APPLICATION, ds_qos_ipv6_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IS_LABEL, ds_qos_ipv6_key_is_label, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IS_TCP, ds_qos_ipv6_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_IS_UDP, ds_qos_ipv6_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L2_QOS_LABEL, ds_qos_ipv6_key_l2_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L3_QOS_LABEL, ds_qos_ipv6_key_l3_qos_label, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4DESTPORT_OR_L4INFO5TO0, ds_qos_ipv6_key_l4destport_or_l4info5to0, 6)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4DESTPORT_OR_L4INFO15TO6, ds_qos_ipv6_key_l4destport_or_l4info15to6, 10)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4INFO_MAPPED, ds_qos_ipv6_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4_DESTPORT, ds_qos_ipv6_key_l4_destport, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4_SOURCE_PORT3TO0, ds_qos_ipv6_key_l4_source_port3to0, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4_SOURCE_PORT11TO4, ds_qos_ipv6_key_l4_source_port11to4, 8)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_L4_SOURCE_PORT15TO12, ds_qos_ipv6_key_l4_source_port15to12, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_LAYER2_TYPE, ds_qos_ipv6_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_LAYER3_TYPE, ds_qos_ipv6_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_MAC_DA_LOWER, ds_qos_ipv6_key_mac_da_lower, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_MAC_DA_UPPER, ds_qos_ipv6_key_mac_da_upper, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_MAC_SA_LOWER, ds_qos_ipv6_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_MAC_SA_UPPER, ds_qos_ipv6_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_QOS_LABEL_LOWER, ds_qos_ipv6_key_qos_label_lower, 6)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_QOS_LABEL_UPPER, ds_qos_ipv6_key_qos_label_upper, 2)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_ROUTED_PACKET, ds_qos_ipv6_key_routed_packet, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_STAG_CFI, ds_qos_ipv6_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_STAG_COS, ds_qos_ipv6_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_SVLAN_ID, ds_qos_ipv6_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID0, ds_qos_ipv6_key_tableid0, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID1, ds_qos_ipv6_key_tableid1, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID2, ds_qos_ipv6_key_tableid2, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID3, ds_qos_ipv6_key_tableid3, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID4, ds_qos_ipv6_key_tableid4, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID5, ds_qos_ipv6_key_tableid5, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_TABLEID6, ds_qos_ipv6_key_tableid6, 4)
+        DRV_FIELD_GET_CASE(DS_QOS_IPV6_KEY_VLAN_PTR, ds_qos_ipv6_key_vlan_ptr, 14)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_DSCP, ds_ipv4_ucast_route_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_FRAG_INFO, ds_ipv4_ucast_route_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IP_DA, ds_ipv4_ucast_route_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv4_ucast_route_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IP_SA, ds_ipv4_ucast_route_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv4_ucast_route_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IS_TCP, ds_ipv4_ucast_route_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_IS_UDP, ds_ipv4_ucast_route_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_L4INFO_MAPPED, ds_ipv4_ucast_route_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv4_ucast_route_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv4_ucast_route_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv4_ucast_route_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_LKP_MODE, ds_ipv4_ucast_route_key_lkp_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_PBR_LABEL, ds_ipv4_ucast_route_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_TABLE_ID0, ds_ipv4_ucast_route_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_TABLE_ID1, ds_ipv4_ucast_route_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_VRF_IDH, ds_ipv4_ucast_route_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_ROUTE_KEY_VRF_IDL, ds_ipv4_ucast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_DSCP, ds_ipv4_mcast_route_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_FRAG_INFO, ds_ipv4_mcast_route_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IP_DA, ds_ipv4_mcast_route_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv4_mcast_route_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IP_SA, ds_ipv4_mcast_route_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv4_mcast_route_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IS_TCP, ds_ipv4_mcast_route_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_IS_UDP, ds_ipv4_mcast_route_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_L4INFO_MAPPED, ds_ipv4_mcast_route_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv4_mcast_route_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv4_mcast_route_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv4_mcast_route_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_LKP_MODE, ds_ipv4_mcast_route_key_lkp_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_PBR_LABEL, ds_ipv4_mcast_route_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_TABLE_ID0, ds_ipv4_mcast_route_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_TABLE_ID1, ds_ipv4_mcast_route_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_VRF_IDH, ds_ipv4_mcast_route_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_ROUTE_KEY_VRF_IDL, ds_ipv4_mcast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_NAT_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_DSCP, ds_ipv4_nat_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_FRAG_INFO, ds_ipv4_nat_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_IP_DA, ds_ipv4_nat_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_IP_OPTIONS, ds_ipv4_nat_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_IP_SA, ds_ipv4_nat_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_IS_APPLICATION, ds_ipv4_nat_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_IS_TCP, ds_ipv4_nat_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_IS_UDP, ds_ipv4_nat_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_L4INFO_MAPPED, ds_ipv4_nat_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_L4_DEST_PORT, ds_ipv4_nat_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_L4_SOURCE_PORT, ds_ipv4_nat_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_LAYER4_TYPE, ds_ipv4_nat_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_LKP_MODE, ds_ipv4_nat_key_lkp_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_PBR_LABEL, ds_ipv4_nat_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_TABLE_ID0, ds_ipv4_nat_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_TABLE_ID1, ds_ipv4_nat_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_VRF_IDH, ds_ipv4_nat_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV4_NAT_KEY_VRF_IDL, ds_ipv4_nat_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_PBR_DUALDA_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_DSCP, ds_ipv4_pbr_dualda_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_FRAG_INFO, ds_ipv4_pbr_dualda_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_IP_DA, ds_ipv4_pbr_dualda_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_IP_OPTIONS, ds_ipv4_pbr_dualda_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_IP_SA, ds_ipv4_pbr_dualda_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_IS_APPLICATION, ds_ipv4_pbr_dualda_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_IS_TCP, ds_ipv4_pbr_dualda_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_IS_UDP, ds_ipv4_pbr_dualda_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_L4INFO_MAPPED, ds_ipv4_pbr_dualda_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_L4_DEST_PORT, ds_ipv4_pbr_dualda_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_L4_SOURCE_PORT, ds_ipv4_pbr_dualda_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_LAYER4_TYPE, ds_ipv4_pbr_dualda_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_LKP_MODE, ds_ipv4_pbr_dualda_key_lkp_mode, 1)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_PBR_LABEL, ds_ipv4_pbr_dualda_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_TABLE_ID0, ds_ipv4_pbr_dualda_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_TABLE_ID1, ds_ipv4_pbr_dualda_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_VRF_IDH, ds_ipv4_pbr_dualda_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV4_PBR_DUALDA_KEY_VRF_IDL, ds_ipv4_pbr_dualda_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_HASH_KEY0_KEY_MAPPED_IP, ds_ipv4_ucast_hash_key0_key_mapped_ip, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_HASH_KEY0_KEY_VRFID, ds_ipv4_ucast_hash_key0_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_UCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_HASH_KEY1_KEY_MAPPED_IP, ds_ipv4_ucast_hash_key1_key_mapped_ip, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_UCAST_HASH_KEY1_KEY_VRFID, ds_ipv4_ucast_hash_key1_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_HASH_KEY0_KEY_MAPPED_IP, ds_ipv4_mcast_hash_key0_key_mapped_ip, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_HASH_KEY0_KEY_VRFID, ds_ipv4_mcast_hash_key0_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV4_MCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_HASH_KEY1_KEY_MAPPED_IP, ds_ipv4_mcast_hash_key1_key_mapped_ip, 32)
+        DRV_FIELD_GET_CASE(DS_IPV4_MCAST_HASH_KEY1_KEY_VRFID, ds_ipv4_mcast_hash_key1_key_vrfid, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_CTAG_CFI, ds_ipv6_ucast_route_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_CTAG_COS, ds_ipv6_ucast_route_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_CVLAN_ID, ds_ipv6_ucast_route_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_DSCP, ds_ipv6_ucast_route_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_DS_VLAN_PTR, ds_ipv6_ucast_route_key_ds_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_ETHER_TYPEH, ds_ipv6_ucast_route_key_ether_typeh, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_ETHER_TYPEL, ds_ipv6_ucast_route_key_ether_typel, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_FRAG_INFO, ds_ipv6_ucast_route_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_ucast_route_key_ipv6_extension_headers, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_FLOW_LABELH, ds_ipv6_ucast_route_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_FLOW_LABELL, ds_ipv6_ucast_route_key_ipv6_flow_labell, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_ucast_route_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA0, ds_ipv6_ucast_route_key_ip_da0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA1, ds_ipv6_ucast_route_key_ip_da1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA2, ds_ipv6_ucast_route_key_ip_da2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA3, ds_ipv6_ucast_route_key_ip_da3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_DA4, ds_ipv6_ucast_route_key_ip_da4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_HEADER_ERROR, ds_ipv6_ucast_route_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv6_ucast_route_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA0, ds_ipv6_ucast_route_key_ip_sa0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA1, ds_ipv6_ucast_route_key_ip_sa1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA2, ds_ipv6_ucast_route_key_ip_sa2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA3, ds_ipv6_ucast_route_key_ip_sa3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IP_SA4, ds_ipv6_ucast_route_key_ip_sa4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv6_ucast_route_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IS_TCP, ds_ipv6_ucast_route_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_IS_UDP, ds_ipv6_ucast_route_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv6_ucast_route_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_L4_INFO_MAPPED, ds_ipv6_ucast_route_key_l4_info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv6_ucast_route_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_LAYER2_TYPE, ds_ipv6_ucast_route_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_LAYER3_TYPE, ds_ipv6_ucast_route_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv6_ucast_route_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_DAH, ds_ipv6_ucast_route_key_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_DAL, ds_ipv6_ucast_route_key_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_SAH, ds_ipv6_ucast_route_key_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_MAC_SAL, ds_ipv6_ucast_route_key_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_PBR_LABEL, ds_ipv6_ucast_route_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_SCVLAN_ID, ds_ipv6_ucast_route_key_scvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_STAG_CFI, ds_ipv6_ucast_route_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_STAG_COS, ds_ipv6_ucast_route_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID0, ds_ipv6_ucast_route_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID1, ds_ipv6_ucast_route_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID2, ds_ipv6_ucast_route_key_table_id2, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID3, ds_ipv6_ucast_route_key_table_id3, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID4, ds_ipv6_ucast_route_key_table_id4, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID5, ds_ipv6_ucast_route_key_table_id5, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_TABLE_ID6, ds_ipv6_ucast_route_key_table_id6, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_VRF_IDH, ds_ipv6_ucast_route_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_ROUTE_KEY_VRF_IDL, ds_ipv6_ucast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_NAT_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_CTAG_CFI, ds_ipv6_nat_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_CTAG_COS, ds_ipv6_nat_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_CVLAN_ID, ds_ipv6_nat_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_DSCP, ds_ipv6_nat_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_DS_VLAN_PTR, ds_ipv6_nat_key_ds_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_ETHER_TYPEH, ds_ipv6_nat_key_ether_typeh, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_ETHER_TYPEL, ds_ipv6_nat_key_ether_typel, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_FRAG_INFO, ds_ipv6_nat_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_nat_key_ipv6_extension_headers, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IPV6_FLOW_LABELH, ds_ipv6_nat_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IPV6_FLOW_LABELL, ds_ipv6_nat_key_ipv6_flow_labell, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_nat_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_DA0, ds_ipv6_nat_key_ip_da0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_DA1, ds_ipv6_nat_key_ip_da1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_DA2, ds_ipv6_nat_key_ip_da2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_DA3, ds_ipv6_nat_key_ip_da3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_DA4, ds_ipv6_nat_key_ip_da4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_HEADER_ERROR, ds_ipv6_nat_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_OPTIONS, ds_ipv6_nat_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_SA0, ds_ipv6_nat_key_ip_sa0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_SA1, ds_ipv6_nat_key_ip_sa1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_SA2, ds_ipv6_nat_key_ip_sa2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_SA3, ds_ipv6_nat_key_ip_sa3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IP_SA4, ds_ipv6_nat_key_ip_sa4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IS_APPLICATION, ds_ipv6_nat_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IS_TCP, ds_ipv6_nat_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_IS_UDP, ds_ipv6_nat_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_L4_DEST_PORT, ds_ipv6_nat_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_L4_INFO_MAPPED, ds_ipv6_nat_key_l4_info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_L4_SOURCE_PORT, ds_ipv6_nat_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_LAYER2_TYPE, ds_ipv6_nat_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_LAYER3_TYPE, ds_ipv6_nat_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_LAYER4_TYPE, ds_ipv6_nat_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_MAC_DAH, ds_ipv6_nat_key_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_MAC_DAL, ds_ipv6_nat_key_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_MAC_SAH, ds_ipv6_nat_key_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_MAC_SAL, ds_ipv6_nat_key_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_PBR_LABEL, ds_ipv6_nat_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_SCVLAN_ID, ds_ipv6_nat_key_scvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_STAG_CFI, ds_ipv6_nat_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_STAG_COS, ds_ipv6_nat_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID0, ds_ipv6_nat_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID1, ds_ipv6_nat_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID2, ds_ipv6_nat_key_table_id2, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID3, ds_ipv6_nat_key_table_id3, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID4, ds_ipv6_nat_key_table_id4, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID5, ds_ipv6_nat_key_table_id5, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_TABLE_ID6, ds_ipv6_nat_key_table_id6, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_VRF_IDH, ds_ipv6_nat_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_NAT_KEY_VRF_IDL, ds_ipv6_nat_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_PBR_DUALDA_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_CTAG_CFI, ds_ipv6_pbr_dualda_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_CTAG_COS, ds_ipv6_pbr_dualda_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_CVLAN_ID, ds_ipv6_pbr_dualda_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_DSCP, ds_ipv6_pbr_dualda_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_DS_VLAN_PTR, ds_ipv6_pbr_dualda_key_ds_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_ETHER_TYPEH, ds_ipv6_pbr_dualda_key_ether_typeh, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_ETHER_TYPEL, ds_ipv6_pbr_dualda_key_ether_typel, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_FRAG_INFO, ds_ipv6_pbr_dualda_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_pbr_dualda_key_ipv6_extension_headers, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_FLOW_LABELH, ds_ipv6_pbr_dualda_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_FLOW_LABELL, ds_ipv6_pbr_dualda_key_ipv6_flow_labell, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_pbr_dualda_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA0, ds_ipv6_pbr_dualda_key_ip_da0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA1, ds_ipv6_pbr_dualda_key_ip_da1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA2, ds_ipv6_pbr_dualda_key_ip_da2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA3, ds_ipv6_pbr_dualda_key_ip_da3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_DA4, ds_ipv6_pbr_dualda_key_ip_da4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_HEADER_ERROR, ds_ipv6_pbr_dualda_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_OPTIONS, ds_ipv6_pbr_dualda_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA0, ds_ipv6_pbr_dualda_key_ip_sa0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA1, ds_ipv6_pbr_dualda_key_ip_sa1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA2, ds_ipv6_pbr_dualda_key_ip_sa2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA3, ds_ipv6_pbr_dualda_key_ip_sa3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IP_SA4, ds_ipv6_pbr_dualda_key_ip_sa4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IS_APPLICATION, ds_ipv6_pbr_dualda_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IS_TCP, ds_ipv6_pbr_dualda_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_IS_UDP, ds_ipv6_pbr_dualda_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_L4_DEST_PORT, ds_ipv6_pbr_dualda_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_L4_INFO_MAPPED, ds_ipv6_pbr_dualda_key_l4_info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_L4_SOURCE_PORT, ds_ipv6_pbr_dualda_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_LAYER2_TYPE, ds_ipv6_pbr_dualda_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_LAYER3_TYPE, ds_ipv6_pbr_dualda_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_LAYER4_TYPE, ds_ipv6_pbr_dualda_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_DAH, ds_ipv6_pbr_dualda_key_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_DAL, ds_ipv6_pbr_dualda_key_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_SAH, ds_ipv6_pbr_dualda_key_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_MAC_SAL, ds_ipv6_pbr_dualda_key_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_PBR_LABEL, ds_ipv6_pbr_dualda_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_SCVLAN_ID, ds_ipv6_pbr_dualda_key_scvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_STAG_CFI, ds_ipv6_pbr_dualda_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_STAG_COS, ds_ipv6_pbr_dualda_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID0, ds_ipv6_pbr_dualda_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID1, ds_ipv6_pbr_dualda_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID2, ds_ipv6_pbr_dualda_key_table_id2, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID3, ds_ipv6_pbr_dualda_key_table_id3, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID4, ds_ipv6_pbr_dualda_key_table_id4, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID5, ds_ipv6_pbr_dualda_key_table_id5, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_TABLE_ID6, ds_ipv6_pbr_dualda_key_table_id6, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_VRF_IDH, ds_ipv6_pbr_dualda_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_PBR_DUALDA_KEY_VRF_IDL, ds_ipv6_pbr_dualda_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_ROUTE_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_CTAG_CFI, ds_ipv6_mcast_route_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_CTAG_COS, ds_ipv6_mcast_route_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_CVLAN_ID, ds_ipv6_mcast_route_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_DSCP, ds_ipv6_mcast_route_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_DS_VLAN_PTR, ds_ipv6_mcast_route_key_ds_vlan_ptr, 14)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_ETHER_TYPEH, ds_ipv6_mcast_route_key_ether_typeh, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_ETHER_TYPEL, ds_ipv6_mcast_route_key_ether_typel, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_FRAG_INFO, ds_ipv6_mcast_route_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_EXTENSION_HEADERS, ds_ipv6_mcast_route_key_ipv6_extension_headers, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_FLOW_LABELH, ds_ipv6_mcast_route_key_ipv6_flow_labelh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_FLOW_LABELL, ds_ipv6_mcast_route_key_ipv6_flow_labell, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IPV6_RTK_TABLE_ID7, ds_ipv6_mcast_route_key_ipv6_rtk_table_id7, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA0, ds_ipv6_mcast_route_key_ip_da0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA1, ds_ipv6_mcast_route_key_ip_da1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA2, ds_ipv6_mcast_route_key_ip_da2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA3, ds_ipv6_mcast_route_key_ip_da3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_DA4, ds_ipv6_mcast_route_key_ip_da4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_HEADER_ERROR, ds_ipv6_mcast_route_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_OPTIONS, ds_ipv6_mcast_route_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA0, ds_ipv6_mcast_route_key_ip_sa0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA1, ds_ipv6_mcast_route_key_ip_sa1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA2, ds_ipv6_mcast_route_key_ip_sa2, 8)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA3, ds_ipv6_mcast_route_key_ip_sa3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IP_SA4, ds_ipv6_mcast_route_key_ip_sa4, 24)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IS_APPLICATION, ds_ipv6_mcast_route_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IS_TCP, ds_ipv6_mcast_route_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_IS_UDP, ds_ipv6_mcast_route_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_L4_DEST_PORT, ds_ipv6_mcast_route_key_l4_dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_L4_INFO_MAPPED, ds_ipv6_mcast_route_key_l4_info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_L4_SOURCE_PORT, ds_ipv6_mcast_route_key_l4_source_port, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_LAYER2_TYPE, ds_ipv6_mcast_route_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_LAYER3_TYPE, ds_ipv6_mcast_route_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_LAYER4_TYPE, ds_ipv6_mcast_route_key_layer4_type, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_DAH, ds_ipv6_mcast_route_key_mac_dah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_DAL, ds_ipv6_mcast_route_key_mac_dal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_SAH, ds_ipv6_mcast_route_key_mac_sah, 16)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_MAC_SAL, ds_ipv6_mcast_route_key_mac_sal, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_PBR_LABEL, ds_ipv6_mcast_route_key_pbr_label, 6)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_SCVLAN_ID, ds_ipv6_mcast_route_key_scvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_STAG_CFI, ds_ipv6_mcast_route_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_STAG_COS, ds_ipv6_mcast_route_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID0, ds_ipv6_mcast_route_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID1, ds_ipv6_mcast_route_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID2, ds_ipv6_mcast_route_key_table_id2, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID3, ds_ipv6_mcast_route_key_table_id3, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID4, ds_ipv6_mcast_route_key_table_id4, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID5, ds_ipv6_mcast_route_key_table_id5, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_TABLE_ID6, ds_ipv6_mcast_route_key_table_id6, 4)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_VRF_IDH, ds_ipv6_mcast_route_key_vrf_idh, 12)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_ROUTE_KEY_VRF_IDL, ds_ipv6_mcast_route_key_vrf_idl, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA0, ds_ipv6_ucast_hash_key0_key_ipda0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA1, ds_ipv6_ucast_hash_key0_key_ipda1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA2, ds_ipv6_ucast_hash_key0_key_ipda2, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_KEY_IPDA3, ds_ipv6_ucast_hash_key0_key_ipda3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID0, ds_ipv6_ucast_hash_key0_vrfid0, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID1, ds_ipv6_ucast_hash_key0_vrfid1, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID2, ds_ipv6_ucast_hash_key0_vrfid2, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY0_VRFID3, ds_ipv6_ucast_hash_key0_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA0, ds_ipv6_mcast_hash_key0_key_ipda0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA1, ds_ipv6_mcast_hash_key0_key_ipda1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA2, ds_ipv6_mcast_hash_key0_key_ipda2, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_KEY_IPDA3, ds_ipv6_mcast_hash_key0_key_ipda3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID0, ds_ipv6_mcast_hash_key0_vrfid0, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID1, ds_ipv6_mcast_hash_key0_vrfid1, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID2, ds_ipv6_mcast_hash_key0_vrfid2, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY0_VRFID3, ds_ipv6_mcast_hash_key0_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_UCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA0, ds_ipv6_ucast_hash_key1_key_ipda0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA1, ds_ipv6_ucast_hash_key1_key_ipda1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA2, ds_ipv6_ucast_hash_key1_key_ipda2, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_KEY_IPDA3, ds_ipv6_ucast_hash_key1_key_ipda3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID0, ds_ipv6_ucast_hash_key1_vrfid0, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID1, ds_ipv6_ucast_hash_key1_vrfid1, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID2, ds_ipv6_ucast_hash_key1_vrfid2, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_UCAST_HASH_KEY1_VRFID3, ds_ipv6_ucast_hash_key1_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_IPV6_MCAST_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA0, ds_ipv6_mcast_hash_key1_key_ipda0, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA1, ds_ipv6_mcast_hash_key1_key_ipda1, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA2, ds_ipv6_mcast_hash_key1_key_ipda2, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_KEY_IPDA3, ds_ipv6_mcast_hash_key1_key_ipda3, 32)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID0, ds_ipv6_mcast_hash_key1_vrfid0, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID1, ds_ipv6_mcast_hash_key1_vrfid1, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID2, ds_ipv6_mcast_hash_key1_vrfid2, 3)
+        DRV_FIELD_GET_CASE(DS_IPV6_MCAST_HASH_KEY1_VRFID3, ds_ipv6_mcast_hash_key1_vrfid3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_VLAN_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_CUSTOMER_ID, ds_user_id_vlan_key_customer_id, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_CVLAN_IDH, ds_user_id_vlan_key_cvlan_idh, 6)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_CVLAN_IDL, ds_user_id_vlan_key_cvlan_idl, 6)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_FROM_SGMAC, ds_user_id_vlan_key_from_sgmac, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_GLOBAL_SRC_PORT, ds_user_id_vlan_key_global_src_port, 13)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_SVLAN_ID, ds_user_id_vlan_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_TABLE_ID, ds_user_id_vlan_key_table_id, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_VLAN_KEY_USER_ID_LABEL, ds_user_id_vlan_key_user_id_label, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_MAC_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_CFI1, ds_user_id_mac_key_cfi1, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_CFI2, ds_user_id_mac_key_cfi2, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_COS1, ds_user_id_mac_key_cos1, 3)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_COS2, ds_user_id_mac_key_cos2, 3)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_EXP2, ds_user_id_mac_key_exp2, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_EXP_SUB_IDX, ds_user_id_mac_key_exp_sub_idx, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_FROM_SGMAC, ds_user_id_mac_key_from_sgmac, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_LAYER2_TYPE, ds_user_id_mac_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_LAYER3_TYPE, ds_user_id_mac_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_MAC_DA_LOWER, ds_user_id_mac_key_mac_da_lower, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_MAC_DA_UPPER, ds_user_id_mac_key_mac_da_upper, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_MAC_SA_LOWER, ds_user_id_mac_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_MAC_SA_UPPER, ds_user_id_mac_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_TABLE_ID0, ds_user_id_mac_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_TABLE_ID1, ds_user_id_mac_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_USER_ID_LABEL, ds_user_id_mac_key_user_id_label, 6)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_VLAN_ID1, ds_user_id_mac_key_vlan_id1, 12)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_VLAN_ID27TO0, ds_user_id_mac_key_vlan_id27to0, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_MAC_KEY_VLAN_ID211TO8, ds_user_id_mac_key_vlan_id211to8, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV4_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_CTAG_CFI, ds_user_id_ipv4_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_CTAG_COS, ds_user_id_ipv4_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_CVLAN_ID, ds_user_id_ipv4_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_DSCP, ds_user_id_ipv4_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_ETHER_TYPE_LOWER, ds_user_id_ipv4_key_ether_type_lower, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_ETHER_TYPE_UPPER, ds_user_id_ipv4_key_ether_type_upper, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_EXP2, ds_user_id_ipv4_key_exp2, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_EXP_SUB_IDX, ds_user_id_ipv4_key_exp_sub_idx, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_FRAG_INFO, ds_user_id_ipv4_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_FROM_SGMAC, ds_user_id_ipv4_key_from_sgmac, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IP_DA, ds_user_id_ipv4_key_ip_da, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IP_HEADER_ERROR, ds_user_id_ipv4_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IP_OPTIONS, ds_user_id_ipv4_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IP_SA, ds_user_id_ipv4_key_ip_sa, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IS_APPLICATION, ds_user_id_ipv4_key_is_application, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IS_TCP, ds_user_id_ipv4_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_IS_UDP, ds_user_id_ipv4_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_L4DEST_PORT, ds_user_id_ipv4_key_l4dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_L4INFO_MAPPED, ds_user_id_ipv4_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_L4SOURCE_PORT, ds_user_id_ipv4_key_l4source_port, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_LAYER2_TYPE, ds_user_id_ipv4_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_LAYER3_TYPE, ds_user_id_ipv4_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_MAC_DA_LOWER, ds_user_id_ipv4_key_mac_da_lower, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_MAC_DA_UPPER, ds_user_id_ipv4_key_mac_da_upper, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_MAC_SA_LOWER, ds_user_id_ipv4_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_MAC_SA_UPPER, ds_user_id_ipv4_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_ROUTED_PACKET, ds_user_id_ipv4_key_routed_packet, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_STAG_CFI, ds_user_id_ipv4_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_STAG_COS, ds_user_id_ipv4_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_SVLAN_ID, ds_user_id_ipv4_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID0, ds_user_id_ipv4_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID1, ds_user_id_ipv4_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID2, ds_user_id_ipv4_key_table_id2, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_TABLE_ID3, ds_user_id_ipv4_key_table_id3, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV4_KEY_USER_ID_LABEL, ds_user_id_ipv4_key_user_id_label, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_USER_ID_IPV6_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_CTAG_CFI, ds_user_id_ipv6_key_ctag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_CTAG_COS, ds_user_id_ipv6_key_ctag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_CVLAN_ID, ds_user_id_ipv6_key_cvlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_DSCP, ds_user_id_ipv6_key_dscp, 6)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_ETHER_TYPE7TO0, ds_user_id_ipv6_key_ether_type7to0, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_ETHER_TYPE15TO8, ds_user_id_ipv6_key_ether_type15to8, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_EXP2, ds_user_id_ipv6_key_exp2, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_EXP_SUB_IDX, ds_user_id_ipv6_key_exp_sub_idx, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_FRAG_INFO, ds_user_id_ipv6_key_frag_info, 2)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_FROM_SGMAC, ds_user_id_ipv6_key_from_sgmac, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IPV6_EXTERNSION_HEADERS, ds_user_id_ipv6_key_ipv6_externsion_headers, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IPV6_FLOW_LABEL, ds_user_id_ipv6_key_ipv6_flow_label, 20)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_DA31_TO0, ds_user_id_ipv6_key_ip_da31_to0, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_DA63_TO32, ds_user_id_ipv6_key_ip_da63_to32, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_DA71_TO64, ds_user_id_ipv6_key_ip_da71_to64, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_DA103_TO72, ds_user_id_ipv6_key_ip_da103_to72, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_DA127_TO104, ds_user_id_ipv6_key_ip_da127_to104, 24)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_HEADER_ERROR, ds_user_id_ipv6_key_ip_header_error, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_OPTIONS, ds_user_id_ipv6_key_ip_options, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_SA31_TO0, ds_user_id_ipv6_key_ip_sa31_to0, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_SA63_TO32, ds_user_id_ipv6_key_ip_sa63_to32, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_SA71_TO64, ds_user_id_ipv6_key_ip_sa71_to64, 8)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_SA103_TO72, ds_user_id_ipv6_key_ip_sa103_to72, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IP_SA127_TO104, ds_user_id_ipv6_key_ip_sa127_to104, 24)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IS_APP, ds_user_id_ipv6_key_is_app, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IS_TCP, ds_user_id_ipv6_key_is_tcp, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_IS_UDP, ds_user_id_ipv6_key_is_udp, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_L4DEST_PORT, ds_user_id_ipv6_key_l4dest_port, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_L4INFO_MAPPED, ds_user_id_ipv6_key_l4info_mapped, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_L4SOURCE_PORT, ds_user_id_ipv6_key_l4source_port, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_LAYER2_TYPE, ds_user_id_ipv6_key_layer2_type, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_LAYER3_TYPE, ds_user_id_ipv6_key_layer3_type, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_MAC_DA_LOWER, ds_user_id_ipv6_key_mac_da_lower, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_MAC_DA_UPPER, ds_user_id_ipv6_key_mac_da_upper, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_MAC_SA_LOWER, ds_user_id_ipv6_key_mac_sa_lower, 32)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_MAC_SA_UPPER, ds_user_id_ipv6_key_mac_sa_upper, 16)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_ROUTED_PACKET, ds_user_id_ipv6_key_routed_packet, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_STAG_CFI, ds_user_id_ipv6_key_stag_cfi, 1)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_STAG_COS, ds_user_id_ipv6_key_stag_cos, 3)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_SVLAN_ID, ds_user_id_ipv6_key_svlan_id, 12)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID0, ds_user_id_ipv6_key_table_id0, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID1, ds_user_id_ipv6_key_table_id1, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID2, ds_user_id_ipv6_key_table_id2, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID3, ds_user_id_ipv6_key_table_id3, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID4, ds_user_id_ipv6_key_table_id4, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID5, ds_user_id_ipv6_key_table_id5, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID6, ds_user_id_ipv6_key_table_id6, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_TABLE_ID7, ds_user_id_ipv6_key_table_id7, 4)
+        DRV_FIELD_GET_CASE(DS_USER_ID_IPV6_KEY_USER_ID_LABEL, ds_user_id_ipv6_key_user_id_label, 6)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_KEY_IS_UP, ds_eth_oam_key_is_up, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_KEY_OAM_LOOKUP_TYPE, ds_eth_oam_key_oam_lookup_type, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_KEY_PORT, ds_eth_oam_key_port, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_KEY_TABLE_ID, ds_eth_oam_key_table_id, 4)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_KEY_VLAN_PTR, ds_eth_oam_key_vlan_ptr, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT0, ds_eth_oam_hash_key0_global_src_port0, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT1, ds_eth_oam_hash_key0_global_src_port1, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT2, ds_eth_oam_hash_key0_global_src_port2, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_GLOBAL_SRC_PORT3, ds_eth_oam_hash_key0_global_src_port3, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID0, ds_eth_oam_hash_key0_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID1, ds_eth_oam_hash_key0_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID2, ds_eth_oam_hash_key0_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_INVALID3, ds_eth_oam_hash_key0_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP0, ds_eth_oam_hash_key0_is_up0, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP1, ds_eth_oam_hash_key0_is_up1, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP2, ds_eth_oam_hash_key0_is_up2, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_IS_UP3, ds_eth_oam_hash_key0_is_up3, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE0, ds_eth_oam_hash_key0_oam_hash_type0, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE1, ds_eth_oam_hash_key0_oam_hash_type1, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE2, ds_eth_oam_hash_key0_oam_hash_type2, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_OAM_HASH_TYPE3, ds_eth_oam_hash_key0_oam_hash_type3, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR0, ds_eth_oam_hash_key0_vlan_ptr0, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR1, ds_eth_oam_hash_key0_vlan_ptr1, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR2, ds_eth_oam_hash_key0_vlan_ptr2, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY0_VLAN_PTR3, ds_eth_oam_hash_key0_vlan_ptr3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT0, ds_eth_oam_hash_key1_global_src_port0, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT1, ds_eth_oam_hash_key1_global_src_port1, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT2, ds_eth_oam_hash_key1_global_src_port2, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_GLOBAL_SRC_PORT3, ds_eth_oam_hash_key1_global_src_port3, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID0, ds_eth_oam_hash_key1_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID1, ds_eth_oam_hash_key1_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID2, ds_eth_oam_hash_key1_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_INVALID3, ds_eth_oam_hash_key1_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP0, ds_eth_oam_hash_key1_is_up0, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP1, ds_eth_oam_hash_key1_is_up1, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP2, ds_eth_oam_hash_key1_is_up2, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_IS_UP3, ds_eth_oam_hash_key1_is_up3, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE0, ds_eth_oam_hash_key1_oam_hash_type0, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE1, ds_eth_oam_hash_key1_oam_hash_type1, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE2, ds_eth_oam_hash_key1_oam_hash_type2, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_OAM_HASH_TYPE3, ds_eth_oam_hash_key1_oam_hash_type3, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR0, ds_eth_oam_hash_key1_vlan_ptr0, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR1, ds_eth_oam_hash_key1_vlan_ptr1, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR2, ds_eth_oam_hash_key1_vlan_ptr2, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_HASH_KEY1_VLAN_PTR3, ds_eth_oam_hash_key1_vlan_ptr3, 16)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PBT_OAM_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_KEY_ESP_ID, ds_pbt_oam_key_esp_id, 13)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_KEY_OAM_LOOKUP_TYPE, ds_pbt_oam_key_oam_lookup_type, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_KEY_PBT_OAM_PORT, ds_pbt_oam_key_pbt_oam_port, 12)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_KEY_TABLE_ID, ds_pbt_oam_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PBT_OAM_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID0, ds_pbt_oam_hash_key0_esp_id0, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID1, ds_pbt_oam_hash_key0_esp_id1, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID2, ds_pbt_oam_hash_key0_esp_id2, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_ESP_ID3, ds_pbt_oam_hash_key0_esp_id3, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID0, ds_pbt_oam_hash_key0_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID1, ds_pbt_oam_hash_key0_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID2, ds_pbt_oam_hash_key0_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_INVALID3, ds_pbt_oam_hash_key0_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE0, ds_pbt_oam_hash_key0_oam_lookup_type0, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE1, ds_pbt_oam_hash_key0_oam_lookup_type1, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE2, ds_pbt_oam_hash_key0_oam_lookup_type2, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_OAM_LOOKUP_TYPE3, ds_pbt_oam_hash_key0_oam_lookup_type3, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT0, ds_pbt_oam_hash_key0_pbt_oam_port0, 15)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT1, ds_pbt_oam_hash_key0_pbt_oam_port1, 15)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT2, ds_pbt_oam_hash_key0_pbt_oam_port2, 15)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY0_PBT_OAM_PORT3, ds_pbt_oam_hash_key0_pbt_oam_port3, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_PBT_OAM_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID0, ds_pbt_oam_hash_key1_esp_id0, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID1, ds_pbt_oam_hash_key1_esp_id1, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID2, ds_pbt_oam_hash_key1_esp_id2, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_ESP_ID3, ds_pbt_oam_hash_key1_esp_id3, 16)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID0, ds_pbt_oam_hash_key1_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID1, ds_pbt_oam_hash_key1_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID2, ds_pbt_oam_hash_key1_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_INVALID3, ds_pbt_oam_hash_key1_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE0, ds_pbt_oam_hash_key1_oam_lookup_type0, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE1, ds_pbt_oam_hash_key1_oam_lookup_type1, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE2, ds_pbt_oam_hash_key1_oam_lookup_type2, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_OAM_LOOKUP_TYPE3, ds_pbt_oam_hash_key1_oam_lookup_type3, 3)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT0, ds_pbt_oam_hash_key1_pbt_oam_port0, 15)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT1, ds_pbt_oam_hash_key1_pbt_oam_port1, 15)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT2, ds_pbt_oam_hash_key1_pbt_oam_port2, 15)
+        DRV_FIELD_GET_CASE(DS_PBT_OAM_HASH_KEY1_PBT_OAM_PORT3, ds_pbt_oam_hash_key1_pbt_oam_port3, 15)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_LABEL_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_KEY_MPLS_LABLE, ds_mpls_oam_label_key_mpls_lable, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_KEY_OAM_LOOKUP_TYPE, ds_mpls_oam_label_key_oam_lookup_type, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_KEY_TABLE_ID, ds_mpls_oam_label_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_LABEL_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID0, ds_mpls_oam_label_hash_key0_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID1, ds_mpls_oam_label_hash_key0_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID2, ds_mpls_oam_label_hash_key0_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_INVALID3, ds_mpls_oam_label_hash_key0_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL0, ds_mpls_oam_label_hash_key0_mpls_label0, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL1, ds_mpls_oam_label_hash_key0_mpls_label1, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL2, ds_mpls_oam_label_hash_key0_mpls_label2, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_MPLS_LABEL3, ds_mpls_oam_label_hash_key0_mpls_label3, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE0, ds_mpls_oam_label_hash_key0_oam_look_up_type0, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE1, ds_mpls_oam_label_hash_key0_oam_look_up_type1, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE2, ds_mpls_oam_label_hash_key0_oam_look_up_type2, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY0_OAM_LOOK_UP_TYPE3, ds_mpls_oam_label_hash_key0_oam_look_up_type3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_LABEL_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID0, ds_mpls_oam_label_hash_key1_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID1, ds_mpls_oam_label_hash_key1_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID2, ds_mpls_oam_label_hash_key1_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_INVALID3, ds_mpls_oam_label_hash_key1_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL0, ds_mpls_oam_label_hash_key1_mpls_label0, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL1, ds_mpls_oam_label_hash_key1_mpls_label1, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL2, ds_mpls_oam_label_hash_key1_mpls_label2, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_MPLS_LABEL3, ds_mpls_oam_label_hash_key1_mpls_label3, 20)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE0, ds_mpls_oam_label_hash_key1_oam_look_up_type0, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE1, ds_mpls_oam_label_hash_key1_oam_look_up_type1, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE2, ds_mpls_oam_label_hash_key1_oam_look_up_type2, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_LABEL_HASH_KEY1_OAM_LOOK_UP_TYPE3, ds_mpls_oam_label_hash_key1_oam_look_up_type3, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_IPV4_TTSI_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_LSP_ID, ds_mpls_oam_ipv4_ttsi_key_lsp_id, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_LSR_ID, ds_mpls_oam_ipv4_ttsi_key_lsr_id, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_OAM_LOOKUP_TYPE, ds_mpls_oam_ipv4_ttsi_key_oam_lookup_type, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_KEY_TABLE_ID, ds_mpls_oam_ipv4_ttsi_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_INVALID0, ds_mpls_oam_ipv4_ttsi_hash_key0_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_INVALID1, ds_mpls_oam_ipv4_ttsi_hash_key0_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSP_ID0, ds_mpls_oam_ipv4_ttsi_hash_key0_lsp_id0, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSP_ID1, ds_mpls_oam_ipv4_ttsi_hash_key0_lsp_id1, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSR_ID0, ds_mpls_oam_ipv4_ttsi_hash_key0_lsr_id0, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_LSR_ID1, ds_mpls_oam_ipv4_ttsi_hash_key0_lsr_id1, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_OAM_LOOKUP_TYPE0, ds_mpls_oam_ipv4_ttsi_hash_key0_oam_lookup_type0, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY0_OAM_LOOKUP_TYPE1, ds_mpls_oam_ipv4_ttsi_hash_key0_oam_lookup_type1, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_INVALID0, ds_mpls_oam_ipv4_ttsi_hash_key1_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_INVALID1, ds_mpls_oam_ipv4_ttsi_hash_key1_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSP_ID0, ds_mpls_oam_ipv4_ttsi_hash_key1_lsp_id0, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSP_ID1, ds_mpls_oam_ipv4_ttsi_hash_key1_lsp_id1, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSR_ID0, ds_mpls_oam_ipv4_ttsi_hash_key1_lsr_id0, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_LSR_ID1, ds_mpls_oam_ipv4_ttsi_hash_key1_lsr_id1, 32)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_OAM_LOOKUP_TYPE0, ds_mpls_oam_ipv4_ttsi_hash_key1_oam_lookup_type0, 3)
+        DRV_FIELD_GET_CASE(DS_MPLS_OAM_IPV4_TTSI_HASH_KEY1_OAM_LOOKUP_TYPE1, ds_mpls_oam_ipv4_ttsi_hash_key1_oam_lookup_type1, 3)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_RMEP_KEY:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_KEY_MEP_INDEX, ds_eth_oam_rmep_key_mep_index, 16)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_KEY_OAM_LOOKUP_TYPE, ds_eth_oam_rmep_key_oam_lookup_type, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_KEY_RMEP_ID, ds_eth_oam_rmep_key_rmep_id, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_KEY_TABLE_ID, ds_eth_oam_rmep_key_table_id, 4)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_RMEP_HASH_KEY0:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID0, ds_eth_oam_rmep_hash_key0_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID1, ds_eth_oam_rmep_hash_key0_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID2, ds_eth_oam_rmep_hash_key0_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_INVALID3, ds_eth_oam_rmep_hash_key0_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX0, ds_eth_oam_rmep_hash_key0_mep_index0, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX1, ds_eth_oam_rmep_hash_key0_mep_index1, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX2, ds_eth_oam_rmep_hash_key0_mep_index2, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_MEP_INDEX3, ds_eth_oam_rmep_hash_key0_mep_index3, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE0, ds_eth_oam_rmep_hash_key0_oam_lookup_type0, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE1, ds_eth_oam_rmep_hash_key0_oam_lookup_type1, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE2, ds_eth_oam_rmep_hash_key0_oam_lookup_type2, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_OAM_LOOKUP_TYPE3, ds_eth_oam_rmep_hash_key0_oam_lookup_type3, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID0, ds_eth_oam_rmep_hash_key0_rmep_id0, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID1, ds_eth_oam_rmep_hash_key0_rmep_id1, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID2, ds_eth_oam_rmep_hash_key0_rmep_id2, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY0_RMEP_ID3, ds_eth_oam_rmep_hash_key0_rmep_id3, 13)
+        default:
+            break;
+        }
+        break;
+
+    case DS_ETH_OAM_RMEP_HASH_KEY1:
+        switch (field_id)
+        {
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID0, ds_eth_oam_rmep_hash_key1_invalid0, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID1, ds_eth_oam_rmep_hash_key1_invalid1, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID2, ds_eth_oam_rmep_hash_key1_invalid2, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_INVALID3, ds_eth_oam_rmep_hash_key1_invalid3, 1)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX0, ds_eth_oam_rmep_hash_key1_mep_index0, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX1, ds_eth_oam_rmep_hash_key1_mep_index1, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX2, ds_eth_oam_rmep_hash_key1_mep_index2, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_MEP_INDEX3, ds_eth_oam_rmep_hash_key1_mep_index3, 15)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE0, ds_eth_oam_rmep_hash_key1_oam_lookup_type0, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE1, ds_eth_oam_rmep_hash_key1_oam_lookup_type1, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE2, ds_eth_oam_rmep_hash_key1_oam_lookup_type2, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_OAM_LOOKUP_TYPE3, ds_eth_oam_rmep_hash_key1_oam_lookup_type3, 3)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID0, ds_eth_oam_rmep_hash_key1_rmep_id0, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID1, ds_eth_oam_rmep_hash_key1_rmep_id1, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID2, ds_eth_oam_rmep_hash_key1_rmep_id2, 13)
+        DRV_FIELD_GET_CASE(DS_ETH_OAM_RMEP_HASH_KEY1_RMEP_ID3, ds_eth_oam_rmep_hash_key1_rmep_id3, 13)
+        default:
+            break;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return drv_tbl_field_get(tbl_id, field_id, entry, value);
+}
@@ -57,8 +57,8 @@ _drv_install_io_api(drv_work_platform_type_t  platform_type, uint8 chip_num)
         drv_io_api[chip_id].drv_tcam_tbl_ds_to_entry = drv_tcam_tbl_ds_to_entry;
         drv_io_api[chip_id].drv_sram_tbl_entry_to_ds = drv_sram_tbl_entry_to_ds;
         drv_io_api[chip_id].drv_tcam_tbl_entry_to_ds = drv_tcam_tbl_entry_to_ds;
-        drv_io_api[chip_id].drv_tbl_field_set = drv_tbl_field_set;
-        drv_io_api[chip_id].drv_tbl_field_get = drv_tbl_field_get;
+        drv_io_api[chip_id].drv_tbl_field_set = drv_humber_tbl_field_set;
+        drv_io_api[chip_id].drv_tbl_field_get = drv_humber_tbl_field_get;
         drv_io_api[chip_id].drv_sram_reg_ds_to_entry = drv_sram_reg_ds_to_entry;
         drv_io_api[chip_id].drv_sram_reg_entry_to_ds = drv_sram_reg_entry_to_ds;
         drv_io_api[chip_id].drv_reg_field_set = drv_reg_field_set;
@@ -18,9 +18,340 @@
 /**********************************************************************************
               Define Gloabal var, Typedef, define and Data Structure
 ***********************************************************************************/
+/* software copy of a sram table that is only ever written by software,
+   it serves the reads and field read-modify-writes of drv_tbl_ioctl() */
+struct drv_tbl_shadow_s
+{
+    uint32* p_data;         /* max_index entries of entry_words words */
+    uint32* p_valid;        /* bitmap of the entries that mirror the hardware */
+    uint32 entry_words;
+    uint32 max_index;
+    uint32 hit_count;
+    uint32 miss_count;
+};
+typedef struct drv_tbl_shadow_s drv_tbl_shadow_t;
+
+static drv_tbl_shadow_t* drv_tbl_shadow[MAX_LOCAL_CHIP_NUM][MAX_TBL_NUM];
+static kal_mutex_t* drv_tbl_shadow_mutex[MAX_LOCAL_CHIP_NUM];
+
+#define DRV_TBL_SHADOW_LOCK(chip_id)    kal_mutex_lock(drv_tbl_shadow_mutex[chip_id])
+#define DRV_TBL_SHADOW_UNLOCK(chip_id)  kal_mutex_unlock(drv_tbl_shadow_mutex[chip_id])
+
+#define DRV_TBL_SHADOW_IS_VALID(p_shadow, index) \
+    ((p_shadow)->p_valid[(index) >> 5] & (1U << ((index) & 0x1F)))
+#define DRV_TBL_SHADOW_SET_VALID(p_shadow, index) \
+    ((p_shadow)->p_valid[(index) >> 5] |= (1U << ((index) & 0x1F)))
+#define DRV_TBL_SHADOW_CLEAR_VALID(p_shadow, index) \
+    ((p_shadow)->p_valid[(index) >> 5] &= ~(1U << ((index) & 0x1F)))
+#define DRV_TBL_SHADOW_ENTRY(p_shadow, index) \
+    ((p_shadow)->p_data + (index) * (p_shadow)->entry_words)
+
 /**********************************************************************************
                       Function interfaces realization
 ***********************************************************************************/
+/**
+ @brief Get one shadowed sram entry, loading it from the chip on a miss
+*/
+static int32
+_drv_tbl_shadow_get_entry(uint8 chip_id, tbl_id_t tbl_id, drv_tbl_shadow_t* p_shadow,
+                          uint32 index, uint32* data_entry)
+{
+    if (DRV_TBL_SHADOW_IS_VALID(p_shadow, index))
+    {
+        p_shadow->hit_count++;
+        kal_memcpy(data_entry, DRV_TBL_SHADOW_ENTRY(p_shadow, index), p_shadow->entry_words * 4);
+        return DRV_E_NONE;
+    }
+
+    p_shadow->miss_count++;
+    if (drv_io_api[chip_id].drv_sram_tbl_read)
+    {
+        DRV_IF_ERROR_RETURN(drv_io_api[chip_id].drv_sram_tbl_read(chip_id, tbl_id, index, data_entry));
+    }
+
+    kal_memcpy(DRV_TBL_SHADOW_ENTRY(p_shadow, index), data_entry, p_shadow->entry_words * 4);
+    DRV_TBL_SHADOW_SET_VALID(p_shadow, index);
+
+    return DRV_E_NONE;
+}
+
+/**
+ @brief Write one shadowed sram entry through to the chip
+*/
+static int32
+_drv_tbl_shadow_set_entry(uint8 chip_id, tbl_id_t tbl_id, drv_tbl_shadow_t* p_shadow,
+                          uint32 index, uint32* data_entry)
+{
+    int32 ret = DRV_E_NONE;
+
+    if (drv_io_api[chip_id].drv_sram_tbl_write)
+    {
+        ret = drv_io_api[chip_id].drv_sram_tbl_write(chip_id, tbl_id, index, data_entry);
+    }
+
+    if (ret < DRV_E_NONE)
+    {
+        /* the chip may hold either version now */
+        DRV_TBL_SHADOW_CLEAR_VALID(p_shadow, index);
+        return ret;
+    }
+
+    kal_memcpy(DRV_TBL_SHADOW_ENTRY(p_shadow, index), data_entry, p_shadow->entry_words * 4);
+    DRV_TBL_SHADOW_SET_VALID(p_shadow, index);
+
+    return DRV_E_NONE;
+}
+
+/**
+ @brief drv_tbl_ioctl() for a shadowed sram table, called with the shadow lock held
+*/
+static int32
+_drv_tbl_shadow_ioctl(uint8 chip_id, drv_tbl_shadow_t* p_shadow, int32 index,
+                      int32 action, tbl_id_t tbl_id, uint16 field_id, void* val)
+{
+    uint32 data_entry[MAX_ENTRY_WORD] = {0};
+
+    if ((index < 0) || ((uint32)index >= p_shadow->max_index))
+    {
+        return DRV_E_INVALID_PARAM;
+    }
+
+    if (DRV_ENTRY_FLAG == field_id)
+    {
+        switch (action)
+        {
+        case DRV_IOC_WRITE:
+            DRV_IF_ERROR_RETURN(drv_io_api[chip_id].drv_sram_tbl_ds_to_entry(tbl_id, val, data_entry));
+            DRV_IF_ERROR_RETURN(_drv_tbl_shadow_set_entry(chip_id, tbl_id, p_shadow, index, data_entry));
+            break;
+        case DRV_IOC_READ:
+            DRV_IF_ERROR_RETURN(_drv_tbl_shadow_get_entry(chip_id, tbl_id, p_shadow, index, data_entry));
+            DRV_IF_ERROR_RETURN(drv_io_api[chip_id].drv_sram_tbl_entry_to_ds(tbl_id, data_entry, val));
+            break;
+        default:
+            break;
+        }
+    }
+    else
+    {
+        switch (action)
+        {
+        case DRV_IOC_WRITE:
+            DRV_IF_ERROR_RETURN(_drv_tbl_shadow_get_entry(chip_id, tbl_id, p_shadow, index, data_entry));
+            DRV_IF_ERROR_RETURN(drv_io_api[chip_id].drv_tbl_field_set(tbl_id, field_id, data_entry, *(uint32*)val));
+            DRV_IF_ERROR_RETURN(_drv_tbl_shadow_set_entry(chip_id, tbl_id, p_shadow, index, data_entry));
+            break;
+        case DRV_IOC_READ:
+            DRV_IF_ERROR_RETURN(_drv_tbl_shadow_get_entry(chip_id, tbl_id, p_shadow, index, data_entry));
+            DRV_IF_ERROR_RETURN(drv_io_api[chip_id].drv_tbl_field_get(tbl_id, field_id, data_entry, (uint32*)val));
+            break;
+        default:
+            break;
+        }
+    }
+
+    return DRV_E_NONE;
+}
+
+/**
+ @brief Forget one shadowed entry after the chip was written behind drv_tbl_ioctl()
+*/
+static void
+_drv_tbl_shadow_invalidate(uint8 chip_id, tbl_id_t tbl_id, uint32 index)
+{
+    drv_tbl_shadow_t* p_shadow;
+
+    if ((chip_id >= MAX_LOCAL_CHIP_NUM) || (tbl_id >= MAX_TBL_NUM)
+        || (NULL == drv_tbl_shadow[chip_id][tbl_id]))
+    {
+        return;
+    }
+
+    DRV_TBL_SHADOW_LOCK(chip_id);
+    p_shadow = drv_tbl_shadow[chip_id][tbl_id];
+    if (p_shadow && (index < p_shadow->max_index))
+    {
+        DRV_TBL_SHADOW_CLEAR_VALID(p_shadow, index);
+    }
+    DRV_TBL_SHADOW_UNLOCK(chip_id);
+}
+
+/**
+ @brief Keep a write-through software copy of a sram table
+
+ Only for tables no one but drv_tbl_ioctl() writes: entries are loaded
+ from the chip on first access and never re-read afterwards.
+*/
+int32
+drv_tbl_shadow_enable(uint8 chip_id, tbl_id_t tbl_id)
+{
+    drv_tbl_shadow_t* p_shadow = NULL;
+    tables_t* tbl_ptr = NULL;
+    uint32 valid_words;
+    int32 ret;
+
+    DRV_CHIP_ID_VALID_CHECK(chip_id);
+    DRV_TBL_ID_VALID_CHECK(tbl_id);
+
+    tbl_ptr = DRV_TBL_GET_INFOPTR(tbl_id);
+
+    /* counters/status are updated by the chip, tcam reads back as X/Y */
+    if ((DS_POLICER == tbl_id) || (DS_FORWARDING_STATS == tbl_id)
+        || (INVALID_MASK_OFFSET != tbl_ptr->hw_mask_base)
+        || (0 == tbl_ptr->max_index_num) || (0 == tbl_ptr->entry_size))
+    {
+        return DRV_E_INVALID_TBL;
+    }
+
+    if (NULL == drv_tbl_shadow_mutex[chip_id])
+    {
+        ret = kal_mutex_create(&drv_tbl_shadow_mutex[chip_id]);
+        if (ret || !drv_tbl_shadow_mutex[chip_id])
+        {
+            return DRV_E_FAIL_CREATE_MUTEX;
+        }
+    }
+
+    if (drv_tbl_shadow[chip_id][tbl_id])
+    {
+        return DRV_E_NONE;
+    }
+
+    p_shadow = mem_malloc(MEM_SYSTEM_MODULE, sizeof(drv_tbl_shadow_t));
+    if (NULL == p_shadow)
+    {
+        return DRV_E_NO_MEMORY;
+    }
+    kal_memset(p_shadow, 0, sizeof(drv_tbl_shadow_t));
+
+    p_shadow->entry_words = tbl_ptr->entry_size >> 2;
+    p_shadow->max_index = tbl_ptr->max_index_num;
+    valid_words = (p_shadow->max_index + 31) >> 5;
+
+    p_shadow->p_data = mem_malloc(MEM_SYSTEM_MODULE, p_shadow->max_index * p_shadow->entry_words * 4);
+    p_shadow->p_valid = mem_malloc(MEM_SYSTEM_MODULE, valid_words * 4);
+    if ((NULL == p_shadow->p_data) || (NULL == p_shadow->p_valid))
+    {
+        if (p_shadow->p_data)
+        {
+            mem_free(p_shadow->p_data);
+        }
+        if (p_shadow->p_valid)
+        {
+            mem_free(p_shadow->p_valid);
+        }
+        mem_free(p_shadow);
+        return DRV_E_NO_MEMORY;
+    }
+    kal_memset(p_shadow->p_valid, 0, valid_words * 4);
+
+    DRV_TBL_SHADOW_LOCK(chip_id);
+    drv_tbl_shadow[chip_id][tbl_id] = p_shadow;
+    DRV_TBL_SHADOW_UNLOCK(chip_id);
+
+    return DRV_E_NONE;
+}
+
+/**
+ @brief Drop the software copy of a table, accesses go to the chip again
+*/
+int32
+drv_tbl_shadow_disable(uint8 chip_id, tbl_id_t tbl_id)
+{
+    drv_tbl_shadow_t* p_shadow = NULL;
+
+    DRV_CHIP_ID_VALID_CHECK(chip_id);
+    DRV_TBL_ID_VALID_CHECK(tbl_id);
+
+    if (NULL == drv_tbl_shadow[chip_id][tbl_id])
+    {
+        return DRV_E_NONE;
+    }
+
+    DRV_TBL_SHADOW_LOCK(chip_id);
+    p_shadow = drv_tbl_shadow[chip_id][tbl_id];
+    drv_tbl_shadow[chip_id][tbl_id] = NULL;
+    DRV_TBL_SHADOW_UNLOCK(chip_id);
+
+    if (p_shadow)
+    {
+        mem_free(p_shadow->p_data);
+        mem_free(p_shadow->p_valid);
+        mem_free(p_shadow);
+    }
+
+    return DRV_E_NONE;
+}
+
+/**
+ @brief Compare every cached entry of a shadowed table with the chip
+
+ Mismatching entries are dumped and dropped from the shadow, so the next
+ access reloads them.
+*/
+int32
+drv_tbl_shadow_check(uint8 chip_id, tbl_id_t tbl_id, uint32* p_mismatch)
+{
+    drv_tbl_shadow_t* p_shadow = NULL;
+    uint32 data_entry[MAX_ENTRY_WORD] = {0};
+    uint32* p_entry;
+    uint32 index;
+    uint32 i;
+    int32 ret = DRV_E_NONE;
+
+    DRV_CHIP_ID_VALID_CHECK(chip_id);
+    DRV_TBL_ID_VALID_CHECK(tbl_id);
+    DRV_PTR_VALID_CHECK(p_mismatch);
+
+    *p_mismatch = 0;
+    if (NULL == drv_tbl_shadow[chip_id][tbl_id])
+    {
+        return DRV_E_INVALID_TBL;
+    }
+
+    DRV_TBL_SHADOW_LOCK(chip_id);
+    p_shadow = drv_tbl_shadow[chip_id][tbl_id];
+
+    for (index = 0; p_shadow && (index < p_shadow->max_index); index++)
+    {
+        if (!DRV_TBL_SHADOW_IS_VALID(p_shadow, index) || !drv_io_api[chip_id].drv_sram_tbl_read)
+        {
+            continue;
+        }
+
+        ret = drv_io_api[chip_id].drv_sram_tbl_read(chip_id, tbl_id, index, data_entry);
+        if (ret < DRV_E_NONE)
+        {
+            break;
+        }
+
+        p_entry = DRV_TBL_SHADOW_ENTRY(p_shadow, index);
+        if (0 == kal_memcmp(p_entry, data_entry, p_shadow->entry_words * 4))
+        {
+            continue;
+        }
+
+        DRV_DBG_INFO("\nchip %d table %d index %d shadow/hardware mismatch:\n", chip_id, tbl_id, index);
+        for (i = 0; i < p_shadow->entry_words; i++)
+        {
+            DRV_DBG_INFO("  word %d: 0x%.8x 0x%.8x\n", i, p_entry[i], data_entry[i]);
+        }
+
+        DRV_TBL_SHADOW_CLEAR_VALID(p_shadow, index);
+        (*p_mismatch)++;
+    }
+
+    if (p_shadow)
+    {
+        DRV_DBG_INFO("\nchip %d table %d shadow: hit %u, miss %u, mismatch %u\n",
+                     chip_id, tbl_id, p_shadow->hit_count, p_shadow->miss_count, *p_mismatch);
+    }
+
+    DRV_TBL_SHADOW_UNLOCK(chip_id);
+
+    return ret;
+}
+
 
 /**
  @brief The function is the table I/O control API
@@ -65,6 +396,27 @@ drv_tbl_ioctl(uint8 chip_id, int32 index, uint32 cmd, void* val)
 
         tbl_ptr = DRV_TBL_GET_INFOPTR(tbl_id);
 
+        if (drv_tbl_shadow[chip_id][tbl_id])
+        {
+            drv_tbl_shadow_t* p_shadow = NULL;
+            int32 ret = DRV_E_NONE;
+            bool shadowed = FALSE;
+
+            DRV_TBL_SHADOW_LOCK(chip_id);
+            p_shadow = drv_tbl_shadow[chip_id][tbl_id];
+            if (p_shadow)
+            {
+                shadowed = TRUE;
+                ret = _drv_tbl_shadow_ioctl(chip_id, p_shadow, index, action, tbl_id, field_id, val);
+            }
+            DRV_TBL_SHADOW_UNLOCK(chip_id);
+
+            if (shadowed)
+            {
+                return ret;
+            }
+        }
+
         /* operating all the entry */
         if (DRV_ENTRY_FLAG == field_id)
         {
@@ -344,6 +696,8 @@ drv_hash_key_ioctl(uint8 chip_id,
                  return DRV_E_INVALID_PARAM;
             }
 
+            _drv_tbl_shadow_invalidate(chip_id, tbl_id, tbl_idx);
+
             /* process parity error */
             data_base = DRV_TBL_GET_INFO(tbl_id).hw_data_base;
             entry_size = DRV_TBL_ENTRY_SIZE(tbl_id);
@@ -365,6 +719,8 @@ drv_hash_key_ioctl(uint8 chip_id,
             {
                 return DRV_E_INVALID_PARAM;
             }
+
+            _drv_tbl_shadow_invalidate(chip_id, tbl_id, tbl_idx);
             break;
         /* Delete according to the appointed index */
         case HASH_OP_TP_DEL_ENTRY_BY_INDEX:
@@ -381,6 +737,8 @@ drv_hash_key_ioctl(uint8 chip_id,
                  return DRV_E_INVALID_PARAM;
             }
 
+            _drv_tbl_shadow_invalidate(chip_id, tbl_id, tbl_idx);
+
             /* process parity error */
             data_base = DRV_TBL_GET_INFO(tbl_id).hw_data_base;
             entry_size = DRV_TBL_ENTRY_SIZE(tbl_id);
@@ -223,7 +223,6 @@ struct bucket_info_s
     kal_mem_pool_t *mem_pool;
 #else
     mem_cache_t *cache;
-    kal_mutex_t *cache_mutex;
 #endif
 #endif
 };
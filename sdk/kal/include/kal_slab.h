@@ -49,6 +49,9 @@ struct mem_cache
     kal_slab_list_pointer_t free_slabs;
     int32 obj_size;
     int32 slab_size;
+    kal_mutex_t *mutex;     /* protects the slab lists */
+    int32 id;               /* index of the per thread magazine, -1 if none */
+    int32 mag_size;         /* objects a thread may keep, 0 disables the magazine */
 };
 
 static INLINE mem_slab_t *vm_to_slab(void *p)
@@ -847,13 +847,6 @@ mem_mgr_init (void)
             return -1;
         }
 
-        ret = kal_mutex_create(&(bucket_info[index].cache_mutex));
-
-        if ((ret != 0) || (NULL == bucket_info[index].cache_mutex))
-        {
-            return -1;
-        }
-
         bucket_info[index].used_count = 0;
         index++;
     }
@@ -873,12 +866,6 @@ mem_mgr_deinit (void)
             mem_cache_destroy(bucket_info[index].cache);
             bucket_info[index].cache = NULL;
         }
-
-        if (bucket_info[index].cache_mutex)
-        {
-            kal_mutex_destroy(bucket_info[index].cache_mutex);
-            bucket_info[index].cache_mutex = NULL;
-        }
         index++;
     }
 
@@ -928,15 +915,13 @@ mem_mgr_malloc (uint32 size, enum mem_mgr_type mtype, char *filename, uint16 lin
         return bufptr;
     }
 
-    MEMMGR_LOCK(bucket_info[index].cache_mutex);
+    /* the cache is thread safe and serves most requests from a per thread magazine */
     mhdr = (struct mem_block_header *)mem_cache_alloc(bucket_info[index].cache);
     if (!mhdr)
     {
-        MEMMGR_UNLOCK(bucket_info[index].cache_mutex);
         return NULL;
     }
-    bucket_info[index].used_count++;
-    MEMMGR_UNLOCK(bucket_info[index].cache_mutex);
+    __sync_fetch_and_add(&bucket_info[index].used_count, 1);
 
 
     mhdr->bukt = index;
@@ -996,10 +981,8 @@ mem_mgr_free (void *ptr, char *file, int line)
     }
 #endif
 
-    MEMMGR_LOCK(bucket_info[index].cache_mutex);
     mem_cache_free(mhdr);
-    bucket_info[index].used_count--;
-    MEMMGR_UNLOCK(bucket_info[index].cache_mutex);
+    __sync_fetch_and_sub(&bucket_info[index].used_count, 1);
 
 }
 
@@ -2,6 +2,7 @@
 #include <sys/mman.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <pthread.h>
 
 #include "kal.h"
 #include "kal_slab.h"
@@ -14,9 +15,45 @@
 
 #define M_ASSERT(expr)
 
+/*
+ * Each thread keeps a magazine of free objects per cache, so that most
+ * allocs and frees touch neither the slab lists nor the cache mutex. An
+ * empty magazine is refilled, and a full one flushed, by half of its size
+ * at a time under the mutex. Objects a thread left unused for a whole trim
+ * period go back to the slabs, but a thread only trims its own magazines,
+ * from its own allocs and frees: one that stops calling keeps what its
+ * magazines hold, up to mag_size objects (64, and no more than a slab's
+ * worth of bytes) per cache, until it exits or the cache is destroyed.
+ *
+ * Lock order is tls_mutex, then a cache mutex, then internal_cache.mutex.
+ */
+#define M_MAG_SIZE_MAX  64          /* objects per magazine */
+#define M_MAG_SIZE_MIN  4           /* smaller magazines are disabled */
+#define M_MAG_TRIM_OPS  4096        /* allocs and frees of a thread between two trims */
+#define M_CACHE_MAX     32          /* caches with a magazine */
+
+typedef struct mem_magazine
+{
+    int32 count;
+    int32 low;                      /* lowest count since the last trim */
+    int32 ops;
+    void *objs[M_MAG_SIZE_MAX];
+} mem_magazine_t;
+
+typedef struct mem_cache_tls
+{
+    struct mem_cache_tls *next;     /* all threads, for mem_cache_destroy() */
+    mem_magazine_t mag[M_CACHE_MAX];
+} mem_cache_tls_t;
 
 static mem_cache_t internal_cache;
 
+static kal_mutex_t *tls_mutex;      /* protects cache_table and tls_list */
+static mem_cache_t *cache_table[M_CACHE_MAX];
+static mem_cache_tls_t *tls_list;
+static pthread_key_t tls_key;
+static __thread mem_cache_tls_t *cur_tls;
+
 static void kal_slab_list_pointer_delete(kal_slab_list_pointer_t* p_list, kal_slab_list_pointer_node_t* p_node)
 {
     if (p_node->p_next != NULL)
@@ -123,6 +160,147 @@ static void free_slab(mem_cache_t *cache, mem_slab_t *slab)
         mem_cache_free(/*&internal_cache, */slab);
 }
 
+/* take one object from the slabs, the caller holds cache->mutex */
+static void *slab_alloc_obj(mem_cache_t *cache)
+{
+    mem_slab_t *slab;
+    void *p;
+
+    if (kal_slab_list_pointer_empty(&cache->free_slabs))
+        alloc_slab(cache);
+
+    if (kal_slab_list_pointer_empty(&cache->free_slabs))
+        return NULL;
+
+    slab = _kal_slab_container_of(kal_slab_list_pointer_head(&cache->free_slabs), mem_slab_t, list_node);
+    if (slab->free_list) {
+        p = slab->free_list;
+        slab->free_list = *(void **)p;
+    }
+    else {
+        p = slab->left;
+        *(mem_slab_t **)p = slab;
+        p += sizeof(mem_slab_t *);
+        slab->left += M_ALIGN(cache->obj_size + sizeof(mem_slab_t *));
+    }
+
+    slab->used++;
+    if (slab->used == slab->limit) {
+        kal_slab_list_pointer_delete(&cache->free_slabs, &slab->list_node);
+        kal_slab_list_pointer_insert_tail(&cache->full_slabs, &slab->list_node);
+    }
+
+    return p;
+}
+
+/* give one object back to its slab, the caller holds cache->mutex */
+static void slab_free_obj(mem_cache_t *cache, void *p)
+{
+    mem_slab_t *slab;
+
+    slab = vm_to_slab(p);
+    M_ASSERT(slab);
+
+    *(void **)p = slab->free_list;
+    slab->free_list = p;
+    slab->used--;
+
+    if (slab->used == slab->limit - 1) {
+        kal_slab_list_pointer_delete(&cache->full_slabs, &slab->list_node);
+        kal_slab_list_pointer_insert_head(&cache->free_slabs, &slab->list_node);
+    }
+
+    if (slab->used == 0) {
+        kal_slab_list_pointer_delete(&cache->free_slabs, &slab->list_node);
+        free_slab(cache, slab);
+    }
+}
+
+static void mag_refill(mem_cache_t *cache, mem_magazine_t *mag)
+{
+    void *p;
+
+    kal_mutex_lock(cache->mutex);
+    while (mag->count < cache->mag_size / 2) {
+        p = slab_alloc_obj(cache);
+        if (!p)
+            break;
+        mag->objs[mag->count++] = p;
+    }
+    kal_mutex_unlock(cache->mutex);
+}
+
+static void mag_flush(mem_cache_t *cache, mem_magazine_t *mag, int32 num)
+{
+    kal_mutex_lock(cache->mutex);
+    while (num-- > 0 && mag->count)
+        slab_free_obj(cache, mag->objs[--mag->count]);
+    kal_mutex_unlock(cache->mutex);
+
+    if (mag->low > mag->count)
+        mag->low = mag->count;
+}
+
+/* only the owner thread trims its magazine, from its own alloc and free */
+static INLINE void mag_trim(mem_cache_t *cache, mem_magazine_t *mag)
+{
+    if (++mag->ops < M_MAG_TRIM_OPS)
+        return;
+
+    /* the lowest objects were not needed during the whole period, return half of them */
+    if (mag->low > 1)
+        mag_flush(cache, mag, mag->low / 2);
+    mag->ops = 0;
+    mag->low = mag->count;
+}
+
+/* thread exit, give the magazines back to the slabs */
+static void tls_destroy(void *arg)
+{
+    mem_cache_tls_t *tls = arg;
+    mem_cache_tls_t **pp;
+    int32 id;
+
+    kal_mutex_lock(tls_mutex);
+    for (pp = &tls_list; *pp; pp = &(*pp)->next) {
+        if (*pp == tls) {
+            *pp = tls->next;
+            break;
+        }
+    }
+    for (id = 0; id < M_CACHE_MAX; id++) {
+        if (cache_table[id] && tls->mag[id].count)
+            mag_flush(cache_table[id], &tls->mag[id], tls->mag[id].count);
+    }
+    kal_mutex_unlock(tls_mutex);
+
+    cur_tls = NULL;
+    free(tls);
+}
+
+/* magazine of the calling thread, NULL if the cache has none or we are out of memory */
+static INLINE mem_magazine_t *mag_get(mem_cache_t *cache)
+{
+    mem_cache_tls_t *tls = cur_tls;
+
+    if (!cache->mag_size)
+        return NULL;
+
+    if (!tls) {
+        tls = calloc(1, sizeof(mem_cache_tls_t));
+        if (!tls)
+            return NULL;
+        pthread_setspecific(tls_key, tls);
+        kal_mutex_lock(tls_mutex);
+        tls->next = tls_list;
+        tls_list = tls;
+        kal_mutex_unlock(tls_mutex);
+        cur_tls = tls;
+    }
+
+    return &tls->mag[cache->id];
+}
+
 void mem_cache_init()
 {
     union __uu {
@@ -135,11 +313,17 @@ void mem_cache_init()
     kal_slab_list_pointer_init(&internal_cache.free_slabs);
     internal_cache.obj_size = sizeof(union __uu);
     internal_cache.slab_size = M_SLAB_SIZE;
+    internal_cache.id = -1;
+    internal_cache.mag_size = 0;
+    kal_mutex_create(&internal_cache.mutex);
+    kal_mutex_create(&tls_mutex);
+    pthread_key_create(&tls_key, tls_destroy);
 }
 
 mem_cache_t *mem_cache_create(int32 obj_size)
 {
     mem_cache_t *cache;
+    int32 id;
 
     cache = mem_cache_alloc(&internal_cache);
     if (cache) {
@@ -151,73 +335,102 @@ mem_cache_t *mem_cache_create(int32 obj_size)
             cache->slab_size = M_SLAB_SIZE;
         else
             cache->slab_size = obj_size + sizeof(mem_slab_t *);
+
+        if (kal_mutex_create(&cache->mutex)) {
+            mem_cache_free(cache);
+            return NULL;
+        }
+
+        /* a magazine holds at most one slab worth of objects, big objects get none */
+        cache->id = -1;
+        cache->mag_size = M_SLAB_SIZE / obj_size;
+        if (cache->mag_size > M_MAG_SIZE_MAX)
+            cache->mag_size = M_MAG_SIZE_MAX;
+
+        kal_mutex_lock(tls_mutex);
+        for (id = 0; cache->mag_size >= M_MAG_SIZE_MIN && id < M_CACHE_MAX; id++) {
+            if (!cache_table[id]) {
+                cache_table[id] = cache;
+                cache->id = id;
+                break;
+            }
+        }
+        kal_mutex_unlock(tls_mutex);
+        if (cache->id < 0)
+            cache->mag_size = 0;
     }
 
     return cache;
 }
 
+/* other threads must be done with the cache, their magazines are drained here */
 void mem_cache_destroy(mem_cache_t *cache)
 {
+    mem_cache_tls_t *tls;
+
+    if (cache->id >= 0) {
+        kal_mutex_lock(tls_mutex);
+        for (tls = tls_list; tls; tls = tls->next) {
+            if (tls->mag[cache->id].count)
+                mag_flush(cache, &tls->mag[cache->id], tls->mag[cache->id].count);
+            kal_memset(&tls->mag[cache->id], 0, sizeof(mem_magazine_t));
+        }
+        cache_table[cache->id] = NULL;
+        kal_mutex_unlock(tls_mutex);
+    }
+
     M_ASSERT(kal_slab_list_pointer_empty(&cache->full_slabs));
     M_ASSERT(kal_slab_list_pointer_empty(&cache->free_slabs));
+    kal_mutex_destroy(cache->mutex);
     mem_cache_free(/*&internal_cache, */cache);
 }
 
 void *mem_cache_alloc(mem_cache_t *cache)
 {
-    mem_slab_t *slab;
+    mem_magazine_t *mag;
     void *p;
 
-    if (kal_slab_list_pointer_empty(&cache->free_slabs))
-        alloc_slab(cache);
-
-    if (kal_slab_list_pointer_empty(&cache->free_slabs))
-        return NULL;
-
-    slab = _kal_slab_container_of(kal_slab_list_pointer_head(&cache->free_slabs), mem_slab_t, list_node);
-    if (slab->free_list) {
-        p = slab->free_list;
-        slab->free_list = *(void **)p;
-    }
-    else {
-        p = slab->left;
-        *(mem_slab_t **)p = slab;
-        p += sizeof(mem_slab_t *);
-        slab->left += M_ALIGN(cache->obj_size + sizeof(mem_slab_t *));
+    mag = mag_get(cache);
+    if (mag) {
+        if (!mag->count)
+            mag_refill(cache, mag);
+        if (!mag->count)
+            return NULL;
+
+        p = mag->objs[--mag->count];
+        if (mag->low > mag->count)
+            mag->low = mag->count;
+        mag_trim(cache, mag);
+        return p;
     }
 
-    slab->used++;
-    if (slab->used == slab->limit) {
-        kal_slab_list_pointer_delete(&cache->free_slabs, &slab->list_node);
-        kal_slab_list_pointer_insert_tail(&cache->full_slabs, &slab->list_node);
-    }
+    kal_mutex_lock(cache->mutex);
+    p = slab_alloc_obj(cache);
+    kal_mutex_unlock(cache->mutex);
 
     return p;
 }
 
 void mem_cache_free(/*mem_cache_t *cache, */void *p)
 {
-    mem_slab_t *slab;
+    mem_magazine_t *mag;
     mem_cache_t *cache;
 
 
-    slab = vm_to_slab(p);
-    M_ASSERT(slab);
-    cache = slab->cache;
-
-    *(void **)p = slab->free_list;
-    slab->free_list = p;
-    slab->used--;
+    cache = vm_to_slab(p)->cache;
 
-    if (slab->used == slab->limit - 1) {
-        kal_slab_list_pointer_delete(&cache->full_slabs, &slab->list_node);
-        kal_slab_list_pointer_insert_head(&cache->free_slabs, &slab->list_node);
+    mag = mag_get(cache);
+    if (mag) {
+        if (mag->count == cache->mag_size)
+            mag_flush(cache, mag, cache->mag_size / 2);
+        mag->objs[mag->count++] = p;
+        mag_trim(cache, mag);
+        return;
     }
 
-    if (slab->used == 0) {
-        kal_slab_list_pointer_delete(&cache->free_slabs, &slab->list_node);
-        free_slab(cache, slab);
-    }
+    kal_mutex_lock(cache->mutex);
+    slab_free_obj(cache, p);
+    kal_mutex_unlock(cache->mutex);
 }
 
 
@@ -0,0 +1,320 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file
+ * @brief Benchmark of the flow priority db in adpt_flow_db.c: [count] entries, 50000 by
+ *        default, are added with distinct priorities in random order to the mac index,
+ *        and with 16 priorities in entry id order to the ipv4 index. Each add looks up
+ *        the "after" entry as a flow add does. Half the entries are then deleted at
+ *        random and half of those added back. After every phase the "after" entry of
+ *        every entry must match the tcam order, priority descending and then insertion
+ *        order, rebuilt from scratch.
+ *
+ *        bench_adpt_flow_db [count]
+ */
+
+/****************************************************************************
+ *
+ * Header Files
+ *
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ofp_api.h"
+
+#include "adpt.h"
+#include "adpt_flow.h"
+#include "adpt_flow_priv.h"
+
+/****************************************************************************
+ *
+ * Defines and Macros
+ *
+ ****************************************************************************/
+#define BENCH_ENTRIES           50000
+#define BENCH_FEW_PRIORITIES    16
+
+/****************************************************************************
+ *
+ * Global and Declaration
+ *
+ ****************************************************************************/
+adpt_flow_master_t* g_p_adpt_flow_master;
+uint8_ofp g_current_profile;
+
+/* entry ids are 1 based and given in insertion order, so within a priority
+   the tcam order is the entry id order */
+struct bench_db_s
+{
+    ofp_flow_type_t flow_type;
+    uint32_ofp max_entry;       /**< entry ids used so far */
+    uint32_ofp max_priority;
+    uint32_ofp* priority;       /**< by entry id */
+    bool* present;              /**< by entry id */
+    uint32_ofp* bucket;         /**< first entry id of a priority, by priority */
+    uint32_ofp* bucket_next;    /**< next entry id of the same priority, by entry id */
+};
+typedef struct bench_db_s bench_db_t;
+
+static uint32_ofp g_seed = 1;
+
+/****************************************************************************
+ *
+ * Function
+ *
+ ****************************************************************************/
+static uint32_ofp
+bench_rand(void)
+{
+    g_seed = g_seed * 1103515245 + 12345;
+    return (g_seed >> 16) | (g_seed << 16);
+}
+
+static uint64_ofp
+bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_ofp)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int32_ofp
+bench_db_alloc(bench_db_t* p_db, ofp_flow_type_t flow_type, uint32_ofp count, uint32_ofp max_priority)
+{
+    memset(p_db, 0, sizeof(bench_db_t));
+    p_db->flow_type    = flow_type;
+    p_db->max_priority = max_priority;
+    p_db->priority     = calloc(2 * count + 1, sizeof(uint32_ofp));
+    p_db->present      = calloc(2 * count + 1, sizeof(bool));
+    p_db->bucket_next  = calloc(2 * count + 1, sizeof(uint32_ofp));
+    p_db->bucket       = calloc(max_priority + 1, sizeof(uint32_ofp));
+
+    return (p_db->priority && p_db->present && p_db->bucket_next && p_db->bucket)
+           ? OFP_ERR_SUCCESS : OFP_ERR_NO_MEMORY;
+}
+
+static void
+bench_db_free(bench_db_t* p_db)
+{
+    free(p_db->priority);
+    free(p_db->present);
+    free(p_db->bucket_next);
+    free(p_db->bucket);
+}
+
+static int32_ofp
+bench_db_add(bench_db_t* p_db, uint32_ofp priority)
+{
+    uint32_ofp entry_id = ++p_db->max_entry;
+    uint32_ofp after_entry_id;
+    int32_ofp rc;
+
+    p_db->priority[entry_id] = priority;
+    p_db->present[entry_id] = TRUE;
+
+    rc = adpt_flowdb_add_flow_priority_entry_id(p_db->flow_type, priority, entry_id);
+    if (rc)
+    {
+        return rc;
+    }
+
+    return adpt_flowdb_get_prev_entry_id(p_db->flow_type, priority, entry_id, &after_entry_id);
+}
+
+static int32_ofp
+bench_db_del(bench_db_t* p_db, uint32_ofp entry_id)
+{
+    p_db->present[entry_id] = FALSE;
+
+    return adpt_flowdb_del_flow_priority_entry_id(p_db->flow_type, p_db->priority[entry_id], entry_id);
+}
+
+/* walk the present entries in tcam order, every one must be after the one before */
+static int32_ofp
+bench_db_check(bench_db_t* p_db, const char* phase)
+{
+    uint32_ofp after_entry_id, expect = 0;
+    uint32_ofp entry_id, priority;
+    int32_ofp rc;
+
+    memset(p_db->bucket, 0, (p_db->max_priority + 1) * sizeof(uint32_ofp));
+    for (entry_id = p_db->max_entry; entry_id > 0; entry_id--)
+    {
+        if (p_db->present[entry_id])
+        {
+            p_db->bucket_next[entry_id] = p_db->bucket[p_db->priority[entry_id]];
+            p_db->bucket[p_db->priority[entry_id]] = entry_id;
+        }
+    }
+
+    for (priority = p_db->max_priority + 1; priority-- > 0; )
+    {
+        for (entry_id = p_db->bucket[priority]; entry_id; entry_id = p_db->bucket_next[entry_id])
+        {
+            rc = adpt_flowdb_get_prev_entry_id(p_db->flow_type, priority, entry_id, &after_entry_id);
+            if (rc || (after_entry_id != expect))
+            {
+                printf("%s: entry %u priority %u is after %u, expected %u, rc %d\n",
+                       phase, entry_id, priority, after_entry_id, expect, rc);
+                return OFP_ERR_FAIL;
+            }
+            expect = entry_id;
+        }
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
+/* add count entries, delete half of them at random, add back a quarter */
+static int32_ofp
+bench_db_run(bench_db_t* p_db, uint32_ofp count, bool distinct)
+{
+    uint32_ofp* order;
+    uint64_ofp start, add_nsec, del_nsec, readd_nsec;
+    uint32_ofp i, j, tmp;
+
+    order = malloc((count + 1) * sizeof(uint32_ofp));
+    if (!order)
+    {
+        return OFP_ERR_NO_MEMORY;
+    }
+
+    /* distinct priorities are a random permutation of [0, count) */
+    for (i = 0; i < count; i++)
+    {
+        order[i] = i;
+    }
+    for (i = count - 1; distinct && (i > 0); i--)
+    {
+        j = bench_rand() % (i + 1);
+        tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    start = bench_now();
+    for (i = 0; i < count; i++)
+    {
+        if (bench_db_add(p_db, distinct ? order[i] : bench_rand() % BENCH_FEW_PRIORITIES))
+        {
+            printf("add of entry %u failed\n", i + 1);
+            return OFP_ERR_FAIL;
+        }
+    }
+    add_nsec = bench_now() - start;
+    if (bench_db_check(p_db, "add"))
+    {
+        return OFP_ERR_FAIL;
+    }
+
+    /* a random half of the entry ids */
+    for (i = 0; i < count; i++)
+    {
+        order[i] = i + 1;
+    }
+    for (i = 0; i < count / 2; i++)
+    {
+        j = i + bench_rand() % (count - i);
+        tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    start = bench_now();
+    for (i = 0; i < count / 2; i++)
+    {
+        bench_db_del(p_db, order[i]);
+    }
+    del_nsec = bench_now() - start;
+    if (bench_db_check(p_db, "delete"))
+    {
+        return OFP_ERR_FAIL;
+    }
+
+    /* deleted priorities come back under new entry ids */
+    start = bench_now();
+    for (i = 0; i < count / 4; i++)
+    {
+        if (bench_db_add(p_db, p_db->priority[order[i]]))
+        {
+            printf("re-add of entry %u failed\n", order[i]);
+            return OFP_ERR_FAIL;
+        }
+    }
+    readd_nsec = bench_now() - start;
+    if (bench_db_check(p_db, "re-add"))
+    {
+        return OFP_ERR_FAIL;
+    }
+
+    printf("%-10s %8u %10.1f %10.1f %10.1f\n", distinct ? "distinct" : "16", count,
+           (double)add_nsec / count, (double)del_nsec / (count / 2), (double)readd_nsec / (count / 4));
+    free(order);
+
+    return OFP_ERR_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    bench_db_t db;
+    int count = BENCH_ENTRIES;
+
+    if (argc > 1)
+    {
+        count = atoi(argv[1]);
+    }
+    if (count < 4)
+    {
+        fprintf(stderr, "count must be at least 4\n");
+        return 1;
+    }
+
+    g_p_adpt_flow_master = calloc(1, sizeof(adpt_flow_master_t));
+    if (!g_p_adpt_flow_master || adpt_flow_db_init())
+    {
+        fprintf(stderr, "flow db init failed\n");
+        return 1;
+    }
+
+    printf("ns per entry, an add includes the after entry lookup\n");
+    printf("%-10s %8s %10s %10s %10s\n", "priorities", "entries", "add", "delete", "re-add");
+
+    if (bench_db_alloc(&db, FLOW_TYPE_MAC, count, count) || bench_db_run(&db, count, TRUE))
+    {
+        fprintf(stderr, "distinct priority benchmark failed\n");
+        return 1;
+    }
+    bench_db_free(&db);
+
+    if (bench_db_alloc(&db, FLOW_TYPE_IPV4, count, BENCH_FEW_PRIORITIES)
+        || bench_db_run(&db, count, FALSE))
+    {
+        fprintf(stderr, "repeated priority benchmark failed\n");
+        return 1;
+    }
+    bench_db_free(&db);
+
+    printf("mac index %u entries, %u levels; ipv4 index %u entries, %u levels\n",
+           ADPT_FLOW_MAC_INDEX->count, ADPT_FLOW_MAC_INDEX->level,
+           ADPT_FLOW_IPV4_INDEX->count, ADPT_FLOW_IPV4_INDEX->level);
+    adpt_flow_db_deinit();
+
+    return 0;
+}
@@ -0,0 +1,438 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file
+ * @brief Stress test of the adapter lock domains: flow installs, port queries and
+ *        packet-outs of the vswitchd main loop against the idle timeout sweep and the
+ *        LCM link notify. The work done under a lock is modelled as a sleep.
+ *
+ *        bench_adpt_lock [global|domains|nested] [seconds]
+ *
+ *        "global" takes one mutex for the whole main loop iteration and for the sweep,
+ *        as pg_mutex did. "domains" takes adpt_lock() the way the ofp_* API does, after
+ *        the checks of "nested": an ofp_* call made from a callback of another one
+ *        nests its domains, and a write take of a domain held for read fails without
+ *        leaving any domain of the set taken.
+ */
+
+/****************************************************************************
+ *
+ * Header Files
+ *
+ ****************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/prctl.h>
+
+#include "ofp_api.h"
+#include "adpt_lock.h"
+
+/****************************************************************************
+ *
+ * Defines and Macros
+ *
+ ****************************************************************************/
+#define BENCH_LAT_MAX           400000
+
+/****************************************************************************
+ *
+ * Global and Declaration
+ *
+ ****************************************************************************/
+struct bench_lat_s
+{
+    const char* name;
+    uint64_ofp nsec[BENCH_LAT_MAX];
+    uint32_ofp count;
+};
+typedef struct bench_lat_s bench_lat_t;
+
+static bench_lat_t g_lat_install = {"flow install"};
+static bench_lat_t g_lat_port = {"port query"};
+static bench_lat_t g_lat_pkt_out = {"packet-out"};
+static bench_lat_t g_lat_link = {"link notify"};
+static bench_lat_t g_lat_sweep = {"sweep"};
+
+static pthread_mutex_t g_global_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool g_use_domains;
+static volatile bool g_stop;
+
+/****************************************************************************
+ *
+ * Function
+ *
+ ****************************************************************************/
+
+static uint64_ofp
+bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_ofp)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void
+bench_work(uint32_ofp usec)
+{
+    struct timespec ts = {0, usec * 1000};
+
+    nanosleep(&ts, NULL);
+}
+
+static void
+bench_lat_add(bench_lat_t* p_lat, uint64_ofp nsec)
+{
+    if (p_lat->count < BENCH_LAT_MAX)
+    {
+        p_lat->nsec[p_lat->count++] = nsec;
+    }
+}
+
+static int
+bench_lat_cmp(const void* p_a, const void* p_b)
+{
+    uint64_ofp a = *(const uint64_ofp*)p_a;
+    uint64_ofp b = *(const uint64_ofp*)p_b;
+
+    return a < b ? -1 : a > b;
+}
+
+static void
+bench_lat_show(bench_lat_t* p_lat)
+{
+    uint32_ofp n = p_lat->count;
+
+    if (0 == n)
+    {
+        return;
+    }
+
+    qsort(p_lat->nsec, n, sizeof(uint64_ofp), bench_lat_cmp);
+    printf("  %-14s n=%6u p50=%8.1f p99=%8.1f p99.9=%8.1f max=%8.1f us\n", p_lat->name, n,
+           p_lat->nsec[n / 2] / 1e3, p_lat->nsec[n * 99 / 100] / 1e3,
+           p_lat->nsec[n * 999 / 1000] / 1e3, p_lat->nsec[n - 1] / 1e3);
+}
+
+/**
+ * One adapter call from the main loop, with the global mutex the caller already holds it
+ */
+static void
+bench_adapter_call(uint32_ofp locks, uint32_ofp usec, bench_lat_t* p_lat, uint64_ofp waited)
+{
+    uint64_ofp start = bench_now();
+
+    if (g_use_domains)
+    {
+        adpt_lock(locks);
+        bench_work(usec);
+        adpt_unlock(locks);
+    }
+    else
+    {
+        bench_work(usec);
+    }
+    bench_lat_add(p_lat, bench_now() - start + waited);
+}
+
+/**
+ * vswitchd main loop: 4 flow installs, 8 port queries and a packet-out per iteration,
+ * then ofproto bookkeeping and poll
+ */
+static void*
+bench_main_loop(void* arg)
+{
+    uint64_ofp waited;
+    uint32_ofp i;
+
+    while (!g_stop)
+    {
+        waited = bench_now();
+        if (!g_use_domains)
+        {
+            pthread_mutex_lock(&g_global_mutex);
+        }
+        waited = bench_now() - waited;
+
+        for (i = 0; i < 4; i++)
+        {
+            bench_adapter_call(ADPT_LOCK_FLOW_UPDATE, 20, &g_lat_install, i ? 0 : waited);
+        }
+        for (i = 0; i < 8; i++)
+        {
+            bench_adapter_call(ADPT_LOCK_RD(ADPT_LOCK_PORT), 2, &g_lat_port, i ? 0 : waited);
+        }
+        bench_adapter_call(ADPT_LOCK_RD(ADPT_LOCK_PORT), 3, &g_lat_pkt_out, waited);
+
+        bench_work(50);
+        if (!g_use_domains)
+        {
+            pthread_mutex_unlock(&g_global_mutex);
+        }
+        bench_work(200);
+    }
+
+    return NULL;
+}
+
+/**
+ * Idle timeout sweep every 10ms: collect under FLOW, read the counters under STATS,
+ * publish under FLOW
+ */
+static void*
+bench_sweep_loop(void* arg)
+{
+    uint64_ofp start;
+
+    while (!g_stop)
+    {
+        start = bench_now();
+        if (g_use_domains)
+        {
+            adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_WR(ADPT_LOCK_STATS));
+            bench_work(800);
+            adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_FLOW));
+            bench_work(3000);
+            adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_STATS));
+
+            adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_WR(ADPT_LOCK_STATS));
+            bench_work(300);
+            adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_FLOW) | ADPT_LOCK_WR(ADPT_LOCK_STATS));
+        }
+        else
+        {
+            pthread_mutex_lock(&g_global_mutex);
+            bench_work(800);
+            pthread_mutex_unlock(&g_global_mutex);
+            bench_work(3000);
+            pthread_mutex_lock(&g_global_mutex);
+            bench_work(300);
+            pthread_mutex_unlock(&g_global_mutex);
+        }
+        bench_lat_add(&g_lat_sweep, bench_now() - start);
+        bench_work(10000);
+    }
+
+    return NULL;
+}
+
+/**
+ * LCM link notify every 1ms
+ */
+static void*
+bench_lcm_loop(void* arg)
+{
+    uint64_ofp start;
+
+    while (!g_stop)
+    {
+        start = bench_now();
+        if (g_use_domains)
+        {
+            adpt_lock(ADPT_LOCK_WR(ADPT_LOCK_PORT));
+            bench_work(5);
+            adpt_unlock(ADPT_LOCK_WR(ADPT_LOCK_PORT));
+        }
+        else
+        {
+            pthread_mutex_lock(&g_global_mutex);
+            bench_work(5);
+            pthread_mutex_unlock(&g_global_mutex);
+        }
+        bench_lat_add(&g_lat_link, bench_now() - start);
+        bench_work(1000);
+    }
+
+    return NULL;
+}
+
+static void*
+bench_other_thread(void* arg)
+{
+    uint32_ofp locks = *(uint32_ofp*)arg;
+
+    if (OFP_ERR_SUCCESS == adpt_lock(locks))
+    {
+        adpt_unlock(locks);
+        return (void*)1;
+    }
+
+    return NULL;
+}
+
+/**
+ * Take locks from another thread, fails if that thread is still blocked after 1s
+ */
+static bool
+bench_other_thread_can_take(uint32_ofp locks)
+{
+    struct timespec deadline;
+    pthread_t thread;
+    void* taken = NULL;
+
+    pthread_create(&thread, NULL, bench_other_thread, &locks);
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += 1;
+    if (pthread_timedjoin_np(thread, &taken, &deadline))
+    {
+        /* the thread stays blocked, the process exits with the failure */
+        return false;
+    }
+
+    return NULL != taken;
+}
+
+#define BENCH_NESTED_CHECK(cond) \
+do { \
+    if (!(cond)) \
+    { \
+        printf("  nested: %s failed at line %d\n", #cond, __LINE__); \
+        return -1; \
+    } \
+} while (0)
+
+/**
+ * Nested ofp_* calls, as made from the callbacks of an outer ofp_* call
+ */
+static int
+bench_nested_check(void)
+{
+    uint32_ofp flow_rd = ADPT_LOCK_RD(ADPT_LOCK_FLOW) | ADPT_LOCK_RD(ADPT_LOCK_PORT);
+    uint32_ofp port_rd = ADPT_LOCK_RD(ADPT_LOCK_PORT);
+
+    /* a flow add looks the ports up and adds a flow again from a callback */
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS == adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS == adpt_lock(port_rd));
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS == adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    adpt_unlock(port_rd);
+    BENCH_NESTED_CHECK(!bench_other_thread_can_take(ADPT_LOCK_WR(ADPT_LOCK_FLOW)));
+    adpt_unlock(ADPT_LOCK_FLOW_UPDATE);
+    BENCH_NESTED_CHECK(bench_other_thread_can_take(ADPT_LOCK_PORT_UPDATE));
+
+    /* an upcall resolve holds flow and port for read, a flow add under it fails */
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS == adpt_lock(flow_rd));
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS != adpt_lock(ADPT_LOCK_FLOW_UPDATE));
+    BENCH_NESTED_CHECK(bench_other_thread_can_take(flow_rd | ADPT_LOCK_RD(ADPT_LOCK_TUNNEL)));
+    BENCH_NESTED_CHECK(bench_other_thread_can_take(ADPT_LOCK_WR(ADPT_LOCK_TUNNEL)));
+    adpt_unlock(flow_rd);
+    BENCH_NESTED_CHECK(bench_other_thread_can_take(ADPT_LOCK_PORT_UPDATE));
+
+    /* a port add under a port query takes flow for write, then fails on port:
+     * flow must be given back */
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS == adpt_lock(port_rd));
+    BENCH_NESTED_CHECK(OFP_ERR_SUCCESS != adpt_lock(ADPT_LOCK_PORT_UPDATE));
+    BENCH_NESTED_CHECK(bench_other_thread_can_take(ADPT_LOCK_WR(ADPT_LOCK_FLOW)));
+    adpt_unlock(port_rd);
+    BENCH_NESTED_CHECK(bench_other_thread_can_take(ADPT_LOCK_PORT_UPDATE));
+
+    return 0;
+}
+
+static void
+bench_lock_stats_show(void)
+{
+    adpt_lock_stats_t stats[2];
+    adpt_lock_stats_t* p_stats;
+    uint32_ofp lock, is_wr;
+
+    for (lock = 0; lock < ADPT_LOCK_MAX; lock++)
+    {
+        if (adpt_lock_get_stats(lock, &stats[0], &stats[1]))
+        {
+            continue;
+        }
+        for (is_wr = 0; is_wr < 2; is_wr++)
+        {
+            p_stats = &stats[is_wr];
+            if (0 == p_stats->count)
+            {
+                continue;
+            }
+            printf("  %-6s %s count=%llu contended=%llu wait avg=%.1f max=%.1f hold avg=%.1f max=%.1f us\n",
+                   adpt_lock_name(lock), is_wr ? "wr" : "rd",
+                   (unsigned long long)p_stats->count, (unsigned long long)p_stats->contended,
+                   p_stats->wait_nsec / 1e3 / p_stats->count, p_stats->wait_max_nsec / 1e3,
+                   p_stats->hold_nsec / 1e3 / p_stats->count, p_stats->hold_max_nsec / 1e3);
+        }
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    pthread_t main_thread, sweep_thread, lcm_thread;
+    uint32_ofp seconds = 10;
+
+    g_use_domains = argc < 2 || strcmp(argv[1], "global");
+    if (argc > 2)
+    {
+        seconds = atoi(argv[2]);
+    }
+
+    /* nanosleep() of a few us should not be rounded up to the 50us default slack */
+    prctl(PR_SET_TIMERSLACK, 1);
+    if (adpt_lock_init())
+    {
+        fprintf(stderr, "adpt_lock_init failed\n");
+        return 1;
+    }
+
+    if (g_use_domains)
+    {
+        /* once with the profile off and once with it on, both take paths */
+        if (bench_nested_check())
+        {
+            return 1;
+        }
+        adpt_lock_set_profile(true);
+        if (bench_nested_check())
+        {
+            return 1;
+        }
+        adpt_lock_clear_stats();
+        printf("nested ofp_* calls: ok\n");
+        if (argc > 1 && !strcmp(argv[1], "nested"))
+        {
+            return 0;
+        }
+    }
+
+    pthread_create(&main_thread, NULL, bench_main_loop, NULL);
+    pthread_create(&sweep_thread, NULL, bench_sweep_loop, NULL);
+    pthread_create(&lcm_thread, NULL, bench_lcm_loop, NULL);
+    sleep(seconds);
+    g_stop = true;
+    pthread_join(main_thread, NULL);
+    pthread_join(sweep_thread, NULL);
+    pthread_join(lcm_thread, NULL);
+
+    printf("%s, %u s\n", g_use_domains ? "lock domains" : "global mutex", seconds);
+    bench_lat_show(&g_lat_install);
+    bench_lat_show(&g_lat_port);
+    bench_lat_show(&g_lat_pkt_out);
+    bench_lat_show(&g_lat_link);
+    bench_lat_show(&g_lat_sweep);
+    if (g_use_domains)
+    {
+        bench_lock_stats_show();
+    }
+
+    return 0;
+}
@@ -0,0 +1,420 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file
+ * @brief Benchmark of the flex next-hop and multicast group sharing in adpt_nexthop.c.
+ *        The opf, the hal and the rest of the adapter are stubbed, the stubs count the
+ *        hardware writes.
+ */
+
+/****************************************************************************
+ *
+ * Header Files
+ *
+ ****************************************************************************/
+#include <stdio.h>
+#include <time.h>
+
+#include "ofp_api.h"
+
+#include "adpt.h"
+#include "adpt_lock.h"
+#include "adpt_flow.h"
+#include "adpt_port.h"
+#include "adpt_nexthop.h"
+#include "adpt_opf.h"
+#include "adpt_parser.h"
+
+#include "hal_nexthop.h"
+
+/****************************************************************************
+ *
+ * Defines and Macros
+ *
+ ****************************************************************************/
+#define BENCH_FLEX_FLOWS        10000
+#define BENCH_FLEX_EDITS        50
+#define BENCH_MCAST_FLOWS       10000
+#define BENCH_MCAST_OUTPUTS     4
+#define BENCH_MCAST_SETS        20
+#define BENCH_MCAST_MODIFY      100
+#define BENCH_MEMBER_NHID_BASE  1000
+
+/****************************************************************************
+ *
+ * Global and Declaration
+ *
+ ****************************************************************************/
+struct bench_hal_cnt_s
+{
+    uint32_ofp flex_create;
+    uint32_ofp flex_remove;
+    uint32_ofp flex_live;
+    uint32_ofp group_create;
+    uint32_ofp group_remove;
+    uint32_ofp member_add;
+    uint32_ofp member_del;
+};
+typedef struct bench_hal_cnt_s bench_hal_cnt_t;
+
+static bench_hal_cnt_t g_hal_cnt;
+static uint32_ofp g_next_nhid = ADPT_NH_RSV_NHID_MAX;
+static uint32_ofp g_next_offset = 16;
+static uint32_ofp g_qinq_with_mac_cur;
+
+static ofp_nh_offset_t g_flex_nh[BENCH_FLEX_FLOWS];
+static ofp_nh_offset_t g_group_nh[BENCH_MCAST_FLOWS];
+static ofp_nh_offset_t g_modify_group_nh[BENCH_MCAST_MODIFY];
+
+/****************************************************************************
+ *
+ * Stubs
+ *
+ ****************************************************************************/
+int32_ofp
+adpt_opf_alloc_offset(uint8_ofp type, uint8_ofp num, uint32_ofp* p_offset)
+{
+    if (OPF_OFP_NH_ID == type)
+    {
+        *p_offset = g_next_nhid++;
+    }
+    else
+    {
+        *p_offset = g_next_offset;
+        g_next_offset += num;
+    }
+
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_opf_free_offset(uint8_ofp type, uint8_ofp num, uint32_ofp offset)
+{
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_flow_op_nexthop_res(ofp_nexthop_info_t *nh_info, adpt_res_op_type_t type)
+{
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_flowdb_get_qinq_with_mac_max_num(void)
+{
+    return BENCH_FLEX_FLOWS;
+}
+
+int32_ofp
+adpt_flowdb_get_qinq_with_mac_cur_num(void)
+{
+    return g_qinq_with_mac_cur;
+}
+
+int32_ofp
+adpt_flowdb_incr_qinq_with_mac_cur_num(void)
+{
+    g_qinq_with_mac_cur++;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_flowdb_decr_qinq_with_mac_cur_num(void)
+{
+    g_qinq_with_mac_cur--;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_parser_get_svlan_tpid(uint16_ofp* p_tpid)
+{
+    *p_tpid = 0x8100;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_parser_get_cvlan_tpid(uint16_ofp* p_tpid)
+{
+    *p_tpid = 0x8100;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_port_get_ofport_by_gport(uint16_ofp gport, uint16_ofp* p_ofport)
+{
+    *p_ofport = gport + 1;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_port_set_port_data(uint16_ofp ofport, adpt_port_data_type_t data_type, void* p_data)
+{
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+adpt_port_get_port_data(uint16_ofp ofport, adpt_port_data_type_t data_type, void** pp_data)
+{
+    return OFP_ERR_FAIL;
+}
+
+int32_ofp
+hal_nexthop_create_flex_nh(uint32_ofp nhid, ctc_flex_nh_param_t* p_nh_param)
+{
+    g_hal_cnt.flex_create++;
+    g_hal_cnt.flex_live++;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_remove_flex_nh(uint32_ofp nhid)
+{
+    g_hal_cnt.flex_remove++;
+    g_hal_cnt.flex_live--;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_create_ipuc_nh(uint32_ofp nhid, ctc_ip_nh_param_t* p_nh_param)
+{
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_remove_ipuc_nh(uint32_ofp nhid)
+{
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_remove_mpls_nh(uint32_ofp nhid)
+{
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_create_mcast_group(uint32_ofp nhid, uint32_ofp offset)
+{
+    g_hal_cnt.group_create++;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_remove_mcast_group(uint32_ofp nhid)
+{
+    g_hal_cnt.group_remove++;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_add_mcast_member(uint32_ofp groupid, uint32_ofp mem_nhid, bool port_check_discard)
+{
+    g_hal_cnt.member_add++;
+    return OFP_ERR_SUCCESS;
+}
+
+int32_ofp
+hal_nexthop_del_mcast_member(uint32_ofp groupid, uint32_ofp mem_nhid)
+{
+    g_hal_cnt.member_del++;
+    return OFP_ERR_SUCCESS;
+}
+
+/****************************************************************************
+ *
+ * Function
+ *
+ ****************************************************************************/
+
+static double
+bench_msec(const struct timespec* p_start, const struct timespec* p_end)
+{
+    return (p_end->tv_sec - p_start->tv_sec) * 1e3 + (p_end->tv_nsec - p_start->tv_nsec) / 1e6;
+}
+
+/**
+ * Single output flows over a few distinct edits share one flex nexthop per edit
+ */
+static int32_ofp
+bench_flex_nh(void)
+{
+    adpt_flow_action_combo_t action_combo;
+    ofp_nh_offset_t repeat_nh[2];
+    struct timespec start, installed, removed;
+    uint32_ofp i, edit;
+    int32_ofp rc;
+
+    memset(&g_hal_cnt, 0, sizeof(g_hal_cnt));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCH_FLEX_FLOWS; i++)
+    {
+        edit = i % BENCH_FLEX_EDITS;
+        memset(&action_combo, 0, sizeof(action_combo));
+        action_combo.output_gport = edit % 10;
+        SET_FLAG(action_combo.flag, OFP_FLOW_ACTION_FIELD_OUTPUT);
+        action_combo.vlan_id = 100 + edit / 10;
+        SET_FLAG(action_combo.flag, OFP_FLOW_ACTION_FIELD_REPLACE_SVLAN_VID);
+        action_combo.mac_da[5] = edit;
+        SET_FLAG(action_combo.flag, OFP_FLOW_ACTION_FIELD_SET_MACDA);
+        rc = adpt_nexthop_alloc_flex_nh(&action_combo, &g_flex_nh[i]);
+        if (rc)
+        {
+            return rc;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &installed);
+
+    printf("flex nexthop: %u flows over %u edits\n", BENCH_FLEX_FLOWS, BENCH_FLEX_EDITS);
+    printf("  install  %.2f ms, %u flex nexthops created\n",
+           bench_msec(&start, &installed), g_hal_cnt.flex_create);
+
+    /* a flow repeating an output gets a second nexthop, a group holds a member once */
+    rc = adpt_nexthop_alloc_flex_nh(&action_combo, &repeat_nh[0]);
+    rc = rc ? rc : adpt_nexthop_alloc_unshared_flex_nh(&action_combo, &repeat_nh[1]);
+    if (rc)
+    {
+        return rc;
+    }
+    printf("  repeated output  shared nhid %u, unshared nhid %u\n", repeat_nh[0].nhid, repeat_nh[1].nhid);
+    adpt_nexthop_release_nh_info(&repeat_nh[0]);
+    adpt_nexthop_release_nh_info(&repeat_nh[1]);
+
+    for (i = 0; i < BENCH_FLEX_FLOWS; i++)
+    {
+        adpt_nexthop_release_nh_info(&g_flex_nh[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &removed);
+    printf("  remove   %.2f ms, %u flex nexthops removed, %u live\n",
+           bench_msec(&installed, &removed), g_hal_cnt.flex_remove, g_hal_cnt.flex_live);
+
+    return OFP_ERR_SUCCESS;
+}
+
+/**
+ * Fill the member next-hops of a flow outputting to ports first..first + BENCH_MCAST_OUTPUTS - 1
+ */
+static void
+bench_mcast_members(uint32_ofp first, ofp_nh_offset_t* p_member_nh)
+{
+    uint32_ofp i;
+
+    memset(p_member_nh, 0, BENCH_MCAST_OUTPUTS * sizeof(ofp_nh_offset_t));
+    for (i = 0; i < BENCH_MCAST_OUTPUTS; i++)
+    {
+        p_member_nh[i].nhid = BENCH_MEMBER_NHID_BASE + first + i;
+        p_member_nh[i].port_check_discard = true;
+    }
+}
+
+/**
+ * Multi output flows over a few port sets share one group per set, a flow that is the
+ * only user of its group and changes its outputs updates the group in place
+ */
+static int32_ofp
+bench_mcast_group(void)
+{
+    ofp_nh_offset_t member_nh[BENCH_MCAST_OUTPUTS];
+    ofp_nh_offset_t group_nh;
+    struct timespec start, installed, modified, removed;
+    uint32_ofp i, first;
+    int32_ofp rc;
+
+    memset(&g_hal_cnt, 0, sizeof(g_hal_cnt));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCH_MCAST_FLOWS; i++)
+    {
+        bench_mcast_members(i % BENCH_MCAST_SETS, member_nh);
+        rc = adpt_nexthop_alloc_shared_mcast_group(member_nh, BENCH_MCAST_OUTPUTS, NULL, &g_group_nh[i]);
+        if (rc)
+        {
+            return rc;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &installed);
+
+    printf("mcast group: %u flows x %u outputs over %u port sets\n",
+           BENCH_MCAST_FLOWS, BENCH_MCAST_OUTPUTS, BENCH_MCAST_SETS);
+    printf("  install  %.2f ms, %u groups created, %u members added\n",
+           bench_msec(&start, &installed), g_hal_cnt.group_create, g_hal_cnt.member_add);
+
+    /* flows with a port set of their own, each moved one port up */
+    for (i = 0; i < BENCH_MCAST_MODIFY; i++)
+    {
+        first = BENCH_MCAST_SETS + i * BENCH_MCAST_OUTPUTS * 2;
+        bench_mcast_members(first, member_nh);
+        rc = adpt_nexthop_alloc_shared_mcast_group(member_nh, BENCH_MCAST_OUTPUTS, NULL, &g_modify_group_nh[i]);
+        if (rc)
+        {
+            return rc;
+        }
+    }
+
+    memset(&g_hal_cnt, 0, sizeof(g_hal_cnt));
+    clock_gettime(CLOCK_MONOTONIC, &installed);
+    for (i = 0; i < BENCH_MCAST_MODIFY; i++)
+    {
+        first = BENCH_MCAST_SETS + i * BENCH_MCAST_OUTPUTS * 2;
+        bench_mcast_members(first + 1, member_nh);
+        rc = adpt_nexthop_alloc_shared_mcast_group(member_nh, BENCH_MCAST_OUTPUTS, &g_modify_group_nh[i], &group_nh);
+        if (rc)
+        {
+            return rc;
+        }
+        adpt_nexthop_release_mcast_group(&g_modify_group_nh[i]);
+        g_modify_group_nh[i] = group_nh;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &modified);
+    printf("  modify   %.2f ms for %u flows, %u groups created, %u members added, %u deleted\n",
+           bench_msec(&installed, &modified), BENCH_MCAST_MODIFY, g_hal_cnt.group_create,
+           g_hal_cnt.member_add, g_hal_cnt.member_del);
+
+    memset(&g_hal_cnt, 0, sizeof(g_hal_cnt));
+    for (i = 0; i < BENCH_MCAST_MODIFY; i++)
+    {
+        adpt_nexthop_release_mcast_group(&g_modify_group_nh[i]);
+    }
+    for (i = 0; i < BENCH_MCAST_FLOWS; i++)
+    {
+        adpt_nexthop_release_mcast_group(&g_group_nh[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &removed);
+    printf("  remove   %.2f ms, %u groups removed\n", bench_msec(&modified, &removed), g_hal_cnt.group_remove);
+
+    return OFP_ERR_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    if (adpt_lock_init() || adpt_nexthop_init())
+    {
+        fprintf(stderr, "nexthop init failed\n");
+        return 1;
+    }
+
+    if (bench_flex_nh())
+    {
+        fprintf(stderr, "flex nexthop benchmark failed\n");
+        return 1;
+    }
+    if (bench_mcast_group())
+    {
+        fprintf(stderr, "mcast group benchmark failed\n");
+        return 1;
+    }
+    adpt_nexthop_show_db();
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Benchmark of the afx event loop: 1000 idle pipes, a writer thread poking a
+ * random pipe every 2ms, and periodic timers with random 100..1000ms periods.
+ *
+ *     bench_afx [timers] [seconds]
+ *
+ * Reports the timer start cost, the loop thread cpu time, the fd wakeup
+ * latency and the timer lateness. Build libafx with AFX_NO_EPOLL defined to
+ * measure the poll() backend.
+ */
+
+#include "afx.h"
+#include <pthread.h>
+#include <sys/resource.h>
+
+#define BENCH_FD_NUM        1000
+#define BENCH_TIMER_MAX     10000
+#define BENCH_WAKEUP_MAX    200000
+#define BENCH_LATE_MAX      2000000
+
+struct bench_timer
+{
+    afx_timer_t *p_timer;
+    uint64_t due;                   /* usec */
+    uint32_t period;                /* msec */
+};
+
+static int pipes[BENCH_FD_NUM][2];
+static afx_mio_t *mios[BENCH_FD_NUM];
+static volatile uint64_t sent[BENCH_FD_NUM];
+static struct bench_timer timers[BENCH_TIMER_MAX];
+static afx_timer_t *end_timer;
+static int64_t wakeup[BENCH_WAKEUP_MAX];
+static int n_wakeup;
+static int64_t late[BENCH_LATE_MAX];
+static int n_late;
+static struct rusage loop_usage;
+static volatile bool stop;
+
+static uint64_t
+bench_usec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void
+bench_read_cb(int fd, afx_io_dir_t dir, void *arg)
+{
+    long i = (long)arg;
+    char c;
+
+    if (read(fd, &c, 1) == 1 && n_wakeup < BENCH_WAKEUP_MAX)
+    {
+        wakeup[n_wakeup++] = bench_usec() - sent[i];
+    }
+}
+
+static void
+bench_timer_cb(void *arg)
+{
+    struct bench_timer *p_timer = arg;
+
+    if (n_late < BENCH_LATE_MAX)
+    {
+        late[n_late++] = bench_usec() - p_timer->due;
+    }
+    p_timer->due += p_timer->period * 1000ULL;
+}
+
+static void
+bench_end_cb(void *arg)
+{
+    getrusage(RUSAGE_THREAD, &loop_usage);
+    stop = true;
+    afx_event_loop_exit();
+}
+
+static void *
+bench_writer(void *arg)
+{
+    unsigned int seed = 7;
+    int i;
+
+    while (!stop)
+    {
+        i = rand_r(&seed) % BENCH_FD_NUM;
+        sent[i] = bench_usec();
+        if (write(pipes[i][1], "x", 1) != 1)
+        {
+            break;
+        }
+        usleep(2000);
+    }
+
+    return NULL;
+}
+
+static int
+bench_cmp(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a;
+    int64_t y = *(const int64_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void
+bench_show(const char *name, int64_t *p_val, int n)
+{
+    if (0 == n)
+    {
+        return;
+    }
+
+    qsort(p_val, n, sizeof(int64_t), bench_cmp);
+    printf("  %-16s n=%d p50 %lld p99 %lld p99.9 %lld max %lld us\n", name, n,
+           (long long)p_val[n / 2], (long long)p_val[n * 99 / 100],
+           (long long)p_val[n * 999 / 1000], (long long)p_val[n - 1]);
+}
+
+int
+main(int argc, char *argv[])
+{
+    pthread_t writer;
+    uint64_t start;
+    int n_timer = 2000;
+    int seconds = 10;
+    int i;
+
+    if (argc > 1)
+    {
+        n_timer = atoi(argv[1]);
+    }
+    if (argc > 2)
+    {
+        seconds = atoi(argv[2]);
+    }
+    if (n_timer <= 0 || n_timer > BENCH_TIMER_MAX || seconds <= 0)
+    {
+        fprintf(stderr, "timers must be in 1..%d\n", BENCH_TIMER_MAX);
+        return 1;
+    }
+
+    srand(1);
+    for (i = 0; i < BENCH_FD_NUM; i++)
+    {
+        if (pipe(pipes[i]) || afx_mio_create(&mios[i], pipes[i][0], AFX_IO_IN, bench_read_cb, (void *)(long)i))
+        {
+            fprintf(stderr, "fd %d: setup failed\n", i);
+            return 1;
+        }
+    }
+    if (afx_event_loop_create())
+    {
+        fprintf(stderr, "afx_event_loop_create failed\n");
+        return 1;
+    }
+
+    start = bench_usec();
+    for (i = 0; i < n_timer; i++)
+    {
+        afx_timer_create(&timers[i].p_timer, bench_timer_cb, &timers[i]);
+        timers[i].period = 100 + rand() % 900;
+        timers[i].due = bench_usec() + timers[i].period * 1000ULL;
+        afx_timer_start(timers[i].p_timer, timers[i].period);
+    }
+    printf("%d timers, %d fds, %d s\n", n_timer, BENCH_FD_NUM, seconds);
+    printf("  timer start      %.0f ns/op\n", (bench_usec() - start) * 1000.0 / n_timer);
+
+    afx_timer_create(&end_timer, bench_end_cb, NULL);
+    afx_timer_start(end_timer, seconds * 1000);
+    pthread_create(&writer, NULL, bench_writer, NULL);
+    afx_event_loop_run();
+    pthread_join(writer, NULL);
+
+    printf("  loop cpu         %.2f s user %.2f s sys\n",
+           loop_usage.ru_utime.tv_sec + loop_usage.ru_utime.tv_usec / 1e6,
+           loop_usage.ru_stime.tv_sec + loop_usage.ru_stime.tv_usec / 1e6);
+    bench_show("fd wakeup", wakeup, n_wakeup);
+    bench_show("timer lateness", late, n_late);
+
+    return 0;
+}
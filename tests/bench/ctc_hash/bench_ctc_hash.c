@@ -0,0 +1,298 @@
+/*
+ * Check and benchmark of ctc_hash from 1K to [max] entries, ten times more
+ * each round:
+ *
+ *     bench_ctc_hash [max]
+ *
+ * Each round inserts the entries, looks every one up and as many absent
+ * keys, and traverses the table three times: read only, with the callback
+ * inserting a new entry per visit, and with the callback removing every
+ * other visited entry with ctc_hash_remove(). Every entry present at the
+ * start of a traversal must be visited exactly once, no entry inserted by
+ * it may be, and the count and lookups must agree afterwards. The rest is
+ * then removed by ctc_hash_traverse_remove().
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "ctc_hash.h"
+
+#define BENCH_MIN_ENTRIES   1000
+#define BENCH_MAX_ENTRIES   1000000
+
+struct bench_node_s
+{
+    uint32 key;
+    uint32 visit;
+};
+typedef struct bench_node_s bench_node_t;
+
+struct bench_ctx_s
+{
+    ctc_hash_t* hash;
+    bench_node_t* node;
+    uint32 next;
+    uint32 error;
+};
+typedef struct bench_ctx_s bench_ctx_t;
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/* odd multiplier, so different indexes give different keys */
+static uint32
+_bench_key(uint32 i)
+{
+    return i * 2654435761U;
+}
+
+static uint32
+_bench_hash_key(bench_node_t* node)
+{
+    return node->key;
+}
+
+static bool
+_bench_hash_cmp(bench_node_t* stored, bench_node_t* node)
+{
+    return stored->key == node->key;
+}
+
+static int32
+_bench_visit(void* data, void* user_data)
+{
+    ((bench_node_t*)data)->visit++;
+    return 0;
+}
+
+static int32
+_bench_visit_insert(void* data, void* user_data)
+{
+    bench_ctx_t* ctx = user_data;
+    bench_node_t* node = &ctx->node[ctx->next];
+
+    ((bench_node_t*)data)->visit++;
+    node->key = _bench_key(ctx->next++);
+    node->visit = 0;
+    if (NULL == ctc_hash_insert(ctx->hash, node))
+    {
+        ctx->error++;
+    }
+
+    return 0;
+}
+
+static int32
+_bench_visit_remove(void* data, void* user_data)
+{
+    bench_ctx_t* ctx = user_data;
+    bench_node_t* node = data;
+
+    node->visit++;
+    if ((node->key & 1) && (ctc_hash_remove(ctx->hash, node) != node))
+    {
+        ctx->error++;
+    }
+
+    return 0;
+}
+
+static int32
+_bench_remove_all(void* data, void* user_data)
+{
+    return TRUE;
+}
+
+/* entries [0, num) must have been visited once, the rest not at all */
+static int32
+_bench_check_visit(bench_ctx_t* ctx, uint32 num, const char* what)
+{
+    uint32 i;
+
+    for (i = 0; i < ctx->next; i++)
+    {
+        if (ctx->node[i].visit != (i < num ? 1 : 0))
+        {
+            printf("%s: entry %u visited %u times\n", what, i, ctx->node[i].visit);
+            return -1;
+        }
+        ctx->node[i].visit = 0;
+    }
+
+    return 0;
+}
+
+static int32
+_bench_check_count(bench_ctx_t* ctx, uint32 expect, const char* what)
+{
+    uint32 count = 0;
+
+    ctc_hash_get_count(ctx->hash, &count);
+    if (ctx->error || (count != expect))
+    {
+        printf("%s: count %u expected %u, %u callback errors\n", what, count, expect, ctx->error);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int32
+_bench_round(uint32 num)
+{
+    bench_ctx_t ctx;
+    bench_node_t probe;
+    struct timespec start;
+    double insert_ns, hit_ns, miss_ns, walk_ns, walk_insert_ns, walk_remove_ns, remove_ns;
+    uint32 i, expect;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.node = calloc(2 * num, sizeof(bench_node_t));
+    ctx.hash = ctc_hash_create(1, 1, _bench_hash_key, _bench_hash_cmp);
+    if (!ctx.node || !ctx.hash)
+    {
+        printf("out of memory\n");
+        return -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < num; i++)
+    {
+        ctx.node[i].key = _bench_key(i);
+        if (NULL == ctc_hash_insert(ctx.hash, &ctx.node[i]))
+        {
+            ctx.error++;
+        }
+    }
+    insert_ns = _bench_elapsed(&start) * 1e9 / num;
+    ctx.next = num;
+    if (_bench_check_count(&ctx, num, "insert"))
+    {
+        return -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < num; i++)
+    {
+        probe.key = _bench_key(i);
+        if (ctc_hash_lookup(ctx.hash, &probe) != &ctx.node[i])
+        {
+            printf("lookup: entry %u not found\n", i);
+            return -1;
+        }
+    }
+    hit_ns = _bench_elapsed(&start) * 1e9 / num;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < num; i++)
+    {
+        probe.key = _bench_key(2 * num + i);
+        if (ctc_hash_lookup(ctx.hash, &probe))
+        {
+            printf("lookup: absent key %u found\n", 2 * num + i);
+            return -1;
+        }
+    }
+    miss_ns = _bench_elapsed(&start) * 1e9 / num;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ctc_hash_traverse(ctx.hash, _bench_visit, &ctx);
+    walk_ns = _bench_elapsed(&start) * 1e9 / num;
+    if (_bench_check_visit(&ctx, num, "traverse"))
+    {
+        return -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ctc_hash_traverse(ctx.hash, _bench_visit_insert, &ctx);
+    walk_insert_ns = _bench_elapsed(&start) * 1e9 / num;
+    if (_bench_check_visit(&ctx, num, "traverse insert")
+        || _bench_check_count(&ctx, 2 * num, "traverse insert"))
+    {
+        return -1;
+    }
+    for (i = 0; i < ctx.next; i++)
+    {
+        if (ctc_hash_lookup(ctx.hash, &ctx.node[i]) != &ctx.node[i])
+        {
+            printf("traverse insert: entry %u not found\n", i);
+            return -1;
+        }
+    }
+
+    expect = 0;
+    for (i = 0; i < ctx.next; i++)
+    {
+        expect += (ctx.node[i].key & 1) ? 0 : 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ctc_hash_traverse(ctx.hash, _bench_visit_remove, &ctx);
+    walk_remove_ns = _bench_elapsed(&start) * 1e9 / (2 * num);
+    if (_bench_check_visit(&ctx, 2 * num, "traverse remove")
+        || _bench_check_count(&ctx, expect, "traverse remove"))
+    {
+        return -1;
+    }
+    for (i = 0; i < ctx.next; i++)
+    {
+        if ((ctc_hash_lookup(ctx.hash, &ctx.node[i]) != NULL) == (ctx.node[i].key & 1))
+        {
+            printf("traverse remove: entry %u wrongly %s\n", i, (ctx.node[i].key & 1) ? "kept" : "removed");
+            return -1;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ctc_hash_traverse_remove(ctx.hash, _bench_remove_all, &ctx);
+    remove_ns = _bench_elapsed(&start) * 1e9 / (expect ? expect : 1);
+    if (_bench_check_count(&ctx, 0, "traverse_remove"))
+    {
+        return -1;
+    }
+
+    printf("%8u %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", num, insert_ns, hit_ns, miss_ns,
+           walk_ns, walk_insert_ns, walk_remove_ns, remove_ns);
+
+    ctc_hash_free(ctx.hash);
+    free(ctx.node);
+
+    return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int32 max = BENCH_MAX_ENTRIES;
+    uint32 num;
+
+    if (argc > 1)
+    {
+        max = atoi(argv[1]);
+    }
+    if (max < BENCH_MIN_ENTRIES)
+    {
+        fprintf(stderr, "max must be at least %u\n", BENCH_MIN_ENTRIES);
+        return 1;
+    }
+
+    printf("ns per entry\n");
+    printf("%8s %9s %9s %9s %9s %9s %9s %9s\n", "entries", "insert", "hit", "miss",
+           "walk", "walk+ins", "walk+rm", "trav_rm");
+    for (num = BENCH_MIN_ENTRIES; num <= (uint32)max; num *= 10)
+    {
+        if (_bench_round(num))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Benchmark of the humber table field set/get: drv_tbl_field_set/get(),
+ * which walk the registered field descriptors, against the generated
+ * drv_humber_tbl_field_set/get() switch that drv_tbl_ioctl() now uses.
+ *
+ *     bench_drv_field [rounds]
+ *
+ * First every field of every registered table is set and read back through
+ * both paths with random values, including values too big for the field and
+ * a field id past the table, and the entries and return codes must match.
+ * Then every field of DsAcl, DsMac and DsFwd is set and read back [rounds]
+ * times through each path.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "drv_humber.h"
+#include "drv_tbl_reg.h"
+#include "drv_humber_field.h"
+
+#define BENCH_ROUNDS        20000
+#define BENCH_CHECK_VALUES  64
+
+typedef int32 (*bench_field_set_t)(tbl_id_t, fld_id_t, uint32*, uint32);
+typedef int32 (*bench_field_get_t)(tbl_id_t, fld_id_t, uint32*, uint32*);
+
+static const struct
+{
+    tbl_id_t tbl_id;
+    char* name;
+} bench_tbl[] =
+{
+    {DS_MAC_ACL, "DsMacAcl"},
+    {DS_IPV4_ACL, "DsIpv4Acl"},
+    {DS_MPLS_ACL, "DsMplsAcl"},
+    {DS_IPV6_ACL, "DsIpv6Acl"},
+    {DS_MAC, "DsMac"},
+    {DS_FWD, "DsFwd"},
+};
+
+static uint32 bench_seed = 1;
+
+static uint32
+_bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (bench_seed >> 16) | (bench_seed << 16);
+}
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int32
+_bench_check_tbl(tbl_id_t tbl_id)
+{
+    uint32 old_entry[MAX_ENTRY_WORD];
+    uint32 new_entry[MAX_ENTRY_WORD];
+    uint32 old_val, new_val, value;
+    fields_t* field;
+    int32 old_ret, new_ret;
+    uint32 f, i;
+
+    for (i = 0; i < MAX_ENTRY_WORD; i++)
+    {
+        old_entry[i] = new_entry[i] = _bench_rand();
+    }
+
+    /* one past the last field must fail the same way on both paths */
+    for (f = 0; f <= DRV_TBL_GET_INFO(tbl_id).num_fields; f++)
+    {
+        field = drv_tbl_field_find(tbl_id, f);
+        for (i = 0; i < BENCH_CHECK_VALUES; i++)
+        {
+            value = _bench_rand();
+            if (field && (field->len < 32) && (i & 1))
+            {
+                value &= (1 << field->len) - 1;
+            }
+
+            old_ret = drv_tbl_field_set(tbl_id, f, old_entry, value);
+            new_ret = drv_humber_tbl_field_set(tbl_id, f, new_entry, value);
+            if ((old_ret != new_ret) || memcmp(old_entry, new_entry, sizeof(old_entry)))
+            {
+                printf("tbl %u field %u: set 0x%x returned %d/%d\n", tbl_id, f, value, old_ret, new_ret);
+                return -1;
+            }
+
+            old_val = new_val = 0;
+            old_ret = drv_tbl_field_get(tbl_id, f, old_entry, &old_val);
+            new_ret = drv_humber_tbl_field_get(tbl_id, f, new_entry, &new_val);
+            if ((old_ret != new_ret) || (old_val != new_val))
+            {
+                printf("tbl %u field %u: get returned %d/%d, 0x%x/0x%x\n",
+                       tbl_id, f, old_ret, new_ret, old_val, new_val);
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static double
+_bench_run(tbl_id_t tbl_id, bench_field_set_t set, bench_field_get_t get, int32 rounds)
+{
+    uint32 entry[MAX_ENTRY_WORD] = {0};
+    uint32 num_f = DRV_TBL_GET_INFO(tbl_id).num_fields;
+    volatile uint32 sink = 0;
+    struct timespec start;
+    uint32 value;
+    uint32 f;
+    int32 r;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (r = 0; r < rounds; r++)
+    {
+        for (f = 0; f < num_f; f++)
+        {
+            set(tbl_id, f, entry, r & 1);
+            get(tbl_id, f, entry, &value);
+            sink += value;
+        }
+    }
+
+    return _bench_elapsed(&start) * 1e9 / ((double)rounds * num_f * 2);
+}
+
+int
+main(int argc, char* argv[])
+{
+    struct timespec start;
+    uint32 num_f = 0;
+    double old_ns, new_ns;
+    int32 rounds = BENCH_ROUNDS;
+    uint32 t, i;
+
+    if (argc > 1)
+    {
+        rounds = atoi(argv[1]);
+    }
+    if (rounds < 1)
+    {
+        fprintf(stderr, "rounds must be positive\n");
+        return 1;
+    }
+
+    if (drv_humber_register())
+    {
+        fprintf(stderr, "drv_humber_register failed\n");
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (t = 0; t < MAX_TBL_NUM; t++)
+    {
+        if (NULL == DRV_TBL_GET_INFO(t).ptr_fields)
+        {
+            continue;
+        }
+        if (_bench_check_tbl(t))
+        {
+            return 1;
+        }
+        num_f += DRV_TBL_GET_INFO(t).num_fields;
+    }
+    printf("checked %u fields of every table in %.2fs\n", num_f, _bench_elapsed(&start));
+
+    printf("%-16s %8s %12s %12s\n", "table", "fields", "runtime ns", "generated ns");
+    for (i = 0; i < sizeof(bench_tbl) / sizeof(bench_tbl[0]); i++)
+    {
+        t = bench_tbl[i].tbl_id;
+        old_ns = _bench_run(t, drv_tbl_field_set, drv_tbl_field_get, rounds);
+        new_ns = _bench_run(t, drv_humber_tbl_field_set, drv_humber_tbl_field_get, rounds);
+        printf("%-16s %8u %12.2f %12.2f\n", bench_tbl[i].name, DRV_TBL_GET_INFO(t).num_fields, old_ns, new_ns);
+    }
+
+    /* what a caller with a constant field gets from the header alone */
+    {
+        uint32 entry[MAX_ENTRY_WORD] = {0};
+        volatile uint32 sink = 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < (uint32)rounds * 100; i++)
+        {
+            drv_ds_fwd_dest_map_set(entry, i & 0x3FFFFF);
+            sink += drv_ds_fwd_dest_map_get(entry);
+        }
+        printf("ds_fwd dest_map inline accessor: %.2f ns\n",
+               _bench_elapsed(&start) * 1e9 / ((double)rounds * 200));
+    }
+
+    return 0;
+}
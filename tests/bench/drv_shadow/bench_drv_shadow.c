@@ -0,0 +1,342 @@
+/*
+ * Consistency run and benchmark of the table shadow of drv_tbl_ioctl():
+ * the port tables sys_humber_port_init() shadows, on a sram model that
+ * replaces the chip.
+ *
+ *     bench_drv_shadow [ops]
+ *
+ * [ops] random field writes, field reads, entry writes and entry reads go
+ * through drv_tbl_ioctl() with the shadow on. Every read must return what the
+ * model holds, and drv_tbl_shadow_check() must find no mismatch every
+ * BENCH_CHECK_EVERY operations. One model write in BENCH_FAIL_ONE fails and
+ * lands on the chip or not, so the shadow must drop the entry.
+ *
+ * Then every entry is cached, BENCH_BEHIND entries are changed in the model
+ * behind the driver, and drv_tbl_shadow_check() must report exactly those
+ * and leave nothing for a second check.
+ *
+ * Last, [ops] field writes are timed with the shadow off and on, with the
+ * model reads and writes counted per field write.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "drv_humber.h"
+#include "drv_tbl_reg.h"
+#include "drv_io.h"
+
+#define BENCH_OPS           200000
+#define BENCH_CHECK_EVERY   1000
+#define BENCH_FAIL_ONE      64
+#define BENCH_BEHIND        100
+
+static const struct
+{
+    tbl_id_t tbl_id;
+    char* name;
+} bench_tbl[] =
+{
+    {DS_PHY_PORT, "DsPhyPort"},
+    {DS_PHY_PORT_EXT, "DsPhyPortExt"},
+    {DS_SRC_PORT, "DsSrcPort"},
+    {DS_DEST_PHY_PORT, "DsDestPhyPort"},
+    {DS_DEST_PORT, "DsDestPort"},
+};
+#define BENCH_TBL_NUM   (sizeof(bench_tbl) / sizeof(bench_tbl[0]))
+
+static uint32 bench_seed = 1;
+
+/* sram model, max_index entries of each bench table */
+static uint32* bench_mem[MAX_TBL_NUM];
+static uint32 bench_reads;
+static uint32 bench_writes;
+static bool bench_fail;
+
+static uint32
+_bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (bench_seed >> 16) | (bench_seed << 16);
+}
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static uint32*
+_bench_model_entry(tbl_id_t tbl_id, uint32 index)
+{
+    return bench_mem[tbl_id] + index * (DRV_TBL_ENTRY_SIZE(tbl_id) >> 2);
+}
+
+static int32
+_bench_model_read(uint8 chip_id, tbl_id_t tbl_id, uint32 index, uint32* data)
+{
+    bench_reads++;
+    kal_memcpy(data, _bench_model_entry(tbl_id, index), DRV_TBL_ENTRY_SIZE(tbl_id));
+    return DRV_E_NONE;
+}
+
+/* a failed write may or may not have reached the chip */
+static int32
+_bench_model_write(uint8 chip_id, tbl_id_t tbl_id, uint32 index, uint32* data)
+{
+    bench_writes++;
+    if (bench_fail && !(_bench_rand() % BENCH_FAIL_ONE))
+    {
+        if (_bench_rand() & 1)
+        {
+            kal_memcpy(_bench_model_entry(tbl_id, index), data, DRV_TBL_ENTRY_SIZE(tbl_id));
+        }
+        return DRV_E_TIME_OUT;
+    }
+
+    kal_memcpy(_bench_model_entry(tbl_id, index), data, DRV_TBL_ENTRY_SIZE(tbl_id));
+    return DRV_E_NONE;
+}
+
+static int32
+_bench_check_shadow(uint32 expect)
+{
+    uint32 mismatch;
+    uint32 t;
+    int32 ret;
+
+    for (t = 0; t < BENCH_TBL_NUM; t++)
+    {
+        ret = drv_tbl_shadow_check(0, bench_tbl[t].tbl_id, &mismatch);
+        if (ret || (mismatch != expect))
+        {
+            printf("%s: shadow check returned %d with %u mismatches, %u expected\n",
+                   bench_tbl[t].name, ret, mismatch, expect);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * one random field write, field read, entry write or entry read, the reads
+ * must see the model
+ */
+static int32
+_bench_op(void)
+{
+    uint32 entry[MAX_ENTRY_WORD];
+    tbl_id_t tbl_id;
+    fields_t* field;
+    uint32 index, f, i;
+    uint32 value, expect;
+    uint32 op;
+
+    tbl_id = bench_tbl[_bench_rand() % BENCH_TBL_NUM].tbl_id;
+    index = _bench_rand() % DRV_TBL_MAX_INDEX(tbl_id);
+    f = _bench_rand() % DRV_TBL_GET_INFO(tbl_id).num_fields;
+    field = drv_tbl_field_find(tbl_id, f);
+    op = _bench_rand() % 10;
+
+    if (op < 4)
+    {
+        value = _bench_rand();
+        if (field->len < 32)
+        {
+            value &= (1 << field->len) - 1;
+        }
+        drv_tbl_ioctl(0, index, DRV_IOW(IOC_TABLE, tbl_id, f), &value);
+    }
+    else if (op < 7)
+    {
+        if (drv_tbl_ioctl(0, index, DRV_IOR(IOC_TABLE, tbl_id, f), &value))
+        {
+            printf("tbl %u index %u field %u: read failed\n", tbl_id, index, f);
+            return -1;
+        }
+        drv_tbl_field_get(tbl_id, f, _bench_model_entry(tbl_id, index), &expect);
+        if (value != expect)
+        {
+            printf("tbl %u index %u field %u: read 0x%x, chip holds 0x%x\n", tbl_id, index, f, value, expect);
+            return -1;
+        }
+    }
+    else if (op < 8)
+    {
+        for (i = 0; i < MAX_ENTRY_WORD; i++)
+        {
+            entry[i] = _bench_rand();
+        }
+        drv_tbl_ioctl(0, index, DRV_IOW(IOC_TABLE, tbl_id, DRV_ENTRY_FLAG), entry);
+    }
+    else
+    {
+        if (drv_tbl_ioctl(0, index, DRV_IOR(IOC_TABLE, tbl_id, DRV_ENTRY_FLAG), entry))
+        {
+            printf("tbl %u index %u: read failed\n", tbl_id, index);
+            return -1;
+        }
+        if (kal_memcmp(entry, _bench_model_entry(tbl_id, index), DRV_TBL_ENTRY_SIZE(tbl_id)))
+        {
+            printf("tbl %u index %u: entry read differs from the chip\n", tbl_id, index);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * cache every entry, change BENCH_BEHIND of each table in the model and the
+ * check must find just those
+ */
+static int32
+_bench_behind(void)
+{
+    uint32 entry[MAX_ENTRY_WORD];
+    tbl_id_t tbl_id;
+    uint32 index, n, t;
+
+    for (t = 0; t < BENCH_TBL_NUM; t++)
+    {
+        tbl_id = bench_tbl[t].tbl_id;
+        for (index = 0; index < DRV_TBL_MAX_INDEX(tbl_id); index++)
+        {
+            drv_tbl_ioctl(0, index, DRV_IOR(IOC_TABLE, tbl_id, DRV_ENTRY_FLAG), entry);
+        }
+
+        /* BENCH_BEHIND distinct entries, each with one bit flipped */
+        for (n = 0; n < BENCH_BEHIND; n++)
+        {
+            index = n * (DRV_TBL_MAX_INDEX(tbl_id) / BENCH_BEHIND);
+            _bench_model_entry(tbl_id, index)[_bench_rand() % (DRV_TBL_ENTRY_SIZE(tbl_id) >> 2)] ^= 0x1;
+        }
+    }
+
+    if (_bench_check_shadow(BENCH_BEHIND) || _bench_check_shadow(0))
+    {
+        return -1;
+    }
+
+    for (n = 0; n < BENCH_OPS / 10; n++)
+    {
+        if (_bench_op())
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static double
+_bench_run(int32 ops)
+{
+    struct timespec start;
+    tbl_id_t tbl_id;
+    uint32 index, f;
+    uint32 value;
+    int32 n;
+
+    bench_reads = bench_writes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (n = 0; n < ops; n++)
+    {
+        tbl_id = bench_tbl[n % BENCH_TBL_NUM].tbl_id;
+        index = _bench_rand() % DRV_TBL_MAX_INDEX(tbl_id);
+        f = _bench_rand() % DRV_TBL_GET_INFO(tbl_id).num_fields;
+        value = _bench_rand() & 1;
+        drv_tbl_ioctl(0, index, DRV_IOW(IOC_TABLE, tbl_id, f), &value);
+    }
+
+    return _bench_elapsed(&start) * 1e9 / ops;
+}
+
+int
+main(int argc, char* argv[])
+{
+    tbl_id_t tbl_id;
+    double off_ns, on_ns;
+    uint32 off_reads, off_writes;
+    int32 ops = BENCH_OPS;
+    int32 n;
+    uint32 t;
+
+    if (argc > 1)
+    {
+        ops = atoi(argv[1]);
+    }
+    if (ops < BENCH_CHECK_EVERY)
+    {
+        fprintf(stderr, "ops must be at least %u\n", BENCH_CHECK_EVERY);
+        return 1;
+    }
+
+    if (drv_init(1))
+    {
+        fprintf(stderr, "drv_init failed\n");
+        return 1;
+    }
+    drv_io_api[0].drv_sram_tbl_read = _bench_model_read;
+    drv_io_api[0].drv_sram_tbl_write = _bench_model_write;
+
+    for (t = 0; t < BENCH_TBL_NUM; t++)
+    {
+        tbl_id = bench_tbl[t].tbl_id;
+        bench_mem[tbl_id] = calloc(DRV_TBL_MAX_INDEX(tbl_id), DRV_TBL_ENTRY_SIZE(tbl_id));
+        if (!bench_mem[tbl_id] || drv_tbl_shadow_enable(0, tbl_id))
+        {
+            fprintf(stderr, "%s: no shadow\n", bench_tbl[t].name);
+            return 1;
+        }
+    }
+
+    bench_fail = TRUE;
+    for (n = 0; n < ops; n++)
+    {
+        if (_bench_op())
+        {
+            return 1;
+        }
+        if (!((n + 1) % BENCH_CHECK_EVERY) && _bench_check_shadow(0))
+        {
+            return 1;
+        }
+    }
+    bench_fail = FALSE;
+    printf("checked %d operations, one write in %u failing\n", ops, BENCH_FAIL_ONE);
+
+    if (_bench_behind())
+    {
+        return 1;
+    }
+    printf("checked %u entries per table changed behind the driver\n", BENCH_BEHIND);
+
+    for (t = 0; t < BENCH_TBL_NUM; t++)
+    {
+        drv_tbl_shadow_disable(0, bench_tbl[t].tbl_id);
+    }
+    off_ns = _bench_run(ops);
+    off_reads = bench_reads;
+    off_writes = bench_writes;
+
+    for (t = 0; t < BENCH_TBL_NUM; t++)
+    {
+        drv_tbl_shadow_enable(0, bench_tbl[t].tbl_id);
+    }
+    _bench_run(ops);
+    on_ns = _bench_run(ops);
+
+    printf("%-12s %12s %14s %14s\n", "field write", "ns", "chip reads", "chip writes");
+    printf("%-12s %12.1f %14.3f %14.3f\n", "no shadow", off_ns,
+           (double)off_reads / ops, (double)off_writes / ops);
+    printf("%-12s %12.1f %14.3f %14.3f\n", "shadow", on_ns,
+           (double)bench_reads / ops, (double)bench_writes / ops);
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Benchmark of the kal slab allocator: every thread does random allocs and
+ * frees over 4 caches of 32 to 1100 bytes, keeping up to 256 objects live.
+ *
+ *     bench_kal_slab [threads]
+ *
+ * After the threads exit, their magazines are drained, so every cache should
+ * report no full slab.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include "kal.h"
+#include "kal_slab.h"
+
+#define BENCH_OPS           2000000
+#define BENCH_LIVE          256
+#define BENCH_CACHE_NUM     4
+#define BENCH_THREAD_MAX    8
+
+static mem_cache_t* bench_cache[BENCH_CACHE_NUM];
+static const int32 bench_obj_size[BENCH_CACHE_NUM] = {32, 96, 300, 1100};
+
+static void*
+_bench_kal_slab_thread(void* arg)
+{
+    void* live[BENCH_LIVE] = {0};
+    uint32 seed = (uint32)(long)arg * 7919 + 1;
+    int32 i, k;
+
+    for (i = 0; i < BENCH_OPS; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        k = (seed >> 8) % BENCH_LIVE;
+        if (live[k])
+        {
+            mem_cache_free(live[k]);
+            live[k] = NULL;
+        }
+        else
+        {
+            live[k] = mem_cache_alloc(bench_cache[k % BENCH_CACHE_NUM]);
+        }
+    }
+
+    for (k = 0; k < BENCH_LIVE; k++)
+    {
+        if (live[k])
+        {
+            mem_cache_free(live[k]);
+        }
+    }
+
+    return NULL;
+}
+
+int
+main(int argc, char* argv[])
+{
+    pthread_t threads[BENCH_THREAD_MAX];
+    struct timespec start, end;
+    double sec;
+    int32 n_thread = 1;
+    int32 i;
+
+    if (argc > 1)
+    {
+        n_thread = atoi(argv[1]);
+    }
+    if (n_thread < 1 || n_thread > BENCH_THREAD_MAX)
+    {
+        fprintf(stderr, "threads must be in 1..%d\n", BENCH_THREAD_MAX);
+        return 1;
+    }
+
+    mem_cache_init();
+    for (i = 0; i < BENCH_CACHE_NUM; i++)
+    {
+        bench_cache[i] = mem_cache_create(bench_obj_size[i]);
+        if (NULL == bench_cache[i])
+        {
+            fprintf(stderr, "mem_cache_create(%d) failed\n", bench_obj_size[i]);
+            return 1;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < n_thread; i++)
+    {
+        pthread_create(&threads[i], NULL, _bench_kal_slab_thread, (void*)(long)i);
+    }
+    for (i = 0; i < n_thread; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("%d threads: %.1f Mops/s\n", n_thread, n_thread * (double)BENCH_OPS / sec / 1e6);
+    for (i = 0; i < BENCH_CACHE_NUM; i++)
+    {
+        printf("  cache %4d bytes: full slabs %u, free slabs %u\n", bench_obj_size[i],
+               bench_cache[i]->full_slabs.count, bench_cache[i]->free_slabs.count);
+        mem_cache_destroy(bench_cache[i]);
+    }
+
+    return 0;
+}
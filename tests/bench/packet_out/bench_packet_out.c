@@ -0,0 +1,119 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file
+ * @brief Benchmark of the cpu side of packet-out for 64, 512 and 1500 byte frames: the
+ *        copy execute() makes plus ofp_encap_packet(), into a new buffer as earlier
+ *        outputs of an action list do and into the headroom of the copy as the last
+ *        output does. Nothing is sent to the hardware.
+ *
+ *        bench_packet_out [count]
+ */
+
+/****************************************************************************
+ *
+ * Header Files
+ *
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ofpbuf.h"
+
+#include "ofp_api.h"
+
+/****************************************************************************
+ *
+ * Function
+ *
+ ****************************************************************************/
+
+static uint64_ofp
+bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_ofp)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int
+main(int argc, char* argv[])
+{
+    static const uint32_ofp frame_size[] = {64, 512, 1500};
+    uint8_ofp payload[1500];
+    ofp_cpu_encap_info_t cpu_encap_info;
+    struct ofpbuf copy;
+    struct ofpbuf hardware_process_packet;
+    uint64_ofp start, copy_nsec, in_place_nsec;
+    uint32_ofp size, i, n;
+    int count = 100000;
+
+    if (argc > 1)
+    {
+        count = atoi(argv[1]);
+    }
+    if (count <= 0)
+    {
+        fprintf(stderr, "count must be positive\n");
+        return 1;
+    }
+
+    memset(payload, 0xA5, sizeof(payload));
+    memset(&cpu_encap_info, 0, sizeof(cpu_encap_info));
+    cpu_encap_info.nh_type   = OFP_NEXTHOP_TYPE_OFFSET;
+    cpu_encap_info.src_vid   = OFP_DEFAULT_VLAN_ID;
+    cpu_encap_info.src_port  = OFP_DEFAULT_CPU_GPORT_ID;
+    cpu_encap_info.hash      = 5;
+
+    printf("%-6s %12s %12s %12s %12s\n",
+           "frame", "copy ns", "copy kpps", "in place ns", "in place kpps");
+    for (i = 0; i < sizeof(frame_size) / sizeof(frame_size[0]); i++)
+    {
+        size = frame_size[i];
+
+        start = bench_now();
+        for (n = 0; n < count; n++)
+        {
+            ofpbuf_init(&copy, OFP_CPU_ENCAP_HDR_LEN + size);
+            ofpbuf_reserve(&copy, OFP_CPU_ENCAP_HDR_LEN);
+            ofpbuf_put(&copy, payload, size);
+            ofp_encap_packet(&cpu_encap_info, &copy, &hardware_process_packet);
+            ofpbuf_uninit(&hardware_process_packet);
+            ofpbuf_uninit(&copy);
+        }
+        copy_nsec = bench_now() - start;
+
+        start = bench_now();
+        for (n = 0; n < count; n++)
+        {
+            ofpbuf_init(&copy, OFP_CPU_ENCAP_HDR_LEN + size);
+            ofpbuf_reserve(&copy, OFP_CPU_ENCAP_HDR_LEN);
+            ofpbuf_put(&copy, payload, size);
+            ofp_encap_packet(&cpu_encap_info, &copy, &copy);
+            ofpbuf_uninit(&copy);
+        }
+        in_place_nsec = bench_now() - start;
+
+        printf("%4uB   %12.1f %12.1f %12.1f %12.1f\n", size,
+               (double)copy_nsec / count, count * 1e6 / (copy_nsec ? copy_nsec : 1),
+               (double)in_place_nsec / count, count * 1e6 / (in_place_nsec ? in_place_nsec : 1));
+    }
+    printf("%d packets per frame size, cpu time only, nothing is sent\n", count);
+
+    return 0;
+}
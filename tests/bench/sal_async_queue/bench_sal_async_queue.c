@@ -0,0 +1,180 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Benchmark of sal_async_queue: producer threads put timestamps, one
+ * consumer gets them and records how long each one was queued.
+ *
+ *     bench_sal_async_queue [list|ring] [producers] [items] [batch]
+ *
+ * items is per producer. With a batch of 1 sal_async_queue_put() is used,
+ * otherwise sal_async_queue_put_batch() and sal_async_queue_get_batch().
+ */
+
+#include "sal.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_QUEUE_LEN     4096
+#define BENCH_PRODUCER_MAX  16
+#define BENCH_BATCH_MAX     64
+
+static sal_async_queue_t *queue;
+static uint32_t n_item;
+static uint32_t batch;
+static int64_t *latency;
+
+static uint64_t
+bench_nsec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void *
+bench_producer(void *arg)
+{
+    void *data[BENCH_BATCH_MAX];
+    uint32_t i, j, sent, count;
+
+    for (i = 0; i < n_item; i += batch)
+    {
+        for (j = 0; j < batch; j++)
+        {
+            data[j] = (void *)(uintptr_t)bench_nsec();
+        }
+
+        if (1 == batch)
+        {
+            while (sal_async_queue_put(queue, data[0]))
+            {
+                sched_yield();
+            }
+            continue;
+        }
+
+        for (sent = 0; sent < batch; sent += count)
+        {
+            count = 0;
+            sal_async_queue_put_batch(queue, data + sent, batch - sent, &count);
+            if (sent + count < batch)
+            {
+                sched_yield();
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static int
+bench_cmp(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a;
+    int64_t y = *(const int64_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+int
+main(int argc, char *argv[])
+{
+    pthread_t producers[BENCH_PRODUCER_MAX];
+    sal_async_queue_type_t type = SAL_ASYNC_QUEUE_RING;
+    sal_async_queue_stats_t stats;
+    void *data[BENCH_BATCH_MAX];
+    uint64_t start, end, now;
+    uint32_t n_producer = 1;
+    uint32_t i, count;
+    size_t total, got = 0;
+
+    n_item = 500000;
+    batch = 1;
+    if (argc > 1 && !strcmp(argv[1], "list"))
+    {
+        type = SAL_ASYNC_QUEUE_LIST;
+    }
+    if (argc > 2)
+    {
+        n_producer = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        n_item = atoi(argv[3]);
+    }
+    if (argc > 4)
+    {
+        batch = atoi(argv[4]);
+    }
+    if (n_producer < 1 || n_producer > BENCH_PRODUCER_MAX || batch < 1 || batch > BENCH_BATCH_MAX
+        || n_item < batch)
+    {
+        fprintf(stderr, "usage: %s [list|ring] [1..%d producers] [items] [1..%d batch]\n",
+                argv[0], BENCH_PRODUCER_MAX, BENCH_BATCH_MAX);
+        return 1;
+    }
+    n_item -= n_item % batch;
+
+    total = (size_t)n_producer * n_item;
+    latency = malloc(total * sizeof(int64_t));
+    if (!latency || sal_async_queue_create_ex(&queue, BENCH_QUEUE_LEN, type))
+    {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+
+    start = bench_nsec();
+    for (i = 0; i < n_producer; i++)
+    {
+        pthread_create(&producers[i], NULL, bench_producer, NULL);
+    }
+    while (got < total)
+    {
+        if (sal_async_queue_get_batch(queue, 1000, data, batch, &count))
+        {
+            continue;
+        }
+        now = bench_nsec();
+        for (i = 0; i < count; i++)
+        {
+            latency[got++] = now - (uint64_t)(uintptr_t)data[i];
+        }
+    }
+    end = bench_nsec();
+    for (i = 0; i < n_producer; i++)
+    {
+        pthread_join(producers[i], NULL);
+    }
+
+    sal_async_queue_get_stats(queue, &stats);
+    qsort(latency, total, sizeof(int64_t), bench_cmp);
+    printf("%s, %u producers, batch %u: %.2f Mops/s, latency p50 %lld p99 %lld us, overflow %u\n",
+           SAL_ASYNC_QUEUE_RING == type ? "ring" : "list", n_producer, batch,
+           total * 1e3 / (end - start), (long long)latency[total / 2] / 1000,
+           (long long)latency[total * 99 / 100] / 1000, stats.overflow);
+
+    sal_async_queue_destroy(queue);
+    free(latency);
+
+    return 0;
+}
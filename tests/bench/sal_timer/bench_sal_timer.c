@@ -0,0 +1,156 @@
+/**
+ *  Copyright (C) 2011, 2012, 2013 CentecNetworks, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * Benchmark of sal_timer: start and stop cost with many armed timers, the
+ * timer task cpu time per expiry and how late handlers run.
+ *
+ *     bench_sal_timer [timers]
+ *
+ * Start and stop run with timeouts of 60..660s, so no timer fires meanwhile.
+ * The expiry run uses timeouts of 1..2000ms and every handler stops its own
+ * timer.
+ */
+
+#include "sal.h"
+#include "sal_task.h"
+#include "sal_timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_TIMER_MAX     100000
+
+static sal_timer_t *timers[BENCH_TIMER_MAX];
+static uint64 due[BENCH_TIMER_MAX];
+static int64 late[BENCH_TIMER_MAX];
+static int order[BENCH_TIMER_MAX];
+static volatile int fired;
+static uint64 handler_cpu;
+
+static uint64
+bench_nsec(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return (uint64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void
+bench_timer_handler(void *arg)
+{
+    long i = (long)arg;
+
+    late[i] = (int64)(bench_nsec(CLOCK_MONOTONIC) - due[i]);
+    sal_timer_stop(timers[i]);
+    handler_cpu = bench_nsec(CLOCK_THREAD_CPUTIME_ID);
+    fired++;
+}
+
+static int
+bench_cmp(const void *a, const void *b)
+{
+    int64 x = *(const int64 *)a;
+    int64 y = *(const int64 *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+int
+main(int argc, char *argv[])
+{
+    uint64 start, end;
+    uint32 timeout;
+    int n = BENCH_TIMER_MAX;
+    int i, j, tmp;
+
+    if (argc > 1)
+    {
+        n = atoi(argv[1]);
+    }
+    if (n <= 0 || n > BENCH_TIMER_MAX)
+    {
+        fprintf(stderr, "timers must be in 1..%d\n", BENCH_TIMER_MAX);
+        return 1;
+    }
+
+    if (sal_timer_init())
+    {
+        fprintf(stderr, "sal_timer_init failed\n");
+        return 1;
+    }
+    sal_task_sleep(10);
+
+    for (i = 0; i < n; i++)
+    {
+        sal_timer_create(&timers[i], bench_timer_handler, (void *)(long)i);
+        order[i] = i;
+    }
+
+    /* stop in random order, so a list walk is not favoured */
+    srand(1);
+    for (i = n - 1; i > 0; i--)
+    {
+        j = rand() % (i + 1);
+        tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    start = bench_nsec(CLOCK_MONOTONIC);
+    for (i = 0; i < n; i++)
+    {
+        sal_timer_start(timers[i], 60000 + rand() % 600000);
+    }
+    end = bench_nsec(CLOCK_MONOTONIC);
+    printf("%d timers\n", n);
+    printf("  start          %.0f ns/op\n", (double)(end - start) / n);
+
+    start = bench_nsec(CLOCK_MONOTONIC);
+    for (i = 0; i < n; i++)
+    {
+        sal_timer_stop(timers[order[i]]);
+    }
+    end = bench_nsec(CLOCK_MONOTONIC);
+    printf("  stop           %.0f ns/op\n", (double)(end - start) / n);
+
+    for (i = 0; i < n; i++)
+    {
+        timeout = 1 + rand() % 2000;
+        due[i] = bench_nsec(CLOCK_MONOTONIC) + timeout * 1000000ULL;
+        sal_timer_start(timers[i], timeout);
+    }
+    while (fired < n)
+    {
+        sal_task_sleep(100);
+    }
+    printf("  expire         %.0f ns/timer of timer task cpu\n", (double)handler_cpu / n);
+
+    qsort(late, n, sizeof(late[0]), bench_cmp);
+    printf("  lateness       p50 %lld p99 %lld p99.9 %lld max %lld us\n",
+           late[n / 2] / 1000, late[n * 99 / 100] / 1000,
+           late[n * 999 / 1000] / 1000, late[n - 1] / 1000);
+
+    for (i = 0; i < n; i++)
+    {
+        sal_timer_destroy(timers[i]);
+    }
+    sal_timer_fini();
+
+    return 0;
+}
@@ -0,0 +1,571 @@
+/*
+ * Benchmark of the acl tcam entry placement: sys_humber_aclqos_entry_insert()
+ * after random entries and sys_humber_aclqos_entry_delete() on the mac key
+ * block, with the chip replaced by a row model of DsAclMacKey.
+ *
+ *     bench_sys_acl_tcam [entries] [ops]
+ *
+ * Every entry carries its id in the mac sa, so the model knows which entry a
+ * key write puts in a row. The model fails the run when a key write lands on
+ * a row of another entry, or when the last row of an entry is removed outside
+ * of the delete of that entry: a lookup of it would miss.
+ *
+ * The block of [entries] rows is filled to 90% after random entries or at the
+ * head, then [ops] deletes and inserts churn it, and the row order must match
+ * the reference priority list after every operation. The churned block is
+ * defragmented with sys_humber_aclqos_entry_defrag() in steps of at most
+ * BENCH_DEFRAG_MOVES rows to the end, and churned again with a defrag step
+ * after every BENCH_DEFRAG_EVERY operations, checked the same way.
+ *
+ * Last, [ops] operations without and with the defrag steps are timed without
+ * the per operation check, for the install rate and the rows moved per insert
+ * and per operation from sys_humber_aclqos_entry_get_block_stats().
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "ctc_error.h"
+#include "ctc_aclqos.h"
+#include "ctc_linklist.h"
+#include "sys_humber_chip.h"
+#include "sys_humber_ftm.h"
+#include "sys_humber_stats.h"
+#include "sys_humber_aclqos_label.h"
+#include "sys_humber_qos_policer.h"
+#include "sys_humber_aclqos_entry.h"
+#include "sys_humber_nexthop_api.h"
+#include "sys_humber_nexthop.h"
+#include "drv_humber.h"
+#include "drv_io.h"
+
+#define BENCH_ENTRIES       1024
+#define BENCH_ENTRIES_MAX   16384
+#define BENCH_OPS           20000
+#define BENCH_DFT_ENTRIES   5
+#define BENCH_LABEL_ID      1
+#define BENCH_DEFRAG_MOVES  64
+#define BENCH_DEFRAG_EVERY  16
+
+static uint32 bench_seed = 1;
+
+/* row model of DsAclMacKey, entry id per row, 0 for a free row */
+static uint32* bench_row;
+static uint32  bench_row_num;
+static uint16* bench_copies;
+static uint32  bench_deleting;
+static uint32  bench_writes;
+static int32   bench_failed;
+
+/* reference priority order and the ids not in use */
+static uint32* bench_order;
+static uint32  bench_order_num;
+static uint32* bench_idle;
+static uint32  bench_idle_num;
+
+static uint32 bench_entries = BENCH_ENTRIES;
+static sys_alloc_info_t bench_alloc_info;
+static sys_aclqos_label_index_t bench_label_index;
+static sys_aclqos_label_t bench_label;
+
+static uint32
+_bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (bench_seed >> 16) | (bench_seed << 16);
+}
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/*
+ * chip and the modules the entry code calls, only the acl mac key rows are
+ * modelled
+ */
+int32
+drv_tbl_ioctl(uint8 chip_id, int32 index, uint32 cmd, void* val)
+{
+    tbl_entry_t* p_key = val;
+    uint32 id;
+
+    if (cmd != DRV_IOW(IOC_TABLE, DS_ACL_MAC_KEY, DRV_ENTRY_FLAG))
+    {
+        return DRV_E_NONE;
+    }
+
+    id = ((ds_acl_mac_key_t*)p_key->data_entry)->mac_sal;
+    if ((index < 0) || (index >= bench_row_num))
+    {
+        printf("entry %u written to row %d past the block\n", id, index);
+        bench_failed = 1;
+        return DRV_E_NONE;
+    }
+    if (bench_row[index] && (bench_row[index] != id))
+    {
+        printf("entry %u written over entry %u at row %d\n", id, bench_row[index], index);
+        bench_failed = 1;
+    }
+    if (bench_row[index] != id)
+    {
+        bench_copies[id]++;
+        bench_row[index] = id;
+    }
+    bench_writes++;
+
+    return DRV_E_NONE;
+}
+
+int32
+drv_tcam_tbl_remove(uint8 chip_id, int32 tbl_id, uint32 index)
+{
+    uint32 id;
+
+    if (tbl_id != DS_ACL_MAC_KEY)
+    {
+        return DRV_E_NONE;
+    }
+
+    id = bench_row[index];
+    if (!id)
+    {
+        return DRV_E_NONE;
+    }
+    if ((1 == bench_copies[id]) && (id != bench_deleting))
+    {
+        printf("entry %u left the tcam at row %u\n", id, index);
+        bench_failed = 1;
+    }
+    bench_copies[id]--;
+    bench_row[index] = 0;
+
+    return DRV_E_NONE;
+}
+
+int32
+drv_reg_ioctl(uint8 chip_id, int32 index, uint32 cmd, void* val)
+{
+    return DRV_E_NONE;
+}
+
+sys_alloc_info_t*
+sys_alloc_get_alloc_info_ptr(void)
+{
+    return &bench_alloc_info;
+}
+
+int32
+sys_alloc_get_dual_lookup_en(uint8* dual_lkp_en, uint8* merge_mackey_en)
+{
+    *dual_lkp_en = 0;
+    *merge_mackey_en = 0;
+    return CTC_E_NONE;
+}
+
+int32
+sys_alloc_get_met_dsfwd_table_info(uint32* global_met_entry_num, uint32* local_met_dsfwd_entry_num)
+{
+    *global_met_entry_num = 0;
+    *local_met_dsfwd_entry_num = 0;
+    return CTC_E_NONE;
+}
+
+int32
+sys_alloc_get_table_entry_num(uint32 table_id, uint32* entry_num)
+{
+    *entry_num = bench_entries + BENCH_DFT_ENTRIES;
+    return CTC_E_NONE;
+}
+
+int32
+sys_humber_aclqos_label_lookup(uint32 label_id, uint8 is_service_label, sys_aclqos_label_t** pp_label)
+{
+    *pp_label = (BENCH_LABEL_ID == label_id) ? &bench_label : NULL;
+    return CTC_E_NONE;
+}
+
+uint8
+sys_humber_get_local_chip_num(void)
+{
+    return 1;
+}
+
+int32
+sys_humber_nh_get_dsfwd_offset(uint32 nhid, sys_nh_offset_array_t offset_array)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_nh_get_l3ifid(uint32 nhid, uint16* p_l3ifid)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_nh_get_nhinfo_by_nhid(uint32 nhid, sys_nh_info_com_t** pp_nhinfo)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_qos_flow_policer_bind(uint8 lchip, uint32 plc_id)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_qos_flow_policer_unbind(uint8 lchip, uint32 plc_id)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_qos_policer_index_get(uint8 lchip, uint32 plc_id, uint32* p_index)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_stats_create_statsptr(uint8 lchip, uint8 stats_szie, uint16* p_stats_ptr)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_stats_delete_statsptr(uint8 lchip, uint8 stats_szie, uint16 stats_ptr)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_stats_get_flow_stats(uint8 lchip, uint16 stats_ptr, ctc_stats_basic_t* p_stats)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+int32
+sys_humber_stats_reset_flow_stats(uint8 lchip, uint16 stats_ptr)
+{
+    return CTC_E_NOT_SUPPORT;
+}
+
+/*
+ * insert an idle id after a random entry or at the head, and the same in the
+ * reference order
+ */
+static int32
+_bench_insert(void)
+{
+    ctc_aclqos_entry_t entry;
+    uint32 after_id = CTC_ACLQOS_ENTRY_ID_HEAD;
+    uint32 pos = 0;
+    uint32 n, id;
+    int32 ret;
+
+    n = _bench_rand() % bench_idle_num;
+    id = bench_idle[n];
+    bench_idle[n] = bench_idle[--bench_idle_num];
+
+    if (bench_order_num && (_bench_rand() % 16))
+    {
+        n = _bench_rand() % bench_order_num;
+        after_id = bench_order[n];
+        pos = n + 1;
+    }
+
+    kal_memset(&entry, 0, sizeof(entry));
+    entry.entry_id = id;
+    entry.key.type = CTC_ACLQOS_MAC_KEY;
+    entry.key.key_info.mac_key.flag = CTC_ACLQOS_MAC_KEY_MACSA_FLAG;
+    entry.key.key_info.mac_key.mac_sa[2] = (id >> 24) & 0xFF;
+    entry.key.key_info.mac_key.mac_sa[3] = (id >> 16) & 0xFF;
+    entry.key.key_info.mac_key.mac_sa[4] = (id >> 8) & 0xFF;
+    entry.key.key_info.mac_key.mac_sa[5] = id & 0xFF;
+    kal_memset(entry.key.key_info.mac_key.mac_sa_mask, 0xFF, sizeof(mac_addr_t));
+
+    ret = sys_humber_aclqos_entry_insert(BENCH_LABEL_ID, CTC_ACL_LABEL, after_id, &entry);
+    if (ret)
+    {
+        printf("insert of entry %u after %u returned %d\n", id, after_id, ret);
+        return -1;
+    }
+
+    memmove(&bench_order[pos + 1], &bench_order[pos], (bench_order_num - pos) * sizeof(uint32));
+    bench_order[pos] = id;
+    bench_order_num++;
+
+    return 0;
+}
+
+static int32
+_bench_delete(void)
+{
+    uint32 n, id;
+    int32 ret;
+
+    n = _bench_rand() % bench_order_num;
+    id = bench_order[n];
+
+    bench_deleting = id;
+    ret = sys_humber_aclqos_entry_delete(BENCH_LABEL_ID, CTC_ACL_LABEL, CTC_ACLQOS_MAC_KEY, id);
+    bench_deleting = 0;
+    if (ret)
+    {
+        printf("delete of entry %u returned %d\n", id, ret);
+        return -1;
+    }
+
+    memmove(&bench_order[n], &bench_order[n + 1], (bench_order_num - n - 1) * sizeof(uint32));
+    bench_order_num--;
+    bench_idle[bench_idle_num++] = id;
+
+    return 0;
+}
+
+/*
+ * the entries in row order must be the reference order, each in one row
+ */
+static int32
+_bench_check(void)
+{
+    uint32 row, n = 0;
+
+    if (bench_failed)
+    {
+        return -1;
+    }
+
+    for (row = 0; row < bench_entries; row++)
+    {
+        if (!bench_row[row])
+        {
+            continue;
+        }
+        if ((n >= bench_order_num) || (bench_row[row] != bench_order[n]))
+        {
+            printf("row %u holds entry %u, %u expected\n", row, bench_row[row],
+                   (n < bench_order_num) ? bench_order[n] : 0);
+            return -1;
+        }
+        if (bench_copies[bench_row[row]] != 1)
+        {
+            printf("entry %u is in %u rows\n", bench_row[row], bench_copies[bench_row[row]]);
+            return -1;
+        }
+        n++;
+    }
+    if (n != bench_order_num)
+    {
+        printf("%u entries in the tcam, %u expected\n", n, bench_order_num);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * longest run of used rows in the model
+ */
+static uint32
+_bench_longest_run(void)
+{
+    uint32 row, run = 0, run_max = 0;
+
+    for (row = 0; row < bench_entries; row++)
+    {
+        run = bench_row[row] ? (run + 1) : 0;
+        if (run > run_max)
+        {
+            run_max = run;
+        }
+    }
+
+    return run_max;
+}
+
+/*
+ * [ops] deletes and inserts, with a defrag of at most BENCH_DEFRAG_MOVES rows
+ * after every defrag_every of them unless defrag_every is 0
+ */
+static int32
+_bench_churn(uint32 ops, bool check, uint32 defrag_every)
+{
+    uint32 moves;
+    uint32 n;
+    int32 ret;
+
+    for (n = 0; n < ops; n++)
+    {
+        if (_bench_delete() || _bench_insert())
+        {
+            return -1;
+        }
+        if (check && _bench_check())
+        {
+            return -1;
+        }
+        if (defrag_every && !((n + 1) % defrag_every))
+        {
+            ret = sys_humber_aclqos_entry_defrag(BENCH_DEFRAG_MOVES, &moves);
+            if (ret)
+            {
+                printf("defrag returned %d\n", ret);
+                return -1;
+            }
+            if (check && _bench_check())
+            {
+                return -1;
+            }
+        }
+    }
+
+    return _bench_check();
+}
+
+/*
+ * time [ops] deletes and inserts and print a line of the result table
+ */
+static int32
+_bench_timed_churn(char* name, uint32 ops, uint32 defrag_every)
+{
+    sys_acl_block_stats_t stats, last;
+    struct timespec start;
+    double sec;
+
+    sys_humber_aclqos_entry_get_block_stats(SYS_ACL_ASIC_TYPE_MAC, &last);
+    bench_writes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (_bench_churn(ops, FALSE, defrag_every))
+    {
+        return -1;
+    }
+    sec = _bench_elapsed(&start);
+    sys_humber_aclqos_entry_get_block_stats(SYS_ACL_ASIC_TYPE_MAC, &stats);
+
+    printf("%-12s %12.1f %12.0f %10.2f %12.2f %12.2f\n", name, sec * 1e9 / ops, ops / sec,
+           (double)(stats.insert_moves - last.insert_moves) / (stats.insert_count - last.insert_count),
+           (double)(stats.defrag_moves - last.defrag_moves) / ops,
+           (double)bench_writes / ops);
+
+    return 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+    ctc_aclqos_global_cfg_t cfg;
+    sys_acl_block_stats_t stats;
+    uint32 run, total, steps, moves;
+    uint32 fill, n;
+    int32 ops = BENCH_OPS;
+
+    if (argc > 1)
+    {
+        bench_entries = atoi(argv[1]);
+    }
+    if (argc > 2)
+    {
+        ops = atoi(argv[2]);
+    }
+    if ((bench_entries < 32) || (bench_entries > BENCH_ENTRIES_MAX))
+    {
+        fprintf(stderr, "entries must be in [32, %u]\n", BENCH_ENTRIES_MAX);
+        return 1;
+    }
+    if (ops < 1)
+    {
+        fprintf(stderr, "ops must be positive\n");
+        return 1;
+    }
+
+    bench_row_num = bench_entries + BENCH_DFT_ENTRIES;
+    bench_row = calloc(bench_row_num, sizeof(uint32));
+    bench_copies = calloc(bench_entries * 2 + 1, sizeof(uint16));
+    bench_order = calloc(bench_entries, sizeof(uint32));
+    bench_idle = calloc(bench_entries * 2, sizeof(uint32));
+    if (!bench_row || !bench_copies || !bench_order || !bench_idle)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (n = 0; n < bench_entries * 2; n++)
+    {
+        bench_idle[bench_idle_num++] = n + 1;
+    }
+
+    bench_label.id = BENCH_LABEL_ID;
+    bench_label.type = SYS_PORT_ACL_LABEL;
+    bench_label.p_index[0] = &bench_label_index;
+    for (n = 0; n < MAX_CTC_ACLQOS_KEY; n++)
+    {
+        ctc_list_pointer_init(&bench_label_index.entry_list[n]);
+    }
+
+    bench_alloc_info.disable_merge_mac_ip_key_physical = 1;
+    kal_memset(&cfg, 0, sizeof(cfg));
+    cfg.entry_sort_mode = CTC_ACLQOS_ENTRY_SORT_MODE_PER_SYSTEM;
+    if (sys_humber_aclqos_entry_init(&cfg))
+    {
+        fprintf(stderr, "sys_humber_aclqos_entry_init failed\n");
+        return 1;
+    }
+
+    fill = bench_entries * 9 / 10;
+    for (n = 0; n < fill; n++)
+    {
+        if (_bench_insert() || _bench_check())
+        {
+            return 1;
+        }
+    }
+    sys_humber_aclqos_entry_get_block_stats(SYS_ACL_ASIC_TYPE_MAC, &stats);
+    printf("filled %u of %u rows: %.2f rows moved per insert, %u at most\n",
+           fill, bench_entries, (double)stats.insert_moves / stats.insert_count, stats.insert_moves_max);
+
+    if (_bench_churn(ops, TRUE, 0))
+    {
+        return 1;
+    }
+    printf("checked %d deletes and inserts at %u entries\n", ops, fill);
+
+    /* defrag the churned block to the end, checking every step */
+    run = _bench_longest_run();
+    total = 0;
+    steps = 0;
+    do
+    {
+        if (sys_humber_aclqos_entry_defrag(BENCH_DEFRAG_MOVES, &moves) || _bench_check())
+        {
+            return 1;
+        }
+        total += moves;
+        steps++;
+    } while (moves && (steps < bench_entries));
+    printf("defrag: longest used run %u -> %u, %u rows moved in %u steps of at most %u\n",
+           run, _bench_longest_run(), total, steps - 1, BENCH_DEFRAG_MOVES);
+
+    if (_bench_churn(ops, TRUE, BENCH_DEFRAG_EVERY))
+    {
+        return 1;
+    }
+    printf("checked %d deletes and inserts with a defrag every %u\n", ops, BENCH_DEFRAG_EVERY);
+
+    printf("%-12s %12s %12s %10s %12s %12s\n",
+           "churn", "ns/op", "inserts/s", "moves/ins", "defrag/op", "writes/op");
+    if (_bench_timed_churn("no defrag", ops, 0)
+        || _bench_timed_churn("defrag", ops, BENCH_DEFRAG_EVERY))
+    {
+        return 1;
+    }
+    sys_humber_aclqos_entry_get_block_stats(SYS_ACL_ASIC_TYPE_MAC, &stats);
+    printf("%u entries, %u rows moved by one insert at most\n", fill, stats.insert_moves_max);
+
+    return 0;
+}
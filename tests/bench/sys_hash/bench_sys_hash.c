@@ -0,0 +1,168 @@
+/*
+ * Check and benchmark of the humber bucket hashes: the per byte CRC tables
+ * sys_humber_hash_init() builds against the bit by bit arithmetic the
+ * generate functions use before it.
+ *
+ *     bench_sys_hash [keys]
+ *
+ * All six hashes of [keys] random keys, the all zero and all ones keys and
+ * every single bit key are computed bit by bit first, then again through
+ * the tables after sys_humber_hash_init(), and must match at every bucket
+ * width. Both passes are timed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "sys_humber_hash.h"
+
+#define BENCH_KEYS          100000
+#define BENCH_KEY_LEN       18
+#define BENCH_BIT_NUM_MAX   8
+
+typedef int16 (*bench_hash_t)(uint8*, uint32);
+
+static const struct
+{
+    bench_hash_t hash;
+    uint32 key_len;
+    char* name;
+} bench_hash[] =
+{
+    {sys_humber_hash_generate_mac_hash0, 8, "mac_hash0"},
+    {sys_humber_hash_generate_mac_hash1, 8, "mac_hash1"},
+    {sys_humber_hash_generate_ipv4_hash0, 6, "ipv4_hash0"},
+    {sys_humber_hash_generate_ipv4_hash1, 6, "ipv4_hash1"},
+    {sys_humber_hash_generate_ipv6_hash0, 18, "ipv6_hash0"},
+    {sys_humber_hash_generate_ipv6_hash1, 18, "ipv6_hash1"},
+};
+
+#define BENCH_HASH_NUM  (sizeof(bench_hash) / sizeof(bench_hash[0]))
+
+static uint32 bench_seed = 1;
+
+static uint32
+_bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (bench_seed >> 16) | (bench_seed << 16);
+}
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/* every hash of every key at every bucket width, returns ns per hash */
+static double
+_bench_run(uint8 (*key)[BENCH_KEY_LEN], uint32 num_key, int16* result)
+{
+    struct timespec start;
+    uint32 h, k, b;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (h = 0; h < BENCH_HASH_NUM; h++)
+    {
+        for (k = 0; k < num_key; k++)
+        {
+            for (b = 0; b <= BENCH_BIT_NUM_MAX; b++)
+            {
+                *result++ = bench_hash[h].hash(key[k], b);
+            }
+        }
+    }
+
+    return _bench_elapsed(&start) * 1e9 / ((double)BENCH_HASH_NUM * num_key * (BENCH_BIT_NUM_MAX + 1));
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint8 (*key)[BENCH_KEY_LEN];
+    int16* bitwise;
+    int16* table;
+    uint32 num_key, num_result;
+    uint32 h, k, b, i;
+    double bitwise_ns, table_ns;
+    int32 count = BENCH_KEYS;
+
+    if (argc > 1)
+    {
+        count = atoi(argv[1]);
+    }
+    if (count < 1)
+    {
+        fprintf(stderr, "keys must be positive\n");
+        return 1;
+    }
+
+    num_key = count + 2 + BENCH_KEY_LEN * 8;
+    num_result = BENCH_HASH_NUM * num_key * (BENCH_BIT_NUM_MAX + 1);
+    key = calloc(num_key, BENCH_KEY_LEN);
+    bitwise = malloc(num_result * sizeof(int16));
+    table = malloc(num_result * sizeof(int16));
+    if (!key || !bitwise || !table)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    k = 0;
+    for (i = 0; i < (uint32)count; i++, k++)
+    {
+        for (b = 0; b < BENCH_KEY_LEN; b++)
+        {
+            key[k][b] = _bench_rand();
+        }
+    }
+    k++;
+    memset(key[k++], 0xFF, BENCH_KEY_LEN);
+    for (i = 0; i < BENCH_KEY_LEN * 8; i++, k++)
+    {
+        key[k][i / 8] = 1 << (i % 8);
+    }
+
+    bitwise_ns = _bench_run(key, num_key, bitwise);
+
+    if (sys_humber_hash_init())
+    {
+        fprintf(stderr, "sys_humber_hash_init failed\n");
+        return 1;
+    }
+
+    table_ns = _bench_run(key, num_key, table);
+
+    i = 0;
+    for (h = 0; h < BENCH_HASH_NUM; h++)
+    {
+        for (k = 0; k < num_key; k++)
+        {
+            for (b = 0; b <= BENCH_BIT_NUM_MAX; b++, i++)
+            {
+                if (bitwise[i] != table[i])
+                {
+                    printf("%s key %u bit_num %u: bitwise 0x%04x table 0x%04x\n", bench_hash[h].name,
+                           k, b, (uint16)bitwise[i], (uint16)table[i]);
+                    return 1;
+                }
+            }
+        }
+    }
+    printf("checked %u keys of %u hashes at %u bucket widths\n",
+           num_key, (uint32)BENCH_HASH_NUM, BENCH_BIT_NUM_MAX + 1);
+
+    printf("%-12s %12s\n", "path", "ns per hash");
+    printf("%-12s %12.2f\n", "bitwise", bitwise_ns);
+    printf("%-12s %12.2f\n", "table", table_ns);
+
+    free(table);
+    free(bitwise);
+    free(key);
+
+    return 0;
+}
@@ -0,0 +1,424 @@
+/*
+ * Check and benchmark of the opf offset pools:
+ *
+ *     bench_sys_opf [ops]
+ *
+ * First [ops] random operations run on each of BENCH_SHAPES pools of random
+ * start offset and size: forward, reverse and last allocs of random block
+ * sizes and multiples, allocs at a given position, frees of allocated
+ * blocks and of free offsets. A plain byte per offset reference model does
+ * the same first or last fit, and every return code, offset and both
+ * allocation marks must match it. At the end of each pool every block is
+ * freed and the whole pool must be allocatable again as one block.
+ *
+ * Then a 16K pool is filled with single offsets, every other one and a few
+ * more are freed, and alloc/free of 1, 2 and 8 offset blocks is timed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "ctc_error.h"
+#include "sys_humber_opf.h"
+
+#define BENCH_OPS           20000
+#define BENCH_SHAPES        200
+#define BENCH_MAX_SIZE      4000
+#define BENCH_TIMED_SIZE    16384
+#define BENCH_TIMED_OPS     200000
+
+extern sys_humber_opf_master_t* p_opf_master;
+
+struct bench_ref_s
+{
+    uint8 used[BENCH_MAX_SIZE];
+    uint32 start;
+    uint32 size;
+    uint32 max_pre;     /* max_offset_for_pre_alloc */
+    uint32 min_rev;     /* min_offset_for_rev_alloc */
+};
+typedef struct bench_ref_s bench_ref_t;
+
+static bench_ref_t bench_ref;
+static uint32 bench_offset[BENCH_MAX_SIZE];
+static uint32 bench_block[BENCH_MAX_SIZE];
+static uint32 bench_seed = 1;
+
+static uint32
+_bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (bench_seed >> 16) | (bench_seed << 16);
+}
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static bool
+_bench_ref_fits(uint32 pos, uint32 block_size)
+{
+    uint32 i;
+
+    if (pos + block_size > bench_ref.size)
+    {
+        return FALSE;
+    }
+    for (i = pos; i < pos + block_size; i++)
+    {
+        if (bench_ref.used[i])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/* first fit under min_rev, last fit under min_rev or last fit from max_pre */
+static int32
+_bench_ref_alloc(bool is_reverse, bool is_last, uint32 multiple, uint32 block_size, uint32* offset)
+{
+    uint32 lo, hi, pos;
+    bool found = FALSE;
+
+    block_size = block_size ? block_size : 1;
+    multiple = multiple ? multiple : 1;
+    if (block_size > bench_ref.size)
+    {
+        return CTC_E_INVALID_PARAM;
+    }
+
+    lo = is_reverse ? bench_ref.max_pre - bench_ref.start : 0;
+    hi = is_reverse ? bench_ref.size : bench_ref.min_rev - bench_ref.start;
+    if (is_reverse || is_last)
+    {
+        for (pos = hi; !found && (pos >= lo + block_size); pos--)
+        {
+            found = ((bench_ref.start + pos - block_size) % multiple == 0)
+                    && _bench_ref_fits(pos - block_size, block_size);
+        }
+        pos -= found ? block_size - 1 : 0;
+    }
+    else
+    {
+        for (pos = lo; !found && (pos + block_size <= hi); pos++)
+        {
+            found = ((bench_ref.start + pos) % multiple == 0) && _bench_ref_fits(pos, block_size);
+        }
+        pos -= found ? 1 : 0;
+    }
+    if (!found)
+    {
+        return CTC_E_NO_ALLOC_OFFSET;
+    }
+
+    memset(&bench_ref.used[pos], 1, block_size);
+    *offset = bench_ref.start + pos;
+    if (is_reverse)
+    {
+        bench_ref.min_rev = (*offset < bench_ref.min_rev) ? *offset : bench_ref.min_rev;
+    }
+    else if (*offset + block_size > bench_ref.max_pre)
+    {
+        bench_ref.max_pre = *offset + block_size;
+    }
+
+    return CTC_E_NONE;
+}
+
+static int32
+_bench_ref_alloc_from_position(uint32 block_size, uint32 begin)
+{
+    block_size = block_size ? block_size : 1;
+    if (block_size > bench_ref.size)
+    {
+        return CTC_E_INVALID_PARAM;
+    }
+    if ((begin < bench_ref.start) || (begin + block_size > bench_ref.min_rev))
+    {
+        return CTC_E_NO_OFFSET_LEFT;
+    }
+    if (!_bench_ref_fits(begin - bench_ref.start, block_size))
+    {
+        return CTC_E_NO_ALLOC_OFFSET;
+    }
+
+    memset(&bench_ref.used[begin - bench_ref.start], 1, block_size);
+    if (begin + block_size > bench_ref.max_pre)
+    {
+        bench_ref.max_pre = begin + block_size;
+    }
+
+    return CTC_E_NONE;
+}
+
+/* a free pulls the mark of its side back over the free run it joined */
+static int32
+_bench_ref_free(uint32 block_size, uint32 offset)
+{
+    uint32 i;
+
+    block_size = block_size ? block_size : 1;
+    if ((offset < bench_ref.start) || (offset + block_size > bench_ref.start + bench_ref.size))
+    {
+        return CTC_E_INVALID_PARAM;
+    }
+    for (i = offset - bench_ref.start; i < offset - bench_ref.start + block_size; i++)
+    {
+        if (!bench_ref.used[i])
+        {
+            return CTC_E_INVALID_PARAM;
+        }
+    }
+
+    memset(&bench_ref.used[offset - bench_ref.start], 0, block_size);
+    if (offset >= bench_ref.max_pre)
+    {
+        while ((bench_ref.min_rev < bench_ref.start + bench_ref.size)
+               && !bench_ref.used[bench_ref.min_rev - bench_ref.start])
+        {
+            bench_ref.min_rev++;
+        }
+    }
+    else
+    {
+        while ((bench_ref.max_pre > bench_ref.start) && !bench_ref.used[bench_ref.max_pre - bench_ref.start - 1])
+        {
+            bench_ref.max_pre--;
+        }
+    }
+
+    return CTC_E_NONE;
+}
+
+static int32
+_bench_check_shape(uint8 pool_index, int32 ops)
+{
+    sys_humber_opf_t opf;
+    uint32 num = 0;
+    uint32 block_size, multiple, offset, ref_offset, begin, i;
+    int32 ret, ref_ret;
+    int32 op;
+    bool is_reverse, is_last;
+
+    memset(&bench_ref, 0, sizeof(bench_ref));
+    bench_ref.start = _bench_rand() % 100;
+    bench_ref.size = 1 + _bench_rand() % ((pool_index % 3) ? 200 : BENCH_MAX_SIZE);
+    bench_ref.max_pre = bench_ref.start;
+    bench_ref.min_rev = bench_ref.start + bench_ref.size;
+
+    memset(&opf, 0, sizeof(opf));
+    opf.pool_type = OPF_USRID_VLAN_KEY;
+    opf.pool_index = pool_index;
+    if (sys_humber_opf_init_offset(&opf, bench_ref.start, bench_ref.size))
+    {
+        printf("pool %u: init failed\n", pool_index);
+        return -1;
+    }
+
+    for (op = 0; op < ops; op++)
+    {
+        block_size = _bench_rand() % ((_bench_rand() % 4) ? 4 : 40);
+        multiple = 1 + _bench_rand() % ((_bench_rand() % 2) ? 1 : 8);
+        offset = ref_offset = 0;
+
+        switch (_bench_rand() % 10)
+        {
+        case 0: case 1: case 2: case 3: case 4:
+            is_reverse = (_bench_rand() % 3 == 0);
+            is_last = !is_reverse && (_bench_rand() % 5 == 0);
+            if (is_reverse)
+            {
+                ret = sys_humber_opf_reverse_alloc_multiple_offset(&opf, multiple, block_size, &offset);
+            }
+            else if (is_last)
+            {
+                multiple = 1;
+                ret = sys_humber_opf_alloc_offset_last(&opf, block_size, &offset);
+            }
+            else
+            {
+                ret = sys_humber_opf_alloc_multiple_offset(&opf, multiple, block_size, &offset);
+            }
+            ref_ret = _bench_ref_alloc(is_reverse, is_last, multiple, block_size, &ref_offset);
+            if ((ret != ref_ret) || (!ret && (offset != ref_offset)))
+            {
+                printf("pool %u op %d: %s alloc of %u x%u returned %d/%u, expected %d/%u\n", pool_index, op,
+                       is_reverse ? "reverse" : (is_last ? "last" : "forward"), block_size, multiple,
+                       ret, offset, ref_ret, ref_offset);
+                return -1;
+            }
+            if (!ret)
+            {
+                bench_offset[num] = offset;
+                bench_block[num++] = block_size ? block_size : 1;
+            }
+            break;
+
+        case 5:
+            begin = bench_ref.start + _bench_rand() % bench_ref.size;
+            ret = sys_humber_opf_alloc_offset_from_position(&opf, block_size, begin);
+            ref_ret = _bench_ref_alloc_from_position(block_size, begin);
+            if (ret != ref_ret)
+            {
+                printf("pool %u op %d: alloc of %u at %u returned %d, expected %d\n",
+                       pool_index, op, block_size, begin, ret, ref_ret);
+                return -1;
+            }
+            if (!ret)
+            {
+                bench_offset[num] = begin;
+                bench_block[num++] = block_size ? block_size : 1;
+            }
+            break;
+
+        default:
+            if (0 == num)
+            {
+                break;
+            }
+            i = _bench_rand() % num;
+            ret = sys_humber_opf_free_offset(&opf, bench_block[i], bench_offset[i]);
+            ref_ret = _bench_ref_free(bench_block[i], bench_offset[i]);
+            if (ret || ref_ret)
+            {
+                printf("pool %u op %d: free of %u at %u returned %d/%d\n",
+                       pool_index, op, bench_block[i], bench_offset[i], ret, ref_ret);
+                return -1;
+            }
+            num--;
+            bench_offset[i] = bench_offset[num];
+            bench_block[i] = bench_block[num];
+
+            /* a free offset must be refused */
+            begin = bench_ref.start + _bench_rand() % bench_ref.size;
+            if (!bench_ref.used[begin - bench_ref.start]
+                && (sys_humber_opf_free_offset(&opf, 1, begin) != CTC_E_INVALID_PARAM))
+            {
+                printf("pool %u op %d: free of free offset %u accepted\n", pool_index, op, begin);
+                return -1;
+            }
+            break;
+        }
+
+        if ((bench_ref.max_pre != p_opf_master->max_offset_for_pre_alloc[opf.pool_type][pool_index])
+            || (bench_ref.min_rev != p_opf_master->min_offset_for_rev_alloc[opf.pool_type][pool_index]))
+        {
+            printf("pool %u op %d: marks %u/%u, expected %u/%u\n", pool_index, op,
+                   p_opf_master->max_offset_for_pre_alloc[opf.pool_type][pool_index],
+                   p_opf_master->min_offset_for_rev_alloc[opf.pool_type][pool_index],
+                   bench_ref.max_pre, bench_ref.min_rev);
+            return -1;
+        }
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        if (sys_humber_opf_free_offset(&opf, bench_block[i], bench_offset[i]))
+        {
+            printf("pool %u: final free of %u at %u failed\n", pool_index, bench_block[i], bench_offset[i]);
+            return -1;
+        }
+    }
+    if (sys_humber_opf_alloc_offset(&opf, bench_ref.size, &offset) || (offset != bench_ref.start))
+    {
+        printf("pool %u: whole pool not free after freeing every block\n", pool_index);
+        return -1;
+    }
+
+    return 0;
+}
+
+static double
+_bench_run(sys_humber_opf_t* p_opf, uint32 block_size)
+{
+    struct timespec start;
+    uint32 offset;
+    uint32 i, ops = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCH_TIMED_OPS; i++)
+    {
+        ops++;
+        if (!sys_humber_opf_alloc_offset(p_opf, block_size, &offset))
+        {
+            sys_humber_opf_free_offset(p_opf, block_size, offset);
+            ops++;
+        }
+    }
+
+    return _bench_elapsed(&start) * 1e9 / ops;
+}
+
+int
+main(int argc, char* argv[])
+{
+    static const uint32 block_size[] = {1, 2, 8};
+    sys_humber_opf_t opf;
+    struct timespec start;
+    uint32 offset, num, i;
+    int32 ops = BENCH_OPS;
+
+    if (argc > 1)
+    {
+        ops = atoi(argv[1]);
+    }
+    if (ops < 1)
+    {
+        fprintf(stderr, "ops must be positive\n");
+        return 1;
+    }
+
+    if (sys_humber_opf_init(OPF_USRID_VLAN_KEY, BENCH_SHAPES)
+        || sys_humber_opf_init(OPF_USRID_MAC_KEY, 1))
+    {
+        fprintf(stderr, "sys_humber_opf_init failed\n");
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCH_SHAPES; i++)
+    {
+        if (_bench_check_shape(i, ops))
+        {
+            return 1;
+        }
+    }
+    printf("checked %d ops on each of %u pools in %.2fs\n", ops, BENCH_SHAPES, _bench_elapsed(&start));
+
+    memset(&opf, 0, sizeof(opf));
+    opf.pool_type = OPF_USRID_MAC_KEY;
+    if (sys_humber_opf_init_offset(&opf, 0, BENCH_TIMED_SIZE))
+    {
+        fprintf(stderr, "sys_humber_opf_init_offset failed\n");
+        return 1;
+    }
+    for (num = 0; !sys_humber_opf_alloc_offset(&opf, 1, &offset); num++)
+    {
+        ;
+    }
+    for (i = 0; i < num; i += 2)
+    {
+        sys_humber_opf_free_offset(&opf, 1, i);
+    }
+    for (i = 0; i < 64; i++)
+    {
+        sys_humber_opf_free_offset(&opf, 1, 2 * (_bench_rand() % (num / 2)) + 1);
+    }
+
+    printf("%u offsets, %u one offset holes\n", num, num / 2);
+    printf("%-8s %12s\n", "block", "ns per op");
+    for (i = 0; i < sizeof(block_size) / sizeof(block_size[0]); i++)
+    {
+        printf("%-8u %12.1f\n", block_size[i], _bench_run(&opf, block_size[i]));
+    }
+
+    return 0;
+}
@@ -0,0 +1,480 @@
+/*
+ * Benchmark of the idle timeout stats sweep: the forwarding stats of every
+ * flow read with one sys_humber_stats_get_flow_stats() per flow in flow
+ * order, as the timer did, against the stats ptrs radix sorted as
+ * adpt_flow_sweep_sort() does and read with
+ * sys_humber_stats_get_flow_stats_bulk() in chunks of BENCH_CHUNK, as
+ * hal_stats_get_stats_bulk() does, with DsForwardingStats replaced by a
+ * counter model.
+ *
+ *     bench_sys_stats_sweep [sweeps]
+ *
+ * For 2.5K and 10K flows, BENCH_HIT_ONE of the flows are hit in the model
+ * before each of [sweeps] sweeps. Both reads are diffed against a snapshot
+ * indexed by stats ptr, and each must find the hit flows and no other, with
+ * the counters the model holds. A stats ptr freed after the flows were
+ * collected must read as 0 from the bulk read.
+ *
+ * The wall time per sweep covers the read and the diff, not the hits.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kal.h"
+#include "ctc_error.h"
+#include "sys_humber_chip.h"
+#include "sys_humber_ftm.h"
+#include "sys_humber_opf.h"
+#include "sys_humber_register.h"
+#include "sys_humber_stats.h"
+#include "drv_humber.h"
+#include "drv_humber_data_path.h"
+#include "drv_io.h"
+
+#define BENCH_SWEEPS        20
+#define BENCH_FLOWS_MAX     10000
+#define BENCH_CHUNK         64
+#define BENCH_HIT_ONE       8
+#define BENCH_PTR_BASE      768
+#define BENCH_SRAM_SIZE     0x10000
+
+static const uint32 bench_flows[] = {2500, 10000};
+
+static uint32 bench_seed = 1;
+
+/* counter model of DsForwardingStats */
+static ds_forwarding_stats_t* bench_sram;
+static uint32 bench_reads;
+
+/* stats ptr of each flow, in flow order and sorted */
+static uint16 bench_ptr[BENCH_FLOWS_MAX];
+static uint16 bench_sorted[BENCH_FLOWS_MAX];
+static uint16 bench_scratch[BENCH_FLOWS_MAX];
+static ctc_stats_basic_t bench_stats[BENCH_FLOWS_MAX];
+
+/* packet count of the last sweep per stats ptr, one for each read */
+static uint64 bench_flow_snapshot[BENCH_SRAM_SIZE];
+static uint64 bench_bulk_snapshot[BENCH_SRAM_SIZE];
+
+static uint32
+_bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (bench_seed >> 16) | (bench_seed << 16);
+}
+
+static double
+_bench_elapsed(struct timespec* start)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/*
+ * chip and the modules the stats code calls, only DsForwardingStats is
+ * modelled
+ */
+int32
+drv_tbl_ioctl(uint8 chip_id, int32 index, uint32 cmd, void* val)
+{
+    if ((index < 0) || (index >= BENCH_SRAM_SIZE))
+    {
+        return DRV_E_EXCEED_MAX_SIZE;
+    }
+
+    if (cmd == DRV_IOR(IOC_TABLE, DS_FORWARDING_STATS, DRV_ENTRY_FLAG))
+    {
+        bench_reads++;
+        kal_memcpy(val, &bench_sram[index], sizeof(ds_forwarding_stats_t));
+    }
+    else if (cmd == DRV_IOW(IOC_TABLE, DS_FORWARDING_STATS, DRV_ENTRY_FLAG))
+    {
+        kal_memcpy(&bench_sram[index], val, sizeof(ds_forwarding_stats_t));
+    }
+
+    return DRV_E_NONE;
+}
+
+int32
+drv_reg_ioctl(uint8 chip_id, int32 index, uint32 cmd, void* val)
+{
+    return DRV_E_NONE;
+}
+
+int32
+drv_get_platform_type(drv_work_platform_type_t* platform_type)
+{
+    *platform_type = SW_SIM_PLATFORM;
+    return DRV_E_NONE;
+}
+
+uint8
+drv_humber_gmac_is_enable(uint8 gmac_id)
+{
+    return FALSE;
+}
+
+uint8
+drv_humber_qmac_is_enable(uint8 qmac_id)
+{
+    return FALSE;
+}
+
+uint8
+drv_humber_sgmac_is_enable(uint8 sgmac_id)
+{
+    return FALSE;
+}
+
+uint8
+drv_humber_xgmac_is_enable(uint8 xgmac_id)
+{
+    return FALSE;
+}
+
+int32
+sys_alloc_get_ext_qdr_en(uint8* ext_qdr_en)
+{
+    *ext_qdr_en = 0;
+    return CTC_E_NONE;
+}
+
+bool
+sys_humber_chip_is_local(uint8 gchip_id, uint8* lchip_id)
+{
+    *lchip_id = 0;
+    return (0 == gchip_id) ? TRUE : FALSE;
+}
+
+uint8
+sys_humber_get_local_chip_num(void)
+{
+    return 1;
+}
+
+int32
+sys_humber_global_ctl_get(ctc_global_control_type_t type, void* value)
+{
+    *(uint32*)value = 0;
+    return CTC_E_NONE;
+}
+
+/* bench_ptr into bench_sorted by the low then the high byte */
+static void
+_bench_sort(uint32 flows)
+{
+    uint32 count[2][256];
+    uint32 sum[2] = {0, 0};
+    uint32 tmp;
+    uint32 i, b;
+
+    kal_memset(count, 0, sizeof(count));
+    for (i = 0; i < flows; i++)
+    {
+        count[0][bench_ptr[i] & 0xFF]++;
+        count[1][bench_ptr[i] >> 8]++;
+    }
+    for (b = 0; b < 256; b++)
+    {
+        tmp = count[0][b];
+        count[0][b] = sum[0];
+        sum[0] += tmp;
+        tmp = count[1][b];
+        count[1][b] = sum[1];
+        sum[1] += tmp;
+    }
+
+    for (i = 0; i < flows; i++)
+    {
+        bench_scratch[count[0][bench_ptr[i] & 0xFF]++] = bench_ptr[i];
+    }
+    for (i = 0; i < flows; i++)
+    {
+        bench_sorted[count[1][bench_scratch[i] >> 8]++] = bench_scratch[i];
+    }
+}
+
+/* hit BENCH_HIT_ONE of the flows in the model */
+static uint32
+_bench_hit(uint32 flows)
+{
+    ds_forwarding_stats_t* p_ds;
+    uint32 pkts, hits = 0;
+    uint32 i;
+
+    for (i = 0; i < flows; i++)
+    {
+        if (_bench_rand() % BENCH_HIT_ONE)
+        {
+            continue;
+        }
+        p_ds = &bench_sram[bench_ptr[i]];
+        pkts = _bench_rand() % 1000 + 1;
+        p_ds->packet_count += pkts;
+        p_ds->byte_count_lower += pkts * 64;
+        hits++;
+    }
+
+    return hits;
+}
+
+/* one read per flow in flow order, the count of flows whose counter moved */
+static int32
+_bench_sweep_flow(uint32 flows, uint32* p_matched)
+{
+    ctc_stats_basic_t stats;
+    uint32 i;
+
+    *p_matched = 0;
+    for (i = 0; i < flows; i++)
+    {
+        CTC_ERROR_RETURN(sys_humber_stats_get_flow_stats(0, bench_ptr[i], &stats));
+        bench_stats[i] = stats;
+        if (stats.packet_count != bench_flow_snapshot[bench_ptr[i]])
+        {
+            bench_flow_snapshot[bench_ptr[i]] = stats.packet_count;
+            (*p_matched)++;
+        }
+    }
+
+    return CTC_E_NONE;
+}
+
+/* the stats ptrs sorted and read in chunks, the count of flows whose counter moved */
+static int32
+_bench_sweep_bulk(uint32 flows, uint32* p_matched)
+{
+    uint32 base, num, i;
+
+    _bench_sort(flows);
+    for (base = 0; base < flows; base += num)
+    {
+        num = (flows - base > BENCH_CHUNK) ? BENCH_CHUNK : flows - base;
+        CTC_ERROR_RETURN(sys_humber_stats_get_flow_stats_bulk(0, bench_sorted + base, num,
+                                                              bench_stats + base));
+    }
+
+    *p_matched = 0;
+    for (i = 0; i < flows; i++)
+    {
+        if (bench_stats[i].packet_count != bench_bulk_snapshot[bench_sorted[i]])
+        {
+            bench_bulk_snapshot[bench_sorted[i]] = bench_stats[i].packet_count;
+            (*p_matched)++;
+        }
+    }
+
+    return CTC_E_NONE;
+}
+
+/* every hit flow and no other moved, and the reads match the model */
+static int32
+_bench_check(uint32 flows, uint32 hits)
+{
+    ds_forwarding_stats_t* p_ds;
+    uint32 matched, i;
+
+    if (_bench_sweep_flow(flows, &matched) || (matched != hits))
+    {
+        printf("%u flows: per flow read found %u of %u hits\n", flows, matched, hits);
+        return -1;
+    }
+    for (i = 0; i < flows; i++)
+    {
+        p_ds = &bench_sram[bench_ptr[i]];
+        if ((bench_stats[i].packet_count != p_ds->packet_count)
+            || (bench_stats[i].byte_count != p_ds->byte_count_lower))
+        {
+            printf("stats ptr %u: per flow read %llu packets, the chip holds %u\n",
+                   bench_ptr[i], (unsigned long long)bench_stats[i].packet_count, p_ds->packet_count);
+            return -1;
+        }
+    }
+
+    if (_bench_sweep_bulk(flows, &matched) || (matched != hits))
+    {
+        printf("%u flows: bulk read found %u of %u hits\n", flows, matched, hits);
+        return -1;
+    }
+    for (i = 0; i < flows; i++)
+    {
+        if (i && (bench_sorted[i] <= bench_sorted[i - 1]))
+        {
+            printf("stats ptr %u sorted after %u\n", bench_sorted[i], bench_sorted[i - 1]);
+            return -1;
+        }
+        p_ds = &bench_sram[bench_sorted[i]];
+        if ((bench_stats[i].packet_count != p_ds->packet_count)
+            || (bench_stats[i].byte_count != p_ds->byte_count_lower))
+        {
+            printf("stats ptr %u: bulk read %llu packets, the chip holds %u\n",
+                   bench_sorted[i], (unsigned long long)bench_stats[i].packet_count, p_ds->packet_count);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* give a flow a cleared stats ptr, as the flow code does */
+static int32
+_bench_alloc(uint16* p_ptr)
+{
+    CTC_ERROR_RETURN(sys_humber_stats_create_statsptr(0, 1, p_ptr));
+    CTC_ERROR_RETURN(sys_humber_stats_reset_flow_stats(0, *p_ptr));
+    bench_flow_snapshot[*p_ptr] = 0;
+    bench_bulk_snapshot[*p_ptr] = 0;
+
+    return CTC_E_NONE;
+}
+
+/* the stats ptr of the first flow freed after the flows were collected reads as 0 */
+static int32
+_bench_check_freed(void)
+{
+    ctc_stats_basic_t stats[2];
+    uint16 ptr[2];
+    uint32 freed;
+
+    freed = (bench_ptr[0] < bench_ptr[1]) ? 0 : 1;
+    ptr[freed] = bench_ptr[0];
+    ptr[!freed] = bench_ptr[1];
+    bench_sram[bench_ptr[0]].packet_count += 1;
+
+    if (sys_humber_stats_delete_statsptr(0, 1, bench_ptr[0])
+        || sys_humber_stats_get_flow_stats_bulk(0, ptr, 2, stats))
+    {
+        printf("stats ptr %u: free and bulk read failed\n", bench_ptr[0]);
+        return -1;
+    }
+    if (stats[freed].packet_count || stats[freed].byte_count
+        || (stats[!freed].packet_count != bench_sram[bench_ptr[1]].packet_count))
+    {
+        printf("stats ptr %u: read %llu packets after the free\n", bench_ptr[0],
+               (unsigned long long)stats[freed].packet_count);
+        return -1;
+    }
+
+    return _bench_alloc(&bench_ptr[0]);
+}
+
+int
+main(int argc, char* argv[])
+{
+    sys_humber_opf_t opf;
+    struct timespec start;
+    double flow_sec, bulk_sec;
+    uint32 flow_reads, bulk_reads;
+    uint32 flows, hits, matched;
+    uint32 f, i, j;
+    uint16 ptr;
+    int32 sweeps = BENCH_SWEEPS;
+    int32 s;
+
+    if (argc > 1)
+    {
+        sweeps = atoi(argv[1]);
+    }
+    if (sweeps < 1)
+    {
+        fprintf(stderr, "sweeps must be positive\n");
+        return 1;
+    }
+
+    /*
+     * the internal sram has stats ptrs for 2816 flows, the pool is set up
+     * before sys_humber_stats_init() so each of the 10K flows has its own
+     */
+    bench_sram = calloc(BENCH_SRAM_SIZE, sizeof(ds_forwarding_stats_t));
+    kal_memset(&opf, 0, sizeof(opf));
+    opf.pool_type = FWD_STATS_SRAM;
+    if (!bench_sram || sys_humber_opf_init(FWD_STATS_SRAM, 1)
+        || sys_humber_opf_init_offset(&opf, BENCH_PTR_BASE, BENCH_SRAM_SIZE - BENCH_PTR_BASE)
+        || sys_humber_stats_init())
+    {
+        fprintf(stderr, "sys_humber_stats_init failed\n");
+        return 1;
+    }
+
+    printf("%-8s %14s %14s %14s %14s\n", "flows", "per flow us", "bulk us", "per flow ns", "bulk ns");
+    for (f = 0; f < sizeof(bench_flows) / sizeof(bench_flows[0]); f++)
+    {
+        flows = bench_flows[f];
+        for (i = 0; i < flows; i++)
+        {
+            if (_bench_alloc(&bench_ptr[i]))
+            {
+                fprintf(stderr, "no stats ptr for flow %u\n", i);
+                return 1;
+            }
+        }
+
+        /* flows come out of the flow hash in no stats ptr order */
+        for (i = flows - 1; i > 0; i--)
+        {
+            j = _bench_rand() % (i + 1);
+            ptr = bench_ptr[i];
+            bench_ptr[i] = bench_ptr[j];
+            bench_ptr[j] = ptr;
+        }
+
+        for (s = 0; s < sweeps; s++)
+        {
+            if (_bench_check(flows, _bench_hit(flows)))
+            {
+                return 1;
+            }
+        }
+        if (_bench_check_freed() || _bench_check(flows, _bench_hit(flows)))
+        {
+            return 1;
+        }
+
+        flow_sec = bulk_sec = 0;
+        flow_reads = bulk_reads = 0;
+        for (s = 0; s < sweeps; s++)
+        {
+            hits = _bench_hit(flows);
+
+            bench_reads = 0;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            _bench_sweep_flow(flows, &matched);
+            flow_sec += _bench_elapsed(&start);
+            flow_reads += bench_reads;
+
+            bench_reads = 0;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            _bench_sweep_bulk(flows, &matched);
+            bulk_sec += _bench_elapsed(&start);
+            bulk_reads += bench_reads;
+
+            if (matched != hits)
+            {
+                printf("%u flows: bulk read found %u of %u hits\n", flows, matched, hits);
+                return 1;
+            }
+        }
+
+        printf("%-8u %14.1f %14.1f %14.1f %14.1f\n", flows,
+               flow_sec * 1e6 / sweeps, bulk_sec * 1e6 / sweeps,
+               flow_sec * 1e9 / sweeps / flows, bulk_sec * 1e9 / sweeps / flows);
+        if ((flow_reads != (uint32)sweeps * flows) || (bulk_reads != flow_reads))
+        {
+            printf("%u flows: %u per flow and %u bulk chip reads for %d sweeps\n",
+                   flows, flow_reads, bulk_reads, sweeps);
+            return 1;
+        }
+
+        for (i = 0; i < flows; i++)
+        {
+            sys_humber_stats_delete_statsptr(0, 1, bench_ptr[i]);
+        }
+    }
+    printf("checked %d sweeps of %u hit flows in one, per sweep wall time of the read and diff\n",
+           sweeps, BENCH_HIT_ONE);
+
+    return 0;
+}